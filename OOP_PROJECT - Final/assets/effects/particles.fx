@@ -0,0 +1,86 @@
+# Particle effects for Color Swap Runner
+#
+# Each "emitter <name> ... end" block describes one effect. The game looks
+# them up by name when it starts (dash, dash_trail, color_change, dodge,
+# wall_pass, pickup, explosion); a missing one falls back to "sparks", which
+# a block here may also redefine. Edit and restart - no recompiling.
+#
+#   shape burst|cone|ring|continuous
+#                                burst: every direction; cone: within spread
+#                                of the direction the game gives; ring: evenly
+#                                spaced; continuous: count per second for as
+#                                long as the game keeps it running
+#   count n                      particles per emit (continuous: per second)
+#   speed min max                pixels per second
+#   lifetime min max             seconds
+#   size min max                 radius in pixels at birth
+#   spread degrees               width of cones and continuous emitters
+#   size_curve k...              size multiplier over the lifetime
+#   alpha_curve k...             opacity 0-1 over the lifetime
+#   color_curve k...             "base" (the color the game asks for) or RRGGBB
+#
+# Curve keys are evenly spaced from birth to death and blended linearly.
+# Anything left out is as in sparks: burst, count 10, speed 50 200,
+# lifetime 0.5 1.5, size 2 6, spread 360, size_curve 1, alpha_curve 1 0,
+# color_curve base.
+
+# Blown out behind a dashing player
+emitter dash
+    shape cone
+    count 20
+    spread 70
+    speed 120 320
+    lifetime 0.3 0.7
+    size 2 5
+    size_curve 1 0.4
+end
+
+# Follows the player while the dash lasts
+emitter dash_trail
+    shape continuous
+    count 90
+    speed 10 40
+    lifetime 0.25 0.5
+    size 3 5
+    size_curve 1 0.2
+    alpha_curve 0.8 0
+end
+
+emitter color_change
+    count 15
+    speed 40 140
+    lifetime 0.4 0.9
+    color_curve ffffff base base
+end
+
+emitter dodge
+    count 15
+end
+
+emitter wall_pass
+    shape ring
+    count 30
+    speed 220 260
+    lifetime 0.6 0.9
+    size 3 5
+    size_curve 1 1.5 0.5
+    alpha_curve 1 1 0
+end
+
+emitter pickup
+    shape ring
+    count 25
+    speed 90 110
+    lifetime 0.5 0.8
+    color_curve ffffff base
+end
+
+emitter explosion
+    count 30
+    speed 60 260
+    lifetime 0.6 1.6
+    size 3 7
+    size_curve 1 1.3 0.6
+    alpha_curve 1 0.8 0
+    color_curve ffffff ffcc66 base base
+end
@@ -0,0 +1,58 @@
+#ifndef ALLOCTRACKER_H
+#define ALLOCTRACKER_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Which part of the frame an allocation happened in
+enum class AllocPhase {
+    OTHER,       // Startup, shutdown and every thread except the game thread
+    INPUT,
+    UPDATE,
+    COLLISION,
+    RENDER,
+    PRESENT,     // window.display() - driver allocations end up here
+    OVERLAY,     // Debug stats overlay (allowed to allocate)
+    COUNT
+};
+
+// Allocations made during one frame
+struct FrameAllocStats {
+    uint64_t count[static_cast<int>(AllocPhase::COUNT)];
+    uint64_t bytes[static_cast<int>(AllocPhase::COUNT)];
+
+    uint64_t totalCount() const;
+    uint64_t totalBytes() const;
+    // Allocations made by our own game code (input, update, collision, render)
+    uint64_t gameplayCount() const;
+};
+
+// Counts every call to the global operator new, over-aligned forms included
+// (hooked in AllocTracker.cpp)
+class AllocTracker {
+public:
+    static void setPhase(AllocPhase phase);
+    static AllocPhase getPhase();
+
+    // Allocations since the previous call
+    static FrameAllocStats endFrame();
+
+    static const char* getPhaseName(AllocPhase phase);
+};
+
+// Sets the phase for the current scope and restores the previous one after
+class AllocPhaseScope {
+private:
+    AllocPhase previous;
+
+public:
+    explicit AllocPhaseScope(AllocPhase phase) : previous(AllocTracker::getPhase()) {
+        AllocTracker::setPhase(phase);
+    }
+    ~AllocPhaseScope() { AllocTracker::setPhase(previous); }
+
+    AllocPhaseScope(const AllocPhaseScope&) = delete;
+    AllocPhaseScope& operator=(const AllocPhaseScope&) = delete;
+};
+
+#endif
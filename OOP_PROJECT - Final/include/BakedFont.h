@@ -0,0 +1,74 @@
+#ifndef BAKEDFONT_H
+#define BAKEDFONT_H
+
+#include <cstdint>
+
+// The UI font is rasterized ahead of time by tools/font_baker into one atlas
+// (BakedFontData.h), so the game needs no font files or FreeType at runtime
+// and never stalls the first time a text size shows up.
+//
+// Each style is a character size and outline thickness as the UI uses them,
+// baked with just the characters it needs. After changing a style or a UI
+// string with new characters, re-run the baker:
+//   font_baker assets/fonts/ARIALN.TTF include/BakedFontData.h
+enum class FontStyle {
+    STATS,          // Debug overlay
+    SMALL,          // Dash cooldown
+    MEDIUM,         // Menu instructions, restart prompt
+    SCORE,
+    LARGE,          // Combo, final score
+    GAME_OVER,
+    TITLE,
+    COUNT
+};
+
+struct BakedFontStyle {
+    unsigned size;
+    unsigned outline;           // Outline thickness in pixels (0 = none)
+    const char* characters;
+};
+
+constexpr const char* PRINTABLE_ASCII =
+    " !\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`abcdefghijklmnopqrstuvwxyz{|}~";
+
+// In FontStyle order
+constexpr BakedFontStyle BAKED_FONT_STYLES[static_cast<int>(FontStyle::COUNT)] = {
+    {18, 1, PRINTABLE_ASCII},
+    {24, 0, "Dash: READY [SPACE]0123456789.s-"},
+    {32, 2, PRINTABLE_ASCII},
+    {36, 2, "Score: 0123456789-"},
+    {48, 3, "COMBO xFinal Score: 0123456789-"},
+    {72, 4, "GAME OVER"},
+    {96, 5, "COLOR SWAP RUNNER! (2.0)"},
+};
+
+// Where a glyph image sits in the atlas and where it goes relative to the
+// pen (on the baseline). Includes a transparent 1 px border for smoothing.
+struct BakedGlyphImage {
+    uint16_t x, y;
+    uint16_t width, height;
+    int16_t left, top;
+};
+
+struct BakedGlyph {
+    char character;
+    float advance;
+    BakedGlyphImage fill;
+    BakedGlyphImage outline;    // Empty for styles without an outline
+};
+
+// Pen adjustment between two characters; only non-zero pairs are baked
+struct BakedKerning {
+    char first, second;
+    int16_t amount;
+};
+
+struct BakedStyleInfo {
+    float lineSpacing;
+    uint16_t firstGlyph;        // Into BAKED_GLYPHS, sorted by character
+    uint16_t glyphCount;
+    uint16_t firstKerning;      // Into BAKED_KERNING, sorted by pair
+    uint16_t kerningCount;
+};
+
+#endif
@@ -0,0 +1,10515 @@
+// Generated by tools/font_baker from ARIALN.TTF - do not edit.
+#ifndef BAKEDFONTDATA_H
+#define BAKEDFONTDATA_H
+
+#include "BakedFont.h"
+#include <cstddef>
+
+constexpr unsigned BAKED_ATLAS_WIDTH = 1024;
+constexpr unsigned BAKED_ATLAS_HEIGHT = 512;
+
+constexpr BakedStyleInfo BAKED_STYLE_INFO[7] = {
+    {21.0f, 0, 95, 0, 2022},
+    {28.0f, 95, 27, 2022, 125},
+    {37.0f, 122, 95, 2147, 1897},
+    {41.0f, 217, 18, 4044, 8},
+    {55.0f, 235, 28, 4052, 85},
+    {83.0f, 263, 8, 4137, 18},
+    {110.0f, 271, 18, 4155, 66},
+};
+
+constexpr BakedGlyph BAKED_GLYPHS[289] = {
+    {' ', 4.00f, {0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0}},
+    {'!', 4.00f, {739, 344, 5, 16, 0, -15}, {185, 344, 7, 18, -1, -16}},
+    {'"', 5.00f, {35, 379, 7, 7, -1, -15}, {934, 363, 9, 9, -2, -16}},
+    {'#', 10.00f, {857, 344, 10, 16, 0, -15}, {284, 344, 12, 18, -1, -16}},
+    {'$', 9.00f, {982, 321, 11, 19, -1, -16}, {430, 321, 13, 21, -2, -17}},
+    {'%', 13.00f, {756, 344, 15, 16, -1, -15}, {657, 344, 17, 18, -2, -16}},
+    {'&', 10.00f, {699, 344, 12, 17, -1, -15}, {895, 321, 14, 19, -2, -16}},
+    {'\'', 3.00f, {14, 379, 5, 7, -1, -15}, {952, 363, 7, 9, -2, -16}},
+    {'(', 5.00f, {745, 321, 7, 20, -1, -15}, {268, 321, 9, 22, -2, -16}},
+    {')', 5.00f, {718, 321, 7, 20, -1, -15}, {259, 321, 9, 22, -2, -16}},
+    {'*', 6.00f, {972, 363, 8, 8, -1, -15}, {858, 363, 11, 10, -2, -16}},
+    {'+', 9.00f, {826, 363, 9, 11, 0, -12}, {592, 363, 11, 13, -1, -13}},
+    {',', 4.00f, {42, 379, 5, 7, 0, -3}, {898, 363, 7, 9, -1, -4}},
+    {'-', 6.00f, {83, 379, 6, 5, 0, -7}, {27, 379, 8, 7, -1, -8}},
+    {'.', 4.00f, {152, 379, 5, 4, 0, -3}, {56, 379, 7, 6, -1, -4}},
+    {'/', 4.00f, {171, 363, 7, 16, -1, -15}, {56, 344, 10, 18, -3, -16}},
+    {'0', 8.00f, {103, 363, 11, 16, -1, -15}, {505, 344, 13, 18, -2, -16}},
+    {'1', 8.00f, {245, 363, 7, 16, 0, -15}, {525, 344, 9, 18, -1, -16}},
+    {'2', 8.00f, {274, 363, 10, 16, 0, -15}, {587, 344, 12, 18, -1, -16}},
+    {'3', 8.00f, {229, 363, 11, 16, -1, -15}, {632, 344, 13, 18, -2, -16}},
+    {'4', 8.00f, {878, 344, 9, 16, 0, -15}, {681, 344, 11, 18, -1, -16}},
+    {'5', 8.00f, {912, 344, 10, 16, -1, -15}, {235, 344, 12, 18, -2, -16}},
+    {'6', 8.00f, {973, 344, 11, 16, -1, -15}, {310, 344, 13, 18, -2, -16}},
+    {'7', 8.00f, {994, 344, 9, 16, 0, -15}, {347, 344, 11, 18, -1, -16}},
+    {'8', 8.00f, {1008, 344, 11, 16, -1, -15}, {413, 344, 13, 18, -2, -16}},
+    {'9', 8.00f, {92, 363, 11, 16, -1, -15}, {160, 344, 13, 18, -2, -16}},
+    {':', 4.00f, {766, 363, 5, 12, 0, -11}, {372, 363, 7, 14, -1, -12}},
+    {';', 4.00f, {318, 363, 5, 15, 0, -11}, {692, 344, 7, 17, -1, -12}},
+    {'<', 9.00f, {670, 363, 9, 12, 0, -13}, {361, 363, 11, 14, -1, -14}},
+    {'=', 9.00f, {1012, 363, 9, 8, 0, -11}, {835, 363, 11, 10, -1, -12}},
+    {'>', 9.00f, {686, 363, 9, 12, 0, -13}, {350, 363, 11, 14, -1, -14}},
+    {'?', 9.00f, {72, 363, 10, 16, 0, -15}, {464, 344, 13, 18, -2, -16}},
+    {'@', 15.00f, {673, 321, 17, 20, -1, -15}, {326, 321, 19, 22, -2, -16}},
+    {'A', 10.00f, {43, 363, 13, 16, -2, -15}, {449, 344, 15, 18, -3, -16}},
+    {'B', 10.00f, {31, 363, 12, 16, -1, -15}, {435, 344, 14, 18, -2, -16}},
+    {'C', 11.00f, {19, 363, 12, 16, -1, -15}, {386, 344, 15, 18, -2, -16}},
+    {'D', 10.00f, {0, 363, 12, 16, -1, -15}, {358, 344, 14, 18, -2, -16}},
+    {'E', 10.00f, {867, 344, 11, 16, -1, -15}, {259, 344, 13, 18, -2, -16}},
+    {'F', 8.00f, {935, 344, 10, 16, -1, -15}, {223, 344, 12, 18, -2, -16}},
+    {'G', 11.00f, {922, 344, 13, 16, -1, -15}, {192, 344, 15, 18, -2, -16}},
+    {'H', 10.00f, {900, 344, 12, 16, -1, -15}, {491, 344, 14, 18, -2, -16}},
+    {'I', 4.00f, {252, 363, 5, 16, 0, -15}, {518, 344, 7, 18, -1, -16}},
+    {'J', 7.00f, {220, 363, 9, 16, -1, -15}, {121, 344, 11, 18, -2, -16}},
+    {'K', 9.00f, {188, 363, 12, 16, -1, -15}, {92, 344, 14, 18, -2, -16}},
+    {'L', 8.00f, {178, 363, 10, 16, -1, -15}, {173, 344, 12, 18, -2, -16}},
+    {'M', 12.00f, {157, 363, 14, 16, -1, -15}, {144, 344, 16, 18, -2, -16}},
+    {'N', 10.00f, {145, 363, 12, 16, -1, -15}, {42, 344, 14, 18, -2, -16}},
+    {'O', 12.00f, {131, 363, 14, 16, -1, -15}, {207, 344, 16, 18, -2, -16}},
+    {'P', 10.00f, {744, 344, 12, 16, -1, -15}, {477, 344, 14, 18, -2, -16}},
+    {'Q', 12.00f, {711, 344, 14, 17, -1, -15}, {802, 321, 16, 19, -2, -16}},
+    {'R', 10.00f, {783, 344, 12, 16, -1, -15}, {372, 344, 14, 18, -2, -16}},
+    {'S', 10.00f, {833, 344, 12, 16, -1, -15}, {296, 344, 14, 18, -2, -16}},
+    {'T', 10.00f, {811, 344, 10, 16, 0, -15}, {247, 344, 12, 18, -1, -16}},
+    {'U', 10.00f, {821, 344, 12, 16, -1, -15}, {611, 344, 14, 18, -2, -16}},
+    {'V', 10.00f, {845, 344, 12, 16, -1, -15}, {573, 344, 14, 18, -2, -16}},
+    {'W', 14.00f, {795, 344, 16, 16, -1, -15}, {543, 344, 18, 18, -2, -16}},
+    {'X', 10.00f, {771, 344, 12, 16, -1, -15}, {78, 344, 14, 18, -2, -16}},
+    {'Y', 9.00f, {887, 344, 13, 16, -2, -15}, {106, 344, 15, 18, -3, -16}},
+    {'Z', 10.00f, {114, 363, 10, 16, 0, -15}, {132, 344, 12, 18, -1, -16}},
+    {'[', 4.00f, {656, 321, 6, 20, -1, -15}, {277, 321, 8, 22, -2, -16}},
+    {'\\', 4.00f, {124, 363, 7, 16, -1, -15}, {32, 344, 10, 18, -3, -16}},
+    {']', 4.00f, {702, 321, 6, 20, -1, -15}, {309, 321, 8, 22, -2, -16}},
+    {'^', 7.00f, {884, 363, 9, 10, -1, -15}, {800, 363, 11, 12, -2, -16}},
+    {'_', 8.00f, {117, 379, 12, 5, -2, -1}, {0, 379, 14, 7, -3, -2}},
+    {'`', 5.00f, {129, 379, 6, 5, -1, -15}, {19, 379, 8, 7, -2, -16}},
+    {'a', 8.00f, {735, 363, 10, 12, -1, -11}, {452, 363, 12, 14, -2, -12}},
+    {'b', 8.00f, {200, 363, 10, 16, -1, -15}, {66, 344, 12, 18, -2, -16}},
+    {'c', 8.00f, {725, 363, 10, 12, -1, -11}, {440, 363, 12, 14, -2, -12}},
+    {'d', 8.00f, {284, 363, 10, 16, -1, -15}, {335, 344, 12, 18, -2, -16}},
+    {'e', 8.00f, {695, 363, 10, 12, -1, -11}, {416, 363, 12, 14, -2, -12}},
+    {'f', 6.00f, {257, 363, 7, 16, 0, -15}, {534, 344, 9, 18, -1, -16}},
+    {'g', 8.00f, {264, 363, 10, 16, -1, -11}, {561, 344, 12, 18, -2, -12}},
+    {'h', 8.00f, {294, 363, 10, 16, -1, -15}, {599, 344, 12, 18, -2, -16}},
+    {'i', 3.00f, {240, 363, 5, 16, -1, -15}, {625, 344, 7, 18, -2, -16}},
+    {'j', 3.00f, {594, 321, 6, 20, -2, -15}, {301, 321, 8, 22, -3, -16}},
+    {'k', 7.00f, {210, 363, 10, 16, -1, -15}, {645, 344, 12, 18, -2, -16}},
+    {'l', 3.00f, {1003, 344, 5, 16, -1, -15}, {674, 344, 7, 18, -2, -16}},
+    {'m', 13.00f, {811, 363, 15, 12, -1, -11}, {399, 363, 17, 14, -2, -12}},
+    {'n', 8.00f, {613, 363, 10, 12, -1, -11}, {428, 363, 12, 14, -2, -12}},
+    {'o', 9.00f, {633, 363, 11, 12, -1, -11}, {464, 363, 13, 14, -2, -12}},
+    {'p', 8.00f, {963, 344, 10, 16, -1, -11}, {272, 344, 12, 18, -2, -12}},
+    {'q', 8.00f, {984, 344, 10, 16, -1, -11}, {323, 344, 12, 18, -2, -12}},
+    {'r', 5.00f, {679, 363, 7, 12, -1, -11}, {389, 363, 10, 14, -2, -12}},
+    {'s', 8.00f, {705, 363, 10, 12, -1, -11}, {527, 363, 12, 14, -2, -12}},
+    {'t', 6.00f, {12, 363, 7, 16, 0, -15}, {426, 344, 9, 18, -1, -16}},
+    {'u', 8.00f, {623, 363, 10, 12, -1, -11}, {551, 363, 12, 14, -2, -12}},
+    {'v', 7.00f, {603, 363, 10, 12, -1, -11}, {539, 363, 12, 14, -2, -12}},
+    {'w', 11.00f, {753, 363, 13, 12, -1, -11}, {486, 363, 16, 14, -3, -12}},
+    {'x', 7.00f, {771, 363, 10, 12, -1, -11}, {502, 363, 12, 14, -2, -12}},
+    {'y', 7.00f, {82, 363, 10, 16, -1, -11}, {401, 344, 12, 18, -2, -12}},
+    {'z', 8.00f, {745, 363, 8, 12, 0, -11}, {379, 363, 10, 14, -1, -12}},
+    {'{', 5.00f, {759, 321, 7, 20, -1, -15}, {317, 321, 9, 22, -2, -16}},
+    {'|', 4.00f, {651, 321, 5, 20, 0, -15}, {285, 321, 7, 22, -1, -16}},
+    {'}', 5.00f, {752, 321, 7, 20, -1, -15}, {292, 321, 9, 22, -2, -16}},
+    {'~', 9.00f, {47, 379, 9, 6, 0, -10}, {1001, 363, 11, 8, -1, -11}},
+    {' ', 5.00f, {0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0}},
+    {'-', 7.00f, {157, 379, 7, 4, 0, -8}, {0, 0, 0, 0, 0, 0}},
+    {'.', 5.00f, {99, 379, 4, 5, 1, -4}, {0, 0, 0, 0, 0, 0}},
+    {'0', 11.00f, {553, 321, 11, 20, 0, -19}, {0, 0, 0, 0, 0, 0}},
+    {'1', 11.00f, {737, 321, 8, 20, 1, -19}, {0, 0, 0, 0, 0, 0}},
+    {'2', 11.00f, {662, 321, 11, 20, 0, -19}, {0, 0, 0, 0, 0, 0}},
+    {'3', 11.00f, {690, 321, 12, 20, 0, -19}, {0, 0, 0, 0, 0, 0}},
+    {'4', 11.00f, {725, 321, 12, 20, 0, -19}, {0, 0, 0, 0, 0, 0}},
+    {'5', 11.00f, {483, 321, 12, 20, -1, -19}, {0, 0, 0, 0, 0, 0}},
+    {'6', 11.00f, {542, 321, 11, 20, 0, -19}, {0, 0, 0, 0, 0, 0}},
+    {'7', 11.00f, {613, 321, 11, 20, 0, -19}, {0, 0, 0, 0, 0, 0}},
+    {'8', 11.00f, {472, 321, 11, 20, 0, -19}, {0, 0, 0, 0, 0, 0}},
+    {'9', 11.00f, {461, 321, 11, 20, 0, -19}, {0, 0, 0, 0, 0, 0}},
+    {':', 5.00f, {323, 363, 4, 15, 1, -14}, {0, 0, 0, 0, 0, 0}},
+    {'A', 13.00f, {509, 321, 17, 20, -2, -19}, {0, 0, 0, 0, 0, 0}},
+    {'C', 14.00f, {579, 321, 15, 20, 0, -19}, {0, 0, 0, 0, 0, 0}},
+    {'D', 14.00f, {637, 321, 14, 20, 0, -19}, {0, 0, 0, 0, 0, 0}},
+    {'E', 14.00f, {624, 321, 13, 20, 1, -19}, {0, 0, 0, 0, 0, 0}},
+    {'P', 14.00f, {600, 321, 13, 20, 1, -19}, {0, 0, 0, 0, 0, 0}},
+    {'R', 14.00f, {564, 321, 15, 20, 1, -19}, {0, 0, 0, 0, 0, 0}},
+    {'S', 13.00f, {495, 321, 14, 20, -1, -19}, {0, 0, 0, 0, 0, 0}},
+    {'Y', 13.00f, {526, 321, 16, 20, -2, -19}, {0, 0, 0, 0, 0, 0}},
+    {'[', 6.00f, {938, 294, 6, 25, 0, -19}, {0, 0, 0, 0, 0, 0}},
+    {']', 6.00f, {944, 294, 6, 25, 0, -19}, {0, 0, 0, 0, 0, 0}},
+    {'a', 11.00f, {338, 363, 12, 15, 0, -14}, {0, 0, 0, 0, 0, 0}},
+    {'h', 10.00f, {708, 321, 10, 20, 0, -19}, {0, 0, 0, 0, 0, 0}},
+    {'s', 10.00f, {327, 363, 11, 15, -1, -14}, {0, 0, 0, 0, 0, 0}},
+    {' ', 7.00f, {0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0}},
+    {'!', 8.00f, {950, 294, 5, 25, 2, -24}, {972, 230, 9, 29, 0, -26}},
+    {'"', 9.00f, {869, 363, 9, 10, 0, -24}, {514, 363, 13, 14, -2, -26}},
+    {'#', 16.00f, {955, 294, 16, 25, 0, -24}, {842, 230, 20, 29, -2, -26}},
+    {'$', 14.00f, {663, 230, 15, 31, -1, -27}, {114, 230, 19, 35, -3, -29}},
+    {'%', 23.00f, {389, 294, 23, 25, 0, -24}, {705, 230, 27, 29, -2, -26}},
+    {'&', 17.00f, {49, 294, 18, 26, 0, -24}, {683, 230, 22, 30, -2, -26}},
+    {'\'', 5.00f, {893, 363, 5, 10, 0, -24}, {477, 363, 9, 14, -2, -26}},
+    {'(', 9.00f, {617, 230, 9, 31, 1, -24}, {37, 230, 13, 35, -1, -26}},
+    {')', 9.00f, {608, 230, 9, 31, 0, -24}, {24, 230, 13, 35, -2, -26}},
+    {'*', 11.00f, {644, 363, 12, 12, -1, -24}, {56, 363, 16, 16, -3, -26}},
+    {'+', 14.00f, {725, 344, 14, 17, 0, -20}, {443, 321, 18, 21, -2, -22}},
+    {',', 7.00f, {878, 363, 6, 10, 0, -4}, {563, 363, 10, 14, -2, -6}},
+    {'-', 9.00f, {103, 379, 9, 5, 0, -11}, {959, 363, 13, 9, -2, -13}},
+    {'.', 7.00f, {112, 379, 5, 5, 1, -4}, {943, 363, 9, 9, -1, -6}},
+    {'/', 7.00f, {333, 294, 10, 25, -1, -24}, {19, 265, 15, 29, -4, -26}},
+    {'0', 15.00f, {274, 294, 15, 25, 0, -24}, {34, 265, 19, 29, -2, -26}},
+    {'1', 15.00f, {442, 294, 10, 25, 1, -24}, {71, 265, 14, 29, -1, -26}},
+    {'2', 15.00f, {427, 294, 15, 25, 0, -24}, {85, 265, 19, 29, -2, -26}},
+    {'3', 15.00f, {412, 294, 15, 25, 0, -24}, {952, 230, 20, 29, -3, -26}},
+    {'4', 15.00f, {374, 294, 15, 25, 0, -24}, {124, 265, 19, 29, -2, -26}},
+    {'5', 15.00f, {358, 294, 16, 25, -1, -24}, {104, 265, 20, 29, -3, -26}},
+    {'6', 15.00f, {343, 294, 15, 25, 0, -24}, {354, 265, 19, 29, -2, -26}},
+    {'7', 15.00f, {319, 294, 14, 25, 0, -24}, {53, 265, 18, 29, -2, -26}},
+    {'8', 15.00f, {304, 294, 15, 25, 0, -24}, {0, 265, 19, 29, -2, -26}},
+    {'9', 15.00f, {289, 294, 15, 25, 0, -24}, {1000, 230, 19, 29, -2, -26}},
+    {':', 7.00f, {977, 321, 5, 19, 1, -18}, {19, 321, 9, 23, -1, -20}},
+    {';', 7.00f, {971, 294, 6, 24, 0, -18}, {822, 265, 10, 28, -2, -20}},
+    {'<', 15.00f, {962, 321, 15, 19, 0, -21}, {0, 321, 19, 23, -2, -23}},
+    {'=', 14.00f, {656, 363, 14, 12, 0, -18}, {945, 344, 18, 16, -2, -20}},
+    {'>', 15.00f, {947, 321, 15, 19, 0, -21}, {995, 294, 19, 23, -2, -23}},
+    {'?', 15.00f, {67, 294, 15, 25, 0, -24}, {981, 230, 19, 29, -2, -26}},
+    {'@', 27.00f, {626, 230, 27, 31, 0, -24}, {214, 230, 31, 35, -2, -26}},
+    {'A', 18.00f, {253, 294, 21, 25, -2, -24}, {927, 230, 25, 29, -4, -26}},
+    {'B', 17.00f, {237, 294, 16, 25, 1, -24}, {907, 230, 20, 29, -1, -26}},
+    {'C', 18.00f, {218, 294, 19, 25, 0, -24}, {884, 230, 23, 29, -2, -26}},
+    {'D', 19.00f, {200, 294, 18, 25, 1, -24}, {862, 230, 22, 29, -1, -26}},
+    {'E', 17.00f, {184, 294, 16, 25, 1, -24}, {822, 230, 20, 29, -1, -26}},
+    {'F', 16.00f, {127, 294, 15, 25, 1, -24}, {803, 230, 19, 29, -1, -26}},
+    {'G', 20.00f, {164, 294, 20, 25, 0, -24}, {779, 230, 24, 29, -2, -26}},
+    {'H', 19.00f, {147, 294, 17, 25, 1, -24}, {758, 230, 21, 29, -1, -26}},
+    {'I', 7.00f, {142, 294, 5, 25, 1, -24}, {749, 230, 9, 29, -1, -26}},
+    {'J', 13.00f, {114, 294, 13, 25, 0, -24}, {732, 230, 17, 29, -2, -26}},
+    {'K', 17.00f, {96, 294, 18, 25, 1, -24}, {435, 265, 22, 29, -1, -26}},
+    {'L', 14.00f, {82, 294, 14, 25, 1, -24}, {773, 265, 18, 29, -1, -26}},
+    {'M', 22.00f, {664, 294, 20, 25, 1, -24}, {749, 265, 24, 29, -1, -26}},
+    {'N', 19.00f, {921, 294, 17, 25, 1, -24}, {728, 265, 21, 29, -1, -26}},
+    {'O', 20.00f, {901, 294, 20, 25, 0, -24}, {704, 265, 24, 29, -2, -26}},
+    {'P', 18.00f, {884, 294, 17, 25, 1, -24}, {683, 265, 21, 29, -1, -26}},
+    {'Q', 20.00f, {22, 294, 21, 27, 0, -24}, {583, 230, 25, 31, -2, -26}},
+    {'R', 19.00f, {865, 294, 19, 25, 1, -24}, {660, 265, 23, 29, -1, -26}},
+    {'S', 18.00f, {847, 294, 18, 25, 0, -24}, {638, 265, 22, 29, -2, -26}},
+    {'T', 17.00f, {830, 294, 17, 25, 0, -24}, {617, 265, 21, 29, -2, -26}},
+    {'U', 19.00f, {813, 294, 17, 25, 1, -24}, {596, 265, 21, 29, -1, -26}},
+    {'V', 18.00f, {793, 294, 20, 25, -1, -24}, {572, 265, 24, 29, -3, -26}},
+    {'W', 25.00f, {766, 294, 27, 25, -1, -24}, {541, 265, 31, 29, -3, -26}},
+    {'X', 18.00f, {746, 294, 20, 25, -1, -24}, {517, 265, 24, 29, -3, -26}},
+    {'Y', 17.00f, {726, 294, 20, 25, -2, -24}, {493, 265, 24, 29, -4, -26}},
+    {'Z', 17.00f, {709, 294, 17, 25, 0, -24}, {472, 265, 21, 29, -2, -26}},
+    {'[', 8.00f, {576, 230, 7, 31, 1, -24}, {0, 230, 11, 35, -1, -26}},
+    {'\\', 7.00f, {699, 294, 10, 25, -1, -24}, {457, 265, 15, 29, -4, -26}},
+    {']', 8.00f, {560, 230, 8, 31, 0, -24}, {1007, 176, 12, 35, -2, -26}},
+    {'^', 12.00f, {304, 363, 14, 15, -1, -25}, {14, 344, 18, 19, -3, -27}},
+    {'_', 15.00f, {135, 379, 17, 4, -1, 1}, {980, 363, 21, 8, -3, -1}},
+    {'`', 9.00f, {76, 379, 7, 6, 0, -24}, {846, 363, 12, 10, -2, -26}},
+    {'a', 15.00f, {1008, 321, 15, 19, 0, -18}, {28, 321, 19, 23, -2, -20}},
+    {'b', 15.00f, {452, 294, 14, 25, 1, -24}, {283, 265, 18, 29, -1, -26}},
+    {'c', 13.00f, {818, 321, 14, 19, 0, -18}, {977, 294, 18, 23, -2, -20}},
+    {'d', 15.00f, {650, 294, 14, 25, 0, -24}, {161, 265, 18, 29, -2, -26}},
+    {'e', 15.00f, {993, 321, 15, 19, 0, -18}, {47, 321, 19, 23, -2, -20}},
+    {'f', 9.00f, {619, 294, 10, 25, 0, -24}, {179, 265, 15, 29, -2, -26}},
+    {'g', 15.00f, {605, 294, 14, 25, 0, -18}, {194, 265, 18, 29, -2, -20}},
+    {'h', 15.00f, {592, 294, 13, 25, 1, -24}, {212, 265, 17, 29, -1, -26}},
+    {'i', 6.00f, {587, 294, 5, 25, 1, -24}, {229, 265, 9, 29, -1, -26}},
+    {'j', 6.00f, {568, 230, 8, 31, -2, -24}, {11, 230, 13, 35, -5, -26}},
+    {'k', 13.00f, {573, 294, 14, 25, 1, -24}, {238, 265, 18, 29, -1, -26}},
+    {'l', 6.00f, {568, 294, 5, 25, 1, -24}, {256, 265, 9, 29, -1, -26}},
+    {'m', 22.00f, {766, 321, 21, 19, 1, -18}, {115, 321, 25, 23, -1, -20}},
+    {'n', 15.00f, {832, 321, 13, 19, 1, -18}, {203, 321, 17, 23, -1, -20}},
+    {'o', 15.00f, {845, 321, 15, 19, 0, -18}, {240, 321, 19, 23, -2, -20}},
+    {'p', 15.00f, {554, 294, 14, 25, 1, -18}, {265, 265, 18, 29, -1, -20}},
+    {'q', 15.00f, {540, 294, 14, 25, 0, -18}, {143, 265, 18, 29, -2, -20}},
+    {'r', 9.00f, {924, 321, 10, 19, 1, -18}, {84, 321, 14, 23, -1, -20}},
+    {'s', 13.00f, {0, 344, 14, 19, -1, -18}, {66, 321, 18, 23, -3, -20}},
+    {'t', 8.00f, {531, 294, 9, 25, 0, -24}, {301, 265, 13, 29, -2, -26}},
+    {'u', 15.00f, {934, 321, 13, 19, 1, -18}, {98, 321, 17, 23, -1, -20}},
+    {'v', 13.00f, {787, 321, 15, 19, -1, -18}, {140, 321, 19, 23, -3, -20}},
+    {'w', 19.00f, {860, 321, 21, 19, -1, -18}, {159, 321, 26, 23, -4, -20}},
+    {'x', 13.00f, {909, 321, 15, 19, -1, -18}, {220, 321, 20, 23, -3, -20}},
+    {'y', 13.00f, {516, 294, 15, 25, -1, -18}, {314, 265, 19, 29, -3, -20}},
+    {'z', 14.00f, {881, 321, 14, 19, 0, -18}, {185, 321, 18, 23, -2, -20}},
+    {'{', 9.00f, {653, 230, 10, 31, -1, -24}, {50, 230, 14, 35, -3, -26}},
+    {'|', 7.00f, {678, 230, 5, 31, 1, -24}, {64, 230, 9, 35, -1, -26}},
+    {'}', 9.00f, {550, 230, 10, 31, -1, -24}, {73, 230, 14, 35, -3, -26}},
+    {'~', 15.00f, {919, 363, 15, 9, 0, -16}, {573, 363, 19, 13, -2, -18}},
+    {' ', 8.00f, {0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0}},
+    {'-', 10.00f, {89, 379, 10, 5, 0, -12}, {905, 363, 14, 9, -2, -14}},
+    {'0', 16.00f, {851, 265, 16, 28, 0, -27}, {350, 230, 20, 32, -2, -29}},
+    {'1', 16.00f, {867, 265, 10, 28, 2, -27}, {370, 230, 14, 32, 0, -29}},
+    {'2', 16.00f, {877, 265, 16, 28, 0, -27}, {330, 230, 20, 32, -2, -29}},
+    {'3', 16.00f, {893, 265, 17, 28, -1, -27}, {384, 230, 21, 32, -3, -29}},
+    {'4', 16.00f, {791, 265, 17, 28, 0, -27}, {405, 230, 21, 32, -2, -29}},
+    {'5', 16.00f, {910, 265, 17, 28, -1, -27}, {426, 230, 21, 32, -3, -29}},
+    {'6', 16.00f, {927, 265, 16, 28, 0, -27}, {447, 230, 20, 32, -2, -29}},
+    {'7', 16.00f, {943, 265, 16, 28, 0, -27}, {467, 230, 20, 32, -2, -29}},
+    {'8', 16.00f, {959, 265, 16, 28, 0, -27}, {487, 230, 20, 32, -2, -29}},
+    {'9', 16.00f, {975, 265, 16, 28, 0, -27}, {507, 230, 20, 32, -2, -29}},
+    {':', 8.00f, {414, 321, 5, 21, 2, -20}, {466, 294, 9, 25, 0, -22}},
+    {'S', 20.00f, {991, 265, 19, 28, 0, -27}, {527, 230, 23, 32, -2, -29}},
+    {'c', 15.00f, {365, 321, 16, 21, 0, -20}, {475, 294, 20, 25, -2, -22}},
+    {'e', 16.00f, {381, 321, 16, 21, 0, -20}, {495, 294, 21, 25, -2, -22}},
+    {'o', 17.00f, {397, 321, 17, 21, 0, -20}, {629, 294, 21, 25, -2, -22}},
+    {'r', 10.00f, {419, 321, 11, 21, 1, -20}, {684, 294, 15, 25, -1, -22}},
+    {' ', 11.00f, {0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0}},
+    {'-', 13.00f, {63, 379, 13, 6, 0, -16}, {781, 363, 19, 12, -3, -19}},
+    {'0', 22.00f, {825, 176, 21, 38, 1, -36}, {369, 176, 27, 44, -2, -39}},
+    {'1', 22.00f, {888, 176, 13, 37, 3, -36}, {423, 176, 19, 43, 0, -39}},
+    {'2', 22.00f, {901, 176, 21, 37, 0, -36}, {542, 176, 27, 43, -3, -39}},
+    {'3', 22.00f, {804, 176, 21, 38, 0, -36}, {260, 176, 27, 44, -3, -39}},
+    {'4', 22.00f, {866, 176, 22, 37, 0, -36}, {569, 176, 28, 43, -3, -39}},
+    {'5', 22.00f, {782, 176, 22, 38, 0, -36}, {314, 176, 28, 44, -3, -39}},
+    {'6', 22.00f, {761, 176, 21, 38, 0, -36}, {287, 176, 27, 44, -3, -39}},
+    {'7', 22.00f, {846, 176, 20, 37, 1, -36}, {469, 176, 26, 43, -2, -39}},
+    {'8', 22.00f, {740, 176, 21, 38, 1, -36}, {396, 176, 27, 44, -2, -39}},
+    {'9', 22.00f, {719, 176, 21, 38, 1, -36}, {342, 176, 27, 44, -2, -39}},
+    {':', 11.00f, {43, 294, 6, 27, 3, -26}, {318, 230, 12, 33, 0, -29}},
+    {'B', 26.00f, {922, 176, 23, 37, 2, -36}, {597, 176, 29, 43, -1, -39}},
+    {'C', 28.00f, {638, 176, 27, 39, 1, -37}, {227, 176, 33, 45, -2, -40}},
+    {'F', 24.00f, {945, 176, 21, 37, 2, -36}, {442, 176, 27, 43, -1, -39}},
+    {'M', 33.00f, {966, 176, 29, 37, 2, -36}, {495, 176, 35, 43, -1, -39}},
+    {'O', 31.00f, {690, 176, 29, 39, 1, -37}, {161, 176, 35, 45, -2, -40}},
+    {'S', 27.00f, {665, 176, 25, 39, 1, -37}, {196, 176, 31, 45, -2, -40}},
+    {'a', 21.00f, {414, 265, 21, 29, 0, -27}, {159, 230, 27, 35, -3, -30}},
+    {'c', 20.00f, {394, 265, 20, 29, 1, -27}, {133, 230, 26, 35, -2, -30}},
+    {'e', 22.00f, {373, 265, 21, 29, 0, -27}, {186, 230, 28, 35, -3, -30}},
+    {'i', 9.00f, {995, 176, 6, 37, 2, -36}, {626, 176, 12, 43, -1, -39}},
+    {'l', 8.00f, {1001, 176, 6, 37, 1, -36}, {530, 176, 12, 43, -2, -39}},
+    {'n', 22.00f, {832, 265, 19, 28, 2, -27}, {265, 230, 25, 34, -1, -30}},
+    {'o', 22.00f, {333, 265, 21, 29, 0, -27}, {87, 230, 27, 35, -3, -30}},
+    {'r', 14.00f, {808, 265, 14, 28, 2, -27}, {245, 230, 20, 34, -1, -30}},
+    {'x', 20.00f, {0, 294, 22, 27, -1, -26}, {290, 230, 28, 33, -4, -29}},
+    {' ', 16.00f, {0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0}},
+    {'A', 39.00f, {41, 176, 43, 54, -2, -53}, {641, 103, 51, 62, -6, -57}},
+    {'E', 40.00f, {127, 176, 34, 53, 4, -52}, {789, 103, 42, 61, 0, -56}},
+    {'G', 46.00f, {882, 103, 41, 55, 2, -53}, {541, 103, 49, 63, -2, -57}},
+    {'M', 49.00f, {84, 176, 43, 53, 3, -52}, {831, 103, 51, 61, -1, -56}},
+    {'O', 46.00f, {923, 103, 43, 55, 2, -53}, {590, 103, 51, 63, -2, -57}},
+    {'R', 43.00f, {966, 103, 39, 54, 4, -53}, {692, 103, 47, 62, 0, -57}},
+    {'V', 39.00f, {0, 176, 41, 54, -1, -53}, {739, 103, 50, 62, -5, -57}},
+    {' ', 22.00f, {0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0}},
+    {'!', 22.00f, {529, 103, 12, 71, 5, -70}, {788, 0, 22, 81, 0, -75}},
+    {'(', 26.00f, {63, 0, 21, 93, 4, -72}, {0, 0, 31, 103, -1, -77}},
+    {')', 26.00f, {84, 0, 22, 93, 1, -72}, {31, 0, 32, 103, -4, -77}},
+    {'.', 22.00f, {715, 363, 10, 12, 6, -11}, {345, 321, 20, 22, 1, -16}},
+    {'0', 44.00f, {47, 103, 39, 72, 2, -70}, {348, 0, 49, 82, -3, -75}},
+    {'2', 44.00f, {317, 103, 40, 71, 1, -70}, {619, 0, 50, 81, -4, -75}},
+    {'A', 53.00f, {214, 103, 56, 71, -2, -70}, {506, 0, 66, 81, -7, -75}},
+    {'C', 56.00f, {896, 0, 52, 73, 3, -71}, {106, 0, 62, 83, -2, -76}},
+    {'E', 52.00f, {133, 103, 44, 71, 5, -70}, {452, 0, 54, 81, 0, -75}},
+    {'L', 44.00f, {177, 103, 37, 71, 5, -70}, {572, 0, 47, 81, 0, -75}},
+    {'N', 57.00f, {270, 103, 47, 71, 5, -70}, {669, 0, 57, 81, 0, -75}},
+    {'O', 61.00f, {948, 0, 56, 73, 3, -71}, {225, 0, 66, 83, -2, -76}},
+    {'P', 52.00f, {357, 103, 45, 71, 5, -70}, {397, 0, 55, 81, 0, -75}},
+    {'R', 57.00f, {402, 103, 52, 71, 5, -70}, {726, 0, 62, 81, 0, -75}},
+    {'S', 53.00f, {0, 103, 47, 73, 3, -71}, {168, 0, 57, 83, -2, -76}},
+    {'U', 57.00f, {86, 103, 47, 72, 5, -70}, {291, 0, 57, 82, 0, -75}},
+    {'W', 74.00f, {454, 103, 75, 71, 0, -70}, {810, 0, 86, 81, -6, -75}},
+};
+
+constexpr BakedKerning BAKED_KERNING[4221] = {
+    {' ', '#', -1},
+    {' ', '-', -1},
+    {' ', 'A', -1},
+    {' ', 'T', -1},
+    {' ', 'Z', -1},
+    {' ', 'f', -1},
+    {' ', 't', -1},
+    {' ', 'z', -1},
+    {'!', '%', 1},
+    {'!', '(', 1},
+    {'!', '@', 1},
+    {'!', 'B', 1},
+    {'!', 'D', 1},
+    {'!', 'E', 1},
+    {'!', 'F', 1},
+    {'!', 'G', 1},
+    {'!', 'H', 1},
+    {'!', 'K', 1},
+    {'!', 'L', 1},
+    {'!', 'M', 1},
+    {'!', 'N', 1},
+    {'!', 'P', 1},
+    {'!', 'R', 1},
+    {'!', 'S', 1},
+    {'!', 'U', 1},
+    {'!', 'Y', 1},
+    {'!', '[', 1},
+    {'!', ']', 1},
+    {'!', 'b', 1},
+    {'!', 'h', 1},
+    {'!', 'i', 1},
+    {'!', 'j', 1},
+    {'!', 'k', 1},
+    {'!', 'l', 1},
+    {'!', 'm', 1},
+    {'!', 'n', 1},
+    {'!', 'p', 1},
+    {'!', 'r', 1},
+    {'!', 'u', 1},
+    {'!', '{', 1},
+    {'!', '}', 1},
+    {'"', '#', -1},
+    {'"', '*', -1},
+    {'"', ',', -1},
+    {'"', '-', -1},
+    {'"', '.', -1},
+    {'"', ':', -1},
+    {'"', ';', -1},
+    {'"', '?', -1},
+    {'"', 'I', -1},
+    {'"', 'J', -1},
+    {'"', 'T', -1},
+    {'"', 'Z', -1},
+    {'"', 'd', -1},
+    {'"', 'f', -1},
+    {'"', 'g', -1},
+    {'"', 'o', -1},
+    {'"', 't', -1},
+    {'"', 'z', -1},
+    {'"', '|', -1},
+    {'"', '~', -1},
+    {'#', ' ', -1},
+    {'#', '!', -1},
+    {'#', '"', -1},
+    {'#', '#', -1},
+    {'#', '$', -1},
+    {'#', '%', -1},
+    {'#', '&', -1},
+    {'#', '\'', -1},
+    {'#', '(', -1},
+    {'#', ')', -1},
+    {'#', '*', -1},
+    {'#', '+', -1},
+    {'#', ',', -1},
+    {'#', '-', -1},
+    {'#', '.', -1},
+    {'#', '/', -1},
+    {'#', '0', -1},
+    {'#', '1', -1},
+    {'#', '2', -1},
+    {'#', '3', -1},
+    {'#', '4', -1},
+    {'#', '5', -1},
+    {'#', '6', -1},
+    {'#', '7', -1},
+    {'#', '8', -1},
+    {'#', '9', -1},
+    {'#', ':', -1},
+    {'#', ';', -1},
+    {'#', '<', -1},
+    {'#', '=', -1},
+    {'#', '>', -1},
+    {'#', '?', -1},
+    {'#', '@', -1},
+    {'#', 'A', -1},
+    {'#', 'C', -1},
+    {'#', 'G', -1},
+    {'#', 'I', -1},
+    {'#', 'J', -1},
+    {'#', 'O', -1},
+    {'#', 'Q', -1},
+    {'#', 'T', -1},
+    {'#', 'V', -1},
+    {'#', 'W', -1},
+    {'#', 'X', -1},
+    {'#', 'Z', -1},
+    {'#', '\\', -1},
+    {'#', ']', -1},
+    {'#', '^', -1},
+    {'#', '_', -1},
+    {'#', '`', -1},
+    {'#', 'a', -1},
+    {'#', 'c', -1},
+    {'#', 'd', -1},
+    {'#', 'e', -1},
+    {'#', 'f', -1},
+    {'#', 'g', -1},
+    {'#', 'o', -1},
+    {'#', 'q', -1},
+    {'#', 's', -1},
+    {'#', 't', -1},
+    {'#', 'v', -1},
+    {'#', 'w', -1},
+    {'#', 'x', -1},
+    {'#', 'y', -1},
+    {'#', 'z', -1},
+    {'#', '{', -1},
+    {'#', '|', -1},
+    {'#', '~', -1},
+    {'$', '#', -1},
+    {'$', '*', -1},
+    {'$', ',', -1},
+    {'$', '-', -1},
+    {'$', '.', -1},
+    {'$', ':', -1},
+    {'$', ';', -1},
+    {'$', '?', -1},
+    {'$', 'I', -1},
+    {'$', 'J', -1},
+    {'$', 'T', -1},
+    {'$', 'Z', -1},
+    {'$', 'f', -1},
+    {'$', 'g', -1},
+    {'$', 'o', -1},
+    {'$', 't', -1},
+    {'$', 'z', -1},
+    {'$', '|', -1},
+    {'$', '~', -1},
+    {'%', '#', -1},
+    {'%', '-', -1},
+    {'%', 'T', -1},
+    {'%', 'Z', -1},
+    {'%', 'f', -1},
+    {'%', 't', -1},
+    {'%', 'z', -1},
+    {'&', '#', -1},
+    {'&', '*', -1},
+    {'&', ',', -1},
+    {'&', '-', -1},
+    {'&', '.', -1},
+    {'&', ':', -1},
+    {'&', ';', -1},
+    {'&', '?', -1},
+    {'&', 'T', -1},
+    {'&', 'Z', -1},
+    {'&', 'f', -1},
+    {'&', 't', -1},
+    {'&', 'z', -1},
+    {'&', '|', -1},
+    {'\'', '#', -1},
+    {'\'', '*', -1},
+    {'\'', ',', -1},
+    {'\'', '-', -1},
+    {'\'', '.', -1},
+    {'\'', ':', -1},
+    {'\'', ';', -1},
+    {'\'', '?', -1},
+    {'\'', 'I', -1},
+    {'\'', 'J', -1},
+    {'\'', 'T', -1},
+    {'\'', 'Z', -1},
+    {'\'', 'f', -1},
+    {'\'', 't', -1},
+    {'\'', 'z', -1},
+    {'\'', '|', -1},
+    {'\'', '~', -1},
+    {'(', '#', -1},
+    {'(', '*', -1},
+    {'(', ',', -1},
+    {'(', '-', -1},
+    {'(', '.', -1},
+    {'(', ':', -1},
+    {'(', ';', -1},
+    {'(', '?', -1},
+    {'(', 'I', -1},
+    {'(', 'J', -1},
+    {'(', 'T', -1},
+    {'(', 'Z', -1},
+    {'(', 'f', -1},
+    {'(', 'g', -1},
+    {'(', 'o', -1},
+    {'(', 't', -1},
+    {'(', 'z', -1},
+    {'(', '|', -1},
+    {'(', '~', -1},
+    {')', '#', -1},
+    {')', '-', -1},
+    {')', 'T', -1},
+    {')', 'Z', -1},
+    {')', 'f', -1},
+    {')', 't', -1},
+    {')', 'z', -1},
+    {'*', '%', 1},
+    {'*', '(', 1},
+    {'*', '@', 1},
+    {'*', 'B', 1},
+    {'*', 'D', 1},
+    {'*', 'E', 1},
+    {'*', 'F', 1},
+    {'*', 'G', 1},
+    {'*', 'H', 1},
+    {'*', 'K', 1},
+    {'*', 'L', 1},
+    {'*', 'M', 1},
+    {'*', 'N', 1},
+    {'*', 'P', 1},
+    {'*', 'R', 1},
+    {'*', 'S', 1},
+    {'*', 'U', 1},
+    {'*', 'Y', 1},
+    {'*', '[', 1},
+    {'*', ']', 1},
+    {'*', 'b', 1},
+    {'*', 'h', 1},
+    {'*', 'i', 1},
+    {'*', 'j', 1},
+    {'*', 'k', 1},
+    {'*', 'l', 1},
+    {'*', 'm', 1},
+    {'*', 'n', 1},
+    {'*', 'p', 1},
+    {'*', 'r', 1},
+    {'*', 'u', 1},
+    {'*', '{', 1},
+    {'*', '}', 1},
+    {'+', '#', -1},
+    {'+', '*', -1},
+    {'+', ',', -1},
+    {'+', '-', -1},
+    {'+', '.', -1},
+    {'+', ':', -1},
+    {'+', ';', -1},
+    {'+', '?', -1},
+    {'+', 'J', -1},
+    {'+', 'T', -1},
+    {'+', 'Z', -1},
+    {'+', 'f', -1},
+    {'+', 't', -1},
+    {'+', 'z', -1},
+    {'+', '|', -1},
+    {'+', '~', -1},
+    {',', '(', 1},
+    {',', 'B', 1},
+    {',', 'D', 1},
+    {',', 'E', 1},
+    {',', 'F', 1},
+    {',', 'H', 1},
+    {',', 'K', 1},
+    {',', 'L', 1},
+    {',', 'M', 1},
+    {',', 'N', 1},
+    {',', 'P', 1},
+    {',', 'R', 1},
+    {',', 'S', 1},
+    {',', 'U', 1},
+    {',', 'Y', 1},
+    {',', '[', 1},
+    {',', ']', 1},
+    {',', 'b', 1},
+    {',', 'h', 1},
+    {',', 'i', 1},
+    {',', 'j', 1},
+    {',', 'k', 1},
+    {',', 'l', 1},
+    {',', 'm', 1},
+    {',', 'n', 1},
+    {',', 'p', 1},
+    {',', 'r', 1},
+    {',', 'u', 1},
+    {',', '{', 1},
+    {',', '}', 1},
+    {'-', ' ', -1},
+    {'-', '!', -1},
+    {'-', '"', -1},
+    {'-', '#', -1},
+    {'-', '$', -1},
+    {'-', '&', -1},
+    {'-', '\'', -1},
+    {'-', ')', -1},
+    {'-', '*', -1},
+    {'-', '+', -1},
+    {'-', ',', -1},
+    {'-', '-', -1},
+    {'-', '.', -1},
+    {'-', '/', -1},
+    {'-', '0', -1},
+    {'-', '1', -1},
+    {'-', '2', -1},
+    {'-', '3', -1},
+    {'-', '4', -1},
+    {'-', '5', -1},
+    {'-', '6', -1},
+    {'-', '7', -1},
+    {'-', '8', -1},
+    {'-', '9', -1},
+    {'-', ':', -1},
+    {'-', ';', -1},
+    {'-', '<', -1},
+    {'-', '=', -1},
+    {'-', '>', -1},
+    {'-', '?', -1},
+    {'-', '@', -1},
+    {'-', 'A', -1},
+    {'-', 'C', -1},
+    {'-', 'I', -1},
+    {'-', 'J', -1},
+    {'-', 'O', -1},
+    {'-', 'Q', -1},
+    {'-', 'T', -1},
+    {'-', 'V', -1},
+    {'-', 'W', -1},
+    {'-', 'X', -1},
+    {'-', 'Z', -1},
+    {'-', '\\', -1},
+    {'-', '^', -1},
+    {'-', '_', -1},
+    {'-', '`', -1},
+    {'-', 'a', -1},
+    {'-', 'c', -1},
+    {'-', 'd', -1},
+    {'-', 'e', -1},
+    {'-', 'f', -1},
+    {'-', 'g', -1},
+    {'-', 'o', -1},
+    {'-', 'q', -1},
+    {'-', 's', -1},
+    {'-', 't', -1},
+    {'-', 'v', -1},
+    {'-', 'w', -1},
+    {'-', 'x', -1},
+    {'-', 'y', -1},
+    {'-', 'z', -1},
+    {'-', '|', -1},
+    {'-', '~', -1},
+    {'.', 'B', 1},
+    {'.', 'D', 1},
+    {'.', 'E', 1},
+    {'.', 'F', 1},
+    {'.', 'H', 1},
+    {'.', 'K', 1},
+    {'.', 'L', 1},
+    {'.', 'M', 1},
+    {'.', 'N', 1},
+    {'.', 'P', 1},
+    {'.', 'R', 1},
+    {'.', 'S', 1},
+    {'.', 'U', 1},
+    {'.', 'Y', 1},
+    {'.', '[', 1},
+    {'.', 'b', 1},
+    {'.', 'h', 1},
+    {'.', 'i', 1},
+    {'.', 'j', 1},
+    {'.', 'k', 1},
+    {'.', 'l', 1},
+    {'.', 'm', 1},
+    {'.', 'n', 1},
+    {'.', 'p', 1},
+    {'.', 'r', 1},
+    {'.', 'u', 1},
+    {'.', '{', 1},
+    {'.', '}', 1},
+    {'/', '#', -1},
+    {'/', 'E', 1},
+    {'/', 'F', 1},
+    {'/', 'H', 1},
+    {'/', 'P', 1},
+    {'/', 'R', 1},
+    {'/', 'S', 1},
+    {'/', 'T', -1},
+    {'/', 'U', 1},
+    {'/', 'f', -1},
+    {'0', '#', -1},
+    {'0', '-', -1},
+    {'0', 'T', -1},
+    {'0', 'Z', -1},
+    {'0', 'f', -1},
+    {'0', 't', -1},
+    {'0', 'z', -1},
+    {'1', '#', -1},
+    {'1', '-', -1},
+    {'1', '1', -1},
+    {'1', 'T', -1},
+    {'1', 'Z', -1},
+    {'1', 'f', -1},
+    {'1', 't', -1},
+    {'1', 'z', -1},
+    {'2', '#', -1},
+    {'2', '-', -1},
+    {'2', 'T', -1},
+    {'2', 'Z', -1},
+    {'2', 'f', -1},
+    {'2', 't', -1},
+    {'2', 'z', -1},
+    {'3', '#', -1},
+    {'3', '-', -1},
+    {'3', 'T', -1},
+    {'3', 'Z', -1},
+    {'3', 'f', -1},
+    {'3', 't', -1},
+    {'3', 'z', -1},
+    {'4', '#', -1},
+    {'4', '-', -1},
+    {'4', 'T', -1},
+    {'4', 'Z', -1},
+    {'4', 'f', -1},
+    {'4', 't', -1},
+    {'4', 'z', -1},
+    {'5', '#', -1},
+    {'5', '-', -1},
+    {'5', 'T', -1},
+    {'5', 'Z', -1},
+    {'5', 'f', -1},
+    {'5', 't', -1},
+    {'5', 'z', -1},
+    {'6', '#', -1},
+    {'6', '-', -1},
+    {'6', 'T', -1},
+    {'6', 'Z', -1},
+    {'6', 'f', -1},
+    {'6', 't', -1},
+    {'6', 'z', -1},
+    {'7', '#', -1},
+    {'7', '-', -1},
+    {'7', 'T', -1},
+    {'7', 'Z', -1},
+    {'7', 'f', -1},
+    {'7', 't', -1},
+    {'7', 'z', -1},
+    {'8', '#', -1},
+    {'8', '-', -1},
+    {'8', 'T', -1},
+    {'8', 'Z', -1},
+    {'8', 'f', -1},
+    {'8', 't', -1},
+    {'8', 'z', -1},
+    {'9', '#', -1},
+    {'9', '-', -1},
+    {'9', 'T', -1},
+    {'9', 'Z', -1},
+    {'9', 'f', -1},
+    {'9', 't', -1},
+    {'9', 'z', -1},
+    {':', 'B', 1},
+    {':', 'D', 1},
+    {':', 'E', 1},
+    {':', 'F', 1},
+    {':', 'H', 1},
+    {':', 'K', 1},
+    {':', 'L', 1},
+    {':', 'M', 1},
+    {':', 'N', 1},
+    {':', 'P', 1},
+    {':', 'R', 1},
+    {':', 'S', 1},
+    {':', 'U', 1},
+    {':', 'Y', 1},
+    {':', '[', 1},
+    {':', 'b', 1},
+    {':', 'h', 1},
+    {':', 'i', 1},
+    {':', 'j', 1},
+    {':', 'k', 1},
+    {':', 'l', 1},
+    {':', 'm', 1},
+    {':', 'n', 1},
+    {':', 'p', 1},
+    {':', 'r', 1},
+    {':', 'u', 1},
+    {':', '{', 1},
+    {':', '}', 1},
+    {';', '(', 1},
+    {';', 'B', 1},
+    {';', 'D', 1},
+    {';', 'E', 1},
+    {';', 'F', 1},
+    {';', 'H', 1},
+    {';', 'K', 1},
+    {';', 'L', 1},
+    {';', 'M', 1},
+    {';', 'N', 1},
+    {';', 'P', 1},
+    {';', 'R', 1},
+    {';', 'S', 1},
+    {';', 'U', 1},
+    {';', 'Y', 1},
+    {';', '[', 1},
+    {';', ']', 1},
+    {';', 'b', 1},
+    {';', 'h', 1},
+    {';', 'i', 1},
+    {';', 'j', 1},
+    {';', 'k', 1},
+    {';', 'l', 1},
+    {';', 'm', 1},
+    {';', 'n', 1},
+    {';', 'p', 1},
+    {';', 'r', 1},
+    {';', 'u', 1},
+    {';', '{', 1},
+    {';', '}', 1},
+    {'<', '#', -1},
+    {'<', '*', -1},
+    {'<', ',', -1},
+    {'<', '-', -1},
+    {'<', '.', -1},
+    {'<', ':', -1},
+    {'<', ';', -1},
+    {'<', '?', -1},
+    {'<', 'J', -1},
+    {'<', 'T', -1},
+    {'<', 'Z', -1},
+    {'<', 'f', -1},
+    {'<', 't', -1},
+    {'<', 'z', -1},
+    {'<', '|', -1},
+    {'<', '~', -1},
+    {'=', '#', -1},
+    {'=', '*', -1},
+    {'=', ',', -1},
+    {'=', '-', -1},
+    {'=', '.', -1},
+    {'=', ':', -1},
+    {'=', ';', -1},
+    {'=', '?', -1},
+    {'=', 'J', -1},
+    {'=', 'T', -1},
+    {'=', 'Z', -1},
+    {'=', 'f', -1},
+    {'=', 't', -1},
+    {'=', 'z', -1},
+    {'=', '|', -1},
+    {'=', '~', -1},
+    {'>', '#', -1},
+    {'>', '*', -1},
+    {'>', ',', -1},
+    {'>', '-', -1},
+    {'>', '.', -1},
+    {'>', ':', -1},
+    {'>', ';', -1},
+    {'>', '?', -1},
+    {'>', 'J', -1},
+    {'>', 'T', -1},
+    {'>', 'Z', -1},
+    {'>', 'f', -1},
+    {'>', 't', -1},
+    {'>', 'z', -1},
+    {'>', '|', -1},
+    {'>', '~', -1},
+    {'?', '#', -1},
+    {'?', '*', -1},
+    {'?', ',', -1},
+    {'?', '-', -1},
+    {'?', '.', -1},
+    {'?', ':', -1},
+    {'?', ';', -1},
+    {'?', '?', -1},
+    {'?', 'I', -1},
+    {'?', 'J', -1},
+    {'?', 'T', -1},
+    {'?', 'Z', -1},
+    {'?', 'f', -1},
+    {'?', 't', -1},
+    {'?', 'z', -1},
+    {'?', '|', -1},
+    {'?', '~', -1},
+    {'@', '#', -1},
+    {'@', '-', -1},
+    {'@', 'T', -1},
+    {'@', 'Z', -1},
+    {'@', 'f', -1},
+    {'@', 't', -1},
+    {'@', 'z', -1},
+    {'A', ' ', -1},
+    {'A', '#', -1},
+    {'A', '*', -1},
+    {'A', ',', -1},
+    {'A', '-', -1},
+    {'A', '.', -1},
+    {'A', ':', -1},
+    {'A', ';', -1},
+    {'A', '?', -1},
+    {'A', 'J', -1},
+    {'A', 'T', -2},
+    {'A', 'V', -1},
+    {'A', 'W', -1},
+    {'A', 'Y', -1},
+    {'A', 'Z', -1},
+    {'A', 'f', -1},
+    {'A', 't', -1},
+    {'A', 'z', -1},
+    {'A', '|', -1},
+    {'A', '~', -1},
+    {'B', '#', -1},
+    {'B', '*', -1},
+    {'B', ',', -1},
+    {'B', '-', -1},
+    {'B', '.', -1},
+    {'B', ':', -1},
+    {'B', ';', -1},
+    {'B', '?', -1},
+    {'B', 'I', -1},
+    {'B', 'J', -1},
+    {'B', 'T', -1},
+    {'B', 'Z', -1},
+    {'B', 'f', -1},
+    {'B', 't', -1},
+    {'B', 'z', -1},
+    {'B', '|', -1},
+    {'B', '~', -1},
+    {'C', '!', -1},
+    {'C', '#', -1},
+    {'C', '$', -1},
+    {'C', '&', -1},
+    {'C', '\'', -1},
+    {'C', '*', -1},
+    {'C', '+', -1},
+    {'C', ',', -1},
+    {'C', '-', -1},
+    {'C', '.', -1},
+    {'C', ':', -1},
+    {'C', ';', -1},
+    {'C', '<', -1},
+    {'C', '=', -1},
+    {'C', '>', -1},
+    {'C', '?', -1},
+    {'C', 'I', -1},
+    {'C', 'J', -1},
+    {'C', 'T', -1},
+    {'C', 'Z', -1},
+    {'C', 'a', -1},
+    {'C', 'c', -1},
+    {'C', 'd', -1},
+    {'C', 'e', -1},
+    {'C', 'f', -1},
+    {'C', 'g', -1},
+    {'C', 'o', -1},
+    {'C', 'q', -1},
+    {'C', 't', -1},
+    {'C', 'z', -1},
+    {'C', '|', -1},
+    {'C', '~', -1},
+    {'D', '#', -1},
+    {'D', '*', -1},
+    {'D', ',', -1},
+    {'D', '-', -1},
+    {'D', '.', -1},
+    {'D', ':', -1},
+    {'D', ';', -1},
+    {'D', 'T', -1},
+    {'D', 'Z', -1},
+    {'D', 'f', -1},
+    {'D', 't', -1},
+    {'D', 'z', -1},
+    {'E', '!', -1},
+    {'E', '"', -1},
+    {'E', '#', -1},
+    {'E', '$', -1},
+    {'E', '&', -1},
+    {'E', '\'', -1},
+    {'E', ')', -1},
+    {'E', '*', -1},
+    {'E', '+', -1},
+    {'E', ',', -1},
+    {'E', '-', -1},
+    {'E', '.', -1},
+    {'E', ':', -1},
+    {'E', ';', -1},
+    {'E', '<', -1},
+    {'E', '=', -1},
+    {'E', '>', -1},
+    {'E', '?', -1},
+    {'E', 'I', -1},
+    {'E', 'J', -1},
+    {'E', 'Q', -1},
+    {'E', 'T', -1},
+    {'E', 'Z', -1},
+    {'E', 'a', -1},
+    {'E', 'c', -1},
+    {'E', 'd', -1},
+    {'E', 'e', -1},
+    {'E', 'f', -1},
+    {'E', 'g', -1},
+    {'E', 'o', -1},
+    {'E', 'q', -1},
+    {'E', 's', -1},
+    {'E', 't', -1},
+    {'E', 'z', -1},
+    {'E', '|', -1},
+    {'E', '~', -1},
+    {'F', '(', 1},
+    {'F', ',', -2},
+    {'F', '.', -2},
+    {'F', 'B', 1},
+    {'F', 'D', 1},
+    {'F', 'E', 1},
+    {'F', 'F', 1},
+    {'F', 'H', 1},
+    {'F', 'K', 1},
+    {'F', 'L', 1},
+    {'F', 'M', 1},
+    {'F', 'N', 1},
+    {'F', 'P', 1},
+    {'F', 'R', 1},
+    {'F', 'S', 1},
+    {'F', 'U', 1},
+    {'F', 'Y', 1},
+    {'F', '[', 1},
+    {'F', ']', 1},
+    {'F', 'b', 1},
+    {'F', 'h', 1},
+    {'F', 'i', 1},
+    {'F', 'j', 1},
+    {'F', 'k', 1},
+    {'F', 'l', 1},
+    {'F', 'm', 1},
+    {'F', 'n', 1},
+    {'F', 'p', 1},
+    {'F', 'r', 1},
+    {'F', 'u', 1},
+    {'F', '{', 1},
+    {'F', '}', 1},
+    {'G', '#', -1},
+    {'G', '-', -1},
+    {'G', 'T', -1},
+    {'G', 'Z', -1},
+    {'G', 'f', -1},
+    {'G', 't', -1},
+    {'G', 'z', -1},
+    {'H', 'B', 1},
+    {'H', 'D', 1},
+    {'H', 'E', 1},
+    {'H', 'F', 1},
+    {'H', 'H', 1},
+    {'H', 'K', 1},
+    {'H', 'L', 1},
+    {'H', 'M', 1},
+    {'H', 'N', 1},
+    {'H', 'P', 1},
+    {'H', 'R', 1},
+    {'H', 'S', 1},
+    {'H', 'U', 1},
+    {'H', 'Y', 1},
+    {'H', '[', 1},
+    {'H', 'h', 1},
+    {'H', 'i', 1},
+    {'H', 'k', 1},
+    {'H', 'm', 1},
+    {'H', 'n', 1},
+    {'H', 'p', 1},
+    {'H', 'r', 1},
+    {'H', '}', 1},
+    {'I', '(', 1},
+    {'I', 'B', 1},
+    {'I', 'D', 1},
+    {'I', 'E', 1},
+    {'I', 'F', 1},
+    {'I', 'H', 1},
+    {'I', 'K', 1},
+    {'I', 'L', 1},
+    {'I', 'M', 1},
+    {'I', 'N', 1},
+    {'I', 'P', 1},
+    {'I', 'R', 1},
+    {'I', 'S', 1},
+    {'I', 'U', 1},
+    {'I', 'Y', 1},
+    {'I', '[', 1},
+    {'I', ']', 1},
+    {'I', 'b', 1},
+    {'I', 'h', 1},
+    {'I', 'i', 1},
+    {'I', 'j', 1},
+    {'I', 'k', 1},
+    {'I', 'l', 1},
+    {'I', 'm', 1},
+    {'I', 'n', 1},
+    {'I', 'p', 1},
+    {'I', 'r', 1},
+    {'I', 'u', 1},
+    {'I', '{', 1},
+    {'I', '}', 1},
+    {'J', 'B', 1},
+    {'J', 'D', 1},
+    {'J', 'E', 1},
+    {'J', 'F', 1},
+    {'J', 'H', 1},
+    {'J', 'K', 1},
+    {'J', 'L', 1},
+    {'J', 'M', 1},
+    {'J', 'N', 1},
+    {'J', 'P', 1},
+    {'J', 'R', 1},
+    {'J', 'S', 1},
+    {'J', 'U', 1},
+    {'J', 'Y', 1},
+    {'J', '[', 1},
+    {'K', '%', 1},
+    {'K', '(', 1},
+    {'K', 'B', 1},
+    {'K', 'D', 1},
+    {'K', 'E', 1},
+    {'K', 'F', 1},
+    {'K', 'G', 1},
+    {'K', 'H', 1},
+    {'K', 'K', 1},
+    {'K', 'L', 1},
+    {'K', 'M', 1},
+    {'K', 'N', 1},
+    {'K', 'P', 1},
+    {'K', 'R', 1},
+    {'K', 'S', 1},
+    {'K', 'U', 1},
+    {'K', 'Y', 1},
+    {'K', '[', 1},
+    {'K', ']', 1},
+    {'K', 'b', 1},
+    {'K', 'h', 1},
+    {'K', 'i', 1},
+    {'K', 'j', 1},
+    {'K', 'k', 1},
+    {'K', 'l', 1},
+    {'K', 'm', 1},
+    {'K', 'n', 1},
+    {'K', 'p', 1},
+    {'K', 'r', 1},
+    {'K', 'u', 1},
+    {'K', '{', 1},
+    {'K', '}', 1},
+    {'L', ' ', -1},
+    {'L', '#', -1},
+    {'L', '*', -1},
+    {'L', ',', -1},
+    {'L', '-', -1},
+    {'L', '.', -1},
+    {'L', ':', -1},
+    {'L', ';', -1},
+    {'L', '?', -1},
+    {'L', 'I', -1},
+    {'L', 'J', -1},
+    {'L', 'T', -2},
+    {'L', 'V', -1},
+    {'L', 'W', -1},
+    {'L', 'Y', -1},
+    {'L', 'Z', -1},
+    {'L', 'f', -1},
+    {'L', 't', -1},
+    {'L', 'y', -1},
+    {'L', 'z', -1},
+    {'L', '|', -1},
+    {'L', '~', -1},
+    {'M', '#', -1},
+    {'M', 'B', 1},
+    {'M', 'D', 1},
+    {'M', 'E', 1},
+    {'M', 'F', 1},
+    {'M', 'H', 1},
+    {'M', 'K', 1},
+    {'M', 'M', 1},
+    {'M', 'N', 1},
+    {'M', 'P', 1},
+    {'M', 'R', 1},
+    {'M', 'S', 1},
+    {'M', 'U', 1},
+    {'M', 'Y', 1},
+    {'M', 'f', -1},
+    {'N', 'B', 1},
+    {'N', 'D', 1},
+    {'N', 'E', 1},
+    {'N', 'F', 1},
+    {'N', 'H', 1},
+    {'N', 'K', 1},
+    {'N', 'L', 1},
+    {'N', 'M', 1},
+    {'N', 'N', 1},
+    {'N', 'P', 1},
+    {'N', 'R', 1},
+    {'N', 'S', 1},
+    {'N', 'U', 1},
+    {'N', 'Y', 1},
+    {'N', '[', 1},
+    {'N', 'h', 1},
+    {'N', 'i', 1},
+    {'N', 'k', 1},
+    {'N', 'm', 1},
+    {'N', 'n', 1},
+    {'N', 'p', 1},
+    {'N', 'r', 1},
+    {'N', '}', 1},
+    {'O', '!', -1},
+    {'O', '#', -1},
+    {'O', '$', -1},
+    {'O', '*', -1},
+    {'O', ',', -1},
+    {'O', '-', -1},
+    {'O', '.', -1},
+    {'O', ':', -1},
+    {'O', ';', -1},
+    {'O', '<', -1},
+    {'O', '>', -1},
+    {'O', '?', -1},
+    {'O', 'I', -1},
+    {'O', 'J', -1},
+    {'O', 'T', -1},
+    {'O', 'Z', -1},
+    {'O', 'a', -1},
+    {'O', 'd', -1},
+    {'O', 'e', -1},
+    {'O', 'f', -1},
+    {'O', 'g', -1},
+    {'O', 'o', -1},
+    {'O', 'q', -1},
+    {'O', 't', -1},
+    {'O', 'z', -1},
+    {'O', '|', -1},
+    {'O', '~', -1},
+    {'P', ' ', -1},
+    {'P', '!', -1},
+    {'P', '#', -1},
+    {'P', '$', -1},
+    {'P', '*', -1},
+    {'P', ',', -3},
+    {'P', '-', -1},
+    {'P', '.', -3},
+    {'P', ':', -1},
+    {'P', ';', -1},
+    {'P', '?', -1},
+    {'P', 'A', -1},
+    {'P', 'I', -1},
+    {'P', 'J', -1},
+    {'P', 'T', -1},
+    {'P', 'Z', -1},
+    {'P', 'a', -1},
+    {'P', 'd', -1},
+    {'P', 'e', -1},
+    {'P', 'f', -1},
+    {'P', 'g', -1},
+    {'P', 'o', -1},
+    {'P', 'q', -1},
+    {'P', 't', -1},
+    {'P', 'z', -1},
+    {'P', '|', -1},
+    {'P', '~', -1},
+    {'Q', '#', -1},
+    {'Q', '*', -1},
+    {'Q', ',', -1},
+    {'Q', '-', -1},
+    {'Q', '.', -1},
+    {'Q', ':', -1},
+    {'Q', ';', -1},
+    {'Q', '?', -1},
+    {'Q', 'I', -1},
+    {'Q', 'J', -1},
+    {'Q', 'T', -1},
+    {'Q', 'Z', -1},
+    {'Q', 'f', -1},
+    {'Q', 'g', -1},
+    {'Q', 'o', -1},
+    {'Q', 't', -1},
+    {'Q', 'z', -1},
+    {'Q', '|', -1},
+    {'Q', '~', -1},
+    {'R', '#', -1},
+    {'R', 'D', 1},
+    {'R', 'E', 1},
+    {'R', 'F', 1},
+    {'R', 'H', 1},
+    {'R', 'P', 1},
+    {'R', 'R', 1},
+    {'R', 'S', 1},
+    {'R', 'T', -1},
+    {'R', 'U', 1},
+    {'R', 'f', -1},
+    {'S', '#', -1},
+    {'S', '*', -1},
+    {'S', ',', -1},
+    {'S', '-', -1},
+    {'S', '.', -1},
+    {'S', ':', -1},
+    {'S', ';', -1},
+    {'S', '?', -1},
+    {'S', 'I', -1},
+    {'S', 'J', -1},
+    {'S', 'T', -1},
+    {'S', 'Z', -1},
+    {'S', 'f', -1},
+    {'S', 't', -1},
+    {'S', 'z', -1},
+    {'S', '|', -1},
+    {'S', '~', -1},
+    {'T', ' ', -1},
+    {'T', '!', -1},
+    {'T', '"', -1},
+    {'T', '#', -1},
+    {'T', '$', -1},
+    {'T', '%', -1},
+    {'T', '&', -1},
+    {'T', '\'', -1},
+    {'T', ')', -1},
+    {'T', '*', -1},
+    {'T', '+', -1},
+    {'T', ',', -3},
+    {'T', '-', -2},
+    {'T', '.', -3},
+    {'T', '/', -1},
+    {'T', '0', -1},
+    {'T', '1', -1},
+    {'T', '2', -1},
+    {'T', '3', -1},
+    {'T', '4', -1},
+    {'T', '5', -1},
+    {'T', '6', -1},
+    {'T', '7', -1},
+    {'T', '8', -1},
+    {'T', '9', -1},
+    {'T', ':', -3},
+    {'T', ';', -3},
+    {'T', '<', -1},
+    {'T', '=', -1},
+    {'T', '>', -1},
+    {'T', '?', -1},
+    {'T', '@', -1},
+    {'T', 'A', -2},
+    {'T', 'C', -1},
+    {'T', 'G', -1},
+    {'T', 'I', -1},
+    {'T', 'J', -1},
+    {'T', 'O', -1},
+    {'T', 'Q', -1},
+    {'T', 'T', -1},
+    {'T', 'V', -1},
+    {'T', 'W', -1},
+    {'T', 'X', -1},
+    {'T', 'Z', -1},
+    {'T', '\\', -1},
+    {'T', '^', -1},
+    {'T', '_', -1},
+    {'T', '`', -1},
+    {'T', 'a', -2},
+    {'T', 'c', -2},
+    {'T', 'd', -1},
+    {'T', 'e', -2},
+    {'T', 'f', -1},
+    {'T', 'g', -1},
+    {'T', 'i', -1},
+    {'T', 'o', -3},
+    {'T', 'q', -1},
+    {'T', 'r', -1},
+    {'T', 's', -2},
+    {'T', 't', -1},
+    {'T', 'u', -1},
+    {'T', 'v', -1},
+    {'T', 'w', -1},
+    {'T', 'x', -1},
+    {'T', 'y', -1},
+    {'T', 'z', -1},
+    {'T', '|', -1},
+    {'T', '~', -1},
+    {'U', 'B', 1},
+    {'U', 'D', 1},
+    {'U', 'E', 1},
+    {'U', 'F', 1},
+    {'U', 'H', 1},
+    {'U', 'K', 1},
+    {'U', 'L', 1},
+    {'U', 'M', 1},
+    {'U', 'N', 1},
+    {'U', 'P', 1},
+    {'U', 'R', 1},
+    {'U', 'S', 1},
+    {'U', 'U', 1},
+    {'U', 'Y', 1},
+    {'U', '[', 1},
+    {'U', 'k', 1},
+    {'V', '#', -1},
+    {'V', '*', -1},
+    {'V', ',', -2},
+    {'V', '-', -1},
+    {'V', '.', -2},
+    {'V', ':', -1},
+    {'V', ';', -1},
+    {'V', '?', -1},
+    {'V', 'A', -1},
+    {'V', 'J', -1},
+    {'V', 'T', -1},
+    {'V', 'Z', -1},
+    {'V', 'a', -1},
+    {'V', 'e', -1},
+    {'V', 'f', -1},
+    {'V', 'o', -1},
+    {'V', 't', -1},
+    {'V', 'u', -1},
+    {'V', 'y', -1},
+    {'V', 'z', -1},
+    {'V', '|', -1},
+    {'V', '~', -1},
+    {'W', '#', -1},
+    {'W', '*', -1},
+    {'W', ',', -1},
+    {'W', '-', -1},
+    {'W', '.', -1},
+    {'W', ':', -1},
+    {'W', ';', -1},
+    {'W', 'A', -1},
+    {'W', 'T', -1},
+    {'W', 'Z', -1},
+    {'W', 'a', -1},
+    {'W', 'e', -1},
+    {'W', 'f', -1},
+    {'W', 'o', -1},
+    {'W', 't', -1},
+    {'W', 'z', -1},
+    {'X', '#', -1},
+    {'X', '*', -1},
+    {'X', ',', -1},
+    {'X', '-', -1},
+    {'X', '.', -1},
+    {'X', ':', -1},
+    {'X', ';', -1},
+    {'X', '?', -1},
+    {'X', 'J', -1},
+    {'X', 'T', -1},
+    {'X', 'Z', -1},
+    {'X', 'f', -1},
+    {'X', 't', -1},
+    {'X', 'z', -1},
+    {'X', '|', -1},
+    {'X', '~', -1},
+    {'Y', '(', 1},
+    {'Y', ',', -2},
+    {'Y', '-', -1},
+    {'Y', '.', -2},
+    {'Y', ':', -1},
+    {'Y', ';', -1},
+    {'Y', 'A', -1},
+    {'Y', 'B', 1},
+    {'Y', 'D', 1},
+    {'Y', 'E', 1},
+    {'Y', 'F', 1},
+    {'Y', 'H', 1},
+    {'Y', 'K', 1},
+    {'Y', 'L', 1},
+    {'Y', 'M', 1},
+    {'Y', 'N', 1},
+    {'Y', 'P', 1},
+    {'Y', 'R', 1},
+    {'Y', 'S', 1},
+    {'Y', 'U', 1},
+    {'Y', 'Y', 1},
+    {'Y', '[', 1},
+    {'Y', ']', 1},
+    {'Y', 'a', -1},
+    {'Y', 'b', 1},
+    {'Y', 'e', -1},
+    {'Y', 'h', 1},
+    {'Y', 'j', 1},
+    {'Y', 'k', 1},
+    {'Y', 'l', 1},
+    {'Y', 'm', 1},
+    {'Y', 'n', 1},
+    {'Y', 'o', -1},
+    {'Y', 'q', -1},
+    {'Y', 'r', 1},
+    {'Y', '{', 1},
+    {'Y', '}', 1},
+    {'Z', '!', -1},
+    {'Z', '"', -1},
+    {'Z', '#', -1},
+    {'Z', '$', -1},
+    {'Z', '&', -1},
+    {'Z', '\'', -1},
+    {'Z', ')', -1},
+    {'Z', '*', -1},
+    {'Z', '+', -1},
+    {'Z', ',', -1},
+    {'Z', '-', -1},
+    {'Z', '.', -1},
+    {'Z', ':', -1},
+    {'Z', ';', -1},
+    {'Z', '<', -1},
+    {'Z', '=', -1},
+    {'Z', '>', -1},
+    {'Z', '?', -1},
+    {'Z', 'C', -1},
+    {'Z', 'I', -1},
+    {'Z', 'J', -1},
+    {'Z', 'Q', -1},
+    {'Z', 'T', -1},
+    {'Z', 'Z', -1},
+    {'Z', 'a', -1},
+    {'Z', 'c', -1},
+    {'Z', 'd', -1},
+    {'Z', 'e', -1},
+    {'Z', 'f', -1},
+    {'Z', 'g', -1},
+    {'Z', 'o', -1},
+    {'Z', 'q', -1},
+    {'Z', 's', -1},
+    {'Z', 't', -1},
+    {'Z', 'z', -1},
+    {'Z', '|', -1},
+    {'Z', '~', -1},
+    {'[', '#', -1},
+    {'[', '*', -1},
+    {'[', ',', -1},
+    {'[', '-', -1},
+    {'[', '.', -1},
+    {'[', ':', -1},
+    {'[', ';', -1},
+    {'[', '?', -1},
+    {'[', 'T', -1},
+    {'[', 'Z', -1},
+    {'[', 'f', -1},
+    {'[', 't', -1},
+    {'[', 'z', -1},
+    {'[', '|', -1},
+    {'\\', '#', -1},
+    {'\\', 'E', 1},
+    {'\\', 'F', 1},
+    {'\\', 'H', 1},
+    {'\\', 'P', 1},
+    {'\\', 'R', 1},
+    {'\\', 'S', 1},
+    {'\\', 'T', -1},
+    {'\\', 'U', 1},
+    {'\\', 'f', -1},
+    {']', '#', -1},
+    {']', '-', -1},
+    {']', 'T', -1},
+    {']', 'Z', -1},
+    {']', 'f', -1},
+    {']', 't', -1},
+    {']', 'z', -1},
+    {'^', '#', -1},
+    {'^', '*', -1},
+    {'^', '-', -1},
+    {'^', 'T', -1},
+    {'^', 'Z', -1},
+    {'^', 'f', -1},
+    {'^', 't', -1},
+    {'^', 'z', -1},
+    {'_', '#', -1},
+    {'_', 'B', 1},
+    {'_', 'D', 1},
+    {'_', 'E', 1},
+    {'_', 'F', 1},
+    {'_', 'H', 1},
+    {'_', 'K', 1},
+    {'_', 'L', 1},
+    {'_', 'M', 1},
+    {'_', 'N', 1},
+    {'_', 'P', 1},
+    {'_', 'R', 1},
+    {'_', 'S', 1},
+    {'_', 'U', 1},
+    {'_', 'Y', 1},
+    {'`', '#', -1},
+    {'`', '*', -1},
+    {'`', '-', -1},
+    {'`', 'T', -1},
+    {'`', 'Z', -1},
+    {'`', 'f', -1},
+    {'`', 't', -1},
+    {'`', 'z', -1},
+    {'a', '#', -1},
+    {'a', 'E', 1},
+    {'a', 'F', 1},
+    {'a', 'H', 1},
+    {'a', 'P', 1},
+    {'a', 'R', 1},
+    {'a', 'S', 1},
+    {'a', 'U', 1},
+    {'a', 'f', -1},
+    {'b', '!', -1},
+    {'b', '#', -1},
+    {'b', '$', -1},
+    {'b', '*', -1},
+    {'b', ',', -1},
+    {'b', '-', -1},
+    {'b', '.', -1},
+    {'b', ':', -1},
+    {'b', ';', -1},
+    {'b', '<', -1},
+    {'b', '>', -1},
+    {'b', '?', -1},
+    {'b', 'I', -1},
+    {'b', 'J', -1},
+    {'b', 'T', -1},
+    {'b', 'Z', -1},
+    {'b', 'a', -1},
+    {'b', 'd', -1},
+    {'b', 'e', -1},
+    {'b', 'f', -1},
+    {'b', 'g', -1},
+    {'b', 'o', -1},
+    {'b', 'q', -1},
+    {'b', 't', -1},
+    {'b', 'z', -1},
+    {'b', '|', -1},
+    {'b', '~', -1},
+    {'c', '!', -1},
+    {'c', '"', -1},
+    {'c', '#', -1},
+    {'c', '$', -1},
+    {'c', '&', -1},
+    {'c', '\'', -1},
+    {'c', '*', -1},
+    {'c', '+', -1},
+    {'c', ',', -1},
+    {'c', '-', -1},
+    {'c', '.', -1},
+    {'c', ':', -1},
+    {'c', ';', -1},
+    {'c', '<', -1},
+    {'c', '=', -1},
+    {'c', '>', -1},
+    {'c', '?', -1},
+    {'c', 'I', -1},
+    {'c', 'J', -1},
+    {'c', 'Q', -1},
+    {'c', 'T', -1},
+    {'c', 'Z', -1},
+    {'c', 'a', -1},
+    {'c', 'c', -1},
+    {'c', 'd', -1},
+    {'c', 'e', -1},
+    {'c', 'f', -1},
+    {'c', 'g', -1},
+    {'c', 'o', -1},
+    {'c', 'q', -1},
+    {'c', 's', -1},
+    {'c', 't', -1},
+    {'c', 'z', -1},
+    {'c', '|', -1},
+    {'c', '~', -1},
+    {'d', '#', -1},
+    {'d', 'D', 1},
+    {'d', 'E', 1},
+    {'d', 'F', 1},
+    {'d', 'H', 1},
+    {'d', 'P', 1},
+    {'d', 'R', 1},
+    {'d', 'S', 1},
+    {'d', 'U', 1},
+    {'d', 'Y', 1},
+    {'d', 'f', -1},
+    {'e', '(', 1},
+    {'e', 'B', 1},
+    {'e', 'D', 1},
+    {'e', 'E', 1},
+    {'e', 'F', 1},
+    {'e', 'H', 1},
+    {'e', 'K', 1},
+    {'e', 'L', 1},
+    {'e', 'M', 1},
+    {'e', 'N', 1},
+    {'e', 'P', 1},
+    {'e', 'R', 1},
+    {'e', 'S', 1},
+    {'e', 'U', 1},
+    {'e', 'Y', 1},
+    {'e', '[', 1},
+    {'e', ']', 1},
+    {'e', 'b', 1},
+    {'e', 'h', 1},
+    {'e', 'i', 1},
+    {'e', 'j', 1},
+    {'e', 'k', 1},
+    {'e', 'l', 1},
+    {'e', 'm', 1},
+    {'e', 'n', 1},
+    {'e', 'p', 1},
+    {'e', 'r', 1},
+    {'e', 'u', 1},
+    {'e', '{', 1},
+    {'e', '}', 1},
+    {'f', ' ', -1},
+    {'f', '!', -1},
+    {'f', '"', -1},
+    {'f', '#', -2},
+    {'f', '$', -1},
+    {'f', '%', -1},
+    {'f', '&', -1},
+    {'f', '\'', -1},
+    {'f', '(', -1},
+    {'f', ')', -1},
+    {'f', '*', -1},
+    {'f', '+', -1},
+    {'f', ',', -1},
+    {'f', '-', -1},
+    {'f', '.', -1},
+    {'f', '/', -1},
+    {'f', '0', -1},
+    {'f', '1', -1},
+    {'f', '2', -1},
+    {'f', '3', -1},
+    {'f', '4', -1},
+    {'f', '5', -1},
+    {'f', '6', -1},
+    {'f', '7', -1},
+    {'f', '8', -1},
+    {'f', '9', -1},
+    {'f', ':', -1},
+    {'f', ';', -1},
+    {'f', '<', -1},
+    {'f', '=', -1},
+    {'f', '>', -1},
+    {'f', '?', -1},
+    {'f', '@', -1},
+    {'f', 'A', -1},
+    {'f', 'B', -1},
+    {'f', 'C', -1},
+    {'f', 'G', -1},
+    {'f', 'I', -1},
+    {'f', 'J', -1},
+    {'f', 'K', -1},
+    {'f', 'L', -1},
+    {'f', 'M', -1},
+    {'f', 'N', -1},
+    {'f', 'O', -1},
+    {'f', 'Q', -1},
+    {'f', 'T', -1},
+    {'f', 'V', -1},
+    {'f', 'W', -1},
+    {'f', 'X', -1},
+    {'f', 'Z', -1},
+    {'f', '[', -1},
+    {'f', '\\', -1},
+    {'f', ']', -1},
+    {'f', '^', -1},
+    {'f', '_', -1},
+    {'f', '`', -1},
+    {'f', 'a', -1},
+    {'f', 'b', -1},
+    {'f', 'c', -1},
+    {'f', 'd', -1},
+    {'f', 'e', -1},
+    {'f', 'f', -2},
+    {'f', 'g', -1},
+    {'f', 'h', -1},
+    {'f', 'i', -1},
+    {'f', 'j', -1},
+    {'f', 'k', -1},
+    {'f', 'l', -1},
+    {'f', 'm', -1},
+    {'f', 'n', -1},
+    {'f', 'o', -1},
+    {'f', 'p', -1},
+    {'f', 'q', -1},
+    {'f', 'r', -1},
+    {'f', 's', -1},
+    {'f', 't', -1},
+    {'f', 'u', -1},
+    {'f', 'v', -1},
+    {'f', 'w', -1},
+    {'f', 'x', -1},
+    {'f', 'y', -1},
+    {'f', 'z', -1},
+    {'f', '{', -1},
+    {'f', '|', -1},
+    {'f', '}', -1},
+    {'f', '~', -1},
+    {'g', '#', -1},
+    {'g', 'E', 1},
+    {'g', 'F', 1},
+    {'g', 'S', 1},
+    {'g', 'T', -1},
+    {'g', 'f', -1},
+    {'h', '#', -1},
+    {'h', 'E', 1},
+    {'h', 'F', 1},
+    {'h', 'S', 1},
+    {'h', 'T', -1},
+    {'h', 'f', -1},
+    {'i', '#', -1},
+    {'i', 'E', 1},
+    {'i', 'F', 1},
+    {'i', 'H', 1},
+    {'i', 'P', 1},
+    {'i', 'R', 1},
+    {'i', 'S', 1},
+    {'i', 'U', 1},
+    {'i', 'f', -1},
+    {'j', '#', -1},
+    {'j', 'E', 1},
+    {'j', 'F', 1},
+    {'j', 'H', 1},
+    {'j', 'P', 1},
+    {'j', 'R', 1},
+    {'j', 'S', 1},
+    {'j', 'U', 1},
+    {'j', 'f', -1},
+    {'k', '#', -1},
+    {'k', 'B', 1},
+    {'k', 'D', 1},
+    {'k', 'E', 1},
+    {'k', 'F', 1},
+    {'k', 'H', 1},
+    {'k', 'K', 1},
+    {'k', 'L', 1},
+    {'k', 'M', 1},
+    {'k', 'N', 1},
+    {'k', 'P', 1},
+    {'k', 'R', 1},
+    {'k', 'S', 1},
+    {'k', 'U', 1},
+    {'k', 'Y', 1},
+    {'k', 'f', -1},
+    {'l', '#', -1},
+    {'l', 'B', 1},
+    {'l', 'D', 1},
+    {'l', 'E', 1},
+    {'l', 'F', 1},
+    {'l', 'H', 1},
+    {'l', 'K', 1},
+    {'l', 'M', 1},
+    {'l', 'N', 1},
+    {'l', 'P', 1},
+    {'l', 'R', 1},
+    {'l', 'S', 1},
+    {'l', 'U', 1},
+    {'l', 'Y', 1},
+    {'l', 'f', -1},
+    {'m', '#', -1},
+    {'m', '-', -1},
+    {'m', 'F', 1},
+    {'m', 'T', -1},
+    {'m', 'Z', -1},
+    {'m', 'f', -1},
+    {'m', 't', -1},
+    {'m', 'z', -1},
+    {'n', '#', -1},
+    {'n', 'E', 1},
+    {'n', 'F', 1},
+    {'n', 'S', 1},
+    {'n', 'T', -1},
+    {'n', 'f', -1},
+    {'o', '!', -1},
+    {'o', '#', -1},
+    {'o', '$', -1},
+    {'o', '*', -1},
+    {'o', '+', -1},
+    {'o', ',', -1},
+    {'o', '-', -1},
+    {'o', '.', -1},
+    {'o', ':', -1},
+    {'o', ';', -1},
+    {'o', '<', -1},
+    {'o', '=', -1},
+    {'o', '>', -1},
+    {'o', '?', -1},
+    {'o', 'I', -1},
+    {'o', 'J', -1},
+    {'o', 'T', -1},
+    {'o', 'Z', -1},
+    {'o', 'a', -1},
+    {'o', 'c', -1},
+    {'o', 'd', -1},
+    {'o', 'e', -1},
+    {'o', 'f', -1},
+    {'o', 'g', -1},
+    {'o', 'o', -1},
+    {'o', 'q', -1},
+    {'o', 't', -1},
+    {'o', 'z', -1},
+    {'o', '|', -1},
+    {'o', '~', -1},
+    {'p', '!', -1},
+    {'p', '#', -1},
+    {'p', '$', -1},
+    {'p', '*', -1},
+    {'p', '+', -1},
+    {'p', ',', -1},
+    {'p', '-', -1},
+    {'p', '.', -1},
+    {'p', ':', -1},
+    {'p', ';', -1},
+    {'p', '<', -1},
+    {'p', '=', -1},
+    {'p', '>', -1},
+    {'p', '?', -1},
+    {'p', 'I', -1},
+    {'p', 'J', -1},
+    {'p', 'T', -1},
+    {'p', 'Z', -1},
+    {'p', 'a', -1},
+    {'p', 'd', -1},
+    {'p', 'e', -1},
+    {'p', 'f', -1},
+    {'p', 'g', -1},
+    {'p', 'o', -1},
+    {'p', 'q', -1},
+    {'p', 't', -1},
+    {'p', 'z', -1},
+    {'p', '|', -1},
+    {'p', '~', -1},
+    {'q', '#', -1},
+    {'q', 'D', 1},
+    {'q', 'E', 1},
+    {'q', 'F', 1},
+    {'q', 'H', 1},
+    {'q', 'P', 1},
+    {'q', 'R', 1},
+    {'q', 'S', 1},
+    {'q', 'U', 1},
+    {'q', 'Y', 1},
+    {'q', 'f', -1},
+    {'r', '#', -1},
+    {'r', '*', -1},
+    {'r', ',', -1},
+    {'r', '-', -1},
+    {'r', '.', -1},
+    {'r', ':', -1},
+    {'r', ';', -1},
+    {'r', '?', -1},
+    {'r', 'I', -1},
+    {'r', 'J', -1},
+    {'r', 'T', -1},
+    {'r', 'Z', -1},
+    {'r', 'd', -1},
+    {'r', 'f', -1},
+    {'r', 'g', -1},
+    {'r', 'o', -1},
+    {'r', 't', -1},
+    {'r', 'z', -1},
+    {'r', '|', -1},
+    {'r', '~', -1},
+    {'s', '!', -1},
+    {'s', '#', -1},
+    {'s', '$', -1},
+    {'s', '*', -1},
+    {'s', '+', -1},
+    {'s', ',', -1},
+    {'s', '-', -1},
+    {'s', '.', -1},
+    {'s', ':', -1},
+    {'s', ';', -1},
+    {'s', '<', -1},
+    {'s', '=', -1},
+    {'s', '>', -1},
+    {'s', '?', -1},
+    {'s', 'I', -1},
+    {'s', 'J', -1},
+    {'s', 'T', -1},
+    {'s', 'Z', -1},
+    {'s', 'a', -1},
+    {'s', 'c', -1},
+    {'s', 'd', -1},
+    {'s', 'e', -1},
+    {'s', 'f', -1},
+    {'s', 'g', -1},
+    {'s', 'o', -1},
+    {'s', 'q', -1},
+    {'s', 't', -1},
+    {'s', 'z', -1},
+    {'s', '|', -1},
+    {'s', '~', -1},
+    {'t', ' ', -1},
+    {'t', '!', -1},
+    {'t', '"', -1},
+    {'t', '#', -1},
+    {'t', '$', -1},
+    {'t', '%', -1},
+    {'t', '&', -1},
+    {'t', '\'', -1},
+    {'t', ')', -1},
+    {'t', '*', -1},
+    {'t', '+', -1},
+    {'t', ',', -1},
+    {'t', '-', -1},
+    {'t', '.', -1},
+    {'t', '/', -1},
+    {'t', '0', -1},
+    {'t', '1', -1},
+    {'t', '2', -1},
+    {'t', '3', -1},
+    {'t', '4', -1},
+    {'t', '5', -1},
+    {'t', '6', -1},
+    {'t', '7', -1},
+    {'t', '8', -1},
+    {'t', '9', -1},
+    {'t', ':', -1},
+    {'t', ';', -1},
+    {'t', '<', -1},
+    {'t', '=', -1},
+    {'t', '>', -1},
+    {'t', '?', -1},
+    {'t', '@', -1},
+    {'t', 'A', -1},
+    {'t', 'C', -1},
+    {'t', 'G', -1},
+    {'t', 'I', -1},
+    {'t', 'J', -1},
+    {'t', 'O', -1},
+    {'t', 'Q', -1},
+    {'t', 'T', -1},
+    {'t', 'V', -1},
+    {'t', 'W', -1},
+    {'t', 'X', -1},
+    {'t', 'Z', -1},
+    {'t', '\\', -1},
+    {'t', '^', -1},
+    {'t', '_', -1},
+    {'t', '`', -1},
+    {'t', 'a', -1},
+    {'t', 'c', -1},
+    {'t', 'd', -1},
+    {'t', 'e', -1},
+    {'t', 'f', -1},
+    {'t', 'g', -1},
+    {'t', 'o', -1},
+    {'t', 'q', -1},
+    {'t', 's', -1},
+    {'t', 't', -1},
+    {'t', 'v', -1},
+    {'t', 'w', -1},
+    {'t', 'x', -1},
+    {'t', 'y', -1},
+    {'t', 'z', -1},
+    {'t', '|', -1},
+    {'t', '~', -1},
+    {'u', '#', -1},
+    {'u', 'D', 1},
+    {'u', 'E', 1},
+    {'u', 'F', 1},
+    {'u', 'H', 1},
+    {'u', 'P', 1},
+    {'u', 'R', 1},
+    {'u', 'S', 1},
+    {'u', 'U', 1},
+    {'u', 'Y', 1},
+    {'u', 'f', -1},
+    {'v', '(', 1},
+    {'v', ',', -1},
+    {'v', '.', -1},
+    {'v', 'B', 1},
+    {'v', 'D', 1},
+    {'v', 'E', 1},
+    {'v', 'F', 1},
+    {'v', 'H', 1},
+    {'v', 'K', 1},
+    {'v', 'L', 1},
+    {'v', 'M', 1},
+    {'v', 'N', 1},
+    {'v', 'P', 1},
+    {'v', 'R', 1},
+    {'v', 'S', 1},
+    {'v', 'U', 1},
+    {'v', 'Y', 1},
+    {'v', '[', 1},
+    {'v', ']', 1},
+    {'v', 'b', 1},
+    {'v', 'h', 1},
+    {'v', 'i', 1},
+    {'v', 'j', 1},
+    {'v', 'k', 1},
+    {'v', 'l', 1},
+    {'v', 'm', 1},
+    {'v', 'n', 1},
+    {'v', 'p', 1},
+    {'v', 'r', 1},
+    {'v', 'u', 1},
+    {'v', '{', 1},
+    {'v', '}', 1},
+    {'w', '!', -1},
+    {'w', '#', -1},
+    {'w', '$', -1},
+    {'w', '*', -1},
+    {'w', '+', -1},
+    {'w', ',', -2},
+    {'w', '-', -1},
+    {'w', '.', -2},
+    {'w', ':', -1},
+    {'w', ';', -1},
+    {'w', '<', -1},
+    {'w', '=', -1},
+    {'w', '>', -1},
+    {'w', '?', -1},
+    {'w', 'I', -1},
+    {'w', 'J', -1},
+    {'w', 'T', -1},
+    {'w', 'Z', -1},
+    {'w', 'a', -1},
+    {'w', 'c', -1},
+    {'w', 'd', -1},
+    {'w', 'e', -1},
+    {'w', 'f', -1},
+    {'w', 'g', -1},
+    {'w', 'o', -1},
+    {'w', 'q', -1},
+    {'w', 't', -1},
+    {'w', 'z', -1},
+    {'w', '|', -1},
+    {'w', '~', -1},
+    {'x', '(', 1},
+    {'x', 'B', 1},
+    {'x', 'D', 1},
+    {'x', 'E', 1},
+    {'x', 'F', 1},
+    {'x', 'H', 1},
+    {'x', 'K', 1},
+    {'x', 'L', 1},
+    {'x', 'M', 1},
+    {'x', 'N', 1},
+    {'x', 'P', 1},
+    {'x', 'R', 1},
+    {'x', 'S', 1},
+    {'x', 'U', 1},
+    {'x', 'Y', 1},
+    {'x', '[', 1},
+    {'x', ']', 1},
+    {'x', 'b', 1},
+    {'x', 'h', 1},
+    {'x', 'i', 1},
+    {'x', 'j', 1},
+    {'x', 'k', 1},
+    {'x', 'l', 1},
+    {'x', 'm', 1},
+    {'x', 'n', 1},
+    {'x', 'p', 1},
+    {'x', 'r', 1},
+    {'x', 'u', 1},
+    {'x', '{', 1},
+    {'x', '}', 1},
+    {'y', '(', 1},
+    {'y', ',', -1},
+    {'y', '.', -1},
+    {'y', 'B', 1},
+    {'y', 'D', 1},
+    {'y', 'E', 1},
+    {'y', 'F', 1},
+    {'y', 'H', 1},
+    {'y', 'K', 1},
+    {'y', 'L', 1},
+    {'y', 'M', 1},
+    {'y', 'N', 1},
+    {'y', 'P', 1},
+    {'y', 'R', 1},
+    {'y', 'S', 1},
+    {'y', 'U', 1},
+    {'y', 'Y', 1},
+    {'y', '[', 1},
+    {'y', ']', 1},
+    {'y', 'b', 1},
+    {'y', 'h', 1},
+    {'y', 'i', 1},
+    {'y', 'j', 1},
+    {'y', 'k', 1},
+    {'y', 'l', 1},
+    {'y', 'm', 1},
+    {'y', 'n', 1},
+    {'y', 'p', 1},
+    {'y', 'r', 1},
+    {'y', 'u', 1},
+    {'y', '{', 1},
+    {'y', '}', 1},
+    {'z', '!', -1},
+    {'z', '"', -1},
+    {'z', '#', -1},
+    {'z', '$', -1},
+    {'z', '&', -1},
+    {'z', '\'', -1},
+    {'z', ')', -1},
+    {'z', '*', -1},
+    {'z', '+', -1},
+    {'z', ',', -1},
+    {'z', '-', -1},
+    {'z', '.', -1},
+    {'z', ':', -1},
+    {'z', ';', -1},
+    {'z', '<', -1},
+    {'z', '=', -1},
+    {'z', '>', -1},
+    {'z', '?', -1},
+    {'z', 'I', -1},
+    {'z', 'J', -1},
+    {'z', 'Q', -1},
+    {'z', 'T', -1},
+    {'z', 'Z', -1},
+    {'z', 'a', -1},
+    {'z', 'c', -1},
+    {'z', 'd', -1},
+    {'z', 'e', -1},
+    {'z', 'f', -1},
+    {'z', 'g', -1},
+    {'z', 'o', -1},
+    {'z', 'q', -1},
+    {'z', 's', -1},
+    {'z', 't', -1},
+    {'z', 'z', -1},
+    {'z', '|', -1},
+    {'z', '~', -1},
+    {'{', '!', -1},
+    {'{', '#', -1},
+    {'{', '*', -1},
+    {'{', ',', -1},
+    {'{', '-', -1},
+    {'{', '.', -1},
+    {'{', ':', -1},
+    {'{', ';', -1},
+    {'{', '?', -1},
+    {'{', 'I', -1},
+    {'{', 'J', -1},
+    {'{', 'T', -1},
+    {'{', 'Z', -1},
+    {'{', 'd', -1},
+    {'{', 'f', -1},
+    {'{', 'g', -1},
+    {'{', 'o', -1},
+    {'{', 'q', -1},
+    {'{', 't', -1},
+    {'{', 'z', -1},
+    {'{', '|', -1},
+    {'{', '~', -1},
+    {'|', '(', 1},
+    {'|', 'B', 1},
+    {'|', 'D', 1},
+    {'|', 'E', 1},
+    {'|', 'F', 1},
+    {'|', 'H', 1},
+    {'|', 'K', 1},
+    {'|', 'L', 1},
+    {'|', 'M', 1},
+    {'|', 'N', 1},
+    {'|', 'P', 1},
+    {'|', 'R', 1},
+    {'|', 'S', 1},
+    {'|', 'U', 1},
+    {'|', 'Y', 1},
+    {'|', '[', 1},
+    {'|', ']', 1},
+    {'|', 'b', 1},
+    {'|', 'h', 1},
+    {'|', 'i', 1},
+    {'|', 'j', 1},
+    {'|', 'k', 1},
+    {'|', 'l', 1},
+    {'|', 'm', 1},
+    {'|', 'n', 1},
+    {'|', 'p', 1},
+    {'|', 'r', 1},
+    {'|', 'u', 1},
+    {'|', '{', 1},
+    {'|', '}', 1},
+    {'}', '!', -1},
+    {'}', '#', -1},
+    {'}', '$', -1},
+    {'}', '*', -1},
+    {'}', ',', -1},
+    {'}', '-', -1},
+    {'}', '.', -1},
+    {'}', ':', -1},
+    {'}', ';', -1},
+    {'}', '<', -1},
+    {'}', '>', -1},
+    {'}', '?', -1},
+    {'}', 'I', -1},
+    {'}', 'J', -1},
+    {'}', 'T', -1},
+    {'}', 'Z', -1},
+    {'}', 'a', -1},
+    {'}', 'd', -1},
+    {'}', 'e', -1},
+    {'}', 'f', -1},
+    {'}', 'g', -1},
+    {'}', 'o', -1},
+    {'}', 'q', -1},
+    {'}', 't', -1},
+    {'}', 'z', -1},
+    {'}', '|', -1},
+    {'}', '~', -1},
+    {'~', '!', -1},
+    {'~', '#', -1},
+    {'~', '$', -1},
+    {'~', '*', -1},
+    {'~', '+', -1},
+    {'~', ',', -1},
+    {'~', '-', -1},
+    {'~', '.', -1},
+    {'~', ':', -1},
+    {'~', ';', -1},
+    {'~', '<', -1},
+    {'~', '=', -1},
+    {'~', '>', -1},
+    {'~', '?', -1},
+    {'~', 'I', -1},
+    {'~', 'J', -1},
+    {'~', 'T', -1},
+    {'~', 'Z', -1},
+    {'~', 'a', -1},
+    {'~', 'c', -1},
+    {'~', 'd', -1},
+    {'~', 'e', -1},
+    {'~', 'f', -1},
+    {'~', 'g', -1},
+    {'~', 'o', -1},
+    {'~', 'q', -1},
+    {'~', 't', -1},
+    {'~', 'z', -1},
+    {'~', '|', -1},
+    {'~', '~', -1},
+    {' ', 'A', -1},
+    {' ', ']', -1},
+    {'-', '-', -1},
+    {'-', '.', -1},
+    {'-', ':', -1},
+    {'-', 'E', -1},
+    {'-', 'P', -1},
+    {'-', 'R', -1},
+    {'-', ']', -1},
+    {'-', 'a', -1},
+    {'.', 'D', 1},
+    {'.', 'S', 1},
+    {'.', 'Y', 1},
+    {'.', '[', 1},
+    {'.', 'h', 1},
+    {'0', ']', -1},
+    {'1', '1', -1},
+    {'1', ']', -1},
+    {'2', ']', -1},
+    {'3', ']', -1},
+    {'4', ']', -1},
+    {'5', ']', -1},
+    {'6', ']', -1},
+    {'7', ']', -1},
+    {'8', ']', -1},
+    {'9', ']', -1},
+    {':', 'D', 1},
+    {':', 'S', 1},
+    {':', 'Y', 1},
+    {':', '[', 1},
+    {':', 'h', 1},
+    {'A', ' ', -1},
+    {'A', 'D', 1},
+    {'A', 'S', 1},
+    {'A', 'Y', -1},
+    {'A', '[', 1},
+    {'C', 'D', 1},
+    {'C', 'S', 1},
+    {'C', 'Y', 1},
+    {'D', '-', -1},
+    {'D', 'E', -1},
+    {'D', 'P', -1},
+    {'D', 'R', -1},
+    {'D', ']', -1},
+    {'E', '-', -1},
+    {'E', '.', -1},
+    {'E', ':', -1},
+    {'E', 'C', -1},
+    {'E', 'E', -1},
+    {'E', 'P', -1},
+    {'E', 'R', -1},
+    {'E', ']', -1},
+    {'E', 'a', -1},
+    {'E', 's', -1},
+    {'P', ' ', -1},
+    {'P', '-', -1},
+    {'P', '.', -3},
+    {'P', ':', -1},
+    {'P', 'A', -2},
+    {'P', 'E', -1},
+    {'P', 'P', -1},
+    {'P', 'R', -1},
+    {'P', ']', -1},
+    {'P', 'a', -1},
+    {'R', 'D', 1},
+    {'R', 'S', 1},
+    {'R', 'Y', 1},
+    {'R', '[', 1},
+    {'R', 'h', 1},
+    {'S', '-', -1},
+    {'S', 'E', -1},
+    {'S', 'P', -1},
+    {'S', 'R', -1},
+    {'S', ']', -1},
+    {'S', 'a', -1},
+    {'Y', ' ', -1},
+    {'Y', '-', -3},
+    {'Y', '.', -3},
+    {'Y', ':', -2},
+    {'Y', 'A', -2},
+    {'Y', 'C', -1},
+    {'Y', 'E', -1},
+    {'Y', 'P', -1},
+    {'Y', 'R', -1},
+    {'Y', ']', -1},
+    {'Y', 'a', -2},
+    {'Y', 's', -1},
+    {'[', ' ', -1},
+    {'[', '-', -1},
+    {'[', '.', -1},
+    {'[', '0', -1},
+    {'[', '1', -1},
+    {'[', '2', -1},
+    {'[', '3', -1},
+    {'[', '4', -1},
+    {'[', '5', -1},
+    {'[', '6', -1},
+    {'[', '7', -1},
+    {'[', '8', -1},
+    {'[', '9', -1},
+    {'[', ':', -1},
+    {'[', 'A', -1},
+    {'[', 'C', -1},
+    {'[', 'E', -1},
+    {'[', 'P', -1},
+    {'[', 'R', -1},
+    {'[', ']', -1},
+    {'[', 'a', -1},
+    {'[', 's', -1},
+    {']', ']', -1},
+    {'a', 'D', 1},
+    {'a', 'S', 1},
+    {'a', 'Y', 1},
+    {'a', '[', 1},
+    {'h', 'D', 1},
+    {'h', 'S', 1},
+    {'h', 'Y', 1},
+    {'h', '[', 1},
+    {'h', 'h', 1},
+    {'s', '-', -1},
+    {'s', 'E', -1},
+    {'s', 'P', -1},
+    {'s', 'R', -1},
+    {'s', ']', -1},
+    {'s', 'a', -1},
+    {' ', '#', -1},
+    {' ', 'A', -1},
+    {' ', 'I', 1},
+    {' ', 'T', -1},
+    {' ', 'f', -1},
+    {'!', '!', -1},
+    {'!', '#', -1},
+    {'!', '(', -1},
+    {'!', 'T', -1},
+    {'!', 'Z', -1},
+    {'!', ']', -1},
+    {'!', 'b', -1},
+    {'!', 'f', -1},
+    {'!', 'j', -1},
+    {'!', 'l', -1},
+    {'!', 't', -1},
+    {'!', 'u', -1},
+    {'!', 'z', -1},
+    {'"', '$', 1},
+    {'"', '%', 1},
+    {'"', '+', 1},
+    {'"', ',', 1},
+    {'"', '.', 1},
+    {'"', ':', 1},
+    {'"', ';', 1},
+    {'"', '<', 1},
+    {'"', '=', 1},
+    {'"', '>', 1},
+    {'"', '@', 1},
+    {'"', 'G', 1},
+    {'"', 'I', 1},
+    {'"', 'O', 1},
+    {'"', 'Y', 1},
+    {'"', '|', 1},
+    {'#', ' ', -1},
+    {'#', '!', -1},
+    {'#', '#', -1},
+    {'#', '(', -1},
+    {'#', ')', -1},
+    {'#', '-', -1},
+    {'#', '/', -1},
+    {'#', '0', -1},
+    {'#', '1', -1},
+    {'#', '2', -1},
+    {'#', '3', -1},
+    {'#', '4', -1},
+    {'#', '5', -1},
+    {'#', '6', -1},
+    {'#', '7', -1},
+    {'#', '8', -1},
+    {'#', '9', -1},
+    {'#', '?', -1},
+    {'#', 'A', -1},
+    {'#', 'B', -1},
+    {'#', 'D', -1},
+    {'#', 'J', -1},
+    {'#', 'K', -1},
+    {'#', 'L', -1},
+    {'#', 'M', -1},
+    {'#', 'N', -1},
+    {'#', 'S', -1},
+    {'#', 'T', -1},
+    {'#', 'V', -1},
+    {'#', 'W', -1},
+    {'#', 'X', -1},
+    {'#', 'Z', -1},
+    {'#', '[', -1},
+    {'#', '\\', -1},
+    {'#', ']', -1},
+    {'#', '^', -1},
+    {'#', '_', -1},
+    {'#', '`', -1},
+    {'#', 'a', -1},
+    {'#', 'b', -1},
+    {'#', 'd', -1},
+    {'#', 'e', -1},
+    {'#', 'f', -1},
+    {'#', 'g', -1},
+    {'#', 'h', -1},
+    {'#', 'i', -1},
+    {'#', 'j', -1},
+    {'#', 'k', -1},
+    {'#', 'l', -1},
+    {'#', 'm', -1},
+    {'#', 'n', -1},
+    {'#', 'o', -1},
+    {'#', 'p', -1},
+    {'#', 'q', -1},
+    {'#', 'r', -1},
+    {'#', 't', -1},
+    {'#', 'u', -1},
+    {'#', 'v', -1},
+    {'#', 'w', -1},
+    {'#', 'x', -1},
+    {'#', 'y', -1},
+    {'#', 'z', -1},
+    {'$', '$', 1},
+    {'$', '%', 1},
+    {'$', '+', 1},
+    {'$', ',', 1},
+    {'$', '.', 1},
+    {'$', ':', 1},
+    {'$', ';', 1},
+    {'$', '<', 1},
+    {'$', '=', 1},
+    {'$', '>', 1},
+    {'$', '@', 1},
+    {'$', 'C', 1},
+    {'$', 'G', 1},
+    {'$', 'I', 1},
+    {'$', 'O', 1},
+    {'$', 'Y', 1},
+    {'$', '|', 1},
+    {'%', '#', -1},
+    {'%', '%', 1},
+    {'%', 'I', 1},
+    {'%', 'f', -1},
+    {'&', '"', 1},
+    {'&', '$', 1},
+    {'&', '%', 1},
+    {'&', '+', 1},
+    {'&', ',', 1},
+    {'&', '.', 1},
+    {'&', ':', 1},
+    {'&', ';', 1},
+    {'&', '<', 1},
+    {'&', '=', 1},
+    {'&', '>', 1},
+    {'&', '@', 1},
+    {'&', 'C', 1},
+    {'&', 'F', 1},
+    {'&', 'G', 1},
+    {'&', 'I', 1},
+    {'&', 'O', 1},
+    {'&', 'Q', 1},
+    {'&', 'Y', 1},
+    {'&', 's', 1},
+    {'&', '{', 1},
+    {'&', '|', 1},
+    {'\'', '!', -1},
+    {'\'', '#', -1},
+    {'\'', '(', -1},
+    {'\'', ')', -1},
+    {'\'', '-', -1},
+    {'\'', 'J', -1},
+    {'\'', 'S', -1},
+    {'\'', 'T', -1},
+    {'\'', 'Z', -1},
+    {'\'', '[', -1},
+    {'\'', ']', -1},
+    {'\'', 'b', -1},
+    {'\'', 'f', -1},
+    {'\'', 'g', -1},
+    {'\'', 'h', -1},
+    {'\'', 'i', -1},
+    {'\'', 'j', -1},
+    {'\'', 'k', -1},
+    {'\'', 'l', -1},
+    {'\'', 'm', -1},
+    {'\'', 'n', -1},
+    {'\'', 'o', -1},
+    {'\'', 'p', -1},
+    {'\'', 'r', -1},
+    {'\'', 't', -1},
+    {'\'', 'u', -1},
+    {'\'', 'z', -1},
+    {'(', '$', 1},
+    {'(', '%', 1},
+    {'(', '+', 1},
+    {'(', ',', 1},
+    {'(', '.', 1},
+    {'(', ':', 1},
+    {'(', ';', 1},
+    {'(', '<', 1},
+    {'(', '=', 1},
+    {'(', '>', 1},
+    {'(', '@', 1},
+    {'(', 'G', 1},
+    {'(', 'I', 1},
+    {'(', '|', 1},
+    {')', '#', -1},
+    {')', 'f', -1},
+    {')', 't', -1},
+    {')', 'z', -1},
+    {'*', '!', -1},
+    {'*', '#', -1},
+    {'*', '(', -1},
+    {'*', ')', -1},
+    {'*', '-', -1},
+    {'*', 'J', -1},
+    {'*', 'S', -1},
+    {'*', 'T', -1},
+    {'*', 'Z', -1},
+    {'*', '[', -1},
+    {'*', ']', -1},
+    {'*', 'b', -1},
+    {'*', 'f', -1},
+    {'*', 'g', -1},
+    {'*', 'h', -1},
+    {'*', 'i', -1},
+    {'*', 'j', -1},
+    {'*', 'k', -1},
+    {'*', 'l', -1},
+    {'*', 'm', -1},
+    {'*', 'n', -1},
+    {'*', 'o', -1},
+    {'*', 'p', -1},
+    {'*', 'r', -1},
+    {'*', 't', -1},
+    {'*', 'u', -1},
+    {'*', 'z', -1},
+    {'+', '"', 1},
+    {'+', '$', 1},
+    {'+', '%', 1},
+    {'+', '&', 1},
+    {'+', '\'', 1},
+    {'+', '*', 1},
+    {'+', '+', 1},
+    {'+', ',', 1},
+    {'+', '.', 1},
+    {'+', ':', 1},
+    {'+', ';', 1},
+    {'+', '<', 1},
+    {'+', '=', 1},
+    {'+', '>', 1},
+    {'+', '@', 1},
+    {'+', 'C', 1},
+    {'+', 'E', 1},
+    {'+', 'F', 1},
+    {'+', 'G', 1},
+    {'+', 'H', 1},
+    {'+', 'I', 1},
+    {'+', 'O', 1},
+    {'+', 'P', 1},
+    {'+', 'Q', 1},
+    {'+', 'R', 1},
+    {'+', 'U', 1},
+    {'+', 'Y', 1},
+    {'+', 'c', 1},
+    {'+', 's', 1},
+    {'+', '{', 1},
+    {'+', '|', 1},
+    {'+', '}', 1},
+    {'+', '~', 1},
+    {',', '!', -1},
+    {',', '#', -1},
+    {',', '(', -1},
+    {',', ')', -1},
+    {',', '-', -1},
+    {',', 'J', -1},
+    {',', 'S', -1},
+    {',', 'T', -1},
+    {',', 'Z', -1},
+    {',', '[', -1},
+    {',', ']', -1},
+    {',', 'b', -1},
+    {',', 'f', -1},
+    {',', 'g', -1},
+    {',', 'h', -1},
+    {',', 'i', -1},
+    {',', 'j', -1},
+    {',', 'k', -1},
+    {',', 'l', -1},
+    {',', 'm', -1},
+    {',', 'n', -1},
+    {',', 'o', -1},
+    {',', 'p', -1},
+    {',', 'r', -1},
+    {',', 't', -1},
+    {',', 'u', -1},
+    {',', 'z', -1},
+    {'-', '!', -1},
+    {'-', '#', -1},
+    {'-', '(', -1},
+    {'-', 'T', -1},
+    {'-', 'Z', -1},
+    {'-', ']', -1},
+    {'-', 'f', -1},
+    {'-', 'l', -1},
+    {'-', 't', -1},
+    {'-', 'u', -1},
+    {'-', 'z', -1},
+    {'.', '!', -1},
+    {'.', '#', -1},
+    {'.', '(', -1},
+    {'.', ')', -1},
+    {'.', '-', -1},
+    {'.', 'J', -1},
+    {'.', 'L', -1},
+    {'.', 'S', -1},
+    {'.', 'T', -1},
+    {'.', 'Z', -1},
+    {'.', '[', -1},
+    {'.', ']', -1},
+    {'.', 'b', -1},
+    {'.', 'd', -1},
+    {'.', 'f', -1},
+    {'.', 'g', -1},
+    {'.', 'h', -1},
+    {'.', 'i', -1},
+    {'.', 'j', -1},
+    {'.', 'k', -1},
+    {'.', 'l', -1},
+    {'.', 'm', -1},
+    {'.', 'n', -1},
+    {'.', 'o', -1},
+    {'.', 'p', -1},
+    {'.', 'q', -1},
+    {'.', 'r', -1},
+    {'.', 't', -1},
+    {'.', 'u', -1},
+    {'.', 'z', -1},
+    {'/', '$', 1},
+    {'/', '%', 1},
+    {'/', '+', 1},
+    {'/', ',', 1},
+    {'/', '.', 1},
+    {'/', ':', 1},
+    {'/', ';', 1},
+    {'/', '<', 1},
+    {'/', '=', 1},
+    {'/', '>', 1},
+    {'/', '@', 1},
+    {'/', 'C', 1},
+    {'/', 'F', 1},
+    {'/', 'G', 1},
+    {'/', 'I', 1},
+    {'/', 'O', 1},
+    {'/', 'Y', 1},
+    {'/', 's', 1},
+    {'/', '{', 1},
+    {'/', '|', 1},
+    {'0', '#', -1},
+    {'0', 'I', 1},
+    {'0', 'f', -1},
+    {'1', '#', -1},
+    {'1', '1', -2},
+    {'1', 'I', 1},
+    {'1', 'f', -1},
+    {'2', '#', -1},
+    {'2', 'I', 1},
+    {'2', 'f', -1},
+    {'3', '#', -1},
+    {'3', 'I', 1},
+    {'3', 'f', -1},
+    {'4', '#', -1},
+    {'4', 'I', 1},
+    {'4', 'f', -1},
+    {'5', '#', -1},
+    {'5', 'I', 1},
+    {'5', 'f', -1},
+    {'6', '#', -1},
+    {'6', 'I', 1},
+    {'6', 'f', -1},
+    {'7', '#', -1},
+    {'7', 'I', 1},
+    {'7', 'f', -1},
+    {'8', '#', -1},
+    {'8', 'I', 1},
+    {'8', 'f', -1},
+    {'9', '#', -1},
+    {'9', 'I', 1},
+    {'9', 'f', -1},
+    {':', '!', -1},
+    {':', '#', -1},
+    {':', '(', -1},
+    {':', ')', -1},
+    {':', '-', -1},
+    {':', 'J', -1},
+    {':', 'L', -1},
+    {':', 'S', -1},
+    {':', 'T', -1},
+    {':', 'Z', -1},
+    {':', '[', -1},
+    {':', ']', -1},
+    {':', 'b', -1},
+    {':', 'd', -1},
+    {':', 'f', -1},
+    {':', 'g', -1},
+    {':', 'h', -1},
+    {':', 'i', -1},
+    {':', 'j', -1},
+    {':', 'k', -1},
+    {':', 'l', -1},
+    {':', 'm', -1},
+    {':', 'n', -1},
+    {':', 'o', -1},
+    {':', 'p', -1},
+    {':', 'q', -1},
+    {':', 'r', -1},
+    {':', 't', -1},
+    {':', 'u', -1},
+    {':', 'z', -1},
+    {';', '!', -1},
+    {';', '#', -1},
+    {';', '(', -1},
+    {';', ')', -1},
+    {';', '-', -1},
+    {';', 'J', -1},
+    {';', 'S', -1},
+    {';', 'T', -1},
+    {';', 'Z', -1},
+    {';', '[', -1},
+    {';', ']', -1},
+    {';', 'b', -1},
+    {';', 'f', -1},
+    {';', 'g', -1},
+    {';', 'h', -1},
+    {';', 'i', -1},
+    {';', 'j', -1},
+    {';', 'k', -1},
+    {';', 'l', -1},
+    {';', 'm', -1},
+    {';', 'n', -1},
+    {';', 'o', -1},
+    {';', 'p', -1},
+    {';', 'r', -1},
+    {';', 't', -1},
+    {';', 'u', -1},
+    {';', 'z', -1},
+    {'<', '#', -1},
+    {'<', 'f', -1},
+    {'=', '"', 1},
+    {'=', '$', 1},
+    {'=', '%', 1},
+    {'=', '&', 1},
+    {'=', '\'', 1},
+    {'=', '*', 1},
+    {'=', '+', 1},
+    {'=', ',', 1},
+    {'=', '.', 1},
+    {'=', ':', 1},
+    {'=', ';', 1},
+    {'=', '<', 1},
+    {'=', '=', 1},
+    {'=', '>', 1},
+    {'=', '@', 1},
+    {'=', 'C', 1},
+    {'=', 'E', 1},
+    {'=', 'F', 1},
+    {'=', 'G', 1},
+    {'=', 'H', 1},
+    {'=', 'I', 1},
+    {'=', 'O', 1},
+    {'=', 'P', 1},
+    {'=', 'Q', 1},
+    {'=', 'R', 1},
+    {'=', 'U', 1},
+    {'=', 'Y', 1},
+    {'=', 'c', 1},
+    {'=', 's', 1},
+    {'=', '{', 1},
+    {'=', '|', 1},
+    {'=', '}', 1},
+    {'=', '~', 1},
+    {'>', '#', -1},
+    {'>', 'f', -1},
+    {'?', '!', -1},
+    {'?', '#', -1},
+    {'?', '(', -1},
+    {'?', 'J', -1},
+    {'?', 'S', -1},
+    {'?', 'T', -1},
+    {'?', 'Z', -1},
+    {'?', ']', -1},
+    {'?', 'b', -1},
+    {'?', 'f', -1},
+    {'?', 'h', -1},
+    {'?', 'i', -1},
+    {'?', 'j', -1},
+    {'?', 'k', -1},
+    {'?', 'l', -1},
+    {'?', 'm', -1},
+    {'?', 'n', -1},
+    {'?', 'p', -1},
+    {'?', 'r', -1},
+    {'?', 't', -1},
+    {'?', 'u', -1},
+    {'?', 'z', -1},
+    {'@', '!', -1},
+    {'@', '#', -1},
+    {'@', '(', -1},
+    {'@', ')', -1},
+    {'@', '-', -1},
+    {'@', 'J', -1},
+    {'@', 'L', -1},
+    {'@', 'S', -1},
+    {'@', 'T', -1},
+    {'@', 'Z', -1},
+    {'@', '[', -1},
+    {'@', ']', -1},
+    {'@', 'b', -1},
+    {'@', 'd', -1},
+    {'@', 'f', -1},
+    {'@', 'g', -1},
+    {'@', 'h', -1},
+    {'@', 'i', -1},
+    {'@', 'j', -1},
+    {'@', 'k', -1},
+    {'@', 'l', -1},
+    {'@', 'm', -1},
+    {'@', 'n', -1},
+    {'@', 'o', -1},
+    {'@', 'p', -1},
+    {'@', 'q', -1},
+    {'@', 'r', -1},
+    {'@', 't', -1},
+    {'@', 'u', -1},
+    {'@', 'z', -1},
+    {'A', ' ', -2},
+    {'A', '!', -1},
+    {'A', '#', -1},
+    {'A', '(', -1},
+    {'A', ')', -1},
+    {'A', '-', -1},
+    {'A', 'B', -1},
+    {'A', 'D', -1},
+    {'A', 'J', -1},
+    {'A', 'K', -1},
+    {'A', 'L', -1},
+    {'A', 'M', -1},
+    {'A', 'N', -1},
+    {'A', 'S', -1},
+    {'A', 'T', -3},
+    {'A', 'V', -2},
+    {'A', 'W', -1},
+    {'A', 'Y', -2},
+    {'A', 'Z', -1},
+    {'A', '[', -1},
+    {'A', ']', -1},
+    {'A', '_', -1},
+    {'A', 'a', -1},
+    {'A', 'b', -1},
+    {'A', 'd', -1},
+    {'A', 'e', -1},
+    {'A', 'f', -1},
+    {'A', 'g', -1},
+    {'A', 'h', -1},
+    {'A', 'i', -1},
+    {'A', 'j', -1},
+    {'A', 'k', -1},
+    {'A', 'l', -1},
+    {'A', 'm', -1},
+    {'A', 'n', -1},
+    {'A', 'o', -1},
+    {'A', 'p', -1},
+    {'A', 'q', -1},
+    {'A', 'r', -1},
+    {'A', 't', -1},
+    {'A', 'u', -1},
+    {'A', 'v', -1},
+    {'A', 'w', -1},
+    {'A', 'y', -1},
+    {'A', 'z', -1},
+    {'B', '"', 1},
+    {'B', '$', 1},
+    {'B', '%', 1},
+    {'B', '&', 1},
+    {'B', '+', 1},
+    {'B', ',', 1},
+    {'B', '.', 1},
+    {'B', ':', 1},
+    {'B', ';', 1},
+    {'B', '<', 1},
+    {'B', '=', 1},
+    {'B', '>', 1},
+    {'B', '@', 1},
+    {'B', 'C', 1},
+    {'B', 'F', 1},
+    {'B', 'G', 1},
+    {'B', 'I', 1},
+    {'B', 'O', 1},
+    {'B', 'Q', 1},
+    {'B', 'Y', 1},
+    {'B', 's', 1},
+    {'B', '{', 1},
+    {'B', '|', 1},
+    {'B', '~', 1},
+    {'C', '"', 1},
+    {'C', '$', 1},
+    {'C', '%', 1},
+    {'C', '&', 1},
+    {'C', '\'', 1},
+    {'C', '*', 1},
+    {'C', '+', 1},
+    {'C', ',', 1},
+    {'C', '.', 1},
+    {'C', ':', 1},
+    {'C', ';', 1},
+    {'C', '<', 1},
+    {'C', '=', 1},
+    {'C', '>', 1},
+    {'C', '@', 1},
+    {'C', 'C', 1},
+    {'C', 'E', 1},
+    {'C', 'F', 1},
+    {'C', 'G', 1},
+    {'C', 'H', 1},
+    {'C', 'I', 1},
+    {'C', 'O', 1},
+    {'C', 'P', 1},
+    {'C', 'Q', 1},
+    {'C', 'R', 1},
+    {'C', 'U', 1},
+    {'C', 'Y', 1},
+    {'C', 'c', 1},
+    {'C', 's', 1},
+    {'C', '{', 1},
+    {'C', '|', 1},
+    {'C', '}', 1},
+    {'C', '~', 1},
+    {'D', '!', -1},
+    {'D', '#', -1},
+    {'D', '(', -1},
+    {'D', 'T', -1},
+    {'D', 'Z', -1},
+    {'D', ']', -1},
+    {'D', 'b', -1},
+    {'D', 'f', -1},
+    {'D', 'h', -1},
+    {'D', 'i', -1},
+    {'D', 'j', -1},
+    {'D', 'l', -1},
+    {'D', 'n', -1},
+    {'D', 'p', -1},
+    {'D', 'r', -1},
+    {'D', 't', -1},
+    {'D', 'u', -1},
+    {'D', 'z', -1},
+    {'E', '"', 1},
+    {'E', '$', 1},
+    {'E', '%', 1},
+    {'E', '&', 1},
+    {'E', '\'', 1},
+    {'E', '+', 1},
+    {'E', ',', 1},
+    {'E', '.', 1},
+    {'E', ':', 1},
+    {'E', ';', 1},
+    {'E', '<', 1},
+    {'E', '=', 1},
+    {'E', '>', 1},
+    {'E', '@', 1},
+    {'E', 'C', 1},
+    {'E', 'F', 1},
+    {'E', 'G', 1},
+    {'E', 'I', 1},
+    {'E', 'O', 1},
+    {'E', 'Q', 1},
+    {'E', 'Y', 1},
+    {'E', 's', 1},
+    {'E', '{', 1},
+    {'E', '|', 1},
+    {'E', '~', 1},
+    {'F', '!', -1},
+    {'F', '#', -1},
+    {'F', '(', -1},
+    {'F', ')', -1},
+    {'F', ',', -3},
+    {'F', '-', -1},
+    {'F', '.', -3},
+    {'F', 'A', -2},
+    {'F', 'J', -1},
+    {'F', 'S', -1},
+    {'F', 'T', -1},
+    {'F', 'Z', -1},
+    {'F', '[', -1},
+    {'F', ']', -1},
+    {'F', 'b', -1},
+    {'F', 'f', -1},
+    {'F', 'g', -1},
+    {'F', 'h', -1},
+    {'F', 'i', -1},
+    {'F', 'j', -1},
+    {'F', 'k', -1},
+    {'F', 'l', -1},
+    {'F', 'm', -1},
+    {'F', 'n', -1},
+    {'F', 'o', -1},
+    {'F', 'p', -1},
+    {'F', 'r', -1},
+    {'F', 't', -1},
+    {'F', 'u', -1},
+    {'F', 'z', -1},
+    {'G', '#', -1},
+    {'G', 'f', -1},
+    {'G', 't', -1},
+    {'G', 'z', -1},
+    {'H', '!', -1},
+    {'H', '#', -1},
+    {'H', '(', -1},
+    {'H', ')', -1},
+    {'H', '-', -1},
+    {'H', 'B', -1},
+    {'H', 'J', -1},
+    {'H', 'K', -1},
+    {'H', 'L', -1},
+    {'H', 'S', -1},
+    {'H', 'T', -1},
+    {'H', 'Z', -1},
+    {'H', '[', -1},
+    {'H', ']', -1},
+    {'H', '_', -1},
+    {'H', 'a', -1},
+    {'H', 'b', -1},
+    {'H', 'd', -1},
+    {'H', 'e', -1},
+    {'H', 'f', -1},
+    {'H', 'g', -1},
+    {'H', 'h', -1},
+    {'H', 'i', -1},
+    {'H', 'j', -1},
+    {'H', 'k', -1},
+    {'H', 'l', -1},
+    {'H', 'm', -1},
+    {'H', 'n', -1},
+    {'H', 'o', -1},
+    {'H', 'p', -1},
+    {'H', 'q', -1},
+    {'H', 'r', -1},
+    {'H', 't', -1},
+    {'H', 'u', -1},
+    {'H', 'z', -1},
+    {'I', '!', -1},
+    {'I', '#', -1},
+    {'I', '(', -1},
+    {'I', ')', -1},
+    {'I', 'J', -1},
+    {'I', 'S', -1},
+    {'I', 'T', -1},
+    {'I', 'Z', -1},
+    {'I', ']', -1},
+    {'I', 'b', -1},
+    {'I', 'f', -1},
+    {'I', 'g', -1},
+    {'I', 'h', -1},
+    {'I', 'i', -1},
+    {'I', 'j', -1},
+    {'I', 'k', -1},
+    {'I', 'l', -1},
+    {'I', 'm', -1},
+    {'I', 'n', -1},
+    {'I', 'p', -1},
+    {'I', 'r', -1},
+    {'I', 't', -1},
+    {'I', 'u', -1},
+    {'I', 'z', -1},
+    {'J', '"', 1},
+    {'J', '$', 1},
+    {'J', '%', 1},
+    {'J', '&', 1},
+    {'J', '\'', 1},
+    {'J', '*', 1},
+    {'J', '+', 1},
+    {'J', ',', 1},
+    {'J', '.', 1},
+    {'J', ':', 1},
+    {'J', ';', 1},
+    {'J', '<', 1},
+    {'J', '=', 1},
+    {'J', '>', 1},
+    {'J', '@', 1},
+    {'J', 'C', 1},
+    {'J', 'E', 1},
+    {'J', 'F', 1},
+    {'J', 'G', 1},
+    {'J', 'I', 1},
+    {'J', 'O', 1},
+    {'J', 'Q', 1},
+    {'J', 'Y', 1},
+    {'J', 's', 1},
+    {'J', '{', 1},
+    {'J', '|', 1},
+    {'J', '}', 1},
+    {'J', '~', 1},
+    {'K', '"', 1},
+    {'K', '$', 1},
+    {'K', '%', 1},
+    {'K', '&', 1},
+    {'K', '\'', 1},
+    {'K', '*', 1},
+    {'K', '+', 1},
+    {'K', ',', 1},
+    {'K', '.', 1},
+    {'K', ':', 1},
+    {'K', ';', 1},
+    {'K', '<', 1},
+    {'K', '=', 1},
+    {'K', '>', 1},
+    {'K', '@', 1},
+    {'K', 'C', 1},
+    {'K', 'E', 1},
+    {'K', 'F', 1},
+    {'K', 'G', 1},
+    {'K', 'I', 1},
+    {'K', 'O', 1},
+    {'K', 'Q', 1},
+    {'K', 'Y', 1},
+    {'K', 's', 1},
+    {'K', '{', 1},
+    {'K', '|', 1},
+    {'K', '}', 1},
+    {'K', '~', 1},
+    {'L', '"', 1},
+    {'L', '$', 1},
+    {'L', '%', 1},
+    {'L', '&', 1},
+    {'L', '\'', 1},
+    {'L', '*', 1},
+    {'L', '+', 1},
+    {'L', ',', 1},
+    {'L', '.', 1},
+    {'L', ':', 1},
+    {'L', ';', 1},
+    {'L', '<', 1},
+    {'L', '=', 1},
+    {'L', '>', 1},
+    {'L', '@', 1},
+    {'L', 'C', 1},
+    {'L', 'E', 1},
+    {'L', 'F', 1},
+    {'L', 'G', 1},
+    {'L', 'H', 1},
+    {'L', 'I', 1},
+    {'L', 'O', 1},
+    {'L', 'P', 1},
+    {'L', 'Q', 1},
+    {'L', 'R', 1},
+    {'L', 'T', -2},
+    {'L', 'U', 1},
+    {'L', 'V', -1},
+    {'L', 'W', -1},
+    {'L', 'Y', -1},
+    {'L', 'c', 1},
+    {'L', 's', 1},
+    {'L', '{', 1},
+    {'L', '|', 1},
+    {'L', '}', 1},
+    {'L', '~', 1},
+    {'M', '#', -1},
+    {'M', 'f', -1},
+    {'N', '$', 1},
+    {'N', '%', 1},
+    {'N', '+', 1},
+    {'N', ',', 1},
+    {'N', '.', 1},
+    {'N', ':', 1},
+    {'N', ';', 1},
+    {'N', '<', 1},
+    {'N', '=', 1},
+    {'N', '>', 1},
+    {'N', '@', 1},
+    {'N', 'G', 1},
+    {'N', 'I', 1},
+    {'N', 'O', 1},
+    {'N', 'Y', 1},
+    {'N', '|', 1},
+    {'O', '#', -1},
+    {'O', '$', 1},
+    {'O', '%', 1},
+    {'O', '+', 1},
+    {'O', ',', 1},
+    {'O', '.', 1},
+    {'O', ':', 1},
+    {'O', ';', 1},
+    {'O', '<', 1},
+    {'O', '=', 1},
+    {'O', '>', 1},
+    {'O', '@', 1},
+    {'O', 'G', 1},
+    {'O', 'I', 1},
+    {'O', '|', 1},
+    {'P', ' ', -1},
+    {'P', '!', -1},
+    {'P', '#', -1},
+    {'P', '(', -1},
+    {'P', ')', -1},
+    {'P', ',', -3},
+    {'P', '-', -1},
+    {'P', '.', -3},
+    {'P', 'A', -2},
+    {'P', 'B', -1},
+    {'P', 'D', -1},
+    {'P', 'J', -1},
+    {'P', 'K', -1},
+    {'P', 'L', -1},
+    {'P', 'M', -1},
+    {'P', 'N', -1},
+    {'P', 'S', -1},
+    {'P', 'T', -1},
+    {'P', 'Z', -1},
+    {'P', '[', -1},
+    {'P', ']', -1},
+    {'P', '_', -1},
+    {'P', 'a', -1},
+    {'P', 'b', -1},
+    {'P', 'd', -1},
+    {'P', 'e', -1},
+    {'P', 'f', -1},
+    {'P', 'g', -1},
+    {'P', 'h', -1},
+    {'P', 'i', -1},
+    {'P', 'j', -1},
+    {'P', 'k', -1},
+    {'P', 'l', -1},
+    {'P', 'm', -1},
+    {'P', 'n', -1},
+    {'P', 'o', -1},
+    {'P', 'p', -1},
+    {'P', 'q', -1},
+    {'P', 'r', -1},
+    {'P', 't', -1},
+    {'P', 'u', -1},
+    {'P', 'z', -1},
+    {'Q', '$', 1},
+    {'Q', '%', 1},
+    {'Q', '+', 1},
+    {'Q', ',', 1},
+    {'Q', '.', 1},
+    {'Q', ':', 1},
+    {'Q', ';', 1},
+    {'Q', '<', 1},
+    {'Q', '=', 1},
+    {'Q', '>', 1},
+    {'Q', '@', 1},
+    {'Q', 'C', 1},
+    {'Q', 'G', 1},
+    {'Q', 'I', 1},
+    {'Q', 'O', 1},
+    {'Q', 'Y', 1},
+    {'Q', '|', 1},
+    {'R', '#', -1},
+    {'R', '(', -1},
+    {'R', 'T', -1},
+    {'R', 'V', -1},
+    {'R', 'W', -1},
+    {'R', 'Z', -1},
+    {'R', ']', -1},
+    {'R', 'f', -1},
+    {'R', 't', -1},
+    {'R', 'z', -1},
+    {'S', '!', -1},
+    {'S', '#', -1},
+    {'S', '(', -1},
+    {'S', 'J', -1},
+    {'S', 'S', -1},
+    {'S', 'T', -1},
+    {'S', 'Z', -1},
+    {'S', ']', -1},
+    {'S', 'b', -1},
+    {'S', 'f', -1},
+    {'S', 'h', -1},
+    {'S', 'i', -1},
+    {'S', 'j', -1},
+    {'S', 'k', -1},
+    {'S', 'l', -1},
+    {'S', 'm', -1},
+    {'S', 'n', -1},
+    {'S', 'p', -1},
+    {'S', 'r', -1},
+    {'S', 't', -1},
+    {'S', 'u', -1},
+    {'S', 'z', -1},
+    {'T', ' ', -1},
+    {'T', '!', -1},
+    {'T', '#', -1},
+    {'T', '(', -1},
+    {'T', ')', -1},
+    {'T', ',', -3},
+    {'T', '-', -2},
+    {'T', '.', -3},
+    {'T', '/', -1},
+    {'T', '0', -1},
+    {'T', '1', -1},
+    {'T', '2', -1},
+    {'T', '3', -1},
+    {'T', '4', -1},
+    {'T', '5', -1},
+    {'T', '6', -1},
+    {'T', '7', -1},
+    {'T', '8', -1},
+    {'T', '9', -1},
+    {'T', ':', -3},
+    {'T', ';', -3},
+    {'T', '?', -1},
+    {'T', 'A', -2},
+    {'T', 'B', -1},
+    {'T', 'D', -1},
+    {'T', 'J', -1},
+    {'T', 'K', -1},
+    {'T', 'L', -1},
+    {'T', 'M', -1},
+    {'T', 'N', -1},
+    {'T', 'O', -1},
+    {'T', 'S', -1},
+    {'T', 'T', -1},
+    {'T', 'V', -1},
+    {'T', 'W', -1},
+    {'T', 'X', -1},
+    {'T', 'Z', -1},
+    {'T', '[', -1},
+    {'T', '\\', -1},
+    {'T', ']', -1},
+    {'T', '^', -1},
+    {'T', '_', -1},
+    {'T', '`', -1},
+    {'T', 'a', -4},
+    {'T', 'b', -1},
+    {'T', 'c', -3},
+    {'T', 'd', -1},
+    {'T', 'e', -4},
+    {'T', 'f', -1},
+    {'T', 'g', -1},
+    {'T', 'h', -1},
+    {'T', 'i', -1},
+    {'T', 'j', -1},
+    {'T', 'k', -1},
+    {'T', 'l', -1},
+    {'T', 'm', -1},
+    {'T', 'n', -1},
+    {'T', 'o', -4},
+    {'T', 'p', -1},
+    {'T', 'q', -1},
+    {'T', 'r', -2},
+    {'T', 's', -3},
+    {'T', 't', -1},
+    {'T', 'u', -2},
+    {'T', 'v', -1},
+    {'T', 'w', -2},
+    {'T', 'x', -1},
+    {'T', 'y', -2},
+    {'T', 'z', -1},
+    {'U', '$', 1},
+    {'U', '%', 1},
+    {'U', '+', 1},
+    {'U', ',', 1},
+    {'U', '.', 1},
+    {'U', ':', 1},
+    {'U', ';', 1},
+    {'U', '<', 1},
+    {'U', '=', 1},
+    {'U', '>', 1},
+    {'U', '@', 1},
+    {'U', 'G', 1},
+    {'U', 'I', 1},
+    {'U', '|', 1},
+    {'V', '!', -1},
+    {'V', '#', -1},
+    {'V', '(', -1},
+    {'V', ')', -1},
+    {'V', ',', -3},
+    {'V', '-', -2},
+    {'V', '.', -2},
+    {'V', ':', -1},
+    {'V', ';', -1},
+    {'V', 'A', -2},
+    {'V', 'B', -1},
+    {'V', 'D', -1},
+    {'V', 'J', -1},
+    {'V', 'K', -1},
+    {'V', 'L', -1},
+    {'V', 'M', -1},
+    {'V', 'N', -1},
+    {'V', 'S', -1},
+    {'V', 'T', -1},
+    {'V', 'Z', -1},
+    {'V', '[', -1},
+    {'V', ']', -1},
+    {'V', '_', -1},
+    {'V', 'a', -3},
+    {'V', 'b', -1},
+    {'V', 'd', -1},
+    {'V', 'e', -2},
+    {'V', 'f', -1},
+    {'V', 'g', -1},
+    {'V', 'h', -1},
+    {'V', 'i', -1},
+    {'V', 'j', -1},
+    {'V', 'k', -1},
+    {'V', 'l', -1},
+    {'V', 'm', -1},
+    {'V', 'n', -1},
+    {'V', 'o', -2},
+    {'V', 'p', -1},
+    {'V', 'q', -1},
+    {'V', 'r', -2},
+    {'V', 't', -1},
+    {'V', 'u', -2},
+    {'V', 'y', -1},
+    {'V', 'z', -1},
+    {'W', '!', -1},
+    {'W', '#', -1},
+    {'W', '(', -1},
+    {'W', ',', -1},
+    {'W', '-', -1},
+    {'W', '.', -1},
+    {'W', 'A', -1},
+    {'W', 'J', -1},
+    {'W', 'S', -1},
+    {'W', 'T', -1},
+    {'W', 'Z', -1},
+    {'W', ']', -1},
+    {'W', 'a', -1},
+    {'W', 'b', -1},
+    {'W', 'e', -1},
+    {'W', 'f', -1},
+    {'W', 'h', -1},
+    {'W', 'i', -1},
+    {'W', 'j', -1},
+    {'W', 'l', -1},
+    {'W', 'm', -1},
+    {'W', 'n', -1},
+    {'W', 'o', -1},
+    {'W', 'p', -1},
+    {'W', 'r', -1},
+    {'W', 't', -1},
+    {'W', 'u', -1},
+    {'W', 'z', -1},
+    {'X', '!', -1},
+    {'X', '#', -1},
+    {'X', '(', -1},
+    {'X', ')', -1},
+    {'X', '-', -1},
+    {'X', 'B', -1},
+    {'X', 'D', -1},
+    {'X', 'J', -1},
+    {'X', 'K', -1},
+    {'X', 'L', -1},
+    {'X', 'M', -1},
+    {'X', 'N', -1},
+    {'X', 'S', -1},
+    {'X', 'T', -1},
+    {'X', 'Z', -1},
+    {'X', '[', -1},
+    {'X', ']', -1},
+    {'X', '_', -1},
+    {'X', 'a', -1},
+    {'X', 'b', -1},
+    {'X', 'd', -1},
+    {'X', 'e', -1},
+    {'X', 'f', -1},
+    {'X', 'g', -1},
+    {'X', 'h', -1},
+    {'X', 'i', -1},
+    {'X', 'j', -1},
+    {'X', 'k', -1},
+    {'X', 'l', -1},
+    {'X', 'm', -1},
+    {'X', 'n', -1},
+    {'X', 'o', -1},
+    {'X', 'p', -1},
+    {'X', 'q', -1},
+    {'X', 'r', -1},
+    {'X', 't', -1},
+    {'X', 'u', -1},
+    {'X', 'z', -1},
+    {'Y', '#', -1},
+    {'Y', '$', 1},
+    {'Y', '%', 1},
+    {'Y', '+', 1},
+    {'Y', ',', -3},
+    {'Y', '-', -3},
+    {'Y', '.', -3},
+    {'Y', ':', -1},
+    {'Y', ';', -1},
+    {'Y', '=', 1},
+    {'Y', 'A', -2},
+    {'Y', 'G', 1},
+    {'Y', 'I', 1},
+    {'Y', 'a', -2},
+    {'Y', 'e', -2},
+    {'Y', 'f', -1},
+    {'Y', 'i', -1},
+    {'Y', 'o', -3},
+    {'Y', 'p', -2},
+    {'Y', 'q', -2},
+    {'Y', 'u', -2},
+    {'Y', 'v', -1},
+    {'Y', '|', 1},
+    {'Z', '!', -1},
+    {'Z', '#', -1},
+    {'Z', '(', -1},
+    {'Z', ')', -1},
+    {'Z', '-', -1},
+    {'Z', 'J', -1},
+    {'Z', 'S', -1},
+    {'Z', 'T', -1},
+    {'Z', 'Z', -1},
+    {'Z', '[', -1},
+    {'Z', ']', -1},
+    {'Z', 'b', -1},
+    {'Z', 'd', -1},
+    {'Z', 'f', -1},
+    {'Z', 'g', -1},
+    {'Z', 'h', -1},
+    {'Z', 'i', -1},
+    {'Z', 'j', -1},
+    {'Z', 'k', -1},
+    {'Z', 'l', -1},
+    {'Z', 'm', -1},
+    {'Z', 'n', -1},
+    {'Z', 'o', -1},
+    {'Z', 'p', -1},
+    {'Z', 'r', -1},
+    {'Z', 't', -1},
+    {'Z', 'u', -1},
+    {'Z', 'z', -1},
+    {'[', ' ', -1},
+    {'[', '!', -1},
+    {'[', '#', -1},
+    {'[', '\'', -1},
+    {'[', '(', -1},
+    {'[', ')', -1},
+    {'[', '*', -1},
+    {'[', '-', -1},
+    {'[', '/', -1},
+    {'[', '0', -1},
+    {'[', '1', -1},
+    {'[', '2', -1},
+    {'[', '3', -1},
+    {'[', '4', -1},
+    {'[', '5', -1},
+    {'[', '6', -1},
+    {'[', '7', -1},
+    {'[', '8', -1},
+    {'[', '9', -1},
+    {'[', '?', -1},
+    {'[', 'A', -1},
+    {'[', 'B', -1},
+    {'[', 'D', -1},
+    {'[', 'E', -1},
+    {'[', 'H', -1},
+    {'[', 'J', -1},
+    {'[', 'K', -1},
+    {'[', 'L', -1},
+    {'[', 'M', -1},
+    {'[', 'N', -1},
+    {'[', 'P', -1},
+    {'[', 'R', -1},
+    {'[', 'S', -1},
+    {'[', 'T', -1},
+    {'[', 'U', -1},
+    {'[', 'V', -1},
+    {'[', 'W', -1},
+    {'[', 'X', -1},
+    {'[', 'Z', -1},
+    {'[', '[', -1},
+    {'[', '\\', -1},
+    {'[', ']', -1},
+    {'[', '^', -1},
+    {'[', '_', -1},
+    {'[', '`', -1},
+    {'[', 'a', -1},
+    {'[', 'b', -1},
+    {'[', 'c', -1},
+    {'[', 'd', -1},
+    {'[', 'e', -1},
+    {'[', 'f', -1},
+    {'[', 'g', -1},
+    {'[', 'h', -1},
+    {'[', 'i', -1},
+    {'[', 'j', -1},
+    {'[', 'k', -1},
+    {'[', 'l', -1},
+    {'[', 'm', -1},
+    {'[', 'n', -1},
+    {'[', 'o', -1},
+    {'[', 'p', -1},
+    {'[', 'q', -1},
+    {'[', 'r', -1},
+    {'[', 't', -1},
+    {'[', 'u', -1},
+    {'[', 'v', -1},
+    {'[', 'w', -1},
+    {'[', 'x', -1},
+    {'[', 'y', -1},
+    {'[', 'z', -1},
+    {'[', '}', -1},
+    {'\\', '$', 1},
+    {'\\', '%', 1},
+    {'\\', '+', 1},
+    {'\\', ',', 1},
+    {'\\', '.', 1},
+    {'\\', ':', 1},
+    {'\\', ';', 1},
+    {'\\', '<', 1},
+    {'\\', '=', 1},
+    {'\\', '>', 1},
+    {'\\', '@', 1},
+    {'\\', 'C', 1},
+    {'\\', 'F', 1},
+    {'\\', 'G', 1},
+    {'\\', 'I', 1},
+    {'\\', 'O', 1},
+    {'\\', 'Y', 1},
+    {'\\', 's', 1},
+    {'\\', '{', 1},
+    {'\\', '|', 1},
+    {']', '#', -1},
+    {']', 'I', 1},
+    {']', 'f', -1},
+    {'^', '"', 1},
+    {'^', '$', 1},
+    {'^', '%', 1},
+    {'^', '+', 1},
+    {'^', ',', 1},
+    {'^', '.', 1},
+    {'^', ':', 1},
+    {'^', ';', 1},
+    {'^', '<', 1},
+    {'^', '=', 1},
+    {'^', '>', 1},
+    {'^', '@', 1},
+    {'^', 'C', 1},
+    {'^', 'F', 1},
+    {'^', 'G', 1},
+    {'^', 'I', 1},
+    {'^', 'O', 1},
+    {'^', 'Q', 1},
+    {'^', 'Y', 1},
+    {'^', 's', 1},
+    {'^', '{', 1},
+    {'^', '|', 1},
+    {'_', '#', -1},
+    {'_', 'f', -1},
+    {'`', '!', -1},
+    {'`', '#', -1},
+    {'`', '(', -1},
+    {'`', 'J', -1},
+    {'`', 'S', -1},
+    {'`', 'T', -1},
+    {'`', 'Z', -1},
+    {'`', ']', -1},
+    {'`', 'b', -1},
+    {'`', 'f', -1},
+    {'`', 'h', -1},
+    {'`', 'i', -1},
+    {'`', 'j', -1},
+    {'`', 'k', -1},
+    {'`', 'l', -1},
+    {'`', 'm', -1},
+    {'`', 'n', -1},
+    {'`', 'p', -1},
+    {'`', 'r', -1},
+    {'`', 't', -1},
+    {'`', 'u', -1},
+    {'`', 'z', -1},
+    {'a', '#', -1},
+    {'a', '(', -1},
+    {'a', 'Z', -1},
+    {'a', ']', -1},
+    {'a', 'f', -1},
+    {'a', 't', -1},
+    {'a', 'z', -1},
+    {'b', '#', -1},
+    {'b', '$', 1},
+    {'b', '%', 1},
+    {'b', '+', 1},
+    {'b', ',', 1},
+    {'b', '.', 1},
+    {'b', ':', 1},
+    {'b', ';', 1},
+    {'b', '<', 1},
+    {'b', '=', 1},
+    {'b', '>', 1},
+    {'b', '@', 1},
+    {'b', 'G', 1},
+    {'b', 'I', 1},
+    {'b', '|', 1},
+    {'c', '#', -1},
+    {'c', '$', 1},
+    {'c', '%', 1},
+    {'c', '+', 1},
+    {'c', '.', 1},
+    {'c', ':', 1},
+    {'c', '<', 1},
+    {'c', '=', 1},
+    {'c', '>', 1},
+    {'c', '@', 1},
+    {'c', 'G', 1},
+    {'c', 'I', 1},
+    {'c', '|', 1},
+    {'d', '#', -1},
+    {'d', 'Z', -1},
+    {'d', ']', -1},
+    {'d', 'f', -1},
+    {'d', 't', -1},
+    {'d', 'z', -1},
+    {'e', '!', -1},
+    {'e', '#', -1},
+    {'e', '(', -1},
+    {'e', ')', -1},
+    {'e', '-', -1},
+    {'e', 'J', -1},
+    {'e', 'S', -1},
+    {'e', 'T', -1},
+    {'e', 'Z', -1},
+    {'e', '[', -1},
+    {'e', ']', -1},
+    {'e', 'b', -1},
+    {'e', 'f', -1},
+    {'e', 'g', -1},
+    {'e', 'h', -1},
+    {'e', 'i', -1},
+    {'e', 'j', -1},
+    {'e', 'k', -1},
+    {'e', 'l', -1},
+    {'e', 'm', -1},
+    {'e', 'n', -1},
+    {'e', 'o', -1},
+    {'e', 'p', -1},
+    {'e', 'r', -1},
+    {'e', 't', -1},
+    {'e', 'u', -1},
+    {'e', 'z', -1},
+    {'f', ' ', -1},
+    {'f', '!', -1},
+    {'f', '"', -1},
+    {'f', '#', -1},
+    {'f', '&', -1},
+    {'f', '\'', -1},
+    {'f', '(', -1},
+    {'f', ')', -1},
+    {'f', '*', -1},
+    {'f', '-', -1},
+    {'f', '/', -1},
+    {'f', '0', -1},
+    {'f', '1', -1},
+    {'f', '2', -1},
+    {'f', '3', -1},
+    {'f', '4', -1},
+    {'f', '5', -1},
+    {'f', '6', -1},
+    {'f', '7', -1},
+    {'f', '8', -1},
+    {'f', '9', -1},
+    {'f', '?', -1},
+    {'f', 'A', -1},
+    {'f', 'B', -1},
+    {'f', 'C', -1},
+    {'f', 'D', -1},
+    {'f', 'E', -1},
+    {'f', 'F', -1},
+    {'f', 'H', -1},
+    {'f', 'J', -1},
+    {'f', 'K', -1},
+    {'f', 'L', -1},
+    {'f', 'M', -1},
+    {'f', 'N', -1},
+    {'f', 'O', -1},
+    {'f', 'P', -1},
+    {'f', 'Q', -1},
+    {'f', 'R', -1},
+    {'f', 'S', -1},
+    {'f', 'T', -1},
+    {'f', 'U', -1},
+    {'f', 'V', -1},
+    {'f', 'W', -1},
+    {'f', 'X', -1},
+    {'f', 'Y', -1},
+    {'f', 'Z', -1},
+    {'f', '[', -1},
+    {'f', '\\', -1},
+    {'f', ']', -1},
+    {'f', '^', -1},
+    {'f', '_', -1},
+    {'f', '`', -1},
+    {'f', 'a', -1},
+    {'f', 'b', -1},
+    {'f', 'c', -1},
+    {'f', 'd', -1},
+    {'f', 'e', -1},
+    {'f', 'f', -2},
+    {'f', 'g', -1},
+    {'f', 'h', -1},
+    {'f', 'i', -1},
+    {'f', 'j', -1},
+    {'f', 'k', -1},
+    {'f', 'l', -1},
+    {'f', 'm', -1},
+    {'f', 'n', -1},
+    {'f', 'o', -1},
+    {'f', 'p', -1},
+    {'f', 'q', -1},
+    {'f', 'r', -1},
+    {'f', 's', -1},
+    {'f', 't', -1},
+    {'f', 'u', -1},
+    {'f', 'v', -1},
+    {'f', 'w', -1},
+    {'f', 'x', -1},
+    {'f', 'y', -1},
+    {'f', 'z', -1},
+    {'f', '{', -1},
+    {'f', '}', -1},
+    {'f', '~', -1},
+    {'g', '!', -1},
+    {'g', '#', -1},
+    {'g', '(', -1},
+    {'g', 'T', -1},
+    {'g', 'Z', -1},
+    {'g', ']', -1},
+    {'g', 'b', -1},
+    {'g', 'f', -1},
+    {'g', 'j', -1},
+    {'g', 'l', -1},
+    {'g', 't', -1},
+    {'g', 'u', -1},
+    {'g', 'z', -1},
+    {'h', '!', -1},
+    {'h', '#', -1},
+    {'h', '(', -1},
+    {'h', 'T', -1},
+    {'h', 'Z', -1},
+    {'h', ']', -1},
+    {'h', 'f', -1},
+    {'h', 'l', -1},
+    {'h', 't', -1},
+    {'h', 'u', -1},
+    {'h', 'z', -1},
+    {'i', '$', 1},
+    {'i', '%', 1},
+    {'i', '+', 1},
+    {'i', ',', 1},
+    {'i', '.', 1},
+    {'i', ':', 1},
+    {'i', ';', 1},
+    {'i', '<', 1},
+    {'i', '=', 1},
+    {'i', '>', 1},
+    {'i', '@', 1},
+    {'i', 'G', 1},
+    {'i', 'I', 1},
+    {'i', 'O', 1},
+    {'i', 'Y', 1},
+    {'i', '|', 1},
+    {'j', '$', 1},
+    {'j', '%', 1},
+    {'j', '+', 1},
+    {'j', ',', 1},
+    {'j', '.', 1},
+    {'j', ':', 1},
+    {'j', ';', 1},
+    {'j', '<', 1},
+    {'j', '=', 1},
+    {'j', '>', 1},
+    {'j', '@', 1},
+    {'j', 'G', 1},
+    {'j', 'I', 1},
+    {'j', 'O', 1},
+    {'j', 'Y', 1},
+    {'j', '|', 1},
+    {'k', '"', 1},
+    {'k', '$', 1},
+    {'k', '%', 1},
+    {'k', '&', 1},
+    {'k', '\'', 1},
+    {'k', '*', 1},
+    {'k', '+', 1},
+    {'k', ',', 1},
+    {'k', '.', 1},
+    {'k', ':', 1},
+    {'k', ';', 1},
+    {'k', '<', 1},
+    {'k', '=', 1},
+    {'k', '>', 1},
+    {'k', '@', 1},
+    {'k', 'C', 1},
+    {'k', 'E', 1},
+    {'k', 'F', 1},
+    {'k', 'G', 1},
+    {'k', 'I', 1},
+    {'k', 'O', 1},
+    {'k', 'Q', 1},
+    {'k', 'Y', 1},
+    {'k', 's', 1},
+    {'k', '{', 1},
+    {'k', '|', 1},
+    {'k', '}', 1},
+    {'k', '~', 1},
+    {'l', '$', 1},
+    {'l', '%', 1},
+    {'l', '+', 1},
+    {'l', ',', 1},
+    {'l', '.', 1},
+    {'l', ':', 1},
+    {'l', ';', 1},
+    {'l', '<', 1},
+    {'l', '=', 1},
+    {'l', '>', 1},
+    {'l', '@', 1},
+    {'l', 'C', 1},
+    {'l', 'G', 1},
+    {'l', 'I', 1},
+    {'l', 'O', 1},
+    {'l', 'Y', 1},
+    {'l', '|', 1},
+    {'m', '#', -1},
+    {'m', '$', 1},
+    {'m', '%', 1},
+    {'m', '+', 1},
+    {'m', '=', 1},
+    {'m', 'G', 1},
+    {'m', 'I', 1},
+    {'m', 'f', -1},
+    {'m', '|', 1},
+    {'n', '#', -1},
+    {'n', '(', -1},
+    {'n', 'Z', -1},
+    {'n', ']', -1},
+    {'n', 'f', -1},
+    {'n', 'l', -1},
+    {'n', 't', -1},
+    {'n', 'u', -1},
+    {'n', 'z', -1},
+    {'o', '#', -1},
+    {'o', 'I', 1},
+    {'o', 'f', -1},
+    {'p', '#', -1},
+    {'p', '$', 1},
+    {'p', '%', 1},
+    {'p', '+', 1},
+    {'p', '.', 1},
+    {'p', ':', 1},
+    {'p', '<', 1},
+    {'p', '=', 1},
+    {'p', '>', 1},
+    {'p', 'G', 1},
+    {'p', 'I', 1},
+    {'p', '|', 1},
+    {'q', '#', -1},
+    {'q', 'f', -1},
+    {'q', 't', -1},
+    {'q', 'z', -1},
+    {'r', '"', 1},
+    {'r', '$', 1},
+    {'r', '%', 1},
+    {'r', '+', 1},
+    {'r', ',', -1},
+    {'r', '.', -1},
+    {'r', ':', 1},
+    {'r', ';', 1},
+    {'r', '<', 1},
+    {'r', '=', 1},
+    {'r', '>', 1},
+    {'r', '@', 1},
+    {'r', 'C', 1},
+    {'r', 'F', 1},
+    {'r', 'G', 1},
+    {'r', 'I', 1},
+    {'r', 'O', 1},
+    {'r', 'Q', 1},
+    {'r', 'Y', 1},
+    {'r', 's', 1},
+    {'r', '{', 1},
+    {'r', '|', 1},
+    {'s', '#', -1},
+    {'s', 'I', 1},
+    {'s', 'f', -1},
+    {'t', ' ', -1},
+    {'t', '!', -1},
+    {'t', '#', -1},
+    {'t', '(', -1},
+    {'t', ')', -1},
+    {'t', '-', -1},
+    {'t', '/', -1},
+    {'t', '0', -1},
+    {'t', '1', -1},
+    {'t', '2', -1},
+    {'t', '3', -1},
+    {'t', '4', -1},
+    {'t', '5', -1},
+    {'t', '6', -1},
+    {'t', '7', -1},
+    {'t', '8', -1},
+    {'t', '9', -1},
+    {'t', '?', -1},
+    {'t', 'A', -1},
+    {'t', 'B', -1},
+    {'t', 'D', -1},
+    {'t', 'H', -1},
+    {'t', 'J', -1},
+    {'t', 'K', -1},
+    {'t', 'L', -1},
+    {'t', 'M', -1},
+    {'t', 'N', -1},
+    {'t', 'R', -1},
+    {'t', 'S', -1},
+    {'t', 'T', -1},
+    {'t', 'U', -1},
+    {'t', 'V', -1},
+    {'t', 'W', -1},
+    {'t', 'X', -1},
+    {'t', 'Z', -1},
+    {'t', '[', -1},
+    {'t', '\\', -1},
+    {'t', ']', -1},
+    {'t', '^', -1},
+    {'t', '_', -1},
+    {'t', '`', -1},
+    {'t', 'a', -1},
+    {'t', 'b', -1},
+    {'t', 'c', -1},
+    {'t', 'd', -1},
+    {'t', 'e', -1},
+    {'t', 'f', -1},
+    {'t', 'g', -1},
+    {'t', 'h', -1},
+    {'t', 'i', -1},
+    {'t', 'j', -1},
+    {'t', 'k', -1},
+    {'t', 'l', -1},
+    {'t', 'm', -1},
+    {'t', 'n', -1},
+    {'t', 'o', -1},
+    {'t', 'p', -1},
+    {'t', 'q', -1},
+    {'t', 'r', -1},
+    {'t', 't', -1},
+    {'t', 'u', -1},
+    {'t', 'v', -1},
+    {'t', 'w', -1},
+    {'t', 'x', -1},
+    {'t', 'y', -1},
+    {'t', 'z', -1},
+    {'u', '#', -1},
+    {'u', 'Z', -1},
+    {'u', ']', -1},
+    {'u', 'f', -1},
+    {'u', 't', -1},
+    {'u', 'z', -1},
+    {'v', '#', -1},
+    {'v', '$', 1},
+    {'v', '%', 1},
+    {'v', '+', 1},
+    {'v', ',', -1},
+    {'v', '.', -1},
+    {'v', ':', 1},
+    {'v', ';', 1},
+    {'v', '<', 1},
+    {'v', '=', 1},
+    {'v', '>', 1},
+    {'v', '@', 1},
+    {'v', 'G', 1},
+    {'v', 'I', 1},
+    {'v', '|', 1},
+    {'w', '#', -1},
+    {'w', ',', -1},
+    {'w', '.', -1},
+    {'w', 'f', -1},
+    {'w', 't', -1},
+    {'w', 'z', -1},
+    {'x', '#', -1},
+    {'x', '$', 1},
+    {'x', '%', 1},
+    {'x', '+', 1},
+    {'x', ',', 1},
+    {'x', '.', 1},
+    {'x', ':', 1},
+    {'x', ';', 1},
+    {'x', '<', 1},
+    {'x', '=', 1},
+    {'x', '>', 1},
+    {'x', '@', 1},
+    {'x', 'G', 1},
+    {'x', 'I', 1},
+    {'x', '|', 1},
+    {'y', '#', -1},
+    {'y', '$', 1},
+    {'y', '%', 1},
+    {'y', '+', 1},
+    {'y', ',', -1},
+    {'y', '.', -1},
+    {'y', ':', 1},
+    {'y', ';', 1},
+    {'y', '<', 1},
+    {'y', '=', 1},
+    {'y', '>', 1},
+    {'y', '@', 1},
+    {'y', 'G', 1},
+    {'y', 'I', 1},
+    {'y', '|', 1},
+    {'z', '!', -1},
+    {'z', '#', -1},
+    {'z', '(', -1},
+    {'z', ')', -1},
+    {'z', '-', -1},
+    {'z', 'J', -1},
+    {'z', 'L', -1},
+    {'z', 'S', -1},
+    {'z', 'T', -1},
+    {'z', 'Z', -1},
+    {'z', '[', -1},
+    {'z', ']', -1},
+    {'z', 'a', -1},
+    {'z', 'b', -1},
+    {'z', 'd', -1},
+    {'z', 'e', -1},
+    {'z', 'f', -1},
+    {'z', 'g', -1},
+    {'z', 'h', -1},
+    {'z', 'i', -1},
+    {'z', 'j', -1},
+    {'z', 'k', -1},
+    {'z', 'l', -1},
+    {'z', 'm', -1},
+    {'z', 'n', -1},
+    {'z', 'o', -1},
+    {'z', 'p', -1},
+    {'z', 'q', -1},
+    {'z', 'r', -1},
+    {'z', 't', -1},
+    {'z', 'u', -1},
+    {'z', 'z', -1},
+    {'{', '!', -1},
+    {'{', '#', -1},
+    {'{', '(', -1},
+    {'{', ')', -1},
+    {'{', '-', -1},
+    {'{', 'J', -1},
+    {'{', 'S', -1},
+    {'{', 'T', -1},
+    {'{', 'Z', -1},
+    {'{', '[', -1},
+    {'{', ']', -1},
+    {'{', 'b', -1},
+    {'{', 'd', -1},
+    {'{', 'f', -1},
+    {'{', 'g', -1},
+    {'{', 'h', -1},
+    {'{', 'i', -1},
+    {'{', 'j', -1},
+    {'{', 'k', -1},
+    {'{', 'l', -1},
+    {'{', 'm', -1},
+    {'{', 'n', -1},
+    {'{', 'o', -1},
+    {'{', 'p', -1},
+    {'{', 'r', -1},
+    {'{', 't', -1},
+    {'{', 'u', -1},
+    {'{', 'z', -1},
+    {'|', '!', -1},
+    {'|', '#', -1},
+    {'|', '(', -1},
+    {'|', 'J', -1},
+    {'|', 'S', -1},
+    {'|', 'T', -1},
+    {'|', 'Z', -1},
+    {'|', ']', -1},
+    {'|', 'b', -1},
+    {'|', 'f', -1},
+    {'|', 'h', -1},
+    {'|', 'i', -1},
+    {'|', 'j', -1},
+    {'|', 'k', -1},
+    {'|', 'l', -1},
+    {'|', 'm', -1},
+    {'|', 'n', -1},
+    {'|', 'p', -1},
+    {'|', 'r', -1},
+    {'|', 't', -1},
+    {'|', 'u', -1},
+    {'|', 'z', -1},
+    {'}', '!', -1},
+    {'}', '#', -1},
+    {'}', '(', -1},
+    {'}', 'J', -1},
+    {'}', 'S', -1},
+    {'}', 'T', -1},
+    {'}', 'Z', -1},
+    {'}', ']', -1},
+    {'}', 'b', -1},
+    {'}', 'f', -1},
+    {'}', 'h', -1},
+    {'}', 'i', -1},
+    {'}', 'j', -1},
+    {'}', 'l', -1},
+    {'}', 'm', -1},
+    {'}', 'n', -1},
+    {'}', 'p', -1},
+    {'}', 'r', -1},
+    {'}', 't', -1},
+    {'}', 'u', -1},
+    {'}', 'z', -1},
+    {'~', '#', -1},
+    {'~', '$', 1},
+    {'~', '%', 1},
+    {'~', '+', 1},
+    {'~', '.', 1},
+    {'~', ':', 1},
+    {'~', '<', 1},
+    {'~', '=', 1},
+    {'~', '>', 1},
+    {'~', 'G', 1},
+    {'~', 'I', 1},
+    {'~', '|', 1},
+    {'1', '1', -2},
+    {':', 'S', 1},
+    {'S', '-', -1},
+    {'S', ':', -1},
+    {'S', 'o', -1},
+    {'S', 'r', -1},
+    {'c', ':', -1},
+    {'e', 'S', 1},
+    {'-', '-', 1},
+    {'-', 'F', 1},
+    {'-', 'a', 1},
+    {'-', 'e', 1},
+    {'-', 'l', 1},
+    {'-', 'o', 1},
+    {'1', '1', -3},
+    {':', 'c', -1},
+    {':', 'i', -1},
+    {':', 'n', -1},
+    {':', 'r', -1},
+    {'B', 'l', 1},
+    {'C', 'F', 1},
+    {'C', 'a', 1},
+    {'C', 'e', 1},
+    {'C', 'l', 1},
+    {'F', ':', -1},
+    {'F', 'c', -1},
+    {'F', 'i', -1},
+    {'F', 'n', -1},
+    {'F', 'r', -1},
+    {'O', ':', -1},
+    {'O', 'c', -1},
+    {'O', 'i', -1},
+    {'O', 'n', -1},
+    {'O', 'r', -1},
+    {'S', ':', -1},
+    {'S', 'B', -1},
+    {'S', 'C', -1},
+    {'S', 'S', -1},
+    {'S', 'c', -1},
+    {'S', 'i', -1},
+    {'S', 'n', -1},
+    {'S', 'r', -1},
+    {'a', '-', 1},
+    {'a', 'F', 1},
+    {'a', 'a', 1},
+    {'a', 'e', 1},
+    {'a', 'l', 1},
+    {'a', 'o', 1},
+    {'c', 'a', 1},
+    {'c', 'e', 1},
+    {'c', 'l', 1},
+    {'e', ':', -1},
+    {'e', 'c', -1},
+    {'e', 'i', -1},
+    {'e', 'n', -1},
+    {'e', 'r', -1},
+    {'i', '-', 1},
+    {'i', 'F', 1},
+    {'i', 'a', 1},
+    {'i', 'e', 1},
+    {'i', 'l', 1},
+    {'i', 'o', 1},
+    {'l', '-', 1},
+    {'l', 'F', 1},
+    {'l', 'a', 1},
+    {'l', 'e', 1},
+    {'l', 'l', 1},
+    {'l', 'o', 1},
+    {'n', '-', 1},
+    {'n', 'F', 1},
+    {'n', 'a', 1},
+    {'n', 'e', 1},
+    {'n', 'l', 1},
+    {'n', 'o', 1},
+    {'o', ':', -1},
+    {'o', 'B', -1},
+    {'o', 'C', -1},
+    {'o', 'M', -1},
+    {'o', 'S', -1},
+    {'o', 'c', -1},
+    {'o', 'i', -1},
+    {'o', 'n', -1},
+    {'o', 'r', -1},
+    {'r', ':', -1},
+    {'r', 'c', -1},
+    {'r', 'i', -1},
+    {'r', 'n', -1},
+    {'r', 'r', -1},
+    {'x', ':', -1},
+    {'x', 'c', -1},
+    {'x', 'i', -1},
+    {'x', 'n', -1},
+    {'x', 'r', -1},
+    {' ', 'A', -3},
+    {'A', ' ', -3},
+    {'A', 'G', 1},
+    {'A', 'M', 1},
+    {'A', 'V', -4},
+    {'E', 'E', -1},
+    {'E', 'R', -1},
+    {'G', 'E', -1},
+    {'G', 'R', -1},
+    {'M', 'E', -1},
+    {'M', 'R', -1},
+    {'O', 'R', -1},
+    {'R', 'E', -1},
+    {'R', 'R', -1},
+    {'R', 'V', -1},
+    {'V', 'A', -4},
+    {'V', 'G', 1},
+    {'V', 'M', 1},
+    {' ', 'A', -4},
+    {'!', '(', -1},
+    {'!', 'C', -1},
+    {'!', 'L', -1},
+    {'!', 'S', -1},
+    {'(', '!', 1},
+    {'(', ')', 1},
+    {'(', '.', 1},
+    {'(', 'E', 1},
+    {'(', 'P', 1},
+    {'(', 'R', 1},
+    {'(', 'U', 1},
+    {')', 'L', -1},
+    {')', 'S', -1},
+    {'.', '(', -1},
+    {'.', 'L', -1},
+    {'.', 'S', -1},
+    {'A', ' ', -5},
+    {'A', '(', -1},
+    {'A', 'C', -1},
+    {'A', 'L', -1},
+    {'A', 'N', -1},
+    {'A', 'O', -1},
+    {'A', 'S', -1},
+    {'A', 'W', -3},
+    {'C', '!', 1},
+    {'C', ')', 1},
+    {'C', '.', 1},
+    {'C', 'E', 1},
+    {'C', 'P', 1},
+    {'C', 'R', 1},
+    {'C', 'U', 1},
+    {'E', ')', 1},
+    {'L', ' ', -3},
+    {'L', 'W', -6},
+    {'N', '(', -1},
+    {'N', 'C', -1},
+    {'N', 'L', -1},
+    {'N', 'S', -1},
+    {'O', '!', 1},
+    {'O', ')', 1},
+    {'O', '.', 1},
+    {'O', 'E', 1},
+    {'P', ' ', -1},
+    {'P', '!', 1},
+    {'P', ')', 1},
+    {'P', '.', -9},
+    {'P', 'A', -5},
+    {'P', 'E', 1},
+    {'P', 'P', 1},
+    {'R', '(', -1},
+    {'R', 'C', -1},
+    {'R', 'L', -1},
+    {'R', 'S', -1},
+    {'R', 'W', -2},
+    {'U', '(', -1},
+    {'U', 'C', -1},
+    {'U', 'L', -1},
+    {'U', 'N', -1},
+    {'U', 'O', -1},
+    {'U', 'S', -1},
+    {'W', '!', 1},
+    {'W', ')', 1},
+    {'W', '.', -4},
+    {'W', 'A', -3},
+    {'W', 'E', 1},
+};
+
+constexpr size_t BAKED_ATLAS_RLE_SIZE = 143376;
+constexpr unsigned char BAKED_ATLAS_RLE[BAKED_ATLAS_RLE_SIZE] = {
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,135,0,2,10,84,120,130,128,
+    2,125,98,25,134,0,2,17,92,123,130,128,2,123,91,17,158,0,0,64,130,128,0,62,
+    128,0,0,47,130,128,0,80,165,0,15,3,54,108,155,192,219,239,248,252,242,231,204,171,
+    128,71,14,168,0,15,23,78,131,170,201,228,240,249,250,237,223,210,177,135,93,41,172,0,
+    15,13,74,119,161,201,221,234,248,251,242,227,199,168,121,71,11,154,0,2,62,178,229,133,
+    255,2,233,182,73,150,0,2,62,178,229,133,255,2,233,182,73,148,0,12,30,96,148,198,
+    221,238,251,241,225,200,153,103,29,147,0,2,62,178,229,147,255,10,253,247,240,234,222,200,
+    177,153,114,70,24,146,0,2,62,178,229,166,255,3,249,204,133,10,155,0,3,13,125,211,
+    249,133,255,3,252,217,142,23,155,0,2,62,178,229,133,255,2,233,182,73,175,0,14,9,
+    66,124,170,203,231,242,252,246,234,216,180,142,85,20,146,0,2,62,178,229,133,255,3,252,
+    221,140,22,149,0,2,62,178,229,133,255,2,233,182,73,133,0,2,62,178,229,151,255,9,
+    253,248,240,225,207,182,152,115,68,15,150,0,3,2,111,195,244,134,255,3,244,195,111,2,
+    133,0,2,52,163,221,133,255,3,254,220,158,30,144,0,2,70,187,235,135,255,2,231,180,
+    57,144,0,2,58,180,230,133,255,3,249,200,136,12,149,0,13,13,67,123,177,205,223,241,
+    252,242,226,195,155,99,31,165,0,13,31,100,146,187,220,234,248,251,242,221,192,149,98,32,
+    183,0,1,86,239,134,255,2,251,134,3,131,0,1,111,247,134,255,1,246,111,156,0,1,
+    10,228,129,255,1,253,38,128,0,1,17,243,129,255,1,244,25,161,0,3,7,81,169,240,
+    140,255,3,250,185,100,11,162,0,3,31,124,203,254,141,255,3,223,148,68,1,165,0,3,
+    24,115,190,250,140,255,3,249,190,105,20,150,0,1,123,253,138,255,0,140,148,0,1,123,
+    253,138,255,0,140,144,0,3,7,100,193,254,137,255,3,254,200,98,5,143,0,1,123,253,
+    160,255,2,210,136,48,142,0,1,123,253,171,255,1,218,29,153,0,1,22,212,139,255,1,
+    230,39,153,0,1,123,253,138,255,0,140,171,0,3,1,75,169,244,139,255,3,254,196,99,
+    12,142,0,1,123,253,138,255,1,227,39,147,0,1,123,253,138,255,0,140,131,0,1,123,
+    253,162,255,3,253,201,122,31,146,0,1,9,195,140,255,1,195,9,131,0,1,96,248,138,
+    255,1,245,59,142,0,0,134,141,255,0,109,142,0,0,114,139,255,1,212,36,145,0,3,
+    4,78,177,251,139,255,2,205,104,11,159,0,2,25,126,213,140,255,2,212,122,24,179,0,
+    1,80,254,137,255,0,140,130,0,0,109,138,255,0,110,155,0,0,130,130,255,0,171,130,
+    0,0,141,130,255,0,160,159,0,2,24,133,235,146,255,2,239,141,21,158,0,2,56,175,
+    252,147,255,2,215,105,10,161,0,2,59,167,250,146,255,2,250,165,52,147,0,1,62,254,
+    140,255,0,78,146,0,1,62,254,140,255,0,78,141,0,2,1,91,223,143,255,1,224,95,
+    141,0,1,62,254,164,255,1,193,64,139,0,1,62,254,173,255,0,186,153,0,0,180,141,
+    255,1,210,2,151,0,1,62,254,140,255,0,78,169,0,1,91,215,145,255,2,235,114,8,
+    139,0,1,62,254,140,255,1,209,5,145,0,1,62,254,140,255,0,78,129,0,1,62,254,
+    166,255,2,253,171,33,144,0,0,145,142,255,0,143,130,0,1,36,252,140,255,1,235,16,
+    140,0,0,81,142,255,1,253,58,140,0,1,61,254,140,255,0,192,143,0,2,5,111,231,
+    144,255,2,235,111,5,155,0,2,34,165,250,144,255,2,249,156,30,176,0,1,15,234,138,
+    255,1,253,38,128,0,1,17,243,138,255,1,247,32,153,0,1,29,246,130,255,0,53,130,
+    0,1,27,250,129,255,1,254,51,156,0,2,15,136,245,150,255,2,242,124,5,154,0,1,
+    32,170,152,255,1,232,91,158,0,1,41,181,152,255,1,176,42,145,0,0,178,141,255,0,
+    197,146,0,0,178,141,255,0,197,140,0,1,24,189,147,255,1,185,30,139,0,0,178,167,
+    255,1,174,24,137,0,0,178,175,255,0,49,151,0,0,46,143,255,0,82,151,0,0,178,
+    141,255,0,197,167,0,1,43,196,149,255,1,218,54,138,0,0,178,142,255,0,107,145,0,
+    0,178,141,255,0,197,129,0,0,178,169,255,2,246,120,5,141,0,1,10,252,142,255,1,
+    252,9,129,0,0,158,142,255,0,104,140,0,0,195,143,255,0,170,140,0,0,169,142,255,
+    0,59,141,0,1,75,216,148,255,1,209,48,152,0,2,10,138,248,148,255,2,248,131,7,
+    174,0,0,141,140,255,0,118,128,0,0,88,140,255,0,171,153,0,0,167,130,255,0,191,
+    132,0,0,161,130,255,0,195,155,0,1,87,231,154,255,1,209,48,152,0,1,96,242,155,
+    255,1,188,36,154,0,2,9,144,251,154,255,2,251,135,9,143,0,0,230,141,255,1,246,
+    3,145,0,0,230,141,255,1,246,3,138,0,1,63,233,149,255,1,233,57,138,0,0,230,
+    168,255,1,236,69,136,0,0,230,175,255,0,102,151,0,0,133,143,255,0,172,151,0,0,
+    230,141,255,1,246,3,165,0,1,97,246,151,255,1,251,115,137,0,0,230,142,255,1,233,
+    13,144,0,0,230,141,255,1,246,3,128,0,0,230,171,255,1,193,16,140,0,0,58,144,
+    255,0,58,129,0,0,223,142,255,0,180,139,0,1,18,254,143,255,1,244,4,138,0,1,
+    2,242,142,255,0,107,139,0,1,8,159,151,255,1,248,96,150,0,1,47,215,152,255,1,
+    214,40,172,0,1,37,249,140,255,0,146,128,0,0,115,141,255,0,61,151,0,0,59,131,
+    255,0,73,132,0,0,44,131,255,0,86,152,0,1,14,166,157,255,1,248,95,149,0,1,
+    5,159,158,255,1,240,71,152,0,1,45,212,158,255,1,216,47,142,0,143,255,0,20,145,
+    0,143,255,0,20,137,0,1,70,246,151,255,1,247,77,137,0,170,255,1,253,92,135,0,
+    176,255,0,128,151,0,0,213,143,255,1,246,11,150,0,143,255,0,20,164,0,0,137,155,
+    255,1,140,1,135,0,144,255,0,130,144,0,143,255,0,20,128,0,173,255,1,211,28,139,
+    0,0,84,144,255,0,84,129,0,0,223,142,255,0,229,139,0,0,76,145,255,0,51,138,
+    0,0,40,143,255,0,107,138,0,1,31,205,154,255,0,130,148,0,1,94,248,154,255,1,
+    241,77,171,0,0,178,141,255,0,120,128,0,0,89,141,255,1,205,1,150,0,0,196,130,
+    255,1,214,1,133,0,0,185,130,255,1,220,3,150,0,1,38,219,160,255,0,136,147,0,
+    1,13,187,160,255,1,252,109,150,0,1,94,247,160,255,1,247,97,141,0,143,255,0,20,
+    145,0,143,255,0,20,136,0,1,67,247,153,255,1,247,62,136,0,171,255,1,252,89,134,
+    0,176,255,0,128,150,0,0,37,145,255,0,87,150,0,143,255,0,20,163,0,0,149,157,
+    255,0,135,135,0,144,255,1,244,24,143,0,143,255,0,20,128,0,174,255,1,216,16,138,
+    0,0,84,144,255,0,84,129,0,0,183,143,255,0,22,138,0,0,135,145,255,0,110,138,
+    0,0,91,143,255,0,83,137,0,1,44,235,156,255,0,131,146,0,1,116,254,156,255,1,
+    254,120,169,0,0,69,142,255,0,41,128,0,1,17,248,141,255,0,97,149,0,0,67,131,
+    255,0,101,134,0,0,72,131,255,0,94,149,0,1,60,238,162,255,1,146,1,144,0,1,
+    7,189,163,255,0,112,148,0,0,119,164,255,0,131,140,0,143,255,0,20,145,0,143,255,
+    0,20,135,0,1,32,237,155,255,1,240,36,135,0,172,255,1,252,77,133,0,176,255,0,
+    128,150,0,0,118,145,255,0,172,150,0,143,255,0,20,162,0,0,122,159,255,0,98,134,
+    0,145,255,0,152,143,0,143,255,0,20,128,0,175,255,1,186,3,137,0,0,84,144,255,
+    0,84,129,0,0,128,143,255,0,70,138,0,0,194,145,255,0,169,138,0,0,142,143,255,
+    0,26,136,0,1,33,230,158,255,0,100,144,0,0,127,160,255,0,111,167,0,1,3,212,
+    141,255,0,184,130,0,0,153,141,255,1,230,11,148,0,0,193,130,255,1,235,8,135,0,
+    0,214,130,255,1,217,3,147,0,1,61,243,164,255,0,136,144,0,0,170,164,255,1,254,
+    88,146,0,0,143,166,255,0,144,139,0,143,255,0,20,145,0,143,255,0,20,134,0,1,
+    7,204,157,255,1,204,6,134,0,173,255,1,237,26,132,0,176,255,0,128,150,0,0,198,
+    145,255,1,246,11,149,0,143,255,0,20,161,0,1,74,254,159,255,1,247,42,133,0,145,
+    255,1,251,39,142,0,143,255,0,20,128,0,176,255,0,131,137,0,0,84,144,255,0,84,
+    129,0,0,73,143,255,0,119,137,0,1,6,247,145,255,0,228,138,0,0,194,142,255,0,
+    225,136,0,1,24,220,137,255,11,198,136,82,40,23,6,13,34,59,121,190,251,136,255,1,
+    249,50,142,0,0,103,138,255,4,214,142,88,47,21,128,8,4,27,47,96,156,223,137,255,
+    1,254,93,166,0,0,92,142,255,0,64,130,0,1,36,252,141,255,0,118,147,0,0,65,
+    131,255,0,134,136,0,0,105,131,255,0,91,146,0,1,48,243,166,255,0,100,142,0,0,
+    113,166,255,1,249,55,144,0,0,131,168,255,0,138,138,0,143,255,0,20,145,0,143,255,
+    0,20,134,0,0,128,159,255,0,134,134,0,174,255,1,188,1,131,0,176,255,0,128,149,
+    0,1,24,253,146,255,0,87,149,0,143,255,0,20,160,0,1,19,231,161,255,1,206,4,
+    132,0,146,255,0,174,142,0,143,255,0,20,128,0,176,255,1,250,42,136,0,0,84,144,
+    255,0,84,129,0,0,18,143,255,0,167,137,0,0,56,147,255,0,32,136,0,1,2,242,
+    142,255,0,168,135,0,1,2,192,135,255,2,244,136,37,137,0,2,33,156,250,135,255,1,
+    216,8,140,0,1,74,252,135,255,2,248,152,46,137,0,2,1,72,176,136,255,1,251,65,
+    164,0,1,2,216,141,255,0,200,132,0,0,170,141,255,1,233,10,146,0,0,192,130,255,
+    1,252,28,136,0,1,11,240,130,255,1,214,2,144,0,1,27,228,167,255,1,249,47,140,
+    0,1,46,250,167,255,1,215,8,142,0,0,106,170,255,0,105,137,0,143,255,0,20,145,
+    0,143,255,0,20,133,0,1,33,247,159,255,1,249,34,133,0,175,255,0,105,131,0,176,
+    255,0,128,149,0,0,103,147,255,0,173,149,0,143,255,0,20,160,0,0,158,163,255,0,
+    110,132,0,136,255,0,252,136,255,0,58,141,0,143,255,0,20,128,0,177,255,0,194,136,
+    0,0,84,144,255,0,84,130,0,0,218,142,255,0,216,137,0,0,115,147,255,0,91,136,
+    0,0,40,143,255,0,110,135,0,0,116,135,255,1,165,27,141,0,1,51,223,135,255,0,
+    126,139,0,1,27,236,135,255,1,172,33,142,0,1,60,208,135,255,1,226,15,163,0,0,
+    89,142,255,0,83,132,0,0,53,142,255,0,115,145,0,0,61,131,255,0,175,138,0,0,
+    146,131,255,0,87,143,0,1,4,197,169,255,1,213,9,139,0,0,195,169,255,0,138,141,
+    0,1,72,253,170,255,1,251,64,136,0,143,255,0,20,145,0,143,255,0,20,133,0,0,
+    175,161,255,0,173,133,0,175,255,1,229,7,130,0,176,255,0,128,149,0,0,183,147,255,
+    1,246,12,148,0,143,255,0,20,159,0,1,44,253,163,255,1,239,17,131,0,136,255,0,
+    155,136,255,0,197,141,0,143,255,0,20,128,0,178,255,0,72,135,0,0,84,144,255,0,
+    84,130,0,0,163,142,255,1,253,11,136,0,0,174,147,255,0,150,136,0,0,91,143,255,
+    0,53,134,0,1,44,248,133,255,1,249,96,144,0,1,18,193,134,255,1,246,28,137,0,
+    1,2,191,134,255,1,243,95,145,0,2,3,128,254,134,255,0,162,162,0,1,2,213,141,
+    255,1,220,2,133,0,0,191,141,255,1,231,9,144,0,0,173,131,255,0,70,138,0,0,
+    42,131,255,0,197,143,0,0,135,171,255,0,130,138,0,0,86,170,255,1,253,41,139,0,
+    1,25,234,172,255,1,230,22,135,0,143,255,0,20,145,0,143,255,0,20,132,0,0,45,
+    163,255,0,53,132,0,176,255,0,109,130,0,176,255,0,128,148,0,1,14,249,148,255,0,
+    88,148,0,143,255,0,20,159,0,0,172,165,255,0,126,131,0,136,255,1,26,245,136,255,
+    0,80,140,0,143,255,0,20,128,0,178,255,0,188,135,0,0,84,144,255,0,84,130,0,
+    0,107,143,255,0,57,136,0,0,232,147,255,0,209,136,0,0,142,142,255,1,246,5,134,
+    0,0,198,133,255,1,244,60,146,0,1,15,211,134,255,0,146,137,0,0,102,134,255,1,
+    232,49,148,0,1,79,242,134,255,0,80,161,0,0,87,142,255,0,108,134,0,0,77,142,
+    255,0,111,143,0,1,27,251,130,255,1,223,1,139,0,0,198,131,255,0,48,141,0,1,
+    52,252,171,255,1,247,34,137,0,0,206,171,255,0,160,138,0,1,2,189,174,255,0,178,
+    135,0,143,255,0,20,145,0,143,255,0,20,132,0,0,165,163,255,0,166,132,0,176,255,
+    1,229,4,129,0,176,255,0,101,148,0,0,88,149,255,0,174,148,0,143,255,0,20,158,
+    0,1,29,252,165,255,1,236,7,130,0,136,255,1,0,133,136,255,1,215,3,139,0,143,
+    255,0,20,128,0,179,255,0,48,134,0,0,84,144,255,0,84,130,0,0,52,143,255,0,
+    106,135,0,0,36,148,255,1,253,15,135,0,0,194,142,255,0,194,134,0,0,76,133,255,
+    1,252,75,148,0,1,28,234,133,255,1,247,21,135,0,1,15,234,133,255,1,231,35,150,
+    0,1,59,245,133,255,1,219,4,160,0,0,211,141,255,1,238,11,134,0,1,1,217,141,
+    255,1,230,6,142,0,0,130,131,255,0,125,140,0,0,98,131,255,0,154,140,0,1,3,
+    208,173,255,0,167,136,0,0,65,172,255,1,250,30,137,0,0,109,176,255,0,89,134,0,
+    143,255,0,20,145,0,143,255,0,20,131,0,1,24,251,163,255,1,250,27,131,0,177,255,
+    0,68,129,0,176,255,0,50,148,0,0,168,149,255,1,247,12,147,0,143,255,0,20,158,
+    0,0,132,167,255,0,87,130,0,136,255,1,3,44,137,255,0,103,139,0,143,255,0,20,
+    128,0,179,255,0,137,134,0,0,84,144,255,0,84,130,0,1,5,247,142,255,0,154,135,
+    0,0,95,149,255,0,71,134,0,1,2,242,142,255,0,137,133,0,1,1,206,133,255,0,
+    113,150,0,0,93,134,255,0,118,135,0,0,139,133,255,1,242,48,152,0,1,71,250,133,
+    255,0,100,159,0,0,67,142,255,0,137,136,0,0,106,142,255,0,90,141,0,1,5,231,
+    130,255,1,254,31,140,0,1,14,246,130,255,1,245,15,139,0,0,103,174,255,1,253,40,
+    135,0,0,157,173,255,0,132,136,0,1,19,238,176,255,1,232,12,133,0,143,255,0,20,
+    145,0,143,255,0,20,131,0,0,116,165,255,0,127,131,0,177,255,0,149,129,0,175,255,
+    0,186,148,0,1,6,241,150,255,0,89,147,0,143,255,0,20,158,0,0,218,167,255,0,
+    181,130,0,136,255,0,228,138,255,1,231,11,138,0,143,255,0,20,128,0,179,255,0,215,
+    134,0,0,84,144,255,0,84,131,0,0,197,142,255,0,203,135,0,0,154,149,255,0,130,
+    134,0,0,40,143,255,0,79,133,0,0,84,133,255,1,197,1,151,0,0,188,133,255,0,
+    218,134,0,1,16,243,133,255,0,87,154,0,0,118,133,255,1,226,7,158,0,0,173,141,
+    255,1,252,30,136,0,1,12,240,141,255,0,196,141,0,0,88,131,255,0,193,142,0,0,
+    169,131,255,0,111,138,0,1,11,232,175,255,0,159,134,0,1,4,238,173,255,0,213,136,
+    0,0,150,178,255,0,131,133,0,143,255,0,20,145,0,143,255,0,20,131,0,0,211,145,
+    255,0,252,145,255,0,213,131,0,177,255,1,229,1,128,0,174,255,1,219,29,148,0,0,
+    73,151,255,0,174,147,0,143,255,0,20,157,0,0,44,147,255,0,249,146,255,1,247,10,
+    129,0,150,255,0,125,138,0,143,255,0,20,128,0,180,255,0,36,133,0,0,84,144,255,
+    0,84,131,0,0,141,142,255,1,247,4,134,0,0,213,149,255,0,189,134,0,0,91,143,
+    255,0,22,133,0,0,193,132,255,1,249,42,152,0,0,52,134,255,0,49,133,0,0,119,
+    133,255,0,160,155,0,1,2,193,133,255,0,104,157,0,1,28,251,141,255,0,174,138,0,
+    0,144,142,255,0,46,140,0,0,189,131,255,0,106,142,0,0,82,131,255,0,213,138,0,
+    0,114,176,255,1,247,18,133,0,0,54,175,255,0,38,134,0,1,37,252,178,255,1,245,
+    22,132,0,143,255,0,20,145,0,143,255,0,20,130,0,0,40,144,255,4,178,29,3,59,
+    200,144,255,0,41,130,0,178,255,0,44,128,0,171,255,3,249,205,134,10,149,0,0,153,
+    151,255,1,247,12,146,0,143,255,0,20,157,0,0,113,144,255,6,201,75,11,0,19,97,
+    227,144,255,0,74,129,0,150,255,1,242,21,137,0,143,255,0,20,128,0,180,255,0,92,
+    133,0,0,84,144,255,0,84,131,0,0,86,143,255,0,44,133,0,1,17,254,149,255,1,
+    244,4,133,0,0,142,142,255,0,221,133,0,1,32,254,132,255,0,152,154,0,0,194,133,
+    255,0,133,132,0,1,3,227,132,255,1,241,21,156,0,1,38,252,132,255,0,203,157,0,
+    0,131,142,255,0,68,138,0,0,40,142,255,0,152,139,0,1,24,253,131,255,0,27,142,
+    0,1,11,248,131,255,0,44,136,0,1,6,228,146,255,10,253,185,107,53,23,6,13,35,
+    92,176,254,146,255,0,114,133,0,0,114,144,255,11,252,184,108,57,26,12,4,20,41,94,
+    161,248,145,255,0,112,134,0,0,151,148,255,3,197,119,62,24,128,8,3,27,67,127,217,
+    148,255,0,135,132,0,143,255,0,20,145,0,143,255,0,20,130,0,0,114,143,255,1,187,
+    4,129,0,1,9,195,143,255,0,124,130,0,143,255,0,20,135,0,6,2,7,14,31,56,
+    103,207,144,255,0,90,128,0,143,255,0,20,179,0,1,1,231,152,255,0,89,146,0,143,
+    255,0,20,157,0,0,175,143,255,1,165,3,131,0,1,22,209,143,255,0,128,129,0,151,
+    255,0,147,137,0,143,255,0,20,128,0,143,255,0,20,138,0,5,2,16,33,80,142,235,
+    144,255,0,136,133,0,0,84,144,255,0,84,131,0,0,30,143,255,0,92,133,0,0,75,
+    151,255,0,51,133,0,0,193,142,255,0,163,133,0,0,126,132,255,1,252,35,154,0,0,
+    79,133,255,0,205,132,0,0,67,133,255,0,123,158,0,0,159,133,255,0,43,155,0,1,
+    5,231,141,255,1,218,1,139,0,0,191,141,255,1,244,14,138,0,0,109,131,255,0,205,
+    144,0,0,184,131,255,0,131,136,0,0,84,146,255,1,170,33,135,0,1,51,219,145,255,
+    0,203,133,0,0,161,143,255,1,205,43,136,0,1,25,185,144,255,0,160,133,0,1,19,
+    246,146,255,1,183,48,135,0,2,1,71,211,146,255,1,242,12,131,0,143,255,0,20,145,
+    0,143,255,0,20,130,0,0,188,142,255,1,240,25,131,0,1,26,240,142,255,0,192,130,
+    0,143,255,0,20,141,0,1,8,199,143,255,0,136,128,0,143,255,0,20,179,0,0,58,
+    153,255,0,175,146,0,143,255,0,20,157,0,0,230,142,255,1,215,8,133,0,1,34,246,
+    142,255,0,179,129,0,151,255,1,250,36,136,0,143,255,0,20,128,0,143,255,0,20,143,
+    0,1,15,175,143,255,0,180,133,0,0,84,144,255,0,84,132,0,0,230,142,255,0,141,
+    133,0,0,134,151,255,0,111,132,0,1,2,242,142,255,0,106,133,0,0,219,132,255,0,
+    167,155,0,1,4,237,132,255,1,253,19,131,0,0,153,132,255,1,244,14,158,0,1,33,
+    253,132,255,0,138,155,0,0,86,142,255,0,118,140,0,0,91,142,255,0,106,138,0,0,
+    196,131,255,0,128,144,0,0,107,131,255,0,218,136,0,0,179,144,255,1,248,92,138,0,
+    1,16,211,145,255,0,33,132,0,0,196,142,255,1,218,14,138,0,1,3,184,143,255,0,
+    205,133,0,0,124,145,255,1,244,94,139,0,2,4,125,254,145,255,0,96,131,0,143,255,
+    0,20,145,0,143,255,0,20,129,0,1,7,248,142,255,0,125,133,0,0,120,142,255,1,
+    247,6,129,0,143,255,0,20,142,0,1,40,252,142,255,0,181,128,0,143,255,0,20,179,
+    0,0,138,153,255,1,247,13,145,0,143,255,0,20,156,0,0,18,143,255,0,94,135,0,
+    0,150,142,255,0,214,129,0,152,255,0,170,136,0,143,255,0,20,128,0,143,255,0,20,
+    144,0,1,7,216,142,255,0,212,133,0,0,81,144,255,0,82,132,0,0,175,142,255,0,
+    189,133,0,0,193,151,255,0,170,132,0,0,40,143,255,0,48,132,0,0,42,133,255,0,
+    71,156,0,0,160,130,255,3,231,159,86,9,130,0,1,3,234,132,255,0,152,160,0,0,
+    187,132,255,1,230,1,154,0,0,176,141,255,1,252,24,140,0,1,8,241,141,255,0,196,
+    137,0,1,28,254,131,255,0,59,144,0,0,39,132,255,0,49,134,0,1,22,251,143,255,
+    1,252,74,140,0,1,29,235,144,255,0,113,132,0,0,227,142,255,0,93,140,0,1,27,
+    246,142,255,1,247,3,132,0,0,219,144,255,1,235,53,142,0,1,77,247,144,255,0,192,
+    131,0,143,255,0,20,145,0,143,255,0,20,129,0,0,56,142,255,1,250,19,133,0,1,
+    15,248,142,255,0,60,129,0,143,255,0,20,143,0,0,173,142,255,0,208,128,0,143,255,
+    0,20,179,0,0,218,154,255,0,90,145,0,143,255,0,20,156,0,0,61,142,255,1,250,
+    10,135,0,0,72,142,255,0,243,129,0,153,255,0,54,135,0,143,255,0,20,128,0,143,
+    255,0,20,145,0,0,109,142,255,0,226,133,0,0,67,144,255,0,71,132,0,0,120,142,
+    255,0,238,132,0,1,5,246,151,255,0,229,132,0,0,91,142,255,1,244,3,132,0,0,
+    102,132,255,1,237,5,156,0,5,79,252,196,123,50,1,133,0,0,54,133,255,0,53,160,
+    0,0,94,133,255,0,46,153,0,1,14,248,141,255,0,180,142,0,0,156,141,255,1,254,
+    28,136,0,0,114,131,255,1,244,5,145,0,0,230,131,255,0,136,134,0,0,113,144,255,
+    0,114,142,0,0,95,144,255,0,182,132,0,0,240,142,255,0,35,141,0,0,156,143,255,
+    0,20,131,0,0,50,144,255,1,243,51,144,0,1,77,251,143,255,1,254,33,130,0,143,
+    255,0,20,145,0,143,255,0,20,129,0,0,111,142,255,0,184,135,0,0,180,142,255,0,
+    119,129,0,143,255,0,20,143,0,0,96,142,255,0,222,128,0,143,255,0,20,178,0,0,
+    43,155,255,0,176,145,0,143,255,0,20,156,0,0,93,142,255,0,205,136,0,0,24,143,
+    255,0,4,128,0,153,255,0,192,135,0,143,255,0,20,128,0,143,255,0,20,145,0,0,
+    48,142,255,0,240,133,0,0,52,144,255,0,57,132,0,0,64,143,255,0,31,131,0,0,
+    55,153,255,0,32,131,0,0,142,142,255,0,190,133,0,0,163,132,255,0,156,157,0,1,
+    6,17,137,0,0,116,132,255,1,228,1,160,0,1,12,245,132,255,0,109,153,0,0,93,
+    142,255,0,91,142,0,0,68,142,255,0,113,136,0,0,190,131,255,0,184,146,0,0,165,
+    131,255,0,212,134,0,0,203,143,255,1,198,2,143,0,0,200,143,255,1,244,6,131,0,
+    0,251,142,255,0,26,141,0,0,79,143,255,0,34,131,0,0,137,144,255,0,84,146,0,
+    0,116,144,255,0,128,130,0,143,255,0,20,145,0,143,255,0,20,129,0,0,165,142,255,
+    0,112,135,0,0,108,142,255,0,165,129,0,143,255,0,20,143,0,0,51,142,255,0,236,
+    128,0,143,255,0,20,178,0,0,123,155,255,1,247,13,144,0,143,255,0,20,156,0,0,
+    121,142,255,0,160,136,0,0,6,143,255,0,14,128,0,154,255,0,76,134,0,143,255,0,
+    20,128,0,143,255,0,20,145,0,0,27,142,255,0,252,133,0,0,38,144,255,0,43,132,
+    0,1,12,252,142,255,0,79,131,0,0,114,153,255,0,91,131,0,0,193,142,255,0,132,
+    133,0,0,224,132,255,0,88,170,0,0,178,132,255,0,151,162,0,0,174,132,255,0,171,
+    153,0,0,180,141,255,1,249,13,142,0,1,3,236,141,255,0,199,135,0,1,9,248,131,
+    255,0,124,146,0,0,105,132,255,0,24,132,0,1,14,253,142,255,1,254,47,144,0,0,
+    85,144,255,0,32,131,0,0,249,142,255,0,57,141,0,0,14,143,255,0,48,131,0,0,
+    220,143,255,0,163,147,0,1,2,192,143,255,0,211,130,0,143,255,0,20,145,0,143,255,
+    0,20,129,0,0,209,142,255,0,55,135,0,0,51,142,255,0,209,129,0,143,255,0,20,
+    143,0,0,29,142,255,0,250,128,0,143,255,0,20,178,0,0,204,156,255,0,91,144,0,
+    143,255,0,20,156,0,0,141,142,255,0,142,136,0,0,16,143,255,0,15,128,0,154,255,
+    1,212,3,133,0,143,255,0,20,128,0,143,255,0,20,145,0,0,43,142,255,0,247,133,
+    0,0,23,144,255,0,30,133,0,0,209,142,255,0,128,131,0,0,173,153,255,0,150,130,
+    0,1,2,242,142,255,0,75,132,0,0,26,133,255,0,34,170,0,0,235,132,255,0,87,
+    162,0,0,112,132,255,0,233,152,0,1,16,249,141,255,0,184,144,0,0,164,142,255,0,
+    31,134,0,0,69,132,255,0,69,146,0,0,52,132,255,0,90,132,0,0,74,143,255,0,
+    177,145,0,1,3,224,143,255,0,41,131,0,0,235,142,255,0,165,142,0,0,231,142,255,
+    0,56,130,0,0,29,143,255,1,247,28,148,0,0,52,143,255,1,254,20,129,0,143,255,
+    0,20,145,0,143,255,0,20,128,0,1,2,246,141,255,1,253,7,135,0,1,6,252,141,
+    255,1,248,3,128,0,143,255,0,20,143,0,0,25,142,255,0,250,128,0,143,255,0,20,
+    177,0,0,28,157,255,0,176,144,0,143,255,0,20,156,0,0,119,142,255,0,126,136,0,
+    0,43,143,255,0,7,128,0,155,255,0,98,133,0,143,255,0,20,128,0,143,255,0,20,
+    145,0,0,76,142,255,0,238,133,0,0,8,144,255,0,16,133,0,0,154,142,255,0,176,
+    131,0,0,231,153,255,0,209,130,0,0,40,143,255,0,18,132,0,0,64,132,255,0,235,
+    170,0,0,23,133,255,0,31,162,0,0,49,133,255,0,33,151,0,0,94,142,255,0,107,
+    144,0,0,87,142,255,0,114,134,0,0,137,131,255,1,254,16,146,0,1,5,248,131,255,
+    0,157,132,0,0,136,143,255,0,59,146,0,0,139,142,255,1,239,7,131,0,0,221,143,
+    255,1,165,27,140,0,0,191,142,255,0,18,130,0,0,91,143,255,0,149,150,0,0,179,
+    143,255,0,82,129,0,143,255,0,20,145,0,143,255,0,20,128,0,0,33,142,255,0,221,
+    137,0,0,218,142,255,0,37,128,0,143,255,0,20,143,0,0,41,142,255,0,241,128,0,
+    143,255,0,20,177,0,0,108,157,255,1,248,14,143,0,143,255,0,20,156,0,0,69,142,
+    255,0,83,136,0,0,101,142,255,0,246,129,0,155,255,1,228,9,132,0,143,255,0,20,
+    128,0,143,255,0,20,145,0,0,161,142,255,0,218,134,0,0,249,143,255,0,3,133,0,
+    0,98,142,255,0,225,130,0,0,35,154,255,1,253,15,129,0,0,91,142,255,0,216,133,
+    0,0,98,132,255,0,184,170,0,0,64,132,255,0,232,163,0,1,2,240,132,255,0,69,
+    151,0,0,165,142,255,0,34,144,0,1,17,253,141,255,0,184,134,0,0,204,131,255,0,
+    217,148,0,0,200,131,255,0,225,132,0,0,197,142,255,0,222,147,0,0,57,142,255,0,
+    146,132,0,0,188,144,255,3,249,164,65,1,137,0,0,124,141,255,0,203,131,0,0,153,
+    143,255,0,44,150,0,0,80,143,255,0,145,129,0,143,255,0,20,145,0,143,255,0,20,
+    128,0,0,69,142,255,0,183,137,0,0,180,142,255,0,67,128,0,143,255,0,20,143,0,
+    0,63,142,255,0,231,128,0,143,255,0,20,177,0,0,189,158,255,0,92,143,0,143,255,
+    0,20,157,0,0,194,140,255,1,254,27,136,0,0,172,142,255,0,221,129,0,156,255,0,
+    120,132,0,143,255,0,20,128,0,143,255,0,20,144,0,1,51,248,142,255,0,191,134,0,
+    0,234,142,255,0,244,134,0,0,43,143,255,0,18,129,0,0,94,155,255,0,71,129,0,
+    0,142,142,255,0,159,133,0,0,131,132,255,0,150,170,0,0,106,132,255,0,190,164,0,
+    0,193,132,255,0,103,151,0,0,231,141,255,0,225,146,0,0,205,141,255,1,245,6,132,
+    0,1,16,253,131,255,0,170,148,0,0,155,132,255,0,34,130,0,1,6,249,142,255,0,
+    138,147,0,1,1,224,140,255,1,198,9,132,0,0,145,147,255,3,229,147,69,6,134,0,
+    1,39,249,139,255,1,253,55,131,0,0,210,142,255,0,208,151,0,1,6,237,142,255,0,
+    209,129,0,143,255,0,20,145,0,143,255,0,20,128,0,0,97,142,255,0,154,137,0,0,
+    153,142,255,0,96,128,0,143,255,0,20,143,0,0,118,142,255,0,206,128,0,143,255,0,
+    20,176,0,1,17,251,158,255,0,177,143,0,143,255,0,20,157,0,1,28,207,139,255,0,
+    139,136,0,1,20,249,142,255,0,187,129,0,156,255,1,240,19,131,0,143,255,0,20,128,
+    0,143,255,0,20,143,0,1,57,228,143,255,0,155,134,0,0,219,142,255,0,230,134,0,
+    1,2,241,142,255,0,66,129,0,0,153,155,255,0,130,129,0,0,193,142,255,0,101,133,
+    0,0,165,132,255,0,120,170,0,0,140,132,255,0,153,164,0,0,158,132,255,0,138,150,
+    0,0,44,142,255,0,160,146,0,0,140,142,255,0,63,132,0,0,66,132,255,0,125,148,
+    0,0,110,132,255,0,86,130,0,0,38,143,255,0,60,148,0,0,107,138,255,2,238,123,
+    12,133,0,0,99,150,255,3,243,178,107,36,132,0,0,101,138,255,1,235,69,131,0,1,
+    4,249,142,255,0,131,152,0,0,152,142,255,1,254,9,128,0,143,255,0,20,145,0,143,
+    255,0,20,128,0,0,124,142,255,0,127,137,0,0,126,142,255,0,125,128,0,143,255,0,
+    20,143,0,0,195,142,255,0,179,128,0,169,255,3,249,204,133,10,147,0,0,93,159,255,
+    1,248,14,142,0,143,255,0,20,158,0,3,11,105,187,236,135,255,1,170,5,136,0,0,
+    123,143,255,0,144,129,0,157,255,0,143,131,0,143,255,0,20,128,0,143,255,0,20,137,
+    0,6,5,12,31,58,103,177,254,144,255,0,108,134,0,0,205,142,255,0,216,135,0,0,
+    188,142,255,0,115,129,0,0,212,155,255,0,190,128,0,1,1,242,142,255,0,44,133,0,
+    0,196,132,255,0,91,170,0,0,164,132,255,0,117,164,0,0,123,132,255,0,172,150,0,
+    0,111,142,255,0,97,146,0,0,78,142,255,0,130,132,0,0,114,132,255,0,80,148,0,
+    0,65,132,255,0,134,130,0,0,73,142,255,1,251,9,148,0,1,7,185,134,255,3,212,
+    139,65,5,135,0,0,29,154,255,3,219,145,68,5,129,0,1,75,212,130,255,6,238,214,
+    190,166,139,79,12,132,0,0,39,143,255,0,62,152,0,0,83,143,255,0,43,128,0,143,
+    255,0,20,145,0,143,255,0,20,128,0,0,151,142,255,0,104,137,0,0,104,142,255,0,
+    154,128,0,143,255,0,20,142,0,0,76,143,255,0,144,128,0,172,255,1,218,29,146,0,
+    0,174,160,255,0,92,142,0,143,255,0,20,162,0,8,11,44,76,108,141,172,170,147,61,
+    137,0,1,14,237,143,255,0,90,129,0,157,255,1,249,33,130,0,143,255,0,20,128,0,
+    180,255,0,52,134,0,0,190,142,255,0,202,135,0,0,132,142,255,0,163,128,0,1,16,
+    254,155,255,3,245,4,0,40,142,255,1,240,2,133,0,0,211,132,255,0,63,170,0,0,
+    187,132,255,0,93,164,0,0,88,132,255,0,200,150,0,0,179,142,255,0,42,146,0,0,
+    24,142,255,0,198,132,0,0,162,132,255,0,40,148,0,0,24,132,255,0,182,130,0,0,
+    107,142,255,0,208,150,0,2,4,134,230,128,255,3,243,176,103,29,140,0,0,210,156,255,
+    3,240,164,80,7,128,0,3,17,40,30,6,139,0,0,81,142,255,1,251,10,152,0,0,
+    22,143,255,0,78,128,0,143,255,0,20,145,0,143,255,0,20,128,0,0,174,142,255,0,
+    86,137,0,0,87,142,255,0,172,128,0,143,255,0,20,141,0,1,83,241,143,255,0,97,
+    128,0,173,255,0,186,145,0,1,8,244,160,255,0,178,142,0,143,255,0,20,182,0,0,
+    135,144,255,0,29,129,0,158,255,0,165,130,0,143,255,0,20,128,0,179,255,1,236,2,
+    134,0,0,175,142,255,0,189,135,0,0,77,142,255,0,212,128,0,0,74,157,255,2,52,
+    0,91,142,255,0,185,134,0,0,221,132,255,0,50,170,0,0,210,132,255,0,72,164,0,
+    0,63,132,255,0,211,149,0,1,2,241,141,255,1,242,2,147,0,0,227,141,255,1,251,
+    11,131,0,0,210,131,255,1,253,7,149,0,0,244,131,255,0,230,130,0,0,141,142,255,
+    0,158,152,0,3,2,38,24,3,143,0,0,121,159,255,2,239,152,53,143,0,0,119,142,
+    255,0,207,154,0,0,217,142,255,0,113,128,0,143,255,0,20,145,0,143,255,0,20,128,
+    0,0,190,142,255,0,69,137,0,0,70,142,255,0,188,128,0,143,255,0,20,135,0,5,
+    4,18,32,72,123,206,145,255,0,47,128,0,174,255,0,49,144,0,0,78,143,255,1,149,
+    254,142,255,1,248,14,141,0,143,255,0,20,181,0,1,45,250,143,255,0,212,130,0,158,
+    255,1,254,50,129,0,143,255,0,20,128,0,179,255,0,160,135,0,0,160,142,255,0,175,
+    135,0,0,22,142,255,3,252,8,0,133,157,255,2,111,0,142,142,255,0,128,134,0,0,
+    231,132,255,0,41,170,0,0,227,132,255,0,51,164,0,0,52,132,255,0,222,149,0,0,
+    39,142,255,0,191,148,0,0,173,142,255,0,58,130,0,1,7,250,131,255,0,226,150,0,
+    0,210,132,255,0,22,129,0,0,175,142,255,0,126,173,0,1,19,246,161,255,2,202,85,
+    1,140,0,0,145,142,255,0,166,154,0,0,167,142,255,0,148,128,0,143,255,0,20,145,
+    0,143,255,0,20,128,0,0,205,142,255,0,56,137,0,0,57,142,255,0,204,128,0,177,
+    255,1,235,1,128,0,174,255,0,102,144,0,0,159,143,255,1,48,200,143,255,0,93,141,
+    0,143,255,0,20,180,0,1,7,209,144,255,0,132,130,0,159,255,0,188,129,0,143,255,
+    0,20,128,0,179,255,0,66,135,0,0,145,142,255,0,161,136,0,0,222,142,255,2,53,
+    0,192,157,255,2,170,0,193,142,255,0,70,134,0,0,241,132,255,0,33,170,0,0,235,
+    132,255,0,38,164,0,0,41,132,255,0,233,149,0,0,87,142,255,0,144,148,0,0,128,
+    142,255,0,106,130,0,0,44,132,255,0,192,150,0,0,175,132,255,0,64,129,0,0,198,
+    142,255,0,97,174,0,0,150,163,255,1,199,53,139,0,0,168,142,255,0,130,154,0,0,
+    133,142,255,0,182,128,0,143,255,0,20,145,0,143,255,0,20,128,0,0,220,142,255,0,
+    47,137,0,0,48,142,255,0,220,128,0,177,255,0,168,129,0,174,255,0,128,143,0,1,
+    3,235,142,255,2,226,0,122,143,255,0,178,141,0,143,255,0,20,180,0,0,151,145,255,
+    0,39,130,0,160,255,0,71,128,0,143,255,0,20,128,0,178,255,1,215,1,135,0,0,
+    130,142,255,0,147,136,0,0,167,142,255,2,101,5,245,157,255,2,229,1,242,141,255,1,
+    254,15,134,0,0,251,132,255,0,24,170,0,0,242,132,255,0,32,164,0,0,30,132,255,
+    0,244,149,0,0,135,142,255,0,99,148,0,0,83,142,255,0,154,130,0,0,74,132,255,
+    0,164,150,0,0,147,132,255,0,93,129,0,0,209,142,255,0,69,174,0,1,21,239,163,
+    255,2,254,156,12,137,0,0,192,142,255,0,97,154,0,0,99,142,255,0,199,128,0,143,
+    255,0,20,145,0,143,255,0,20,128,0,0,233,142,255,0,37,137,0,0,39,142,255,0,
+    232,128,0,177,255,0,83,129,0,174,255,0,128,143,0,0,63,143,255,2,149,0,44,143,
+    255,1,249,15,140,0,143,255,0,20,179,0,0,94,145,255,0,195,131,0,160,255,2,208,
+    2,0,143,255,0,20,128,0,178,255,0,94,136,0,0,116,142,255,0,133,136,0,0,111,
+    142,255,1,150,54,159,255,0,72,142,255,0,212,135,0,0,251,132,255,0,22,170,0,0,
+    250,132,255,0,26,164,0,0,22,132,255,0,253,149,0,0,183,142,255,0,55,148,0,0,
+    38,142,255,0,202,130,0,0,103,132,255,0,139,150,0,0,122,132,255,0,122,129,0,0,
+    220,142,255,0,49,175,0,0,108,165,255,1,215,44,136,0,0,214,142,255,0,76,154,0,
+    0,66,142,255,0,210,128,0,143,255,0,20,145,0,143,255,0,20,128,0,0,240,142,255,
+    0,29,137,0,0,30,142,255,0,237,128,0,176,255,1,238,7,129,0,174,255,0,128,143,
+    0,0,144,143,255,0,72,128,0,0,222,143,255,0,94,140,0,143,255,0,20,178,0,1,
+    55,248,145,255,0,81,131,0,161,255,1,93,0,143,255,0,20,128,0,177,255,1,207,3,
+    136,0,0,101,142,255,0,119,136,0,0,56,142,255,1,199,113,142,255,0,253,142,255,0,
+    183,142,255,0,154,135,0,0,242,132,255,0,28,170,0,0,254,132,255,0,21,164,0,0,
+    28,132,255,0,248,149,0,0,231,142,255,0,16,148,0,1,5,252,141,255,1,246,3,129,
+    0,0,132,132,255,0,114,150,0,0,97,132,255,0,150,129,0,0,230,142,255,0,41,175,
+    0,1,1,182,165,255,1,245,84,135,0,0,227,142,255,0,56,154,0,0,51,142,255,0,
+    221,128,0,143,255,0,20,145,0,143,255,0,20,128,0,0,244,142,255,0,26,137,0,0,
+    27,142,255,0,242,128,0,176,255,0,142,130,0,174,255,0,128,143,0,0,223,142,255,1,
+    243,7,128,0,0,145,143,255,0,179,140,0,143,255,0,20,177,0,1,33,232,145,255,1,
+    214,2,131,0,161,255,1,225,7,143,255,0,20,128,0,176,255,1,253,57,137,0,0,86,
+    142,255,0,105,136,0,1,7,249,141,255,1,244,175,141,255,1,253,139,159,255,0,97,135,
+    0,0,232,132,255,0,33,170,0,0,248,132,255,0,27,164,0,0,35,132,255,0,241,148,
+    0,0,20,142,255,0,237,150,0,0,222,142,255,0,40,129,0,0,160,132,255,0,91,150,
+    0,0,73,132,255,0,179,129,0,0,240,142,255,0,32,176,0,1,18,224,165,255,1,252,
+    86,134,0,0,235,142,255,0,39,154,0,0,40,142,255,0,232,128,0,143,255,0,20,145,
+    0,143,255,0,20,128,0,0,249,142,255,0,23,137,0,0,24,142,255,0,247,128,0,175,
+    255,1,249,28,130,0,174,255,0,128,142,0,0,49,143,255,0,173,129,0,0,67,143,255,
+    1,249,15,139,0,143,255,0,20,176,0,1,18,216,146,255,0,81,132,0,162,255,0,116,
+    143,255,0,20,128,0,176,255,0,129,138,0,0,71,142,255,0,91,137,0,0,201,158,255,
+    1,210,67,159,255,0,39,135,0,0,222,132,255,0,41,170,0,0,240,132,255,0,34,164,
+    0,0,43,132,255,0,233,148,0,0,52,142,255,0,202,150,0,0,186,142,255,0,71,129,
+    0,0,189,132,255,0,75,150,0,0,57,132,255,0,207,129,0,0,251,142,255,0,24,177,
+    0,1,39,231,165,255,1,251,85,133,0,0,242,142,255,0,32,154,0,0,29,142,255,0,
+    243,128,0,143,255,0,20,145,0,143,255,0,20,128,0,0,254,142,255,0,21,137,0,0,
+    21,142,255,0,252,128,0,175,255,0,149,131,0,174,255,0,128,142,0,0,129,143,255,0,
+    95,129,0,1,4,239,143,255,0,94,139,0,143,255,0,20,175,0,1,10,199,146,255,0,
+    192,133,0,143,255,0,237,144,255,0,238,143,255,0,20,128,0,175,255,1,182,3,138,0,
+    0,56,142,255,0,78,137,0,0,145,158,255,2,152,12,252,157,255,1,237,1,135,0,0,
+    212,132,255,0,58,170,0,0,231,132,255,0,43,164,0,0,62,132,255,0,222,148,0,0,
+    81,142,255,0,170,150,0,0,153,142,255,0,100,129,0,0,207,132,255,0,60,150,0,0,
+    42,132,255,0,226,129,0,0,251,142,255,0,22,178,0,1,41,231,165,255,1,247,45,132,
+    0,0,250,142,255,0,26,154,0,0,22,142,255,0,253,128,0,143,255,0,20,145,0,143,
+    255,0,20,128,0,0,254,142,255,0,20,137,0,0,22,142,255,0,253,128,0,174,255,1,
+    236,18,131,0,174,255,0,128,142,0,0,209,142,255,1,253,21,130,0,0,167,143,255,0,
+    180,139,0,143,255,0,20,174,0,1,5,183,146,255,1,250,42,133,0,143,255,0,115,162,
+    255,0,20,128,0,174,255,1,197,10,139,0,0,41,142,255,0,64,137,0,0,90,158,255,
+    2,94,0,207,157,255,0,181,136,0,0,199,132,255,0,77,170,0,0,212,132,255,0,64,
+    164,0,0,84,132,255,0,199,148,0,0,110,142,255,0,144,150,0,0,128,142,255,0,129,
+    129,0,0,217,132,255,0,45,150,0,0,27,132,255,0,235,129,0,0,242,142,255,0,27,
+    179,0,1,28,201,165,255,1,213,10,131,0,0,254,142,255,0,21,154,0,0,28,142,255,
+    0,248,128,0,143,255,0,20,145,0,143,255,0,20,128,0,0,250,142,255,0,23,137,0,
+    0,25,142,255,0,248,128,0,174,255,0,94,132,0,174,255,0,128,141,0,0,33,143,255,
+    0,254,131,244,0,249,143,255,1,249,16,138,0,143,255,0,20,173,0,1,3,170,147,255,
+    0,125,134,0,143,255,1,22,210,161,255,0,20,128,0,173,255,1,184,12,140,0,0,27,
+    142,255,0,50,137,0,0,34,158,255,2,35,0,149,157,255,0,123,136,0,0,171,132,255,
+    0,98,170,0,0,187,132,255,0,88,164,0,0,107,132,255,0,175,148,0,0,138,142,255,
+    0,120,150,0,0,102,142,255,0,157,129,0,0,226,132,255,0,35,150,0,0,17,132,255,
+    0,245,129,0,0,231,142,255,0,33,180,0,2,7,144,253,164,255,0,147,131,0,0,248,
+    142,255,0,26,154,0,0,35,142,255,0,241,128,0,143,255,0,20,145,0,143,255,0,20,
+    128,0,0,245,142,255,0,26,137,0,0,28,142,255,0,244,128,0,173,255,0,164,133,0,
+    174,255,0,101,141,0,0,114,168,255,0,95,138,0,143,255,0,20,172,0,1,1,160,147,
+    255,1,203,4,134,0,143,255,1,20,73,161,255,0,20,128,0,171,255,2,254,141,4,141,
+    0,0,12,142,255,0,36,138,0,0,234,156,255,0,233,128,0,0,91,157,255,0,66,136,
+    0,0,139,132,255,0,129,170,0,0,161,132,255,0,115,164,0,0,142,132,255,0,151,148,
+    0,0,167,142,255,0,95,150,0,0,77,142,255,0,186,129,0,0,236,132,255,0,30,150,
+    0,0,12,132,255,0,254,129,0,0,221,142,255,0,43,182,0,1,54,197,163,255,1,251,
+    34,130,0,0,240,142,255,0,33,154,0,0,44,142,255,0,233,128,0,143,255,0,20,145,
+    0,143,255,0,20,128,0,0,241,142,255,0,29,137,0,0,31,142,255,0,239,128,0,172,
+    255,1,205,12,133,0,174,255,0,50,141,0,0,194,168,255,0,181,138,0,143,255,0,20,
+    171,0,1,1,154,147,255,1,242,36,135,0,143,255,2,20,0,191,160,255,0,20,128,0,
+    170,255,1,221,70,144,0,0,252,141,255,0,22,138,0,0,179,156,255,0,175,128,0,0,
+    33,156,255,1,252,12,136,0,0,106,132,255,0,162,170,0,0,128,132,255,0,155,164,0,
+    0,182,132,255,0,116,148,0,0,194,142,255,0,77,150,0,0,59,142,255,0,213,129,0,
+    0,245,132,255,0,25,150,0,0,7,133,255,0,8,128,0,0,211,142,255,0,62,184,0,
+    1,73,194,162,255,0,162,130,0,0,232,142,255,0,45,154,0,0,66,142,255,0,224,128,
+    0,143,255,0,20,145,0,143,255,0,19,128,0,0,236,142,255,0,37,137,0,0,39,142,
+    255,0,233,128,0,171,255,1,214,20,134,0,173,255,0,186,141,0,1,21,253,168,255,1,
+    250,16,137,0,143,255,0,20,171,0,0,149,148,255,0,89,136,0,143,255,3,20,0,53,
+    254,159,255,0,20,128,0,170,255,0,82,145,0,0,238,141,255,0,8,138,0,0,124,156,
+    255,0,117,129,0,0,230,155,255,0,207,137,0,0,74,132,255,0,198,170,0,0,85,132,
+    255,0,198,164,0,0,222,132,255,0,75,148,0,0,207,142,255,0,62,150,0,0,44,142,
+    255,0,226,129,0,0,253,132,255,0,21,150,0,0,1,133,255,0,17,128,0,0,201,142,
+    255,0,80,153,0,3,25,66,45,12,155,0,2,50,155,243,159,255,1,253,33,129,0,0,
+    217,142,255,0,68,154,0,0,88,142,255,0,204,128,0,0,252,142,255,0,21,144,0,0,
+    3,143,255,0,14,128,0,0,225,142,255,0,46,137,0,0,49,142,255,0,219,128,0,170,
+    255,1,197,24,135,0,172,255,1,219,29,141,0,0,99,170,255,0,96,137,0,143,255,0,
+    20,170,0,0,140,148,255,0,146,137,0,143,255,0,20,128,0,0,169,159,255,0,20,128,
+    0,170,255,1,235,27,144,0,0,223,140,255,0,250,139,0,0,68,156,255,0,59,129,0,
+    0,173,155,255,0,150,137,0,0,40,132,255,1,244,2,158,0,1,24,27,135,0,0,42,
+    132,255,1,244,4,162,0,0,22,133,255,0,34,148,0,0,217,142,255,0,47,150,0,0,
+    29,142,255,0,236,129,0,0,252,132,255,0,26,150,0,0,7,133,255,0,15,128,0,0,
+    181,142,255,0,106,151,0,2,33,188,253,128,255,3,249,184,106,28,154,0,3,11,93,182,
+    250,157,255,0,120,129,0,0,192,142,255,0,92,154,0,0,116,142,255,0,180,128,0,0,
+    247,142,255,0,23,144,0,0,8,143,255,0,7,128,0,0,211,142,255,0,55,137,0,0,
+    58,142,255,0,204,128,0,169,255,1,148,5,136,0,169,255,3,249,205,134,10,142,0,0,
+    179,170,255,0,181,137,0,143,255,0,20,169,0,0,133,148,255,1,195,5,137,0,143,255,
+    0,20,128,0,1,35,250,158,255,0,20,128,0,171,255,1,192,3,143,0,0,208,140,255,
+    0,237,139,0,1,14,253,154,255,1,249,7,129,0,0,115,155,255,0,92,137,0,1,2,
+    242,132,255,0,41,158,0,4,115,254,204,125,47,132,0,1,4,244,132,255,0,56,162,0,
+    0,82,132,255,1,240,2,148,0,0,226,142,255,0,35,150,0,0,17,142,255,0,245,129,
+    0,0,247,132,255,0,34,150,0,0,15,133,255,0,10,128,0,0,148,142,255,0,139,150,
+    0,1,37,228,134,255,2,205,127,48,137,0,10,20,53,81,109,137,166,194,208,187,131,16,
+    132,0,3,16,92,170,241,154,255,0,206,129,0,0,167,142,255,0,129,154,0,0,155,142,
+    255,0,156,128,0,0,241,142,255,0,28,144,0,0,12,143,255,0,1,128,0,0,196,142,
+    255,0,69,137,0,0,72,142,255,0,189,128,0,167,255,1,203,58,138,0,143,255,0,20,
+    170,0,1,11,247,170,255,1,250,17,136,0,143,255,0,20,168,0,0,122,148,255,1,223,
+    21,138,0,143,255,0,20,129,0,0,147,158,255,0,20,128,0,172,255,0,122,143,0,0,
+    193,140,255,0,223,140,0,0,213,154,255,0,198,130,0,0,57,155,255,0,35,138,0,0,
+    187,132,255,0,98,158,0,0,166,130,255,3,224,146,68,4,129,0,0,185,132,255,0,121,
+    162,0,0,147,132,255,0,182,149,0,0,236,142,255,0,30,150,0,0,12,142,255,0,254,
+    129,0,0,243,132,255,0,42,150,0,0,23,133,255,0,4,128,0,0,115,142,255,0,173,
+    150,0,0,173,138,255,2,223,101,4,132,0,1,98,205,136,255,1,239,52,134,0,3,5,
+    68,144,222,152,255,0,32,128,0,0,140,142,255,0,170,154,0,0,195,142,255,0,130,128,
+    0,0,236,142,255,0,36,144,0,0,24,142,255,0,250,129,0,0,182,142,255,0,86,137,
+    0,0,89,142,255,0,174,128,0,165,255,2,191,82,1,139,0,143,255,0,20,170,0,0,
+    84,172,255,0,96,136,0,143,255,0,20,167,0,0,103,148,255,1,242,45,139,0,143,255,
+    0,20,129,0,1,21,242,157,255,0,20,128,0,143,255,0,20,129,0,4,5,18,50,121,
+    240,146,255,1,245,29,142,0,0,179,140,255,0,209,140,0,0,158,154,255,0,140,130,0,
+    1,6,248,153,255,0,233,139,0,0,129,132,255,0,168,158,0,0,227,133,255,0,23,129,
+    0,0,121,132,255,0,203,161,0,1,1,228,132,255,0,121,149,0,0,245,142,255,0,25,
+    150,0,0,7,143,255,0,8,128,0,0,232,132,255,0,50,150,0,0,31,132,255,0,249,
+    129,0,0,82,142,255,0,219,149,0,1,23,251,140,255,1,182,3,130,0,0,153,139,255,
+    1,228,21,137,0,2,46,127,211,149,255,0,87,128,0,0,103,142,255,0,220,153,0,1,
+    5,245,142,255,0,91,128,0,0,225,142,255,0,47,144,0,0,39,142,255,0,243,129,0,
+    0,165,142,255,0,104,137,0,0,106,142,255,0,150,128,0,161,255,3,254,202,125,41,142,
+    0,143,255,0,20,170,0,0,164,172,255,0,182,136,0,143,255,0,20,166,0,1,82,253,
+    147,255,1,251,72,140,0,143,255,0,20,130,0,0,126,157,255,0,20,128,0,143,255,0,
+    20,133,0,1,39,229,146,255,0,169,142,0,0,164,140,255,0,195,140,0,0,102,154,255,
+    0,82,131,0,0,197,153,255,0,176,139,0,0,71,132,255,1,236,2,156,0,0,39,133,
+    255,0,217,130,0,0,51,133,255,0,36,160,0,0,57,133,255,0,57,149,0,0,253,142,
+    255,0,21,150,0,0,1,143,255,0,17,128,0,0,217,132,255,0,58,150,0,0,39,132,
+    255,0,235,129,0,0,49,142,255,1,254,15,148,0,0,88,142,255,0,131,129,0,0,80,
+    141,255,0,110,140,0,2,41,133,227,146,255,0,136,128,0,0,60,143,255,0,28,152,0,
+    0,54,143,255,0,49,128,0,0,208,142,255,0,62,144,0,0,56,142,255,0,228,129,0,
+    0,140,142,255,0,126,137,0,0,130,142,255,0,123,128,0,153,255,8,249,240,231,212,184,
+    155,116,66,16,145,0,143,255,0,20,169,0,1,5,239,172,255,1,250,17,135,0,143,255,
+    0,20,165,0,1,55,246,148,255,0,101,141,0,143,255,0,20,130,0,1,11,231,156,255,
+    0,20,128,0,143,255,0,20,134,0,1,44,242,146,255,0,62,141,0,0,149,140,255,0,
+    181,140,0,0,47,154,255,0,24,131,0,0,139,153,255,0,119,139,0,1,14,250,132,255,
+    0,71,156,0,0,118,133,255,0,155,131,0,0,222,132,255,0,136,160,0,0,160,132,255,
+    1,230,1,149,0,0,252,142,255,0,26,150,0,0,7,143,255,0,15,128,0,0,202,132,
+    255,0,69,150,0,0,49,132,255,0,220,129,0,0,15,143,255,0,73,148,0,0,140,142,
+    255,1,231,3,128,0,0,189,141,255,0,186,142,0,2,3,82,216,144,255,0,185,128,0,
+    0,16,143,255,0,97,152,0,0,126,142,255,1,254,9,128,0,0,190,142,255,0,82,144,
+    0,0,84,142,255,0,206,129,0,0,113,142,255,0,154,137,0,0,157,142,255,0,97,128,
+    0,143,255,0,20,163,0,143,255,0,20,169,0,0,69,174,255,0,97,135,0,143,255,0,
+    20,164,0,1,32,234,148,255,0,129,142,0,143,255,0,20,131,0,0,104,156,255,0,20,
+    128,0,143,255,0,20,135,0,0,83,146,255,1,208,3,140,0,0,134,140,255,0,167,140,
+    0,1,3,244,152,255,0,221,132,0,0,81,153,255,0,61,140,0,0,181,132,255,0,166,
+    156,0,0,203,133,255,0,83,131,0,0,138,132,255,1,240,13,158,0,1,22,248,132,255,
+    0,148,150,0,0,247,142,255,0,34,150,0,0,15,143,255,0,10,128,0,0,183,132,255,
+    0,92,150,0,0,73,132,255,0,201,130,0,0,219,142,255,0,143,148,0,0,204,143,255,
+    0,34,128,0,0,237,141,255,0,230,144,0,1,10,161,143,255,0,212,129,0,0,223,142,
+    255,0,185,152,0,0,209,142,255,0,216,129,0,0,172,142,255,0,107,144,0,0,111,142,
+    255,0,184,129,0,0,87,142,255,0,182,137,0,0,185,142,255,0,69,128,0,143,255,0,
+    20,163,0,143,255,0,20,169,0,0,149,174,255,0,183,135,0,143,255,0,20,163,0,1,
+    10,208,148,255,0,152,143,0,143,255,0,20,131,0,1,4,217,155,255,0,20,128,0,143,
+    255,0,20,136,0,0,162,146,255,0,103,140,0,0,119,140,255,0,153,141,0,0,192,152,
+    255,0,163,132,0,0,23,152,255,1,250,9,140,0,0,92,132,255,1,248,25,154,0,0,
+    49,133,255,1,249,13,131,0,0,45,133,255,0,123,158,0,0,141,133,255,0,61,150,0,
+    0,242,142,255,0,42,150,0,0,23,143,255,0,4,128,0,0,158,132,255,0,116,150,0,
+    0,97,132,255,0,176,130,0,0,161,142,255,0,221,147,0,1,20,253,143,255,0,29,128,
+    0,0,250,142,255,0,11,144,0,1,3,197,142,255,0,227,129,0,0,161,142,255,1,252,
+    31,150,0,0,50,143,255,0,155,129,0,0,148,142,255,0,138,144,0,0,151,142,255,0,
+    162,129,0,0,58,142,255,0,219,137,0,0,224,142,255,0,32,128,0,143,255,0,20,163,
+    0,143,255,0,20,168,0,1,1,228,174,255,1,250,17,134,0,143,255,0,20,163,0,0,
+    167,148,255,1,172,2,143,0,143,255,0,20,132,0,0,82,155,255,0,20,128,0,143,255,
+    0,20,136,0,1,18,234,145,255,1,229,8,139,0,0,104,140,255,0,140,141,0,0,136,
+    152,255,0,105,133,0,0,221,151,255,0,202,141,0,1,13,246,132,255,0,142,154,0,0,
+    160,133,255,0,183,133,0,0,192,132,255,1,244,28,156,0,1,36,249,132,255,0,212,151,
+    0,0,233,142,255,0,50,150,0,0,31,142,255,0,251,129,0,0,132,132,255,0,141,150,
+    0,0,122,132,255,0,150,130,0,0,102,143,255,0,60,146,0,0,100,143,255,1,246,5,
+    128,0,0,240,142,255,0,61,145,0,0,88,142,255,0,242,129,0,0,97,143,255,0,144,
+    150,0,0,161,143,255,0,94,129,0,0,117,142,255,0,179,144,0,0,194,142,255,0,138,
+    129,0,0,21,142,255,1,252,7,135,0,1,9,254,141,255,1,246,1,128,0,143,255,0,
+    20,163,0,143,255,0,20,168,0,0,54,176,255,0,98,134,0,143,255,0,20,162,0,0,
+    106,148,255,1,184,6,144,0,143,255,0,20,133,0,0,198,154,255,0,20,128,0,143,255,
+    0,20,137,0,0,95,146,255,0,114,139,0,0,90,140,255,0,126,141,0,0,81,152,255,
+    0,47,133,0,0,163,151,255,0,145,142,0,0,171,132,255,1,246,33,152,0,1,36,251,
+    133,255,0,90,133,0,0,81,133,255,0,178,155,0,1,1,187,133,255,0,105,151,0,0,
+    219,142,255,0,58,150,0,0,39,142,255,0,236,129,0,0,104,132,255,0,165,150,0,0,
+    146,132,255,0,121,130,0,0,43,143,255,0,168,146,0,0,196,143,255,0,190,129,0,0,
+    230,142,255,0,122,145,0,0,43,142,255,0,251,129,0,0,32,143,255,1,247,33,148,0,
+    1,42,252,143,255,0,32,129,0,0,85,142,255,0,231,143,0,1,5,245,142,255,0,100,
+    130,0,0,236,142,255,0,53,135,0,0,59,142,255,0,208,129,0,143,255,0,20,163,0,
+    143,255,0,20,168,0,0,134,176,255,0,183,134,0,143,255,0,20,161,0,1,46,248,147,
+    255,1,195,10,145,0,143,255,0,20,133,0,0,60,154,255,0,20,128,0,143,255,0,20,
+    137,0,1,1,199,145,255,1,234,12,138,0,0,75,140,255,0,112,141,0,0,25,151,255,
+    1,242,2,133,0,0,105,151,255,0,88,142,0,0,68,133,255,0,184,152,0,0,180,133,
+    255,1,242,9,133,0,1,2,212,133,255,0,112,154,0,0,119,133,255,1,234,11,151,0,
+    0,203,142,255,0,72,150,0,0,53,142,255,0,221,129,0,0,69,132,255,0,190,150,0,
+    0,171,132,255,0,86,130,0,1,1,239,142,255,1,253,40,144,0,0,55,144,255,0,128,
+    129,0,0,208,142,255,0,204,145,0,0,27,142,255,0,237,130,0,0,208,143,255,0,180,
+    147,0,1,1,188,143,255,0,211,130,0,0,52,143,255,0,46,142,0,0,62,143,255,0,
+    60,130,0,0,196,142,255,0,110,135,0,0,116,142,255,0,165,129,0,143,255,0,20,163,
+    0,143,255,0,20,168,0,0,215,176,255,1,250,18,133,0,143,255,0,20,160,0,1,6,
+    209,147,255,1,203,14,146,0,143,255,0,20,134,0,0,178,153,255,0,20,128,0,143,255,
+    0,20,138,0,1,53,254,145,255,0,122,138,0,0,60,140,255,0,98,142,0,0,226,150,
+    255,0,186,134,0,0,47,151,255,0,30,143,0,0,210,133,255,0,109,150,0,0,91,134,
+    255,0,144,135,0,0,79,133,255,1,250,71,152,0,1,75,251,133,255,0,111,152,0,0,
+    187,142,255,0,97,150,0,0,78,142,255,0,205,129,0,0,32,132,255,0,221,150,0,0,
+    202,132,255,0,50,131,0,0,166,143,255,0,188,144,0,0,195,144,255,0,59,129,0,0,
+    177,143,255,0,55,144,0,0,50,142,255,0,222,130,0,0,122,144,255,0,111,146,0,0,
+    116,144,255,0,128,130,0,1,11,253,142,255,0,146,142,0,0,147,143,255,0,19,130,0,
+    0,151,142,255,0,182,135,0,0,189,142,255,0,110,129,0,143,255,0,20,163,0,143,255,
+    0,20,167,0,0,38,178,255,0,98,133,0,143,255,0,20,160,0,0,129,147,255,1,208,
+    17,147,0,143,255,0,20,134,0,1,42,252,152,255,0,20,128,0,143,255,0,20,139,0,
+    0,164,145,255,1,238,15,137,0,0,32,140,255,0,70,142,0,0,171,150,255,0,128,134,
+    0,1,2,242,149,255,0,229,144,0,0,88,133,255,1,250,63,148,0,1,44,243,133,255,
+    1,252,32,136,0,0,197,133,255,1,244,57,150,0,1,59,245,133,255,1,225,7,152,0,
+    0,164,142,255,0,121,150,0,0,103,142,255,0,181,129,0,1,2,248,131,255,1,253,9,
+    149,0,0,242,132,255,0,14,131,0,0,77,144,255,0,107,142,0,0,95,144,255,1,236,
+    2,129,0,0,145,143,255,1,196,3,143,0,0,115,142,255,0,205,130,0,0,36,144,255,
+    1,251,76,144,0,1,77,252,144,255,0,45,131,0,0,216,142,255,1,246,33,140,0,1,
+    20,242,142,255,0,234,131,0,0,95,142,255,1,249,18,133,0,1,23,251,142,255,0,55,
+    129,0,143,255,0,20,163,0,143,255,0,20,167,0,0,119,143,255,0,157,141,0,1,6,
+    241,143,255,0,184,133,0,143,255,0,20,159,0,1,38,248,146,255,1,214,21,148,0,143,
+    255,0,20,135,0,0,156,152,255,0,20,128,0,143,255,0,20,139,0,1,30,248,145,255,
+    0,131,138,0,0,226,138,255,1,251,12,142,0,0,115,150,255,0,70,135,0,0,187,149,
+    255,0,172,144,0,1,1,210,133,255,1,242,56,146,0,1,35,229,134,255,0,159,137,0,
+    1,44,250,133,255,1,244,74,148,0,1,74,245,134,255,0,78,153,0,0,138,142,255,0,
+    146,150,0,0,127,142,255,0,156,130,0,0,206,132,255,0,47,148,0,0,27,132,255,0,
+    223,132,0,1,6,238,143,255,1,249,68,140,0,1,54,247,144,255,0,162,130,0,0,99,
+    144,255,0,147,142,0,1,9,223,142,255,0,169,131,0,0,194,144,255,1,246,76,142,0,
+    1,77,247,144,255,0,210,132,0,0,166,143,255,1,202,12,138,0,1,7,181,143,255,0,
+    178,131,0,0,36,143,255,0,125,133,0,0,131,142,255,1,248,7,129,0,143,255,0,20,
+    163,0,143,255,0,20,167,0,0,200,143,255,0,82,142,0,0,168,143,255,1,251,18,132,
+    0,143,255,0,20,159,0,0,181,146,255,1,222,26,149,0,143,255,0,20,135,0,1,27,
+    246,151,255,0,20,128,0,143,255,0,20,140,0,0,138,145,255,1,242,20,137,0,0,179,
+    138,255,0,214,143,0,0,60,149,255,1,253,14,135,0,0,129,149,255,0,114,145,0,0,
+    69,134,255,1,242,81,144,0,1,54,233,134,255,1,247,29,138,0,0,130,134,255,2,251,
+    121,2,144,0,2,2,121,251,134,255,0,166,154,0,0,112,142,255,0,170,150,0,0,152,
+    142,255,0,131,130,0,0,157,132,255,0,88,148,0,0,68,132,255,0,175,133,0,0,156,
+    144,255,1,245,78,138,0,1,63,235,145,255,0,77,130,0,0,45,145,255,1,165,13,139,
+    0,1,3,170,143,255,0,120,131,0,0,84,145,255,2,251,119,1,138,0,2,1,118,251,
+    145,255,0,103,132,0,0,110,144,255,1,209,48,136,0,1,44,193,144,255,0,115,132,0,
+    0,233,142,255,1,241,26,131,0,1,29,243,142,255,0,187,130,0,143,255,0,20,163,0,
+    143,255,0,20,166,0,1,25,254,142,255,1,249,13,142,0,0,88,144,255,0,99,132,0,
+    143,255,0,20,158,0,0,62,146,255,1,229,34,150,0,143,255,0,20,136,0,0,134,151,
+    255,0,20,128,0,143,255,0,20,140,0,1,17,239,145,255,0,140,136,0,0,123,140,255,
+    0,122,142,0,1,9,251,148,255,0,210,136,0,0,71,149,255,0,57,146,0,0,172,134,
+    255,2,254,145,13,140,0,2,4,116,249,135,255,0,127,139,0,1,6,202,135,255,1,193,
+    47,142,0,1,47,193,135,255,1,228,20,154,0,0,82,142,255,0,197,150,0,0,178,142,
+    255,0,99,130,0,0,108,132,255,0,128,148,0,0,109,132,255,0,127,133,0,0,66,145,
+    255,2,254,145,16,134,0,2,10,124,251,145,255,1,233,4,130,0,1,2,240,145,255,2,
+    229,97,6,136,0,1,38,194,144,255,0,71,131,0,1,3,226,146,255,1,198,58,136,0,
+    1,58,198,146,255,1,240,11,132,0,0,40,145,255,11,254,179,95,44,15,2,7,23,55,
+    105,180,253,145,255,0,51,132,0,0,165,143,255,1,193,7,129,0,1,7,195,143,255,0,
+    113,130,0,143,255,0,20,163,0,173,255,2,230,177,61,134,0,0,105,143,255,0,187,143,
+    0,1,14,249,143,255,0,185,132,0,166,255,2,230,177,61,133,0,0,185,164,255,2,233,
+    182,73,131,0,143,255,0,20,136,0,1,15,236,150,255,0,20,128,0,143,255,0,20,141,
+    0,0,118,145,255,1,246,25,134,0,1,62,254,140,255,1,253,61,142,0,0,205,148,255,
+    0,151,136,0,1,15,253,147,255,1,248,7,146,0,1,22,234,135,255,2,230,114,14,136,
+    0,2,3,85,211,136,255,1,209,5,140,0,1,30,236,135,255,2,253,165,55,138,0,2,
+    57,166,253,135,255,1,248,54,155,0,0,45,142,255,0,236,150,0,0,217,142,255,0,63,
+    130,0,0,54,132,255,0,170,148,0,0,150,132,255,0,71,133,0,1,1,217,146,255,9,
+    242,153,80,33,9,6,27,64,137,230,147,255,0,143,132,0,0,167,147,255,11,232,151,84,
+    41,14,3,12,28,59,113,185,254,144,255,1,251,18,132,0,0,110,148,255,9,203,120,60,
+    22,5,6,23,62,122,204,148,255,0,140,134,0,0,223,174,255,1,239,2,132,0,0,84,
+    144,255,4,193,49,1,37,189,144,255,0,40,130,0,143,255,0,20,163,0,175,255,1,253,
+    122,133,0,0,185,143,255,0,111,144,0,0,184,143,255,1,251,19,131,0,168,255,1,253,
+    122,131,0,0,45,168,255,0,140,130,0,143,255,0,20,137,0,0,113,150,255,0,20,128,
+    0,143,255,0,20,141,0,1,8,227,145,255,0,148,134,0,0,178,142,255,0,177,142,0,
+    0,149,148,255,0,93,137,0,0,211,147,255,0,198,148,0,1,75,254,136,255,11,245,176,
+    105,60,24,9,3,14,42,86,150,232,137,255,1,243,43,142,0,1,69,251,137,255,11,218,
+    144,87,44,18,5,7,20,47,89,146,220,138,255,0,97,156,0,1,9,254,142,255,0,21,
+    148,0,1,6,251,142,255,0,27,130,0,1,4,245,131,255,0,223,148,0,0,203,131,255,
+    1,253,15,134,0,0,106,176,255,1,253,37,132,0,0,86,177,255,0,185,133,0,1,6,
+    224,178,255,1,242,20,134,0,0,149,174,255,0,159,133,0,1,11,247,145,255,0,252,145,
+    255,0,211,131,0,143,255,0,20,163,0,176,255,1,253,61,131,0,1,15,249,143,255,0,
+    35,144,0,0,104,144,255,0,100,131,0,169,255,1,253,61,130,0,0,161,169,255,0,78,
+    129,0,143,255,0,20,137,0,1,6,223,138,255,0,226,136,255,0,20,128,0,143,255,0,
+    20,142,0,0,98,145,255,1,249,31,133,0,0,230,142,255,0,230,142,0,0,94,148,255,
+    0,35,137,0,0,153,147,255,0,141,149,0,0,127,158,255,1,254,82,144,0,1,88,253,
+    159,255,0,119,158,0,0,225,142,255,0,62,148,0,0,43,142,255,1,243,1,131,0,0,
+    190,132,255,0,24,146,0,1,8,250,131,255,0,210,135,0,1,9,231,175,255,0,176,133,
+    0,1,11,240,176,255,0,99,134,0,0,95,178,255,0,127,135,0,0,55,174,255,0,69,
+    134,0,0,173,165,255,0,116,131,0,143,255,0,20,163,0,177,255,0,177,131,0,0,90,
+    143,255,0,216,145,0,1,25,254,143,255,0,185,131,0,170,255,0,177,129,0,1,17,249,
+    169,255,0,197,129,0,143,255,0,20,138,0,0,91,137,255,2,39,1,236,135,255,0,20,
+    128,0,143,255,0,20,142,0,1,3,214,145,255,0,157,133,0,144,255,142,0,0,38,147,
+    255,0,232,138,0,0,96,147,255,0,83,150,0,0,153,157,255,0,103,146,0,1,95,253,
+    157,255,0,120,159,0,0,179,142,255,0,103,148,0,0,84,142,255,0,197,132,0,0,123,
+    132,255,0,81,146,0,0,60,132,255,0,142,136,0,0,110,175,255,0,56,134,0,0,143,
+    175,255,1,246,18,134,0,1,2,202,176,255,1,230,12,136,0,0,210,172,255,1,217,1,
+    134,0,0,66,164,255,1,252,25,131,0,143,255,0,20,163,0,177,255,0,230,131,0,0,
+    170,143,255,0,140,146,0,0,200,143,255,1,251,19,130,0,170,255,0,230,129,0,0,99,
+    170,255,1,246,3,128,0,143,255,0,20,138,0,1,1,206,136,255,2,141,0,236,135,255,
+    0,20,128,0,143,255,0,20,143,0,0,80,145,255,1,251,37,132,0,144,255,142,0,1,
+    1,237,146,255,0,175,138,0,0,38,147,255,0,26,150,0,1,2,150,154,255,1,251,101,
+    148,0,1,77,242,154,255,1,248,98,160,0,0,131,142,255,0,145,148,0,0,125,142,255,
+    0,150,132,0,0,52,132,255,0,138,146,0,0,117,132,255,0,72,136,0,1,7,222,173,
+    255,0,172,135,0,1,35,252,174,255,0,144,136,0,1,45,250,175,255,0,79,137,0,0,
+    106,172,255,0,103,136,0,0,212,163,255,0,166,132,0,143,255,0,20,163,0,178,255,130,
+    0,1,7,242,143,255,0,65,146,0,0,120,144,255,0,101,130,0,171,255,129,0,0,184,
+    171,255,0,20,128,0,143,255,0,20,139,0,0,69,136,255,2,248,31,236,135,255,0,20,
+    128,0,143,255,0,20,144,0,0,198,145,255,0,165,132,0,144,255,143,0,0,183,146,255,
+    0,116,139,0,0,234,145,255,0,224,153,0,1,114,251,151,255,1,236,69,150,0,1,42,
+    217,152,255,1,227,54,161,0,0,82,142,255,0,197,148,0,0,176,142,255,0,102,132,0,
+    1,1,233,131,255,0,196,146,0,0,174,131,255,1,247,9,137,0,0,79,172,255,1,250,
+    37,136,0,0,153,173,255,1,248,26,137,0,0,131,174,255,0,167,138,0,1,7,225,170,
+    255,1,220,5,136,0,0,96,163,255,0,47,132,0,143,255,0,20,163,0,178,255,130,0,
+    0,75,143,255,1,240,4,146,0,0,39,144,255,0,186,130,0,171,255,128,0,1,16,251,
+    171,255,0,20,128,0,143,255,0,20,140,0,0,186,136,255,1,163,236,135,255,0,20,128,
+    0,143,255,0,20,144,0,0,62,145,255,1,253,44,131,0,144,255,143,0,0,128,146,255,
+    0,58,139,0,0,178,145,255,0,167,154,0,1,52,199,149,255,1,181,25,152,0,2,8,
+    132,249,148,255,2,252,145,14,162,0,0,27,142,255,1,248,6,147,0,0,232,142,255,0,
+    46,133,0,0,157,131,255,1,247,8,144,0,1,1,232,131,255,0,178,139,0,0,179,171,
+    255,0,126,137,0,1,22,241,172,255,0,146,138,0,1,6,199,172,255,1,227,20,139,0,
+    0,97,170,255,0,79,137,0,1,2,206,161,255,0,176,133,0,143,255,0,20,163,0,178,
+    255,130,0,0,155,143,255,0,169,148,0,0,216,143,255,1,251,20,129,0,171,255,128,0,
+    0,71,172,255,0,20,128,0,143,255,0,20,140,0,1,49,254,135,255,0,254,136,255,0,
+    20,128,0,143,255,0,20,145,0,0,181,145,255,0,174,131,0,144,255,143,0,0,72,145,
+    255,1,248,7,139,0,0,120,145,255,0,110,155,0,2,1,93,226,145,255,1,212,76,156,
+    0,2,40,164,251,144,255,2,253,172,47,165,0,0,223,142,255,0,55,146,0,0,34,142,
+    255,1,241,2,133,0,0,72,132,255,0,72,144,0,0,50,132,255,0,96,139,0,1,24,
+    237,169,255,1,207,5,138,0,0,103,171,255,1,225,14,139,0,1,28,235,170,255,1,248,
+    53,140,0,1,3,199,168,255,0,169,139,0,0,63,160,255,1,247,35,133,0,143,255,0,
+    20,163,0,178,255,129,0,1,2,232,143,255,0,94,148,0,0,136,144,255,0,101,129,0,
+    171,255,128,0,0,125,172,255,0,20,128,0,143,255,0,20,141,0,0,165,146,255,0,20,
+    128,0,143,255,0,20,145,0,1,46,253,145,255,0,51,130,0,144,255,143,0,1,18,254,
+    144,255,0,198,140,0,0,62,145,255,0,52,157,0,3,3,73,170,248,139,255,3,246,174,
+    72,1,159,0,2,30,134,215,140,255,2,219,139,34,167,0,0,163,142,255,0,113,146,0,
+    0,91,142,255,0,184,134,0,1,5,237,131,255,0,146,144,0,0,123,131,255,1,251,19,
+    140,0,1,78,254,167,255,1,242,40,140,0,0,175,170,255,0,68,141,0,1,68,253,169,
+    255,0,96,142,0,1,34,242,166,255,1,213,14,140,0,0,148,159,255,0,130,134,0,143,
+    255,0,20,163,0,178,255,129,0,0,60,143,255,1,253,21,148,0,0,56,144,255,0,187,
+    129,0,171,255,128,0,0,178,172,255,0,20,128,0,143,255,0,20,141,0,1,33,249,145,
+    255,0,20,128,0,143,255,0,20,146,0,0,163,145,255,0,182,130,0,144,255,144,0,0,
+    217,144,255,0,140,140,0,1,9,250,143,255,1,246,5,160,0,14,12,64,117,170,204,220,
+    237,251,248,237,213,179,133,75,11,165,0,5,39,103,148,193,221,235,128,249,5,236,222,193,
+    149,104,41,170,0,0,99,142,255,0,170,146,0,0,148,142,255,0,119,135,0,0,151,131,
+    255,0,219,144,0,0,196,131,255,0,177,142,0,0,130,166,255,1,254,79,141,0,1,18,
+    217,168,255,0,143,143,0,1,100,254,167,255,0,134,144,0,1,88,254,164,255,1,237,35,
+    141,0,1,8,210,157,255,1,206,8,134,0,143,255,0,20,163,0,178,255,129,0,0,140,
+    143,255,0,199,149,0,1,1,229,143,255,1,252,20,128,0,171,255,128,0,0,210,172,255,
+    0,20,128,0,143,255,0,20,142,0,0,143,145,255,0,20,128,0,143,255,0,20,146,0,
+    1,32,249,145,255,0,46,129,0,144,255,144,0,0,162,144,255,0,81,141,0,0,202,143,
+    255,0,193,255,0,144,0,0,27,142,255,1,232,1,145,0,0,210,142,255,0,49,135,0,
+    0,54,132,255,0,36,142,0,1,16,252,131,255,0,82,142,0,1,1,162,165,255,0,112,
+    143,0,1,31,229,166,255,1,174,2,144,0,0,107,166,255,0,136,146,0,0,111,163,255,
+    1,249,65,143,0,1,38,235,155,255,1,239,33,135,0,143,255,0,20,163,0,178,255,129,
+    0,0,216,143,255,0,123,150,0,0,151,144,255,0,96,128,0,171,255,128,0,0,228,172,
+    255,0,20,128,0,143,255,0,20,142,0,1,19,240,144,255,0,20,128,0,143,255,0,20,
+    147,0,0,145,145,255,0,126,129,0,144,255,144,0,0,106,144,255,0,23,141,0,0,144,
+    143,255,0,136,255,0,145,0,0,210,142,255,0,50,144,0,0,27,142,255,1,234,1,136,
+    0,0,211,131,255,0,109,142,0,0,87,131,255,1,237,6,143,0,1,4,173,163,255,0,
+    120,145,0,1,43,228,164,255,1,195,8,146,0,1,112,254,163,255,0,136,148,0,0,121,
+    161,255,1,237,61,145,0,1,55,244,153,255,1,248,70,136,0,143,255,0,20,163,0,178,
+    255,128,0,1,11,254,143,255,0,47,150,0,0,71,144,255,0,146,128,0,171,255,128,0,
+    0,247,172,255,0,20,128,0,143,255,0,20,143,0,0,121,144,255,0,20,128,0,0,249,
+    142,255,0,13,147,0,1,21,242,144,255,0,152,129,0,144,255,144,0,0,51,143,255,0,
+    221,142,0,0,86,143,255,0,79,255,0,145,0,0,136,142,255,0,123,144,0,0,101,142,
+    255,0,160,137,0,0,114,131,255,0,191,142,0,0,167,131,255,0,148,145,0,1,3,156,
+    160,255,1,251,103,147,0,1,29,213,162,255,1,178,12,148,0,1,79,242,160,255,1,248,
+    99,150,0,1,86,245,158,255,1,219,38,147,0,1,64,240,151,255,1,248,73,137,0,0,
+    230,141,255,1,246,3,163,0,0,230,176,255,0,229,128,0,0,10,143,255,0,227,151,0,
+    1,5,240,143,255,0,147,128,0,0,230,169,255,0,229,128,0,0,230,171,255,1,246,3,
+    128,0,0,230,141,255,1,246,3,143,0,1,9,229,142,255,1,246,3,128,0,0,205,141,
+    255,0,224,149,0,0,126,144,255,0,126,129,0,0,230,142,255,0,229,144,0,1,4,246,
+    142,255,0,163,142,0,0,27,143,255,0,22,255,0,145,0,0,53,142,255,0,197,144,0,
+    0,174,142,255,0,79,137,0,1,21,250,130,255,1,253,26,140,0,1,11,245,131,255,0,
+    53,147,0,1,113,250,157,255,1,235,69,149,0,1,16,169,160,255,1,141,2,150,0,1,
+    43,220,158,255,1,227,53,152,0,1,47,207,156,255,1,176,20,149,0,1,44,226,149,255,
+    1,235,67,138,0,0,179,141,255,0,198,164,0,0,179,176,255,0,178,129,0,0,212,142,
+    255,0,144,152,0,0,160,143,255,0,95,128,0,0,179,169,255,0,178,128,0,0,179,171,
+    255,0,198,129,0,0,179,141,255,0,198,145,0,0,100,142,255,0,198,129,0,0,135,141,
+    255,0,154,149,0,1,12,232,143,255,0,44,129,0,0,179,142,255,0,178,145,0,0,175,
+    142,255,0,86,143,0,0,206,141,255,0,200,255,0,147,0,0,223,141,255,1,252,17,142,
+    0,1,5,241,141,255,1,244,9,138,0,0,173,131,255,0,114,140,0,0,90,131,255,0,
+    211,149,0,1,54,213,155,255,1,183,24,152,0,1,96,239,156,255,1,228,81,153,0,2,
+    11,139,251,154,255,2,253,150,16,154,0,2,4,117,242,152,255,1,224,88,152,0,1,18,
+    168,147,255,1,194,27,139,0,1,63,254,140,255,0,80,164,0,1,63,254,174,255,1,253,
+    62,129,0,0,98,141,255,1,249,30,152,0,1,41,253,141,255,1,228,10,128,0,1,63,
+    254,167,255,1,253,62,128,0,1,63,254,170,255,0,80,129,0,1,63,254,140,255,0,80,
+    145,0,1,3,204,141,255,0,80,129,0,1,11,220,139,255,1,231,18,150,0,0,78,142,
+    255,0,148,130,0,1,63,254,140,255,1,253,62,145,0,1,65,254,140,255,1,224,5,143,
+    0,0,94,141,255,0,87,255,0,147,0,0,138,142,255,0,89,142,0,0,65,142,255,0,
+    168,139,0,0,65,131,255,0,204,140,0,0,179,131,255,0,101,150,0,2,6,119,239,151,
+    255,1,224,89,155,0,2,19,148,251,152,255,2,252,147,13,156,0,1,47,194,152,255,1,
+    199,52,158,0,2,16,123,233,148,255,2,220,110,7,155,0,1,80,213,143,255,2,226,96,
+    2,141,0,1,124,254,138,255,0,141,166,0,1,124,254,172,255,1,254,123,131,0,1,124,
+    254,138,255,1,251,83,154,0,1,96,253,139,255,1,222,41,130,0,1,124,254,165,255,1,
+    254,123,130,0,1,124,254,168,255,0,141,131,0,1,124,254,138,255,0,141,147,0,1,36,
+    225,139,255,0,141,131,0,1,30,188,137,255,1,198,38,152,0,1,86,238,138,255,2,252,
+    140,4,131,0,1,124,254,138,255,1,254,123,147,0,0,118,139,255,1,238,44,145,0,0,
+    147,139,255,0,142,255,0,148,0,0,43,142,255,0,176,142,0,0,153,142,255,0,73,140,
+    0,0,208,131,255,0,37,138,0,1,18,250,130,255,1,237,9,152,0,2,17,126,230,147,
+    255,2,218,108,8,158,0,2,33,142,240,148,255,2,240,140,31,160,0,2,58,176,254,146,
+    255,2,254,178,63,162,0,3,6,76,162,237,142,255,3,235,157,71,2,158,0,3,2,89,
+    191,253,138,255,2,197,103,8,144,0,2,63,179,230,133,255,2,234,183,74,168,0,2,63,
+    179,230,168,255,2,230,178,62,133,0,2,79,196,243,134,255,2,228,170,45,156,0,2,53,
+    176,231,134,255,3,254,229,155,22,132,0,2,63,179,230,161,255,2,230,178,62,132,0,2,
+    63,179,230,163,255,2,234,183,74,133,0,2,63,179,230,133,255,2,234,183,74,149,0,3,
+    20,139,221,252,133,255,2,234,183,74,133,0,2,1,51,103,133,128,2,106,55,2,154,0,
+    2,10,85,120,134,128,2,126,99,28,134,0,2,63,179,230,134,255,2,230,178,62,149,0,
+    2,62,183,233,133,255,3,253,218,149,23,147,0,2,79,192,238,133,255,2,237,190,75,255,
+    0,150,0,0,202,141,255,1,249,16,140,0,1,5,236,141,255,1,231,3,140,0,0,96,
+    131,255,0,128,138,0,0,102,131,255,0,135,155,0,3,5,80,166,239,141,255,3,236,157,
+    71,1,162,0,3,11,88,169,241,142,255,3,238,169,94,12,164,0,3,34,117,196,253,140,
+    255,3,253,197,119,35,167,0,17,1,42,99,144,176,209,230,240,250,253,246,235,212,185,147,
+    103,45,1,164,0,12,25,100,151,198,226,241,252,239,223,199,150,99,33,255,0,255,0,255,
+    0,255,0,255,0,132,0,0,104,142,255,0,100,140,0,0,75,142,255,0,139,141,0,1,
+    7,232,130,255,1,226,3,137,0,0,204,130,255,1,251,29,158,0,16,2,50,106,150,188,
+    214,236,247,253,248,237,221,189,154,106,48,3,168,0,17,3,46,100,146,179,210,231,241,251,
+    250,238,225,212,184,142,101,56,3,170,0,6,21,76,121,167,205,221,235,128,249,6,235,221,
+    204,166,121,77,20,255,0,255,0,255,0,255,0,255,0,245,0,1,15,246,141,255,0,190,
+    140,0,0,165,142,255,0,43,142,0,0,126,131,255,0,80,136,0,0,54,131,255,0,168,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,158,0,0,164,141,255,1,253,26,138,
+    0,1,10,243,141,255,0,204,143,0,1,18,242,130,255,0,186,136,0,0,159,130,255,1,
+    254,44,255,0,255,0,255,0,255,0,255,0,255,0,255,0,158,0,0,65,142,255,0,122,
+    138,0,0,97,142,255,0,105,144,0,0,131,130,255,1,254,37,134,0,1,17,246,130,255,
+    0,169,255,0,255,0,255,0,255,0,255,0,255,0,255,0,160,0,0,211,141,255,1,225,
+    2,137,0,0,202,141,255,1,239,11,144,0,1,17,240,130,255,0,142,134,0,0,114,130,
+    255,1,253,42,255,0,255,0,255,0,255,0,255,0,255,0,255,0,160,0,0,100,142,255,
+    0,78,136,0,0,51,142,255,0,138,146,0,0,128,130,255,1,239,12,132,0,1,2,220,
+    130,255,0,166,255,0,255,0,255,0,255,0,255,0,255,0,255,0,161,0,1,8,234,141,
+    255,0,184,136,0,0,158,141,255,1,252,31,146,0,1,15,238,130,255,0,117,132,0,0,
+    88,130,255,1,251,39,255,0,255,0,255,0,255,0,255,0,255,0,255,0,162,0,0,131,
+    141,255,1,254,35,134,0,1,16,246,141,255,0,172,148,0,0,108,130,255,1,231,8,131,
+    0,0,208,130,255,0,141,255,0,255,0,255,0,255,0,255,0,255,0,255,0,163,0,1,
+    24,249,141,255,0,143,134,0,0,116,142,255,0,61,148,0,1,3,209,130,255,0,105,130,
+    0,0,76,130,255,1,231,14,255,0,255,0,255,0,255,0,255,0,255,0,255,0,164,0,
+    0,155,141,255,1,244,20,132,0,1,7,229,141,255,0,193,150,0,0,63,130,255,1,223,
+    4,129,0,0,197,130,255,0,94,255,0,255,0,255,0,255,0,255,0,255,0,255,0,165,
+    0,1,31,250,141,255,0,131,132,0,0,103,142,255,0,63,151,0,0,167,130,255,0,94,
+    128,0,0,63,130,255,1,198,1,255,0,255,0,255,0,255,0,255,0,255,0,255,0,166,
+    0,0,152,141,255,1,239,14,130,0,1,3,220,141,255,0,189,255,0,255,0,255,0,255,
+    0,255,0,255,0,255,0,207,0,1,29,249,141,255,0,120,130,0,0,90,142,255,0,60,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,208,0,0,149,141,255,1,233,8,129,
+    0,0,210,141,255,0,186,255,0,255,0,255,0,255,0,255,0,255,0,255,0,209,0,1,
+    25,242,141,255,0,84,128,0,0,54,141,255,1,252,48,255,0,255,0,255,0,255,0,255,
+    0,255,0,255,0,210,0,0,117,141,255,0,137,128,0,0,107,141,255,0,149,255,0,255,
+    0,255,0,255,0,255,0,255,0,255,0,211,0,1,5,216,140,255,0,139,128,0,0,108,
+    140,255,1,236,17,255,0,255,0,255,0,255,0,255,0,255,0,255,0,212,0,0,71,140,
+    255,0,87,128,0,0,56,140,255,0,102,255,0,255,0,255,0,255,0,255,0,255,0,255,
+    0,214,0,0,170,138,255,1,223,6,129,0,0,197,138,255,1,201,2,255,0,255,0,255,
+    0,255,0,255,0,255,0,255,0,214,0,1,7,174,136,255,1,235,49,130,0,1,30,223,
+    136,255,1,224,29,255,0,255,0,255,0,255,0,255,0,255,0,255,0,216,0,3,3,121,
+    214,249,130,255,3,253,226,150,27,132,0,3,16,137,220,251,130,255,3,251,221,137,16,255,
+    0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,
+    0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,201,0,14,
+    44,104,157,193,222,239,249,250,237,224,202,161,120,65,5,156,0,10,44,124,177,220,238,251,
+    241,223,181,128,49,141,0,133,255,0,20,155,0,133,255,0,20,128,0,166,255,0,128,129,
+    0,133,255,0,20,177,0,0,153,133,255,0,190,151,0,133,255,1,207,1,154,0,133,255,
+    0,20,141,0,12,20,92,150,194,226,243,252,246,234,205,168,111,43,140,0,147,255,10,254,
+    248,242,235,218,197,176,141,99,49,1,139,0,151,255,8,253,249,238,225,203,177,142,96,39,
+    144,0,0,209,132,255,0,207,149,0,0,42,134,255,1,254,18,148,0,1,15,254,132,255,
+    0,110,128,0,0,84,134,255,0,84,146,0,13,39,91,142,191,213,229,245,251,238,225,195,
+    155,110,41,160,0,13,7,69,131,173,213,232,246,249,230,211,188,134,74,17,164,0,2,19,
+    148,227,132,255,2,242,187,59,150,0,0,18,144,44,3,42,34,24,13,149,0,2,18,79,
+    125,131,128,2,118,71,1,148,0,2,25,97,126,130,128,2,127,92,29,132,0,2,27,165,
+    229,156,255,2,249,203,97,132,0,2,27,165,229,134,255,2,246,200,80,145,0,2,53,183,
+    240,133,255,2,243,192,66,144,0,13,8,75,127,176,213,229,245,251,239,221,184,141,75,11,
+    153,0,11,29,101,161,202,232,246,249,231,212,171,113,50,143,0,144,44,3,42,35,26,11,
+    174,0,2,30,134,223,140,255,2,241,171,70,152,0,1,80,206,137,255,1,208,87,139,0,
+    133,255,0,20,155,0,133,255,0,20,128,0,166,255,0,128,129,0,133,255,0,20,176,0,
+    1,1,231,133,255,1,252,23,150,0,134,255,0,92,154,0,133,255,0,20,139,0,2,67,
+    181,251,138,255,2,208,100,4,137,0,157,255,2,233,150,35,137,0,160,255,2,224,134,28,
+    141,0,0,153,132,255,1,250,6,148,0,0,100,135,255,0,76,148,0,0,65,133,255,0,
+    53,128,0,0,84,134,255,0,84,143,0,2,37,126,216,140,255,2,224,128,26,155,0,2,
+    60,167,244,138,255,3,252,179,79,4,160,0,1,14,211,136,255,1,249,69,147,0,1,58,
+    209,149,255,4,242,210,173,113,50,143,0,1,67,239,135,255,1,203,21,146,0,1,96,246,
+    134,255,1,252,106,130,0,1,28,236,161,255,0,135,130,0,1,28,236,139,255,0,104,143,
+    0,1,62,247,137,255,1,254,88,141,0,2,58,159,241,138,255,2,244,153,40,148,0,2,
+    1,82,190,138,255,2,210,109,11,140,0,148,255,4,237,204,149,83,6,167,0,2,27,157,
+    252,145,255,1,213,88,148,0,1,26,190,141,255,1,189,31,137,0,133,255,0,20,155,0,
+    133,255,0,20,128,0,166,255,0,128,129,0,133,255,0,20,176,0,0,57,135,255,0,105,
+    150,0,134,255,1,224,7,153,0,133,255,0,20,137,0,1,40,188,143,255,1,216,57,136,
+    0,159,255,2,252,163,19,135,0,162,255,2,245,118,4,139,0,0,98,133,255,0,49,148,
+    0,0,159,135,255,0,135,148,0,0,116,132,255,1,246,5,128,0,0,84,134,255,0,84,
+    141,0,1,43,176,145,255,2,251,153,22,151,0,1,63,203,144,255,2,229,98,2,158,0,
+    0,125,138,255,1,217,2,145,0,1,47,250,155,255,2,215,111,8,139,0,1,30,250,137,
+    255,0,188,145,0,1,52,253,137,255,0,76,129,0,0,166,162,255,1,253,39,129,0,0,
+    166,140,255,1,241,15,142,0,0,207,139,255,1,238,7,138,0,1,44,179,143,255,2,251,
+    146,12,145,0,1,56,202,142,255,1,228,91,139,0,152,255,2,235,112,3,164,0,1,97,
+    242,149,255,1,188,37,145,0,1,58,234,143,255,1,235,57,136,0,133,255,0,20,155,0,
+    133,255,0,20,128,0,166,255,0,128,129,0,133,255,0,20,176,0,0,138,135,255,0,191,
+    150,0,135,255,0,114,153,0,133,255,0,20,136,0,1,96,245,145,255,1,252,114,135,0,
+    161,255,1,229,67,134,0,164,255,1,192,16,138,0,0,42,133,255,0,97,148,0,0,218,
+    135,255,0,194,148,0,0,167,132,255,0,194,129,0,0,84,134,255,0,84,139,0,2,17,
+    158,253,148,255,1,241,100,148,0,1,21,172,148,255,1,204,58,157,0,0,220,139,255,0,
+    63,145,0,0,183,158,255,1,219,67,138,0,0,132,139,255,0,50,144,0,0,167,138,255,
+    0,183,129,0,0,230,163,255,0,101,129,0,0,230,141,255,0,92,141,0,0,44,141,255,
+    0,53,137,0,1,113,251,146,255,1,217,45,142,0,2,3,128,252,145,255,1,186,18,137,
+    0,154,255,1,189,15,161,0,1,4,156,152,255,1,242,76,143,0,1,59,243,145,255,1,
+    246,59,135,0,133,255,0,20,155,0,133,255,0,20,128,0,166,255,0,128,129,0,133,255,
+    0,20,176,0,0,217,135,255,1,253,23,149,0,135,255,1,237,16,152,0,133,255,0,20,
+    135,0,0,126,149,255,0,129,134,0,162,255,1,251,82,133,0,165,255,1,211,17,137,0,
+    1,1,240,132,255,0,146,147,0,0,22,136,255,1,247,6,147,0,0,218,132,255,0,137,
+    129,0,0,84,134,255,0,84,138,0,1,50,222,152,255,1,164,10,145,0,1,68,231,150,
+    255,1,252,115,155,0,0,46,140,255,0,149,145,0,0,238,159,255,1,253,110,137,0,0,
+    160,139,255,0,128,143,0,1,6,241,138,255,0,210,129,0,164,255,0,128,129,0,142,255,
+    0,164,141,0,0,117,141,255,0,80,135,0,1,8,172,149,255,1,239,55,140,0,1,9,
+    178,148,255,1,222,45,136,0,155,255,1,200,8,159,0,1,5,180,154,255,1,253,108,141,
+    0,1,33,238,147,255,1,238,38,134,0,133,255,0,20,155,0,133,255,0,20,128,0,166,
+    255,0,128,129,0,133,255,0,20,175,0,0,42,137,255,0,106,149,0,136,255,0,137,152,
+    0,133,255,0,20,134,0,0,119,151,255,0,99,133,0,163,255,1,250,76,132,0,166,255,
+    1,188,4,137,0,0,187,132,255,0,194,147,0,0,80,137,255,0,56,146,0,1,14,254,
+    132,255,0,80,129,0,0,84,134,255,0,84,137,0,1,96,248,154,255,1,192,11,143,0,
+    1,99,252,153,255,1,164,9,153,0,0,126,140,255,1,232,2,144,0,162,255,0,124,136,
+    0,0,137,139,255,0,203,143,0,0,70,139,255,0,189,129,0,164,255,0,128,129,0,142,
+    255,1,233,1,140,0,0,190,141,255,0,80,134,0,1,5,179,151,255,1,240,39,138,0,
+    1,10,195,150,255,1,237,42,135,0,156,255,0,156,159,0,0,167,156,255,1,254,90,139,
+    0,1,7,205,136,255,1,254,249,137,255,1,206,6,133,0,133,255,0,20,155,0,133,255,
+    0,20,128,0,166,255,0,128,129,0,133,255,0,20,175,0,0,123,137,255,0,191,149,0,
+    136,255,1,247,29,151,0,133,255,0,20,133,0,1,74,254,138,255,0,250,138,255,1,247,
+    43,132,0,164,255,1,240,30,131,0,167,255,0,130,137,0,0,132,132,255,1,241,1,146,
+    0,0,139,137,255,0,115,146,0,0,65,133,255,0,23,129,0,0,84,134,255,0,84,136,
+    0,1,94,254,156,255,1,194,6,141,0,0,119,156,255,1,185,5,152,0,0,207,141,255,
+    0,65,144,0,163,255,0,86,135,0,0,73,139,255,1,254,24,142,0,0,148,139,255,0,
+    123,129,0,164,255,0,128,129,0,143,255,0,50,139,0,1,13,250,141,255,0,80,134,0,
+    0,167,134,255,11,232,149,93,45,23,6,8,24,60,116,191,254,133,255,1,215,10,136,0,
+    1,4,180,134,255,9,208,129,68,28,10,6,24,56,115,192,134,255,1,228,31,134,0,131,
+    255,0,80,139,0,4,11,28,67,125,218,133,255,0,64,157,0,0,116,158,255,1,249,58,
+    138,0,0,124,134,255,8,236,129,47,4,0,16,69,157,249,134,255,0,129,133,0,133,255,
+    0,20,155,0,133,255,0,20,128,0,166,255,0,128,129,0,133,255,0,20,175,0,0,203,
+    131,255,0,229,131,255,1,253,24,148,0,137,255,0,159,151,0,133,255,0,20,132,0,1,
+    18,231,134,255,9,253,180,98,37,11,0,15,44,116,202,135,255,1,204,2,131,0,165,255,
+    1,192,2,130,0,167,255,1,249,40,136,0,0,76,133,255,0,35,146,0,0,198,137,255,
+    0,174,146,0,0,116,132,255,0,221,130,0,0,84,134,255,0,84,135,0,1,82,252,158,
+    255,0,154,140,0,0,103,158,255,1,167,2,150,0,0,32,142,255,0,151,144,0,163,255,
+    1,244,30,134,0,1,6,241,139,255,0,98,142,0,0,225,139,255,0,41,129,0,164,255,
+    0,128,129,0,143,255,0,121,139,0,0,81,142,255,0,80,133,0,0,107,133,255,2,212,
+    80,3,136,0,1,39,182,133,255,0,134,136,0,0,140,133,255,1,192,58,136,0,1,40,
+    171,133,255,1,204,4,133,0,131,255,0,80,143,0,2,2,93,242,131,255,0,199,156,0,
+    1,42,250,136,255,12,197,137,86,44,28,12,4,21,38,65,122,181,248,136,255,1,217,9,
+    136,0,1,30,245,133,255,1,177,20,133,0,1,36,200,133,255,1,246,29,132,0,133,255,
+    0,20,155,0,133,255,0,20,128,0,133,255,0,20,162,0,133,255,0,20,174,0,1,28,
+    254,131,255,0,123,132,255,0,107,148,0,137,255,1,253,45,150,0,133,255,0,20,132,0,
+    0,145,134,255,1,199,49,135,0,1,83,225,134,255,0,101,131,0,133,255,0,20,140,0,
+    7,3,10,16,34,56,88,135,205,136,255,0,90,130,0,133,255,0,20,143,0,6,2,17,
+    33,56,109,163,240,136,255,0,181,136,0,0,21,133,255,0,84,145,0,1,8,249,131,255,
+    0,232,131,255,0,233,146,0,0,167,132,255,0,163,130,0,0,84,134,255,0,84,134,0,
+    1,51,249,160,255,0,90,138,0,1,75,253,159,255,0,141,150,0,0,113,142,255,1,233,
+    3,143,0,164,255,0,179,135,0,0,166,139,255,0,173,141,0,0,49,139,255,0,215,130,
+    0,164,255,0,128,129,0,143,255,0,192,139,0,0,154,142,255,0,80,132,0,1,40,246,
+    131,255,2,252,120,3,140,0,1,84,238,131,255,1,249,31,134,0,1,72,254,131,255,1,
+    246,102,140,0,1,70,234,132,255,0,129,133,0,131,255,0,80,145,0,1,43,240,131,255,
+    0,57,155,0,0,190,134,255,2,250,142,38,138,0,2,22,128,237,135,255,0,137,136,0,
+    0,154,133,255,1,157,2,135,0,1,6,175,133,255,0,160,132,0,133,255,0,20,155,0,
+    133,255,0,20,128,0,133,255,0,20,162,0,133,255,0,20,174,0,0,108,131,255,2,246,
+    22,254,131,255,0,192,148,0,138,255,0,181,150,0,133,255,0,20,131,0,1,29,249,133,
+    255,1,158,3,137,0,1,22,204,133,255,1,227,6,130,0,133,255,0,20,148,0,1,50,
+    201,134,255,1,215,2,129,0,133,255,0,20,149,0,2,11,102,227,134,255,1,254,42,136,
+    0,0,221,132,255,0,133,145,0,0,60,131,255,1,249,140,132,255,0,37,145,0,0,218,
+    132,255,0,106,130,0,0,84,134,255,0,84,133,0,1,10,215,161,255,1,233,16,136,0,
+    1,27,236,160,255,1,254,70,149,0,0,194,143,255,0,67,143,0,165,255,0,64,134,0,
+    0,84,139,255,1,242,6,140,0,0,127,139,255,0,133,130,0,164,255,0,128,129,0,143,
+    255,1,250,13,138,0,0,226,142,255,0,80,132,0,0,196,131,255,1,246,69,143,0,1,
+    54,242,131,255,0,143,133,0,1,9,225,131,255,1,236,55,142,0,1,29,209,131,255,1,
+    251,47,132,0,131,255,0,80,146,0,0,80,131,255,0,143,154,0,0,61,134,255,1,205,
+    45,142,0,1,26,190,134,255,1,246,21,134,0,1,24,248,132,255,1,187,3,137,0,1,
+    5,197,132,255,1,250,25,131,0,133,255,0,20,155,0,133,255,0,20,128,0,133,255,0,
+    20,162,0,133,255,0,20,174,0,0,188,131,255,2,200,0,209,131,255,1,253,24,147,0,
+    139,255,0,65,149,0,133,255,0,20,131,0,0,135,133,255,1,157,1,139,0,1,12,210,
+    133,255,0,97,130,0,133,255,0,20,149,0,1,7,171,134,255,0,83,129,0,133,255,0,
+    20,151,0,1,18,173,134,255,0,153,136,0,0,166,132,255,0,181,145,0,0,119,131,255,
+    1,206,78,132,255,0,96,144,0,1,14,254,132,255,0,49,130,0,0,84,134,255,0,84,
+    133,0,0,151,163,255,0,144,135,0,1,1,191,162,255,1,229,17,147,0,1,21,252,143,
+    255,0,153,143,0,165,255,0,181,134,0,1,11,247,139,255,0,68,140,0,0,205,139,255,
+    0,51,130,0,164,255,0,101,129,0,144,255,0,79,137,0,0,45,143,255,0,80,131,0,
+    0,77,131,255,1,251,74,145,0,1,63,252,130,255,1,242,9,132,0,0,126,131,255,1,
+    242,50,144,0,1,22,216,131,255,0,180,132,0,131,255,0,80,147,0,0,197,130,255,0,
+    216,154,0,0,172,133,255,1,195,11,144,0,1,2,158,134,255,0,132,134,0,0,129,132,
+    255,1,238,23,139,0,1,26,240,132,255,0,130,131,0,133,255,0,20,155,0,133,255,0,
+    20,128,0,133,255,0,20,162,0,133,255,0,20,173,0,1,17,251,131,255,2,151,0,141,
+    132,255,0,107,147,0,139,255,1,203,1,148,0,133,255,0,20,130,0,1,2,232,132,255,
+    1,218,9,141,0,1,39,243,132,255,0,196,130,0,133,255,0,20,150,0,1,7,198,133,
+    255,0,172,129,0,133,255,0,20,152,0,1,1,171,133,255,1,234,2,135,0,0,110,132,
+    255,0,230,145,0,0,178,131,255,1,158,21,132,255,0,155,144,0,0,64,132,255,1,244,
+    3,130,0,0,84,134,255,0,84,132,0,0,58,164,255,1,245,19,134,0,0,94,164,255,
+    0,160,147,0,0,99,144,255,1,235,3,142,0,165,255,1,254,31,134,0,0,177,139,255,
+    0,143,139,0,0,27,139,255,0,224,131,0,163,255,1,253,40,129,0,144,255,0,150,137,
+    0,0,118,143,255,0,80,130,0,1,2,209,131,255,0,118,147,0,0,142,131,255,0,83,
+    131,0,1,13,241,131,255,0,79,146,0,1,34,242,131,255,0,56,131,0,131,255,0,80,
+    147,0,0,106,130,255,1,253,10,152,0,1,14,247,132,255,1,219,13,146,0,1,5,189,
+    133,255,1,232,2,132,0,1,1,222,132,255,0,105,141,0,0,105,132,255,1,230,2,130,
+    0,133,255,0,20,155,0,133,255,0,20,128,0,133,255,0,20,162,0,133,255,0,20,173,
+    0,0,93,132,255,2,101,0,73,132,255,0,193,147,0,140,255,0,87,148,0,133,255,0,
+    20,130,0,0,64,133,255,0,63,143,0,0,125,133,255,0,28,129,0,133,255,0,20,151,
+    0,1,37,248,132,255,1,244,9,128,0,133,255,0,20,153,0,1,8,210,133,255,0,58,
+    135,0,0,55,133,255,0,22,143,0,1,1,236,131,255,2,109,0,221,131,255,0,214,144,
+    0,0,116,132,255,0,190,131,0,0,84,134,255,0,84,132,0,0,193,165,255,0,125,133,
+    0,1,11,229,164,255,1,253,43,146,0,0,180,145,255,0,68,142,0,166,255,0,109,134,
+    0,0,96,139,255,0,218,139,0,0,105,139,255,0,142,131,0,163,255,0,136,130,0,144,
+    255,0,221,137,0,0,191,143,255,0,80,130,0,0,76,131,255,1,198,2,147,0,1,20,
+    245,130,255,0,167,131,0,0,113,131,255,0,154,148,0,0,99,131,255,0,179,131,0,131,
+    255,0,80,147,0,0,43,131,255,0,47,152,0,0,82,133,255,0,71,148,0,1,22,243,
+    133,255,0,58,132,0,0,60,132,255,1,226,5,141,0,1,5,225,132,255,0,60,130,0,
+    133,255,0,20,155,0,133,255,0,20,128,0,133,255,0,20,162,0,133,255,0,20,173,0,
+    0,173,132,255,3,51,0,11,249,131,255,1,253,25,146,0,140,255,1,220,5,147,0,133,
+    255,0,20,130,0,0,139,132,255,0,206,144,0,1,17,243,132,255,0,99,129,0,133,255,
+    0,20,152,0,0,140,133,255,0,73,128,0,133,255,0,20,154,0,0,74,133,255,0,120,
+    135,0,1,6,248,132,255,0,71,143,0,0,40,132,255,2,55,0,165,131,255,1,254,18,
+    143,0,0,167,132,255,0,132,131,0,0,84,134,255,0,84,131,0,0,73,166,255,0,221,
+    133,0,0,120,166,255,0,175,145,0,1,12,248,145,255,0,154,142,0,166,255,0,184,134,
+    0,1,18,251,139,255,0,37,138,0,0,184,139,255,0,60,131,0,160,255,2,249,205,98,
+    131,0,145,255,0,37,135,0,1,14,250,143,255,0,80,130,0,0,175,131,255,0,52,149,
+    0,0,155,130,255,0,234,131,0,0,216,130,255,1,242,21,148,0,1,1,207,130,255,1,
+    252,24,130,0,131,255,0,80,147,0,0,17,131,255,0,64,152,0,0,141,132,255,0,201,
+    150,0,0,131,133,255,0,136,132,0,0,140,132,255,0,120,143,0,0,119,132,255,0,143,
+    130,0,133,255,0,20,155,0,133,255,0,20,128,0,133,255,0,20,162,0,133,255,0,20,
+    172,0,1,8,244,131,255,1,243,5,128,0,0,189,132,255,0,108,146,0,133,255,0,252,
+    133,255,0,109,147,0,133,255,0,20,130,0,0,202,132,255,0,103,145,0,0,165,132,255,
+    0,156,129,0,133,255,0,20,152,0,1,28,252,132,255,0,120,128,0,133,255,0,20,155,
+    0,0,209,132,255,0,163,136,0,0,200,132,255,0,119,143,0,0,99,131,255,3,248,6,
+    0,109,132,255,0,76,143,0,0,218,132,255,0,75,131,0,0,84,134,255,0,84,131,0,
+    0,203,142,255,9,205,118,61,22,6,15,39,87,171,250,141,255,0,52,131,0,1,5,229,
+    141,255,9,254,192,105,45,20,6,27,80,166,249,142,255,0,51,144,0,0,85,146,255,1,
+    236,4,141,0,139,255,0,80,135,0,3,11,35,94,208,139,255,0,233,135,0,0,189,139,
+    255,0,113,137,0,1,12,248,138,255,1,232,2,131,0,139,255,0,80,154,0,145,255,0,
+    108,135,0,0,82,144,255,0,80,129,0,1,22,250,130,255,0,177,150,0,0,63,131,255,
+    0,41,129,0,0,48,131,255,0,136,150,0,0,78,131,255,0,116,130,0,131,255,0,80,
+    147,0,0,4,131,255,0,75,152,0,0,187,132,255,0,116,150,0,1,15,247,132,255,0,
+    188,132,0,0,212,132,255,0,33,143,0,0,32,132,255,0,219,130,0,133,255,0,20,155,
+    0,133,255,0,20,128,0,133,255,0,20,162,0,133,255,0,20,172,0,0,78,132,255,0,
+    180,129,0,0,116,132,255,0,194,146,0,133,255,0,156,133,255,1,234,13,146,0,133,255,
+    0,20,129,0,1,6,251,132,255,0,30,145,0,0,101,132,255,0,203,129,0,133,255,0,
+    20,153,0,0,194,132,255,0,164,128,0,133,255,0,20,155,0,0,136,132,255,0,205,136,
+    0,0,144,132,255,0,168,143,0,0,158,131,255,0,199,128,0,0,52,132,255,0,135,142,
+    0,1,14,254,132,255,0,19,131,0,0,81,134,255,0,80,130,0,0,50,141,255,1,226,
+    75,135,0,1,41,196,140,255,0,135,131,0,0,92,141,255,1,215,56,134,0,1,36,189,
+    141,255,0,154,144,0,0,166,147,255,0,70,141,0,139,255,0,80,138,0,1,6,197,139,
+    255,0,21,134,0,0,107,139,255,0,188,137,0,0,84,139,255,0,152,132,0,139,255,0,
+    80,154,0,145,255,0,179,135,0,0,155,144,255,0,80,129,0,0,109,131,255,0,60,150,
+    0,1,2,237,128,255,2,236,155,31,129,0,0,131,130,255,1,253,32,150,0,1,3,230,
+    130,255,0,206,130,0,131,255,0,80,147,0,0,19,131,255,0,64,152,0,0,220,132,255,
+    0,61,151,0,0,180,132,255,0,233,131,0,0,27,132,255,0,210,145,0,0,209,132,255,
+    0,25,129,0,133,255,0,20,155,0,133,255,0,20,128,0,133,255,0,20,162,0,133,255,
+    0,20,172,0,0,158,132,255,0,113,129,0,0,43,132,255,1,253,25,145,0,133,255,1,
+    36,237,133,255,0,132,146,0,133,255,0,20,129,0,0,46,132,255,0,232,146,0,0,47,
+    132,255,0,236,129,0,133,255,0,20,153,0,0,123,132,255,0,205,128,0,133,255,0,20,
+    155,0,0,73,132,255,0,227,136,0,0,89,132,255,0,217,143,0,0,217,131,255,0,143,
+    128,0,1,5,246,131,255,0,194,142,0,0,64,132,255,0,216,132,0,0,67,134,255,0,
+    67,130,0,0,148,140,255,1,203,21,137,0,1,9,191,139,255,0,201,131,0,0,186,140,
+    255,1,189,12,136,0,1,3,145,140,255,1,240,9,142,0,1,6,240,147,255,0,156,141,
+    0,139,255,0,80,139,0,0,71,139,255,0,50,134,0,1,27,254,138,255,1,250,13,136,
+    0,0,162,139,255,0,69,132,0,139,255,0,80,154,0,145,255,1,244,6,134,0,0,227,
+    144,255,0,80,129,0,0,176,130,255,0,222,152,0,3,152,159,72,4,131,0,0,198,130,
+    255,0,195,152,0,0,142,130,255,1,254,18,129,0,131,255,0,80,147,0,0,60,131,255,
+    0,46,152,0,0,241,132,255,0,36,151,0,0,101,133,255,0,17,130,0,0,86,132,255,
+    0,147,145,0,0,146,132,255,0,87,129,0,133,255,0,20,155,0,133,255,0,20,128,0,
+    133,255,0,20,162,0,133,255,0,20,171,0,1,3,234,132,255,0,45,130,0,0,225,132,
+    255,0,109,145,0,133,255,1,20,115,133,255,1,245,25,145,0,133,255,0,20,129,0,0,
+    86,132,255,0,182,146,0,0,26,133,255,0,4,128,0,133,255,0,20,153,0,0,78,132,
+    255,0,223,128,0,133,255,0,20,155,0,0,48,132,255,0,240,136,0,0,33,132,255,1,
+    253,11,141,0,0,21,132,255,0,85,129,0,0,194,131,255,1,247,6,141,0,0,115,132,
+    255,0,159,132,0,0,52,134,255,0,54,129,0,1,8,238,139,255,1,224,21,139,0,1,
+    22,239,138,255,1,251,12,129,0,1,20,251,139,255,1,203,10,139,0,0,156,140,255,0,
+    90,142,0,0,72,148,255,1,237,4,140,0,139,255,0,80,139,0,0,16,139,255,0,64,
+    135,0,0,200,139,255,0,82,135,0,1,3,236,138,255,1,238,4,132,0,139,255,0,80,
+    154,0,146,255,0,65,133,0,0,46,145,255,0,80,128,0,1,2,238,130,255,0,132,160,
+    0,1,9,250,130,255,0,117,152,0,0,55,131,255,0,79,129,0,131,255,0,80,147,0,
+    0,131,131,255,0,20,152,0,0,251,132,255,0,26,151,0,0,40,133,255,0,35,130,0,
+    0,139,132,255,0,87,145,0,0,86,132,255,0,146,129,0,133,255,0,20,155,0,133,255,
+    0,20,128,0,133,255,0,20,162,0,133,255,0,20,171,0,0,63,132,255,1,233,1,130,
+    0,0,150,132,255,0,194,145,0,133,255,2,20,7,224,133,255,0,154,145,0,133,255,0,
+    20,129,0,0,115,132,255,0,159,146,0,0,6,133,255,0,14,128,0,133,255,0,20,153,
+    0,0,44,132,255,0,236,128,0,133,255,0,20,155,0,0,27,132,255,0,251,137,0,0,
+    233,132,255,0,58,141,0,0,79,132,255,0,27,129,0,0,136,132,255,0,56,141,0,0,
+    167,132,255,0,101,132,0,0,37,134,255,0,40,129,0,0,76,139,255,1,254,65,141,0,
+    0,131,139,255,0,63,129,0,0,100,139,255,1,243,34,140,0,1,8,211,139,255,0,175,
+    142,0,0,153,149,255,0,72,140,0,139,255,0,80,139,0,0,8,139,255,0,75,135,0,
+    0,119,139,255,0,158,135,0,0,62,139,255,0,161,133,0,139,255,0,80,154,0,146,255,
+    0,137,133,0,0,119,145,255,0,80,128,0,0,48,131,255,0,65,160,0,0,59,131,255,
+    0,54,152,0,1,4,243,130,255,0,142,129,0,131,255,0,80,146,0,1,8,229,130,255,
+    0,221,153,0,0,249,132,255,0,46,151,0,1,5,252,132,255,0,49,130,0,0,192,132,
+    255,0,41,145,0,0,41,132,255,0,192,129,0,133,255,0,20,155,0,133,255,0,20,128,
+    0,133,255,0,20,162,0,133,255,0,20,171,0,0,143,132,255,0,166,131,0,0,73,132,
+    255,1,253,26,144,0,133,255,2,20,0,93,133,255,1,252,41,144,0,133,255,0,20,129,
+    0,1,128,253,131,255,0,143,146,0,0,14,133,255,0,12,128,0,133,255,0,20,153,0,
+    0,30,132,255,0,250,128,0,133,255,0,20,155,0,0,32,132,255,0,239,137,0,0,178,
+    132,255,0,106,141,0,0,138,131,255,0,224,130,0,0,78,132,255,0,116,141,0,0,218,
+    132,255,0,44,132,0,0,22,134,255,0,26,129,0,0,142,139,255,0,168,142,0,0,33,
+    139,255,0,75,129,0,0,166,139,255,0,126,142,0,0,70,139,255,1,237,1,140,0,1,
+    1,231,149,255,0,158,140,0,139,255,0,80,139,0,0,36,139,255,0,64,135,0,0,37,
+    139,255,1,232,1,134,0,0,141,139,255,0,79,133,0,139,255,0,80,154,0,146,255,0,
+    208,133,0,0,193,145,255,0,80,128,0,0,96,130,255,1,250,10,160,0,0,102,130,255,
+    1,248,6,153,0,0,185,130,255,0,186,129,0,131,255,0,80,146,0,0,131,131,255,0,
+    162,153,0,0,236,132,255,0,85,152,0,7,219,255,252,231,207,183,159,33,130,0,0,237,
+    131,255,1,249,4,145,0,1,3,248,131,255,0,235,129,0,133,255,0,20,155,0,133,255,
+    0,20,128,0,133,255,0,20,162,0,133,255,0,20,171,0,0,222,132,255,0,98,131,0,
+    1,7,244,132,255,0,109,144,0,133,255,3,20,0,2,208,133,255,0,176,144,0,133,255,
+    0,20,130,0,6,6,36,68,100,132,165,95,146,0,0,35,132,255,0,250,129,0,133,255,
+    0,20,153,0,0,25,132,255,0,250,128,0,133,255,0,20,155,0,0,51,132,255,0,222,
+    137,0,0,123,132,255,0,155,141,0,0,197,131,255,0,166,130,0,0,20,132,255,0,175,
+    140,0,1,14,254,131,255,1,240,2,132,0,0,8,134,255,0,12,129,0,0,207,138,255,
+    1,254,41,143,0,0,205,137,255,1,254,31,129,0,0,227,138,255,1,245,16,143,0,0,
+    206,139,255,0,46,140,0,0,58,150,255,1,238,5,139,0,139,255,0,80,139,0,0,113,
+    139,255,0,46,136,0,0,212,139,255,0,52,134,0,0,218,138,255,1,244,8,133,0,139,
+    255,0,80,154,0,147,255,0,24,131,0,1,14,251,145,255,0,80,128,0,0,133,130,255,
+    0,206,161,0,0,143,130,255,0,208,154,0,0,131,130,255,0,221,129,0,131,255,0,80,
+    145,0,1,85,252,131,255,0,71,153,0,0,214,132,255,0,154,152,0,2,33,23,2,134,
+    0,0,20,132,255,0,214,147,0,0,214,132,255,0,23,128,0,133,255,0,20,155,0,133,
+    255,0,20,128,0,133,255,0,20,162,0,133,255,0,20,170,0,0,48,132,255,1,254,24,
+    132,0,0,175,132,255,0,195,144,0,133,255,0,20,128,0,0,71,134,255,0,60,143,0,
+    133,255,0,20,157,0,0,69,132,255,0,233,129,0,133,255,0,20,153,0,0,42,132,255,
+    0,241,128,0,133,255,0,20,155,0,0,97,132,255,0,205,137,0,0,67,132,255,0,203,
+    140,0,1,7,248,131,255,0,108,131,0,0,218,131,255,0,233,140,0,0,64,132,255,0,
+    185,134,0,0,249,132,255,1,253,1,128,0,1,18,253,138,255,0,192,144,0,0,136,137,
+    255,0,163,129,0,0,30,139,255,0,164,144,0,0,113,139,255,0,110,140,0,0,139,151,
+    255,0,74,139,0,139,255,0,80,138,0,1,31,235,139,255,0,28,136,0,0,130,139,255,
+    0,128,133,0,0,41,139,255,0,171,134,0,159,255,2,229,165,27,132,0,147,255,0,94,
+    131,0,0,83,146,255,0,80,128,0,0,169,130,255,0,172,161,0,0,175,130,255,0,171,
+    154,0,0,96,130,255,1,251,4,128,0,131,255,0,80,143,0,2,9,131,253,131,255,1,
+    217,1,153,0,0,173,132,255,1,242,19,162,0,0,58,132,255,0,183,147,0,0,183,132,
+    255,0,61,128,0,133,255,0,20,155,0,133,255,0,20,128,0,133,255,0,20,162,0,133,
+    255,0,20,170,0,0,128,132,255,0,201,133,0,0,98,132,255,1,254,26,143,0,133,255,
+    0,20,129,0,0,188,133,255,0,198,143,0,133,255,0,20,157,0,0,129,132,255,0,208,
+    129,0,133,255,0,20,153,0,0,60,132,255,0,226,128,0,133,255,0,20,155,0,0,163,
+    132,255,0,177,137,0,1,14,253,131,255,1,248,4,139,0,0,59,132,255,0,50,131,0,
+    0,160,132,255,0,37,139,0,0,115,132,255,0,128,134,0,0,234,132,255,0,240,129,0,
+    0,68,139,255,0,100,144,0,1,38,253,134,255,2,253,157,8,129,0,0,73,139,255,0,
+    85,144,0,0,25,139,255,0,159,140,0,0,219,151,255,0,160,139,0,139,255,0,80,134,
+    0,4,6,21,54,117,234,139,255,1,241,2,136,0,0,49,139,255,0,203,133,0,0,119,
+    139,255,0,88,134,0,161,255,1,236,27,131,0,147,255,0,166,131,0,0,156,146,255,0,
+    80,128,0,0,203,130,255,0,138,161,0,0,198,130,255,0,140,154,0,0,61,131,255,0,
+    32,128,0,131,255,0,80,137,0,6,1,8,20,46,88,149,234,133,255,0,78,154,0,0,
+    124,133,255,0,155,162,0,0,93,132,255,0,153,147,0,0,153,132,255,0,90,128,0,133,
+    255,0,20,155,0,133,255,0,20,128,0,133,255,0,20,162,0,133,255,0,20,170,0,0,
+    209,132,255,0,123,133,0,1,22,253,132,255,0,110,143,0,133,255,0,20,129,0,1,51,
+    254,133,255,0,82,142,0,133,255,0,20,157,0,0,191,132,255,0,158,129,0,133,255,0,
+    20,153,0,0,89,132,255,0,200,128,0,133,255,0,20,154,0,1,13,242,132,255,0,121,
+    138,0,0,213,132,255,0,44,139,0,0,118,131,255,1,243,3,131,0,0,102,132,255,0,
+    96,139,0,0,166,132,255,0,70,134,0,0,219,132,255,0,226,129,0,0,105,139,255,0,
+    29,145,0,0,138,132,255,2,210,123,35,131,0,0,114,139,255,0,22,145,0,0,214,138,
+    255,0,194,139,0,0,44,152,255,1,239,6,138,0,166,255,0,185,138,0,0,223,138,255,
+    1,254,24,132,0,0,197,138,255,1,248,13,134,0,162,255,0,165,131,0,147,255,1,235,
+    2,130,0,0,228,146,255,0,80,128,0,0,220,130,255,0,111,161,0,0,221,130,255,0,
+    119,154,0,0,33,131,255,0,46,128,0,156,255,0,161,155,0,0,52,134,255,0,119,161,
+    0,0,120,132,255,0,127,147,0,0,127,132,255,0,118,128,0,133,255,0,20,155,0,133,
+    255,0,20,128,0,133,255,0,20,162,0,133,255,0,20,169,0,0,32,133,255,0,46,134,
+    0,0,199,132,255,0,196,143,0,133,255,0,20,130,0,0,167,133,255,1,217,4,141,0,
+    133,255,0,20,156,0,1,27,253,132,255,0,106,129,0,133,255,0,20,153,0,0,150,132,
+    255,0,169,128,0,133,255,0,20,154,0,0,127,133,255,0,64,138,0,0,157,132,255,0,
+    93,139,0,0,177,131,255,0,189,132,0,0,44,132,255,0,155,139,0,0,218,131,255,1,
+    254,15,134,0,0,204,132,255,0,213,129,0,0,141,138,255,0,226,147,0,5,97,196,230,
+    198,127,40,134,0,0,153,138,255,0,222,146,0,0,152,138,255,0,229,139,0,0,125,153,
+    255,0,76,138,0,166,255,0,126,138,0,0,142,139,255,0,97,131,0,1,21,253,138,255,
+    0,180,135,0,162,255,0,229,131,0,148,255,0,52,129,0,0,47,147,255,0,80,128,0,
+    0,231,130,255,0,100,161,0,0,237,130,255,0,99,154,0,0,22,131,255,0,57,128,0,
+    155,255,1,184,8,155,0,1,1,225,134,255,1,166,24,159,0,0,145,132,255,0,107,147,
+    0,0,108,132,255,0,147,128,0,133,255,0,20,155,0,133,255,0,20,128,0,133,255,0,
+    20,162,0,133,255,0,20,169,0,0,113,132,255,0,224,135,0,0,121,132,255,1,254,27,
+    142,0,133,255,0,20,130,0,1,34,249,133,255,0,104,141,0,133,255,0,20,156,0,0,
+    121,133,255,0,50,129,0,133,255,0,20,153,0,0,211,132,255,0,124,128,0,133,255,0,
+    20,153,0,1,44,247,132,255,1,247,11,138,0,0,102,132,255,0,142,139,0,0,235,131,
+    255,0,131,132,0,1,1,239,131,255,0,214,138,0,1,14,254,131,255,0,212,135,0,0,
+    189,132,255,0,199,129,0,0,178,138,255,0,177,161,0,0,179,138,255,0,182,146,0,0,
+    104,138,255,1,254,9,138,0,0,206,139,255,0,178,139,255,0,162,138,0,166,255,0,45,
+    138,0,0,61,139,255,0,173,131,0,0,98,139,255,0,98,135,0,163,255,131,0,148,255,
+    0,123,129,0,0,120,147,255,0,80,128,0,0,242,130,255,0,90,161,0,0,244,130,255,
+    0,90,154,0,0,10,131,255,0,68,128,0,154,255,1,167,7,157,0,0,119,135,255,2,
+    244,139,29,157,0,0,170,132,255,0,88,147,0,0,89,132,255,0,170,128,0,133,255,0,
+    20,155,0,133,255,0,20,128,0,133,255,0,20,162,0,133,255,0,20,169,0,0,194,132,
+    255,0,147,135,0,0,43,133,255,0,111,142,0,133,255,0,20,131,0,0,145,133,255,1,
+    231,12,140,0,133,255,0,20,155,0,1,5,224,132,255,0,221,130,0,133,255,0,20,152,
+    0,0,55,133,255,0,73,128,0,133,255,0,20,152,0,1,26,219,133,255,0,160,139,0,
+    0,46,132,255,0,190,138,0,0,39,132,255,0,73,133,0,0,184,131,255,1,254,18,137,
+    0,0,64,132,255,0,154,135,0,0,175,132,255,0,185,129,0,0,207,138,255,0,145,134,
+    0,2,23,160,227,144,255,2,229,165,27,129,0,0,202,138,255,0,146,146,0,0,70,139,
+    255,0,34,137,0,0,31,139,255,1,210,68,139,255,1,241,7,137,0,165,255,0,193,139,
+    0,1,2,232,138,255,1,242,6,130,0,0,176,138,255,1,252,19,135,0,163,255,131,0,
+    148,255,0,195,129,0,0,194,147,255,0,80,128,0,0,252,130,255,0,82,141,0,0,244,
+    143,255,128,0,0,251,130,255,0,84,154,0,0,2,131,255,0,77,128,0,152,255,1,227,
+    82,159,0,1,16,237,136,255,3,252,179,84,9,154,0,0,190,132,255,0,70,147,0,0,
+    70,132,255,0,186,128,0,133,255,0,20,155,0,133,255,0,20,128,0,133,255,0,20,162,
+    0,133,255,0,20,168,0,1,20,252,132,255,0,69,136,0,0,221,132,255,0,196,142,0,
+    133,255,0,20,131,0,1,20,241,133,255,0,127,140,0,133,255,0,20,155,0,0,103,133,
+    255,0,133,130,0,133,255,0,20,152,0,0,176,132,255,1,250,12,128,0,133,255,0,20,
+    151,0,1,51,221,134,255,0,53,139,0,1,3,243,131,255,0,238,138,0,0,98,131,255,
+    1,254,16,133,0,0,126,132,255,0,76,137,0,0,115,132,255,0,97,135,0,0,160,132,
+    255,0,171,129,0,0,219,138,255,0,114,133,0,1,21,231,148,255,1,236,27,128,0,0,
+    225,138,255,0,122,146,0,0,37,139,255,0,45,137,0,0,112,139,255,2,133,5,241,139,
+    255,0,78,137,0,165,255,0,84,140,0,0,154,139,255,0,67,129,0,1,8,245,138,255,
+    0,190,136,0,163,255,131,0,148,255,4,251,14,0,15,251,147,255,0,80,128,0,0,248,
+    130,255,0,86,141,0,0,244,143,255,128,0,0,253,130,255,0,81,154,0,0,8,131,255,
+    0,72,128,0,149,255,3,249,189,86,4,161,0,0,103,139,255,3,243,170,90,19,151,0,
+    0,204,132,255,0,58,147,0,0,60,132,255,0,202,128,0,133,255,0,20,155,0,133,255,
+    0,20,128,0,133,255,0,20,162,0,133,255,0,20,168,0,0,98,132,255,1,242,6,136,
+    0,0,144,132,255,1,254,27,141,0,133,255,0,20,132,0,0,123,133,255,1,243,22,139,
+    0,133,255,0,20,154,0,1,7,225,133,255,0,43,130,0,133,255,0,20,151,0,1,81,
+    254,132,255,0,189,129,0,133,255,0,20,149,0,2,29,146,249,134,255,0,195,141,0,0,
+    191,132,255,0,31,137,0,0,157,131,255,0,212,134,0,0,68,132,255,0,135,137,0,0,
+    166,132,255,0,40,135,0,0,145,132,255,0,157,129,0,0,231,138,255,0,99,133,0,0,
+    154,150,255,0,165,128,0,0,237,138,255,0,101,146,0,0,21,139,255,0,56,137,0,0,
+    192,139,255,2,55,0,169,139,255,0,164,137,0,164,255,1,193,1,140,0,0,72,139,255,
+    0,143,129,0,0,76,139,255,0,107,136,0,163,255,131,0,149,255,2,81,0,84,148,255,
+    0,80,128,0,0,236,130,255,0,93,141,0,0,244,143,255,128,0,0,246,130,255,0,88,
+    154,0,0,15,131,255,0,65,128,0,147,255,2,251,105,9,164,0,1,2,184,141,255,4,
+    253,201,129,58,3,147,0,0,219,132,255,0,48,147,0,0,49,132,255,0,218,128,0,133,
+    255,0,20,155,0,133,255,0,20,128,0,164,255,0,128,131,0,133,255,0,20,168,0,0,
+    179,132,255,0,170,137,0,0,66,133,255,0,111,141,0,133,255,0,20,132,0,1,10,230,
+    133,255,0,149,139,0,133,255,0,20,154,0,0,128,133,255,0,178,131,0,133,255,0,20,
+    150,0,1,46,243,133,255,0,97,129,0,133,255,0,20,142,0,7,6,13,28,54,86,135,
+    196,254,135,255,1,248,41,141,0,0,136,132,255,0,80,137,0,0,216,131,255,0,154,134,
+    0,1,13,252,131,255,0,195,137,0,0,217,131,255,1,237,1,135,0,0,130,132,255,0,
+    143,129,0,0,242,138,255,0,89,133,0,0,218,150,255,0,229,128,0,0,244,138,255,0,
+    90,146,0,0,10,139,255,0,67,136,0,1,20,252,138,255,3,232,1,0,91,139,255,1,
+    242,8,136,0,163,255,1,244,34,141,0,1,6,240,138,255,0,218,129,0,0,154,138,255,
+    1,254,26,136,0,163,255,131,0,149,255,2,152,0,158,148,255,0,80,128,0,0,225,130,
+    255,0,107,141,0,0,244,143,255,128,0,0,237,130,255,0,97,154,0,0,32,131,255,0,
+    53,128,0,131,255,0,80,132,0,4,7,24,62,130,231,131,255,1,247,104,165,0,1,19,
+    222,144,255,3,237,166,88,15,144,0,0,232,132,255,0,37,147,0,0,38,132,255,0,232,
+    128,0,133,255,0,20,155,0,133,255,0,20,128,0,164,255,0,128,131,0,133,255,0,20,
+    167,0,1,11,247,132,255,0,93,137,0,1,4,239,132,255,0,197,141,0,133,255,0,20,
+    133,0,0,102,133,255,1,251,37,138,0,133,255,0,20,153,0,1,45,248,133,255,0,52,
+    131,0,133,255,0,20,149,0,1,91,242,133,255,1,238,12,129,0,167,255,0,117,142,0,
+    0,80,132,255,0,128,136,0,0,20,132,255,0,96,135,0,0,208,131,255,1,247,6,135,
+    0,1,14,254,131,255,0,181,136,0,0,115,132,255,0,129,129,0,0,252,138,255,0,81,
+    133,0,0,244,151,255,128,0,0,251,138,255,0,84,146,0,0,2,139,255,0,77,136,0,
+    0,98,139,255,0,179,128,44,0,61,140,255,0,80,136,0,162,255,1,254,96,143,0,0,
+    165,139,255,3,37,0,1,230,138,255,0,199,137,0,163,255,131,0,149,255,2,223,0,230,
+    148,255,0,80,128,0,0,213,130,255,0,130,141,0,0,244,143,255,128,0,0,216,130,255,
+    0,119,154,0,0,55,131,255,0,31,128,0,131,255,0,80,136,0,1,13,168,132,255,0,
+    141,165,0,1,31,224,146,255,3,249,181,94,13,141,0,0,241,132,255,0,30,147,0,0,
+    31,132,255,0,237,128,0,133,255,0,20,155,0,133,255,0,20,128,0,164,255,0,128,131,
+    0,133,255,0,20,167,0,0,83,132,255,1,252,19,138,0,0,166,132,255,1,254,28,140,
+    0,133,255,0,20,133,0,1,3,215,133,255,0,171,138,0,133,255,0,20,152,0,1,7,
+    209,133,255,0,180,132,0,133,255,0,20,146,0,2,1,69,179,135,255,0,130,130,0,166,
+    255,1,166,2,142,0,0,24,132,255,0,177,136,0,0,78,132,255,0,38,135,0,0,150,
+    132,255,0,57,135,0,0,64,132,255,0,123,136,0,0,100,132,255,0,116,129,0,0,248,
+    138,255,0,86,133,0,0,244,151,255,128,0,0,253,138,255,0,81,146,0,0,8,139,255,
+    0,72,136,0,0,179,157,255,0,166,136,0,161,255,1,254,102,144,0,0,84,139,255,2,
+    112,0,55,139,255,0,117,137,0,162,255,0,229,131,0,150,255,0,87,149,255,0,80,128,
+    0,0,183,130,255,0,157,141,0,0,244,143,255,128,0,0,191,130,255,0,144,154,0,0,
+    82,131,255,0,8,128,0,131,255,0,80,137,0,1,1,155,132,255,0,118,165,0,1,28,
+    202,148,255,2,245,161,54,139,0,0,245,132,255,0,27,147,0,0,28,132,255,0,242,128,
+    0,133,255,0,20,155,0,133,255,0,20,128,0,164,255,0,128,131,0,133,255,0,20,167,
+    0,0,164,132,255,0,194,139,0,0,89,133,255,0,112,140,0,133,255,0,20,134,0,0,
+    80,134,255,0,56,137,0,133,255,0,20,152,0,0,153,133,255,1,248,37,132,0,133,255,
+    0,20,140,0,6,4,19,34,54,103,156,220,136,255,1,232,15,130,0,165,255,1,164,3,
+    144,0,0,225,131,255,0,226,136,0,0,137,131,255,0,235,136,0,0,92,132,255,0,116,
+    135,0,0,115,132,255,0,66,136,0,0,85,132,255,0,102,129,0,0,236,138,255,0,93,
+    133,0,0,244,151,255,128,0,0,246,138,255,0,88,146,0,0,15,139,255,0,65,135,0,
+    1,11,247,157,255,1,243,8,135,0,160,255,1,247,97,145,0,1,11,247,138,255,2,188,
+    0,133,139,255,0,35,137,0,162,255,0,165,131,0,150,255,0,232,149,255,0,80,128,0,
+    0,146,130,255,0,197,153,0,0,80,131,255,128,0,0,159,130,255,0,182,154,0,0,123,
+    130,255,0,231,129,0,131,255,0,80,138,0,1,3,187,131,255,1,251,55,165,0,2,7,
+    144,253,149,255,1,189,48,137,0,0,250,132,255,0,24,147,0,0,25,132,255,0,247,128,
+    0,133,255,0,20,155,0,133,255,0,20,128,0,164,255,0,128,131,0,133,255,0,20,166,
+    0,1,4,238,132,255,0,116,139,0,1,16,250,132,255,0,198,140,0,133,255,0,20,135,
+    0,0,197,133,255,0,194,137,0,133,255,0,20,151,0,0,96,134,255,0,124,133,0,165,
+    255,0,92,131,0,163,255,2,252,136,2,145,0,0,170,132,255,0,19,135,0,0,196,131,
+    255,0,177,136,0,0,34,132,255,0,175,135,0,0,166,131,255,1,252,12,136,0,0,71,
+    132,255,0,88,129,0,0,225,138,255,0,111,133,0,0,244,151,255,128,0,0,237,138,255,
+    0,99,146,0,0,35,139,255,0,56,135,0,0,84,159,255,0,82,135,0,159,255,1,214,
+    39,147,0,0,177,138,255,2,250,13,211,138,255,0,208,138,0,161,255,1,236,27,131,0,
+    174,255,0,80,128,0,0,110,130,255,1,239,1,152,0,0,80,131,255,128,0,0,116,130,
+    255,0,226,154,0,0,166,130,255,0,189,129,0,131,255,0,80,139,0,1,22,235,131,255,
+    1,221,14,166,0,1,48,183,149,255,2,253,153,14,135,0,0,254,132,255,0,21,147,0,
+    0,22,132,255,0,252,128,0,133,255,0,20,155,0,133,255,0,20,128,0,164,255,0,128,
+    131,0,133,255,0,20,166,0,0,68,133,255,0,39,140,0,0,189,132,255,1,254,28,139,
+    0,133,255,0,20,135,0,0,59,134,255,0,77,136,0,133,255,0,20,150,0,1,56,248,
+    133,255,1,202,4,133,0,164,255,0,166,132,0,162,255,1,211,53,147,0,0,114,132,255,
+    0,67,134,0,1,7,248,131,255,0,119,137,0,0,232,131,255,0,234,135,0,0,217,131,
+    255,0,207,137,0,0,56,132,255,0,74,129,0,0,213,138,255,0,133,133,0,0,244,151,
+    255,128,0,0,221,138,255,0,122,146,0,0,58,139,255,0,35,135,0,0,165,159,255,0,
+    168,135,0,159,255,0,174,148,0,0,95,139,255,0,115,139,255,0,126,138,0,159,255,2,
+    230,166,28,132,0,174,255,0,80,128,0,0,68,131,255,0,44,152,0,0,80,131,255,128,
+    0,0,70,131,255,0,29,153,0,0,225,130,255,0,146,129,0,131,255,0,80,140,0,0,
+    90,132,255,0,160,168,0,2,49,160,247,148,255,1,219,48,134,0,0,254,132,255,0,21,
+    147,0,0,22,132,255,0,253,128,0,133,255,0,20,155,0,133,255,0,20,128,0,164,255,
+    0,128,131,0,133,255,0,20,166,0,0,149,132,255,0,217,141,0,0,112,133,255,0,113,
+    139,0,133,255,0,20,136,0,0,175,133,255,1,213,3,135,0,133,255,0,20,149,0,1,
+    32,232,133,255,1,242,37,134,0,163,255,1,200,12,132,0,160,255,2,197,89,5,148,0,
+    0,59,132,255,0,115,134,0,0,58,132,255,0,61,137,0,0,175,132,255,0,36,133,0,
+    1,14,254,131,255,0,150,137,0,0,41,132,255,0,60,129,0,0,193,138,255,0,168,133,
+    0,0,244,151,255,128,0,0,195,138,255,0,153,146,0,0,95,139,255,0,12,134,0,1,
+    5,240,159,255,1,244,9,134,0,160,255,0,102,147,0,1,18,251,152,255,0,44,138,0,
+    139,255,0,80,154,0,174,255,0,80,128,0,1,10,249,130,255,0,109,152,0,0,80,131,
+    255,128,0,1,13,251,130,255,0,95,152,0,0,34,131,255,0,87,129,0,131,255,0,80,
+    141,0,0,188,131,255,1,254,56,169,0,2,17,107,199,147,255,1,247,78,133,0,0,250,
+    132,255,0,24,147,0,0,25,132,255,0,249,128,0,133,255,0,20,155,0,133,255,0,20,
+    128,0,164,255,0,128,131,0,133,255,0,20,165,0,1,1,227,132,255,0,140,141,0,0,
+    34,133,255,0,198,139,0,133,255,0,20,136,0,1,40,252,133,255,0,99,135,0,133,255,
+    0,20,148,0,1,16,214,134,255,0,90,135,0,162,255,1,199,17,133,0,156,255,3,247,
+    192,130,47,151,0,1,8,250,131,255,0,164,134,0,0,117,131,255,1,250,9,137,0,0,
+    117,132,255,0,92,133,0,0,64,132,255,0,92,137,0,0,26,132,255,0,46,129,0,0,
+    156,138,255,0,209,133,0,0,219,151,255,128,0,0,169,138,255,0,194,146,0,0,136,138,
+    255,0,242,135,0,0,71,161,255,0,84,134,0,160,255,1,245,31,147,0,0,188,151,255,
+    0,218,139,0,139,255,0,80,154,0,174,255,0,80,129,0,0,194,130,255,0,192,152,0,
+    0,80,131,255,129,0,0,200,130,255,0,179,152,0,0,117,131,255,0,27,129,0,131,255,
+    0,80,141,0,1,43,252,131,255,1,201,1,171,0,3,30,112,191,251,144,255,1,249,75,
+    132,0,0,246,132,255,0,27,147,0,0,28,132,255,0,244,128,0,133,255,0,20,155,0,
+    133,255,0,20,128,0,133,255,0,20,162,0,133,255,0,20,165,0,0,53,133,255,0,62,
+    142,0,0,212,132,255,1,254,29,138,0,133,255,0,20,137,0,0,154,133,255,1,228,10,
+    134,0,133,255,0,20,147,0,1,8,194,134,255,0,147,136,0,160,255,2,254,147,6,134,
+    0,155,255,1,228,45,155,0,0,204,131,255,0,212,134,0,0,176,131,255,0,201,138,0,
+    0,59,132,255,0,148,133,0,0,115,132,255,0,35,137,0,0,11,132,255,0,32,129,0,
+    0,119,138,255,1,252,12,132,0,0,155,151,255,128,0,0,131,138,255,1,244,5,145,0,
+    0,194,138,255,0,203,135,0,0,151,161,255,0,170,134,0,139,255,0,80,128,0,3,5,
+    29,110,247,141,255,0,170,147,0,0,107,151,255,0,136,139,0,139,255,0,80,154,0,174,
+    255,0,80,129,0,0,127,130,255,1,253,30,151,0,0,80,131,255,129,0,0,122,130,255,
+    1,249,23,151,0,0,209,130,255,0,208,130,0,131,255,0,80,142,0,0,151,132,255,0,
+    93,174,0,3,16,89,165,238,142,255,1,247,47,131,0,0,241,132,255,0,31,147,0,0,
+    31,132,255,0,239,128,0,133,255,0,20,155,0,133,255,0,20,128,0,133,255,0,20,162,
+    0,133,255,0,20,165,0,0,134,132,255,1,237,3,142,0,0,134,133,255,0,114,138,0,
+    133,255,0,20,137,0,1,25,245,133,255,0,122,134,0,133,255,0,20,146,0,1,3,176,
+    134,255,1,195,5,136,0,159,255,1,191,52,136,0,133,255,0,20,134,0,5,6,16,42,
+    79,139,225,134,255,1,247,105,154,0,0,148,131,255,1,252,8,133,0,0,234,131,255,0,
+    142,138,0,1,7,249,131,255,0,204,133,0,0,166,131,255,0,233,139,0,0,251,131,255,
+    0,19,129,0,0,81,139,255,0,73,132,0,1,22,231,150,255,128,0,0,87,139,255,0,
+    63,144,0,1,12,248,138,255,0,162,134,0,1,1,230,161,255,1,245,10,133,0,139,255,
+    0,80,131,0,1,73,252,141,255,0,62,146,0,1,26,254,150,255,0,54,139,0,139,255,
+    0,80,154,0,174,255,0,80,129,0,0,38,131,255,0,142,151,0,0,80,131,255,129,0,
+    0,37,131,255,0,132,150,0,0,65,131,255,0,125,130,0,131,255,0,80,142,0,1,23,
+    243,131,255,1,224,6,176,0,3,4,64,146,227,140,255,1,215,11,130,0,0,236,132,255,
+    0,37,147,0,0,39,132,255,0,232,128,0,133,255,0,20,155,0,133,255,0,19,128,0,
+    133,255,0,20,162,0,133,255,0,20,165,0,0,214,132,255,0,163,143,0,0,57,133,255,
+    0,199,138,0,133,255,0,20,138,0,0,132,133,255,1,241,20,133,0,133,255,0,20,145,
+    0,1,1,159,134,255,1,223,21,137,0,156,255,2,224,147,46,138,0,133,255,0,20,139,
+    0,2,2,102,242,134,255,1,159,4,152,0,0,93,132,255,0,53,132,0,0,38,132,255,
+    0,84,139,0,0,199,131,255,1,251,9,132,0,0,217,131,255,0,176,139,0,0,238,131,
+    255,0,5,129,0,0,36,139,255,0,157,133,0,2,23,161,228,148,255,128,0,0,40,139,
+    255,0,159,144,0,0,87,139,255,0,116,134,0,0,57,163,255,0,86,133,0,139,255,0,
+    80,132,0,0,125,141,255,1,207,2,146,0,0,200,149,255,1,226,1,139,0,139,255,0,
+    80,154,0,174,255,0,80,130,0,0,191,130,255,1,245,29,150,0,0,80,131,255,130,0,
+    0,195,130,255,1,242,24,149,0,0,197,130,255,1,254,35,130,0,131,255,0,80,143,0,
+    0,128,132,255,0,105,179,0,3,1,58,145,233,138,255,0,136,130,0,0,224,132,255,0,
+    48,147,0,0,50,132,255,0,218,128,0,0,252,132,255,0,21,154,0,0,3,133,255,0,
+    14,128,0,133,255,0,20,162,0,133,255,0,20,164,0,0,38,133,255,0,86,143,0,1,
+    2,232,132,255,1,254,30,137,0,133,255,0,20,138,0,1,14,235,133,255,0,144,133,0,
+    133,255,0,20,145,0,0,148,134,255,1,241,44,138,0,148,255,7,250,242,231,206,179,143,
+    94,41,141,0,133,255,0,20,141,0,1,39,222,134,255,1,175,4,151,0,0,37,132,255,
+    0,102,132,0,0,97,132,255,0,26,139,0,0,141,132,255,0,61,131,0,1,13,254,131,
+    255,0,119,139,0,0,223,130,255,0,247,131,0,0,227,138,255,1,244,17,143,0,0,80,
+    139,255,129,0,0,233,138,255,1,245,15,143,0,0,191,139,255,0,56,134,0,0,138,163,
+    255,0,172,133,0,139,255,0,80,132,0,1,4,205,141,255,0,94,146,0,0,118,149,255,
+    0,145,140,0,139,255,0,80,154,0,139,255,0,244,146,255,0,247,139,255,0,80,130,0,
+    0,88,131,255,0,174,150,0,0,80,131,255,130,0,0,85,131,255,0,166,148,0,0,94,
+    131,255,0,182,131,0,131,255,0,80,143,0,1,13,235,131,255,1,228,7,181,0,2,5,
+    81,189,136,255,1,245,23,129,0,0,210,132,255,0,59,147,0,0,60,132,255,0,203,128,
+    0,0,247,132,255,0,23,154,0,0,8,133,255,0,8,128,0,133,255,0,20,162,0,133,
+    255,0,20,164,0,0,119,133,255,0,246,144,244,0,253,133,255,0,114,137,0,133,255,0,
+    20,139,0,0,110,133,255,1,249,33,132,0,133,255,0,20,144,0,0,137,134,255,1,250,
+    69,139,0,133,255,0,20,163,0,133,255,0,20,142,0,1,30,224,134,255,0,141,152,0,
+    0,236,131,255,0,151,132,0,0,156,131,255,0,224,140,0,0,83,132,255,0,115,131,0,
+    0,63,132,255,0,61,139,0,0,208,130,255,0,233,131,0,0,160,139,255,0,135,143,0,
+    0,80,139,255,129,0,0,170,139,255,0,134,142,0,0,60,139,255,1,246,5,134,0,0,
+    218,163,255,1,246,11,132,0,139,255,0,80,133,0,1,53,254,140,255,1,220,4,145,0,
+    0,37,149,255,0,63,140,0,139,255,0,80,154,0,139,255,0,178,146,255,0,182,139,255,
+    0,80,130,0,1,4,216,131,255,0,107,149,0,0,97,131,255,130,0,1,3,216,131,255,
+    0,97,146,0,1,35,241,131,255,0,67,131,0,131,255,0,80,144,0,0,114,132,255,0,
+    110,184,0,1,58,207,135,255,0,136,129,0,0,195,132,255,0,70,147,0,0,71,132,255,
+    0,189,128,0,0,241,132,255,0,28,154,0,0,13,133,255,0,2,128,0,133,255,0,20,
+    162,0,133,255,0,20,164,0,0,199,160,255,0,200,137,0,133,255,0,20,139,0,1,6,
+    221,133,255,0,167,132,0,133,255,0,20,143,0,0,132,135,255,0,96,140,0,133,255,0,
+    20,163,0,133,255,0,20,143,0,1,44,242,133,255,1,254,76,151,0,0,182,131,255,0,
+    199,132,0,0,215,131,255,0,166,140,0,0,24,132,255,0,164,131,0,0,115,131,255,1,
+    251,9,139,0,0,193,130,255,0,219,131,0,0,92,139,255,1,248,47,142,0,0,80,139,
+    255,129,0,0,94,139,255,1,251,50,140,0,1,6,208,139,255,0,179,134,0,0,43,165,
+    255,0,88,132,0,139,255,0,80,134,0,0,158,141,255,0,99,146,0,0,211,147,255,1,
+    234,3,140,0,139,255,0,80,154,0,139,255,0,106,146,255,0,108,139,255,0,80,131,0,
+    0,79,131,255,1,251,80,147,0,1,72,244,131,255,131,0,0,84,131,255,1,249,67,144,
+    0,1,20,217,131,255,0,189,132,0,131,255,0,80,144,0,1,8,228,131,255,1,231,9,
+    184,0,1,4,146,134,255,1,225,1,128,0,0,180,132,255,0,88,147,0,0,90,132,255,
+    0,170,128,0,0,235,132,255,0,36,154,0,0,23,132,255,0,251,129,0,133,255,0,20,
+    162,0,133,255,0,20,163,0,1,25,254,161,255,0,30,136,0,133,255,0,20,140,0,0,
+    89,133,255,1,254,51,131,0,133,255,0,20,142,0,0,128,135,255,0,122,141,0,133,255,
+    0,20,163,0,133,255,0,20,144,0,0,85,134,255,1,236,27,150,0,0,127,131,255,1,
+    245,2,130,0,1,19,254,131,255,0,107,141,0,0,223,131,255,0,214,131,0,0,166,131,
+    255,0,203,140,0,0,178,130,255,0,205,131,0,1,19,248,139,255,1,222,30,141,0,0,
+    103,139,255,129,0,1,14,248,139,255,1,216,19,139,0,0,154,140,255,0,95,134,0,0,
+    124,165,255,0,174,132,0,139,255,0,80,134,0,1,25,244,140,255,1,224,5,145,0,0,
+    130,147,255,0,155,141,0,139,255,0,80,154,0,139,255,1,80,209,145,255,0,34,139,255,
+    0,80,132,0,0,190,131,255,1,249,95,144,0,2,5,129,253,132,255,132,0,0,190,131,
+    255,1,244,72,142,0,1,25,210,131,255,1,251,49,132,0,131,255,0,80,145,0,0,103,
+    132,255,0,115,186,0,0,136,134,255,0,57,128,0,0,160,132,255,0,107,147,0,0,110,
+    132,255,0,144,128,0,0,223,132,255,0,47,154,0,0,38,132,255,0,243,129,0,133,255,
+    0,20,162,0,133,255,0,20,163,0,0,104,162,255,0,115,136,0,133,255,0,20,140,0,
+    1,1,204,133,255,0,189,131,0,133,255,0,20,141,0,0,120,135,255,0,145,142,0,133,
+    255,0,20,163,0,133,255,0,20,145,0,0,162,134,255,1,194,3,149,0,0,71,132,255,
+    0,40,130,0,0,77,132,255,0,49,141,0,0,165,131,255,1,253,11,130,0,0,217,131,
+    255,0,145,140,0,0,163,130,255,0,191,132,0,0,166,140,255,1,225,37,139,0,0,81,
+    140,255,130,0,0,172,140,255,1,204,21,136,0,1,1,142,140,255,1,248,17,134,0,0,
+    205,139,255,0,85,137,0,0,156,139,255,1,247,12,131,0,139,255,0,80,135,0,0,129,
+    141,255,0,104,145,0,0,49,147,255,0,73,141,0,139,255,0,80,154,0,139,255,1,80,
+    137,144,255,1,216,0,139,255,0,80,132,0,1,30,238,132,255,1,153,13,141,0,1,71,
+    213,134,255,132,0,1,36,246,131,255,2,251,120,2,139,0,1,62,227,132,255,0,133,133,
+    0,131,255,0,80,145,0,1,4,220,131,255,1,234,11,185,0,1,1,189,133,255,0,118,
+    128,0,0,134,132,255,0,127,147,0,0,129,132,255,0,118,128,0,0,205,132,255,0,61,
+    154,0,0,53,132,255,0,224,129,0,133,255,0,20,162,0,133,255,0,20,163,0,0,184,
+    162,255,0,200,136,0,133,255,0,20,141,0,0,67,134,255,0,72,130,0,133,255,0,20,
+    140,0,0,112,135,255,1,163,1,142,0,133,255,0,20,163,0,133,255,0,20,145,0,1,
+    18,232,134,255,0,118,149,0,1,17,254,131,255,0,88,130,0,0,136,131,255,1,243,3,
+    141,0,0,107,132,255,0,57,129,0,1,13,254,131,255,0,88,140,0,0,149,130,255,0,
+    178,132,0,0,63,141,255,2,243,119,6,135,0,1,66,191,141,255,130,0,0,65,141,255,
+    1,226,67,134,0,1,28,182,141,255,0,161,134,0,0,30,139,255,1,250,14,137,0,0,
+    74,140,255,0,90,131,0,139,255,0,80,135,0,1,13,234,140,255,1,227,7,145,0,0,
+    222,145,255,1,240,6,141,0,161,255,2,249,203,97,130,0,139,255,1,80,64,144,255,1,
+    142,0,139,255,0,80,133,0,0,80,133,255,2,231,110,13,136,0,2,7,87,199,135,255,
+    0,139,133,0,0,98,133,255,1,204,68,136,0,2,33,159,254,132,255,1,200,6,133,0,
+    131,255,0,80,146,0,0,91,132,255,0,120,186,0,1,42,253,132,255,0,165,128,0,0,
+    107,132,255,0,152,147,0,0,156,132,255,0,92,128,0,0,187,132,255,0,79,154,0,0,
+    77,132,255,0,202,129,0,133,255,0,20,162,0,133,255,0,20,162,0,1,14,249,163,255,
+    0,31,135,0,133,255,0,20,142,0,0,184,133,255,1,209,2,129,0,133,255,0,20,139,
+    0,1,95,254,134,255,1,174,4,143,0,133,255,0,20,163,0,133,255,0,20,146,0,0,
+    91,134,255,1,242,25,149,0,0,217,131,255,0,135,130,0,0,194,131,255,0,189,142,0,
+    0,49,132,255,0,107,129,0,0,63,132,255,0,30,140,0,0,134,130,255,0,164,133,0,
+    0,213,142,255,9,229,150,74,38,15,5,23,67,132,217,143,255,131,0,0,209,142,255,8,
+    195,104,43,16,10,36,80,166,246,142,255,0,53,134,0,0,110,139,255,0,188,138,0,1,
+    7,242,139,255,0,176,131,0,139,255,0,80,136,0,0,112,141,255,0,109,145,0,0,142,
+    145,255,0,164,142,0,164,255,0,135,129,0,139,255,2,80,5,242,143,255,1,68,0,139,
+    255,0,80,134,0,0,122,134,255,11,244,168,102,55,22,7,4,19,52,98,165,237,135,255,
+    1,253,111,135,0,0,154,134,255,10,213,130,67,26,7,4,19,54,108,184,253,133,255,1,
+    231,26,134,0,131,255,0,80,146,0,1,2,210,131,255,1,236,13,149,0,4,45,74,102,
+    130,158,128,186,156,0,0,184,132,255,0,208,128,0,0,80,132,255,0,183,147,0,0,186,
+    132,255,0,57,128,0,0,168,132,255,0,103,154,0,0,105,132,255,0,181,129,0,133,255,
+    0,20,162,0,133,255,0,20,162,0,0,89,164,255,0,116,135,0,133,255,0,20,142,0,
+    1,47,253,133,255,0,94,129,0,133,255,0,20,138,0,1,77,252,134,255,1,185,6,144,
+    0,133,255,0,20,163,0,133,255,0,20,147,0,0,191,134,255,0,161,149,0,0,161,131,
+    255,0,182,129,0,1,2,244,131,255,0,131,142,0,1,3,243,131,255,0,155,129,0,0,
+    114,131,255,0,229,141,0,0,119,130,255,0,150,133,0,0,81,169,255,131,0,0,82,166,
+    255,0,187,135,0,0,191,139,255,0,111,139,0,0,168,139,255,1,248,13,130,0,139,255,
+    0,80,136,0,1,7,227,140,255,1,230,9,144,0,0,60,145,255,0,82,142,0,164,255,
+    1,253,39,128,0,139,255,2,80,0,175,142,255,2,243,6,0,139,255,0,80,135,0,0,
+    127,153,255,1,235,71,136,0,1,4,173,150,255,1,235,46,135,0,131,255,0,80,147,0,
+    0,79,132,255,0,124,149,0,0,250,131,255,1,252,5,155,0,0,105,132,255,0,227,128,
+    0,0,45,132,255,0,214,147,0,0,216,132,255,0,19,128,0,0,139,132,255,0,131,154,
+    0,0,134,132,255,0,159,129,0,133,255,0,20,162,0,133,255,0,20,162,0,0,169,132,
+    255,0,221,149,0,0,77,133,255,0,201,135,0,133,255,0,20,143,0,0,162,133,255,1,
+    225,8,128,0,133,255,0,20,137,0,1,53,245,134,255,1,192,9,145,0,133,255,0,20,
+    163,0,133,255,0,20,147,0,1,46,252,133,255,1,254,55,148,0,0,106,131,255,0,228,
+    129,0,0,42,132,255,0,72,143,0,0,189,131,255,0,198,129,0,0,165,131,255,0,172,
+    141,0,0,104,130,255,0,136,134,0,0,193,168,255,132,0,0,201,164,255,1,254,52,134,
+    0,1,19,252,139,255,0,35,139,0,0,87,140,255,0,92,130,0,139,255,0,80,137,0,
+    0,102,141,255,0,114,144,0,1,2,232,143,255,1,245,10,142,0,165,255,0,101,128,0,
+    139,255,2,80,0,103,142,255,0,176,128,0,139,255,0,80,136,0,1,108,249,150,255,1,
+    191,29,138,0,1,5,170,148,255,1,229,46,136,0,131,255,0,80,148,0,0,200,131,255,
+    1,239,15,148,0,0,241,132,255,0,37,155,0,0,56,132,255,0,242,128,0,1,7,253,
+    131,255,1,248,4,145,0,1,5,250,131,255,0,236,129,0,0,107,132,255,0,165,154,0,
+    0,177,132,255,0,126,129,0,133,255,0,20,162,0,133,255,0,20,161,0,1,7,242,132,
+    255,0,146,149,0,1,8,244,133,255,0,32,134,0,133,255,0,20,143,0,1,31,248,133,
+    255,0,117,128,0,133,255,0,20,136,0,1,31,232,134,255,1,199,12,146,0,133,255,0,
+    20,163,0,133,255,0,20,148,0,0,153,134,255,1,201,1,147,0,0,50,132,255,0,19,
+    128,0,0,92,131,255,1,254,16,143,0,0,131,131,255,0,241,129,0,0,214,131,255,0,
+    114,141,0,0,89,130,255,0,122,134,0,1,53,254,166,255,0,234,132,0,1,56,253,163,
+    255,0,162,135,0,0,97,139,255,0,214,140,0,1,13,248,139,255,0,178,130,0,139,255,
+    0,80,137,0,1,4,219,140,255,1,233,10,144,0,0,153,143,255,0,174,143,0,165,255,
+    0,128,128,0,139,255,2,80,0,30,142,255,0,101,128,0,139,255,0,80,137,0,1,52,
+    220,147,255,2,238,100,1,140,0,2,1,125,253,145,255,1,196,24,137,0,131,255,0,80,
+    148,0,0,67,132,255,0,129,148,0,0,228,132,255,0,90,155,0,0,31,132,255,0,251,
+    129,0,0,220,132,255,0,41,145,0,0,45,132,255,0,192,129,0,0,75,132,255,0,207,
+    154,0,0,220,132,255,0,86,129,0,133,255,0,20,162,0,133,255,0,20,161,0,0,74,
+    133,255,0,71,150,0,0,173,133,255,0,116,134,0,133,255,0,20,144,0,0,141,133,255,
+    2,238,17,0,133,255,0,20,135,0,1,10,208,134,255,1,206,16,147,0,133,255,0,20,
+    163,0,133,255,0,20,148,0,1,22,242,134,255,0,84,147,0,1,4,246,131,255,0,65,
+    128,0,0,143,131,255,0,212,144,0,0,73,132,255,3,28,0,9,252,131,255,0,57,141,
+    0,0,74,130,255,0,108,135,0,0,138,166,255,0,174,133,0,0,147,162,255,1,233,19,
+    135,0,0,177,139,255,0,137,141,0,0,180,139,255,1,248,15,129,0,139,255,0,80,138,
+    0,0,90,141,255,0,118,144,0,0,72,143,255,0,92,143,0,165,255,0,128,128,0,139,
+    255,0,80,128,0,0,214,141,255,0,28,128,0,139,255,0,80,138,0,2,8,118,238,143,
+    255,2,242,131,16,144,0,1,53,206,142,255,2,241,110,3,138,0,131,255,0,80,149,0,
+    0,189,131,255,1,241,18,147,0,0,200,132,255,0,150,155,0,0,27,132,255,0,237,129,
+    0,0,176,132,255,0,87,145,0,0,92,132,255,0,138,129,0,0,33,132,255,1,250,8,
+    152,0,0,22,133,255,0,46,129,0,133,255,0,20,162,0,133,255,0,20,161,0,0,154,
+    132,255,1,244,7,150,0,0,93,133,255,0,202,134,0,133,255,0,20,144,0,1,18,239,
+    133,255,1,139,0,133,255,0,20,135,0,0,168,134,255,1,215,21,148,0,133,255,0,20,
+    163,0,133,255,0,20,149,0,0,123,134,255,1,214,2,147,0,0,195,131,255,0,112,128,
+    0,0,194,131,255,0,154,144,0,1,16,254,131,255,2,70,0,54,131,255,1,248,7,141,
+    0,0,59,130,255,0,94,135,0,1,5,200,164,255,1,244,36,133,0,1,11,213,160,255,
+    1,254,79,135,0,1,11,246,139,255,0,61,141,0,0,99,140,255,0,94,129,0,139,255,
+    0,80,138,0,1,1,210,140,255,1,236,13,143,0,1,5,240,141,255,1,249,15,143,0,
+    165,255,0,128,128,0,139,255,0,80,128,0,0,141,140,255,0,209,129,0,139,255,0,80,
+    140,0,2,17,114,207,139,255,2,206,107,15,147,0,2,2,83,198,138,255,2,230,124,19,
+    140,0,131,255,0,80,149,0,0,55,132,255,0,134,147,0,0,169,132,255,0,220,155,0,
+    0,50,132,255,0,222,129,0,0,121,132,255,0,147,145,0,0,153,132,255,0,84,130,0,
+    0,239,132,255,0,66,152,0,0,85,132,255,1,252,8,129,0,133,255,0,20,162,0,133,
+    255,0,20,160,0,1,2,232,132,255,0,176,151,0,1,17,251,133,255,0,32,133,0,133,
+    255,0,20,145,0,0,119,133,255,1,248,30,133,255,0,20,134,0,0,107,134,255,1,225,
+    28,149,0,133,255,0,20,163,0,133,255,0,20,149,0,1,9,229,134,255,0,93,147,0,
+    0,140,131,255,3,157,0,1,242,131,255,0,96,145,0,0,213,131,255,2,113,0,101,131,
+    255,0,198,158,0,1,32,237,162,255,1,240,63,135,0,1,39,242,159,255,0,132,136,0,
+    0,83,139,255,1,237,3,141,0,1,21,252,139,255,0,180,129,0,139,255,0,80,139,0,
+    0,78,141,255,0,123,144,0,0,165,141,255,0,183,144,0,165,255,0,128,128,0,139,255,
+    0,80,128,0,0,69,140,255,0,135,129,0,139,255,0,80,143,0,12,40,102,155,202,223,
+    240,252,243,228,196,154,99,28,153,0,12,30,108,162,206,233,247,251,238,218,177,129,57,2,
+    200,0,0,126,133,255,0,56,154,0,0,75,132,255,0,197,129,0,0,63,132,255,0,210,
+    145,0,0,215,132,255,0,26,130,0,0,190,132,255,0,149,152,0,0,165,132,255,0,204,
+    130,0,133,255,0,20,162,0,133,255,0,20,160,0,0,59,133,255,0,100,152,0,0,189,
+    133,255,0,117,133,0,133,255,0,20,145,0,1,8,227,133,255,0,162,133,255,0,20,133,
+    0,1,45,248,133,255,1,235,39,150,0,133,255,0,20,163,0,133,255,0,20,150,0,0,
+    101,134,255,1,221,4,146,0,0,84,131,255,2,197,0,39,132,255,0,37,145,0,0,155,
+    131,255,2,155,0,148,131,255,0,141,159,0,1,51,239,160,255,1,228,45,137,0,1,78,
+    252,157,255,1,178,2,136,0,0,164,139,255,0,164,143,0,0,192,139,255,1,249,16,128,
+    0,139,255,0,80,140,0,0,199,140,255,1,238,15,143,0,0,83,141,255,0,101,144,0,
+    165,255,0,128,128,0,139,255,0,80,128,0,1,7,244,139,255,0,61,129,0,139,255,0,
+    80,255,0,141,0,0,72,133,255,0,160,154,0,0,141,132,255,0,149,129,0,1,10,249,
+    132,255,0,33,143,0,0,39,132,255,0,210,131,0,0,131,132,255,1,243,15,150,0,1,
+    12,244,132,255,0,141,130,0,133,255,0,20,162,0,133,255,0,20,160,0,0,139,132,255,
+    1,254,26,152,0,0,109,133,255,0,203,133,0,133,255,0,20,146,0,0,97,133,255,0,
+    253,133,255,0,20,132,0,1,6,208,133,255,1,245,54,151,0,133,255,0,20,163,0,133,
+    255,0,20,150,0,1,3,215,134,255,0,102,146,0,0,29,131,255,2,237,0,90,131,255,
+    0,234,146,0,0,97,131,255,2,191,0,194,131,255,0,83,160,0,1,53,240,158,255,1,
+    193,26,139,0,1,90,253,155,255,1,184,8,137,0,0,229,139,255,0,87,143,0,0,111,
+    140,255,0,76,128,0,139,255,0,80,140,0,0,66,141,255,0,115,143,0,1,11,246,139,
+    255,1,253,22,144,0,165,255,0,128,128,0,139,255,0,80,129,0,0,180,138,255,1,239,
+    3,129,0,139,255,0,80,255,0,141,0,1,15,251,132,255,1,252,41,153,0,0,220,132,
+    255,0,100,130,0,0,185,132,255,0,120,143,0,0,127,132,255,0,139,131,0,0,61,133,
+    255,0,123,150,0,0,116,133,255,0,78,130,0,133,255,0,20,162,0,133,255,0,20,160,
+    0,0,219,132,255,0,205,153,0,0,29,134,255,0,33,132,0,133,255,0,20,146,0,1,
+    2,211,140,255,0,20,132,0,0,124,133,255,1,254,79,152,0,133,255,0,20,163,0,133,
+    255,0,20,151,0,0,82,134,255,1,226,7,146,0,0,229,131,255,1,21,141,131,255,0,
+    177,146,0,0,39,131,255,2,227,0,239,131,255,0,26,161,0,1,50,221,155,255,2,254,
+    136,3,141,0,1,90,248,153,255,1,179,8,138,0,0,249,138,255,1,251,15,143,0,0,
+    30,140,255,0,100,128,0,139,255,0,80,141,0,0,188,140,255,0,181,144,0,0,176,139,
+    255,0,193,145,0,0,230,164,255,0,101,128,0,0,230,138,255,0,53,129,0,0,107,138,
+    255,0,169,130,0,0,230,138,255,0,53,255,0,142,0,0,187,133,255,1,197,4,151,0,
+    0,82,133,255,0,34,130,0,0,106,132,255,1,226,5,141,0,1,8,231,132,255,0,59,
+    131,0,1,4,241,132,255,1,246,35,148,0,1,20,234,132,255,1,245,13,130,0,133,255,
+    0,20,162,0,133,255,0,20,159,0,0,44,133,255,0,130,154,0,0,205,133,255,0,118,
+    132,0,133,255,0,20,147,0,0,76,140,255,0,20,131,0,1,33,247,133,255,0,128,153,
+    0,133,255,0,20,163,0,133,255,0,20,152,0,0,200,134,255,0,111,146,0,0,174,131,
+    255,1,61,192,131,255,0,119,147,0,0,236,130,255,1,254,35,131,255,0,225,163,0,1,
+    15,171,153,255,1,211,57,144,0,1,56,230,150,255,2,254,131,2,139,0,0,221,138,255,
+    0,187,145,0,0,202,139,255,0,69,128,0,0,230,138,255,0,53,141,0,0,55,140,255,
+    0,182,144,0,0,95,139,255,0,110,145,0,0,167,163,255,1,253,40,128,0,0,167,137,
+    255,1,238,7,129,0,1,23,247,137,255,0,75,130,0,0,167,137,255,1,238,7,255,0,
+    142,0,0,101,134,255,0,144,150,0,1,8,223,132,255,0,203,131,0,1,26,252,132,255,
+    0,106,141,0,0,114,132,255,0,221,133,0,0,158,133,255,1,203,11,146,0,1,2,176,
+    133,255,0,160,131,0,133,255,0,20,162,0,133,255,0,20,159,0,0,124,133,255,0,55,
+    154,0,0,125,133,255,0,203,132,0,133,255,0,20,148,0,0,193,139,255,0,20,131,0,
+    0,166,133,255,1,198,3,153,0,133,255,0,20,163,0,133,255,0,20,152,0,0,64,134,
+    255,1,232,10,145,0,0,118,131,255,1,103,241,131,255,0,61,147,0,0,179,131,255,0,
+    112,131,255,0,167,165,0,1,94,227,149,255,2,235,116,5,146,0,1,23,167,148,255,1,
+    220,70,141,0,0,113,138,255,0,71,145,0,0,84,138,255,1,217,1,128,0,0,167,137,
+    255,1,238,7,142,0,0,175,139,255,0,115,144,0,1,14,239,137,255,1,246,23,145,0,
+    1,28,237,162,255,0,136,129,0,1,28,237,135,255,1,254,89,131,0,0,118,136,255,0,
+    177,131,0,1,28,237,135,255,1,254,89,255,0,143,0,1,11,239,134,255,0,135,148,0,
+    1,2,169,133,255,0,115,132,0,0,175,132,255,1,240,26,139,0,1,29,242,132,255,0,
+    128,133,0,0,60,134,255,1,185,11,144,0,1,3,156,134,255,0,62,131,0,133,255,0,
+    20,162,0,133,255,0,20,159,0,0,205,132,255,1,233,2,154,0,0,45,134,255,0,33,
+    131,0,133,255,0,20,148,0,0,55,139,255,0,20,130,0,1,39,254,132,255,1,244,35,
+    154,0,133,255,0,20,163,0,133,255,0,20,153,0,0,183,134,255,0,119,145,0,0,63,
+    131,255,0,179,131,255,1,249,8,147,0,0,121,131,255,0,190,131,255,0,110,166,0,2,
+    8,118,237,145,255,2,230,122,12,150,0,1,70,203,144,255,2,237,125,8,142,0,1,1,
+    139,135,255,1,249,113,147,0,1,125,252,135,255,1,213,31,129,0,1,28,237,135,255,1,
+    254,89,143,0,1,18,211,137,255,1,185,9,145,0,0,100,137,255,0,115,147,0,2,28,
+    167,230,157,255,2,249,205,98,131,0,2,28,167,230,131,255,2,243,193,67,133,0,2,90,
+    206,248,130,255,3,253,220,125,7,132,0,2,28,167,230,131,255,2,243,193,67,255,0,145,
+    0,0,136,135,255,1,171,13,145,0,1,3,156,133,255,1,239,14,132,0,0,68,133,255,
+    1,195,5,137,0,1,5,197,132,255,1,248,24,134,0,0,209,134,255,1,213,42,142,0,
+    1,31,189,134,255,0,203,132,0,133,255,0,20,162,0,133,255,0,20,158,0,0,29,133,
+    255,0,160,156,0,0,220,133,255,0,118,131,0,133,255,0,20,149,0,0,171,138,255,0,
+    20,130,0,0,155,133,255,0,127,155,0,133,255,0,20,163,0,133,255,0,20,153,0,1,
+    48,254,133,255,1,237,14,144,0,1,11,252,130,255,0,250,131,255,0,200,148,0,0,63,
+    131,255,0,251,131,255,0,52,142,0,134,255,144,0,3,8,86,179,250,139,255,3,243,176,
+    79,4,154,0,2,65,171,244,138,255,3,254,204,107,10,146,0,1,40,102,131,128,2,127,
+    102,32,149,0,2,36,104,127,131,128,2,120,66,8,131,0,2,28,167,230,131,255,2,243,
+    193,67,145,0,2,24,167,237,133,255,2,231,144,7,147,0,2,78,200,246,131,255,2,248,
+    205,87,255,0,255,0,1,15,235,135,255,1,225,85,143,0,1,37,200,134,255,0,128,134,
+    0,0,197,133,255,1,173,5,135,0,1,3,168,133,255,0,154,135,0,0,79,135,255,2,
+    251,150,31,138,0,2,30,139,245,135,255,0,58,132,0,133,255,0,20,162,0,133,255,0,
+    20,158,0,0,109,133,255,0,84,156,0,0,141,133,255,0,204,131,0,133,255,0,20,149,
+    0,1,37,251,137,255,0,20,129,0,1,23,248,132,255,1,229,10,155,0,133,255,0,20,
+    163,0,133,255,0,20,154,0,0,165,134,255,0,128,145,0,0,208,136,255,0,142,148,0,
+    1,9,250,135,255,1,246,5,142,0,134,255,147,0,14,17,71,123,174,207,223,240,252,243,
+    229,207,166,123,65,6,159,0,13,8,74,130,176,215,232,247,251,238,223,191,147,98,26,255,
+    0,255,0,255,0,145,0,0,98,137,255,2,203,91,6,138,0,2,41,147,245,134,255,1,
+    226,14,134,0,1,54,254,133,255,1,197,34,133,0,1,24,186,133,255,1,246,31,136,0,
+    0,195,136,255,13,254,195,121,72,32,15,2,8,19,46,80,132,199,254,136,255,0,164,133,
+    0,168,255,128,0,161,255,131,0,0,190,132,255,1,250,14,156,0,0,61,134,255,0,34,
+    130,0,133,255,0,20,150,0,0,149,137,255,0,20,129,0,0,116,161,255,0,20,128,0,
+    133,255,0,20,163,0,133,255,0,20,154,0,1,34,250,133,255,1,241,19,144,0,0,152,
+    136,255,0,84,149,0,0,203,135,255,0,194,143,0,134,255,255,0,255,0,255,0,229,0,
+    0,172,138,255,12,243,175,110,67,30,14,3,13,29,46,87,143,201,137,255,0,70,136,0,
+    0,149,134,255,8,248,152,64,12,0,5,50,136,241,134,255,0,125,137,0,1,34,242,158,
+    255,1,217,17,133,0,168,255,128,0,161,255,130,0,1,18,251,132,255,0,189,157,0,1,
+    2,233,133,255,0,119,130,0,133,255,0,20,150,0,1,23,243,136,255,0,20,129,0,0,
+    203,161,255,0,20,128,0,133,255,0,20,163,0,133,255,0,20,155,0,0,147,134,255,0,
+    137,144,0,0,97,136,255,0,26,149,0,0,145,135,255,0,136,143,0,134,255,255,0,255,
+    0,255,0,229,0,1,16,211,160,255,0,144,137,0,1,8,211,137,255,0,248,137,255,1,
+    207,7,138,0,1,85,253,156,255,1,239,39,134,0,168,255,128,0,161,255,130,0,0,94,
+    133,255,0,114,158,0,0,157,133,255,0,205,130,0,133,255,0,20,151,0,0,128,136,255,
+    0,20,128,0,0,33,162,255,0,20,128,0,133,255,0,20,163,0,133,255,0,20,155,0,
+    1,22,243,133,255,1,245,24,143,0,0,41,135,255,0,223,150,0,0,87,135,255,0,79,
+    143,0,134,255,255,0,255,0,255,0,230,0,1,27,224,158,255,1,175,2,138,0,1,34,
+    232,147,255,1,241,35,140,0,0,102,155,255,1,238,60,135,0,168,255,128,0,161,255,130,
+    0,0,175,133,255,0,39,158,0,0,77,134,255,0,34,129,0,133,255,0,20,151,0,1,
+    12,232,135,255,0,20,128,0,0,99,162,255,0,20,128,0,133,255,0,20,163,0,133,255,
+    0,20,156,0,0,128,134,255,0,146,143,0,1,1,240,134,255,0,165,150,0,0,29,135,
+    255,0,22,143,0,134,255,255,0,255,0,255,0,231,0,1,27,211,156,255,1,182,9,140,
+    0,1,50,238,145,255,1,244,62,142,0,1,86,245,152,255,1,221,39,136,0,168,255,128,
+    0,161,255,129,0,1,9,245,132,255,0,219,159,0,1,8,244,133,255,0,120,129,0,133,
+    255,0,20,152,0,0,106,135,255,0,20,128,0,0,154,162,255,0,20,128,0,133,255,0,
+    20,163,0,133,255,0,20,156,0,1,13,234,133,255,1,248,29,143,0,0,186,134,255,0,
+    107,151,0,0,227,133,255,0,220,144,0,134,255,255,0,255,0,255,0,232,0,1,15,172,
+    154,255,1,145,3,142,0,1,41,224,143,255,1,236,62,144,0,1,46,204,150,255,1,167,
+    20,137,0,168,255,128,0,161,255,129,0,0,79,133,255,0,144,160,0,0,173,133,255,0,
+    205,129,0,133,255,0,20,152,0,1,4,218,134,255,0,20,128,0,0,204,162,255,0,20,
+    128,0,133,255,0,20,163,0,133,255,0,20,157,0,0,110,134,255,0,155,143,0,0,131,
+    134,255,0,49,151,0,0,169,133,255,0,163,144,0,134,255,255,0,255,0,255,0,234,0,
+    1,97,234,150,255,1,227,81,145,0,1,18,167,141,255,1,194,29,146,0,2,3,106,225,
+    146,255,1,210,63,139,0,168,255,128,0,161,255,129,0,0,160,133,255,0,68,160,0,0,
+    93,134,255,0,35,128,0,133,255,0,20,153,0,0,84,134,255,0,20,128,0,0,227,162,
+    255,0,20,128,0,133,255,0,20,163,0,133,255,0,20,157,0,1,6,222,133,255,1,251,
+    35,142,0,0,75,133,255,1,243,3,151,0,0,111,133,255,0,105,144,0,134,255,255,0,
+    255,0,255,0,235,0,2,15,134,239,146,255,2,238,134,13,148,0,1,65,193,137,255,1,
+    209,84,150,0,3,4,88,179,249,140,255,3,244,160,63,1,140,0,168,255,128,0,161,255,
+    128,0,1,3,236,132,255,1,243,6,160,0,1,17,251,133,255,0,121,128,0,133,255,0,
+    20,154,0,0,200,133,255,0,20,128,0,0,246,162,255,0,20,128,0,133,255,0,20,163,
+    0,133,128,0,10,158,0,0,63,134,128,0,65,142,0,0,20,133,255,0,189,152,0,0,
+    53,133,255,0,48,144,0,134,255,255,0,255,0,255,0,237,0,3,10,101,187,251,140,255,
+    3,251,194,105,11,152,0,10,37,121,177,222,241,252,240,222,179,126,47,155,0,6,13,69,
+    125,169,200,228,241,128,250,6,235,219,202,166,113,61,10,255,0,255,0,255,0,255,0,255,
+    0,255,0,255,0,146,0,15,16,73,127,170,201,229,242,251,250,239,226,207,169,129,81,15,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,200,0,
+    0,82,131,128,0,51,152,0,0,110,130,128,0,107,144,0,1,8,244,131,255,0,90,145,
+    0,134,255,0,123,149,0,0,77,133,255,0,80,128,0,156,255,0,128,141,0,8,4,48,
+    90,113,123,108,88,42,1,150,0,7,16,71,95,115,122,109,81,38,151,0,7,10,62,97,
+    115,119,98,73,17,146,0,9,2,75,152,211,235,248,226,196,125,42,144,0,9,16,101,176,
+    224,246,245,221,179,102,18,140,0,2,81,213,253,139,255,2,241,171,25,137,0,9,25,117,
+    187,230,250,242,218,161,86,4,143,0,9,3,75,160,214,242,251,235,194,127,35,143,0,9,
+    12,89,166,214,238,247,225,195,126,45,145,0,6,88,221,254,255,250,200,59,129,0,2,6,
+    135,229,145,255,2,229,135,6,128,0,2,6,135,229,144,255,2,229,135,6,128,0,2,6,
+    135,229,131,255,2,251,205,65,137,0,2,4,137,233,131,255,2,229,135,6,128,0,2,6,
+    135,229,129,255,2,250,200,59,137,0,3,56,132,198,224,128,247,3,227,186,120,30,148,0,
+    2,23,171,239,128,255,2,250,200,59,133,0,2,6,135,229,137,255,5,245,230,196,148,76,
+    4,135,0,2,6,135,229,129,255,2,250,200,59,138,0,7,2,45,94,115,120,99,58,4,
+    143,0,7,4,57,96,116,122,107,72,20,146,0,6,31,82,113,123,108,81,25,143,0,7,
+    54,151,216,244,242,205,130,25,139,0,8,33,135,206,238,248,226,173,89,2,139,0,7,43,
+    147,213,246,245,217,150,44,137,0,0,192,139,255,0,68,134,0,8,15,120,197,236,249,226,
+    173,85,1,138,0,7,17,123,201,241,247,218,166,65,134,0,144,255,140,0,0,155,128,255,
+    0,140,139,0,3,13,239,255,140,133,0,8,9,103,179,225,247,240,215,154,66,133,0,137,
+    255,4,245,225,186,119,24,133,0,145,255,128,0,131,255,0,182,141,0,0,32,131,255,128,
+    0,129,255,0,140,128,0,129,255,0,140,128,0,1,73,226,131,255,1,245,146,134,0,0,
+    103,131,255,0,158,151,0,1,24,254,130,255,0,153,144,0,0,77,132,255,0,176,145,0,
+    134,255,0,194,149,0,0,150,133,255,0,80,128,0,156,255,0,128,139,0,2,61,165,239,
+    133,255,2,236,156,54,145,0,3,9,110,201,252,133,255,2,229,150,44,145,0,3,8,91,
+    190,251,132,255,3,253,201,103,7,142,0,1,76,212,135,255,1,167,30,140,0,2,5,123,
+    240,134,255,2,240,120,5,137,0,1,57,252,143,255,1,201,1,134,0,2,7,133,250,134,
+    255,1,225,90,141,0,1,69,214,134,255,2,252,156,17,139,0,2,3,104,233,135,255,1,
+    176,39,142,0,1,60,250,131,255,1,243,31,128,0,0,136,149,255,0,135,128,0,0,136,
+    148,255,0,135,128,0,0,136,135,255,1,247,36,136,0,0,136,135,255,0,135,128,0,0,
+    136,133,255,1,243,31,134,0,1,61,198,135,255,2,253,159,21,145,0,1,9,211,132,255,
+    1,243,31,132,0,0,136,144,255,1,226,97,134,0,0,136,133,255,1,243,31,135,0,2,
+    25,138,233,132,255,2,242,147,29,139,0,2,35,156,243,132,255,2,253,194,84,141,0,2,
+    6,106,209,133,255,2,203,98,4,138,0,2,11,154,254,132,255,1,245,109,136,0,2,1,
+    126,248,133,255,1,210,42,136,0,2,5,142,253,132,255,2,253,136,2,135,0,0,230,139,
+    255,0,68,133,0,1,80,237,133,255,1,200,32,136,0,1,73,236,133,255,1,165,11,132,
+    0,144,255,139,0,1,43,252,128,255,0,140,139,0,0,128,128,255,0,140,132,0,1,77,
+    228,134,255,1,175,19,131,0,141,255,1,247,115,132,0,145,255,128,0,131,255,1,245,6,
+    140,0,0,104,131,255,128,0,129,255,0,140,128,0,129,255,0,140,128,0,0,227,134,255,
+    0,62,133,0,1,23,253,130,255,1,232,1,150,0,0,101,131,255,0,71,144,0,0,158,
+    132,255,1,248,14,144,0,134,255,1,251,14,148,0,0,223,133,255,0,80,128,0,156,255,
+    0,128,137,0,1,51,194,139,255,1,186,40,142,0,1,104,232,139,255,1,168,25,141,0,
+    2,1,90,226,138,255,1,229,87,139,0,1,2,138,138,255,1,240,67,138,0,1,25,203,
+    138,255,1,190,18,136,0,0,154,145,255,0,41,133,0,1,35,215,138,255,1,173,10,138,
+    0,1,128,254,137,255,1,224,43,137,0,1,13,183,138,255,1,246,82,140,0,1,1,209,
+    133,255,0,113,128,0,0,230,149,255,0,229,128,0,0,230,148,255,0,229,128,0,0,230,
+    136,255,0,138,135,0,1,4,240,135,255,0,229,128,0,0,230,134,255,0,113,133,0,0,
+    131,139,255,1,231,53,144,0,0,122,134,255,0,113,132,0,0,230,146,255,1,176,10,132,
+    0,0,230,134,255,0,113,133,0,2,1,115,243,136,255,1,244,96,137,0,1,106,250,137,
+    255,1,193,27,138,0,1,61,220,137,255,1,212,58,136,0,1,11,193,136,255,0,150,135,
+    0,0,159,136,255,1,240,54,134,0,1,6,182,136,255,0,158,134,0,0,12,140,255,0,
+    68,132,0,1,100,254,135,255,1,231,41,134,0,1,75,251,135,255,1,193,4,131,0,143,
+    255,0,254,139,0,0,181,129,255,0,140,138,0,1,42,247,128,255,0,140,131,0,1,101,
+    253,136,255,1,204,14,130,0,143,255,0,143,131,0,145,255,128,0,132,255,0,66,140,0,
+    0,176,131,255,128,0,129,255,0,140,128,0,129,255,0,140,128,0,135,255,0,92,134,0,
+    0,196,131,255,0,53,150,0,0,179,130,255,1,239,5,143,0,1,3,235,133,255,0,92,
+    144,0,135,255,0,80,147,0,0,41,134,255,0,80,128,0,156,255,0,128,135,0,2,1,
+    122,251,141,255,1,250,115,139,0,1,9,164,142,255,1,235,62,139,0,1,15,180,142,255,
+    1,158,8,137,0,0,158,140,255,1,250,82,136,0,1,26,223,140,255,1,208,10,135,0,
+    0,200,145,255,0,68,132,0,1,35,227,140,255,1,198,14,136,0,0,131,140,255,1,233,
+    36,135,0,1,12,206,140,255,1,254,100,139,0,0,102,134,255,0,140,128,0,151,255,128,
+    0,150,255,128,0,137,255,0,209,135,0,0,63,137,255,128,0,135,255,0,140,132,0,0,
+    159,141,255,1,242,46,142,0,1,21,241,134,255,0,140,132,0,148,255,1,193,7,131,0,
+    135,255,0,140,132,0,1,7,172,140,255,0,130,135,0,0,132,140,255,1,229,33,136,0,
+    1,106,252,139,255,1,250,101,135,0,0,170,130,255,3,238,166,151,202,130,255,0,119,133,
+    0,0,111,130,255,4,230,162,148,191,253,129,255,1,228,20,133,0,0,156,130,255,3,209,
+    157,159,229,130,255,0,96,133,0,0,50,129,255,0,147,136,140,0,37,131,0,1,55,250,
+    129,255,4,239,169,146,180,248,129,255,1,215,12,132,0,1,27,239,129,255,3,238,166,154,
+    207,130,255,0,144,131,0,139,140,0,207,129,255,0,147,138,0,0,66,130,255,0,140,137,
+    0,1,13,212,129,255,0,140,130,0,1,57,251,129,255,4,247,181,147,161,225,130,255,0,
+    163,130,0,129,255,0,203,131,140,4,141,147,163,193,244,130,255,0,90,130,0,129,255,0,
+    203,141,140,128,0,132,255,0,135,139,0,1,5,242,131,255,128,0,129,255,0,140,128,0,
+    129,255,0,140,128,0,135,255,0,92,134,0,0,114,131,255,0,128,149,0,1,10,246,130,
+    255,0,163,144,0,0,64,134,255,0,178,144,0,135,255,0,152,147,0,0,114,134,255,0,
+    80,128,0,156,255,0,128,134,0,1,5,164,145,255,1,159,3,136,0,1,3,187,144,255,
+    1,249,69,137,0,1,29,217,144,255,1,181,5,135,0,0,117,142,255,1,243,41,134,0,
+    1,8,208,142,255,0,163,135,0,0,237,145,255,0,68,131,0,1,13,223,142,255,1,175,
+    1,134,0,0,78,142,255,1,209,7,134,0,0,168,142,255,1,249,56,137,0,1,42,244,
+    134,255,0,140,128,0,151,255,128,0,150,255,128,0,137,255,1,254,23,134,0,0,134,137,
+    255,128,0,135,255,0,140,131,0,0,112,143,255,1,221,10,141,0,0,149,135,255,0,140,
+    132,0,149,255,0,155,131,0,135,255,0,140,131,0,1,2,173,130,255,7,193,100,44,20,
+    25,58,135,241,130,255,0,107,133,0,0,86,130,255,8,192,99,46,23,18,38,90,179,254,
+    129,255,1,212,7,134,0,0,109,130,255,8,243,160,76,42,18,32,79,158,247,130,255,0,
+    100,133,0,0,84,130,255,1,154,10,129,0,1,75,239,128,255,1,250,40,131,0,1,16,
+    242,129,255,1,135,6,129,0,1,50,222,129,255,0,142,132,0,0,78,129,255,1,244,84,
+    129,0,1,6,147,129,255,1,227,7,132,0,0,88,128,255,0,243,143,0,0,200,129,255,
+    1,166,15,129,0,1,32,204,129,255,0,127,132,0,0,162,129,255,1,178,15,129,0,1,
+    83,245,128,255,1,253,46,142,0,1,24,239,128,255,1,220,11,137,0,1,1,205,130,255,
+    0,140,136,0,1,6,183,130,255,0,140,130,0,0,208,129,255,1,178,23,129,0,2,2,
+    107,250,129,255,0,62,129,0,129,255,0,140,135,0,1,11,145,129,255,1,232,8,129,0,
+    129,255,0,140,143,0,132,255,0,205,139,0,0,63,132,255,128,0,129,255,0,140,128,0,
+    129,255,0,140,128,0,0,243,134,255,0,92,134,0,0,33,131,255,0,204,149,0,0,79,
+    131,255,0,81,144,0,0,144,130,255,0,243,129,255,1,249,15,143,0,135,255,0,223,147,
+    0,0,187,134,255,0,80,128,0,156,255,0,128,133,0,1,1,167,147,255,0,155,136,0,
+    0,145,146,255,1,244,40,135,0,1,18,214,146,255,0,167,134,0,1,32,248,143,255,1,
+    209,1,133,0,0,147,144,255,0,63,133,0,0,20,146,255,0,68,131,0,0,153,144,255,
+    0,107,133,0,1,12,229,143,255,0,126,133,0,0,90,144,255,1,222,4,135,0,1,26,
+    224,135,255,0,140,128,0,151,255,128,0,150,255,128,0,138,255,0,92,134,0,0,206,137,
+    255,128,0,135,255,0,140,130,0,1,43,250,144,255,0,137,140,0,1,38,251,135,255,0,
+    140,132,0,150,255,0,67,130,0,129,255,0,140,128,0,129,255,0,140,131,0,0,127,129,
+    255,1,234,74,133,0,1,23,196,129,255,1,246,37,131,0,1,7,227,128,255,1,249,88,
+    134,0,1,71,239,129,255,0,123,133,0,1,72,253,129,255,1,174,22,133,0,1,30,181,
+    129,255,1,252,64,132,0,0,210,129,255,0,151,132,0,1,59,250,128,255,0,174,131,0,
+    0,113,129,255,0,140,132,0,1,32,239,128,255,1,245,9,130,0,1,2,217,128,255,1,
+    252,67,132,0,0,168,129,255,0,84,132,0,0,126,128,255,0,207,142,0,0,62,129,255,
+    1,184,1,131,0,1,18,227,128,255,1,238,5,130,0,1,31,252,128,255,1,201,5,131,
+    0,0,74,129,255,0,165,142,0,0,165,128,255,1,254,61,138,0,0,92,131,255,0,140,
+    135,0,1,10,184,131,255,0,140,129,0,0,72,129,255,1,183,3,132,0,0,88,129,255,
+    0,177,129,0,129,255,0,140,137,0,0,159,129,255,0,97,129,0,129,255,0,140,143,0,
+    129,255,0,233,128,255,1,254,20,138,0,0,135,128,255,0,252,129,255,134,0,129,255,0,
+    140,128,0,0,138,134,255,0,92,135,0,0,207,130,255,1,254,24,148,0,0,157,130,255,
+    1,244,9,144,0,0,224,129,255,1,221,179,130,255,0,94,143,0,136,255,0,38,145,0,
+    1,11,248,134,255,0,80,128,0,131,255,0,80,158,0,0,133,149,255,0,123,134,0,0,
+    60,148,255,1,202,2,133,0,1,1,189,148,255,0,94,133,0,0,166,145,255,0,83,132,
+    0,1,49,253,144,255,0,192,133,0,0,58,146,255,0,62,130,0,0,56,145,255,1,238,
+    19,132,0,0,124,144,255,1,244,20,131,0,1,2,214,145,255,0,97,134,0,1,34,221,
+    136,255,0,140,128,0,150,255,0,250,128,0,0,250,148,255,0,228,128,0,138,255,0,162,
+    133,0,1,23,254,137,255,128,0,135,255,0,140,130,0,0,167,145,255,1,251,28,139,0,
+    0,175,136,255,0,140,132,0,150,255,0,201,130,0,135,255,0,140,130,0,1,48,251,128,
+    255,1,231,35,135,0,1,11,208,129,255,0,177,131,0,0,95,129,255,0,99,136,0,0,
+    70,129,255,1,236,5,131,0,1,19,233,129,255,0,127,136,0,1,1,138,129,255,1,223,
+    13,130,0,0,56,129,255,1,217,7,133,0,0,136,128,255,1,253,32,130,0,0,183,128,
+    255,1,238,11,133,0,0,123,129,255,0,68,130,0,0,75,129,255,0,148,133,0,1,32,
+    253,128,255,0,163,132,0,0,164,128,255,0,170,142,0,0,152,128,255,1,253,38,133,0,
+    0,108,129,255,0,61,130,0,0,126,128,255,1,253,43,133,0,0,159,128,255,1,250,16,
+    140,0,1,53,254,128,255,0,162,138,0,1,7,224,131,255,0,140,134,0,1,17,198,132,
+    255,0,140,129,0,0,158,128,255,1,250,28,134,0,0,177,128,255,1,253,17,128,0,129,
+    255,0,140,137,0,1,26,252,128,255,0,176,129,0,129,255,0,140,143,0,129,255,0,165,
+    129,255,0,89,138,0,0,207,128,255,0,198,129,255,134,0,129,255,0,140,129,0,1,51,
+    80,132,255,0,92,135,0,0,126,131,255,0,98,147,0,1,2,233,130,255,0,172,144,0,
+    0,50,130,255,1,171,117,130,255,0,180,143,0,131,255,0,249,130,255,0,109,145,0,0,
+    78,135,255,0,80,128,0,131,255,0,80,157,0,1,66,253,149,255,1,251,50,133,0,0,
+    194,149,255,0,85,133,0,0,112,149,255,1,238,22,131,0,1,21,251,145,255,0,197,132,
+    0,0,177,146,255,0,36,132,0,0,96,145,255,1,250,18,130,0,0,165,146,255,0,130,
+    131,0,1,6,234,145,255,0,122,131,0,0,72,146,255,0,208,133,0,1,55,231,137,255,
+    0,140,128,0,150,255,0,201,128,0,0,202,148,255,0,124,128,0,138,255,0,231,133,0,
+    0,94,138,255,128,0,135,255,0,140,129,0,1,33,252,146,255,0,130,138,0,0,60,137,
+    255,0,140,132,0,151,255,0,54,129,0,135,255,0,140,130,0,0,184,128,255,1,253,60,
+    137,0,1,43,251,128,255,1,254,39,130,0,0,170,128,255,1,221,1,137,0,0,174,129,
+    255,0,71,131,0,0,147,129,255,0,145,139,0,0,156,129,255,0,131,130,0,0,128,129,
+    255,0,92,134,0,1,21,250,128,255,0,118,130,0,0,227,128,255,0,172,134,0,0,41,
+    129,255,0,112,130,0,0,165,128,255,1,247,19,134,0,0,195,128,255,0,217,132,0,0,
+    202,128,255,0,133,142,0,0,218,128,255,0,193,134,0,0,35,129,255,0,109,130,0,0,
+    208,128,255,0,181,134,0,0,43,129,255,0,92,140,0,0,192,128,255,1,246,29,138,0,
+    0,118,128,255,0,186,129,255,0,140,133,0,1,68,226,129,255,0,247,129,255,0,140,129,
+    0,0,227,128,255,0,175,135,0,0,76,129,255,0,75,128,0,129,255,0,140,138,0,0,
+    194,128,255,0,225,129,0,129,255,0,140,143,0,129,255,1,140,210,128,255,0,158,137,0,
+    4,23,254,255,238,143,129,255,134,0,129,255,0,140,131,0,132,255,0,92,135,0,0,44,
+    131,255,0,173,147,0,0,58,131,255,0,90,144,0,0,131,130,255,1,121,52,130,255,1,
+    249,16,142,0,131,255,0,190,130,255,0,181,145,0,0,151,129,255,0,238,131,255,0,80,
+    128,0,131,255,0,80,156,0,1,6,220,151,255,1,209,2,131,0,0,51,150,255,0,198,
+    132,0,1,24,245,150,255,0,134,131,0,0,108,146,255,1,253,18,130,0,1,32,253,146,
+    255,0,119,132,0,0,134,145,255,0,117,130,0,1,19,248,146,255,1,233,7,130,0,0,
+    81,146,255,0,220,131,0,0,141,147,255,0,24,130,0,2,6,133,252,138,255,0,140,128,
+    0,149,255,1,244,60,128,0,1,60,244,146,255,1,210,6,128,0,139,255,0,45,132,0,
+    0,165,138,255,128,0,135,255,0,140,129,0,0,116,147,255,0,225,138,0,0,200,137,255,
+    0,140,132,0,151,255,0,136,129,0,0,230,134,255,0,113,129,0,0,54,129,255,0,154,
+    139,0,0,155,129,255,0,139,130,0,0,221,128,255,0,159,138,0,0,78,129,255,0,124,
+    130,0,1,24,249,128,255,1,219,7,139,0,1,10,220,128,255,1,242,19,129,0,0,182,
+    128,255,1,247,10,135,0,0,189,128,255,0,191,130,0,0,247,128,255,0,145,134,0,0,
+    8,129,255,0,132,129,0,1,2,239,128,255,0,167,135,0,4,132,249,226,198,2,131,0,
+    0,239,128,255,0,96,141,0,1,12,251,128,255,0,126,134,0,0,6,129,255,0,130,129,
+    0,1,21,254,128,255,0,101,135,0,0,219,128,255,0,159,139,0,0,66,129,255,0,134,
+    138,0,4,19,239,255,254,49,129,255,0,140,132,0,1,150,254,129,255,1,247,69,129,255,
+    0,140,128,0,0,19,129,255,0,113,135,0,0,23,129,255,0,113,128,0,129,255,0,140,
+    138,0,0,162,128,255,0,248,129,0,129,255,0,140,143,0,129,255,1,140,139,128,255,0,
+    227,137,0,0,94,128,255,1,169,140,129,255,134,0,129,255,0,140,131,0,132,255,0,92,
+    136,0,0,218,130,255,1,242,6,146,0,0,136,130,255,1,249,14,144,0,0,211,130,255,
+    2,71,2,237,130,255,0,96,142,0,131,255,0,117,130,255,1,245,7,144,0,0,224,129,
+    255,0,167,131,255,0,80,128,0,131,255,0,80,156,0,0,113,153,255,0,91,131,0,0,
+    125,150,255,1,254,27,131,0,0,145,151,255,1,239,12,130,0,0,180,135,255,2,220,153,
+    239,135,255,0,80,130,0,0,119,136,255,1,167,205,135,255,0,183,132,0,0,172,134,255,
+    0,215,134,140,1,126,57,131,0,0,89,136,255,2,208,165,254,135,255,0,73,130,0,0,
+    164,135,255,1,218,168,136,255,0,47,130,0,0,201,135,255,2,205,157,248,135,255,0,85,
+    129,0,1,15,199,140,255,0,140,128,0,135,255,0,203,138,140,1,114,32,130,0,1,32,
+    115,134,140,136,255,1,250,49,129,0,139,255,0,115,131,0,1,1,234,138,255,128,0,135,
+    255,0,140,129,0,0,186,135,255,2,229,155,194,136,255,0,32,136,0,0,86,138,255,0,
+    140,132,0,135,255,0,203,129,140,2,146,161,214,135,255,0,191,129,0,0,136,133,255,1,
+    243,32,129,0,0,153,128,255,1,252,31,139,0,0,46,129,255,0,216,130,0,0,243,128,
+    255,0,145,138,0,0,13,129,255,0,156,130,0,0,126,129,255,0,77,141,0,0,91,129,
+    255,0,113,129,0,0,221,128,255,0,199,136,0,0,139,128,255,1,243,1,129,0,0,249,
+    128,255,0,156,134,0,0,12,129,255,0,130,129,0,0,46,129,255,0,86,135,0,0,4,
+    134,0,0,22,129,255,0,59,142,0,3,11,62,117,53,134,0,0,15,129,255,0,130,129,
+    0,0,76,129,255,0,41,135,0,0,159,128,255,0,217,139,0,0,190,128,255,1,240,14,
+    138,0,0,144,128,255,1,165,0,129,255,0,140,132,0,130,255,2,233,61,0,129,255,0,
+    140,128,0,0,52,129,255,0,77,135,0,0,5,129,255,0,132,128,0,129,255,0,140,138,
+    0,0,147,128,255,0,241,129,0,129,255,0,140,143,0,129,255,1,140,68,129,255,0,42,
+    136,0,0,166,128,255,1,97,140,129,255,134,0,129,255,0,140,131,0,132,255,0,92,136,
+    0,0,137,131,255,0,68,146,0,0,214,130,255,0,182,144,0,0,36,130,255,3,254,20,
+    0,170,130,255,0,182,142,0,131,255,1,80,220,130,255,0,67,143,0,0,42,130,255,0,
+    93,131,255,0,80,128,0,131,255,0,80,155,0,1,4,226,136,255,6,225,112,41,18,40,
+    115,232,136,255,1,219,2,130,0,0,191,135,255,6,159,60,22,18,49,149,253,135,255,0,
+    89,130,0,1,20,248,135,255,6,253,165,67,28,36,101,238,136,255,0,95,130,0,0,233,
+    134,255,3,236,20,0,74,135,255,0,109,130,0,0,198,135,255,3,124,0,12,235,134,255,
+    0,227,132,0,0,210,134,255,0,140,141,0,0,144,135,255,3,201,8,0,115,135,255,0,
+    147,130,0,0,234,134,255,3,240,28,0,135,135,255,0,115,130,0,0,228,134,255,3,214,
+    5,0,93,135,255,0,111,129,0,0,164,141,255,0,140,128,0,135,255,0,140,153,0,1,
+    32,251,135,255,0,131,130,0,139,255,0,185,131,0,0,53,139,255,128,0,135,255,0,140,
+    129,0,0,243,134,255,1,231,24,128,0,0,160,135,255,0,89,135,0,1,6,220,138,255,
+    0,140,132,0,135,255,0,140,131,0,1,8,226,134,255,0,231,129,0,0,12,133,255,0,
+    120,129,0,1,5,238,128,255,0,178,141,0,4,215,255,231,156,7,129,0,0,245,128,255,
+    0,174,139,0,3,194,190,165,94,130,0,0,214,128,255,1,225,1,141,0,1,3,232,128,
+    255,0,208,129,0,0,238,128,255,0,161,136,0,0,113,129,255,0,33,129,0,0,225,128,
+    255,0,206,134,0,0,58,129,255,0,101,129,0,0,96,129,255,0,29,144,0,0,60,129,
+    255,0,22,154,0,0,59,129,255,0,102,129,0,0,122,128,255,1,249,3,135,0,0,114,
+    128,255,1,253,8,137,0,0,53,129,255,0,135,138,0,5,35,249,255,249,33,0,129,255,
+    0,140,132,0,129,255,1,199,29,128,0,129,255,0,140,128,0,4,17,84,118,152,43,135,
+    0,0,20,129,255,0,128,128,0,129,255,0,140,138,0,0,171,128,255,0,213,129,0,129,
+    255,0,140,143,0,129,255,2,140,7,245,128,255,0,112,135,0,1,2,235,128,255,1,25,
+    140,129,255,128,0,129,255,0,140,128,0,129,255,0,140,131,0,132,255,0,92,136,0,0,
+    56,131,255,0,143,145,0,0,35,131,255,0,99,144,0,0,117,130,255,0,209,128,0,0,
+    98,130,255,1,250,17,141,0,131,255,1,80,148,130,255,0,138,143,0,0,115,129,255,1,
+    253,21,131,255,0,80,128,0,131,255,0,80,155,0,0,82,136,255,1,178,14,131,0,1,
+    18,202,136,255,0,70,130,0,0,221,134,255,0,189,132,0,0,139,135,255,0,134,130,0,
+    0,108,135,255,1,251,77,131,0,1,42,243,135,255,0,172,129,0,0,21,135,255,0,148,
+    128,0,0,13,135,255,0,130,129,0,1,9,250,134,255,1,220,4,128,0,0,156,135,255,
+    0,4,130,0,1,1,246,134,255,0,103,141,0,0,195,135,255,0,48,128,0,1,3,226,
+    134,255,0,209,129,0,0,37,135,255,0,135,128,0,1,12,242,134,255,0,176,130,0,0,
+    247,134,255,0,150,128,0,0,16,135,255,0,132,129,0,0,236,141,255,0,140,128,0,135,
+    255,0,140,153,0,0,151,135,255,1,230,11,130,0,139,255,1,246,8,130,0,0,125,139,
+    255,128,0,135,255,0,140,128,0,0,22,135,255,0,130,129,0,0,44,135,255,0,113,135,
+    0,0,112,139,255,0,140,132,0,135,255,0,140,132,0,0,159,134,255,0,248,129,0,0,
+    136,133,255,1,243,31,128,0,0,55,129,255,0,96,141,0,2,70,53,1,131,0,0,219,
+    128,255,1,242,17,145,0,0,33,129,255,0,139,143,0,0,147,129,255,0,29,128,0,0,
+    251,128,255,0,146,136,0,0,100,129,255,0,68,129,0,0,173,129,255,0,53,133,0,0,
+    160,129,255,0,41,129,0,0,138,128,255,0,235,145,0,0,98,128,255,0,241,155,0,0,
+    154,129,255,0,44,129,0,0,160,128,255,0,219,136,0,0,81,129,255,0,43,137,0,0,
+    165,128,255,1,248,24,138,0,0,170,128,255,0,144,128,0,129,255,0,140,132,0,3,255,
+    248,120,3,129,0,129,255,0,140,142,0,0,69,129,255,0,107,128,0,129,255,0,140,138,
+    0,0,215,128,255,0,167,129,0,129,255,0,140,143,0,129,255,2,140,0,183,128,255,0,
+    181,135,0,0,54,128,255,2,208,0,140,129,255,128,0,129,255,0,140,128,0,129,255,0,
+    140,131,0,132,255,0,92,136,0,1,1,229,130,255,0,218,145,0,0,114,130,255,1,252,
+    20,144,0,0,198,130,255,0,142,128,0,0,26,131,255,0,98,141,0,131,255,1,80,76,
+    130,255,0,209,143,0,0,188,129,255,1,201,0,131,255,0,80,128,0,131,255,0,80,155,
+    0,0,170,135,255,1,198,7,133,0,1,15,214,135,255,0,165,130,0,0,243,134,255,0,
+    150,132,0,0,33,135,255,0,156,130,0,0,200,135,255,0,126,133,0,0,119,135,255,1,
+    242,4,128,0,1,12,252,134,255,0,91,128,0,0,32,135,255,0,130,129,0,0,61,135,
+    255,4,154,92,125,135,208,134,255,0,232,131,0,0,30,136,255,5,246,245,218,164,82,3,
+    135,0,0,221,134,255,0,214,130,0,0,154,134,255,1,249,5,128,0,0,88,135,255,0,
+    55,129,0,0,172,134,255,0,226,130,0,0,249,134,255,0,172,128,0,0,25,135,255,0,
+    130,129,0,142,255,0,140,128,0,135,255,0,140,152,0,1,20,247,135,255,0,100,131,0,
+    140,255,0,68,130,0,0,196,139,255,128,0,135,255,0,140,128,0,0,55,135,255,0,79,
+    129,0,0,8,135,255,0,132,134,0,1,16,236,139,255,0,140,132,0,135,255,0,140,132,
+    0,0,147,134,255,0,248,129,0,0,230,134,255,0,113,128,0,0,115,129,255,0,31,149,
+    0,0,179,129,255,1,177,9,144,0,0,94,129,255,0,60,143,0,0,71,129,255,0,91,
+    128,0,0,243,128,255,0,148,136,0,0,110,129,255,0,91,129,0,0,87,129,255,1,215,
+    21,131,0,0,89,129,255,0,197,130,0,0,171,128,255,0,204,129,0,5,6,73,123,131,
+    102,33,136,0,0,136,128,255,9,204,0,45,150,217,246,236,201,119,20,145,0,1,69,252,
+    128,255,0,204,130,0,0,190,128,255,0,192,136,0,0,54,129,255,0,72,136,0,1,24,
+    250,128,255,0,155,138,0,0,55,128,255,1,241,20,128,0,129,255,0,140,132,0,1,160,
+    31,131,0,129,255,0,140,142,0,0,148,129,255,0,61,128,0,129,255,0,140,137,0,0,
+    62,129,255,0,76,129,0,129,255,0,140,143,0,129,255,2,140,0,112,128,255,1,244,6,
+    134,0,0,125,128,255,2,135,0,140,129,255,128,0,129,255,0,140,128,0,129,255,0,140,
+    131,0,132,255,0,92,137,0,0,149,131,255,0,38,144,0,0,193,130,255,0,191,144,0,
+    1,24,254,130,255,0,74,129,0,0,207,130,255,0,184,141,0,131,255,2,80,10,248,130,
+    255,0,26,141,0,1,12,249,129,255,1,127,0,131,255,0,80,128,0,131,255,0,80,154,
+    0,1,4,243,134,255,1,252,47,135,0,0,68,135,255,1,241,3,129,0,0,251,134,255,
+    1,222,44,132,0,0,235,134,255,0,164,129,0,1,16,253,134,255,1,233,8,133,0,1,
+    15,244,135,255,0,17,129,0,0,156,133,255,1,254,28,128,0,0,137,135,255,0,111,129,
+    0,0,105,148,255,0,104,131,0,0,68,141,255,1,219,67,134,0,0,237,134,255,0,165,
+    130,0,0,113,135,255,0,42,128,0,0,130,134,255,1,251,6,129,0,0,118,135,255,0,
+    14,129,0,0,231,134,255,3,248,66,12,156,135,255,0,110,129,0,142,255,0,140,128,0,
+    135,255,0,140,152,0,0,123,135,255,1,213,3,131,0,140,255,0,138,129,0,1,15,251,
+    139,255,128,0,135,255,0,140,128,0,0,57,135,255,0,60,129,0,0,30,135,255,0,128,
+    134,0,0,138,140,255,0,140,132,0,135,255,0,140,132,0,0,174,134,255,0,230,129,0,
+    135,255,0,140,128,0,0,161,128,255,0,235,150,0,0,92,130,255,2,217,90,5,142,0,
+    0,143,129,255,0,14,143,0,1,14,253,128,255,0,146,128,0,0,228,128,255,0,168,136,
+    0,0,131,129,255,0,113,129,0,1,3,197,129,255,6,225,96,22,6,43,147,253,128,255,
+    1,247,48,130,0,0,198,128,255,0,176,128,0,1,102,232,130,255,2,254,175,24,134,0,
+    0,174,128,255,2,179,154,254,132,255,1,235,86,142,0,2,5,107,247,128,255,1,251,59,
+    130,0,0,214,128,255,0,172,136,0,0,34,129,255,0,97,136,0,0,117,129,255,0,45,
+    138,0,0,195,128,255,0,123,129,0,129,255,0,140,139,0,129,255,0,140,141,0,1,13,
+    238,128,255,1,244,9,128,0,129,255,0,140,136,0,1,27,224,128,255,1,216,4,129,0,
+    129,255,0,140,143,0,129,255,2,140,0,41,129,255,0,65,134,0,0,197,128,255,2,63,
+    0,140,129,255,128,0,129,255,0,140,128,0,129,255,0,140,131,0,132,255,0,92,137,0,
+    0,68,131,255,0,113,143,0,1,18,252,130,255,0,109,144,0,0,103,130,255,1,250,12,
+    129,0,0,130,130,255,1,251,19,140,0,131,255,2,80,0,187,130,255,0,96,141,0,0,
+    79,130,255,1,53,0,131,255,0,80,128,0,131,255,0,80,154,0,0,55,135,255,0,177,
+    137,0,0,193,135,255,0,51,129,0,0,236,135,255,3,254,189,100,23,129,0,0,184,134,
+    255,0,117,129,0,0,76,135,255,0,134,135,0,0,171,134,255,0,221,130,0,2,5,130,
+    225,131,255,3,211,133,151,200,136,255,0,67,129,0,0,145,145,255,2,205,169,77,132,0,
+    0,106,143,255,1,146,1,132,0,0,251,134,255,0,146,130,0,0,99,135,255,0,69,128,
+    0,0,166,134,255,0,220,130,0,0,80,135,255,0,47,129,0,0,193,147,255,0,65,129,
+    0,142,255,0,140,128,0,135,255,0,140,151,0,1,3,228,135,255,0,93,132,0,140,255,
+    0,208,129,0,0,84,140,255,128,0,135,255,0,140,128,0,1,10,231,133,255,1,253,15,
+    129,0,0,102,135,255,0,111,133,0,1,31,248,140,255,0,140,132,0,135,255,0,140,129,
+    0,3,2,15,80,246,134,255,0,191,129,0,135,255,0,140,128,0,0,194,128,255,0,199,
+    150,0,1,11,230,131,255,3,234,145,66,4,139,0,0,182,128,255,0,226,145,0,0,220,
+    128,255,0,181,128,0,0,199,128,255,0,216,136,0,0,178,129,255,0,124,130,0,1,21,
+    221,136,255,1,238,69,131,0,0,219,128,255,2,159,3,164,134,255,1,234,44,133,0,0,
+    212,138,255,1,254,106,138,0,3,46,145,170,233,130,255,0,111,131,0,0,231,128,255,0,
+    158,136,0,0,20,129,255,0,113,136,0,0,207,128,255,0,202,138,0,0,81,128,255,1,
+    230,10,129,0,129,255,0,140,139,0,129,255,0,140,141,0,0,126,129,255,0,166,129,0,
+    129,255,0,140,132,0,4,3,15,46,123,239,128,255,1,251,53,130,0,129,255,0,140,143,
+    0,129,255,0,140,128,0,0,226,128,255,0,134,133,0,6,16,252,255,242,5,0,140,129,
+    255,128,0,129,255,0,140,128,0,129,255,0,140,131,0,132,255,0,92,137,0,1,4,237,
+    130,255,0,188,143,0,0,93,130,255,1,254,28,144,0,0,184,130,255,0,193,130,0,0,
+    53,131,255,0,100,140,0,131,255,2,80,0,115,130,255,0,167,141,0,0,152,129,255,2,
+    233,1,0,131,255,0,80,128,0,131,255,0,80,154,0,0,110,135,255,0,91,137,0,0,
+    103,135,255,0,112,129,0,0,199,138,255,5,254,201,126,49,76,254,132,255,1,207,11,129,
+    0,0,131,135,255,0,53,135,0,0,80,133,255,1,242,63,133,0,4,25,80,131,142,209,
+    139,255,1,245,9,129,0,0,175,144,255,1,251,82,134,0,0,145,144,255,1,160,2,131,
+    0,0,243,134,255,0,147,130,0,0,108,135,255,0,93,128,0,0,193,134,255,0,192,130,
+    0,0,52,135,255,0,76,129,0,0,132,146,255,1,243,8,129,0,142,255,0,140,128,0,
+    146,255,2,229,135,6,138,0,0,72,135,255,1,226,5,132,0,140,255,1,254,22,128,0,
+    0,156,140,255,128,0,135,255,0,140,129,0,1,60,229,132,255,0,137,129,0,1,1,211,
+    135,255,0,75,133,0,0,164,141,255,0,140,132,0,151,255,0,130,129,0,135,255,0,140,
+    128,0,0,224,128,255,0,171,151,0,0,76,134,255,3,239,169,92,16,136,0,0,211,128,
+    255,0,187,145,0,0,187,128,255,0,215,128,0,0,146,129,255,0,38,134,0,1,10,242,
+    129,255,0,131,131,0,2,16,153,254,133,255,1,203,26,132,0,0,234,128,255,1,151,143,
+    136,255,1,232,29,131,0,1,2,247,131,255,3,202,157,155,200,131,255,0,71,137,0,0,
+    99,131,255,1,243,78,132,0,0,244,128,255,0,148,136,0,0,9,129,255,0,127,135,0,
+    0,41,129,255,0,103,137,0,1,4,217,128,255,0,102,130,0,129,255,0,140,139,0,129,
+    255,0,140,140,0,1,37,247,129,255,0,54,129,0,142,255,1,246,84,131,0,143,255,130,
+    0,129,255,0,140,128,0,0,156,128,255,0,204,133,0,0,85,128,255,0,174,128,0,0,
+    140,129,255,128,0,129,255,0,140,128,0,129,255,0,140,131,0,132,255,0,92,138,0,0,
+    161,130,255,1,250,14,142,0,0,171,130,255,0,201,144,0,1,15,249,130,255,0,117,130,
+    0,1,1,230,130,255,0,186,140,0,131,255,2,80,0,42,130,255,1,236,2,140,0,0,
+    225,129,255,0,161,128,0,131,255,0,80,128,0,131,255,0,80,154,0,0,152,135,255,0,
+    19,137,0,0,32,135,255,0,153,129,0,0,142,142,255,8,222,210,226,213,194,169,144,92,
+    8,130,0,0,167,134,255,1,246,3,135,0,1,1,176,129,255,3,250,190,113,20,137,0,
+    1,22,253,139,255,0,161,130,0,0,201,145,255,1,250,70,133,0,0,183,145,255,0,133,
+    131,0,0,227,134,255,0,176,130,0,0,141,135,255,0,114,128,0,0,215,134,255,0,171,
+    130,0,0,33,135,255,0,98,129,0,0,45,146,255,0,156,130,0,0,217,141,255,0,140,
+    128,0,148,255,0,135,138,0,0,163,135,255,0,113,133,0,141,255,0,91,128,0,0,227,
+    140,255,128,0,135,255,0,140,130,0,3,2,52,89,123,128,155,0,86,130,0,0,100,136,
+    255,0,25,132,0,1,50,254,141,255,0,140,132,0,151,255,0,47,129,0,135,255,0,140,
+    128,0,0,238,128,255,0,154,152,0,1,116,254,135,255,3,250,177,76,1,133,0,0,233,
+    128,255,0,171,145,0,0,161,128,255,0,233,128,0,0,82,129,255,0,156,134,0,0,108,
+    130,255,0,137,131,0,2,35,165,251,134,255,1,185,26,131,0,0,246,128,255,9,202,254,
+    255,253,144,43,8,31,118,243,129,255,0,182,131,0,0,32,130,255,1,211,53,130,0,1,
+    47,207,129,255,1,229,14,136,0,0,124,132,255,1,195,68,131,0,0,251,128,255,0,143,
+    136,0,0,5,129,255,0,133,135,0,0,132,128,255,1,245,14,137,0,0,107,128,255,1,
+    215,3,130,0,129,255,0,140,139,0,129,255,0,140,139,0,1,7,202,129,255,0,178,130,
+    0,142,255,1,151,5,131,0,143,255,130,0,129,255,0,140,128,0,0,85,128,255,1,254,
+    20,132,0,0,156,128,255,0,102,128,0,0,140,129,255,128,0,129,255,0,140,128,0,129,
+    255,0,140,131,0,132,255,0,92,138,0,0,79,131,255,0,83,141,0,1,6,242,130,255,
+    0,118,144,0,0,90,131,255,0,39,131,0,0,155,130,255,1,251,20,139,0,131,255,0,
+    80,128,0,0,225,130,255,0,54,139,0,0,43,130,255,0,86,128,0,131,255,0,80,128,
+    0,131,255,0,80,154,0,0,189,134,255,0,224,139,0,0,230,134,255,0,188,129,0,0,
+    61,144,255,2,253,172,35,134,0,0,201,134,255,0,204,137,0,4,2,75,118,84,15,140,
+    0,0,77,139,255,1,253,41,130,0,0,220,146,255,1,230,16,132,0,0,221,145,255,1,
+    252,57,130,0,0,207,134,255,1,239,15,129,0,0,206,135,255,0,123,128,0,0,232,134,
+    255,0,157,130,0,0,18,135,255,0,114,130,0,0,179,144,255,1,246,34,130,0,0,112,
+    130,255,1,233,101,135,255,0,140,128,0,148,255,0,229,137,0,1,9,243,134,255,1,243,
+    13,133,0,141,255,2,161,0,43,141,255,128,0,135,255,0,140,140,0,1,33,240,135,255,
+    0,209,133,0,0,190,142,255,0,140,132,0,150,255,0,192,130,0,135,255,0,140,128,0,
+    0,249,128,255,0,146,153,0,1,89,237,137,255,1,207,56,132,0,0,246,128,255,0,159,
+    145,0,0,150,128,255,0,244,128,0,1,5,233,128,255,1,254,79,132,0,1,37,239,130,
+    255,0,134,130,0,1,79,246,129,255,4,222,159,149,189,252,129,255,1,227,33,130,0,0,
+    251,130,255,1,249,74,131,0,1,44,237,129,255,0,72,130,0,0,70,129,255,1,203,15,
+    132,0,1,14,205,129,255,0,111,136,0,0,148,133,255,1,253,116,130,0,0,254,128,255,
+    0,140,136,0,0,1,129,255,0,138,135,0,0,221,128,255,0,165,137,0,1,13,234,128,
+    255,0,81,131,0,129,255,0,140,139,0,129,255,0,140,139,0,0,153,129,255,1,244,31,
+    130,0,143,255,1,208,34,130,0,143,255,130,0,129,255,0,140,128,0,1,17,252,128,255,
+    0,88,132,0,0,227,128,255,0,30,128,0,0,140,129,255,128,0,129,255,0,140,128,0,
+    129,255,0,140,131,0,132,255,0,92,138,0,1,9,244,130,255,0,158,141,0,0,71,131,
+    255,0,36,144,0,0,170,130,255,0,218,132,0,0,77,131,255,0,102,139,0,131,255,0,
+    80,128,0,0,153,130,255,0,125,139,0,0,116,129,255,1,251,16,128,0,131,255,0,80,
+    128,0,131,255,0,80,154,0,0,214,134,255,0,189,139,0,0,193,134,255,0,219,130,0,
+    0,208,145,255,1,248,117,133,0,0,226,134,255,0,175,156,0,0,102,140,255,0,2,130,
+    0,0,235,147,255,0,157,131,0,1,6,252,146,255,0,209,130,0,0,161,135,255,0,143,
+    128,0,0,83,136,255,0,130,128,0,0,245,134,255,0,147,130,0,0,9,135,255,0,127,
+    130,0,0,33,144,255,0,170,132,0,5,101,197,193,121,11,0,135,255,0,140,128,0,149,
+    255,137,0,0,88,135,255,0,157,134,0,141,255,2,230,0,115,141,255,128,0,135,255,0,
+    140,139,0,1,8,206,136,255,0,123,132,0,0,75,143,255,0,140,132,0,150,255,0,51,
+    130,0,135,255,0,140,128,0,0,253,128,255,0,143,154,0,2,17,123,227,136,255,1,251,
+    108,131,0,0,253,128,255,0,146,145,0,0,143,128,255,0,252,129,0,0,122,129,255,2,
+    248,102,1,129,0,3,58,226,255,244,129,255,0,128,129,0,1,53,250,128,255,1,246,97,
+    130,0,1,35,195,129,255,1,206,5,129,0,131,255,0,112,133,0,0,80,129,255,0,176,
+    130,0,4,42,142,184,220,41,134,0,1,40,250,128,255,0,216,136,0,5,63,44,9,18,
+    76,194,129,255,1,254,75,129,0,0,253,128,255,0,141,136,0,0,3,129,255,0,136,134,
+    0,0,53,129,255,0,85,137,0,0,133,128,255,0,198,132,0,129,255,0,140,139,0,129,
+    255,0,140,138,0,0,114,130,255,0,101,131,0,129,255,0,203,132,140,3,142,153,179,230,
+    130,255,1,225,23,129,0,129,255,0,203,139,140,130,0,129,255,0,140,129,0,0,199,128,
+    255,0,157,131,0,0,44,128,255,0,213,129,0,0,140,129,255,128,0,129,255,0,140,128,
+    0,129,255,0,140,131,0,132,255,0,92,139,0,0,172,130,255,1,232,1,140,0,0,150,
+    130,255,0,210,144,0,1,7,243,130,255,0,140,132,0,1,9,246,130,255,0,188,139,0,
+    131,255,0,80,128,0,0,81,130,255,0,196,139,0,0,190,129,255,0,194,129,0,131,255,
+    0,80,128,0,131,255,0,80,154,0,0,235,134,255,0,165,139,0,0,163,134,255,0,233,
+    130,0,0,70,147,255,1,165,3,131,0,0,238,134,255,0,153,156,0,0,127,140,255,0,
+    135,130,0,0,246,147,255,1,252,28,130,0,0,41,148,255,0,64,129,0,0,108,136,255,
+    2,185,162,248,136,255,0,137,128,0,0,251,134,255,0,142,130,0,0,4,135,255,0,133,
+    130,0,0,110,144,255,1,242,32,137,0,135,255,0,140,128,0,149,255,137,0,0,178,135,
+    255,0,58,134,0,142,255,1,44,187,141,255,128,0,135,255,0,140,138,0,1,1,171,136,
+    255,1,247,23,131,0,1,3,212,143,255,0,140,132,0,150,255,0,61,130,0,135,255,0,
+    140,128,0,0,244,128,255,0,153,156,0,3,2,69,154,232,135,255,0,101,130,0,0,248,
+    128,255,0,146,145,0,0,155,128,255,0,240,129,0,1,5,208,130,255,3,222,158,150,197,
+    129,255,0,103,129,255,0,121,128,0,1,1,209,128,255,1,253,70,132,0,1,8,192,129,
+    255,0,107,129,0,0,252,129,255,1,220,2,134,0,0,200,128,255,1,250,8,143,0,0,
+    170,129,255,0,26,140,0,1,1,142,129,255,1,217,2,128,0,0,249,128,255,0,145,136,
+    0,0,6,129,255,0,131,134,0,0,122,128,255,1,248,13,136,0,1,27,246,128,255,0,
+    60,132,0,129,255,0,140,139,0,129,255,0,140,137,0,1,83,253,129,255,0,167,132,0,
+    129,255,0,140,135,0,2,1,77,230,129,255,0,174,129,0,129,255,0,140,143,0,129,255,
+    0,140,129,0,0,129,128,255,0,227,131,0,0,116,128,255,0,141,129,0,0,140,129,255,
+    128,0,129,255,0,140,128,0,129,255,0,140,131,0,132,255,0,92,139,0,0,91,131,255,
+    0,53,140,0,0,226,130,255,0,128,144,0,0,76,131,255,0,63,133,0,0,178,130,255,
+    1,252,21,138,0,131,255,0,80,128,0,1,13,250,129,255,1,252,15,137,0,1,12,250,
+    129,255,0,120,129,0,131,255,0,80,128,0,131,255,0,80,154,0,0,246,134,255,0,149,
+    139,0,0,150,134,255,0,244,131,0,0,153,147,255,0,159,131,0,0,248,134,255,0,145,
+    156,0,0,151,140,255,1,254,53,129,0,0,251,148,255,0,127,130,0,0,78,148,255,0,
+    170,129,0,0,41,149,255,0,134,128,0,0,254,134,255,0,140,130,0,0,1,135,255,0,
+    138,129,0,1,40,248,145,255,0,189,137,0,135,255,0,140,128,0,149,255,136,0,1,16,
+    250,134,255,0,216,135,0,142,255,1,124,248,141,255,128,0,135,255,0,140,138,0,0,142,
+    137,255,0,147,132,0,0,101,144,255,0,140,132,0,150,255,1,227,17,129,0,135,255,0,
+    140,128,0,0,234,128,255,0,164,159,0,3,2,56,133,216,132,255,1,247,40,129,0,0,
+    232,128,255,0,161,145,0,0,169,128,255,0,225,130,0,1,32,225,135,255,1,158,17,129,
+    255,0,109,128,0,0,71,129,255,0,144,134,0,1,28,244,128,255,0,218,129,0,0,246,
+    129,255,0,127,135,0,0,109,129,255,0,58,143,0,0,88,129,255,0,82,141,0,1,1,
+    183,129,255,0,78,128,0,0,240,128,255,0,153,136,0,0,15,129,255,0,120,134,0,0,
+    188,128,255,0,182,137,0,0,159,128,255,0,177,133,0,129,255,0,140,139,0,129,255,0,
+    140,136,0,1,69,248,129,255,1,208,11,132,0,129,255,0,140,137,0,1,27,234,129,255,
+    0,48,128,0,129,255,0,140,143,0,129,255,0,140,129,0,0,58,129,255,0,41,130,0,
+    0,187,128,255,0,69,129,0,0,140,129,255,128,0,129,255,0,140,128,0,129,255,0,140,
+    131,0,132,255,0,92,139,0,1,15,250,130,255,0,128,139,0,0,50,131,255,0,46,144,
+    0,0,157,130,255,1,238,3,133,0,0,100,131,255,0,104,138,0,131,255,0,80,129,0,
+    0,192,130,255,0,83,137,0,0,80,130,255,0,46,129,0,131,255,0,80,128,0,155,255,
+    131,0,0,253,134,255,0,142,139,0,0,143,134,255,0,252,131,0,1,6,183,147,255,0,
+    97,130,0,0,253,134,255,0,143,156,0,0,155,141,255,0,177,129,0,149,255,0,217,130,
+    0,0,89,135,255,3,244,162,170,243,135,255,1,238,1,129,0,0,195,148,255,0,128,128,
+    0,0,253,134,255,0,141,130,0,0,2,135,255,0,136,129,0,0,171,147,255,0,64,136,
+    0,135,255,0,140,128,0,148,255,0,250,136,0,0,82,135,255,0,121,135,0,159,255,128,
+    0,135,255,0,140,137,0,0,122,137,255,1,235,19,131,0,1,11,230,134,255,0,254,135,
+    255,0,140,132,0,151,255,0,140,129,0,135,255,0,140,128,0,0,214,128,255,0,177,163,
+    0,2,49,150,246,130,255,0,168,129,0,0,215,128,255,0,175,145,0,0,183,128,255,0,
+    210,131,0,1,32,197,132,255,3,252,124,0,34,129,255,0,88,128,0,0,152,128,255,1,
+    252,28,135,0,0,150,129,255,0,40,128,0,0,235,129,255,0,68,135,0,0,54,129,255,
+    0,102,143,0,0,37,129,255,0,110,142,0,0,45,129,255,0,152,128,0,0,227,128,255,
+    0,165,136,0,0,25,129,255,0,106,133,0,1,6,246,128,255,0,104,136,0,4,46,253,
+    255,252,42,133,0,129,255,0,140,139,0,129,255,0,140,135,0,1,59,245,129,255,1,232,
+    30,133,0,129,255,0,140,138,0,0,87,129,255,0,137,128,0,129,255,0,140,143,0,129,
+    255,0,140,129,0,1,3,239,128,255,0,111,129,0,4,10,248,255,245,7,129,0,0,140,
+    129,255,128,0,129,255,0,140,128,0,129,255,0,140,131,0,132,255,0,92,140,0,0,184,
+    130,255,0,203,139,0,0,128,130,255,0,220,144,0,1,2,234,130,255,0,164,134,0,1,
+    24,254,130,255,0,190,138,0,131,255,0,80,129,0,0,120,130,255,0,154,137,0,0,153,
+    129,255,0,227,130,0,131,255,0,80,128,0,155,255,131,0,0,248,134,255,0,146,139,0,
+    0,155,134,255,0,240,132,0,1,7,157,146,255,1,240,16,129,0,0,244,134,255,0,153,
+    156,0,0,106,141,255,1,254,36,128,0,0,252,136,255,3,131,15,96,253,135,255,0,19,
+    129,0,1,38,253,133,255,1,238,39,128,0,1,40,239,135,255,0,42,129,0,0,88,148,
+    255,0,121,128,0,0,249,134,255,0,144,130,0,0,5,135,255,0,131,128,0,1,29,254,
+    147,255,0,171,136,0,135,255,0,140,128,0,148,255,0,201,136,0,0,147,135,255,0,41,
+    135,0,159,255,128,0,135,255,0,140,136,0,0,107,138,255,0,91,132,0,0,127,135,255,
+    0,165,135,255,0,140,132,0,151,255,1,244,15,128,0,135,255,0,140,128,0,0,183,128,
+    255,0,210,165,0,1,37,205,129,255,1,249,16,128,0,0,191,128,255,0,203,145,0,0,
+    220,128,255,0,185,132,0,7,2,89,182,230,250,225,156,44,128,0,0,50,129,255,0,67,
+    128,0,0,204,128,255,0,205,136,0,0,73,129,255,0,90,128,0,0,218,129,255,0,36,
+    135,0,0,20,129,255,0,120,143,0,0,15,129,255,0,127,143,0,0,214,128,255,0,210,
+    128,0,0,209,128,255,0,182,136,0,0,44,129,255,0,85,133,0,0,63,129,255,0,40,
+    136,0,0,185,128,255,0,157,134,0,129,255,0,140,139,0,129,255,0,140,134,0,1,49,
+    240,129,255,1,244,54,134,0,129,255,0,140,138,0,1,5,235,128,255,0,197,128,0,129,
+    255,0,140,143,0,129,255,0,140,130,0,0,172,128,255,0,180,129,0,0,75,128,255,0,
+    180,130,0,0,140,129,255,128,0,129,255,0,140,128,0,129,255,0,140,131,0,132,255,0,
+    92,140,0,0,102,130,255,1,254,24,138,0,0,206,130,255,0,137,144,0,0,62,131,255,
+    0,87,135,0,0,201,130,255,1,252,23,137,0,131,255,0,80,129,0,0,47,130,255,0,
+    225,137,0,0,226,129,255,0,154,130,0,131,255,0,80,128,0,155,255,131,0,0,232,134,
+    255,0,160,139,0,0,168,134,255,0,225,134,0,1,75,214,145,255,0,124,129,0,0,234,
+    134,255,0,164,139,0,1,17,7,141,0,1,4,189,141,255,0,107,128,0,0,246,135,255,
+    0,185,129,0,0,161,135,255,0,73,130,0,0,120,132,255,1,251,78,130,0,0,124,135,
+    255,0,90,129,0,1,1,192,147,255,0,112,128,0,0,241,134,255,0,151,130,0,0,14,
+    135,255,0,121,128,0,0,109,136,255,2,185,158,235,135,255,1,243,7,135,0,135,255,0,
+    140,128,0,147,255,1,244,60,136,0,0,213,134,255,0,218,136,0,159,255,128,0,135,255,
+    0,140,135,0,1,93,254,137,255,0,163,132,0,1,24,243,147,255,2,229,135,6,128,0,
+    152,255,0,89,128,0,135,255,0,140,128,0,0,149,128,255,1,247,2,141,0,1,4,3,
+    148,0,1,20,225,129,255,0,76,128,0,0,141,128,255,1,248,4,143,0,1,12,254,128,
+    255,0,136,142,0,0,78,129,255,0,38,128,0,0,237,128,255,0,160,136,0,0,25,129,
+    255,0,122,128,0,0,193,129,255,0,23,135,0,0,5,129,255,0,135,143,0,0,4,129,
+    255,0,133,143,0,0,164,128,255,0,234,128,0,0,184,128,255,0,204,136,0,0,66,129,
+    255,0,59,133,0,0,129,128,255,1,238,1,136,0,146,255,135,0,129,255,0,140,133,0,
+    1,39,234,129,255,1,251,73,135,0,129,255,0,140,139,0,0,179,128,255,0,234,128,0,
+    129,255,0,140,143,0,129,255,0,140,130,0,0,102,128,255,1,244,6,128,0,0,147,128,
+    255,0,107,130,0,0,140,129,255,128,0,129,255,0,140,128,0,129,255,0,140,131,0,132,
+    255,0,92,140,0,1,23,253,130,255,0,98,137,0,0,29,131,255,0,55,144,0,0,143,
+    130,255,1,250,15,135,0,0,123,131,255,0,106,137,0,131,255,0,80,130,0,0,230,130,
+    255,0,40,135,0,0,44,130,255,0,80,130,0,131,255,0,80,128,0,155,255,131,0,0,
+    215,134,255,0,176,139,0,0,187,134,255,0,210,129,0,9,5,64,104,133,163,169,116,90,
+    184,253,142,255,0,216,129,0,0,219,134,255,0,181,137,0,6,21,188,254,253,197,116,35,
+    140,0,5,70,95,64,12,41,197,135,255,0,175,128,0,0,236,135,255,0,85,129,0,0,
+    71,135,255,0,102,131,0,6,35,108,151,192,225,210,81,131,0,0,50,135,255,0,110,130,
+    0,1,34,244,146,255,0,91,128,0,0,227,134,255,0,163,130,0,0,25,135,255,0,107,
+    128,0,0,171,135,255,0,132,128,0,1,30,237,135,255,0,55,135,0,135,255,0,140,128,
+    0,135,255,0,203,136,140,1,114,32,136,0,0,23,135,255,0,138,136,0,159,255,128,0,
+    135,255,0,140,134,0,1,79,251,137,255,1,216,12,132,0,0,145,150,255,0,135,128,0,
+    135,255,0,203,129,140,3,142,152,188,251,135,255,0,160,128,0,135,255,0,140,128,0,0,
+    99,129,255,0,37,141,0,4,68,236,159,78,9,128,0,3,97,127,157,80,140,0,0,106,
+    129,255,0,117,128,0,0,89,129,255,0,47,143,0,0,60,129,255,0,86,142,0,0,134,
+    128,255,1,248,3,128,0,0,251,128,255,0,144,136,0,0,6,129,255,0,135,128,0,0,
+    163,129,255,0,33,135,0,0,10,129,255,0,130,143,0,0,17,129,255,0,117,143,0,0,
+    145,128,255,0,250,128,0,0,154,128,255,0,234,136,0,0,96,129,255,0,24,133,0,0,
+    191,128,255,0,182,137,0,146,255,135,0,129,255,0,140,132,0,1,22,224,129,255,1,254,
+    93,136,0,129,255,0,140,139,0,0,152,128,255,0,250,128,0,129,255,0,140,143,0,129,
+    255,0,140,130,0,0,31,129,255,0,64,128,0,0,218,128,255,0,35,130,0,0,140,129,
+    255,128,0,129,255,0,140,128,0,129,255,0,140,131,0,132,255,0,92,141,0,0,195,130,
+    255,0,173,137,0,0,107,130,255,1,228,1,144,0,0,223,130,255,0,188,136,0,0,46,
+    131,255,0,192,137,0,131,255,0,80,130,0,0,159,130,255,0,111,135,0,0,117,129,255,
+    1,249,12,130,0,131,255,0,80,128,0,155,255,131,0,0,197,134,255,0,215,139,0,0,
+    232,134,255,0,192,128,0,1,34,217,132,255,5,186,2,27,109,190,250,140,255,0,36,128,
+    0,0,189,134,255,0,218,137,0,0,185,132,255,1,203,62,131,0,6,16,77,119,162,198,
+    189,90,131,0,1,26,245,134,255,0,213,128,0,0,219,135,255,0,37,129,0,0,23,135,
+    255,0,119,131,0,6,44,83,110,138,152,114,12,131,0,0,13,135,255,0,127,131,0,1,
+    67,247,145,255,0,68,128,0,0,211,134,255,0,180,130,0,0,42,135,255,0,88,128,0,
+    0,213,134,255,1,232,10,129,0,0,118,135,255,0,98,135,0,135,255,0,140,128,0,135,
+    255,0,140,148,0,0,88,135,255,0,61,136,0,159,255,128,0,135,255,0,140,133,0,1,
+    58,248,137,255,1,239,38,133,0,0,223,150,255,0,229,128,0,135,255,0,140,132,0,1,
+    68,253,134,255,0,206,128,0,135,255,0,140,128,0,0,41,129,255,0,106,141,0,0,124,
+    129,255,0,127,128,0,0,240,128,255,0,146,140,0,0,32,129,255,0,134,128,0,0,31,
+    129,255,0,124,143,0,0,141,129,255,0,32,142,0,0,192,128,255,0,209,129,0,0,245,
+    128,255,0,153,136,0,0,12,129,255,0,126,128,0,0,122,129,255,0,56,135,0,0,26,
+    129,255,0,113,129,0,3,77,105,133,104,136,0,0,42,129,255,0,97,128,0,4,37,110,
+    152,195,12,136,0,0,155,128,255,0,237,128,0,0,115,129,255,0,18,135,0,0,137,128,
+    255,0,239,134,0,0,240,128,255,0,125,137,0,146,255,135,0,129,255,0,140,131,0,1,
+    7,198,130,255,0,110,137,0,129,255,0,140,139,0,0,154,128,255,0,247,128,0,129,255,
+    0,140,143,0,129,255,0,140,131,0,0,216,128,255,2,131,0,32,128,255,0,219,131,0,
+    0,140,129,255,128,0,129,255,0,140,128,0,129,255,0,140,131,0,132,255,0,92,141,0,
+    0,114,130,255,1,242,6,136,0,0,185,130,255,0,147,144,0,0,49,131,255,0,110,137,
+    0,0,224,130,255,1,253,24,136,0,131,255,0,80,130,0,0,86,130,255,0,183,135,0,
+    0,191,129,255,0,187,131,0,131,255,0,80,128,0,155,255,131,0,0,157,134,255,1,253,
+    11,137,0,0,22,135,255,0,148,128,0,0,182,134,255,0,61,129,0,3,15,87,170,245,
+    137,255,0,86,128,0,0,156,134,255,1,251,5,135,0,1,25,254,133,255,1,246,42,129,
+    0,1,108,247,132,255,0,102,131,0,0,173,134,255,0,233,128,0,0,198,135,255,0,23,
+    129,0,0,5,135,255,0,135,129,0,1,27,203,132,255,1,211,14,130,0,0,4,135,255,
+    0,133,130,0,2,7,57,158,145,255,0,45,128,0,0,188,134,255,0,204,130,0,0,67,
+    135,255,0,62,128,0,0,238,134,255,0,167,130,0,0,34,135,255,0,122,135,0,135,255,
+    0,140,128,0,135,255,0,140,148,0,0,153,134,255,1,249,7,136,0,159,255,128,0,135,
+    255,0,140,132,0,1,30,233,137,255,1,252,69,134,0,152,255,128,0,135,255,0,140,133,
+    0,0,193,134,255,0,236,128,0,135,255,0,140,128,0,1,1,227,128,255,0,184,141,0,
+    0,197,129,255,0,58,128,0,0,221,128,255,0,199,140,0,0,7,129,255,0,129,129,0,
+    0,197,128,255,1,220,1,141,0,1,2,229,128,255,0,201,129,0,3,28,82,112,123,135,
+    0,1,7,245,128,255,0,147,129,0,0,226,128,255,0,183,136,0,0,37,129,255,0,107,
+    128,0,0,74,129,255,0,106,135,0,0,69,129,255,0,78,129,0,0,234,128,255,0,207,
+    136,0,0,92,129,255,0,50,128,0,0,99,129,255,0,62,136,0,0,186,128,255,0,217,
+    128,0,0,67,129,255,0,68,135,0,0,188,128,255,0,187,133,0,0,34,129,255,0,75,
+    137,0,138,140,129,255,0,203,130,140,135,0,129,255,0,140,131,0,0,149,130,255,0,128,
+    138,0,129,255,0,140,139,0,0,180,128,255,0,229,128,0,129,255,0,140,143,0,129,255,
+    0,140,131,0,0,145,128,255,2,197,0,102,128,255,0,146,131,0,0,140,129,255,128,0,
+    129,255,0,140,128,0,129,255,0,140,129,0,1,50,80,132,255,0,92,141,0,0,32,131,
+    255,0,68,135,0,1,13,249,130,255,0,65,144,0,0,129,131,255,0,33,137,0,0,147,
+    131,255,0,108,136,0,131,255,0,80,130,0,1,17,252,129,255,1,246,8,133,0,1,13,
+    250,129,255,0,113,131,0,131,255,0,80,128,0,131,255,0,80,154,0,0,104,135,255,0,
+    77,137,0,0,94,135,255,0,97,128,0,0,244,134,255,0,115,132,0,2,13,108,239,135,
+    255,0,118,128,0,0,117,135,255,0,57,135,0,0,83,135,255,0,135,128,0,1,46,254,
+    133,255,0,219,131,0,0,145,134,255,0,250,128,0,0,169,135,255,0,33,129,0,0,10,
+    135,255,0,130,129,0,0,176,134,255,0,109,130,0,0,17,135,255,0,116,129,0,1,95,
+    242,146,255,1,253,9,128,0,0,161,134,255,0,236,130,0,0,99,135,255,0,31,128,0,
+    0,251,134,255,0,144,130,0,0,6,135,255,0,135,135,0,135,255,0,140,128,0,135,255,
+    0,140,148,0,0,206,134,255,0,200,137,0,159,255,128,0,135,255,0,140,131,0,1,6,
+    206,138,255,0,101,135,0,152,255,128,0,135,255,0,140,133,0,0,151,134,255,0,250,128,
+    0,135,255,0,140,129,0,0,141,128,255,1,249,30,139,0,1,32,254,128,255,1,239,4,
+    128,0,0,188,128,255,1,252,23,139,0,0,23,129,255,0,107,129,0,0,101,129,255,0,
+    78,141,0,0,89,129,255,0,108,129,0,0,100,128,255,1,253,12,134,0,0,85,129,255,
+    0,78,129,0,0,191,128,255,1,238,4,135,0,0,94,129,255,0,69,128,0,1,15,252,
+    128,255,0,181,135,0,0,130,129,255,0,27,129,0,0,197,128,255,1,252,19,135,0,0,
+    169,128,255,1,246,4,128,0,0,61,129,255,0,135,135,0,1,7,242,128,255,0,168,128,
+    0,1,13,252,128,255,0,136,134,0,1,10,245,128,255,0,125,133,0,0,79,129,255,0,
+    41,149,0,129,255,0,140,139,0,129,255,0,140,130,0,0,76,130,255,0,152,139,0,129,
+    255,0,140,138,0,1,3,231,128,255,0,189,128,0,129,255,0,140,143,0,129,255,0,140,
+    131,0,0,75,128,255,2,251,12,172,128,255,0,74,131,0,0,140,129,255,128,0,129,255,
+    0,140,128,0,129,255,0,140,128,0,0,137,134,255,0,92,142,0,0,207,130,255,0,143,
+    135,0,0,85,130,255,1,235,3,144,0,0,210,130,255,0,211,138,0,0,69,131,255,0,
+    194,136,0,131,255,0,80,131,0,0,197,130,255,0,69,133,0,0,81,130,255,0,39,131,
+    0,131,255,0,80,128,0,131,255,0,80,154,0,0,52,135,255,0,173,137,0,0,185,135,
+    255,0,47,128,0,0,240,134,255,0,159,134,0,0,62,135,255,0,133,128,0,0,61,135,
+    255,0,134,135,0,0,151,135,255,0,141,128,0,0,111,135,255,0,25,130,0,0,156,134,
+    255,0,236,128,0,0,134,135,255,0,65,129,0,0,34,135,255,0,116,129,0,0,242,134,
+    255,0,173,130,0,0,55,135,255,0,99,128,0,1,40,252,134,255,3,242,251,234,188,135,
+    255,0,219,129,0,0,125,135,255,0,24,129,0,0,144,134,255,1,246,1,128,0,0,244,
+    134,255,0,154,130,0,0,11,135,255,0,126,135,0,135,255,0,140,128,0,135,255,0,140,
+    147,0,1,5,249,134,255,0,143,137,0,159,255,128,0,135,255,0,140,131,0,0,141,138,
+    255,0,125,136,0,152,255,128,0,135,255,0,140,133,0,0,152,134,255,0,247,128,0,135,
+    255,0,140,129,0,0,47,129,255,0,157,139,0,0,151,129,255,0,148,129,0,0,125,129,
+    255,0,133,139,0,0,85,129,255,0,61,129,0,1,14,237,128,255,1,225,11,139,0,1,
+    14,230,128,255,1,244,19,129,0,0,58,129,255,0,80,134,0,0,196,128,255,1,238,8,
+    129,0,0,129,129,255,0,86,135,0,0,189,128,255,1,251,11,129,0,0,191,128,255,1,
+    252,35,133,0,1,3,221,128,255,0,214,130,0,0,137,129,255,0,105,134,0,1,28,248,
+    128,255,0,170,129,0,1,8,244,128,255,1,225,4,134,0,0,99,129,255,0,103,129,0,
+    0,193,128,255,1,226,4,133,0,0,95,129,255,0,52,133,0,0,117,128,255,1,254,8,
+    149,0,129,255,0,140,139,0,129,255,0,140,129,0,1,9,225,129,255,1,184,3,139,0,
+    129,255,0,140,138,0,0,76,129,255,0,126,128,0,129,255,0,140,143,0,129,255,0,140,
+    131,0,1,11,249,128,255,4,76,238,255,248,10,131,0,0,140,129,255,128,0,129,255,0,
+    140,128,0,129,255,0,140,128,0,0,243,134,255,0,92,142,0,0,125,130,255,0,218,135,
+    0,0,163,130,255,0,156,144,0,0,35,131,255,0,134,138,0,1,5,241,130,255,1,253,
+    26,135,0,131,255,0,80,131,0,0,125,130,255,0,140,133,0,0,155,129,255,0,221,132,
+    0,131,255,0,80,128,0,131,255,0,80,154,0,1,5,239,134,255,1,253,51,135,0,0,
+    60,135,255,1,241,4,128,0,0,220,134,255,1,228,3,133,0,0,9,135,255,0,129,128,
+    0,1,8,250,134,255,1,229,8,133,0,1,7,235,135,255,0,86,128,0,0,104,135,255,
+    0,89,130,0,0,209,134,255,0,217,128,0,0,90,135,255,0,130,129,0,0,88,135,255,
+    0,85,129,0,0,237,134,255,0,227,130,0,0,122,135,255,0,66,128,0,0,109,134,255,
+    0,226,129,0,0,42,135,255,0,173,129,0,0,84,135,255,0,87,129,0,0,210,134,255,
+    0,203,129,0,0,225,134,255,0,201,130,0,0,52,135,255,0,106,135,0,135,255,0,140,
+    128,0,135,255,0,140,147,0,0,46,135,255,0,87,137,0,159,255,128,0,135,255,0,140,
+    130,0,1,59,254,137,255,0,151,137,0,0,250,150,255,0,250,128,0,135,255,0,140,133,
+    0,0,189,134,255,0,233,128,0,135,255,0,140,130,0,0,185,128,255,1,252,60,137,0,
+    1,48,251,129,255,0,44,129,0,0,54,129,255,1,251,66,137,0,1,1,201,128,255,1,
+    239,5,130,0,0,108,129,255,1,160,1,137,0,1,1,165,129,255,0,123,130,0,1,5,
+    241,128,255,0,186,133,0,0,82,129,255,0,144,130,0,0,48,129,255,1,222,13,133,0,
+    0,78,129,255,0,177,130,0,0,97,129,255,1,185,1,132,0,0,111,129,255,0,122,130,
+    0,0,58,129,255,1,224,13,132,0,1,1,178,129,255,0,70,130,0,0,173,129,255,0,
+    103,133,0,1,23,233,128,255,1,244,19,129,0,0,105,129,255,0,119,132,0,1,13,224,
+    128,255,0,217,134,0,0,154,128,255,0,228,150,0,129,255,0,140,139,0,129,255,0,140,
+    129,0,0,122,129,255,1,231,19,140,0,129,255,0,140,137,0,1,19,224,128,255,1,254,
+    40,128,0,129,255,0,140,143,0,129,255,0,140,132,0,0,189,128,255,0,193,128,255,0,
+    185,132,0,0,140,129,255,128,0,129,255,0,140,128,0,129,255,0,140,128,0,135,255,0,
+    92,142,0,0,44,131,255,0,38,133,0,1,3,237,130,255,0,74,144,0,0,116,131,255,
+    0,97,139,44,0,190,131,255,0,110,135,0,131,255,0,80,131,0,0,53,130,255,0,212,
+    133,0,0,227,129,255,0,147,132,0,131,255,0,80,128,0,131,255,0,80,155,0,0,152,
+    135,255,1,208,12,133,0,1,14,212,135,255,0,166,129,0,0,199,135,255,0,116,133,0,
+    0,49,135,255,0,113,129,0,0,185,135,255,0,123,133,0,0,114,135,255,1,253,18,128,
+    0,0,67,135,255,0,184,129,0,0,79,135,255,0,187,128,0,0,36,135,255,1,234,19,
+    128,0,0,187,135,255,0,46,129,0,0,201,135,255,0,63,128,0,1,15,229,134,255,1,
+    253,13,128,0,0,107,135,255,0,33,128,0,0,161,135,255,0,106,129,0,0,31,135,255,
+    0,190,128,0,0,58,135,255,0,148,129,0,0,203,135,255,0,63,129,0,0,162,135,255,
+    0,82,135,0,135,255,0,140,128,0,135,255,0,140,147,0,0,88,135,255,0,47,137,0,
+    135,255,0,240,139,255,0,240,135,255,128,0,135,255,0,140,129,0,1,2,204,137,255,1,
+    167,2,137,0,0,202,150,255,0,201,128,0,135,255,0,140,132,0,1,48,252,134,255,0,
+    199,128,0,135,255,0,140,130,0,1,57,254,128,255,1,234,33,135,0,1,23,222,129,255,
+    0,174,131,0,0,195,129,255,1,238,70,136,0,0,143,129,255,0,146,131,0,1,4,213,
+    129,255,0,146,136,0,1,1,150,129,255,1,222,8,131,0,0,162,129,255,0,97,131,0,
+    1,50,238,128,255,1,246,26,131,0,0,188,129,255,1,190,12,131,0,1,57,239,129,255,
+    0,60,130,0,1,7,227,129,255,1,148,2,130,0,1,64,248,128,255,1,244,21,131,0,
+    0,202,129,255,1,177,7,130,0,1,3,147,129,255,1,198,1,130,0,0,58,129,255,1,
+    243,54,131,0,1,24,208,129,255,0,142,130,0,1,13,236,128,255,1,249,70,130,0,1,
+    4,171,129,255,0,108,134,0,0,185,128,255,0,195,150,0,129,255,0,140,139,0,129,255,
+    0,140,128,0,1,7,232,129,255,0,85,141,0,129,255,0,140,136,0,1,61,213,129,255,
+    0,176,129,0,129,255,0,140,143,0,129,255,0,140,132,0,0,118,131,255,0,113,132,0,
+    0,140,129,255,128,0,129,255,0,140,128,0,129,255,0,140,128,0,135,255,0,92,143,0,
+    0,218,130,255,0,113,133,0,0,64,130,255,1,241,6,144,0,0,197,151,255,0,196,135,
+    0,131,255,0,80,131,0,1,1,234,130,255,0,27,131,0,0,45,130,255,0,73,132,0,
+    131,255,0,80,128,0,131,255,0,80,155,0,0,56,136,255,1,192,18,131,0,1,21,196,
+    136,255,0,76,129,0,0,148,135,255,2,253,128,7,130,0,1,25,199,135,255,0,74,129,
+    0,0,98,135,255,1,252,73,131,0,1,60,247,135,255,0,201,129,0,0,25,136,255,3,
+    112,24,81,237,135,255,0,125,129,0,0,227,135,255,2,193,35,118,135,255,1,239,2,129,
+    0,0,161,135,255,3,218,50,45,193,135,255,0,210,129,0,0,68,135,255,3,158,22,111,
+    254,135,255,0,36,130,0,0,227,135,255,2,124,31,214,135,255,0,82,129,0,0,149,135,
+    255,4,225,65,27,116,254,135,255,0,25,135,0,135,255,0,140,128,0,135,255,0,140,147,
+    0,0,125,135,255,0,13,137,0,135,255,0,173,139,255,0,172,135,255,128,0,135,255,0,
+    140,129,0,0,84,138,255,0,145,132,140,2,134,84,2,129,0,1,60,244,148,255,1,244,
+    60,128,0,135,255,0,203,130,140,2,144,171,247,135,255,0,153,128,0,135,255,0,140,131,
+    0,0,155,129,255,1,234,72,133,0,1,51,224,129,255,1,245,30,131,0,1,66,254,129,
+    255,2,254,153,42,132,0,1,46,183,129,255,1,244,28,132,0,1,53,249,129,255,1,185,
+    28,133,0,1,30,189,129,255,1,252,66,132,0,1,42,253,128,255,6,252,140,44,17,44,
+    133,247,129,255,0,123,132,0,1,44,246,129,255,6,225,103,34,19,53,144,250,129,255,0,
+    160,132,0,0,80,130,255,5,194,74,23,36,128,249,129,255,0,127,132,0,1,65,254,129,
+    255,5,209,84,25,27,82,200,129,255,1,252,49,132,0,0,172,129,255,6,246,129,44,18,
+    41,118,237,129,255,1,217,12,131,0,0,103,129,255,5,250,138,45,22,68,194,129,255,1,
+    221,8,134,0,0,209,128,255,0,179,150,0,129,255,0,140,139,0,129,255,0,140,128,0,
+    0,84,129,255,0,247,139,140,0,76,128,0,129,255,0,203,133,140,2,145,165,211,130,255,
+    1,241,33,129,0,129,255,0,140,143,0,129,255,0,140,132,0,0,48,131,255,0,41,132,
+    0,0,140,129,255,128,0,129,255,0,140,128,0,129,255,0,140,128,0,0,227,134,255,0,
+    62,143,0,0,137,130,255,0,188,133,0,0,142,130,255,0,166,144,0,1,23,253,151,255,
+    1,254,27,134,0,131,255,0,80,132,0,0,164,130,255,0,98,131,0,0,119,129,255,1,
+    246,8,132,0,131,255,0,80,128,0,131,255,0,80,156,0,0,212,136,255,6,230,113,40,
+    19,43,117,233,136,255,1,224,2,129,0,0,83,137,255,5,239,168,138,137,171,244,135,255,
+    1,254,23,129,0,1,16,245,135,255,6,252,142,49,18,38,126,247,136,255,0,105,130,0,
+    0,208,148,255,0,59,129,0,0,149,147,255,0,172,130,0,0,92,148,255,0,124,129,0,
+    0,23,147,255,0,201,131,0,0,151,146,255,1,248,14,129,0,0,86,148,255,0,217,136,
+    0,135,255,0,140,128,0,135,255,0,140,147,0,0,160,134,255,0,234,138,0,135,255,1,
+    140,218,137,255,1,216,140,135,255,128,0,135,255,0,140,129,0,0,198,147,255,1,185,2,
+    129,0,1,32,115,135,140,135,255,3,203,140,114,32,129,0,152,255,0,83,128,0,135,255,
+    0,140,131,0,1,14,212,129,255,8,254,188,91,45,19,32,79,166,253,129,255,1,254,90,
+    133,0,0,132,132,255,1,208,166,128,138,1,160,213,131,255,0,104,134,0,1,95,254,129,
+    255,8,245,162,76,39,19,41,79,165,246,130,255,0,107,134,0,0,133,137,255,1,185,2,
+    133,0,1,96,254,137,255,1,207,12,133,0,0,126,137,255,1,200,5,133,0,0,125,138,
+    255,0,105,133,0,1,15,218,137,255,1,236,45,133,0,0,164,136,255,1,252,63,135,0,
+    0,231,128,255,0,168,150,0,129,255,0,140,139,0,129,255,0,140,128,0,0,163,143,255,
+    0,140,128,0,143,255,1,247,71,130,0,129,255,0,140,143,0,129,255,0,140,132,0,1,
+    1,232,129,255,0,224,133,0,0,140,129,255,128,0,129,255,0,140,128,0,129,255,0,140,
+    128,0,1,74,227,131,255,1,245,147,144,0,0,56,130,255,1,250,13,132,0,0,219,130,
+    255,0,84,144,0,0,102,153,255,0,112,134,0,131,255,0,80,132,0,0,91,130,255,0,
+    169,131,0,0,192,129,255,0,181,133,0,131,255,0,80,128,0,131,255,0,80,156,0,0,
+    77,153,255,0,102,130,0,1,18,249,151,255,0,199,131,0,0,145,151,255,1,242,12,130,
+    0,0,129,147,255,1,217,2,129,0,0,56,147,255,0,79,130,0,1,19,252,146,255,1,
+    252,27,130,0,0,204,146,255,0,98,131,0,0,63,146,255,0,172,130,0,1,16,243,147,
+    255,0,130,136,0,135,255,0,140,128,0,135,255,0,140,147,0,0,189,134,255,0,200,138,
+    0,135,255,1,140,147,137,255,1,143,140,135,255,128,0,135,255,0,140,128,0,0,38,149,
+    255,0,84,140,0,135,255,0,140,132,0,151,255,1,241,12,128,0,135,255,0,140,132,0,
+    1,32,222,139,255,1,254,114,134,0,1,2,157,141,255,0,142,136,0,1,100,251,139,255,
+    1,252,109,135,0,1,2,159,135,255,1,178,9,135,0,1,89,248,135,255,1,193,16,135,
+    0,1,131,253,134,255,1,203,20,135,0,1,124,254,134,255,1,251,117,135,0,1,25,206,
+    135,255,1,221,40,134,0,1,9,174,134,255,1,251,93,136,0,0,244,128,255,0,156,150,
+    0,129,255,0,140,139,0,129,255,0,140,128,0,0,218,143,255,0,140,128,0,142,255,1,
+    210,53,131,0,129,255,0,140,143,0,129,255,0,140,133,0,0,162,129,255,0,152,133,0,
+    0,140,129,255,128,0,129,255,0,140,128,0,129,255,0,140,155,0,1,1,228,130,255,0,
+    83,131,0,0,42,130,255,1,246,11,144,0,0,183,153,255,0,198,134,0,131,255,0,80,
+    132,0,1,20,253,129,255,1,237,2,129,0,1,14,250,129,255,0,106,133,0,131,255,0,
+    80,128,0,131,255,0,80,157,0,0,185,151,255,1,214,4,131,0,0,153,151,255,0,103,
+    131,0,1,29,249,150,255,0,141,131,0,1,26,247,146,255,0,99,131,0,0,198,145,255,
+    1,223,4,131,0,0,166,146,255,0,169,131,0,0,121,145,255,1,226,8,132,0,0,210,
+    145,255,0,65,131,0,0,144,146,255,1,248,23,136,0,135,255,0,140,128,0,135,255,0,
+    140,147,0,0,212,134,255,0,179,138,0,135,255,1,140,77,137,255,1,71,140,135,255,128,
+    0,135,255,0,140,128,0,0,121,149,255,0,134,140,0,135,255,0,140,132,0,151,255,0,
+    140,129,0,135,255,0,140,133,0,1,21,185,137,255,1,238,76,137,0,1,111,245,137,255,
+    1,246,111,138,0,1,62,221,137,255,1,223,67,138,0,1,100,229,131,255,1,223,99,138,
+    0,2,34,170,250,131,255,2,226,104,2,137,0,1,65,198,131,255,2,240,128,8,137,0,
+    1,59,195,131,255,2,254,191,53,137,0,2,8,122,237,131,255,2,236,131,10,136,0,2,
+    1,111,229,131,255,1,201,56,137,0,0,252,128,255,0,145,150,0,129,255,0,140,139,0,
+    129,255,0,140,128,0,0,247,143,255,0,140,128,0,137,255,5,248,232,199,148,71,1,132,
+    0,129,255,0,140,143,0,129,255,0,140,133,0,0,91,129,255,0,80,133,0,0,140,129,
+    255,128,0,129,255,0,140,128,0,129,255,0,140,156,0,0,149,130,255,0,158,131,0,0,
+    120,130,255,0,175,144,0,1,14,249,153,255,1,254,29,133,0,131,255,0,80,133,0,0,
+    203,130,255,0,56,129,0,0,82,130,255,0,32,133,0,131,255,0,80,128,0,131,255,0,
+    80,157,0,1,42,249,149,255,1,253,58,132,0,1,32,251,149,255,1,230,7,132,0,0,
+    132,149,255,1,231,15,132,0,0,143,145,255,1,213,6,131,0,1,62,254,144,255,0,97,
+    132,0,1,37,252,144,255,1,245,29,131,0,1,17,240,144,255,0,95,133,0,0,78,144,
+    255,0,196,132,0,1,30,244,145,255,0,144,137,0,135,255,0,140,128,0,135,255,0,140,
+    147,0,0,233,134,255,0,168,138,0,135,255,2,140,12,249,135,255,2,246,8,140,135,255,
+    128,0,135,255,0,140,128,0,0,181,149,255,0,140,140,0,135,255,0,140,132,0,150,255,
+    1,235,19,129,0,135,255,0,140,135,0,2,78,187,253,132,255,2,231,130,16,139,0,2,
+    22,139,227,133,255,2,237,149,32,140,0,2,9,109,214,133,255,2,215,111,9,140,0,6,
+    3,61,107,122,105,55,3,141,0,6,15,80,109,120,98,54,1,141,0,5,40,90,118,114,
+    73,9,141,0,5,30,91,116,114,87,30,141,0,6,4,64,104,121,102,65,4,140,0,5,
+    5,68,104,122,100,43,255,0,195,0,0,67,130,255,1,232,1,130,0,0,198,130,255,0,
+    93,144,0,0,88,131,255,0,93,143,0,0,176,131,255,0,114,133,0,131,255,0,80,133,
+    0,0,130,130,255,0,126,129,0,0,155,129,255,0,214,134,0,131,255,0,80,128,0,131,
+    255,0,80,158,0,0,107,149,255,0,123,134,0,0,131,149,255,0,88,133,0,1,8,219,
+    148,255,0,91,133,0,1,15,220,143,255,1,246,43,133,0,0,149,143,255,1,195,2,133,
+    0,0,130,144,255,0,118,133,0,0,123,143,255,1,183,1,134,0,0,173,142,255,1,252,
+    50,133,0,0,95,144,255,1,212,9,137,0,135,255,0,140,128,0,135,255,0,140,147,0,
+    0,244,134,255,0,156,138,0,135,255,2,140,0,191,135,255,2,182,0,140,135,255,128,0,
+    135,255,0,140,128,0,0,227,149,255,0,140,140,0,135,255,0,140,132,0,150,255,0,86,
+    130,0,135,255,0,140,137,0,6,18,71,107,122,115,93,47,145,0,7,40,86,107,123,117,
+    94,52,3,145,0,6,34,85,114,124,113,85,34,255,0,255,0,196,0,1,4,237,130,255,
+    0,53,129,0,1,22,253,129,255,1,250,16,144,0,0,169,130,255,1,252,19,143,0,0,
+    94,131,255,0,200,133,0,131,255,0,80,133,0,0,58,130,255,0,195,129,0,0,227,129,
+    255,0,140,134,0,131,255,0,80,128,0,131,255,0,80,159,0,0,152,147,255,1,166,1,
+    134,0,1,2,185,147,255,0,168,135,0,1,44,242,146,255,0,147,135,0,1,48,246,141,
+    255,1,252,89,134,0,1,6,194,141,255,1,233,34,134,0,1,2,180,142,255,1,176,1,
+    133,0,1,3,190,141,255,1,225,22,135,0,1,18,220,141,255,0,121,135,0,0,154,142,
+    255,1,237,43,138,0,135,255,0,140,128,0,135,255,0,140,147,0,0,252,134,255,0,145,
+    138,0,135,255,2,140,0,120,135,255,2,110,0,140,135,255,128,0,135,255,0,140,128,0,
+    0,247,149,255,0,140,140,0,135,255,0,140,132,0,149,255,0,125,131,0,135,255,0,140,
+    255,0,255,0,255,0,139,0,0,160,130,255,0,125,129,0,0,95,130,255,0,185,144,0,
+    1,7,242,130,255,0,196,144,0,1,17,251,131,255,0,31,132,0,131,255,0,80,133,0,
+    1,3,238,129,255,3,251,13,0,44,130,255,0,66,134,0,131,255,0,80,128,0,131,255,
+    0,80,159,0,1,1,157,145,255,1,168,4,136,0,1,18,210,145,255,1,196,8,136,0,
+    1,72,247,144,255,1,173,2,136,0,1,61,237,139,255,1,247,78,136,0,1,13,193,139,
+    255,1,236,51,136,0,1,10,176,140,255,1,181,8,135,0,1,21,206,139,255,1,219,31,
+    137,0,1,35,224,139,255,1,151,1,135,0,1,1,142,140,255,1,228,42,139,0,0,230,
+    134,255,0,113,128,0,0,230,134,255,0,113,147,0,0,230,134,255,0,113,138,0,0,230,
+    134,255,2,113,0,48,135,255,2,37,0,115,134,255,0,229,128,0,0,230,134,255,0,113,
+    128,0,0,230,149,255,0,113,140,0,0,230,134,255,0,113,132,0,0,230,146,255,1,249,
+    106,132,0,0,230,134,255,0,113,255,0,255,0,255,0,139,0,0,79,130,255,0,196,129,
+    0,0,168,130,255,0,103,144,0,0,75,131,255,0,119,145,0,0,188,131,255,0,116,132,
+    0,131,255,0,80,134,0,0,169,130,255,2,77,0,116,129,255,1,242,5,134,0,131,255,
+    0,80,128,0,131,255,0,80,161,0,1,119,252,141,255,2,253,126,1,138,0,1,17,183,
+    143,255,1,173,9,138,0,1,56,232,141,255,2,254,136,3,138,0,1,39,200,137,255,1,
+    202,51,138,0,2,5,142,253,136,255,1,202,33,138,0,2,2,131,248,136,255,2,250,130,
+    3,137,0,1,11,171,137,255,1,169,19,139,0,1,25,189,136,255,2,250,118,1,138,0,
+    1,99,235,137,255,1,178,29,140,0,0,136,133,255,1,243,32,128,0,0,136,133,255,1,
+    243,32,147,0,0,136,133,255,1,243,32,138,0,0,136,133,255,1,243,32,128,0,0,194,
+    133,255,0,183,128,0,1,32,244,133,255,0,135,128,0,0,136,133,255,1,243,32,128,0,
+    0,136,148,255,1,243,32,140,0,0,136,133,255,1,243,32,132,0,0,136,144,255,2,253,
+    175,39,133,0,0,136,133,255,1,243,32,255,0,255,0,255,0,139,0,1,8,244,129,255,
+    4,251,15,0,3,237,129,255,1,253,23,144,0,0,156,131,255,0,42,145,0,0,106,131,
+    255,0,202,132,0,131,255,0,80,134,0,0,97,130,255,2,146,0,186,129,255,0,174,135,
+    0,131,255,0,80,128,0,131,255,0,80,162,0,1,49,199,139,255,1,202,53,141,0,2,
+    1,104,236,139,255,1,235,97,141,0,2,23,159,254,138,255,1,214,74,142,0,2,88,198,
+    253,132,255,2,207,97,2,141,0,2,46,167,246,132,255,2,205,95,2,141,0,2,31,154,
+    235,132,255,2,243,156,38,141,0,2,66,192,253,131,255,2,252,183,66,142,0,2,1,88,
+    206,132,255,2,244,160,36,141,0,2,16,132,219,132,255,2,249,181,72,142,0,2,6,136,
+    230,129,255,2,250,202,60,129,0,2,6,136,230,129,255,2,250,202,60,148,0,2,6,136,
+    230,129,255,2,250,202,60,139,0,2,6,136,230,129,255,2,250,202,60,129,0,2,21,170,
+    243,129,255,2,241,165,17,129,0,2,60,202,250,129,255,2,230,136,6,128,0,2,6,136,
+    230,129,255,2,250,202,60,129,0,2,6,136,230,144,255,2,250,202,60,141,0,2,6,136,
+    230,129,255,2,250,202,60,133,0,2,6,136,230,137,255,5,247,235,206,166,105,30,135,0,
+    2,6,136,230,129,255,2,250,202,60,255,0,255,0,255,0,141,0,0,172,130,255,2,82,
+    0,58,130,255,0,194,144,0,1,2,233,130,255,0,222,146,0,1,26,254,131,255,0,32,
+    131,0,131,255,0,80,134,0,1,25,254,129,255,2,214,9,247,129,255,0,100,135,0,131,
+    255,0,80,128,0,131,255,0,80,164,0,2,67,169,242,133,255,2,242,170,69,145,0,3,
+    11,104,185,245,133,255,3,252,197,106,10,144,0,2,44,144,233,133,255,3,248,188,88,2,
+    145,0,6,22,78,104,123,115,83,29,146,0,6,11,67,107,123,114,87,32,146,0,7,3,
+    57,93,116,121,102,60,6,145,0,6,19,80,106,122,106,75,15,147,0,6,35,89,117,123,
+    106,64,10,146,0,6,42,84,109,120,98,71,14,255,0,255,0,255,0,255,0,235,0,0,
+    90,130,255,2,151,0,127,130,255,0,112,144,0,0,61,131,255,0,145,147,0,0,200,131,
+    255,0,118,131,0,131,255,0,80,135,0,0,208,130,255,0,98,130,255,0,26,135,0,131,
+    255,0,80,128,0,131,255,0,80,166,0,8,6,50,93,114,124,114,93,50,6,150,0,8,
+    6,59,86,106,123,116,100,62,16,150,0,7,35,83,106,122,114,93,65,9,255,0,255,0,
+    255,0,255,0,255,0,255,0,142,0,1,15,249,129,255,2,214,0,191,130,255,0,30,144,
+    0,0,142,131,255,0,68,147,0,0,118,131,255,0,204,131,0,131,255,0,80,135,0,0,
+    135,130,255,0,226,129,255,0,207,136,0,131,255,0,80,128,0,131,255,0,80,255,0,255,
+    0,255,0,255,0,255,0,255,0,255,0,128,0,0,183,130,255,1,30,247,129,255,0,204,
+    145,0,0,222,130,255,1,242,6,147,0,0,37,132,255,0,34,130,0,131,255,0,80,135,
+    0,0,63,134,255,0,133,136,0,131,255,0,80,128,0,131,255,0,80,255,0,255,0,255,
+    0,255,0,255,0,255,0,255,0,128,0,0,102,130,255,0,149,130,255,0,122,144,0,0,
+    47,131,255,0,171,149,0,0,212,131,255,0,120,130,0,131,255,0,80,135,0,1,4,241,
+    133,255,0,59,136,0,131,255,0,80,128,0,157,255,0,128,255,0,255,0,255,0,255,0,
+    255,0,255,0,231,0,1,22,253,129,255,0,248,130,255,0,40,144,0,0,128,131,255,0,
+    94,149,0,0,131,131,255,0,206,130,0,131,255,0,80,136,0,0,174,132,255,1,238,3,
+    136,0,131,255,0,80,128,0,157,255,0,128,255,0,255,0,255,0,255,0,255,0,255,0,
+    232,0,0,195,133,255,0,213,145,0,0,209,130,255,1,253,20,149,0,0,49,132,255,0,
+    36,129,0,131,255,0,80,136,0,0,102,132,255,0,167,137,0,131,255,0,80,128,0,157,
+    255,0,128,255,0,255,0,255,0,255,0,255,0,255,0,232,0,0,113,133,255,0,131,144,
+    0,0,34,131,255,0,197,151,0,0,223,131,255,0,122,129,0,131,255,0,80,136,0,0,
+    29,132,255,0,93,137,0,131,255,0,80,128,0,157,255,0,128,255,0,255,0,255,0,255,
+    0,255,0,255,0,232,0,0,32,133,255,0,49,144,0,0,115,131,255,0,120,151,0,0,
+    143,131,255,0,208,129,0,131,255,0,80,137,0,0,213,130,255,1,253,21,137,0,131,255,
+    0,80,128,0,157,255,0,128,255,0,255,0,255,0,255,0,255,0,255,0,233,0,0,206,
+    131,255,0,222,145,0,0,195,131,255,0,44,151,0,0,61,132,255,0,38,128,0,131,255,
+    0,80,137,0,0,140,130,255,0,201,138,0,131,255,0,80,128,0,157,255,0,128,255,0,
+    255,0,255,0,255,0,255,0,255,0,233,0,0,125,131,255,0,141,144,0,1,2,125,130,
+    128,0,121,152,0,1,2,125,131,128,0,51,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,149,0,1,73,226,131,255,1,226,72,132,0,1,73,
+    226,128,255,1,245,146,129,0,1,42,208,128,254,1,206,40,137,0,5,5,157,246,255,235,
+    111,134,0,6,22,141,212,241,255,226,72,128,0,1,73,226,128,255,1,245,146,129,0,6,
+    7,172,249,250,231,177,71,142,0,6,29,82,114,124,112,80,26,143,0,4,18,109,127,97,
+    6,143,0,6,40,89,116,122,102,72,12,144,0,8,2,41,88,107,122,117,101,62,14,145,
+    0,6,21,76,110,123,115,86,34,147,0,10,10,89,156,205,233,249,246,229,187,130,45,145,
+    0,5,31,96,121,108,64,6,141,0,6,12,67,108,122,104,77,18,136,0,2,8,151,231,
+    130,255,2,230,151,7,130,0,2,18,167,238,130,255,1,210,102,130,0,2,6,135,229,129,
+    255,2,250,200,59,134,0,8,31,130,201,234,249,229,194,115,21,137,0,7,57,158,221,249,
+    235,202,121,22,139,0,5,75,220,255,252,192,22,133,0,8,9,108,188,233,249,230,185,101,
+    7,142,0,6,6,163,247,255,252,192,22,134,0,2,27,185,253,135,255,2,253,195,26,134,
+    0,8,3,82,181,234,251,235,194,116,12,132,0,1,73,226,140,255,1,226,72,133,0,7,
+    48,148,216,244,242,213,143,43,137,0,8,1,78,169,222,247,238,196,117,16,139,0,9,68,
+    150,210,236,251,242,211,159,79,3,133,0,4,128,250,226,139,6,131,0,131,255,0,92,131,
+    0,128,255,0,92,128,0,131,255,134,0,9,10,92,171,223,246,247,224,174,94,9,135,0,
+    2,151,249,37,136,0,2,192,235,10,135,0,10,1,59,142,196,233,249,246,225,179,106,18,
+    139,0,3,73,198,242,255,133,0,1,22,126,134,0,128,255,0,92,133,0,7,2,98,193,
+    239,245,209,124,12,138,0,6,85,189,239,244,206,118,9,130,0,5,4,163,247,255,233,105,
+    141,0,1,73,226,128,255,1,245,146,129,0,1,73,226,128,255,1,245,146,129,0,1,73,
+    226,128,255,1,245,146,132,0,1,73,226,128,255,1,245,146,135,0,9,7,84,163,214,241,
+    250,229,203,138,54,134,0,1,73,226,138,255,2,249,171,6,128,0,1,73,226,139,255,2,
+    249,171,6,133,0,1,64,209,128,255,3,218,57,71,213,128,255,1,215,52,129,0,1,73,
+    226,132,255,5,254,247,228,192,129,32,140,0,8,22,115,186,232,250,241,212,150,54,134,0,
+    1,73,226,133,255,4,245,222,189,108,20,140,0,2,32,196,254,128,255,1,202,40,141,0,
+    7,43,150,218,246,241,207,132,24,133,0,1,73,226,128,255,1,245,146,133,0,8,26,132,
+    203,238,249,228,176,91,3,136,0,7,38,139,213,243,242,202,122,19,138,0,0,227,133,255,
+    0,226,132,0,0,227,131,255,0,62,128,0,0,181,130,255,1,212,4,136,0,0,124,130,
+    255,1,253,22,132,0,1,48,238,131,255,0,226,128,0,0,227,131,255,0,62,128,0,0,
+    99,132,255,0,132,138,0,2,4,99,206,133,255,2,200,91,2,139,0,1,3,213,129,255,
+    0,167,140,0,2,11,119,221,132,255,2,250,181,58,140,0,2,48,151,240,133,255,2,250,
+    183,70,141,0,2,81,192,253,132,255,2,210,100,4,142,0,2,18,138,244,136,255,1,192,
+    59,135,0,2,6,135,229,136,255,2,237,134,14,130,0,2,6,135,229,129,255,3,239,203,
+    184,246,131,255,2,250,182,57,134,0,0,169,134,255,0,175,129,0,1,6,206,134,255,0,
+    90,129,0,0,136,133,255,1,243,31,131,0,2,3,138,249,133,255,1,238,98,134,0,1,
+    4,151,133,255,1,240,82,137,0,1,22,241,130,255,0,138,132,0,1,66,230,133,255,1,
+    225,66,141,0,0,131,131,255,0,138,134,0,0,156,139,255,0,146,133,0,1,43,213,133,
+    255,1,234,71,131,0,0,227,142,255,0,226,131,0,2,5,151,253,132,255,2,252,145,4,
+    134,0,1,35,194,133,255,1,237,92,136,0,1,45,202,135,255,1,218,56,132,0,0,128,
+    129,255,0,143,131,0,131,255,0,92,131,0,128,255,0,92,128,0,131,255,133,0,1,100,
+    232,134,255,1,230,94,134,0,2,32,251,182,135,0,2,88,255,122,135,0,1,70,207,135,
+    255,2,243,127,5,136,0,1,48,251,129,255,133,0,2,57,252,15,133,0,128,255,0,92,
+    132,0,1,19,197,132,255,1,225,42,135,0,1,7,174,132,255,1,220,36,129,0,0,122,
+    130,255,1,251,19,140,0,0,227,131,255,0,62,128,0,0,227,131,255,0,62,128,0,0,
+    227,131,255,0,62,131,0,0,227,131,255,0,62,133,0,1,93,227,135,255,1,182,34,132,
+    0,0,227,141,255,0,98,128,0,0,227,142,255,0,98,132,0,1,1,220,130,255,1,207,
+    227,130,255,0,194,129,0,0,227,138,255,2,251,137,4,136,0,2,5,130,246,134,255,1,
+    179,24,132,0,0,227,138,255,1,240,86,139,0,0,183,131,255,0,196,139,0,2,4,139,
+    254,132,255,1,245,100,132,0,0,227,131,255,0,62,131,0,1,112,247,133,255,1,212,43,
+    134,0,1,119,248,132,255,1,238,86,137,0,135,255,132,0,132,255,0,92,128,0,0,181,
+    131,255,0,111,135,0,1,30,246,131,255,0,21,131,0,1,6,224,133,255,128,0,132,255,
+    0,92,128,0,0,128,133,255,0,73,136,0,1,52,214,137,255,1,205,43,137,0,1,24,
+    184,131,255,1,149,38,137,0,1,73,230,137,255,1,159,10,136,0,2,13,151,254,138,255,
+    1,177,16,137,0,1,32,194,137,255,1,213,49,140,0,1,77,236,139,255,2,254,142,5,
+    133,0,0,136,140,255,1,231,51,129,0,0,136,142,255,2,254,155,6,131,0,1,11,249,
+    135,255,0,74,128,0,0,119,135,255,0,181,129,0,0,230,134,255,0,113,130,0,1,4,
+    182,137,255,0,112,132,0,1,2,178,136,255,0,91,136,0,0,148,131,255,0,168,131,0,
+    1,82,252,135,255,1,251,85,139,0,1,28,246,131,255,0,168,134,0,0,221,139,255,0,
+    176,132,0,1,68,246,135,255,1,252,82,130,0,144,255,130,0,1,4,186,136,255,1,179,
+    3,132,0,1,43,231,136,255,0,127,134,0,1,79,245,137,255,1,252,118,131,0,5,40,
+    95,200,255,247,9,130,0,129,80,128,255,0,92,131,0,128,255,0,92,128,0,128,255,0,
+    143,128,80,131,0,1,6,169,138,255,1,158,4,133,0,2,166,255,64,133,0,3,5,221,
+    243,17,133,0,1,3,143,129,255,7,228,153,105,85,92,128,195,254,128,255,1,203,23,135,
+    0,4,161,255,244,128,85,131,0,1,85,209,128,255,3,254,210,100,1,130,0,128,255,0,
+    92,131,0,1,6,203,134,255,1,230,20,134,0,0,157,134,255,4,223,13,0,7,231,130,
+    255,1,254,17,140,0,132,255,0,92,128,0,132,255,0,92,128,0,132,255,0,92,131,0,
+    132,255,0,92,131,0,1,4,162,138,255,1,242,55,131,0,142,255,0,128,128,0,143,255,
+    0,128,132,0,0,34,137,255,0,209,129,0,141,255,1,185,7,134,0,1,20,199,137,255,
+    1,230,39,131,0,140,255,1,254,80,137,0,1,19,252,132,255,0,33,138,0,0,162,136,
+    255,0,115,131,0,132,255,0,92,130,0,0,135,136,255,1,242,52,132,0,0,140,135,255,
+    1,254,102,136,0,135,255,132,0,128,255,1,92,0,128,255,0,92,128,0,0,85,131,255,
+    1,236,13,134,0,0,160,131,255,0,179,132,0,0,101,134,255,128,0,132,255,0,92,128,
+    0,0,128,133,255,0,198,135,0,1,87,249,139,255,1,244,73,135,0,1,78,244,133,255,
+    1,250,111,135,0,1,113,254,139,255,1,209,17,134,0,1,19,211,141,255,1,215,20,135,
+    0,1,59,238,139,255,1,248,81,138,0,0,121,143,255,1,181,9,132,0,0,230,141,255,
+    1,220,2,128,0,0,230,144,255,1,179,6,130,0,1,12,250,135,255,3,209,2,25,243,
+    135,255,0,183,129,0,135,255,0,140,130,0,0,143,138,255,1,254,61,131,0,0,114,137,
+    255,1,246,45,134,0,1,80,254,131,255,0,168,130,0,1,40,246,137,255,1,245,44,138,
+    0,0,161,132,255,0,168,133,0,1,7,253,139,255,0,176,131,0,1,40,239,137,255,1,
+    243,31,129,0,144,255,130,0,0,139,138,255,0,132,131,0,1,14,224,138,255,0,91,132,
+    0,1,53,246,140,255,0,86,132,0,0,41,128,255,0,55,133,0,128,255,0,92,136,0,
+    128,255,0,92,132,0,1,1,171,140,255,1,164,1,132,0,2,52,255,194,133,0,2,101,
+    255,146,133,0,1,2,164,128,255,2,222,85,2,132,0,1,45,192,128,255,1,216,16,134,
+    0,2,221,255,138,132,0,0,113,133,255,1,169,2,129,0,128,255,0,92,131,0,0,123,
+    136,255,0,151,133,0,0,54,136,255,2,134,0,98,131,255,0,181,141,0,132,255,0,92,
+    128,0,132,255,0,92,128,0,132,255,0,92,131,0,132,255,0,92,131,0,0,168,140,255,
+    1,239,41,130,0,142,255,0,128,128,0,143,255,0,128,132,0,0,81,137,255,0,165,129,
+    0,142,255,0,153,133,0,1,11,206,139,255,1,227,18,130,0,141,255,1,238,29,136,0,
+    0,97,133,255,0,118,137,0,0,99,137,255,1,253,55,130,0,132,255,0,92,129,0,0,
+    77,138,255,1,227,16,130,0,0,82,137,255,1,251,57,135,0,134,255,0,243,132,0,132,
+    255,0,92,128,0,1,2,215,131,255,0,125,133,0,1,38,252,131,255,0,56,132,0,0,
+    176,133,255,0,243,128,0,132,255,0,92,128,0,0,115,133,255,1,253,17,133,0,1,79,
+    252,141,255,1,248,66,133,0,1,59,249,136,255,0,119,133,0,0,102,142,255,1,195,7,
+    132,0,1,6,203,143,255,1,194,1,133,0,1,50,243,141,255,1,251,72,136,0,0,117,
+    145,255,1,171,1,131,0,143,255,0,35,128,0,146,255,0,138,131,0,0,186,136,255,1,
+    93,162,136,255,0,102,129,0,135,255,0,140,129,0,1,43,254,139,255,1,211,1,129,0,
+    1,26,246,138,255,0,189,133,0,1,59,242,132,255,0,168,130,0,0,182,139,255,0,184,
+    137,0,1,50,254,132,255,0,168,133,0,0,44,140,255,0,171,130,0,1,2,206,139,255,
+    0,157,129,0,0,251,142,255,0,219,129,0,1,30,251,138,255,1,249,27,130,0,0,154,
+    139,255,1,239,22,130,0,1,2,210,141,255,1,245,33,131,0,0,10,128,255,0,76,133,
+    0,128,255,0,92,136,0,128,255,0,92,132,0,0,115,142,255,0,110,133,0,2,204,255,
+    52,131,0,3,1,214,255,41,133,0,0,129,128,255,1,176,14,135,0,1,4,144,128,255,
+    0,179,134,0,2,245,255,99,131,0,7,33,249,255,224,126,252,110,225,128,255,0,118,129,
+    0,128,255,0,92,130,0,1,2,234,136,255,1,246,8,132,0,0,153,136,255,2,233,2,
+    211,131,255,0,67,141,0,132,255,0,92,128,0,132,255,0,92,128,0,132,255,0,92,131,
+    0,132,255,0,92,130,0,0,110,142,255,0,197,130,0,142,255,0,115,128,0,143,255,0,
+    115,132,0,0,129,137,255,0,117,129,0,142,255,1,254,64,132,0,0,158,141,255,0,163,
+    130,0,142,255,0,156,136,0,0,177,133,255,0,204,136,0,1,5,232,138,255,0,184,130,
+    0,132,255,0,92,128,0,1,2,213,139,255,0,130,129,0,1,4,229,138,255,0,205,135,
+    0,134,255,0,137,132,0,0,227,131,255,0,62,129,0,0,98,131,255,1,233,7,132,0,
+    0,152,131,255,0,193,133,0,0,228,133,255,0,137,128,0,132,255,0,92,128,0,1,31,
+    235,133,255,0,57,132,0,1,25,240,143,255,1,233,19,131,0,1,2,208,137,255,1,252,
+    54,131,0,1,39,248,143,255,0,123,132,0,0,127,145,255,0,98,132,0,1,11,223,143,
+    255,1,237,22,134,0,1,67,253,146,255,0,112,131,0,142,255,1,254,16,128,0,146,255,
+    1,251,44,130,0,1,51,253,146,255,1,213,4,129,0,129,255,0,140,128,0,129,255,0,
+    140,129,0,0,160,141,255,0,69,129,0,0,128,140,255,0,50,131,0,1,76,245,133,255,
+    0,168,129,0,0,38,141,255,0,39,136,0,0,191,133,255,0,168,133,0,0,84,140,255,
+    0,105,130,0,0,87,140,255,1,247,12,128,0,0,186,142,255,0,109,129,0,0,131,140,
+    255,0,127,129,0,1,24,249,140,255,0,140,130,0,0,84,143,255,0,150,131,0,0,3,
+    128,255,0,86,133,0,128,255,0,92,136,0,128,255,0,92,131,0,1,28,247,142,255,1,
+    246,26,132,0,2,111,255,159,131,0,2,67,255,202,133,0,4,57,253,255,177,4,138,0,
+    0,150,128,255,0,84,133,0,2,253,255,91,131,0,11,137,255,245,34,44,252,0,22,221,
+    255,237,11,128,0,128,255,0,92,130,0,0,50,138,255,0,60,132,0,0,213,137,255,0,
+    113,131,255,0,208,142,0,132,255,0,92,128,0,132,255,0,92,128,0,132,255,0,92,131,
+    0,132,255,0,92,129,0,1,24,244,143,255,0,67,129,0,141,255,1,234,30,128,0,142,
+    255,1,234,30,132,0,0,176,137,255,0,69,129,0,143,255,0,205,131,0,0,58,142,255,
+    1,254,42,129,0,142,255,1,243,8,134,0,1,10,246,134,255,0,34,135,0,0,78,139,
+    255,1,252,18,129,0,132,255,0,92,128,0,0,65,140,255,1,232,1,128,0,0,84,140,
+    255,0,68,134,0,132,255,1,143,51,133,0,0,148,131,255,130,0,1,7,235,131,255,0,
+    94,131,0,1,16,245,131,255,0,81,133,0,0,245,131,255,1,158,51,129,0,132,255,0,
+    92,129,0,1,18,82,132,255,0,76,132,0,0,174,145,255,0,164,131,0,0,78,139,255,
+    0,181,130,0,1,1,193,144,255,1,244,25,130,0,1,27,248,145,255,0,204,132,0,0,
+    143,145,255,0,166,133,0,1,13,230,147,255,1,243,28,130,0,142,255,0,197,129,0,147,
+    255,0,147,131,0,0,157,146,255,0,64,130,0,135,255,0,140,128,0,1,2,237,132,255,
+    2,208,165,237,132,255,0,153,129,0,0,227,132,255,1,185,224,132,255,0,143,129,0,1,
+    7,148,135,255,0,168,129,0,0,123,132,255,2,236,164,231,132,255,0,110,135,0,0,78,
+    134,255,0,168,133,0,0,124,132,255,132,152,2,149,93,1,130,0,0,192,132,255,2,231,
+    165,246,132,255,0,80,128,0,1,16,123,132,152,0,178,133,255,1,185,1,129,0,0,199,
+    132,255,1,200,201,132,255,0,196,129,0,0,115,133,255,1,193,199,132,255,1,240,6,129,
+    0,0,165,132,255,4,243,184,160,186,247,132,255,1,237,3,130,0,0,1,128,255,0,90,
+    133,0,128,255,0,92,131,0,128,255,0,92,128,0,128,255,0,92,131,0,0,151,132,255,
+    5,251,157,94,98,167,253,132,255,0,150,132,0,3,35,255,242,8,130,0,2,159,255,126,
+    132,0,4,1,201,255,222,14,129,0,14,89,205,247,210,87,0,67,255,251,6,9,214,255,
+    212,1,132,0,128,255,0,89,131,0,5,208,255,158,0,44,252,128,0,0,86,128,255,0,
+    75,128,0,128,255,0,92,130,0,0,81,138,255,0,84,132,0,0,243,143,255,0,94,142,
+    0,132,255,0,92,128,0,132,255,0,92,128,0,132,255,0,92,131,0,132,255,0,92,129,
+    0,0,144,132,255,5,253,172,106,87,126,226,132,255,0,162,129,0,132,255,0,143,133,80,
+    1,73,17,129,0,132,255,0,143,134,80,1,73,17,129,0,1,73,226,140,255,1,248,72,
+    128,0,132,255,5,143,80,81,91,138,250,132,255,0,49,130,0,0,184,132,255,4,230,128,
+    90,125,239,132,255,0,148,129,0,132,255,4,143,80,81,90,168,132,255,0,56,134,0,0,
+    82,135,255,0,119,135,0,0,144,131,255,2,253,116,145,132,255,0,66,129,0,132,255,0,
+    92,128,0,0,139,132,255,2,167,99,225,132,255,0,45,128,0,0,159,132,255,2,170,128,
+    254,131,255,0,157,134,0,132,255,0,92,134,0,0,227,131,255,0,62,130,0,0,141,131,
+    255,0,188,131,0,0,101,131,255,1,230,3,133,0,0,253,131,255,0,91,130,0,132,255,
+    0,92,130,0,0,3,132,255,0,85,131,0,0,62,147,255,0,55,130,0,0,157,140,255,
+    0,27,129,0,0,80,146,255,0,123,130,0,0,127,147,255,0,20,130,0,1,42,253,146,
+    255,0,56,132,0,0,134,149,255,0,146,130,0,142,255,0,116,129,0,147,255,1,232,2,
+    130,0,1,23,242,144,255,0,166,131,0,135,255,0,140,128,0,0,49,132,255,4,197,4,
+    0,39,248,131,255,0,212,128,0,0,41,132,255,3,183,0,29,244,131,255,0,217,129,0,
+    0,164,136,255,0,168,129,0,0,182,132,255,2,52,0,51,132,255,0,146,134,0,1,4,
+    216,134,255,0,168,133,0,0,164,131,255,0,226,138,0,1,20,253,131,255,3,242,34,0,
+    94,132,255,0,128,136,0,0,151,132,255,1,238,24,130,0,0,235,131,255,3,218,3,6,
+    226,131,255,0,233,129,0,0,175,132,255,3,152,0,1,181,132,255,0,69,129,0,0,220,
+    131,255,1,229,24,129,0,1,34,235,132,255,0,43,131,0,2,254,255,92,133,0,128,255,
+    0,92,131,0,128,255,0,92,128,0,128,255,0,92,130,0,1,12,243,131,255,1,244,61,
+    130,0,1,74,247,131,255,1,242,11,132,0,2,220,255,79,129,0,3,3,239,255,54,132,
+    0,0,78,128,255,0,74,128,0,1,3,160,131,255,3,115,105,255,214,128,0,0,77,128,
+    255,0,62,131,0,0,1,128,255,0,85,131,0,5,239,255,110,0,44,252,128,0,3,12,
+    221,180,68,128,0,128,255,0,92,130,0,0,80,138,255,0,78,132,0,0,252,142,255,1,
+    230,6,142,0,132,255,0,92,128,0,132,255,0,92,128,0,132,255,0,92,131,0,132,255,
+    0,92,128,0,1,9,239,131,255,1,247,72,130,0,1,16,219,131,255,0,233,129,0,132,
+    255,0,92,138,0,132,255,0,92,139,0,0,227,142,255,0,226,128,0,132,255,0,92,130,
+    0,0,85,132,255,0,145,129,0,1,30,253,131,255,1,218,23,129,0,1,54,252,131,255,
+    0,228,129,0,132,255,0,92,129,0,0,21,132,255,0,84,134,0,0,162,135,255,0,205,
+    135,0,0,184,131,255,2,177,0,11,132,255,0,85,129,0,132,255,0,92,128,0,0,188,
+    131,255,3,221,4,0,59,132,255,0,75,128,0,0,212,131,255,3,218,3,0,169,131,255,
+    0,223,134,0,132,255,0,92,134,0,132,255,0,92,130,0,0,53,131,255,1,253,24,130,
+    0,0,190,131,255,0,146,134,0,132,255,0,89,130,0,132,255,0,92,130,0,0,1,132,
+    255,0,89,131,0,0,161,147,255,0,156,130,0,0,215,140,255,0,87,129,0,0,177,146,
+    255,0,216,130,0,0,221,147,255,0,67,130,0,0,143,147,255,0,157,131,0,1,21,247,
+    149,255,1,244,13,129,0,142,255,0,36,129,0,148,255,0,41,131,0,0,119,143,255,1,
+    243,26,131,0,0,230,134,255,0,113,128,0,0,88,132,255,0,91,129,0,0,191,131,255,
+    0,239,128,0,0,104,132,255,0,72,128,0,0,159,132,255,0,20,128,0,0,247,136,255,
+    0,168,129,0,0,211,131,255,0,213,128,0,0,12,132,255,0,163,134,0,0,109,135,255,
+    0,168,133,0,0,204,132,255,3,137,140,110,40,134,0,0,80,132,255,0,129,128,0,1,
+    14,251,131,255,0,146,135,0,1,30,249,132,255,0,108,131,0,0,250,131,255,0,176,128,
+    0,0,178,131,255,0,251,129,0,0,221,131,255,1,246,19,128,0,0,56,132,255,0,128,
+    129,0,0,244,131,255,0,177,131,0,0,134,132,255,0,74,131,0,2,248,255,98,133,0,
+    128,255,0,92,131,0,128,255,0,92,128,0,128,255,0,92,130,0,0,84,132,255,0,105,
+    132,0,0,129,132,255,0,83,132,0,2,166,255,149,129,0,3,58,255,249,6,132,0,2,
+    186,255,197,129,0,0,140,128,255,7,182,96,122,241,251,187,255,171,128,0,3,1,229,255,
+    141,131,0,0,6,128,255,0,77,131,0,5,249,255,102,0,44,252,134,0,128,255,0,92,
+    130,0,0,45,138,255,0,37,132,0,0,239,142,255,0,122,143,0,132,255,0,92,128,0,
+    132,255,0,92,128,0,132,255,0,92,131,0,132,255,0,92,128,0,0,78,132,255,0,117,
+    132,0,0,97,131,255,1,254,8,128,0,132,255,0,92,138,0,132,255,0,92,139,0,144,
+    255,128,0,132,255,0,92,131,0,0,196,131,255,0,206,129,0,0,104,132,255,0,74,131,
+    0,0,170,131,255,1,254,7,128,0,132,255,0,92,129,0,0,8,132,255,0,76,133,0,
+    1,4,237,136,255,0,34,134,0,0,125,131,255,2,112,13,113,132,255,0,62,129,0,132,
+    255,0,92,128,0,0,216,131,255,0,147,128,0,0,13,132,255,0,83,128,0,0,237,131,
+    255,0,132,128,0,0,88,132,255,0,15,133,0,132,255,0,92,134,0,132,255,0,92,130,
+    0,1,1,234,131,255,0,95,129,0,1,12,250,131,255,0,71,133,0,0,1,132,255,0,
+    84,130,0,132,255,0,92,131,0,0,254,131,255,0,92,130,0,1,12,244,147,255,1,243,
+    12,129,0,0,239,140,255,0,126,128,0,1,21,250,147,255,0,26,128,0,0,29,148,255,
+    0,99,129,0,1,5,234,147,255,1,243,11,130,0,0,121,151,255,0,86,129,0,141,255,
+    0,195,130,0,148,255,0,81,131,0,1,6,220,142,255,0,116,132,0,0,136,133,255,1,
+    243,32,128,0,0,112,132,255,0,57,129,0,0,187,131,255,0,250,128,0,0,150,131,255,
+    1,254,12,128,0,0,98,132,255,0,59,128,0,137,255,0,168,129,0,0,128,131,255,0,
+    151,128,0,0,93,132,255,0,147,133,0,1,15,235,135,255,0,168,133,0,0,242,136,255,
+    1,193,44,132,0,0,133,132,255,3,191,222,249,232,131,255,1,245,53,135,0,0,144,132,
+    255,1,209,3,131,0,0,229,131,255,3,220,3,2,217,131,255,0,240,129,0,0,240,131,
+    255,0,205,129,0,1,3,252,131,255,0,174,129,0,0,243,131,255,2,241,92,5,129,0,
+    0,80,132,255,0,76,131,0,2,229,255,113,133,0,128,255,0,92,131,0,128,255,0,92,
+    128,0,128,255,0,92,130,0,0,149,131,255,1,238,6,132,0,1,12,247,131,255,0,149,
+    132,0,2,115,255,208,129,0,2,119,255,203,132,0,3,24,254,255,90,128,0,3,55,254,
+    255,131,129,0,1,57,253,128,255,0,128,129,0,2,160,255,195,131,0,0,20,128,255,0,
+    61,131,0,5,229,255,145,0,44,252,134,0,128,255,0,92,130,0,1,1,228,136,255,0,
+    213,133,0,0,205,141,255,1,245,18,143,0,132,255,0,92,128,0,132,255,0,92,128,0,
+    132,255,0,143,131,80,132,255,0,92,128,0,0,144,131,255,1,247,10,132,0,1,17,247,
+    130,255,0,149,129,0,132,255,0,92,138,0,132,255,0,92,139,0,144,255,128,0,132,255,
+    0,92,131,0,0,108,131,255,1,251,8,128,0,0,164,131,255,0,220,132,0,0,78,131,
+    255,0,144,129,0,132,255,0,92,128,0,1,9,95,132,255,0,47,133,0,0,67,137,255,
+    0,120,134,0,4,2,103,173,224,254,135,255,1,253,23,129,0,132,255,0,92,128,0,0,
+    155,131,255,0,89,128,0,0,98,132,255,0,57,128,0,0,251,131,255,0,102,128,0,0,
+    68,132,255,0,46,133,0,132,255,0,92,134,0,132,255,0,92,131,0,0,173,131,255,0,
+    164,129,0,0,75,131,255,1,252,11,133,0,0,6,132,255,0,77,130,0,132,255,0,92,
+    131,0,0,248,131,255,0,98,130,0,0,77,135,255,4,251,99,28,110,252,135,255,0,75,
+    129,0,0,249,139,255,1,252,59,128,0,0,89,135,255,3,242,85,26,181,135,255,0,82,
+    128,0,0,87,135,255,3,126,24,18,97,135,255,0,119,129,0,0,67,135,255,4,226,74,
+    26,87,239,135,255,0,76,130,0,0,222,151,255,0,156,129,0,136,255,1,182,237,128,255,
+    1,228,45,130,0,136,255,2,166,31,120,135,255,0,109,132,0,0,80,141,255,1,213,5,
+    132,0,2,6,136,230,129,255,2,250,202,60,129,0,1,52,253,130,255,1,251,20,128,0,
+    1,7,237,131,255,0,235,128,0,0,183,131,255,0,225,129,0,0,57,132,255,0,95,128,
+    0,137,255,0,168,129,0,9,1,74,139,190,229,189,128,155,184,253,132,255,0,98,133,0,
+    0,139,136,255,0,168,132,0,0,27,138,255,1,250,86,131,0,0,173,139,255,2,163,86,
+    26,135,0,1,15,243,132,255,0,77,132,0,0,199,132,255,1,197,195,132,255,0,200,129,
+    0,0,251,131,255,0,176,130,0,0,244,131,255,0,205,129,0,0,216,133,255,2,237,161,
+    87,128,18,0,238,130,255,1,209,12,131,0,2,191,255,149,133,0,128,255,0,92,131,0,
+    128,255,0,92,128,0,128,255,0,92,130,0,0,195,131,255,0,172,134,0,0,185,131,255,
+    0,194,132,0,3,78,255,251,7,128,0,2,168,255,166,132,0,3,96,255,249,11,128,0,
+    3,187,255,208,2,130,0,0,175,128,255,0,85,129,0,2,117,255,233,131,0,0,54,128,
+    255,0,23,131,0,5,176,255,238,24,44,252,134,0,128,255,0,92,131,0,0,121,136,255,
+    0,90,133,0,0,144,141,255,0,149,144,0,132,255,0,92,128,0,132,255,0,92,128,0,
+    144,255,0,92,128,0,0,191,131,255,0,184,134,0,4,107,246,244,170,79,130,0,139,255,
+    2,249,171,6,129,0,141,255,1,226,72,129,0,0,243,142,255,0,243,128,0,132,255,0,
+    92,131,0,0,53,132,255,0,46,128,0,0,204,131,255,0,155,132,0,5,2,161,253,228,
+    156,72,130,0,142,255,1,235,5,133,0,0,147,137,255,0,205,138,0,1,23,254,134,255,
+    0,178,130,0,132,255,0,92,128,0,9,7,112,169,206,226,147,2,0,61,247,131,255,1,
+    248,14,128,0,0,241,131,255,0,115,128,0,0,82,132,255,0,69,133,0,132,255,0,92,
+    134,0,132,255,0,92,131,0,0,123,131,255,0,217,129,0,0,128,131,255,0,212,134,0,
+    0,21,132,255,0,63,130,0,132,255,0,92,131,0,0,230,131,255,0,113,130,0,0,128,
+    135,255,0,128,129,0,0,134,135,255,0,128,129,0,0,229,135,255,4,206,228,188,141,56,
+    129,0,0,136,135,255,0,99,128,0,0,42,135,255,0,102,128,0,0,94,135,255,3,112,
+    147,192,250,135,255,0,131,129,0,0,119,149,255,0,127,129,0,0,43,152,255,0,202,129,
+    0,135,255,5,254,17,9,85,83,14,131,0,135,255,3,247,13,0,32,135,255,0,124,133,
+    0,0,188,140,255,0,66,146,0,2,61,149,184,128,217,0,94,129,0,0,99,132,255,0,
+    196,128,0,0,215,131,255,0,202,129,0,0,34,132,255,0,128,128,0,0,250,136,255,0,
+    168,134,0,0,116,135,255,1,248,21,132,0,1,33,248,136,255,0,168,132,0,0,67,139,
+    255,1,252,75,130,0,0,204,139,255,1,242,58,136,0,0,103,132,255,0,206,133,0,0,
+    132,140,255,0,126,129,0,0,238,131,255,0,198,129,0,1,10,254,131,255,0,229,129,0,
+    0,164,136,255,7,253,195,151,155,134,109,73,2,132,0,3,116,255,233,15,132,0,128,255,
+    0,92,131,0,128,255,0,92,128,0,128,255,0,92,130,0,0,229,131,255,0,126,134,0,
+    0,131,131,255,0,228,132,0,0,46,128,255,0,39,128,0,2,205,255,135,132,0,2,155,
+    255,194,128,0,0,39,128,255,0,88,131,0,0,112,128,255,0,41,129,0,2,98,255,249,
+    131,0,2,149,255,202,132,0,0,84,128,255,2,210,92,252,134,0,128,255,0,92,131,0,
+    0,97,135,255,0,161,134,0,0,47,141,255,5,225,238,243,203,110,5,139,0,132,255,0,
+    92,128,0,132,255,0,92,128,0,144,255,0,92,128,0,0,226,131,255,0,131,128,0,2,
+    21,191,252,133,255,1,245,146,129,0,141,255,0,98,129,0,142,255,0,226,129,0,0,138,
+    142,255,0,137,128,0,132,255,0,92,131,0,0,22,132,255,0,62,128,0,0,234,131,255,
+    0,117,134,0,0,3,133,0,142,255,0,144,134,0,0,226,138,255,0,35,137,0,0,63,
+    135,255,0,78,130,0,132,255,0,92,135,0,1,44,239,132,255,0,175,129,0,0,220,131,
+    255,0,179,128,0,0,151,132,255,0,81,133,0,132,255,0,92,134,0,132,255,0,92,131,
+    0,0,80,131,255,1,254,11,128,0,0,175,131,255,0,168,133,0,1,17,114,132,255,0,
+    34,130,0,132,255,0,92,131,0,0,198,131,255,1,187,50,129,0,0,178,134,255,1,252,
+    20,129,0,1,22,252,134,255,0,181,129,0,0,192,135,255,0,4,133,0,0,183,134,255,
+    1,245,8,129,0,0,222,134,255,0,50,128,0,1,23,247,147,255,0,137,129,0,0,168,
+    149,255,0,177,129,0,0,113,137,255,2,252,121,228,132,255,0,224,131,255,0,234,129,0,
+    135,255,0,219,136,0,135,255,0,197,128,0,0,9,135,255,0,133,133,0,1,44,252,138,
+    255,0,167,155,0,1,20,232,132,255,0,136,128,0,0,232,131,255,0,182,129,0,0,16,
+    132,255,0,142,128,0,0,178,128,255,1,242,115,132,255,0,168,134,0,0,187,135,255,0,
+    137,133,0,0,169,137,255,0,168,132,0,0,107,140,255,1,233,21,129,0,0,226,140,255,
+    1,234,21,135,0,0,198,132,255,0,83,133,0,1,26,246,138,255,1,241,22,129,0,0,
+    216,131,255,1,244,20,128,0,0,83,132,255,0,242,129,0,0,72,139,255,2,246,132,10,
+    134,0,4,6,200,255,208,100,131,0,128,255,0,92,131,0,128,255,0,92,128,0,128,255,
+    0,92,130,0,0,245,131,255,0,105,134,0,0,111,131,255,0,244,132,0,0,21,128,255,
+    0,67,128,0,2,232,255,112,132,0,2,197,255,149,128,0,3,125,255,247,8,131,0,3,
+    89,255,250,4,129,0,2,107,255,245,129,0,4,45,150,255,248,62,133,0,0,181,129,255,
+    2,254,121,43,132,0,128,255,0,92,130,0,1,110,254,135,255,3,168,176,119,54,132,0,
+    0,152,145,255,1,208,23,138,0,132,255,0,92,128,0,132,255,0,92,128,0,144,255,0,
+    92,128,0,0,243,131,255,0,111,128,0,0,135,137,255,0,62,128,0,141,255,0,128,129,
+    0,143,255,130,0,2,51,80,241,137,255,1,86,51,129,0,132,255,0,92,131,0,0,7,
+    132,255,0,78,128,0,0,247,131,255,0,98,142,0,142,255,0,25,133,0,0,52,132,255,
+    0,172,132,255,0,121,137,0,0,89,135,255,1,202,5,129,0,132,255,0,92,134,0,1,
+    18,224,132,255,1,254,55,129,0,0,171,132,255,2,138,115,249,132,255,0,88,133,0,132,
+    255,0,92,134,0,132,255,0,92,131,0,0,49,132,255,0,42,128,0,0,208,131,255,0,
+    138,132,0,1,30,234,132,255,0,225,131,0,132,255,0,92,131,0,0,144,133,255,0,136,
+    128,0,0,212,134,255,0,209,131,0,0,209,134,255,0,212,129,0,0,120,135,255,2,234,
+    120,9,131,0,0,215,134,255,0,199,130,0,0,119,133,255,0,135,130,0,1,72,227,146,
+    255,0,140,129,0,0,208,149,255,0,211,129,0,0,162,137,255,2,142,0,128,132,255,0,
+    151,131,255,0,248,129,0,135,255,0,176,136,0,135,255,0,162,128,0,0,1,135,255,0,
+    138,134,0,0,149,137,255,1,243,27,154,0,1,3,188,133,255,0,49,128,0,0,242,131,
+    255,0,175,129,0,0,9,132,255,0,152,128,0,0,14,128,115,1,22,0,132,255,0,168,
+    134,0,0,214,135,255,0,115,132,0,0,56,138,255,0,168,132,0,0,147,141,255,0,137,
+    129,0,0,242,141,255,0,166,134,0,0,37,132,255,1,226,3,134,0,0,178,138,255,0,
+    169,130,0,0,165,132,255,3,182,25,41,221,132,255,0,249,129,0,1,2,199,140,255,1,
+    211,33,134,0,1,12,160,128,255,131,0,128,255,0,92,131,0,128,255,0,92,128,0,128,
+    255,0,92,130,0,0,253,131,255,0,95,134,0,0,96,131,255,0,252,132,0,0,11,128,
+    255,0,81,128,0,2,247,255,102,132,0,2,229,255,115,128,0,2,188,255,184,132,0,2,
+    100,255,211,130,0,2,132,255,225,129,0,3,128,255,222,57,134,0,2,9,154,254,130,255,
+    1,191,46,130,0,128,255,0,92,129,0,1,80,254,140,255,1,178,13,130,0,1,6,172,
+    145,255,1,207,5,137,0,132,255,0,92,128,0,132,255,0,92,128,0,144,255,0,92,128,
+    0,0,253,131,255,0,96,128,0,0,164,137,255,0,92,128,0,141,255,0,128,129,0,143,
+    255,131,0,0,17,137,255,0,226,131,0,132,255,0,92,131,0,0,4,132,255,0,88,128,
+    0,0,253,131,255,0,94,142,0,142,255,0,146,133,0,0,132,132,255,0,149,132,255,0,
+    206,137,0,0,103,136,255,0,99,129,0,132,255,0,92,134,0,0,169,133,255,0,140,130,
+    0,0,103,141,255,0,87,133,0,132,255,0,92,134,0,132,255,0,92,131,0,0,22,132,
+    255,0,69,128,0,0,234,131,255,0,112,132,0,0,115,133,255,0,136,131,0,132,255,0,
+    92,131,0,0,53,133,255,0,243,128,0,0,227,134,255,0,169,131,0,0,169,134,255,0,
+    228,129,0,1,25,244,136,255,1,216,40,130,0,0,229,134,255,0,163,130,0,7,2,135,
+    242,252,215,166,117,42,132,0,1,9,222,145,255,0,140,129,0,0,224,149,255,0,226,129,
+    0,0,203,136,255,3,253,27,0,94,131,255,1,252,115,131,255,0,245,129,0,135,255,0,
+    158,136,0,135,255,0,148,129,0,135,255,0,140,134,0,1,19,238,136,255,0,123,155,0,
+    0,155,133,255,0,191,129,0,0,251,131,255,0,170,129,0,0,3,132,255,0,162,133,0,
+    132,255,0,168,134,0,0,240,135,255,1,251,55,131,0,0,198,138,255,0,168,132,0,0,
+    186,141,255,1,236,6,128,0,0,251,141,255,1,252,29,133,0,0,132,132,255,0,124,134,
+    0,1,56,249,138,255,1,253,67,129,0,0,100,142,255,0,253,130,0,1,38,241,140,255,
+    1,224,22,133,0,1,47,222,128,255,131,0,128,255,0,92,131,0,128,255,0,92,128,0,
+    128,255,0,92,130,0,0,241,131,255,0,105,134,0,0,109,131,255,0,237,132,0,0,3,
+    128,255,0,89,128,0,2,253,255,95,132,0,2,243,255,101,128,0,2,230,255,131,132,0,
+    2,124,255,168,130,0,2,177,255,191,129,0,3,128,255,249,109,136,0,1,52,163,130,255,
+    1,246,71,129,0,128,255,0,92,128,0,1,14,231,142,255,0,98,132,0,5,87,190,239,
+    245,208,201,140,255,0,113,137,0,132,255,0,92,128,0,132,255,0,92,128,0,144,255,0,
+    92,128,0,0,246,131,255,0,105,128,0,0,164,137,255,0,92,128,0,141,255,0,115,129,
+    0,142,255,0,243,129,0,1,73,226,140,255,1,226,72,128,0,132,255,0,92,131,0,0,
+    21,132,255,0,80,128,0,0,244,131,255,0,105,134,0,1,9,4,132,0,142,255,1,253,
+    40,132,0,0,212,140,255,0,36,136,0,1,47,251,135,255,0,208,129,0,132,255,0,92,
+    133,0,0,41,133,255,1,189,4,130,0,1,13,242,140,255,0,80,133,0,132,255,0,92,
+    134,0,132,255,0,92,131,0,0,11,132,255,0,82,128,0,0,247,131,255,0,102,132,0,
+    0,128,133,255,0,15,131,0,132,255,0,92,132,0,0,175,133,255,128,0,0,242,134,255,
+    0,151,131,0,0,152,134,255,0,244,130,0,0,118,137,255,1,233,30,129,0,0,243,134,
+    255,0,149,144,0,0,158,146,255,0,140,129,0,0,239,149,255,0,241,129,0,0,230,136,
+    255,0,201,128,0,0,101,131,255,1,217,133,131,255,0,225,129,0,135,255,0,143,136,0,
+    135,255,0,140,129,0,135,255,0,140,134,0,1,19,238,136,255,0,174,154,0,0,135,133,
+    255,1,253,55,129,0,0,254,131,255,0,170,129,0,0,2,132,255,0,163,133,0,132,255,
+    0,168,134,0,0,242,136,255,0,185,130,0,0,86,132,255,0,180,132,255,0,168,132,0,
+    0,186,131,255,4,242,79,11,85,244,132,255,0,60,128,0,0,254,133,255,2,216,172,252,
+    132,255,0,120,133,0,0,217,131,255,1,252,24,133,0,1,4,215,140,255,1,221,5,128,
+    0,1,12,241,141,255,0,247,131,0,1,48,231,140,255,0,177,132,0,4,12,230,255,155,
+    22,131,0,128,255,0,92,131,0,128,255,0,92,128,0,128,255,0,92,130,0,0,224,131,
+    255,0,125,134,0,0,130,131,255,0,218,132,0,0,17,128,255,0,80,128,0,2,246,255,
+    108,132,0,2,253,255,95,128,0,2,250,255,107,132,0,2,177,255,125,129,0,3,9,245,
+    255,129,129,0,4,5,74,243,255,72,136,0,3,44,252,77,189,128,255,1,240,21,128,0,
+    128,255,0,92,128,0,0,109,143,255,0,90,137,0,0,195,140,255,0,216,137,0,132,255,
+    0,92,128,0,132,255,0,92,128,0,144,255,0,92,128,0,0,231,131,255,0,125,128,0,
+    0,151,137,255,0,92,128,0,140,255,1,234,30,129,0,142,255,0,137,129,0,0,227,142,
+    255,0,226,128,0,132,255,0,92,131,0,0,39,132,255,0,66,128,0,0,228,131,255,0,
+    124,133,0,5,113,248,247,180,101,9,129,0,143,255,0,139,131,0,0,36,141,255,0,121,
+    137,0,4,65,143,112,98,224,132,255,0,25,128,0,132,255,0,92,133,0,0,131,132,255,
+    1,213,15,132,0,0,110,140,255,0,69,133,0,132,255,0,92,134,0,132,255,0,92,131,
+    0,0,3,132,255,0,89,128,0,0,253,131,255,0,95,132,0,0,128,133,255,0,27,131,
+    0,132,255,0,92,132,0,0,180,133,255,128,0,0,252,134,255,0,142,131,0,0,143,134,
+    255,0,251,131,0,0,146,137,255,0,194,129,0,0,252,134,255,0,142,132,0,2,15,42,
+    22,134,0,0,82,147,255,0,140,129,0,0,251,149,255,0,254,129,0,0,243,136,255,0,
+    137,128,0,0,129,131,255,1,174,198,131,255,0,200,129,0,135,255,0,140,136,0,135,255,
+    0,140,129,0,135,255,0,140,134,0,0,148,138,255,0,65,152,0,0,127,134,255,0,142,
+    130,0,0,249,131,255,0,176,129,0,0,9,132,255,0,153,133,0,132,255,0,168,134,0,
+    0,146,137,255,0,32,128,0,1,6,222,131,255,1,252,42,132,255,0,168,132,0,1,63,
+    240,129,255,1,253,84,129,0,0,131,132,255,0,117,128,0,0,247,132,255,3,204,10,0,
+    98,132,255,0,179,132,0,0,29,132,255,0,187,134,0,0,86,142,255,0,87,129,0,0,
+    122,141,255,0,240,132,0,2,23,156,250,139,255,0,55,131,0,3,111,255,218,2,132,0,
+    128,255,0,92,131,0,128,255,0,92,128,0,128,255,0,92,130,0,0,193,131,255,0,170,
+    129,0,2,20,95,61,128,0,0,182,131,255,0,194,132,0,0,34,128,255,0,68,128,0,
+    2,233,255,125,132,0,2,243,255,106,128,0,2,248,255,101,131,0,3,7,244,255,81,129,
+    0,0,95,128,255,0,53,131,0,2,123,255,208,136,0,1,44,252,128,0,0,105,128,255,
+    0,131,128,0,128,255,0,92,128,0,0,190,143,255,0,29,136,0,0,54,142,255,0,26,
+    128,0,5,2,91,156,197,212,113,128,0,132,255,0,92,128,0,132,255,0,92,128,0,132,
+    255,0,92,131,0,132,255,0,92,128,0,0,197,131,255,0,171,128,0,1,56,246,136,255,
+    0,92,128,0,132,255,0,143,132,80,1,73,17,130,0,132,255,0,143,134,80,0,51,130,
+    0,144,255,128,0,132,255,0,92,131,0,0,73,132,255,0,37,128,0,0,197,131,255,0,
+    163,132,0,1,13,247,130,255,1,207,19,128,0,132,255,0,143,128,80,2,86,124,245,131,
+    255,0,205,131,0,0,117,141,255,0,207,132,0,5,1,86,153,194,207,101,129,0,0,70,
+    132,255,0,66,128,0,132,255,0,92,133,0,0,199,131,255,1,237,29,133,0,1,1,170,
+    139,255,0,46,133,0,132,255,0,92,134,0,132,255,0,92,131,0,0,17,132,255,0,80,
+    128,0,0,246,131,255,0,108,132,0,0,99,133,255,0,146,131,0,132,255,0,92,131,0,
+    0,49,133,255,0,226,128,0,0,242,134,255,0,151,131,0,0,153,134,255,0,238,132,0,
+    0,84,137,255,0,69,128,0,0,242,134,255,0,151,131,0,1,115,245,128,255,3,237,195,
+    140,35,129,0,1,6,230,147,255,0,140,129,0,0,244,149,255,0,250,129,0,0,253,136,
+    255,0,107,128,0,0,198,131,255,1,161,253,131,255,0,142,129,0,135,255,0,140,136,0,
+    135,255,0,140,129,0,135,255,0,140,133,0,1,43,252,138,255,1,209,3,150,0,0,113,
+    134,255,1,203,6,130,0,0,239,131,255,0,183,129,0,0,16,132,255,0,143,133,0,132,
+    255,0,168,135,0,4,60,65,13,47,220,132,255,0,99,128,0,0,116,142,255,1,226,72,
+    130,0,4,9,58,99,120,63,130,0,0,38,132,255,0,144,128,0,0,236,132,255,0,80,
+    128,0,1,3,229,131,255,0,223,132,0,0,98,132,255,0,102,134,0,0,170,132,255,3,
+    179,25,34,191,132,255,0,169,129,0,1,3,193,140,255,0,224,129,0,7,38,93,119,140,
+    103,30,121,208,137,255,0,150,131,0,2,181,255,142,133,0,128,255,0,92,131,0,128,255,
+    0,92,128,0,128,255,0,92,130,0,0,141,131,255,4,238,8,0,10,224,128,255,2,206,
+    104,244,131,255,0,137,132,0,0,51,128,255,0,39,128,0,2,205,255,142,132,0,2,227,
+    255,131,128,0,2,227,255,129,131,0,0,94,128,255,0,39,128,0,3,6,222,255,199,132,
+    0,0,49,128,255,0,19,135,0,1,44,252,129,0,2,185,255,208,128,0,128,255,0,92,
+    128,0,0,236,131,255,2,223,22,228,134,255,0,212,137,0,0,169,142,255,0,68,128,0,
+    0,155,131,255,1,51,0,132,255,0,89,128,0,132,255,0,92,128,0,132,255,0,92,131,
+    0,132,255,0,92,128,0,0,153,131,255,1,238,7,128,0,1,26,76,129,80,132,255,0,
+    92,128,0,132,255,0,92,138,0,132,255,0,92,139,0,144,255,128,0,132,255,0,92,131,
+    0,0,137,131,255,1,249,6,128,0,0,154,131,255,0,224,132,0,0,72,132,255,0,89,
+    128,0,132,255,0,92,130,0,0,133,131,255,0,241,131,0,0,197,142,255,0,36,131,0,
+    0,168,131,255,0,44,128,0,0,13,132,255,0,85,128,0,132,255,0,92,133,0,0,225,
+    131,255,0,129,134,0,1,89,163,139,255,0,19,133,0,132,255,0,92,134,0,132,255,0,
+    92,131,0,0,34,132,255,0,69,128,0,0,234,131,255,0,125,132,0,2,7,173,249,131,
+    255,0,229,131,0,132,255,0,92,131,0,0,130,132,255,1,227,73,128,0,0,227,134,255,
+    0,168,131,0,0,171,134,255,0,223,131,0,2,12,59,99,136,255,0,155,128,0,0,229,
+    134,255,0,165,130,0,0,63,133,255,1,239,42,128,0,0,88,148,255,0,140,129,0,0,
+    229,149,255,0,201,129,0,0,243,136,255,3,100,0,35,253,131,255,0,245,132,255,0,79,
+    129,0,135,255,0,140,136,0,135,255,0,140,129,0,135,255,0,140,133,0,0,186,140,255,
+    0,103,149,0,0,98,134,255,1,232,31,131,0,0,223,131,255,0,202,129,0,0,36,132,
+    255,0,127,133,0,132,255,0,168,130,0,4,39,95,137,160,82,130,0,0,77,132,255,0,
+    139,128,0,0,222,143,255,0,226,129,0,5,5,64,97,124,136,59,130,0,0,7,132,255,
+    0,161,128,0,0,225,132,255,0,27,129,0,0,182,131,255,0,241,132,0,0,167,131,255,
+    1,253,20,134,0,0,221,131,255,1,240,16,128,0,1,23,244,131,255,0,219,130,0,1,
+    14,197,139,255,0,201,128,0,1,128,253,130,255,0,134,128,0,3,31,107,188,252,133,255,
+    0,210,131,0,2,221,255,112,133,0,128,255,0,92,131,0,128,255,0,92,128,0,128,255,
+    0,92,130,0,0,82,132,255,2,115,0,90,137,255,0,75,132,0,3,81,255,252,8,128,
+    0,2,170,255,172,132,0,2,190,255,172,128,0,2,179,255,192,130,0,4,10,221,255,250,
+    4,128,0,0,150,128,255,0,71,132,0,0,20,128,255,0,58,131,0,1,6,52,128,0,
+    1,44,252,129,0,2,117,255,242,128,0,128,255,0,92,128,0,0,251,131,255,2,174,0,
+    72,134,255,0,126,136,0,1,31,252,142,255,0,84,128,0,0,243,131,255,1,94,3,132,
+    255,0,78,128,0,132,255,0,92,128,0,132,255,0,92,131,0,132,255,0,92,128,0,0,
+    87,132,255,0,113,133,0,132,255,0,92,128,0,132,255,0,92,138,0,132,255,0,92,139,
+    0,0,243,142,255,0,243,128,0,132,255,0,92,131,0,0,209,131,255,0,200,129,0,0,
+    94,132,255,0,69,131,0,0,161,132,255,0,61,128,0,132,255,0,92,130,0,0,98,131,
+    255,0,251,130,0,1,23,253,142,255,0,122,131,0,0,247,131,255,0,110,128,0,0,25,
+    132,255,0,75,128,0,132,255,0,92,133,0,0,249,131,255,0,98,133,0,0,101,132,255,
+    1,249,234,132,255,0,232,134,0,132,255,0,92,134,0,132,255,0,92,131,0,0,51,132,
+    255,0,43,128,0,0,208,131,255,0,142,134,0,0,65,132,255,0,27,130,0,132,255,0,
+    92,131,0,0,192,131,255,0,159,130,0,0,212,134,255,0,207,131,0,0,212,134,255,0,
+    208,129,0,2,96,210,253,138,255,0,217,128,0,0,214,134,255,0,199,130,0,0,147,134,
+    255,0,160,128,0,0,165,148,255,0,140,129,0,0,213,149,255,0,110,129,0,0,229,136,
+    255,2,131,0,168,138,255,1,235,8,129,0,135,255,0,140,136,0,135,255,0,140,129,0,
+    135,255,0,140,132,0,0,77,141,255,1,234,15,147,0,1,66,251,133,255,1,247,56,132,
+    0,0,199,131,255,0,225,129,0,0,59,132,255,0,95,133,0,132,255,0,168,129,0,1,
+    138,253,129,255,1,254,59,129,0,0,19,132,255,0,160,128,0,145,255,128,0,1,4,201,
+    130,255,1,250,46,129,0,0,8,132,255,0,155,128,0,0,200,132,255,0,26,129,0,0,
+    175,131,255,0,251,132,0,0,233,131,255,0,206,135,0,0,245,131,255,0,191,130,0,0,
+    197,131,255,0,244,129,0,2,72,144,178,139,255,0,173,128,0,0,243,131,255,0,216,131,
+    0,1,25,144,132,255,0,242,131,0,2,238,255,99,133,0,128,255,0,92,131,0,128,255,
+    0,92,128,0,128,255,0,92,130,0,1,7,237,131,255,2,247,69,163,136,255,1,241,12,
+    132,0,2,132,255,209,129,0,2,120,255,222,132,0,5,143,255,234,1,0,100,128,255,0,
+    60,128,0,1,6,171,128,255,3,239,1,3,137,128,255,0,159,133,0,0,7,128,255,0,
+    79,130,0,6,99,248,255,20,0,44,252,129,0,2,98,255,248,128,0,128,255,0,92,128,
+    0,0,236,131,255,3,229,7,0,181,133,255,0,80,136,0,0,142,143,255,0,83,128,0,
+    0,241,131,255,1,113,20,132,255,0,63,128,0,132,255,0,92,128,0,132,255,0,92,131,
+    0,132,255,0,92,128,0,1,14,244,131,255,1,247,77,130,0,1,2,106,132,255,0,92,
+    128,0,132,255,0,92,138,0,132,255,0,92,139,0,0,138,142,255,0,137,128,0,132,255,
+    0,92,130,0,0,86,132,255,0,131,129,0,1,22,251,131,255,1,217,18,129,0,1,63,
+    252,131,255,1,240,4,128,0,132,255,0,92,130,0,0,131,131,255,0,238,130,0,0,102,
+    143,255,0,207,131,0,0,225,131,255,0,193,128,0,0,102,132,255,0,52,128,0,0,227,
+    131,255,0,62,133,0,0,251,131,255,0,87,133,0,0,160,131,255,3,175,0,9,234,131,
+    255,0,179,134,0,132,255,0,92,134,0,132,255,0,92,131,0,0,90,132,255,0,11,128,
+    0,0,175,131,255,0,180,134,0,0,22,132,255,0,58,130,0,132,255,0,92,131,0,0,
+    222,131,255,0,113,130,0,0,177,134,255,1,251,19,129,0,1,23,253,134,255,0,170,128,
+    0,0,63,141,255,0,242,128,0,0,180,134,255,1,244,7,129,0,0,197,134,255,0,189,
+    128,0,0,215,136,255,2,243,198,209,135,255,0,141,129,0,0,181,135,255,0,143,130,140,
+    135,255,0,179,129,0,0,197,136,255,1,228,153,139,255,0,132,130,0,135,255,0,140,136,
+    0,135,255,0,140,129,0,135,255,0,140,131,0,1,5,218,142,255,0,141,132,0,2,6,
+    135,229,129,255,2,250,200,59,131,0,1,28,237,133,255,1,252,80,133,0,0,167,131,255,
+    1,254,13,128,0,0,101,132,255,0,62,133,0,132,255,0,168,128,0,0,19,132,255,0,
+    138,129,0,0,18,132,255,0,154,128,0,145,255,128,0,0,60,132,255,0,124,129,0,0,
+    38,132,255,0,137,128,0,0,161,132,255,0,57,129,0,0,204,131,255,0,239,131,0,0,
+    33,132,255,0,145,135,0,0,249,131,255,0,181,130,0,0,179,131,255,0,249,128,0,0,
+    84,132,255,3,129,146,122,127,132,255,0,130,128,0,0,239,131,255,1,252,11,132,0,0,
+    193,131,255,0,251,131,0,2,247,255,93,133,0,128,255,0,92,131,0,128,255,0,92,128,
+    0,128,255,0,92,131,0,0,142,132,255,0,253,137,255,0,144,133,0,2,182,255,152,129,
+    0,0,62,128,255,0,18,131,0,0,71,128,255,10,66,0,10,226,255,239,114,105,212,255,
+    209,128,255,1,185,212,128,255,1,203,13,133,0,0,2,128,255,0,87,130,0,0,98,128,
+    255,3,70,0,44,252,129,0,2,133,255,225,128,0,128,255,0,92,128,0,0,194,132,255,
+    2,166,102,239,133,255,1,225,32,134,0,1,14,242,130,255,0,252,138,255,0,66,128,0,
+    0,218,131,255,1,191,132,132,255,0,24,128,0,132,255,0,92,128,0,132,255,0,92,131,
+    0,132,255,0,92,129,0,0,152,133,255,4,178,104,87,123,213,133,255,0,92,128,0,132,
+    255,0,92,138,0,132,255,0,143,135,80,0,50,130,0,0,111,137,255,0,201,128,80,0,
+    51,129,0,132,255,5,143,80,81,97,154,249,132,255,0,43,130,0,0,180,132,255,4,223,
+    115,89,142,249,132,255,0,156,129,0,132,255,0,143,128,80,2,83,114,240,131,255,0,200,
+    130,0,0,182,131,255,1,249,12,130,0,0,204,132,255,0,37,130,0,0,180,132,255,2,
+    130,113,244,131,255,1,245,5,128,0,0,148,131,255,134,0,132,255,0,28,133,0,0,130,
+    131,255,2,247,96,176,132,255,0,107,134,0,132,255,0,92,134,0,132,255,0,92,131,0,
+    0,140,131,255,0,221,129,0,0,131,131,255,0,231,134,0,0,8,132,255,0,78,130,0,
+    132,255,0,92,131,0,0,237,131,255,0,99,130,0,0,128,135,255,0,129,129,0,0,132,
+    135,255,0,122,128,0,0,118,141,255,0,247,128,0,0,133,135,255,0,91,128,0,1,22,
+    251,134,255,0,157,128,0,0,244,134,255,4,197,44,1,0,171,135,255,0,143,129,0,0,
+    130,135,255,0,92,129,0,0,73,135,255,0,214,129,0,0,154,150,255,1,236,21,130,0,
+    135,255,0,140,136,0,135,255,0,140,129,0,135,255,0,140,131,0,0,115,143,255,1,250,
+    38,131,0,0,136,133,255,1,243,31,130,0,0,190,134,255,0,99,134,0,0,125,132,255,
+    0,73,128,0,0,163,131,255,1,254,19,133,0,132,255,0,168,128,0,0,11,132,255,0,
+    204,129,0,0,65,132,255,0,134,128,0,0,251,143,255,0,251,128,0,0,48,132,255,0,
+    178,129,0,0,119,132,255,0,96,128,0,0,122,132,255,0,121,128,0,1,9,241,131,255,
+    0,208,131,0,0,83,132,255,0,84,135,0,0,231,131,255,0,222,130,0,0,214,131,255,
+    0,230,128,0,0,148,131,255,1,244,2,128,0,0,155,132,255,0,80,128,0,0,217,132,
+    255,0,103,132,0,0,190,131,255,0,235,131,0,2,252,255,91,133,0,128,255,0,92,131,
+    0,128,255,0,92,128,0,128,255,0,92,131,0,1,20,237,143,255,0,39,133,0,2,233,
+    255,77,129,0,3,4,238,255,70,131,0,3,6,232,255,181,128,0,1,67,250,130,255,2,
+    177,28,251,130,255,1,192,19,135,0,128,255,0,91,130,0,0,54,128,255,3,149,0,44,
+    252,128,0,3,6,222,255,169,128,0,128,255,0,92,128,0,0,123,143,255,1,225,27,133,
+    0,0,116,131,255,1,172,189,137,255,0,22,128,0,0,171,138,255,0,230,129,0,132,255,
+    0,92,128,0,132,255,0,92,131,0,132,255,0,92,129,0,1,26,244,144,255,0,90,128,
+    0,132,255,0,92,138,0,143,255,0,136,129,0,0,102,137,255,0,140,132,0,143,255,0,
+    187,131,0,0,61,143,255,0,46,129,0,143,255,0,134,129,0,1,13,249,131,255,0,186,
+    131,0,0,124,132,255,0,123,130,0,0,102,140,255,0,172,129,0,0,227,131,255,0,62,
+    133,0,0,240,131,255,0,62,133,0,0,74,139,255,1,248,20,134,0,132,255,0,92,134,
+    0,132,255,0,92,131,0,0,191,131,255,0,166,129,0,0,76,132,255,0,27,133,0,0,
+    2,132,255,0,87,130,0,132,255,0,92,131,0,0,246,131,255,0,93,130,0,0,77,135,
+    255,4,251,104,27,98,252,135,255,0,73,128,0,0,98,141,255,0,228,128,0,0,86,135,
+    255,3,235,70,28,177,135,255,0,108,128,0,0,251,134,255,3,173,19,45,161,136,255,0,
+    147,129,0,0,79,135,255,4,244,96,25,61,229,135,255,0,179,129,0,0,94,150,255,2,
+    178,83,27,129,0,135,255,0,140,136,0,135,255,0,140,129,0,135,255,0,140,130,0,1,
+    21,240,144,255,0,179,131,0,0,230,134,255,0,113,129,0,0,91,134,255,0,115,135,0,
+    0,67,132,255,3,184,0,30,245,131,255,0,210,134,0,132,255,0,168,129,0,0,228,132,
+    255,3,58,0,9,198,132,255,0,87,128,0,0,186,143,255,0,185,128,0,1,11,254,131,
+    255,4,250,44,0,25,234,132,255,0,38,128,0,0,65,132,255,3,235,26,0,113,132,255,
+    0,159,131,0,0,128,132,255,0,39,135,0,0,198,132,255,0,102,128,0,0,85,132,255,
+    0,195,128,0,0,121,132,255,3,72,0,39,248,131,255,1,251,14,128,0,0,167,132,255,
+    1,243,80,130,0,1,73,251,131,255,0,193,131,0,128,255,0,89,133,0,128,255,0,92,
+    131,0,128,255,0,92,128,0,128,255,0,92,132,0,0,97,143,255,1,213,52,131,0,3,
+    53,255,242,9,130,0,2,159,255,145,132,0,0,123,128,255,0,78,128,0,14,59,194,246,
+    219,110,1,0,108,231,244,201,101,2,0,19,128,88,0,45,131,0,2,253,255,92,130,0,
+    9,1,225,255,246,39,44,252,0,8,166,128,255,0,73,128,0,128,255,0,92,128,0,1,
+    23,248,143,255,0,158,132,0,1,4,225,131,255,1,58,122,136,255,0,209,129,0,0,97,
+    138,255,0,149,129,0,132,255,0,92,128,0,132,255,0,92,131,0,132,255,0,92,130,0,
+    0,105,143,255,1,253,41,128,0,132,255,0,92,138,0,143,255,0,243,129,0,0,144,137,
+    255,0,97,132,0,142,255,1,253,55,132,0,0,173,141,255,0,158,130,0,142,255,1,253,
+    37,129,0,0,87,132,255,0,110,131,0,0,44,132,255,0,208,130,0,1,12,235,139,255,
+    0,54,129,0,132,255,0,92,133,0,132,255,0,92,133,0,1,8,239,138,255,0,148,135,
+    0,132,255,0,92,134,0,132,255,0,92,130,0,1,7,243,131,255,0,101,129,0,1,16,
+    250,131,255,0,87,134,0,132,255,0,91,130,0,132,255,0,92,131,0,0,252,131,255,0,
+    91,130,0,1,12,244,147,255,1,242,10,128,0,0,68,141,255,0,183,128,0,1,18,249,
+    147,255,0,47,128,0,0,234,148,255,0,154,129,0,1,14,245,148,255,0,105,129,0,1,
+    20,253,151,255,1,244,52,128,0,135,255,0,140,136,0,135,255,0,140,129,0,135,255,0,
+    140,130,0,0,153,146,255,0,70,130,0,135,255,0,140,128,0,1,2,219,134,255,132,152,
+    1,122,15,128,0,1,7,242,132,255,1,185,220,132,255,0,143,134,0,132,255,0,168,129,
+    0,0,162,132,255,2,239,164,218,132,255,1,253,21,128,0,1,16,123,133,152,132,255,3,
+    220,152,123,15,129,0,0,201,132,255,2,236,165,231,132,255,0,212,129,0,1,6,238,132,
+    255,2,230,169,251,132,255,0,86,131,0,0,166,131,255,1,252,5,135,0,0,136,132,255,
+    3,254,182,176,252,132,255,0,130,128,0,0,74,132,255,2,229,162,237,132,255,0,181,129,
+    0,0,96,134,255,3,217,167,158,198,133,255,0,122,130,0,0,1,128,255,0,85,133,0,
+    128,255,0,92,130,0,0,2,128,255,0,89,128,0,128,255,0,92,133,0,0,138,143,255,
+    1,239,32,130,0,2,137,255,155,131,0,3,61,255,228,1,131,0,4,10,223,255,238,41,
+    140,0,4,7,189,255,247,35,131,0,2,247,255,97,131,0,0,95,128,255,4,230,134,253,
+    117,213,128,255,0,179,129,0,128,255,0,92,129,0,0,124,143,255,0,162,132,0,0,89,
+    131,255,3,200,0,29,248,135,255,0,105,129,0,1,12,236,136,255,1,251,44,129,0,132,
+    255,0,92,128,0,132,255,0,92,131,0,132,255,0,92,131,0,0,154,141,255,1,247,95,
+    129,0,132,255,0,92,138,0,144,255,129,0,0,187,137,255,0,54,132,0,142,255,0,137,
+    133,0,1,22,226,139,255,1,222,19,130,0,142,255,0,139,130,0,0,168,132,255,0,35,
+    132,0,0,219,132,255,0,38,130,0,0,103,138,255,0,147,130,0,128,255,1,92,0,128,
+    255,0,92,133,0,128,255,1,92,0,128,255,0,92,134,0,0,119,137,255,1,231,19,135,
+    0,132,255,0,92,134,0,132,255,0,92,130,0,0,79,131,255,1,254,24,130,0,0,186,
+    131,255,0,171,134,0,0,253,131,255,0,92,130,0,132,255,0,92,131,0,132,255,0,89,
+    131,0,0,160,147,255,0,156,129,0,1,8,243,140,255,0,114,129,0,0,174,146,255,0,
+    218,129,0,0,207,148,255,0,164,130,0,0,160,147,255,1,251,27,130,0,0,175,152,255,
+    0,141,128,0,135,255,0,140,136,0,135,255,0,140,129,0,135,255,0,140,129,0,1,47,
+    253,135,255,1,248,254,135,255,1,213,4,129,0,135,255,0,140,128,0,0,74,142,255,0,
+    184,129,0,0,158,140,255,0,44,134,0,132,255,0,168,129,0,0,75,141,255,0,173,138,
+    0,132,255,0,168,132,0,0,116,141,255,0,112,130,0,0,145,140,255,1,237,8,131,0,
+    0,199,131,255,0,220,136,0,0,46,141,255,1,254,40,128,0,1,9,246,140,255,0,75,
+    129,0,1,10,231,143,255,1,248,27,130,0,0,12,128,255,0,75,133,0,128,255,0,92,
+    130,0,0,13,128,255,0,80,128,0,128,255,0,92,134,0,0,145,143,255,0,79,130,0,
+    2,221,255,53,132,0,2,211,255,58,132,0,4,62,250,255,235,62,138,0,1,23,190,128,
+    255,0,104,132,0,2,236,255,106,131,0,1,1,153,133,255,1,193,15,129,0,128,255,0,
+    92,129,0,1,4,179,141,255,1,247,44,132,0,0,180,131,255,0,85,128,0,0,122,134,
+    255,1,200,3,130,0,0,90,136,255,0,132,130,0,132,255,0,92,128,0,132,255,0,92,
+    131,0,132,255,0,92,131,0,1,1,139,139,255,1,218,47,130,0,132,255,0,92,138,0,
+    144,255,129,0,0,225,136,255,1,254,12,132,0,141,255,1,167,2,134,0,1,43,230,137,
+    255,1,225,35,131,0,141,255,1,200,5,130,0,0,236,131,255,0,215,133,0,0,140,132,
+    255,0,110,131,0,0,158,136,255,1,183,6,130,0,132,255,0,92,133,0,132,255,0,92,
+    134,0,1,4,191,135,255,1,245,61,136,0,132,255,0,92,133,0,0,2,132,255,0,89,
+    130,0,0,164,131,255,0,193,131,0,0,99,131,255,1,245,10,133,0,0,248,131,255,0,
+    96,130,0,132,255,0,92,130,0,0,1,132,255,0,84,131,0,0,59,147,255,0,59,130,
+    0,0,164,139,255,1,243,17,129,0,0,77,146,255,0,124,129,0,0,147,148,255,0,187,
+    130,0,0,57,147,255,0,165,131,0,0,57,152,255,0,99,128,0,135,255,0,140,136,0,
+    135,255,0,140,129,0,135,255,0,140,129,0,0,190,136,255,1,67,158,136,255,0,108,129,
+    0,129,255,0,140,128,0,129,255,0,140,128,0,0,158,142,255,0,251,129,0,1,42,252,
+    138,255,0,189,135,0,132,255,0,168,130,0,0,203,139,255,1,251,49,138,0,132,255,0,
+    168,132,0,1,12,234,139,255,1,221,8,130,0,1,28,244,139,255,0,123,132,0,0,224,
+    131,255,0,198,137,0,0,177,140,255,0,171,130,0,0,153,139,255,0,197,131,0,0,103,
+    143,255,0,137,131,0,0,54,128,255,0,40,133,0,128,255,0,92,130,0,0,52,128,255,
+    0,54,128,0,128,255,0,92,135,0,1,75,230,140,255,1,252,24,129,0,2,57,255,194,
+    133,0,2,96,255,150,133,0,5,92,252,255,254,156,38,134,0,2,16,116,238,128,255,0,
+    119,133,0,2,210,255,149,132,0,8,1,84,193,249,255,244,200,104,3,130,0,128,255,0,
+    92,130,0,2,7,157,254,132,255,3,251,120,90,253,129,255,0,104,133,0,0,179,130,255,
+    1,222,3,129,0,0,147,132,255,1,206,20,132,0,1,107,250,132,255,1,252,133,131,0,
+    0,227,131,255,0,62,128,0,0,227,131,255,0,62,131,0,0,227,131,255,0,62,133,0,
+    1,72,211,135,255,2,232,109,6,131,0,0,227,131,255,0,62,138,0,0,227,142,255,0,
+    226,129,0,0,212,130,255,1,209,224,130,255,0,201,133,0,0,227,138,255,2,242,117,1,
+    136,0,1,25,175,134,255,2,254,167,17,132,0,0,227,139,255,1,169,13,131,0,0,231,
+    131,255,0,130,133,0,1,52,254,131,255,0,106,131,0,2,1,132,251,132,255,2,252,145,
+    5,131,0,0,227,131,255,0,62,133,0,0,227,131,255,0,62,135,0,1,13,175,133,255,
+    1,222,56,137,0,132,255,1,143,50,131,0,1,87,174,132,255,0,80,129,0,1,9,241,
+    131,255,0,94,131,0,1,12,242,131,255,0,86,133,0,0,237,131,255,1,160,50,129,0,
+    132,255,0,92,129,0,1,17,84,132,255,0,75,132,0,0,169,145,255,0,171,131,0,1,
+    33,246,138,255,0,113,131,0,0,190,144,255,1,233,13,129,0,0,67,148,255,1,237,2,
+    130,0,0,167,145,255,1,251,44,132,0,0,165,137,255,1,132,152,137,255,1,218,6,128,
+    0,135,255,0,140,136,0,135,255,0,140,129,0,135,255,0,140,128,0,0,72,136,255,3,
+    184,0,28,247,135,255,1,237,8,128,0,135,255,0,140,128,0,0,217,143,255,130,0,0,
+    130,137,255,1,246,39,135,0,132,255,0,168,130,0,1,49,247,138,255,0,119,139,0,132,
+    255,0,168,133,0,0,85,138,255,1,252,69,132,0,0,97,138,255,1,214,8,132,0,0,
+    243,131,255,0,186,137,0,1,26,233,138,255,1,230,22,130,0,1,29,241,137,255,1,244,
+    42,132,0,0,160,141,255,1,203,8,129,0,5,40,102,213,255,232,2,130,0,129,80,128,
+    255,0,92,128,0,5,88,130,213,255,250,11,128,0,128,255,0,143,128,80,134,0,10,8,
+    96,174,224,248,249,231,188,120,79,219,130,255,0,188,130,0,2,173,255,69,133,0,3,5,
+    221,245,20,133,0,1,74,235,129,255,8,207,145,106,88,83,97,130,184,247,128,255,1,239,
+    84,134,0,4,146,255,248,123,83,133,0,1,48,252,134,0,128,255,0,92,132,0,7,55,
+    153,218,244,247,213,143,36,128,0,3,83,238,254,146,134,0,1,41,208,128,255,1,212,51,
+    131,0,6,76,186,238,244,206,114,6,134,0,7,36,149,216,244,245,218,151,46,132,0,1,
+    74,227,128,255,1,245,147,129,0,1,74,227,128,255,1,245,147,132,0,1,74,227,128,255,
+    1,245,147,135,0,10,2,69,154,208,240,251,232,206,154,75,7,133,0,1,74,227,128,255,
+    1,245,147,139,0,1,74,227,140,255,1,227,73,129,0,1,65,223,128,255,3,207,58,74,
+    227,128,255,1,204,53,133,0,1,74,227,133,255,4,245,223,178,107,20,140,0,8,53,147,
+    206,240,251,236,204,138,43,134,0,1,74,227,133,255,4,251,238,203,145,52,133,0,1,77,
+    227,128,255,2,249,176,9,134,0,1,118,235,128,255,2,249,174,12,133,0,7,39,145,214,
+    244,243,214,144,44,133,0,1,74,227,128,255,1,245,147,134,0,1,74,227,128,255,1,245,
+    147,138,0,7,73,172,229,250,238,192,108,10,138,0,134,255,0,136,129,0,0,65,134,255,
+    0,58,129,0,0,106,131,255,1,235,9,132,0,0,148,131,255,0,198,133,0,0,216,133,
+    255,0,136,128,0,132,255,0,92,128,0,1,30,234,133,255,0,46,132,0,1,22,236,143,
+    255,1,240,25,132,0,0,102,137,255,0,164,132,0,1,38,248,143,255,0,100,131,0,0,
+    201,148,255,0,68,130,0,1,20,234,144,255,0,132,133,0,1,21,228,148,255,1,248,54,
+    129,0,135,255,0,140,136,0,135,255,0,140,129,0,135,255,0,140,128,0,0,150,135,255,
+    1,253,47,128,0,0,138,136,255,0,66,128,0,135,255,0,140,128,0,0,247,143,255,130,
+    0,1,1,176,135,255,1,253,99,136,0,132,255,0,168,131,0,1,86,250,136,255,1,143,
+    1,139,0,132,255,0,168,134,0,0,124,137,255,0,102,134,0,0,126,136,255,1,234,39,
+    133,0,0,252,131,255,0,174,138,0,1,55,236,136,255,1,234,51,132,0,1,77,251,135,
+    255,1,248,78,133,0,1,6,158,139,255,1,202,21,130,0,0,128,129,255,0,118,131,0,
+    131,255,0,92,128,0,0,180,129,255,0,163,129,0,131,255,144,0,5,11,137,247,255,251,
+    69,129,0,2,37,253,189,135,0,2,91,255,129,134,0,2,21,149,246,136,255,2,249,156,
+    30,135,0,1,34,245,129,255,133,0,1,44,252,134,0,128,255,0,92,143,0,1,9,18,
+    255,0,255,0,192,0,134,255,0,243,129,0,0,142,133,255,1,254,21,128,0,1,3,220,
+    131,255,0,128,133,0,1,33,252,131,255,0,61,132,0,0,163,133,255,0,243,128,0,132,
+    255,0,92,128,0,0,115,133,255,1,246,4,133,0,1,71,250,141,255,1,252,80,134,0,
+    1,100,244,133,255,2,251,134,1,133,0,0,100,142,255,0,158,132,0,1,55,249,147,255,
+    0,128,131,0,1,67,249,142,255,1,190,7,134,0,1,50,244,146,255,1,251,85,130,0,
+    135,255,0,140,136,0,135,255,0,140,129,0,135,255,0,140,128,0,0,150,135,255,0,162,
+    129,0,1,17,238,135,255,0,65,128,0,0,230,134,255,0,113,128,0,0,227,142,255,0,
+    226,131,0,1,4,141,133,255,1,245,82,137,0,0,227,131,255,0,138,132,0,1,64,223,
+    133,255,1,239,104,141,0,0,227,131,255,0,138,135,0,1,92,236,133,255,1,233,79,136,
+    0,1,91,240,133,255,1,205,35,134,0,0,227,131,255,0,138,139,0,1,37,195,134,255,
+    1,193,36,134,0,1,69,234,133,255,1,219,59,136,0,1,92,223,135,255,2,248,137,9,
+    131,0,4,128,251,222,128,2,131,0,131,255,0,92,128,0,4,181,247,239,157,12,129,0,
+    131,255,146,0,2,23,86,40,130,0,2,153,249,41,136,0,2,193,237,11,135,0,11,17,
+    92,160,203,234,248,249,232,212,165,103,25,138,0,3,59,195,242,255,133,0,1,44,252,134,
+    0,128,255,0,92,255,0,255,0,211,0,135,255,129,0,0,189,133,255,0,205,129,0,0,
+    86,131,255,1,239,17,134,0,0,159,131,255,0,180,132,0,0,85,134,255,128,0,132,255,
+    0,92,128,0,0,128,133,255,0,169,135,0,1,79,247,139,255,1,249,88,136,0,1,23,
+    177,131,255,1,142,40,136,0,0,115,140,255,1,173,7,133,0,1,101,254,146,255,0,133,
+    132,0,1,75,245,140,255,1,196,12,136,0,1,55,234,144,255,1,239,77,131,0,0,230,
+    134,255,0,113,136,0,0,230,134,255,0,113,129,0,0,230,134,255,0,113,128,0,1,61,
+    251,133,255,1,232,29,130,0,0,100,134,255,1,221,6,128,0,0,136,133,255,1,243,32,
+    128,0,1,74,227,140,255,1,227,73,133,0,2,46,153,215,128,245,2,208,135,27,138,0,
+    1,74,227,128,255,2,253,193,22,133,0,8,7,103,184,230,249,232,195,116,20,142,0,1,
+    74,227,128,255,2,253,193,22,136,0,8,15,115,192,233,249,228,191,106,16,138,0,8,20,
+    113,196,230,250,231,178,86,2,135,0,1,74,227,128,255,2,253,193,22,141,0,2,73,159,
+    218,128,244,2,219,160,73,137,0,8,13,119,196,236,250,232,181,95,7,138,0,10,4,83,
+    153,209,233,250,247,224,181,113,22,255,0,255,0,255,0,220,0,135,255,129,0,0,225,133,
+    255,0,91,129,0,0,178,131,255,0,118,135,0,1,31,247,130,255,1,254,19,131,0,1,
+    2,209,133,255,128,0,132,255,0,92,128,0,0,128,132,255,1,251,50,136,0,1,48,212,
+    137,255,1,217,54,138,0,0,44,130,255,0,252,139,0,1,78,234,136,255,2,250,127,1,
+    135,0,1,83,244,144,255,1,248,44,133,0,1,44,206,137,255,2,253,135,5,138,0,1,
+    30,184,142,255,1,195,30,132,0,0,136,133,255,1,243,32,136,0,0,136,133,255,1,243,
+    32,129,0,0,136,133,255,1,243,32,129,0,2,80,202,253,129,255,2,246,185,44,132,0,
+    1,105,211,130,255,2,243,179,30,129,0,2,6,136,230,129,255,2,250,202,60,255,0,255,
+    0,255,0,255,0,255,0,178,0,0,227,133,255,0,226,129,0,0,177,132,255,0,155,130,
+    0,0,179,130,255,1,214,5,136,0,0,126,130,255,1,253,21,132,0,1,34,227,131,255,
+    0,226,128,0,0,227,131,255,0,62,128,0,0,99,131,255,1,252,105,138,0,2,4,101,
+    208,133,255,2,210,105,5,139,0,1,19,252,129,255,0,222,140,0,2,15,127,228,132,255,
+    2,241,161,34,138,0,2,26,148,243,132,255,4,232,138,27,138,236,129,255,2,251,200,67,
+    135,0,3,2,91,197,254,132,255,2,241,153,37,142,0,1,78,196,138,255,2,202,83,2,
+    133,0,2,6,136,230,129,255,2,250,202,60,137,0,2,6,136,230,129,255,2,250,202,60,
+    130,0,2,6,136,230,129,255,2,250,202,60,255,0,255,0,255,0,255,0,255,0,218,0,
+    1,74,227,131,255,1,227,73,129,0,6,9,142,218,247,242,195,89,131,0,1,42,208,128,
+    255,1,207,41,137,0,5,5,157,246,255,235,110,134,0,6,16,133,211,241,255,227,73,128,
+    0,1,74,227,128,255,1,245,147,129,0,1,7,173,128,249,2,227,167,53,142,0,6,30,
+    84,115,125,115,84,31,143,0,4,107,238,255,226,71,142,0,7,1,46,94,119,120,97,63,
+    5,142,0,7,5,61,99,119,120,96,49,1,148,0,7,21,75,109,124,115,94,52,3,146,
+    0,11,35,111,167,209,235,247,249,231,212,177,114,48,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,129,0,7,35,144,214,244,243,212,140,32,139,0,5,
+    5,166,247,255,240,129,133,0,7,12,107,200,243,245,216,148,44,133,0,1,73,226,138,255,
+    1,226,72,134,0,4,95,228,255,245,146,133,0,8,9,108,187,232,249,232,194,113,13,135,
+    0,2,31,188,253,134,255,2,249,171,6,137,0,5,10,171,248,255,245,146,135,0,7,50,
+    156,217,246,238,179,210,245,128,255,1,226,72,138,0,1,146,245,128,255,1,226,72,132,0,
+    7,38,148,219,246,244,216,149,15,133,0,7,45,153,221,249,230,183,226,246,128,255,1,226,
+    72,128,0,1,73,226,128,255,1,245,146,137,0,1,73,226,128,255,1,245,146,129,0,1,
+    73,226,128,255,1,245,146,138,0,1,73,226,128,255,1,245,146,129,0,1,73,226,128,255,
+    7,245,218,182,229,249,222,156,47,132,0,1,73,226,128,255,1,245,146,142,0,3,54,172,
+    171,35,131,0,2,14,178,250,128,255,1,205,49,130,0,1,142,241,128,255,1,215,52,134,
+    0,6,4,65,100,121,100,63,3,139,0,7,58,162,217,246,237,194,110,9,138,0,6,1,
+    55,95,120,104,70,6,140,0,6,10,74,105,121,103,52,2,139,0,7,27,79,107,122,118,
+    96,51,1,133,0,1,73,226,128,255,1,245,146,132,0,1,137,242,129,255,1,222,76,130,
+    0,1,70,224,128,255,1,198,41,135,0,1,73,226,139,255,1,226,72,130,0,1,113,235,
+    128,255,2,254,202,32,133,0,1,73,222,129,255,1,209,44,129,0,1,72,223,129,255,1,
+    217,57,132,0,1,47,211,128,255,2,254,206,39,129,0,2,21,188,252,128,255,1,201,48,
+    130,0,1,67,212,129,255,1,209,61,130,0,1,62,208,128,255,2,248,170,9,128,0,1,
+    50,214,128,255,2,254,197,33,134,0,1,105,230,128,255,1,240,131,129,0,1,73,226,128,
+    255,1,245,146,133,0,1,146,245,128,255,1,226,72,128,0,1,73,226,141,255,1,226,72,
+    133,0,9,26,127,194,232,249,235,209,162,75,5,133,0,1,73,226,134,255,5,253,243,218,
+    173,96,7,133,0,1,73,226,133,255,5,252,243,222,181,108,12,138,0,9,10,87,172,215,
+    241,247,224,174,94,9,134,0,1,73,226,128,255,2,247,166,8,132,0,1,146,245,128,255,
+    1,226,72,128,0,1,73,226,129,255,2,252,186,19,133,0,1,123,236,129,255,1,226,72,
+    128,0,1,73,226,128,255,1,245,146,147,0,2,198,255,168,137,0,3,67,117,102,35,131,
+    0,1,73,226,128,255,1,245,146,136,0,5,41,90,119,105,60,1,135,0,6,10,114,207,
+    243,236,186,76,137,0,2,83,255,168,131,0,7,3,97,187,235,249,230,176,75,135,0,6,
+    54,168,230,249,229,166,51,135,0,0,216,135,255,0,176,133,0,6,41,152,220,248,233,174,
+    60,131,0,140,255,131,0,7,8,115,204,244,243,202,111,6,134,0,6,25,142,218,247,236,
+    178,67,136,0,8,25,130,200,236,249,229,200,126,35,149,0,1,113,249,132,255,1,249,114,
+    138,0,0,114,131,255,0,42,131,0,1,52,230,132,255,2,251,122,1,131,0,0,227,140,
+    255,0,226,133,0,1,41,250,130,255,0,62,131,0,1,62,229,133,255,1,228,68,134,0,
+    0,164,138,255,0,98,137,0,0,146,131,255,0,62,132,0,2,3,134,254,136,255,0,226,
+    137,0,0,63,131,255,0,226,131,0,1,84,245,132,255,0,194,132,0,1,127,252,136,255,
+    0,226,128,0,0,227,131,255,0,62,136,0,0,227,131,255,0,62,128,0,0,227,131,255,
+    0,62,137,0,0,227,131,255,0,62,128,0,0,227,136,255,2,252,130,1,130,0,0,227,
+    131,255,0,62,139,0,2,2,122,251,128,255,0,203,131,0,0,114,131,255,0,208,129,0,
+    0,81,131,255,0,194,132,0,2,9,132,236,131,255,2,233,125,6,135,0,1,11,164,133,
+    255,1,224,49,135,0,2,2,110,224,131,255,2,238,136,9,136,0,2,18,153,244,131,255,
+    1,221,92,136,0,1,82,199,133,255,2,227,106,1,131,0,0,227,131,255,0,62,130,0,
+    0,125,132,255,0,234,130,0,0,224,130,255,0,189,135,0,0,227,141,255,0,226,129,0,
+    0,26,132,255,0,199,132,0,1,21,242,131,255,0,185,129,0,0,226,131,255,1,231,13,
+    130,0,1,10,223,131,255,0,177,129,0,0,132,131,255,0,197,129,0,1,3,227,131,255,
+    0,220,130,0,0,218,131,255,0,100,128,0,0,190,131,255,0,182,133,0,1,37,251,131,
+    255,0,42,128,0,0,227,131,255,0,62,131,0,0,63,131,255,0,226,128,0,0,227,143,
+    255,0,226,131,0,2,2,131,248,134,255,1,216,54,132,0,0,227,140,255,1,219,46,132,
+    0,0,227,139,255,1,232,70,136,0,1,88,231,134,255,1,230,94,133,0,0,227,131,255,
+    0,137,131,0,0,63,131,255,0,226,128,0,0,227,132,255,0,154,132,0,0,57,132,255,
+    0,226,128,0,0,227,131,255,0,62,145,0,0,87,128,255,0,168,131,0,129,255,2,56,
+    11,184,129,255,2,254,171,12,129,0,0,227,131,255,0,62,128,0,129,255,3,56,0,52,
+    189,131,255,1,225,88,133,0,1,21,203,132,255,0,139,135,0,3,4,213,255,168,130,0,
+    1,23,200,133,255,1,157,1,132,0,1,122,254,131,255,1,254,119,133,0,1,4,250,135,
+    255,0,176,132,0,1,100,248,131,255,1,254,122,130,0,140,255,130,0,1,25,208,132,255,
+    1,204,22,132,0,1,72,240,132,255,1,153,4,133,0,1,101,247,133,255,2,251,127,4,
+    146,0,0,122,136,255,0,125,137,0,0,190,131,255,0,55,130,0,1,51,245,135,255,0,
+    126,131,0,142,255,132,0,1,1,182,131,255,0,92,130,0,1,70,249,135,255,1,247,64,
+    133,0,0,228,138,255,0,128,136,0,1,39,251,131,255,0,92,132,0,0,140,139,255,137,
+    0,0,92,132,255,130,0,1,36,245,133,255,0,234,131,0,0,133,139,255,128,0,132,255,
+    0,92,136,0,132,255,0,92,128,0,132,255,0,92,137,0,132,255,0,92,128,0,139,255,
+    0,140,130,0,132,255,0,92,138,0,1,3,178,130,255,0,254,131,0,0,121,132,255,0,
+    38,128,0,0,169,131,255,0,200,131,0,1,36,219,135,255,1,211,28,133,0,1,8,199,
+    135,255,1,240,40,133,0,1,19,197,135,255,1,218,34,134,0,1,55,233,135,255,1,159,
+    2,132,0,1,3,163,137,255,1,173,4,130,0,132,255,0,92,129,0,1,79,254,132,255,
+    1,233,2,129,0,0,234,130,255,1,252,12,134,0,143,255,129,0,0,25,133,255,0,78,
+    131,0,0,145,132,255,0,184,129,0,0,226,132,255,0,138,130,0,0,136,132,255,0,176,
+    129,0,0,142,131,255,1,254,12,128,0,0,48,133,255,0,39,128,0,0,33,132,255,0,
+    110,128,0,0,197,131,255,1,251,15,132,0,0,120,132,255,0,48,128,0,132,255,0,92,
+    131,0,0,92,132,255,128,0,145,255,130,0,1,3,179,137,255,1,251,95,131,0,142,255,
+    1,239,40,131,0,141,255,1,251,78,133,0,1,3,161,138,255,1,160,4,131,0,132,255,
+    1,248,32,130,0,0,92,132,255,128,0,133,255,1,234,1,131,0,0,140,133,255,128,0,
+    132,255,0,92,144,0,1,7,222,128,255,0,168,131,0,129,255,1,56,162,131,255,1,237,
+    4,129,0,132,255,0,92,128,0,129,255,2,56,79,249,134,255,0,132,132,0,0,184,128,
+    255,3,231,165,186,253,128,255,0,101,134,0,0,144,128,255,0,168,129,0,1,6,202,128,
+    255,3,245,179,159,201,129,255,0,127,131,0,0,97,129,255,3,196,158,191,254,128,255,0,
+    100,132,0,0,40,128,255,0,181,133,152,0,104,131,0,0,87,129,255,2,198,160,203,129,
+    255,0,85,129,0,136,152,0,221,128,255,0,180,129,0,1,4,201,128,255,0,239,128,169,
+    0,240,128,255,1,194,3,130,0,1,57,249,128,255,3,237,168,170,241,128,255,0,156,132,
+    0,0,106,129,255,4,221,171,156,171,225,129,255,0,155,145,0,1,57,253,136,255,1,253,
+    58,135,0,1,5,245,130,255,1,249,8,129,0,1,9,215,136,255,1,254,61,130,0,142,
+    255,132,0,0,126,132,255,0,92,129,0,1,23,236,137,255,1,228,13,131,0,0,12,139,
+    255,0,128,136,0,0,179,132,255,0,92,131,0,0,72,140,255,137,0,0,92,132,255,130,
+    0,0,146,134,255,0,202,130,0,0,62,140,255,128,0,132,255,0,92,136,0,128,255,1,
+    92,0,128,255,0,92,128,0,132,255,0,92,137,0,132,255,0,92,128,0,140,255,0,58,
+    129,0,132,255,0,92,138,0,0,67,132,255,131,0,0,52,132,255,3,115,0,5,241,131,
+    255,0,131,130,0,1,33,227,137,255,1,221,27,132,0,0,163,137,255,1,204,1,131,0,
+    1,17,207,137,255,1,225,30,132,0,1,49,240,137,255,0,140,132,0,0,148,139,255,0,
+    131,130,0,132,255,0,92,128,0,1,44,243,133,255,0,103,130,0,0,181,131,255,0,69,
+    134,0,143,255,130,0,0,176,132,255,1,210,2,129,0,1,31,249,132,255,0,77,129,0,
+    0,118,132,255,1,249,36,128,0,1,43,250,132,255,0,65,129,0,0,92,132,255,0,58,
+    128,0,0,107,133,255,0,98,128,0,0,84,132,255,0,58,128,0,0,128,132,255,0,86,
+    132,0,0,198,131,255,1,232,2,128,0,132,255,0,92,131,0,0,92,132,255,128,0,145,
+    255,130,0,0,141,139,255,1,249,58,130,0,143,255,1,203,1,130,0,142,255,1,238,24,
+    131,0,1,2,169,140,255,1,167,1,130,0,133,255,0,168,130,0,0,92,132,255,128,0,
+    134,255,0,51,131,0,0,213,133,255,128,0,132,255,0,92,144,0,0,117,129,255,0,168,
+    131,0,129,255,0,121,132,255,0,160,130,0,128,255,1,92,0,128,255,0,92,128,0,129,
+    255,1,99,246,136,255,0,70,130,0,0,84,128,255,1,187,11,128,0,4,55,238,255,234,
+    11,132,0,0,96,129,255,0,168,129,0,0,110,128,255,1,199,26,129,0,4,72,242,255,
+    249,31,129,0,4,14,237,255,246,72,129,0,4,63,243,255,239,16,131,0,0,80,128,255,
+    0,43,138,0,4,31,245,255,244,70,129,0,4,99,254,255,224,3,137,0,4,39,247,255,
+    230,21,129,0,0,96,128,255,1,204,20,128,0,1,23,209,128,255,0,90,129,0,1,4,
+    218,128,255,1,174,13,128,0,1,20,193,128,255,0,76,130,0,4,33,250,255,232,72,130,
+    0,2,1,85,240,128,255,0,88,144,0,0,183,138,255,0,184,135,0,0,55,131,255,0,
+    196,130,0,0,108,138,255,0,191,130,0,0,243,140,255,0,202,131,0,0,122,133,255,0,
+    92,129,0,0,138,139,255,0,123,131,0,0,51,139,255,0,115,135,0,0,66,133,255,0,
+    92,130,0,1,1,208,140,255,137,0,0,92,132,255,130,0,0,213,134,255,0,160,130,0,
+    0,197,140,255,128,0,132,255,0,92,136,0,132,255,0,92,128,0,132,255,0,92,137,0,
+    132,255,0,92,128,0,140,255,0,198,129,0,132,255,0,92,138,0,0,92,132,255,132,0,
+    0,226,131,255,2,192,0,69,132,255,0,52,129,0,1,1,195,129,255,6,245,127,43,20,
+    49,136,248,129,255,0,187,131,0,0,68,139,255,0,78,131,0,0,168,129,255,6,224,105,
+    37,19,45,123,238,129,255,0,191,131,0,1,6,214,129,255,5,238,119,42,19,51,158,129,
+    255,1,253,50,130,0,1,56,254,128,255,7,244,131,54,21,19,46,117,233,129,255,1,241,
+    8,129,0,132,255,3,92,0,19,221,133,255,0,146,131,0,0,120,131,255,0,130,134,0,
+    0,243,141,255,0,238,130,0,1,40,252,132,255,0,91,129,0,0,162,132,255,0,188,130,
+    0,1,6,218,132,255,3,178,0,1,195,132,255,0,165,130,0,0,37,132,255,0,107,128,
+    0,0,166,133,255,0,158,128,0,0,135,131,255,1,249,7,128,0,0,47,132,255,0,161,
+    131,0,1,22,253,131,255,0,153,129,0,132,255,0,92,131,0,0,92,132,255,128,0,0,
+    243,143,255,0,243,129,0,1,37,251,140,255,1,217,2,129,0,144,255,0,78,130,0,143,
+    255,0,143,131,0,0,114,142,255,0,114,130,0,134,255,0,56,129,0,0,92,132,255,128,
+    0,134,255,0,122,130,0,0,29,134,255,128,0,132,255,0,92,143,0,1,19,240,129,255,
+    0,168,131,0,129,255,0,240,128,255,4,188,140,179,252,79,130,0,132,255,0,92,128,0,
+    129,255,0,236,128,255,5,165,62,22,36,113,240,129,255,0,195,130,0,3,194,255,235,19,
+    130,0,0,86,128,255,0,110,131,0,1,101,253,129,255,0,168,129,0,3,219,255,238,22,
+    131,0,0,90,128,255,0,132,129,0,0,100,128,255,0,115,131,0,0,108,128,255,0,95,
+    131,0,3,120,255,252,6,138,0,0,153,128,255,0,86,131,0,0,157,128,255,0,63,137,
+    0,0,190,128,255,0,74,130,0,3,186,255,251,42,130,0,3,50,253,255,181,129,0,0,
+    84,128,255,1,201,4,130,0,3,14,227,255,205,130,0,3,144,255,253,53,133,0,0,70,
+    128,255,0,202,143,0,1,14,252,138,255,1,252,16,134,0,0,115,131,255,0,135,130,0,
+    0,216,139,255,0,48,129,0,0,138,140,255,0,80,129,0,1,19,170,134,255,0,92,128,
+    0,1,2,236,139,255,0,223,131,0,0,91,138,255,1,234,30,134,0,1,2,208,133,255,
+    0,92,130,0,0,56,141,255,137,0,0,92,132,255,130,0,0,238,133,255,1,253,68,129,
+    0,0,40,141,255,128,0,132,255,0,92,136,0,0,227,131,255,0,62,128,0,132,255,0,
+    92,137,0,132,255,0,92,128,0,141,255,0,50,128,0,132,255,0,92,138,0,0,92,132,
+    255,132,0,0,146,131,255,2,251,17,147,131,255,0,227,130,0,0,100,129,255,1,233,42,
+    131,0,1,49,237,129,255,0,94,130,0,0,186,139,255,0,167,130,0,0,73,129,255,1,
+    181,10,131,0,1,26,213,129,255,0,95,130,0,0,119,129,255,1,217,27,131,0,0,118,
+    129,255,0,168,130,0,0,171,128,255,1,248,51,132,0,1,27,224,129,255,0,58,129,0,
+    132,255,2,92,4,190,133,255,1,182,3,131,0,0,60,131,255,0,190,134,0,0,138,141,
+    255,0,152,131,0,0,153,132,255,4,220,5,0,44,253,131,255,1,253,46,131,0,0,76,
+    133,255,1,71,99,132,255,1,241,24,131,0,0,236,131,255,0,155,128,0,0,225,133,255,
+    0,217,128,0,0,186,131,255,0,199,130,0,0,221,131,255,1,234,2,130,0,0,98,132,
+    255,0,71,129,0,132,255,0,92,131,0,0,92,132,255,128,0,0,138,143,255,0,137,129,
+    0,0,138,142,255,0,71,129,0,144,255,0,167,130,0,143,255,1,233,2,129,0,1,36,
+    246,142,255,1,247,27,129,0,134,255,0,198,129,0,0,92,132,255,128,0,134,255,0,192,
+    130,0,0,102,134,255,128,0,132,255,0,92,143,0,2,147,255,207,128,255,0,168,131,0,
+    130,255,1,254,91,129,0,1,42,9,130,0,0,227,131,255,0,62,128,0,131,255,0,101,
+    131,0,1,52,249,128,255,1,254,24,128,0,0,28,128,255,0,135,132,0,2,216,255,190,
+    129,0,4,7,140,254,255,247,128,255,0,168,128,0,0,37,128,255,0,143,132,0,3,1,
+    228,255,202,129,0,3,173,255,249,15,131,0,0,25,128,255,0,147,131,0,2,159,255,219,
+    138,0,3,8,242,255,195,132,0,0,57,128,255,0,122,136,0,0,81,128,255,0,176,131,
+    0,2,235,255,206,132,0,2,211,255,233,129,0,0,164,128,255,0,62,132,0,0,109,128,
+    255,0,47,129,0,2,214,255,199,135,0,0,192,128,255,0,30,142,0,0,64,132,255,1,
+    145,154,132,255,0,65,134,0,0,176,131,255,0,74,129,0,0,41,132,255,1,179,126,132,
+    255,0,124,130,0,0,51,131,80,0,223,132,255,0,160,129,0,1,23,221,135,255,0,92,
+    128,0,0,53,132,255,2,188,93,199,132,255,0,34,130,0,0,130,131,255,0,208,131,80,
+    1,73,17,135,0,0,100,134,255,0,92,130,0,0,136,132,255,1,138,169,133,255,132,0,
+    4,40,150,218,248,232,133,255,128,0,1,73,226,134,255,0,125,130,0,0,112,132,255,1,
+    147,160,133,255,128,0,133,255,4,228,249,228,168,64,131,0,0,148,131,255,129,0,132,255,
+    3,92,0,105,235,128,255,2,254,203,36,129,0,132,255,0,92,128,0,133,255,1,166,150,
+    132,255,0,123,128,0,133,255,4,233,248,218,148,39,132,0,0,73,133,255,1,226,72,130,
+    0,0,65,132,255,1,90,224,131,255,0,148,130,0,0,209,128,255,1,254,58,133,0,0,
+    63,129,255,0,207,129,0,1,22,253,131,255,2,222,95,214,131,255,0,225,130,0,0,190,
+    128,255,1,209,8,133,0,1,27,240,128,255,0,206,129,0,1,1,222,128,255,1,247,35,
+    133,0,0,197,128,255,1,247,11,128,0,1,13,250,128,255,0,141,134,0,0,97,129,255,
+    0,95,129,0,132,255,1,92,149,133,255,1,211,13,132,0,1,7,248,130,255,1,246,5,
+    134,0,0,51,132,80,0,253,132,255,1,237,20,131,0,1,24,244,132,255,2,104,0,179,
+    132,255,0,154,133,0,0,183,132,255,1,235,241,132,255,0,110,132,0,0,182,131,255,2,
+    204,0,28,135,255,2,21,0,236,131,255,0,142,130,0,0,141,132,255,0,54,130,0,0,
+    176,131,255,1,240,5,129,0,132,255,0,92,131,0,0,92,132,255,129,0,0,51,130,80,
+    132,255,0,143,130,80,0,51,130,0,0,208,131,255,4,234,126,89,108,193,132,255,0,142,
+    129,0,132,255,0,143,129,80,2,85,123,236,131,255,0,222,130,0,132,255,0,143,129,80,
+    1,91,192,132,255,0,41,129,0,0,152,132,255,5,252,161,94,98,169,253,132,255,0,151,
+    129,0,135,255,0,86,128,0,0,92,132,255,128,0,134,255,1,250,13,129,0,0,174,134,
+    255,128,0,132,255,0,92,142,0,3,38,251,255,68,128,255,0,168,131,0,130,255,0,157,
+    136,0,1,74,227,128,255,1,245,147,129,0,130,255,0,166,133,0,0,151,129,255,0,75,
+    128,0,0,91,128,255,0,56,132,0,3,140,255,249,12,128,0,0,210,128,255,1,249,76,
+    128,255,0,168,128,0,0,84,128,255,0,82,133,0,2,180,255,239,129,0,2,109,178,179,
+    132,0,0,6,128,255,0,160,131,0,2,199,255,179,138,0,0,69,128,255,0,94,132,0,
+    3,3,132,110,54,135,0,4,2,214,255,247,33,131,0,2,250,255,177,132,0,2,178,255,
+    249,129,0,2,217,255,232,133,0,0,35,128,255,0,118,129,0,2,244,255,177,135,0,0,
+    117,128,255,0,62,142,0,0,85,132,255,1,9,11,132,255,0,84,134,0,0,235,130,255,
+    1,253,16,129,0,0,106,131,255,3,248,18,0,179,131,255,0,196,135,0,1,22,246,131,
+    255,1,238,19,129,0,0,108,136,255,0,92,128,0,0,99,131,255,3,252,20,0,39,132,
+    255,0,72,130,0,0,170,131,255,3,206,73,53,12,138,0,1,12,231,134,255,0,92,130,
+    0,0,188,131,255,3,203,0,6,227,132,255,131,0,1,122,250,137,255,128,0,0,227,135,
+    255,0,226,130,0,0,180,131,255,3,208,0,1,214,132,255,128,0,138,255,1,154,4,129,
+    0,0,227,131,255,0,62,128,0,132,255,2,92,82,254,131,255,0,172,129,0,132,255,0,
+    92,128,0,132,255,3,227,6,0,208,131,255,0,189,128,0,137,255,1,250,119,131,0,0,
+    227,134,255,0,226,130,0,1,3,236,131,255,0,215,132,255,0,69,129,0,0,49,129,255,
+    0,164,135,0,0,167,129,255,0,50,128,0,0,88,132,255,2,98,72,158,131,255,0,251,
+    129,0,1,31,254,128,255,0,68,135,0,0,126,129,255,0,47,128,0,0,60,129,255,0,
+    139,134,0,0,86,129,255,0,65,128,0,0,72,129,255,0,42,134,0,0,32,129,255,0,
+    118,129,0,132,255,0,189,133,255,1,232,31,134,0,0,195,131,255,0,56,140,0,0,71,
+    133,255,0,101,133,0,0,130,132,255,1,229,68,132,255,1,242,23,133,0,1,40,250,138,
+    255,1,207,3,132,0,0,127,131,255,2,248,4,87,135,255,1,79,32,132,255,0,85,130,
+    0,0,60,132,255,0,129,129,0,1,8,244,131,255,0,164,130,0,132,255,0,92,131,0,
+    0,92,132,255,134,0,132,255,0,92,135,0,0,239,131,255,0,107,129,0,1,7,224,131,
+    255,0,183,129,0,132,255,0,92,131,0,0,117,131,255,0,247,130,0,132,255,0,92,130,
+    0,0,42,132,255,0,77,128,0,1,12,242,131,255,1,243,62,130,0,1,77,248,131,255,
+    1,243,12,128,0,135,255,3,222,7,0,92,132,255,128,0,135,255,0,78,128,0,1,4,
+    241,134,255,128,0,132,255,0,92,142,0,3,177,255,184,0,128,255,0,168,131,0,130,255,
+    0,58,145,0,130,255,0,51,133,0,0,68,129,255,0,107,128,0,3,146,255,252,9,132,
+    0,0,90,128,255,0,55,128,0,128,255,2,235,61,0,128,255,0,168,128,0,3,67,180,
+    213,53,133,0,2,177,255,250,138,0,0,41,128,255,0,134,131,0,2,238,255,140,138,0,
+    0,126,128,255,0,28,145,0,0,89,128,255,0,144,132,0,2,229,255,209,132,0,2,206,
+    255,228,129,0,2,241,255,187,134,0,2,252,255,167,129,0,2,243,255,219,135,0,3,49,
+    133,109,29,142,0,0,72,132,255,1,69,64,132,255,0,67,133,0,0,41,131,255,0,209,
+    130,0,0,156,131,255,0,188,128,0,0,105,131,255,0,241,135,0,0,129,132,255,0,112,
+    130,0,0,128,136,255,0,92,128,0,0,127,131,255,0,227,128,0,0,13,132,255,0,87,
+    130,0,0,209,134,255,2,246,163,29,136,0,0,132,135,255,0,92,130,0,0,228,131,255,
+    0,132,128,0,0,150,132,255,130,0,0,135,139,255,128,0,137,255,130,0,0,213,131,255,
+    0,135,128,0,0,139,132,255,128,0,139,255,0,140,129,0,132,255,0,92,128,0,132,255,
+    1,133,242,132,255,0,171,129,0,132,255,0,92,128,0,132,255,0,149,128,0,0,136,131,
+    255,0,216,128,0,139,255,0,131,130,0,136,255,131,0,0,159,137,255,1,240,5,129,0,
+    0,116,129,255,0,64,135,0,0,66,129,255,0,117,128,0,0,138,140,255,0,167,129,0,
+    0,104,128,255,0,227,136,0,0,35,129,255,0,115,128,0,0,123,129,255,0,46,134,0,
+    4,14,241,199,151,47,128,0,3,20,80,123,153,135,0,0,7,129,255,0,132,129,0,139,
+    255,1,247,55,135,0,0,134,131,255,0,116,139,0,1,6,218,132,255,1,199,1,133,0,
+    1,12,233,139,255,0,121,135,0,0,142,137,255,1,254,56,133,0,0,71,132,255,1,45,
+    146,135,255,1,138,83,132,255,0,27,130,0,1,2,232,131,255,0,204,129,0,0,75,132,
+    255,0,82,130,0,132,255,0,92,131,0,0,92,132,255,134,0,132,255,0,92,135,0,0,
+    247,131,255,2,198,62,1,128,0,0,157,131,255,0,191,129,0,132,255,0,92,131,0,0,
+    107,131,255,0,246,130,0,132,255,0,92,130,0,0,7,132,255,0,87,128,0,0,86,132,
+    255,0,107,132,0,0,125,132,255,0,84,128,0,136,255,2,117,0,92,132,255,128,0,135,
+    255,0,149,128,0,0,63,135,255,128,0,132,255,0,92,141,0,4,64,255,253,46,0,128,
+    255,0,168,131,0,129,255,1,250,7,145,0,129,255,0,233,134,0,0,28,129,255,0,124,
+    128,0,2,181,255,227,133,0,0,55,128,255,0,90,128,0,2,255,183,25,128,0,128,255,
+    0,168,139,0,2,219,255,232,138,0,0,149,128,255,0,68,130,0,0,23,128,255,6,100,
+    8,85,137,140,100,19,132,0,2,170,255,234,146,0,3,207,255,248,26,132,0,3,181,255,
+    252,44,130,0,3,38,250,255,177,129,0,2,251,255,171,134,0,2,244,255,204,129,0,0,
+    213,128,255,0,103,154,0,0,41,140,255,0,33,133,0,0,102,131,255,0,148,130,0,0,
+    191,131,255,0,145,128,0,0,61,132,255,0,24,133,0,1,5,232,131,255,1,229,6,130,
+    0,0,128,136,255,0,92,128,0,0,81,131,255,0,183,128,0,0,70,132,255,0,73,129,
+    0,1,1,246,136,255,1,243,70,134,0,1,29,246,135,255,0,92,130,0,0,245,131,255,
+    0,102,128,0,0,111,132,255,129,0,0,68,140,255,128,0,137,255,130,0,0,234,131,255,
+    0,102,128,0,0,104,132,255,128,0,139,255,1,253,36,128,0,132,255,0,92,128,0,132,
+    255,0,253,132,255,1,246,48,129,0,132,255,0,92,128,0,132,255,0,108,128,0,0,104,
+    131,255,0,237,128,0,140,255,0,67,129,0,136,255,131,0,0,78,137,255,0,166,130,0,
+    0,165,128,255,1,242,2,135,0,1,3,243,128,255,0,168,128,0,0,175,138,255,2,209,
+    88,5,129,0,0,155,128,255,0,171,137,0,0,232,128,255,0,164,128,0,0,170,128,255,
+    0,233,136,0,0,1,145,0,129,255,0,137,129,0,138,255,1,254,86,136,0,0,74,131,
+    255,0,177,139,0,0,124,132,255,1,252,48,135,0,0,107,138,255,1,224,8,135,0,1,
+    15,233,136,255,0,154,134,0,1,17,254,131,255,1,94,205,135,255,1,197,134,131,255,0,
+    226,132,0,0,154,131,255,1,254,25,128,0,0,153,131,255,1,245,10,130,0,132,255,0,
+    92,131,0,0,92,132,255,134,0,132,255,0,92,135,0,0,221,133,255,3,232,161,89,106,
+    131,255,0,114,129,0,132,255,0,92,129,0,2,8,48,213,131,255,0,223,130,0,132,255,
+    0,92,130,0,0,32,132,255,0,72,128,0,0,140,131,255,1,241,8,132,0,1,14,250,
+    131,255,0,149,128,0,136,255,2,240,20,92,132,255,128,0,135,255,0,219,128,0,0,136,
+    135,255,128,0,132,255,0,92,140,0,3,1,205,255,158,128,0,128,255,0,168,131,0,129,
+    255,0,208,146,0,129,255,0,190,134,0,0,9,129,255,0,134,128,0,2,213,255,202,133,
+    0,0,32,128,255,0,125,128,0,0,78,130,0,128,255,0,168,138,0,0,45,128,255,0,
+    185,136,0,1,5,124,128,255,1,202,1,130,0,0,63,128,255,1,141,230,130,255,1,244,
+    105,131,0,10,202,255,203,0,10,113,207,244,232,167,47,137,0,0,66,128,255,0,148,133,
+    0,0,76,128,255,1,201,18,128,0,1,16,197,128,255,0,68,129,0,2,238,255,183,133,
+    0,0,5,128,255,0,227,129,0,0,137,128,255,2,254,163,51,152,0,1,2,231,138,255,
+    0,209,134,0,0,162,131,255,0,88,130,0,0,222,131,255,0,120,128,0,0,34,132,255,
+    0,56,133,0,0,79,132,255,0,115,131,0,0,119,136,255,0,92,129,0,5,100,185,220,
+    248,214,45,128,0,0,186,132,255,0,34,129,0,0,32,138,255,1,248,59,133,0,0,165,
+    136,255,0,92,130,0,0,252,131,255,0,94,128,0,0,96,132,255,129,0,0,208,140,255,
+    128,0,0,243,135,255,0,243,130,0,0,251,131,255,0,94,128,0,0,95,132,255,128,0,
+    140,255,0,125,128,0,132,255,0,92,128,0,139,255,0,87,130,0,132,255,0,92,128,0,
+    132,255,0,94,128,0,0,95,131,255,0,251,128,0,140,255,0,205,129,0,0,243,134,255,
+    0,243,131,0,1,8,244,136,255,0,86,130,0,0,209,128,255,0,199,137,0,0,201,128,
+    255,0,211,128,0,0,210,138,255,1,250,66,130,0,0,202,128,255,0,148,137,0,0,196,
+    128,255,0,209,128,0,0,212,128,255,0,191,153,0,2,28,95,180,129,255,0,140,129,0,
+    138,255,0,123,137,0,1,15,253,130,255,1,236,1,137,0,1,31,245,132,255,0,144,136,
+    0,1,4,218,137,255,0,87,137,0,0,100,135,255,1,236,19,135,0,0,216,131,255,1,
+    154,252,135,255,1,249,193,131,255,0,168,132,0,0,73,132,255,3,98,0,1,229,131,255,
+    0,174,131,0,132,255,0,92,131,0,0,92,132,255,134,0,132,255,0,92,135,0,0,168,
+    136,255,5,251,255,248,160,135,57,130,0,144,255,0,167,130,0,132,255,0,92,128,0,2,
+    2,26,163,132,255,0,41,128,0,0,191,131,255,0,178,134,0,0,189,131,255,0,194,128,
+    0,137,255,1,148,92,132,255,128,0,136,255,2,34,0,208,135,255,128,0,132,255,0,92,
+    140,0,3,94,255,246,27,128,0,128,255,0,168,131,0,129,255,0,174,146,0,129,255,0,
+    160,134,0,0,1,129,255,0,139,128,0,2,233,255,183,133,0,0,15,128,255,0,142,133,
+    0,128,255,0,168,138,0,0,164,128,255,0,109,134,0,2,116,170,231,128,255,1,224,32,
+    131,0,0,103,136,255,0,126,130,0,4,226,255,182,28,207,131,255,1,250,95,136,0,3,
+    164,255,254,38,134,0,0,143,128,255,3,238,168,167,237,128,255,0,125,130,0,2,209,255,
+    229,133,0,0,50,128,255,0,243,129,0,1,29,241,130,255,3,218,142,69,7,149,0,0,
+    115,138,255,0,71,134,0,0,223,131,255,0,27,130,0,0,237,131,255,0,103,128,0,0,
+    14,132,255,0,69,133,0,0,171,131,255,1,241,12,131,0,4,44,245,255,254,166,132,255,
+    0,92,136,0,0,96,132,255,0,226,130,0,0,71,139,255,1,224,13,131,0,1,53,254,
+    136,255,0,92,130,0,0,238,131,255,0,104,128,0,0,100,132,255,128,0,0,52,141,255,
+    128,0,0,138,135,255,0,137,130,0,0,242,131,255,0,103,128,0,0,103,132,255,128,0,
+    140,255,0,186,128,0,132,255,0,92,128,0,138,255,0,131,131,0,132,255,0,92,128,0,
+    132,255,0,102,128,0,0,105,131,255,0,238,128,0,141,255,0,48,128,0,0,138,134,255,
+    0,137,132,0,0,172,135,255,1,249,13,130,0,0,228,128,255,0,165,137,0,0,166,128,
+    255,0,229,128,0,0,230,139,255,1,225,13,129,0,0,225,143,255,0,227,128,0,0,230,
+    128,255,0,161,147,0,5,2,45,93,136,178,228,132,255,0,140,129,0,137,255,0,206,139,
+    0,0,209,131,255,0,42,137,0,0,175,132,255,1,230,14,137,0,0,84,136,255,0,198,
+    138,0,1,2,205,134,255,0,99,136,0,0,161,149,255,0,111,132,0,1,6,241,131,255,
+    2,173,0,53,132,255,0,93,131,0,132,255,0,92,131,0,0,92,132,255,134,0,132,255,
+    0,92,135,0,0,74,139,255,1,175,25,131,0,144,255,0,79,130,0,143,255,1,238,1,
+    128,0,0,221,131,255,0,132,134,0,0,135,131,255,0,228,128,0,137,255,1,251,132,132,
+    255,128,0,136,255,1,105,25,136,255,128,0,132,255,0,92,139,0,3,9,227,255,133,129,
+    0,128,255,0,168,131,0,129,255,0,158,146,0,129,255,0,148,135,0,129,255,0,140,128,
+    0,2,242,255,177,133,0,0,6,128,255,0,152,133,0,128,255,0,168,137,0,4,66,254,
+    255,241,16,134,0,0,213,129,255,1,247,72,132,0,0,142,128,255,9,254,148,41,8,39,
+    144,253,255,254,68,129,0,8,242,255,178,203,255,248,181,161,217,128,255,1,253,71,134,0,
+    3,13,245,255,187,136,0,1,98,252,130,255,1,254,89,131,0,0,153,128,255,0,68,132,
+    0,0,139,128,255,0,250,130,0,1,83,250,132,255,3,242,167,72,1,146,0,0,54,138,
+    255,0,139,133,0,0,27,131,255,0,222,131,0,0,247,131,255,0,97,128,0,0,7,132,
+    255,0,80,132,0,1,15,247,131,255,0,151,133,0,3,39,103,45,0,132,255,0,92,135,
+    0,1,54,247,132,255,0,135,130,0,0,111,140,255,0,115,131,0,0,196,137,255,0,92,
+    130,0,0,219,131,255,0,137,128,0,0,130,132,255,128,0,0,123,132,255,1,133,159,133,
+    255,129,0,0,51,132,255,1,143,51,131,0,0,224,131,255,0,132,128,0,0,133,132,255,
+    128,0,132,255,2,248,112,194,131,255,0,226,128,0,132,255,0,92,128,0,137,255,1,174,
+    1,131,0,132,255,0,92,128,0,132,255,0,131,128,0,0,140,131,255,0,220,128,0,133,
+    255,1,162,145,132,255,0,122,129,0,0,143,132,255,0,51,133,0,0,91,135,255,0,183,
+    131,0,0,242,128,255,0,151,137,0,0,153,128,255,0,244,128,0,0,240,140,255,0,113,
+    129,0,0,239,143,255,0,242,128,0,0,243,128,255,0,150,145,0,2,42,155,237,137,255,
+    0,140,129,0,137,255,1,254,56,138,0,0,148,131,255,0,102,136,0,0,72,133,255,0,
+    88,139,0,0,199,134,255,1,254,56,139,0,0,59,133,255,1,201,1,136,0,0,105,149,
+    255,0,54,133,0,0,166,131,255,2,242,6,131,131,255,1,250,16,131,0,132,255,0,92,
+    131,0,0,92,132,255,134,0,132,255,0,92,135,0,1,1,186,139,255,1,234,47,130,0,
+    143,255,1,203,2,130,0,143,255,0,146,129,0,0,236,131,255,0,108,134,0,0,114,131,
+    255,0,243,128,0,138,255,0,244,132,255,128,0,136,255,1,176,97,136,255,128,0,132,255,
+    0,92,139,0,3,124,255,234,14,129,0,128,255,0,168,131,0,129,255,0,143,146,0,129,
+    255,0,140,135,0,129,255,0,140,128,0,2,251,255,171,133,0,0,2,128,255,0,162,133,
+    0,128,255,0,168,136,0,1,24,230,128,255,0,119,135,0,0,238,131,255,1,150,1,130,
+    0,0,182,128,255,0,96,131,0,0,101,128,255,0,205,129,0,5,251,255,251,255,212,34,
+    128,0,1,1,122,128,255,1,227,7,133,0,0,98,128,255,0,81,135,0,1,95,236,132,
+    255,1,242,113,130,0,0,63,128,255,1,217,18,130,0,1,48,248,128,255,0,253,131,0,
+    1,66,220,134,255,1,193,35,144,0,1,5,218,139,255,0,60,132,0,0,88,131,255,0,
+    162,131,0,0,254,131,255,0,93,128,0,0,1,132,255,0,89,132,0,0,97,132,255,0,
+    50,137,0,132,255,0,92,134,0,1,39,235,132,255,1,246,24,130,0,0,145,140,255,0,
+    216,130,0,0,85,138,255,0,92,130,0,0,174,131,255,3,214,2,0,201,132,255,128,0,
+    0,188,131,255,3,200,0,2,218,132,255,130,0,132,255,0,92,132,0,0,183,131,255,0,
+    202,128,0,0,202,132,255,128,0,132,255,2,159,0,107,131,255,0,243,128,0,132,255,0,
+    92,128,0,136,255,1,209,11,132,0,132,255,0,92,128,0,132,255,3,201,0,1,213,131,
+    255,0,175,128,0,132,255,3,216,3,0,204,131,255,0,189,129,0,0,92,132,255,134,0,
+    1,15,250,134,255,0,104,131,0,0,252,128,255,0,142,137,0,0,143,128,255,0,251,128,
+    0,0,250,140,255,0,211,129,0,0,252,143,255,0,254,128,0,0,252,128,255,0,142,144,
+    0,1,103,250,134,255,1,239,147,129,255,0,140,129,0,138,255,1,206,3,137,0,0,88,
+    131,255,0,163,135,0,1,7,219,132,255,0,188,140,0,0,60,134,255,0,165,140,0,0,
+    62,133,255,1,228,11,136,0,0,50,148,255,1,247,5,133,0,0,85,132,255,1,67,208,
+    131,255,0,185,132,0,132,255,0,92,131,0,0,92,132,255,134,0,132,255,0,92,136,0,
+    1,26,219,139,255,1,225,16,129,0,142,255,1,233,38,131,0,142,255,1,244,32,129,0,
+    0,250,131,255,0,96,134,0,0,96,131,255,0,252,128,0,145,255,128,0,136,255,1,241,
+    174,136,255,128,0,132,255,0,92,138,0,3,23,243,255,108,130,0,128,255,0,168,131,0,
+    129,255,0,140,146,0,129,255,0,140,135,0,129,255,0,140,128,0,2,254,255,168,133,0,
+    0,3,128,255,0,163,133,0,128,255,0,168,135,0,1,10,200,128,255,1,203,4,135,0,
+    4,56,9,21,104,239,128,255,0,119,130,0,2,45,94,104,133,0,0,185,128,255,0,48,
+    128,0,0,254,128,255,1,241,29,131,0,0,157,128,255,0,93,133,0,3,191,255,239,6,
+    134,0,0,111,128,255,5,214,76,11,16,87,223,128,255,0,112,130,0,0,189,128,255,9,
+    217,78,12,17,99,237,254,225,255,247,132,0,3,3,85,181,249,132,255,1,242,47,143,0,
+    0,93,140,255,0,183,132,0,0,148,131,255,0,101,131,0,0,247,131,255,0,97,128,0,
+    0,6,132,255,0,82,132,0,0,168,131,255,0,215,138,0,132,255,0,92,133,0,1,35,
+    228,133,255,0,120,131,0,0,117,131,255,3,202,30,34,206,132,255,0,23,128,0,1,7,
+    222,131,255,0,221,132,255,0,92,130,0,0,117,132,255,1,162,143,133,255,128,0,0,216,
+    131,255,0,133,128,0,0,147,132,255,130,0,132,255,0,92,132,0,0,129,132,255,1,142,
+    146,133,255,128,0,132,255,2,112,0,92,131,255,0,254,128,0,132,255,0,92,128,0,136,
+    255,0,45,133,0,132,255,0,92,128,0,133,255,1,143,153,132,255,0,120,128,0,132,255,
+    0,135,128,0,0,135,131,255,0,216,129,0,0,92,132,255,135,0,0,185,133,255,1,254,
+    26,131,0,0,242,128,255,0,152,137,0,0,153,128,255,0,238,128,0,0,251,132,255,2,
+    140,18,192,132,255,0,18,128,0,0,244,128,255,0,204,141,140,128,0,0,242,128,255,0,
+    151,143,0,0,97,132,255,5,234,186,131,66,5,0,129,255,0,140,129,0,139,255,0,108,
+    137,0,0,27,131,255,0,223,135,0,0,125,132,255,1,249,38,141,0,0,177,132,255,1,
+    247,30,139,0,1,4,211,134,255,0,133,136,0,1,4,245,136,255,0,198,136,255,0,195,
+    134,0,1,12,247,131,255,0,172,132,255,0,103,132,0,132,255,0,92,131,0,0,92,132,
+    255,134,0,132,255,0,92,137,0,1,20,189,139,255,0,135,129,0,142,255,0,40,132,0,
+    142,255,0,99,130,0,0,244,131,255,0,101,134,0,0,107,131,255,0,240,128,0,132,255,
+    0,245,138,255,128,0,148,255,128,0,132,255,0,92,138,0,3,154,255,218,5,130,0,128,
+    255,0,168,131,0,129,255,0,140,137,0,1,73,226,128,255,1,245,146,129,0,129,255,0,
+    140,135,0,129,255,0,140,128,0,2,250,255,172,133,0,0,10,128,255,0,153,133,0,128,
+    255,0,168,134,0,1,4,179,128,255,1,240,34,140,0,4,48,246,255,240,14,139,0,0,
+    84,128,255,0,108,128,0,0,247,128,255,0,136,132,0,3,33,254,255,169,132,0,3,15,
+    252,255,159,134,0,4,38,250,255,212,16,130,0,4,22,221,255,253,44,129,0,1,29,226,
+    133,255,3,137,176,255,240,135,0,3,14,86,164,240,130,255,1,227,13,142,0,0,177,131,
+    255,3,254,137,105,237,131,255,1,251,13,131,0,0,209,131,255,0,40,131,0,0,238,131,
+    255,0,103,128,0,0,12,132,255,0,72,131,0,1,1,233,131,255,0,134,138,0,132,255,
+    0,92,132,0,1,27,223,133,255,1,193,3,131,0,2,8,149,229,128,255,1,218,27,128,
+    0,0,70,132,255,0,65,128,0,0,118,140,255,1,226,72,128,0,1,29,253,140,255,128,
+    0,0,236,131,255,0,103,128,0,0,109,132,255,130,0,132,255,0,92,132,0,0,41,141,
+    255,128,0,132,255,2,95,0,92,132,255,128,0,132,255,0,92,128,0,136,255,0,130,133,
+    0,132,255,0,92,128,0,140,255,1,254,33,128,0,132,255,0,102,128,0,0,103,131,255,
+    0,237,129,0,0,92,132,255,135,0,0,104,133,255,0,200,132,0,0,228,128,255,0,165,
+    137,0,0,167,128,255,0,224,128,0,0,241,131,255,3,237,8,0,62,132,255,0,62,128,
+    0,0,230,128,255,0,153,143,0,0,229,128,255,0,162,142,0,1,25,242,129,255,2,188,
+    90,27,131,0,0,6,129,255,0,140,129,0,139,255,1,239,22,137,0,0,223,131,255,0,
+    28,133,0,1,31,246,132,255,0,132,142,0,0,41,132,255,0,136,140,0,0,115,135,255,
+    1,248,34,136,0,0,195,136,255,0,82,136,255,0,138,135,0,0,179,137,255,1,253,24,
+    132,0,0,250,131,255,0,93,131,0,0,94,131,255,0,252,134,0,132,255,0,92,135,0,
+    6,10,91,125,146,162,183,252,136,255,1,233,3,128,0,141,255,1,224,12,132,0,140,255,
+    1,250,98,131,0,0,228,131,255,0,119,134,0,0,128,131,255,0,224,128,0,132,255,1,
+    133,251,137,255,128,0,148,255,128,0,132,255,0,92,137,0,3,44,252,255,82,131,0,128,
+    255,0,168,131,0,129,255,0,140,137,0,0,227,131,255,0,62,128,0,129,255,0,140,135,
+    0,129,255,0,140,128,0,2,238,255,182,133,0,0,17,128,255,0,144,133,0,128,255,0,
+    168,133,0,1,3,168,128,255,1,252,70,142,0,0,131,128,255,0,84,139,0,0,29,128,
+    255,0,144,128,0,0,236,128,255,0,61,133,0,2,217,255,220,132,0,0,80,128,255,0,
+    74,134,0,0,146,128,255,0,60,132,0,0,69,128,255,0,149,130,0,1,31,195,130,255,
+    5,245,115,0,193,255,222,138,0,2,6,84,205,129,255,0,108,142,0,0,226,131,255,0,
+    167,128,0,0,89,132,255,0,60,130,0,1,15,253,130,255,0,235,132,0,0,226,131,255,
+    0,121,128,0,0,30,132,255,0,57,131,0,0,45,132,255,0,54,138,0,132,255,0,92,
+    131,0,1,18,215,133,255,1,229,25,132,0,5,1,64,106,147,175,62,129,0,0,21,132,
+    255,0,83,128,0,0,223,141,255,0,226,129,0,0,174,140,255,128,0,0,251,131,255,0,
+    94,128,0,0,95,132,255,130,0,132,255,0,92,133,0,0,190,139,255,0,253,128,0,132,
+    255,2,92,0,92,132,255,128,0,132,255,0,92,128,0,136,255,1,244,23,132,0,132,255,
+    0,92,128,0,140,255,0,180,129,0,132,255,0,93,128,0,0,95,131,255,0,251,129,0,
+    0,92,132,255,135,0,1,25,254,132,255,0,121,132,0,0,209,128,255,0,200,137,0,0,
+    202,128,255,0,204,128,0,0,230,131,255,0,200,128,0,0,11,132,255,0,80,128,0,0,
+    212,128,255,0,171,143,0,0,211,128,255,0,193,136,0,1,26,11,130,0,0,120,129,255,
+    0,131,134,0,0,19,129,255,0,140,129,0,133,255,0,251,132,255,0,160,137,0,0,162,
+    131,255,0,88,133,0,0,176,132,255,1,222,9,143,0,132,255,0,92,139,0,1,27,243,
+    136,255,0,176,136,0,0,139,135,255,2,220,8,249,135,255,0,80,135,0,0,98,137,255,
+    0,196,133,0,0,239,131,255,0,98,131,0,0,105,131,255,0,245,134,0,132,255,0,92,
+    134,0,1,35,230,130,255,4,85,21,96,172,243,134,255,0,45,128,0,132,255,2,143,83,
+    152,133,255,0,131,132,0,138,255,2,230,150,32,132,0,0,200,131,255,0,164,134,0,0,
+    176,131,255,0,195,128,0,132,255,1,92,149,137,255,128,0,148,255,128,0,132,255,0,92,
+    137,0,2,184,255,198,132,0,128,255,0,168,131,0,129,255,0,140,137,0,132,255,0,92,
+    128,0,129,255,0,140,135,0,129,255,0,140,128,0,2,221,255,198,133,0,0,36,128,255,
+    0,124,133,0,128,255,0,168,132,0,1,1,160,129,255,0,105,143,0,0,45,128,255,0,
+    138,139,0,0,7,128,255,0,161,128,0,0,224,128,255,0,27,133,0,2,181,255,242,132,
+    0,3,148,255,247,6,134,0,2,213,255,222,134,0,2,228,255,213,131,0,5,1,63,128,
+    142,105,20,128,0,2,209,255,200,140,0,1,4,163,128,255,0,196,142,0,0,248,131,255,
+    0,106,128,0,0,21,132,255,0,83,130,0,0,74,131,255,0,175,132,0,0,199,131,255,
+    0,145,128,0,0,55,132,255,0,25,131,0,0,110,131,255,1,242,2,138,0,132,255,0,
+    92,130,0,1,5,191,133,255,1,245,51,133,0,0,151,130,255,1,249,39,128,0,0,6,
+    132,255,0,82,128,0,143,255,129,0,1,29,242,139,255,128,0,0,241,131,255,0,103,128,
+    0,0,100,132,255,130,0,132,255,0,92,133,0,1,43,250,138,255,0,246,128,0,132,255,
+    2,92,0,92,132,255,128,0,132,255,0,92,128,0,137,255,0,148,132,0,132,255,0,92,
+    128,0,139,255,1,245,33,129,0,132,255,0,100,128,0,0,106,131,255,0,238,129,0,0,
+    92,132,255,136,0,0,201,132,255,0,41,132,0,0,164,128,255,1,242,3,135,0,1,3,
+    243,128,255,0,159,128,0,0,205,131,255,0,196,128,0,0,9,132,255,0,87,128,0,0,
+    168,128,255,0,217,137,0,0,16,131,0,0,168,128,255,0,233,136,0,3,184,254,225,138,
+    128,0,0,199,128,255,1,220,1,134,0,0,49,129,255,0,141,129,0,132,255,1,152,127,
+    132,255,1,254,59,136,0,0,102,131,255,0,149,132,0,0,73,133,255,0,75,144,0,132,
+    255,0,92,139,0,0,169,138,255,0,69,135,0,0,84,135,255,2,162,0,200,135,255,0,
+    23,135,0,1,20,252,136,255,0,114,133,0,0,226,131,255,0,115,131,0,0,125,131,255,
+    0,226,134,0,132,255,0,92,134,0,0,117,131,255,0,165,129,0,2,8,83,205,132,255,
+    0,80,128,0,132,255,0,92,128,0,0,172,132,255,1,246,26,131,0,132,255,0,143,128,
+    80,2,75,58,32,135,0,0,148,131,255,1,233,5,132,0,1,10,242,131,255,0,143,128,
+    0,132,255,2,92,21,241,136,255,128,0,148,255,128,0,132,255,0,92,137,0,141,255,128,
+    0,129,255,0,140,137,0,132,255,0,92,128,0,129,255,0,140,135,0,129,255,0,140,128,
+    0,2,195,255,222,133,0,0,60,128,255,0,92,133,0,128,255,0,168,132,0,0,149,129,
+    255,0,129,144,0,0,9,128,255,0,160,139,0,0,9,128,255,0,155,128,0,0,195,128,
+    255,0,21,133,0,2,172,255,248,132,0,2,217,255,192,135,0,2,245,255,179,134,0,2,
+    182,255,245,138,0,3,5,246,255,166,128,0,2,91,118,122,136,0,3,11,240,255,230,142,
+    0,0,248,131,255,0,112,128,0,0,15,132,255,0,82,130,0,0,134,131,255,0,114,132,
+    0,0,166,131,255,0,189,128,0,0,99,131,255,1,247,1,131,0,0,158,131,255,0,187,
+    139,0,132,255,0,92,130,0,0,138,133,255,1,251,74,134,0,0,249,131,255,0,120,128,
+    0,0,38,132,255,0,64,128,0,143,255,130,0,1,73,249,138,255,128,0,0,224,131,255,
+    0,136,128,0,0,129,132,255,130,0,132,255,0,92,132,0,1,3,142,139,255,0,233,128,
+    0,132,255,2,92,0,92,132,255,128,0,132,255,0,92,128,0,137,255,1,250,35,131,0,
+    132,255,0,92,128,0,138,255,1,251,81,130,0,132,255,0,125,128,0,0,143,131,255,0,
+    220,129,0,0,92,132,255,136,0,0,180,131,255,0,218,133,0,0,115,129,255,0,65,135,
+    0,0,67,129,255,0,111,128,0,0,168,131,255,0,227,128,0,0,37,132,255,0,71,128,
+    0,0,117,128,255,1,254,28,135,0,4,10,243,242,205,139,128,0,0,121,129,255,0,44,
+    134,0,1,2,234,128,255,0,146,128,0,0,232,128,255,0,157,135,0,0,105,129,255,0,
+    143,129,0,132,255,2,92,9,226,132,255,1,208,3,135,0,0,41,131,255,0,209,131,0,
+    1,7,219,132,255,0,175,145,0,132,255,0,92,138,0,0,68,139,255,1,214,4,134,0,
+    0,28,135,255,2,103,0,143,134,255,0,221,137,0,0,192,136,255,0,33,133,0,0,195,
+    131,255,0,151,131,0,0,167,131,255,0,200,134,0,132,255,0,92,134,0,0,110,131,255,
+    0,220,131,0,0,18,132,255,0,86,128,0,132,255,0,92,128,0,1,27,245,132,255,0,
+    146,131,0,132,255,0,92,140,0,0,90,132,255,0,108,132,0,0,119,132,255,0,86,128,
+    0,132,255,2,92,0,119,136,255,128,0,148,255,128,0,132,255,0,92,137,0,141,255,128,
+    0,129,255,0,140,137,0,132,255,0,92,128,0,129,255,0,140,135,0,129,255,0,140,128,
+    0,3,159,255,251,6,132,0,0,95,128,255,0,59,133,0,128,255,0,168,131,0,0,121,
+    129,255,0,149,134,0,3,7,89,131,87,133,0,0,9,128,255,0,155,128,0,3,20,96,
+    122,71,133,0,0,31,128,255,0,135,128,0,0,156,128,255,0,40,133,0,2,186,255,225,
+    131,0,0,23,128,255,0,131,135,0,2,249,255,174,134,0,2,173,255,249,138,0,0,54,
+    128,255,0,123,128,0,3,240,255,251,7,136,0,2,185,255,250,142,0,0,229,131,255,0,
+    177,128,0,0,74,132,255,0,61,130,0,0,195,131,255,0,53,132,0,0,123,131,255,3,
+    248,19,0,180,131,255,0,196,132,0,0,202,131,255,0,131,139,0,132,255,0,92,129,0,
+    1,56,254,132,255,1,253,90,135,0,0,234,131,255,0,187,128,0,0,136,132,255,0,22,
+    128,0,0,243,141,255,0,243,131,0,1,68,229,137,255,128,0,0,182,131,255,3,212,1,
+    0,200,132,255,130,0,132,255,0,92,132,0,0,103,140,255,0,210,128,0,132,255,2,92,
+    0,92,132,255,128,0,132,255,0,92,128,0,138,255,0,166,131,0,132,255,0,92,128,0,
+    137,255,1,235,77,131,0,132,255,3,191,0,2,217,131,255,0,175,129,0,0,92,132,255,
+    136,0,0,224,131,255,0,138,133,0,0,46,129,255,0,164,135,0,0,168,129,255,0,44,
+    128,0,0,125,132,255,2,64,0,111,132,255,0,35,128,0,0,49,129,255,0,128,135,0,
+    0,105,129,255,0,150,128,0,0,56,129,255,0,132,134,0,0,60,129,255,0,91,128,0,
+    0,250,128,255,0,148,134,0,1,1,201,129,255,0,147,129,0,132,255,2,92,0,89,133,
+    255,0,110,136,0,0,235,130,255,1,253,16,130,0,0,126,132,255,1,244,30,145,0,132,
+    255,0,92,137,0,1,6,216,132,255,1,220,254,132,255,0,113,135,0,0,228,134,255,2,
+    45,0,85,134,255,0,164,137,0,0,111,135,255,0,207,134,0,0,152,131,255,1,229,9,
+    129,0,1,11,236,131,255,0,158,134,0,132,255,0,92,134,0,0,86,132,255,0,99,130,
+    0,0,47,132,255,0,66,128,0,132,255,0,92,129,0,0,131,132,255,1,247,25,130,0,
+    132,255,0,92,140,0,1,10,241,131,255,1,246,69,130,0,1,71,248,131,255,1,241,10,
+    128,0,132,255,3,92,0,7,223,135,255,128,0,148,255,128,0,132,255,0,92,137,0,135,
+    152,128,255,0,220,129,152,128,0,129,255,0,140,137,0,0,227,131,255,0,83,128,0,129,
+    255,0,140,135,0,129,255,0,140,128,0,0,112,128,255,0,52,132,0,3,147,255,249,9,
+    133,0,128,255,0,168,130,0,1,76,254,128,255,1,162,1,134,0,3,7,253,255,183,133,
+    0,0,43,128,255,0,131,128,0,0,43,128,255,0,165,133,0,0,83,128,255,0,87,128,
+    0,0,109,128,255,0,89,133,0,2,226,255,198,131,0,0,74,128,255,0,73,135,0,2,
+    231,255,203,134,0,2,198,255,230,128,0,2,86,170,186,133,0,0,120,128,255,0,61,128,
+    0,0,213,128,255,0,64,136,0,2,179,255,231,142,0,0,185,132,255,2,140,100,228,131,
+    255,1,252,15,129,0,1,7,248,130,255,1,244,4,132,0,0,54,132,255,1,181,121,132,
+    255,0,131,131,0,1,1,243,131,255,0,93,139,0,132,255,0,92,129,0,0,198,133,255,
+    0,182,130,80,1,69,10,130,0,0,192,132,255,2,131,126,251,131,255,0,217,129,0,0,
+    138,141,255,0,137,132,0,4,16,115,201,238,240,133,255,128,0,0,127,132,255,1,157,145,
+    133,255,130,0,132,255,0,92,132,0,0,139,140,255,0,172,128,0,132,255,2,92,0,92,
+    132,255,128,0,132,255,0,92,128,0,138,255,1,254,49,130,0,132,255,0,92,128,0,133,
+    255,128,241,2,205,123,22,132,0,133,255,1,131,160,132,255,0,120,129,0,0,90,132,255,
+    1,81,5,130,0,3,15,185,239,212,132,255,0,54,134,0,0,207,128,255,1,254,60,133,
+    0,1,62,254,128,255,0,206,129,0,0,54,132,255,2,223,101,237,131,255,0,232,130,0,
+    0,208,128,255,1,245,37,133,0,1,17,231,129,255,0,66,129,0,0,220,128,255,1,243,
+    27,133,0,0,181,128,255,1,249,15,128,0,0,234,128,255,0,200,134,0,0,105,130,255,
+    0,155,129,0,132,255,0,92,128,0,0,197,132,255,1,240,24,135,0,0,176,131,255,0,
+    74,129,0,1,32,246,132,255,0,199,134,80,0,50,137,0,132,255,0,92,137,0,0,122,
+    132,255,2,244,28,159,132,255,1,240,21,134,0,0,173,133,255,3,241,2,0,26,134,255,
+    0,107,137,0,0,31,135,255,0,125,134,0,0,97,132,255,4,208,107,85,111,208,132,255,
+    0,100,134,0,132,255,0,92,134,0,0,27,133,255,4,175,100,89,124,229,131,255,1,253,
+    19,128,0,132,255,0,92,129,0,1,15,237,132,255,0,143,130,0,132,255,0,92,141,0,
+    0,147,132,255,1,253,162,128,93,1,161,253,132,255,0,153,129,0,132,255,0,92,128,0,
+    0,88,135,255,128,0,132,255,0,216,134,255,0,215,132,255,128,0,132,255,0,207,132,180,
+    1,173,95,138,0,128,255,0,168,131,0,129,255,0,140,137,0,0,109,131,255,0,61,128,
+    0,129,255,0,140,135,0,129,255,0,140,128,0,0,50,128,255,0,127,131,0,3,1,223,
+    255,196,134,0,128,255,0,168,129,0,1,23,235,128,255,1,180,4,136,0,3,214,255,247,
+    15,132,0,0,121,128,255,0,73,128,0,4,7,246,255,234,5,132,0,3,174,255,252,25,
+    128,0,0,34,128,255,0,178,132,0,0,45,128,255,0,131,131,0,0,122,128,255,0,34,
+    135,0,3,184,255,251,24,132,0,3,17,248,255,182,128,0,0,117,128,255,0,40,131,0,
+    4,2,217,255,237,4,128,0,0,149,128,255,0,172,135,0,3,3,231,255,177,142,0,0,
+    116,140,255,0,197,130,0,0,60,131,255,0,188,133,0,1,2,231,139,255,0,51,131,0,
+    0,30,132,255,0,58,139,0,132,255,0,92,128,0,0,59,140,255,1,215,12,129,0,0,
+    118,140,255,0,124,130,0,0,51,132,80,132,255,1,143,51,138,0,0,92,132,255,128,0,
+    0,41,141,255,130,0,132,255,0,92,132,0,0,115,140,255,0,115,128,0,132,255,2,92,
+    0,92,132,255,128,0,132,255,0,92,128,0,132,255,0,240,132,255,0,184,130,0,132,255,
+    0,92,128,0,132,255,0,92,137,0,141,255,0,34,129,0,0,82,133,255,0,164,130,0,
+    0,126,134,255,0,221,135,0,0,96,129,255,1,235,46,131,0,1,44,235,129,255,0,98,
+    129,0,1,1,229,139,255,0,151,130,0,0,95,129,255,1,222,36,131,0,1,12,190,129,
+    255,0,210,130,0,0,115,129,255,1,205,18,131,0,0,119,129,255,0,164,129,0,0,189,
+    129,255,0,81,132,0,1,101,251,130,255,0,164,129,0,132,255,0,92,128,0,1,52,254,
+    132,255,0,163,135,0,0,115,131,255,0,135,129,0,0,168,143,255,0,136,136,0,132,255,
+    0,92,136,0,1,31,245,132,255,3,122,0,25,243,132,255,0,156,134,0,0,118,133,255,
+    0,185,129,0,0,225,133,255,0,49,138,0,0,205,134,255,0,43,134,0,1,17,250,141,
+    255,1,250,23,134,0,132,255,0,92,135,0,0,204,142,255,0,190,129,0,132,255,0,92,
+    130,0,0,121,132,255,1,246,23,129,0,132,255,0,92,141,0,1,22,240,142,255,1,244,
+    29,129,0,132,255,0,92,129,0,0,199,134,255,128,0,132,255,0,144,134,255,0,141,132,
+    255,128,0,141,255,0,69,137,0,128,255,0,168,131,0,129,255,0,140,136,0,1,6,210,
+    130,255,1,253,22,128,0,129,255,0,140,135,0,129,255,0,140,129,0,3,221,255,234,19,
+    130,0,0,88,128,255,0,107,134,0,128,255,0,168,129,0,0,160,128,255,1,210,11,137,
+    0,0,135,128,255,0,127,131,0,4,26,236,255,233,9,129,0,0,175,128,255,0,103,131,
+    0,3,65,254,255,178,130,0,0,205,128,255,0,67,131,0,0,173,128,255,0,48,131,0,
+    3,161,255,250,3,135,0,0,108,128,255,0,154,132,0,0,139,128,255,0,105,128,0,0,
+    57,128,255,0,137,131,0,0,99,128,255,0,140,129,0,0,55,129,255,0,102,134,0,0,
+    114,128,255,0,86,142,0,1,18,243,139,255,0,84,130,0,0,120,131,255,0,127,134,0,
+    0,119,138,255,0,199,132,0,0,51,132,255,0,29,139,0,132,255,0,92,128,0,0,150,
+    141,255,0,79,129,0,1,24,245,138,255,1,241,23,137,0,132,255,0,92,139,0,0,92,
+    132,255,129,0,0,192,140,255,130,0,132,255,0,92,132,0,0,52,139,255,1,252,31,128,
+    0,132,255,2,92,0,92,132,255,128,0,132,255,0,92,128,0,132,255,1,117,246,132,255,
+    0,65,129,0,132,255,0,92,128,0,132,255,0,92,137,0,140,255,0,184,130,0,0,63,
+    133,255,1,252,9,129,0,0,147,134,255,0,125,135,0,1,1,191,129,255,6,247,135,48,
+    19,42,128,245,129,255,1,195,1,130,0,0,110,138,255,1,254,45,131,0,0,188,129,255,
+    6,245,133,49,19,32,98,219,130,255,0,68,130,0,1,5,213,129,255,5,227,104,34,19,
+    60,170,129,255,1,249,34,129,0,0,110,129,255,6,250,133,44,17,40,87,193,129,255,0,
+    252,128,255,0,181,129,0,132,255,0,92,129,0,0,159,133,255,0,61,134,0,0,55,131,
+    255,0,195,129,0,0,244,143,255,0,243,136,0,132,255,0,92,136,0,0,176,132,255,1,
+    220,7,128,0,0,120,132,255,1,253,51,133,0,0,62,133,255,0,126,129,0,0,167,132,
+    255,1,244,3,138,0,0,124,133,255,0,218,136,0,0,166,141,255,0,161,135,0,132,255,
+    0,92,135,0,0,77,142,255,0,71,129,0,132,255,0,92,130,0,1,12,234,132,255,0,
+    140,129,0,132,255,0,92,142,0,0,105,142,255,0,117,130,0,132,255,0,92,129,0,0,
+    58,134,255,128,0,132,255,1,93,234,132,255,1,231,93,132,255,128,0,141,255,0,125,137,
+    0,128,255,0,168,131,0,129,255,0,140,136,0,0,28,131,255,0,194,129,0,129,255,0,
+    140,135,0,129,255,0,140,129,0,0,108,128,255,1,189,14,128,0,4,50,237,255,241,14,
+    134,0,128,255,0,168,128,0,4,35,253,255,253,54,138,0,4,27,247,255,249,82,129,0,
+    1,37,212,128,255,0,112,130,0,0,61,128,255,1,244,73,129,0,4,64,238,255,252,48,
+    130,0,0,72,128,255,1,238,62,128,0,1,1,131,128,255,0,193,132,0,2,196,255,217,
+    136,0,1,11,233,128,255,1,135,5,128,0,5,2,119,254,255,230,9,128,0,4,2,219,
+    255,249,67,129,0,4,83,245,255,243,23,130,0,0,169,129,255,1,152,27,130,0,5,11,
+    125,253,255,198,2,143,0,0,112,138,255,1,186,1,130,0,0,181,131,255,0,67,134,0,
+    1,12,226,136,255,1,253,61,132,0,0,67,132,255,0,16,139,0,132,255,0,92,128,0,
+    0,214,141,255,0,92,130,0,0,127,138,255,0,109,138,0,132,255,0,92,139,0,0,92,
+    132,255,129,0,1,44,250,139,255,130,0,132,255,0,92,133,0,0,199,138,255,0,151,129,
+    0,132,255,2,92,0,92,132,255,128,0,132,255,0,92,128,0,132,255,1,92,138,132,255,
+    0,201,129,0,132,255,0,92,128,0,132,255,0,92,137,0,139,255,1,248,38,130,0,1,
+    23,254,133,255,0,41,129,0,0,125,133,255,1,246,23,136,0,1,30,224,137,255,1,228,
+    33,131,0,1,5,212,137,255,0,156,132,0,1,28,221,138,255,0,139,132,0,1,49,240,
+    137,255,0,100,130,0,1,10,226,137,255,1,154,155,128,255,0,222,129,0,132,255,0,92,
+    129,0,1,25,243,132,255,1,211,4,133,0,1,5,245,130,255,1,248,7,128,0,145,255,
+    136,0,132,255,0,92,135,0,0,75,133,255,0,78,129,0,1,7,221,132,255,1,197,1,
+    132,0,1,10,252,132,255,0,68,129,0,0,109,132,255,0,190,139,0,0,43,133,255,0,
+    136,136,0,1,25,239,139,255,1,233,24,135,0,132,255,0,92,136,0,0,164,140,255,0,
+    149,130,0,132,255,0,92,131,0,0,117,132,255,1,245,21,128,0,132,255,0,92,143,0,
+    0,165,140,255,1,160,1,130,0,132,255,0,92,130,0,0,170,133,255,128,0,132,255,1,
+    92,164,132,255,1,158,92,132,255,128,0,141,255,0,128,137,0,128,255,0,168,131,0,129,
+    255,0,140,137,0,0,209,129,255,1,254,59,129,0,129,255,0,140,135,0,129,255,0,140,
+    129,0,1,4,191,128,255,3,235,166,180,251,128,255,0,101,135,0,128,255,0,168,128,0,
+    0,135,128,255,0,231,136,152,130,0,0,107,129,255,3,199,158,185,250,128,255,1,180,1,
+    131,0,0,150,129,255,2,195,159,197,129,255,0,130,132,0,0,156,128,255,3,254,193,160,
+    214,128,255,1,246,43,132,0,2,222,255,198,137,0,1,71,253,128,255,3,229,166,164,223,
+    128,255,1,251,65,130,0,0,81,128,255,3,253,187,161,208,129,255,0,96,131,0,1,12,
+    205,129,255,5,253,200,167,158,185,242,128,255,1,232,27,145,0,0,160,136,255,1,214,22,
+    131,0,0,234,130,255,1,251,11,135,0,1,50,245,135,255,0,132,133,0,0,84,132,255,
+    0,5,139,0,132,255,0,92,128,0,0,247,141,255,0,92,130,0,1,2,179,136,255,0,
+    159,139,0,132,255,0,92,139,0,0,92,132,255,130,0,1,95,254,138,255,130,0,132,255,
+    0,92,133,0,1,43,240,136,255,1,202,11,129,0,132,255,2,92,0,92,132,255,128,0,
+    132,255,0,92,128,0,132,255,2,92,19,242,132,255,0,49,128,0,132,255,0,92,128,0,
+    132,255,0,92,137,0,138,255,1,253,86,132,0,0,174,133,255,0,69,129,0,0,99,133,
+    255,0,118,138,0,1,32,215,135,255,1,220,36,133,0,1,32,231,135,255,1,209,14,133,
+    0,1,28,210,136,255,0,140,134,0,1,57,235,134,255,1,253,115,132,0,1,53,240,134,
+    255,3,249,122,0,110,129,255,0,26,128,0,132,255,0,92,130,0,0,121,133,255,0,69,
+    134,0,0,190,131,255,0,54,128,0,145,255,136,0,132,255,0,92,135,0,0,188,132,255,
+    0,183,131,0,0,81,133,255,0,52,133,0,0,207,131,255,1,252,13,129,0,0,51,132,
+    255,0,133,140,0,0,218,132,255,0,54,137,0,1,67,242,137,255,1,239,55,136,0,132,
+    255,0,92,136,0,1,7,181,138,255,1,191,6,130,0,132,255,0,92,131,0,1,10,232,
+    132,255,0,107,128,0,132,255,0,92,143,0,1,5,167,138,255,1,166,3,131,0,132,255,
+    0,92,130,0,1,34,248,132,255,128,0,132,255,128,92,132,255,1,84,92,132,255,128,0,
+    141,255,0,128,137,0,128,255,0,168,131,0,129,255,0,140,137,0,0,73,128,255,1,250,
+    103,130,0,129,255,0,140,135,0,129,255,0,140,130,0,1,20,201,132,255,0,141,136,0,
+    128,255,0,168,128,0,0,207,139,255,131,0,1,119,253,132,255,1,167,7,132,0,1,4,
+    154,133,255,0,142,133,0,1,4,158,132,255,1,243,72,133,0,2,242,255,186,138,0,1,
+    79,242,132,255,1,241,74,132,0,1,120,254,131,255,1,250,110,133,0,2,11,158,253,134,
+    255,1,192,29,146,0,2,1,127,249,133,255,1,180,18,132,0,0,224,130,255,0,187,137,
+    0,1,54,225,132,255,1,254,120,134,0,0,63,131,255,0,226,140,0,0,227,131,255,0,
+    62,128,0,0,227,141,255,0,62,131,0,2,5,149,254,132,255,2,252,135,4,139,0,0,
+    227,131,255,0,62,139,0,0,63,131,255,0,226,131,0,1,88,240,136,255,0,226,130,0,
+    0,227,131,255,0,62,134,0,1,50,220,134,255,1,169,15,130,0,0,227,131,255,2,62,
+    0,63,131,255,0,226,128,0,0,227,131,255,0,62,128,0,0,227,131,255,2,62,0,127,
+    132,255,0,50,128,0,0,227,131,255,0,62,128,0,0,227,131,255,0,62,137,0,0,227,
+    136,255,1,238,82,133,0,1,33,223,131,255,1,253,35,129,0,1,31,251,131,255,1,160,
+    3,139,0,2,7,128,234,131,255,2,237,134,9,135,0,1,36,202,133,255,1,188,21,135,
+    0,2,5,117,227,132,255,1,197,68,136,0,2,21,159,247,131,255,1,199,61,134,0,1,
+    40,188,131,255,2,249,175,40,128,0,0,39,129,255,0,116,128,0,0,227,131,255,0,62,
+    130,0,1,7,222,132,255,0,68,134,0,0,114,131,255,0,43,128,0,0,227,143,255,0,
+    226,136,0,0,227,131,255,0,62,135,0,0,191,131,255,1,250,39,132,0,0,189,132,255,
+    0,53,133,0,0,134,131,255,0,191,130,0,1,4,228,131,255,0,60,140,0,0,129,131,
+    255,1,219,1,138,0,1,48,199,135,255,1,195,37,137,0,0,227,131,255,0,62,137,0,
+    2,2,121,242,134,255,2,251,138,6,131,0,0,227,131,255,0,62,132,0,0,112,132,255,
+    0,107,128,0,0,227,131,255,0,62,145,0,1,104,238,134,255,1,239,93,133,0,0,227,
+    131,255,0,62,131,0,0,139,131,255,0,226,128,0,0,227,131,255,2,62,20,244,130,255,
+    2,241,15,63,131,255,0,226,128,0,0,227,140,255,0,98,137,0,128,255,0,168,131,0,
+    129,255,0,140,138,0,2,66,125,50,131,0,129,255,0,140,135,0,129,255,0,140,131,0,
+    6,6,114,208,244,233,186,75,137,0,128,255,0,168,128,0,0,246,139,255,132,0,6,48,
+    162,228,250,232,176,73,136,0,6,67,174,232,249,228,170,63,136,0,6,71,177,231,246,214,
+    140,26,134,0,2,252,255,174,139,0,2,23,135,210,128,244,2,212,135,22,134,0,6,60,
+    176,235,250,226,158,43,136,0,9,39,136,199,234,250,236,211,158,69,2,149,0,7,34,138,
+    208,240,247,222,162,68,134,0,5,70,225,255,254,199,39,138,0,7,14,110,199,236,244,213,
+    149,39,136,0,1,148,245,128,255,1,227,73,140,0,1,74,227,128,255,1,245,147,129,0,
+    1,74,227,138,255,1,245,147,134,0,7,49,153,217,245,242,213,143,45,141,0,1,74,227,
+    128,255,1,245,147,141,0,1,148,245,128,255,1,227,73,132,0,7,27,132,211,243,235,191,
+    236,248,128,255,1,227,73,130,0,1,74,227,128,255,1,245,147,136,0,8,8,99,182,229,
+    249,247,216,155,58,132,0,1,74,227,128,255,1,245,147,129,0,1,148,245,128,255,1,227,
+    73,128,0,1,74,227,128,255,1,245,147,129,0,1,74,227,128,255,1,245,147,128,0,2,
+    6,165,247,128,255,1,241,135,129,0,1,74,227,128,255,1,245,147,129,0,1,74,227,128,
+    255,1,245,147,138,0,1,74,227,128,255,7,249,236,195,237,244,210,129,24,135,0,6,22,
+    136,219,248,240,195,60,131,0,5,60,181,238,242,201,93,143,0,6,4,65,102,121,102,67,
+    5,138,0,7,4,88,181,227,250,233,177,81,139,0,6,1,54,95,119,115,89,30,140,0,
+    5,14,79,109,120,96,37,138,0,5,35,96,120,110,80,18,137,0,1,74,227,128,255,1,
+    245,147,132,0,1,48,212,129,255,2,243,146,2,134,0,5,5,167,247,255,241,129,129,0,
+    1,74,227,141,255,1,227,73,136,0,1,74,227,128,255,1,245,147,136,0,1,48,211,129,
+    255,1,229,89,133,0,2,26,195,253,128,255,1,241,137,134,0,2,13,179,250,128,255,1,
+    200,43,131,0,1,69,213,128,255,1,237,129,141,0,2,8,174,249,128,255,1,211,56,141,
+    0,8,70,150,210,235,251,241,210,155,67,139,0,1,74,227,128,255,1,245,147,140,0,9,
+    16,111,179,225,244,251,234,193,126,29,133,0,1,74,227,128,255,1,245,147,133,0,2,3,
+    154,245,128,255,2,249,173,11,128,0,1,74,227,128,255,1,245,147,147,0,3,12,103,179,
+    227,128,249,3,227,180,105,14,134,0,1,74,227,128,255,1,245,147,132,0,2,8,169,248,
+    128,255,1,227,73,128,0,1,74,227,128,255,1,245,147,128,0,1,89,224,128,255,1,222,
+    82,128,0,1,148,245,128,255,1,227,73,128,0,1,74,227,137,255,2,249,172,7,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,216,0,1,5,217,129,255,0,108,134,0,0,147,129,255,0,
+    138,134,0,7,55,155,217,246,247,217,153,52,134,0,129,255,0,140,132,0,5,30,163,237,
+    246,190,55,136,0,7,1,87,187,237,249,223,153,36,131,0,128,255,0,92,137,0,128,255,
+    0,92,133,0,1,2,182,128,255,0,162,137,0,128,255,0,92,128,0,138,255,0,128,128,
+    0,128,255,0,92,128,0,128,255,0,92,135,0,128,255,0,92,133,0,8,47,144,206,241,
+    250,230,194,115,18,132,0,139,255,0,128,128,0,132,255,5,254,247,226,182,86,1,136,0,
+    8,1,79,171,227,250,241,200,121,16,132,0,133,255,3,246,224,170,69,138,0,4,6,241,
+    255,248,14,138,0,6,57,177,232,245,207,109,2,133,0,6,1,97,199,243,242,186,72,134,
+    0,7,2,98,200,244,243,198,97,1,131,0,138,255,133,0,2,175,255,45,131,0,6,13,
+    127,213,246,236,173,50,134,0,0,220,134,255,0,128,136,0,3,2,209,255,92,131,0,5,
+    19,156,237,244,185,49,133,0,2,190,236,9,134,0,6,6,114,207,246,241,191,84,135,0,
+    6,54,168,230,249,233,175,61,136,0,2,111,255,92,128,0,128,255,0,92,137,0,1,73,
+    226,128,255,2,252,192,22,133,0,7,66,155,216,242,245,217,154,53,138,0,7,46,141,210,
+    238,244,217,156,63,134,0,3,108,255,252,18,132,0,2,148,255,187,130,0,1,1,115,133,
+    0,7,5,119,212,246,226,137,10,92,128,255,128,0,128,255,7,92,13,145,229,243,204,100,
+    3,130,0,128,255,0,92,128,0,128,255,0,92,137,0,128,255,0,92,128,0,128,255,0,
+    92,138,0,7,3,97,202,243,230,150,18,92,128,255,131,0,4,96,208,247,235,188,133,0,
+    8,39,132,204,234,248,224,181,97,10,142,0,0,92,128,255,128,0,129,255,0,218,136,0,
+    0,121,129,255,128,0,1,73,226,128,255,7,248,255,208,249,233,194,111,16,129,0,2,226,
+    244,4,134,0,139,255,129,0,4,13,233,255,245,24,135,0,0,77,128,255,0,147,129,0,
+    0,185,128,255,0,58,134,0,3,47,252,255,133,129,0,3,137,255,249,6,132,0,0,34,
+    129,255,0,25,132,0,0,22,128,255,0,102,128,0,3,184,255,240,4,136,0,0,99,128,
+    255,0,35,128,0,128,255,0,92,135,0,0,92,128,255,128,0,141,255,131,0,8,3,88,
+    179,231,249,235,208,137,41,132,0,134,255,4,253,243,215,156,41,132,0,133,255,4,253,243,
+    218,167,60,136,0,7,53,148,214,242,247,217,153,52,133,0,128,255,1,201,1,134,0,0,
+    92,128,255,128,0,130,255,128,0,129,255,0,196,128,0,128,255,0,92,132,0,2,24,255,
+    211,129,0,2,36,255,203,130,0,128,255,0,92,132,0,7,24,124,203,236,248,224,162,58,
+    133,0,1,3,1,153,0,0,76,129,255,1,233,12,132,0,1,44,252,128,255,1,229,12,
+    132,0,1,14,167,134,255,1,161,11,132,0,129,255,0,140,131,0,1,35,232,130,255,1,
+    248,63,134,0,1,5,171,132,255,1,247,87,130,0,128,255,0,92,137,0,128,255,0,92,
+    133,0,0,138,128,255,1,195,7,137,0,128,255,0,92,128,0,138,255,0,128,128,0,128,
+    255,0,92,128,0,128,255,0,92,135,0,128,255,0,92,131,0,2,12,159,254,133,255,1,
+    235,84,131,0,139,255,0,128,128,0,137,255,1,197,17,134,0,1,33,198,133,255,1,232,
+    66,131,0,137,255,0,132,137,0,0,73,129,255,0,92,137,0,1,96,251,131,255,1,180,
+    3,131,0,1,6,176,132,255,0,146,132,0,1,2,170,132,255,1,171,3,130,0,137,255,
+    0,254,133,0,2,234,238,1,130,0,1,34,217,131,255,1,249,85,132,0,1,6,252,134,
+    255,0,128,136,0,0,101,128,255,0,92,130,0,1,9,210,130,255,1,245,54,131,0,2,
+    48,255,132,134,0,1,13,198,132,255,1,157,1,132,0,1,112,254,131,255,1,254,110,134,
+    0,3,19,233,255,92,128,0,128,255,0,92,137,0,0,227,131,255,0,138,131,0,1,25,
+    178,134,255,1,165,14,134,0,2,12,150,254,133,255,1,174,22,132,0,3,27,254,255,91,
+    132,0,2,225,255,108,129,0,2,21,185,255,132,0,1,6,192,131,255,1,197,98,128,255,
+    128,0,128,255,1,100,203,131,255,1,173,5,129,0,128,255,0,92,128,0,128,255,0,92,
+    137,0,128,255,0,92,128,0,128,255,0,92,137,0,1,4,180,131,255,1,221,113,128,255,
+    130,0,0,97,130,255,0,198,131,0,2,10,143,251,133,255,1,225,77,141,0,0,92,128,
+    255,128,0,130,255,0,33,135,0,0,193,129,255,128,0,0,227,136,255,1,210,17,128,0,
+    2,165,255,54,134,0,139,255,130,0,0,107,128,255,0,149,134,0,4,2,210,255,239,19,
+    129,0,4,42,251,255,204,1,132,0,4,2,200,255,224,10,129,0,0,81,128,255,0,48,
+    132,0,0,92,129,255,0,84,132,0,0,73,128,255,0,45,128,0,0,102,128,255,0,63,
+    136,0,2,177,255,209,129,0,128,255,0,92,135,0,0,92,128,255,128,0,141,255,130,0,
+    1,22,195,133,255,1,250,126,131,0,138,255,1,246,78,131,0,137,255,1,254,125,133,0,
+    1,13,158,134,255,1,161,12,131,0,129,255,0,91,134,0,0,92,128,255,128,0,1,255,
+    241,128,196,128,0,128,196,1,255,196,128,0,128,255,0,92,132,0,2,73,255,163,129,0,
+    2,83,255,155,130,0,128,255,0,92,131,0,1,98,240,133,255,1,162,10,130,0,4,84,
+    237,240,141,21,152,0,0,185,129,255,0,127,132,0,0,189,129,255,0,88,132,0,1,17,
+    208,128,255,5,221,134,95,88,132,222,128,255,1,204,15,131,0,129,255,0,140,131,0,8,
+    192,255,240,115,112,240,255,218,2,133,0,0,142,128,255,7,214,111,88,144,248,255,251,60,
+    129,0,128,255,0,92,137,0,128,255,0,92,132,0,0,91,128,255,1,221,20,138,0,128,
+    255,0,92,128,0,128,255,0,143,135,80,0,40,128,0,128,255,0,92,128,0,128,255,0,
+    92,135,0,128,255,0,92,130,0,1,14,203,128,255,9,234,144,106,87,113,185,254,255,252,
+    85,130,0,128,255,0,143,136,80,0,40,128,0,128,255,0,143,129,80,3,81,92,123,199,
+    128,255,1,207,8,132,0,1,39,233,128,255,8,187,119,88,103,179,254,255,247,61,130,0,
+    128,255,0,143,129,80,3,81,91,123,215,128,255,0,82,136,0,4,153,255,236,255,177,136,
+    0,6,44,248,255,220,108,95,184,128,255,0,130,131,0,0,150,128,255,3,215,108,93,181,
+    128,255,0,119,131,0,0,122,128,255,3,201,105,108,206,128,255,0,125,130,0,134,80,0,
+    113,128,255,0,145,132,0,2,40,255,179,130,0,10,12,213,255,246,142,89,124,238,255,247,
+    31,131,0,3,43,255,254,83,132,80,0,40,135,0,1,12,231,128,255,0,92,130,0,0,
+    120,128,255,4,141,104,233,255,204,131,0,2,163,249,24,134,0,0,168,128,255,3,180,101,
+    108,200,128,255,0,119,131,0,10,70,254,255,227,119,86,124,233,255,253,56,132,0,1,2,
+    185,128,255,0,92,128,0,128,255,0,92,137,0,132,255,0,168,130,0,1,31,221,136,255,
+    1,200,11,132,0,1,12,197,136,255,1,216,26,132,0,2,201,255,168,131,0,0,48,128,
+    255,0,29,129,0,0,92,128,255,132,0,0,141,128,255,5,192,95,108,216,255,217,128,255,
+    128,0,128,255,5,221,255,213,102,100,200,128,255,0,132,129,0,128,255,0,92,128,0,128,
+    255,0,92,137,0,128,255,0,92,128,0,128,255,0,92,137,0,0,127,128,255,5,196,96,
+    105,208,255,243,128,255,130,0,5,202,255,239,116,88,71,130,0,1,13,194,136,255,1,254,
+    110,140,0,0,92,128,255,128,0,130,255,0,104,134,0,1,14,251,129,255,128,0,138,255,
+    0,86,128,0,2,105,255,115,134,0,135,80,3,101,252,255,219,130,0,4,4,217,255,250,
+    33,133,0,0,94,128,255,0,113,131,0,0,144,128,255,0,98,132,0,0,106,128,255,0,
+    78,130,0,0,25,128,255,0,97,132,0,4,151,255,253,255,143,132,0,3,124,255,241,2,
+    128,0,3,23,253,255,138,135,0,3,9,245,255,127,129,0,128,255,0,92,135,0,0,92,
+    128,255,128,0,132,80,128,255,0,143,132,80,129,0,9,5,201,255,254,178,109,85,93,142,
+    235,128,255,0,118,130,0,128,255,0,143,131,80,6,82,104,171,253,255,240,28,130,0,128,
+    255,0,143,130,80,3,81,92,129,229,128,255,0,76,131,0,1,15,200,128,255,5,220,134,
+    95,89,133,223,128,255,1,206,16,130,0,129,255,1,225,8,133,0,0,92,128,255,128,0,
+    1,255,196,132,0,1,255,196,128,0,128,255,0,92,132,0,2,121,255,115,129,0,2,131,
+    255,107,130,0,128,255,0,92,130,0,0,114,136,255,1,183,3,129,0,0,227,129,255,2,
+    244,134,18,150,0,1,42,251,128,255,1,242,22,130,0,0,83,129,255,0,190,133,0,4,
+    181,255,254,121,4,130,0,1,4,133,128,255,0,179,131,0,129,255,0,140,130,0,0,37,
+    128,255,0,85,128,0,0,87,128,255,0,51,132,0,4,32,251,255,191,9,129,0,3,56,
+    245,255,202,129,0,128,255,0,92,137,0,128,255,0,92,131,0,4,53,247,255,239,41,139,
+    0,128,255,0,92,128,0,128,255,0,92,138,0,128,255,0,92,128,0,128,255,0,92,135,
+    0,128,255,0,92,130,0,4,174,255,253,124,8,131,0,4,57,230,255,237,17,129,0,128,
+    255,0,92,139,0,128,255,0,92,133,0,0,110,128,255,0,132,131,0,4,10,215,255,229,
+    59,131,0,4,80,250,255,225,10,129,0,128,255,0,92,132,0,3,7,202,255,211,135,0,
+    6,1,231,255,131,255,248,14,135,0,3,174,255,220,19,129,0,3,153,255,243,20,129,0,
+    0,45,128,255,1,196,10,129,0,3,142,255,247,27,129,0,4,6,239,255,184,4,128,0,
+    4,6,194,255,241,8,137,0,3,183,255,216,9,132,0,2,100,255,119,130,0,3,125,255,
+    247,58,129,0,3,43,248,255,144,131,0,2,82,255,225,143,0,0,133,129,255,0,92,130,
+    0,2,203,255,168,128,0,0,80,128,255,0,33,129,0,2,27,250,159,134,0,0,46,128,
+    255,0,138,129,0,4,3,179,255,241,8,130,0,3,205,255,215,19,129,0,3,27,226,255,
+    189,131,0,1,3,159,129,255,0,92,128,0,128,255,0,92,137,0,132,255,0,168,129,0,
+    1,6,212,138,255,0,154,132,0,0,180,138,255,1,208,5,131,0,3,120,255,240,5,130,
+    0,2,126,255,205,130,0,0,92,128,255,131,0,4,26,248,255,173,2,128,0,1,12,204,
+    129,255,128,0,129,255,1,205,12,128,0,4,4,178,255,245,25,128,0,128,255,0,92,128,
+    0,128,255,0,92,142,0,128,255,0,92,136,0,4,17,244,255,179,3,128,0,1,6,188,
+    129,255,130,0,2,240,255,131,133,0,0,181,139,255,0,87,139,0,0,92,128,255,128,0,
+    128,255,2,244,255,175,134,0,2,82,255,253,128,255,128,0,138,255,0,55,128,0,2,44,
+    255,175,143,0,0,174,128,255,0,70,131,0,0,83,128,255,0,162,132,0,4,6,223,255,
+    218,5,131,0,4,16,235,255,232,14,130,0,3,24,240,255,179,132,0,2,226,255,145,132,
+    0,4,210,255,180,255,202,132,0,2,175,255,186,130,0,2,196,255,213,135,0,0,77,128,
+    255,0,45,129,0,128,255,0,92,135,0,0,92,128,255,134,0,128,255,0,92,135,0,3,
+    105,255,250,73,131,0,4,19,202,255,251,27,129,0,128,255,0,92,134,0,3,78,252,255,
+    131,130,0,128,255,0,92,133,0,3,23,229,255,196,131,0,4,182,255,253,120,3,130,0,
+    1,5,134,128,255,0,182,130,0,130,255,0,122,133,0,0,92,128,255,128,0,1,255,196,
+    132,0,1,255,196,128,0,128,255,0,92,132,0,2,169,255,67,129,0,2,178,255,59,136,
+    0,1,59,254,137,255,0,111,129,0,132,255,2,240,127,14,149,0,0,147,129,255,0,146,
+    129,0,1,8,223,128,255,1,251,42,132,0,0,88,128,255,0,102,134,0,0,119,128,255,
+    0,87,130,0,129,255,0,140,130,0,0,82,128,255,0,13,128,0,0,16,128,255,0,84,
+    132,0,3,121,255,253,35,131,0,0,117,128,255,0,34,128,0,128,255,0,92,137,0,128,
+    255,0,92,130,0,4,25,228,255,251,68,140,0,128,255,0,92,128,0,128,255,0,92,138,
+    0,128,255,0,92,128,0,128,255,0,92,135,0,128,255,0,92,129,0,0,80,128,255,0,
+    108,134,0,3,47,252,255,127,129,0,128,255,0,92,139,0,128,255,0,92,134,0,3,149,
+    255,249,20,130,0,3,128,255,248,46,133,0,0,115,128,255,0,111,129,0,128,255,0,92,
+    133,0,0,74,128,255,0,42,134,0,6,58,255,253,22,245,255,92,134,0,3,24,252,255,
+    78,130,0,3,9,237,255,109,129,0,3,143,255,249,31,130,0,3,5,221,255,131,129,0,
+    0,58,128,255,0,51,130,0,0,59,128,255,0,60,136,0,0,74,128,255,0,69,133,0,
+    2,161,255,58,129,0,3,5,238,255,126,131,0,2,155,255,218,131,0,2,122,255,186,142,
+    0,2,30,247,242,128,255,0,92,130,0,2,242,255,108,128,0,0,17,128,255,0,75,129,
+    0,2,137,255,46,134,0,3,133,255,234,7,130,0,0,48,128,255,0,62,129,0,0,37,
+    128,255,0,73,131,0,0,90,128,255,0,23,129,0,1,14,174,130,255,0,92,128,0,128,
+    255,0,92,137,0,132,255,0,168,129,0,0,125,139,255,1,253,42,130,0,0,92,140,255,
+    0,125,131,0,0,39,128,255,0,66,130,0,2,204,255,125,130,0,0,92,128,255,131,0,
+    3,114,255,246,23,130,0,1,46,254,128,255,128,0,128,255,1,254,47,130,0,3,25,248,
+    255,107,128,0,128,255,0,92,128,0,128,255,0,92,142,0,128,255,0,92,136,0,3,95,
+    255,248,26,130,0,1,31,250,128,255,130,0,2,254,255,96,132,0,0,100,140,255,1,237,
+    24,138,0,0,92,128,255,128,0,128,255,3,179,255,241,4,133,0,2,155,255,200,128,255,
+    128,0,137,255,1,235,2,128,0,2,1,238,235,142,0,0,83,128,255,0,170,133,0,3,
+    198,255,253,42,131,0,0,111,128,255,0,79,133,0,0,102,128,255,0,139,130,0,3,168,
+    255,246,32,132,0,2,171,255,194,131,0,6,15,253,255,74,255,251,10,131,0,2,227,255,
+    129,130,0,0,115,128,255,0,32,134,0,2,155,255,219,130,0,128,255,0,92,135,0,0,
+    92,128,255,134,0,128,255,0,92,135,0,2,196,255,151,133,0,3,38,253,255,123,129,0,
+    128,255,0,92,135,0,2,168,255,209,130,0,128,255,0,92,134,0,0,104,128,255,0,29,
+    129,0,0,95,128,255,0,101,134,0,0,117,128,255,0,90,129,0,130,255,1,242,22,132,
+    0,0,92,128,255,128,0,1,255,196,132,0,1,255,196,128,0,128,255,0,92,132,0,2,
+    217,255,19,129,0,2,225,254,13,136,0,0,210,138,255,1,232,4,128,0,134,255,2,237,
+    120,11,147,0,1,18,237,128,255,1,249,34,128,0,0,125,129,255,0,140,133,0,2,215,
+    255,177,135,0,3,1,200,255,216,138,0,0,79,128,255,0,31,128,0,0,15,128,255,0,
+    66,132,0,2,183,255,196,132,0,0,28,128,255,0,76,128,0,128,255,0,92,137,0,128,
+    255,0,92,129,0,1,7,199,128,255,0,103,141,0,128,255,0,92,128,0,128,255,0,92,
+    138,0,128,255,0,92,128,0,128,255,0,92,135,0,128,255,0,92,129,0,2,208,255,187,
+    136,0,2,161,255,208,129,0,128,255,0,92,139,0,128,255,0,92,134,0,3,18,244,255,
+    113,129,0,3,9,240,255,134,134,0,3,5,228,255,207,129,0,128,255,0,92,133,0,0,
+    18,128,255,0,76,134,0,6,138,255,203,0,180,255,178,134,0,3,91,255,237,3,131,0,
+    2,151,255,183,129,0,2,204,255,175,132,0,2,131,255,209,129,0,0,85,128,255,0,10,
+    130,0,0,12,128,255,0,85,135,0,3,1,208,255,181,134,0,2,221,247,6,129,0,3,
+    65,255,249,18,131,0,2,58,147,122,131,0,2,161,255,148,142,0,2,166,255,122,128,255,
+    0,92,130,0,2,252,255,94,128,0,0,3,128,255,0,88,128,0,2,12,239,187,135,0,
+    2,118,212,166,131,0,0,8,128,255,0,85,129,0,3,95,255,247,4,131,0,0,19,128,
+    255,0,71,128,0,1,54,225,128,255,0,151,128,255,0,92,128,0,128,255,0,92,137,0,
+    132,255,0,168,128,0,1,6,236,140,255,0,141,130,0,0,218,140,255,1,236,7,131,0,
+    2,214,255,143,129,0,3,27,254,255,46,130,0,0,92,128,255,131,0,2,180,255,179,132,
+    0,0,200,128,255,128,0,128,255,0,199,132,0,2,180,255,178,128,0,128,255,0,92,128,
+    0,128,255,0,92,142,0,128,255,0,92,136,0,2,166,255,180,132,0,0,186,128,255,130,
+    0,128,255,0,92,131,0,1,2,223,141,255,0,132,138,0,0,92,128,255,128,0,128,255,
+    3,109,252,255,60,133,0,2,226,255,127,128,255,128,0,137,255,0,163,130,0,2,179,255,
+    40,140,0,4,12,228,255,243,27,133,0,0,60,128,255,0,174,130,0,3,13,234,255,190,
+    134,0,4,2,206,255,249,37,128,0,0,71,128,255,0,123,133,0,3,115,255,241,1,130,
+    0,6,72,255,217,6,248,255,64,130,0,0,22,128,255,0,72,130,0,0,34,128,255,0,
+    107,133,0,3,1,230,255,138,130,0,128,255,0,92,135,0,0,92,128,255,134,0,128,255,
+    0,92,135,0,2,240,255,99,134,0,2,199,255,169,129,0,128,255,0,92,135,0,2,105,
+    255,240,130,0,128,255,0,92,134,0,0,29,128,255,0,63,129,0,2,216,255,179,135,0,
+    3,1,195,255,217,129,0,128,255,0,173,128,255,0,153,132,0,0,92,128,255,128,0,1,
+    255,196,132,0,1,255,196,128,0,128,255,0,92,131,0,2,10,253,227,129,0,2,16,255,
+    219,136,0,0,58,140,255,0,70,128,0,0,253,135,255,2,233,113,8,146,0,0,109,129,
+    255,3,164,0,28,245,128,255,1,229,13,132,0,0,61,128,255,0,52,136,0,0,65,128,
+    255,0,60,137,0,0,30,128,255,0,123,128,0,3,83,255,248,19,132,0,2,140,200,128,
+    132,0,0,6,128,255,0,83,128,0,128,255,0,92,137,0,128,255,0,92,129,0,0,160,
+    128,255,0,141,142,0,128,255,0,92,128,0,128,255,0,92,138,0,128,255,0,92,128,0,
+    128,255,0,92,135,0,128,255,0,92,128,0,0,53,128,255,0,63,136,0,3,72,225,141,
+    2,128,0,128,255,0,92,139,0,128,255,0,92,135,0,2,163,255,195,129,0,3,87,255,
+    253,25,135,0,3,137,209,134,2,128,0,128,255,0,92,133,0,0,9,128,255,0,76,134,
+    0,7,218,255,134,0,104,255,248,14,133,0,2,150,255,184,132,0,2,93,255,241,129,0,
+    2,239,255,117,132,0,3,83,255,253,9,128,0,0,72,128,255,0,36,130,0,0,33,128,
+    255,0,67,135,0,0,79,128,255,0,48,133,0,2,25,255,193,130,0,2,132,255,195,140,
+    0,2,201,255,109,141,0,3,54,254,227,9,128,255,0,92,130,0,2,238,255,107,128,0,
+    0,16,128,255,0,74,128,0,2,110,255,73,143,0,0,35,128,255,0,62,129,0,2,92,
+    215,211,132,0,0,11,128,255,0,87,128,0,0,128,128,255,1,131,1,128,255,0,92,128,
+    0,128,255,7,92,26,160,234,241,199,92,2,130,0,0,227,131,255,0,138,128,0,0,81,
+    133,255,1,192,189,132,255,0,212,129,0,0,61,132,255,3,250,174,183,253,132,255,0,86,
+    131,0,2,133,255,220,129,0,2,105,255,222,130,0,132,255,129,0,2,224,255,128,132,0,
+    0,142,128,255,128,0,128,255,0,139,132,0,2,130,255,218,128,0,128,255,0,92,128,0,
+    128,255,0,92,130,0,0,146,128,255,0,102,129,0,128,255,0,92,128,0,128,255,7,92,
+    21,148,227,249,221,135,12,129,0,2,214,255,128,132,0,0,132,128,255,128,0,133,255,129,
+    0,0,71,133,255,2,209,171,238,132,255,1,232,4,130,0,7,2,92,199,241,232,156,24,
+    92,128,255,128,0,128,255,3,92,199,255,131,132,0,3,44,255,217,92,128,255,128,0,137,
+    255,0,68,130,0,2,119,255,101,140,0,0,139,128,255,0,113,135,0,0,176,128,255,0,
+    53,129,0,3,127,255,253,48,135,0,0,61,128,255,6,176,0,7,220,255,217,6,133,0,
+    0,60,128,255,0,35,130,0,6,131,255,159,0,197,255,123,130,0,3,73,255,254,16,131,
+    0,2,209,255,182,133,0,0,54,128,255,0,56,130,0,128,255,0,92,135,0,0,92,128,
+    255,134,0,128,255,0,92,135,0,2,247,255,130,134,0,2,109,159,103,129,0,128,255,0,
+    92,135,0,2,104,255,247,130,0,128,255,0,92,134,0,0,5,128,255,0,86,128,0,0,
+    62,128,255,0,56,136,0,0,66,128,255,0,61,128,0,128,255,4,92,194,255,252,43,131,
+    0,0,92,128,255,128,0,1,255,196,132,0,1,255,196,128,0,128,255,0,92,128,0,140,
+    255,134,0,0,141,132,255,2,164,110,253,131,255,0,130,128,0,0,192,137,255,2,229,106,
+    6,144,0,1,4,213,128,255,2,253,43,162,129,255,0,89,133,0,2,134,255,218,137,0,
+    3,2,236,255,134,138,0,2,188,255,240,128,25,2,226,255,153,142,0,0,46,128,255,0,
+    54,128,0,128,255,0,92,137,0,128,255,0,92,128,0,0,114,128,255,1,178,2,142,0,
+    128,255,0,92,128,0,128,255,0,92,138,0,128,255,0,92,128,0,128,255,0,92,135,0,
+    128,255,0,92,128,0,3,128,255,237,3,136,0,0,1,131,0,128,255,0,92,139,0,128,
+    255,0,92,135,0,3,95,255,245,3,128,0,2,153,255,200,136,0,0,1,131,0,128,255,
+    0,92,133,0,0,43,128,255,0,39,133,0,0,43,128,255,5,59,0,26,254,255,93,133,
+    0,2,188,255,146,132,0,0,56,128,255,0,21,128,0,2,252,255,96,132,0,0,68,128,
+    255,0,45,128,0,3,29,254,255,135,130,0,3,129,255,246,18,135,0,2,194,255,182,134,
+    0,2,86,255,132,130,0,2,172,255,146,128,0,3,22,65,59,7,134,0,7,240,255,70,
+    0,44,73,50,2,136,0,3,197,255,95,0,128,255,0,92,130,0,2,195,255,167,128,0,
+    0,75,128,255,5,31,0,3,221,213,1,143,0,3,155,255,238,9,138,0,0,51,128,255,
+    0,70,128,0,2,128,226,71,128,0,128,255,0,92,128,0,128,255,1,123,231,131,255,1,
+    166,3,129,0,1,74,227,128,255,2,253,193,22,128,0,0,146,132,255,3,133,0,1,202,
+    131,255,1,254,6,128,0,0,134,132,255,0,221,128,152,0,244,132,255,0,150,131,0,0,
+    52,128,255,0,41,128,0,2,183,255,143,130,0,132,255,129,0,2,245,255,102,132,0,0,
+    108,128,255,128,0,128,255,0,106,132,0,2,103,255,238,128,0,128,255,0,92,128,0,128,
+    255,0,92,129,0,0,91,128,255,0,146,130,0,128,255,0,92,128,0,128,255,1,126,229,
+    131,255,1,199,4,128,0,2,235,255,102,132,0,0,104,128,255,128,0,133,255,129,0,0,
+    140,132,255,4,166,1,0,30,233,132,255,0,50,129,0,1,5,179,131,255,1,229,121,128,
+    255,128,0,128,255,3,92,127,255,202,132,0,3,116,255,143,92,128,255,128,0,133,255,3,
+    55,94,161,88,131,0,2,58,255,161,139,0,4,41,250,255,209,4,135,0,3,40,251,255,
+    184,128,0,3,19,242,255,156,137,0,0,167,128,255,1,61,123,128,255,0,68,134,0,3,
+    9,251,255,83,130,0,6,190,255,101,0,139,255,182,130,0,2,124,255,213,132,0,3,128,
+    255,247,10,132,0,3,132,255,229,1,130,0,128,255,0,92,135,0,0,92,128,255,134,0,
+    128,255,0,92,135,0,3,217,255,234,27,139,0,128,255,0,92,135,0,2,157,255,217,130,
+    0,128,255,0,92,134,0,0,19,128,255,0,72,128,0,2,130,255,223,137,0,3,4,240,
+    255,134,128,0,128,255,4,92,52,254,255,184,131,0,0,92,128,255,128,0,1,255,196,132,
+    0,1,255,196,128,0,128,255,0,92,128,0,140,255,134,0,0,190,131,255,0,205,128,0,
+    0,183,131,255,0,138,128,0,1,22,177,138,255,1,224,82,144,0,0,71,129,255,1,200,
+    254,128,255,0,192,134,0,2,189,255,164,138,0,2,167,255,189,138,0,7,54,253,255,190,
+    223,255,211,13,142,0,3,165,255,234,3,128,0,128,255,0,92,137,0,128,255,6,92,0,
+    70,252,255,207,12,143,0,128,255,0,92,128,0,128,255,0,92,138,0,128,255,0,92,128,
+    0,128,255,0,92,135,0,128,255,0,92,128,0,2,185,255,168,143,0,128,255,0,92,139,
+    0,128,255,0,92,135,0,0,49,128,255,0,42,128,0,2,201,255,147,142,0,128,255,0,
+    92,133,0,2,150,255,209,134,0,3,123,255,234,2,128,0,2,203,255,179,133,0,2,219,
+    255,121,132,0,0,30,128,255,0,55,128,0,2,242,255,103,132,0,0,79,128,255,0,68,
+    129,0,9,175,255,251,123,25,24,120,250,255,132,135,0,0,46,128,255,0,63,134,0,2,
+    147,255,71,130,0,5,207,255,115,14,162,251,128,255,1,238,101,132,0,0,24,128,255,1,
+    105,215,129,255,1,226,84,134,0,4,87,255,207,2,0,128,255,0,92,130,0,7,113,255,
+    254,141,101,230,255,200,128,0,2,84,255,100,140,0,3,1,13,55,175,128,255,0,106,139,
+    0,0,138,128,255,0,24,128,0,1,43,9,129,0,128,255,0,92,128,0,128,255,5,250,
+    255,208,102,99,198,128,255,0,127,138,0,0,195,131,255,1,247,11,128,0,0,110,131,255,
+    1,226,1,128,0,0,185,142,255,0,201,132,0,7,226,255,118,0,12,248,255,63,130,0,
+    1,80,143,128,255,128,80,129,0,2,252,255,94,132,0,0,96,128,255,128,0,128,255,0,
+    94,132,0,2,95,255,251,128,0,128,255,0,92,128,0,128,255,0,92,128,0,4,47,246,
+    255,187,4,130,0,128,255,0,92,128,0,128,255,5,252,255,168,91,114,222,128,255,0,99,
+    128,0,2,251,255,94,132,0,0,95,128,255,128,0,128,80,128,255,0,143,128,80,129,0,
+    0,192,131,255,1,253,26,129,0,0,116,132,255,0,105,129,0,0,136,128,255,5,190,94,
+    104,207,255,248,128,255,128,0,128,255,4,92,55,255,253,19,131,0,3,189,255,70,92,128,
+    255,128,0,132,255,0,235,135,0,2,6,247,222,139,0,3,189,255,254,58,137,0,0,152,
+    128,255,5,58,0,138,255,243,24,137,0,6,29,245,255,201,241,255,168,136,0,2,205,255,
+    132,129,0,8,4,244,255,43,0,81,255,239,1,129,0,2,175,255,155,132,0,0,47,128,
+    255,0,76,132,0,2,210,255,149,131,0,128,255,0,92,135,0,0,92,128,255,134,0,128,
+    255,0,92,135,0,0,139,128,255,2,237,128,33,137,0,128,255,0,92,134,0,3,44,246,
+    255,147,130,0,128,255,0,92,134,0,0,78,128,255,0,30,128,0,2,182,255,170,138,0,
+    2,171,255,189,128,0,128,255,2,92,0,164,128,255,0,71,130,0,0,92,128,255,128,0,
+    1,255,196,132,0,1,255,196,128,0,128,255,0,92,128,0,129,80,2,178,255,143,129,80,
+    2,186,255,138,128,80,134,0,0,227,131,255,0,131,128,0,0,82,130,255,1,227,35,130,
+    0,1,51,179,137,255,1,254,58,144,0,0,180,131,255,1,251,43,134,0,2,226,255,122,
+    138,0,2,132,255,225,139,0,0,141,129,255,1,195,24,142,0,0,108,128,255,0,121,129,
+    0,128,255,0,92,137,0,128,255,2,92,37,239,128,255,0,90,144,0,128,255,0,92,128,
+    0,128,255,0,92,138,0,128,255,0,92,128,0,128,255,0,143,135,80,128,255,0,92,128,
+    0,2,222,255,133,143,0,128,255,0,92,139,0,128,255,0,92,135,0,0,21,128,255,0,
+    63,128,0,2,233,255,115,142,0,128,255,0,92,130,0,5,10,43,148,255,254,65,134,0,
+    2,204,255,159,129,0,3,124,255,249,15,132,0,2,237,255,105,132,0,0,14,128,255,0,
+    70,128,0,2,214,255,146,132,0,0,122,128,255,0,81,129,0,1,17,202,131,255,2,250,
+    133,1,135,0,2,141,255,215,135,0,2,207,253,14,130,0,3,230,255,111,209,132,255,0,
+    119,131,0,0,63,135,255,0,110,132,0,3,7,223,255,67,128,0,128,255,0,92,130,0,
+    1,7,207,130,255,1,244,51,128,0,2,199,234,8,140,0,0,62,129,255,1,250,114,139,
+    0,3,17,239,255,197,134,0,128,255,0,92,128,0,129,255,1,195,8,128,0,4,3,175,
+    255,244,23,137,0,0,228,131,255,0,204,129,0,1,16,214,128,255,2,235,180,48,129,0,
+    0,223,142,255,0,229,132,0,7,146,255,194,0,81,255,236,3,131,0,0,92,128,255,131,
+    0,2,239,255,103,132,0,0,101,128,255,128,0,128,255,0,101,132,0,2,104,255,238,128,
+    0,128,255,0,92,128,0,128,255,6,92,0,17,221,255,219,17,131,0,128,255,0,92,128,
+    0,129,255,0,115,129,0,3,21,234,255,180,128,0,2,242,255,103,132,0,0,103,128,255,
+    130,0,128,255,0,92,131,0,0,225,131,255,0,212,130,0,0,48,132,255,0,137,128,0,
+    4,25,249,255,167,1,128,0,1,6,188,129,255,128,0,128,255,4,92,2,236,255,87,130,
+    0,4,11,249,245,7,92,128,255,128,0,132,255,0,194,136,0,2,193,255,26,137,0,0,
+    89,128,255,0,157,138,0,7,24,244,255,181,20,244,255,122,139,0,0,126,129,255,1,242,
+    26,136,0,2,149,255,180,129,0,5,52,255,239,1,0,23,128,255,0,45,129,0,2,227,
+    255,98,133,0,2,222,255,151,131,0,0,32,128,255,0,67,131,0,128,255,0,92,135,0,
+    0,92,128,255,134,0,128,255,0,92,135,0,1,23,234,130,255,3,212,140,65,4,133,0,
+    128,255,0,92,131,0,6,10,35,107,236,255,244,32,130,0,128,255,0,92,133,0,3,7,
+    202,255,211,129,0,2,220,255,127,138,0,2,136,255,225,128,0,128,255,6,92,0,29,247,
+    255,211,3,129,0,0,92,128,255,128,0,1,255,196,132,0,1,255,196,128,0,128,255,0,
+    92,131,0,2,179,255,56,129,0,2,191,255,48,136,0,0,243,131,255,0,102,129,0,4,
+    79,137,105,58,5,133,0,1,52,180,136,255,0,123,144,0,1,38,250,130,255,0,141,135,
+    0,2,245,255,106,138,0,2,112,255,244,138,0,1,83,228,128,255,1,253,34,142,0,4,
+    84,253,255,200,5,129,0,128,255,0,92,137,0,128,255,1,106,215,129,255,1,219,7,143,
+    0,128,255,0,92,128,0,137,255,0,128,129,0,128,255,0,92,128,0,140,255,0,92,128,
+    0,2,244,255,112,143,0,139,255,129,0,128,255,0,92,135,0,0,8,128,255,0,78,128,
+    0,2,248,255,99,142,0,136,255,1,250,93,134,0,0,28,128,255,0,80,129,0,0,46,
+    128,255,0,94,132,0,2,247,255,98,132,0,0,7,128,255,0,80,128,0,3,157,255,230,
+    8,130,0,1,1,210,128,255,0,88,130,0,1,35,226,130,255,2,238,109,5,134,0,3,
+    2,229,255,115,134,0,2,14,253,206,131,0,11,241,255,227,255,181,43,8,62,212,255,253,
+    54,130,0,0,103,128,255,8,231,92,17,15,89,229,255,252,55,131,0,2,119,255,181,129,
+    0,128,255,0,92,131,0,5,17,154,236,245,186,49,128,0,2,57,255,128,141,0,0,88,
+    130,255,1,194,44,138,0,0,162,128,255,0,81,134,0,128,255,0,92,128,0,128,255,1,
+    251,35,130,0,3,23,247,255,105,137,0,0,242,131,255,0,178,130,0,2,4,48,26,132,
+    0,0,239,142,255,0,244,132,0,6,65,255,251,15,148,255,160,132,0,0,92,128,255,131,
+    0,2,214,255,131,132,0,0,123,128,255,128,0,128,255,0,125,132,0,2,132,255,215,128,
+    0,128,255,0,92,128,0,128,255,5,92,2,183,255,241,41,132,0,128,255,0,92,128,0,
+    128,255,1,218,1,130,0,2,147,255,223,128,0,2,220,255,130,132,0,0,128,128,255,130,
+    0,128,255,0,92,131,0,0,241,131,255,0,180,130,0,0,13,132,255,0,154,128,0,3,
+    106,255,245,20,130,0,1,34,251,128,255,128,0,128,255,4,92,0,167,255,158,130,0,4,
+    78,255,179,0,92,128,255,128,0,132,255,0,176,136,0,2,133,255,87,136,0,4,12,229,
+    255,237,20,139,0,0,129,128,255,3,174,255,225,8,139,0,1,9,224,128,255,0,117,137,
+    0,2,94,255,229,129,0,2,111,255,183,129,0,2,221,255,104,128,0,0,22,128,255,0,
+    41,133,0,2,141,255,226,131,0,3,110,255,237,4,131,0,128,255,0,92,135,0,0,92,
+    128,255,134,0,128,255,0,92,136,0,1,53,234,132,255,2,235,141,17,131,0,138,255,1,
+    246,75,131,0,128,255,0,92,130,0,3,2,21,79,203,128,255,0,89,129,0,2,236,255,
+    109,138,0,2,114,255,243,128,0,128,255,0,92,128,0,0,134,128,255,0,102,129,0,0,
+    92,128,255,128,0,1,255,196,132,0,1,255,196,128,0,128,255,0,92,131,0,2,222,255,
+    14,129,0,2,234,253,8,136,0,0,252,131,255,0,94,129,0,3,13,74,55,15,136,0,
+    1,55,231,134,255,0,128,145,0,0,142,129,255,1,239,13,135,0,2,253,255,95,138,0,
+    2,96,255,252,136,0,1,1,143,128,255,3,236,254,255,181,141,0,4,56,248,255,227,26,
+    130,0,128,255,0,92,137,0,128,255,3,238,255,254,183,128,255,0,124,143,0,128,255,0,
+    92,128,0,137,255,0,128,129,0,128,255,0,92,128,0,140,255,0,92,128,0,2,253,255,
+    96,132,0,0,164,133,255,0,92,128,0,139,255,129,0,128,255,0,92,135,0,0,4,128,
+    255,0,89,128,0,2,253,255,94,142,0,137,255,1,167,18,133,0,3,108,255,247,11,130,
+    0,2,223,255,179,132,0,2,254,255,93,132,0,0,2,128,255,0,89,128,0,0,65,128,
+    255,1,156,1,129,0,0,122,129,255,0,87,129,0,10,82,249,255,194,102,90,159,253,255,
+    175,3,133,0,3,68,255,252,22,134,0,2,72,255,145,131,0,0,251,128,255,1,188,3,
+    129,0,3,21,233,255,178,130,0,3,127,254,239,32,130,0,3,34,240,255,182,130,0,3,
+    21,241,252,43,129,0,128,255,0,92,139,0,9,172,247,22,0,13,149,236,243,179,39,134,
+    0,7,61,103,88,147,248,255,239,35,136,0,0,104,128,255,0,185,135,0,128,255,0,92,
+    128,0,128,255,0,187,132,0,2,179,255,177,137,0,0,252,131,255,0,170,131,0,1,9,
+    6,132,0,0,252,143,255,132,0,6,3,236,255,80,212,255,80,132,0,0,92,128,255,131,
+    0,2,165,255,186,132,0,0,174,128,255,128,0,128,255,0,175,132,0,2,185,255,167,128,
+    0,128,255,0,92,128,0,128,255,4,92,133,255,253,73,133,0,128,255,0,92,128,0,128,
+    255,0,146,131,0,2,105,255,244,128,0,2,172,255,180,132,0,0,177,128,255,130,0,128,
+    255,0,92,131,0,0,252,131,255,0,171,130,0,0,3,132,255,0,163,128,0,2,175,255,
+    177,132,0,0,191,128,255,128,0,128,255,4,92,0,96,255,228,130,0,4,150,255,105,0,
+    92,128,255,128,0,132,255,0,168,136,0,2,72,255,147,136,0,0,140,128,255,0,100,140,
+    0,1,12,232,129,255,0,89,140,0,1,9,222,128,255,0,158,137,0,0,38,128,255,0,
+    22,128,0,2,170,255,124,129,0,2,163,255,163,128,0,3,73,255,238,1,133,0,0,60,
+    128,255,0,45,130,0,2,187,255,159,132,0,128,255,0,92,135,0,0,92,128,255,134,0,
+    128,255,0,92,137,0,2,21,140,237,132,255,1,232,69,130,0,136,255,2,238,158,35,132,
+    0,138,255,0,155,130,0,2,250,255,96,138,0,2,96,255,252,128,0,128,255,0,92,128,
+    0,4,13,233,255,232,13,128,0,0,92,128,255,128,0,1,255,196,132,0,1,255,196,128,
+    0,128,255,0,92,130,0,2,10,254,226,129,0,2,21,255,218,137,0,0,242,131,255,0,
+    103,128,0,1,19,226,129,255,1,211,47,132,0,2,2,89,215,135,255,0,127,145,0,0,
+    142,129,255,1,254,56,135,0,2,241,255,105,138,0,2,109,255,237,136,0,0,138,128,255,
+    2,200,25,148,128,255,5,90,0,5,164,102,24,134,0,4,12,226,255,239,44,131,0,128,
+    255,0,92,137,0,130,255,5,122,8,223,255,246,32,142,0,128,255,0,92,128,0,128,255,
+    0,143,134,80,0,40,129,0,128,255,0,92,128,0,128,255,0,92,135,0,128,255,0,92,
+    128,0,2,246,255,105,132,0,0,164,133,255,0,92,128,0,128,255,0,143,136,80,129,0,
+    128,255,0,92,135,0,0,22,128,255,0,81,128,0,2,245,255,105,142,0,128,255,0,143,
+    130,80,2,86,112,184,128,255,1,192,5,132,0,2,189,255,180,131,0,3,145,255,249,15,
+    131,0,2,247,255,98,132,0,0,7,128,255,0,82,129,0,0,179,128,255,5,196,101,92,
+    172,255,191,128,255,0,80,128,0,3,36,247,255,150,130,0,3,75,252,255,121,133,0,2,
+    150,255,192,135,0,2,133,255,84,131,0,0,251,128,255,0,46,131,0,3,117,255,252,11,
+    130,0,1,10,26,132,0,3,123,255,253,13,129,0,2,152,255,154,130,0,128,255,0,92,
+    138,0,5,34,252,155,0,3,194,128,255,3,252,255,237,38,137,0,3,55,246,255,170,135,
+    0,4,75,251,255,234,26,135,0,128,255,0,92,128,0,128,255,0,130,132,0,2,128,255,
+    217,137,0,0,242,131,255,0,179,130,0,0,134,128,252,2,220,177,71,129,0,0,243,142,
+    255,0,226,133,0,5,159,255,163,254,246,10,132,0,0,92,128,255,131,0,3,91,255,251,
+    32,130,0,1,22,246,128,255,128,0,128,255,1,245,20,130,0,3,30,250,255,95,128,0,
+    128,255,0,92,128,0,128,255,3,171,254,255,198,134,0,128,255,0,92,128,0,128,255,0,
+    109,131,0,2,92,255,254,128,0,3,103,255,246,22,130,0,1,21,246,128,255,130,0,128,
+    255,0,92,131,0,0,241,131,255,0,180,130,0,0,13,132,255,0,149,128,0,2,217,255,
+    127,132,0,0,138,128,255,128,0,128,255,5,92,0,24,254,255,44,129,0,4,222,255,32,
+    0,92,128,255,128,0,132,255,0,168,136,0,2,14,253,208,135,0,4,42,250,255,198,1,
+    141,0,0,105,128,255,1,199,1,140,0,0,130,129,255,1,254,53,136,0,3,1,237,255,
+    70,128,0,2,229,255,66,129,0,2,105,255,217,128,0,2,124,255,182,134,0,3,2,232,
+    255,120,129,0,3,14,250,255,78,132,0,128,255,0,92,135,0,0,92,128,255,134,0,128,
+    255,0,92,139,0,3,6,74,151,226,130,255,1,244,50,129,0,128,255,0,143,128,80,5,
+    85,114,209,255,252,108,134,0,136,255,1,212,97,131,0,2,245,255,101,138,0,2,107,255,
+    240,128,0,128,255,0,92,129,0,0,103,128,255,0,133,128,0,0,92,128,255,128,0,1,
+    255,196,132,0,1,255,196,128,0,128,255,0,92,130,0,2,52,255,183,129,0,2,64,255,
+    175,137,0,0,226,131,255,0,135,128,0,0,99,131,255,0,189,130,0,2,1,86,213,137,
+    255,0,89,144,0,1,38,250,130,255,1,201,1,134,0,2,224,255,122,138,0,2,127,255,
+    219,135,0,11,56,254,255,202,11,0,10,219,255,235,20,56,128,255,0,74,134,0,0,105,
+    128,255,0,75,132,0,128,255,0,92,137,0,129,255,0,163,128,0,0,85,128,255,0,176,
+    142,0,128,255,0,92,128,0,128,255,0,92,138,0,128,255,0,92,128,0,128,255,0,92,
+    135,0,128,255,0,92,128,0,2,228,255,122,132,0,0,51,131,80,128,255,0,92,128,0,
+    128,255,0,92,139,0,128,255,0,92,135,0,0,40,128,255,0,65,128,0,2,226,255,120,
+    142,0,128,255,0,92,133,0,0,110,128,255,0,94,131,0,3,17,251,255,184,131,120,0,
+    165,128,255,0,94,131,0,2,238,255,105,132,0,0,14,128,255,0,72,129,0,1,17,204,
+    131,255,1,211,40,128,255,0,67,128,0,3,141,255,223,6,131,0,3,147,255,229,5,132,
+    0,2,218,255,111,135,0,2,193,255,24,131,0,2,241,255,225,132,0,0,44,128,255,0,
+    58,138,0,0,44,128,255,0,62,128,0,3,43,252,243,24,130,0,128,255,0,92,138,0,
+    11,146,254,42,0,97,255,244,57,15,195,255,181,138,0,3,126,255,251,13,133,0,4,62,
+    245,255,250,64,136,0,128,255,0,92,128,0,128,255,0,102,132,0,2,103,255,237,137,0,
+    0,227,131,255,0,205,129,0,0,32,131,255,1,252,35,128,0,0,228,142,255,0,144,133,
+    0,4,78,255,252,255,177,133,0,0,92,128,255,131,0,4,9,231,255,191,7,128,0,1,
+    2,173,129,255,128,0,129,255,1,170,2,128,0,4,5,185,255,235,11,128,0,128,255,0,
+    92,128,0,132,255,0,62,133,0,128,255,0,92,128,0,128,255,0,95,131,0,0,92,128,
+    255,128,0,4,15,242,255,172,2,128,0,1,2,171,129,255,130,0,128,255,0,92,131,0,
+    0,225,131,255,0,211,130,0,0,48,132,255,0,134,128,0,2,237,255,102,132,0,0,108,
+    128,255,128,0,128,255,0,92,128,0,2,208,255,114,128,0,2,39,255,214,128,0,0,92,
+    128,255,128,0,132,255,0,168,137,0,2,207,253,15,134,0,3,191,255,252,48,142,0,0,
+    4,128,255,0,96,140,0,7,37,248,255,184,251,255,199,1,136,0,7,183,255,119,0,32,
+    255,252,12,129,0,7,47,255,254,15,0,175,255,124,135,0,2,154,255,195,129,0,3,87,
+    255,243,8,132,0,2,251,255,93,135,0,2,94,255,252,134,0,128,255,0,92,143,0,2,
+    52,146,244,128,255,0,190,129,0,128,255,0,92,130,0,1,5,180,128,255,0,111,133,0,
+    128,255,0,143,130,80,2,75,59,23,133,0,2,228,255,117,138,0,2,124,255,224,128,0,
+    128,255,0,92,129,0,6,3,212,255,246,29,0,92,128,255,128,0,1,255,196,132,0,1,
+    255,196,128,0,128,255,0,92,130,0,2,95,255,141,129,0,2,107,255,133,137,0,0,187,
+    131,255,0,204,128,0,0,160,131,255,0,202,129,0,1,83,211,138,255,1,164,6,144,0,
+    0,179,132,255,0,93,134,0,2,184,255,165,138,0,2,171,255,186,135,0,3,169,255,254,
+    44,129,0,7,58,253,255,164,133,255,249,11,134,0,2,188,255,183,133,0,128,255,0,92,
+    137,0,128,255,1,198,7,129,0,0,194,128,255,0,74,141,0,128,255,0,92,128,0,128,
+    255,0,92,138,0,128,255,0,92,128,0,128,255,0,92,135,0,128,255,0,92,128,0,2,
+    192,255,164,138,0,128,255,0,92,128,0,128,255,0,92,139,0,128,255,0,92,135,0,0,
+    63,128,255,0,34,128,0,2,192,255,158,136,0,128,2,130,0,128,255,0,92,134,0,2,
+    197,255,190,131,0,0,93,137,255,0,180,131,0,2,225,255,121,132,0,0,31,128,255,0,
+    55,130,0,7,8,125,217,248,219,128,12,31,128,255,0,45,128,0,2,211,255,137,132,0,
+    0,50,128,255,0,46,131,0,0,29,128,255,0,36,134,0,2,6,247,219,132,0,2,229,
+    255,192,132,0,0,11,128,255,0,80,138,0,0,10,128,255,0,83,128,0,2,184,255,126,
+    131,0,128,255,0,92,137,0,2,16,243,183,128,0,2,185,255,156,128,0,3,65,255,253,
+    19,137,0,0,39,128,255,0,65,132,0,1,56,243,128,255,0,97,137,0,128,255,0,92,
+    128,0,128,255,0,93,132,0,2,95,255,251,137,0,0,194,131,255,1,247,10,128,0,0,
+    98,132,255,0,75,128,0,0,196,131,255,1,244,11,128,0,1,2,222,131,255,0,213,133,
+    0,1,8,244,128,255,0,98,133,0,0,92,128,255,132,0,0,83,128,255,5,210,105,95,
+    194,255,253,128,255,128,0,130,255,3,196,98,100,204,128,255,0,92,129,0,128,255,0,92,
+    128,0,129,255,3,202,227,255,198,133,0,128,255,0,92,128,0,128,255,0,92,131,0,0,
+    92,128,255,129,0,0,110,128,255,0,196,128,98,4,197,255,253,255,253,130,0,128,255,0,
+    92,131,0,0,192,131,255,1,252,24,129,0,0,115,132,255,0,97,128,0,2,252,255,94,
+    132,0,0,96,128,255,128,0,128,255,0,92,128,0,2,136,255,185,128,0,2,112,255,141,
+    128,0,0,92,128,255,128,0,132,255,0,168,137,0,2,147,255,73,133,0,0,90,128,255,
+    0,144,144,0,128,255,0,92,140,0,4,184,255,247,29,154,128,255,0,95,136,0,6,128,
+    255,167,0,91,255,206,130,0,7,2,242,255,66,0,226,255,67,135,0,3,73,255,252,18,
+    128,0,2,165,255,170,133,0,2,240,255,98,135,0,2,105,255,244,134,0,128,255,0,92,
+    145,0,1,32,220,128,255,0,31,128,0,128,255,0,92,131,0,4,14,226,255,249,50,132,
+    0,128,255,0,92,140,0,2,191,255,157,138,0,2,168,255,186,128,0,128,255,0,92,130,
+    0,0,73,128,255,2,164,0,92,128,255,128,0,1,255,196,132,0,1,255,196,128,0,128,
+    255,0,92,128,0,140,255,129,0,128,255,0,92,128,0,0,136,132,255,2,147,108,250,131,
+    255,0,152,128,0,0,134,138,255,1,192,59,145,0,0,70,129,255,1,176,234,128,255,1,
+    229,11,133,0,2,130,255,221,138,0,2,227,255,126,135,0,2,232,255,200,131,0,0,138,
+    128,255,2,241,255,185,135,0,2,227,255,121,133,0,128,255,0,92,137,0,128,255,0,92,
+    130,0,4,49,253,255,220,7,140,0,128,255,0,89,128,0,128,255,0,92,138,0,128,255,
+    0,92,128,0,128,255,0,92,135,0,128,255,0,92,128,0,2,139,255,220,138,0,128,255,
+    0,92,128,0,128,255,0,92,139,0,128,255,0,92,135,0,3,122,255,243,3,128,0,2,
+    142,255,206,136,0,3,60,234,158,37,128,0,128,255,0,92,134,0,2,120,255,229,131,0,
+    0,174,137,255,1,249,16,130,0,2,194,255,146,132,0,0,56,128,255,0,23,137,0,0,
+    65,128,255,0,13,128,0,2,239,255,99,132,0,0,10,128,255,0,76,131,0,2,96,255,
+    233,135,0,2,58,255,158,132,0,2,201,255,190,132,0,0,4,128,255,0,82,138,0,0,
+    6,128,255,0,82,128,0,139,255,135,0,2,119,255,68,128,0,2,233,255,109,128,0,0,
+    18,128,255,0,65,137,0,0,6,128,255,0,85,131,0,1,47,239,128,255,0,121,138,0,
+    128,255,0,92,128,0,128,255,0,100,132,0,2,105,255,238,128,0,1,73,226,128,255,2,
+    252,192,22,128,0,0,144,132,255,0,121,128,0,0,186,132,255,0,35,128,0,0,145,132,
+    255,0,142,128,0,0,95,132,255,0,214,134,0,3,172,255,253,21,133,0,0,92,128,255,
+    133,0,1,114,253,130,255,1,240,138,128,255,128,0,128,255,1,140,241,131,255,0,124,130,
+    0,128,255,0,92,128,0,128,255,2,228,26,102,128,255,0,80,132,0,128,255,0,92,128,
+    0,128,255,0,92,131,0,0,92,128,255,129,0,1,1,156,131,255,3,236,133,255,248,130,
+    0,128,255,0,92,131,0,0,140,132,255,4,166,1,0,28,231,132,255,0,45,128,0,2,
+    242,255,103,132,0,0,101,128,255,128,0,128,255,0,92,128,0,7,64,255,247,9,0,184,
+    255,67,128,0,0,92,128,255,128,0,132,255,0,168,137,0,2,86,255,133,132,0,4,13,
+    229,255,230,14,144,0,128,255,0,92,139,0,0,84,128,255,6,131,0,23,242,255,231,13,
+    135,0,6,72,255,213,0,149,255,148,131,0,6,187,255,119,20,255,252,13,135,0,8,6,
+    241,255,89,0,4,238,255,88,133,0,2,225,255,114,135,0,2,121,255,225,134,0,128,255,
+    0,92,134,0,2,48,122,97,135,0,0,71,128,255,0,69,128,0,128,255,0,92,132,0,
+    0,83,128,255,0,200,132,0,128,255,0,92,140,0,2,135,255,215,138,0,2,223,255,134,
+    128,0,128,255,0,92,131,0,4,186,255,254,53,92,128,255,128,0,1,255,196,132,0,1,
+    255,196,128,0,128,255,0,92,128,0,140,255,129,0,128,255,0,92,128,0,0,54,140,255,
+    0,79,128,0,0,240,136,255,1,201,69,146,0,1,3,212,128,255,2,249,33,112,129,255,
+    0,130,133,0,0,51,128,255,0,57,131,0,1,35,26,129,0,0,68,128,255,0,60,135,
+    0,2,251,255,174,131,0,1,7,212,129,255,0,78,135,0,2,249,255,99,133,0,128,255,
+    0,92,137,0,128,255,0,92,131,0,0,156,128,255,0,126,132,0,2,150,192,82,130,0,
+    0,4,128,255,0,78,128,0,128,255,0,92,138,0,128,255,0,92,128,0,128,255,0,92,
+    135,0,128,255,0,92,128,0,0,64,128,255,0,57,137,0,128,255,0,92,128,0,128,255,
+    0,92,139,0,128,255,0,92,135,0,2,187,255,187,129,0,0,76,128,255,0,29,135,0,
+    0,127,128,255,0,43,128,0,128,255,0,92,134,0,2,98,255,248,130,0,3,8,244,255,
+    133,133,0,0,85,128,255,0,95,130,0,2,159,255,184,132,0,2,94,255,241,138,0,2,
+    125,255,224,129,0,2,248,255,101,132,0,0,8,128,255,0,82,131,0,2,151,255,175,135,
+    0,2,119,255,98,132,0,2,163,255,214,132,0,0,23,128,255,0,58,129,0,2,103,131,
+    69,132,0,0,30,128,255,0,61,128,0,139,255,134,0,2,5,228,209,129,0,2,251,255,
+    94,128,0,0,3,128,255,0,85,128,0,2,144,190,87,132,0,0,13,128,255,0,75,130,
+    0,1,27,229,128,255,0,139,139,0,128,255,0,92,128,0,128,255,0,122,132,0,2,134,
+    255,216,128,0,0,227,131,255,0,138,128,0,0,79,133,255,1,181,193,132,255,0,232,129,
+    0,0,77,133,255,2,195,169,250,132,255,0,145,134,0,2,126,255,194,134,0,0,92,128,
+    255,134,0,6,60,180,239,240,170,35,92,128,255,128,0,128,255,6,92,38,173,239,241,186,
+    67,131,0,128,255,0,92,128,0,128,255,6,99,0,4,220,255,214,3,131,0,128,255,0,
+    92,128,0,128,255,0,92,131,0,0,92,128,255,131,0,8,92,200,245,236,166,31,101,255,
+    233,130,0,128,255,0,92,131,0,0,72,133,255,2,208,167,235,132,255,1,229,3,128,0,
+    2,220,255,130,132,0,0,123,128,255,128,0,128,255,0,92,128,0,7,5,242,255,70,9,
+    247,243,6,128,0,0,92,128,255,128,0,132,255,0,168,137,0,2,25,255,194,132,0,0,
+    141,128,255,0,87,145,0,128,255,0,92,138,0,4,11,227,255,226,10,128,0,0,119,128,
+    255,0,138,135,0,6,18,254,251,6,201,255,90,131,0,5,129,255,162,71,255,208,137,0,
+    7,167,255,164,0,64,255,249,14,133,0,2,190,255,143,135,0,2,157,255,195,134,0,128,
+    255,0,92,134,0,2,111,255,207,135,0,0,11,128,255,0,81,128,0,128,255,0,92,133,
+    0,0,198,128,255,0,86,131,0,128,255,0,92,140,0,0,56,128,255,0,51,136,0,0,
+    61,128,255,0,60,128,0,128,255,0,92,131,0,4,46,253,255,195,92,128,255,128,0,1,
+    255,196,132,0,1,255,196,128,0,128,255,0,92,128,0,128,80,2,238,254,84,129,80,2,
+    246,252,81,129,80,129,0,128,255,0,92,129,0,0,208,138,255,1,229,6,128,0,135,255,
+    1,210,79,148,0,0,107,129,255,3,143,0,7,224,128,255,1,246,30,133,0,2,207,255,
+    185,131,0,7,144,249,157,15,1,188,255,212,136,0,2,233,255,211,132,0,4,50,252,255,
+    239,3,135,0,128,144,0,52,133,0,128,255,0,92,137,0,128,255,0,92,131,0,4,23,
+    242,255,246,33,131,0,2,242,255,110,130,0,0,19,128,255,0,60,128,0,128,255,0,92,
+    138,0,128,255,0,92,128,0,128,255,0,92,135,0,128,255,0,92,128,0,3,1,217,255,
+    184,137,0,128,255,0,92,128,0,128,255,0,92,139,0,128,255,0,92,134,0,3,26,248,
+    255,105,129,0,3,5,236,255,138,134,0,3,5,222,255,220,129,0,128,255,0,92,134,0,
+    2,119,255,225,130,0,0,78,128,255,0,58,133,0,3,12,248,255,181,130,0,3,105,255,
+    237,3,131,0,2,152,255,182,129,0,2,101,185,136,132,0,2,195,255,160,129,0,2,226,
+    255,142,132,0,0,44,128,255,0,56,131,0,2,195,255,125,135,0,2,179,255,37,132,0,
+    3,109,255,253,21,131,0,3,73,255,254,23,129,0,2,228,255,160,132,0,3,88,255,253,
+    14,128,0,134,80,128,255,0,143,128,80,134,0,2,93,255,96,129,0,2,247,255,97,128,
+    0,0,6,128,255,0,84,128,0,2,218,255,160,132,0,0,61,128,255,0,43,129,0,1,
+    4,199,128,255,0,155,140,0,128,255,0,92,128,0,128,255,0,166,132,0,2,189,255,169,
+    128,0,132,255,0,168,128,0,1,5,235,140,255,0,146,129,0,1,4,230,141,255,0,54,
+    134,0,2,200,255,111,134,0,0,92,128,255,140,0,0,92,128,255,128,0,128,255,0,92,
+    137,0,128,255,0,92,128,0,128,255,0,92,128,0,0,92,128,255,0,98,131,0,128,255,
+    0,92,128,0,128,255,0,92,131,0,0,92,128,255,137,0,2,121,255,209,130,0,128,255,
+    0,92,131,0,1,2,222,141,255,0,131,129,0,2,174,255,185,132,0,0,173,128,255,128,
+    0,128,255,0,92,129,0,5,176,255,138,73,255,176,129,0,0,92,128,255,128,0,132,255,
+    0,168,138,0,2,221,247,7,130,0,3,43,251,255,187,146,0,128,255,0,92,138,0,0,
+    138,128,255,0,87,129,0,4,6,220,255,249,38,135,0,5,217,255,49,247,255,31,131,0,
+    5,71,255,202,119,255,151,137,0,6,86,255,232,0,135,255,181,134,0,2,146,255,198,135,
+    0,2,217,255,148,134,0,128,255,0,92,134,0,3,76,255,252,29,134,0,0,20,128,255,
+    0,51,128,0,128,255,0,92,133,0,0,64,128,255,1,212,1,130,0,128,255,0,92,141,
+    0,2,211,255,180,136,0,2,188,255,218,129,0,128,255,0,92,132,0,0,155,128,255,0,
+    175,128,255,128,0,1,255,196,132,0,1,255,196,134,0,2,11,254,225,129,0,2,23,255,
+    217,134,0,1,225,84,129,0,1,59,254,137,255,0,96,129,0,133,255,2,218,90,1,148,
+    0,1,17,236,128,255,1,240,19,128,0,0,94,129,255,0,168,133,0,0,72,128,255,0,
+    113,130,0,0,198,128,255,1,219,142,128,255,0,97,136,0,0,178,128,255,0,54,131,0,
+    0,74,129,255,0,113,145,0,128,255,0,92,137,0,128,255,0,92,132,0,0,118,128,255,
+    0,178,131,0,2,212,255,153,130,0,0,57,128,255,0,21,128,0,128,255,0,92,138,0,
+    128,255,0,92,128,0,128,255,0,92,135,0,128,255,0,92,129,0,0,84,128,255,0,116,
+    135,0,0,123,128,255,0,92,128,0,128,255,0,92,139,0,128,255,0,92,134,0,3,154,
+    255,240,15,130,0,3,128,255,248,48,133,0,0,121,128,255,0,114,129,0,128,255,0,92,
+    134,0,2,191,255,183,130,0,3,159,255,236,2,134,0,3,181,255,250,16,129,0,0,36,
+    128,255,0,78,130,0,3,9,237,255,112,129,0,3,124,255,227,2,130,0,0,50,128,255,
+    0,75,129,0,3,169,255,228,8,131,0,3,136,255,246,7,131,0,2,238,255,89,134,0,
+    2,1,238,232,133,0,0,32,128,255,0,126,131,0,2,168,255,200,130,0,3,172,255,237,
+    11,131,0,2,195,255,190,137,0,128,255,0,92,136,0,2,207,231,6,129,0,2,226,255,
+    121,128,0,0,31,128,255,0,62,128,0,3,158,255,240,14,131,0,3,165,255,230,1,129,
+    0,0,123,128,255,1,178,3,140,0,128,255,0,92,128,0,128,255,1,241,17,130,0,3,
+    34,251,255,99,128,0,132,255,0,168,129,0,0,122,139,255,1,250,36,130,0,0,111,140,
+    255,0,191,134,0,3,30,254,253,27,134,0,0,90,128,255,0,2,139,0,0,92,128,255,
+    128,0,128,255,0,92,137,0,128,255,0,92,128,0,128,255,0,92,128,0,4,2,212,255,
+    226,8,130,0,128,255,0,92,128,0,128,255,0,92,131,0,0,92,128,255,128,0,2,111,
+    173,104,132,0,2,186,255,166,130,0,128,255,0,92,132,0,0,97,140,255,1,239,25,129,
+    0,3,104,255,250,31,130,0,1,20,245,128,255,128,0,128,255,0,92,129,0,5,104,255,
+    207,143,255,102,129,0,0,92,128,255,128,0,132,255,0,168,138,0,2,161,255,59,130,0,
+    3,192,255,249,38,146,0,128,255,0,92,137,0,3,43,250,255,192,131,0,0,80,128,255,
+    0,181,135,0,4,162,255,135,255,229,132,0,5,15,253,241,164,255,93,137,0,6,12,248,
+    255,43,203,255,99,134,0,0,74,128,255,0,58,133,0,0,61,128,255,0,79,134,0,128,
+    255,0,92,134,0,3,14,248,255,160,134,0,3,104,255,236,7,128,0,128,255,0,92,134,
+    0,0,189,128,255,0,84,130,0,128,255,0,92,141,0,0,75,128,255,0,110,134,0,0,
+    116,128,255,0,87,129,0,128,255,0,92,132,0,1,24,243,130,255,128,0,1,255,196,132,
+    0,1,255,196,134,0,2,53,255,182,129,0,2,65,255,174,133,0,2,6,247,62,130,0,
+    0,117,136,255,0,158,130,0,0,246,130,255,2,225,100,4,150,0,0,145,129,255,0,120,
+    129,0,1,2,209,129,255,0,60,133,0,0,162,128,255,1,129,5,128,0,2,7,98,235,
+    129,255,1,185,1,136,0,0,81,128,255,1,200,8,129,0,6,61,238,255,254,255,249,61,
+    144,0,128,255,0,92,137,0,128,255,0,92,132,0,1,6,220,128,255,0,76,130,0,3,
+    155,255,235,20,129,0,2,166,255,213,129,0,128,255,0,92,138,0,128,255,0,92,128,0,
+    128,255,0,92,135,0,128,255,0,92,130,0,0,169,128,255,1,140,11,131,0,1,31,175,
+    129,255,0,81,128,0,128,255,0,92,139,0,128,255,0,92,132,0,1,1,125,128,255,0,
+    122,131,0,4,13,226,255,230,56,131,0,4,104,253,255,221,9,129,0,128,255,0,92,133,
+    0,0,94,128,255,0,91,129,0,3,3,235,255,163,135,0,0,101,128,255,0,96,130,0,
+    3,189,255,221,20,129,0,3,151,255,247,18,129,0,0,50,128,255,0,108,129,0,4,12,
+    205,255,214,2,129,0,0,73,128,255,1,158,1,129,0,3,63,249,255,152,131,0,0,25,
+    128,255,0,54,134,0,2,44,255,172,134,0,3,181,255,247,59,129,0,3,78,254,255,104,
+    130,0,0,80,128,255,0,153,130,0,0,127,128,255,0,78,137,0,128,255,0,92,135,0,
+    2,66,255,123,130,0,2,176,255,189,128,0,3,99,255,251,15,128,0,0,61,128,255,0,
+    155,130,0,0,98,128,255,0,121,129,0,4,21,245,255,230,14,141,0,128,255,0,92,128,
+    0,129,255,1,163,1,128,0,4,7,191,255,238,13,128,0,132,255,0,168,129,0,1,5,
+    209,138,255,0,133,131,0,1,2,196,138,255,1,247,40,133,0,3,2,164,255,188,135,0,
+    0,82,128,255,0,17,139,0,0,92,128,255,128,0,128,255,0,92,137,0,128,255,0,92,
+    128,0,128,255,0,92,129,0,0,82,128,255,0,116,130,0,128,255,0,92,128,0,128,255,
+    0,92,131,0,0,92,128,255,128,0,3,105,255,245,32,130,0,3,77,254,255,90,130,0,
+    128,255,0,92,133,0,0,178,139,255,0,93,130,0,4,16,241,255,188,6,128,0,1,2,
+    172,129,255,128,0,128,255,0,92,129,0,5,32,255,254,226,255,29,129,0,0,92,128,255,
+    128,0,132,255,0,168,138,0,2,100,255,119,129,0,0,91,128,255,0,125,147,0,128,255,
+    0,92,137,0,3,192,255,252,45,132,0,0,188,128,255,0,75,134,0,4,106,255,227,255,
+    171,133,0,4,211,255,230,255,36,138,0,5,180,255,127,253,252,20,134,0,4,5,228,255,
+    222,37,131,0,4,35,220,255,224,5,134,0,128,255,0,92,135,0,0,146,128,255,1,148,
+    9,131,0,3,61,241,255,135,129,0,128,255,0,92,134,0,0,59,128,255,1,208,1,129,
+    0,128,255,0,92,142,0,4,168,255,254,128,5,130,0,1,5,130,128,255,0,180,130,0,
+    128,255,0,92,133,0,0,125,130,255,128,0,1,255,196,132,0,1,255,196,134,0,2,96,
+    255,140,129,0,2,108,255,132,133,0,2,92,246,9,131,0,1,104,243,132,255,2,253,136,
+    2,130,0,0,158,128,255,2,232,110,7,151,0,1,40,251,128,255,1,228,9,130,0,0,
+    74,129,255,1,204,1,132,0,1,6,189,128,255,5,223,135,94,93,135,226,129,255,1,136,
+    1,130,0,129,255,0,140,128,0,1,1,189,128,255,11,211,106,94,164,252,255,195,74,253,
+    255,243,59,133,0,128,255,0,92,133,0,128,255,0,207,134,180,0,90,128,0,128,255,0,
+    92,133,0,0,80,128,255,1,221,8,129,0,0,59,128,255,3,221,113,94,180,128,255,0,
+    111,129,0,128,255,0,92,138,0,128,255,0,92,128,0,128,255,0,92,135,0,128,255,0,
+    92,130,0,1,10,189,128,255,6,233,151,102,87,114,180,251,128,255,1,248,105,129,0,128,
+    255,0,143,137,80,128,0,128,255,0,143,129,80,3,81,94,132,211,128,255,1,196,5,132,
+    0,8,60,248,255,252,175,106,86,114,200,128,255,1,244,55,130,0,128,255,0,143,130,80,
+    2,85,105,174,128,255,1,202,5,129,0,0,63,128,255,0,88,135,0,3,22,253,255,181,
+    130,0,6,54,250,255,224,113,92,178,128,255,0,129,131,0,9,187,255,253,152,92,119,226,
+    255,253,67,131,0,0,177,128,255,7,200,103,89,151,250,255,231,23,131,0,0,50,128,255,
+    0,28,134,0,2,105,255,111,134,0,10,42,244,255,248,139,88,139,250,255,211,3,130,0,
+    1,1,192,128,255,3,188,96,97,184,128,255,0,177,138,0,128,255,0,92,135,0,2,181,
+    246,19,130,0,0,87,128,255,4,154,106,239,255,173,130,0,0,170,128,255,3,185,96,93,
+    171,128,255,1,206,7,129,0,0,122,128,255,0,155,134,80,0,28,133,0,128,255,0,92,
+    128,0,128,255,5,237,255,194,101,100,205,128,255,0,99,129,0,132,255,0,168,130,0,1,
+    28,221,136,255,1,176,2,132,0,1,20,208,136,255,1,251,79,132,0,2,138,204,227,128,
+    255,0,81,135,0,0,60,128,255,2,155,91,6,137,0,0,92,128,255,128,0,128,255,0,
+    92,137,0,128,255,0,92,128,0,128,255,0,92,130,0,3,204,255,237,15,129,0,128,255,
+    0,92,128,0,128,255,0,92,131,0,0,92,128,255,128,0,11,23,245,255,231,128,89,101,
+    162,250,255,207,2,130,0,128,255,0,92,133,0,1,12,191,137,255,0,121,132,0,0,107,
+    128,255,5,207,102,97,196,255,237,128,255,128,0,128,255,0,92,130,0,0,216,128,255,0,
+    211,130,0,0,92,128,255,128,0,132,255,0,168,138,0,2,40,255,180,129,0,3,230,255,
+    240,85,137,80,136,0,128,255,0,92,136,0,0,92,128,255,0,147,133,0,4,44,252,255,
+    218,6,133,0,0,51,129,255,0,113,133,0,0,153,128,255,0,234,139,0,4,99,255,241,
+    255,192,136,0,0,81,128,255,9,247,160,105,85,104,162,248,255,252,71,135,0,128,255,0,
+    92,135,0,1,13,212,128,255,9,232,145,100,84,109,176,253,255,209,9,129,0,128,255,0,
+    92,135,0,0,185,128,255,0,80,129,0,128,255,0,92,142,0,1,8,196,128,255,1,222,
+    134,128,93,1,135,223,128,255,1,202,12,130,0,128,255,0,92,133,0,1,10,228,129,255,
+    128,0,1,255,196,132,0,1,255,196,128,0,128,255,0,92,129,0,2,138,255,97,129,0,
+    2,150,255,89,132,0,2,8,241,129,133,0,7,28,129,207,239,247,219,151,44,132,0,3,
+    5,85,88,10,153,0,0,182,129,255,0,98,132,0,0,191,129,255,0,97,133,0,2,9,
+    146,254,133,255,0,227,128,255,1,185,35,129,0,129,255,0,140,129,0,1,21,211,132,255,
+    3,185,17,0,116,128,255,0,101,133,0,128,255,0,92,133,0,137,255,0,128,128,0,128,
+    255,0,92,134,0,0,189,128,255,0,128,130,0,0,149,132,255,1,185,4,129,0,128,255,
+    0,92,138,0,128,255,0,92,128,0,128,255,0,92,135,0,128,255,0,92,131,0,2,5,
+    137,250,134,255,1,179,43,130,0,140,255,128,0,137,255,1,185,17,134,0,1,64,231,133,
+    255,1,226,58,131,0,137,255,1,212,32,130,0,3,144,255,251,16,136,0,3,197,255,250,
+    17,130,0,1,94,250,131,255,1,179,5,131,0,1,26,220,131,255,1,252,102,132,0,1,
+    13,187,132,255,1,231,48,132,0,0,67,128,255,0,16,134,0,2,165,255,50,135,0,1,
+    71,242,131,255,1,224,35,132,0,1,21,204,132,255,1,196,12,138,0,128,255,0,92,134,
+    0,2,41,254,151,131,0,1,1,185,130,255,1,234,32,130,0,1,13,189,132,255,1,205,
+    23,130,0,0,202,137,255,0,92,133,0,128,255,0,92,128,0,128,255,1,111,222,131,255,
+    0,135,130,0,0,227,131,255,0,138,131,0,1,26,182,133,255,2,251,137,3,134,0,1,
+    17,163,134,255,1,223,60,133,0,0,124,129,255,1,189,1,135,0,1,10,235,129,255,0,
+    37,137,0,0,92,128,255,128,0,128,255,0,92,137,0,128,255,0,92,128,0,128,255,0,
+    92,130,0,0,72,128,255,0,134,129,0,128,255,0,92,128,0,128,255,0,92,131,0,0,
+    92,128,255,129,0,1,89,250,132,255,1,216,31,131,0,128,255,0,92,134,0,2,8,143,
+    252,133,255,1,232,90,134,0,0,141,131,255,1,222,112,128,255,128,0,128,255,0,92,130,
+    0,0,144,128,255,0,138,130,0,0,92,128,255,128,0,0,227,131,255,0,138,139,0,2,
+    234,238,1,128,0,141,255,136,0,128,255,0,92,135,0,4,15,231,255,235,17,134,0,0,
+    149,128,255,0,119,133,0,1,4,246,128,255,0,55,133,0,0,95,128,255,0,177,139,0,
+    1,21,252,128,255,0,110,137,0,1,96,246,133,255,1,242,84,136,0,128,255,0,92,136,
+    0,1,22,188,134,255,1,191,26,130,0,128,255,0,92,135,0,0,55,128,255,0,205,129,
+    0,128,255,0,92,143,0,1,12,155,134,255,1,160,15,131,0,128,255,0,92,134,0,0,
+    95,129,255,128,0,1,255,241,128,196,128,0,128,196,1,255,196,128,0,128,255,0,92,129,
+    0,2,181,255,55,129,0,2,193,255,47,133,0,1,65,1,177,0,0,73,129,255,1,212,
+    3,132,0,0,54,129,255,1,231,13,134,0,13,47,144,211,240,249,226,172,86,3,88,246,
+    255,249,49,128,0,129,255,0,140,130,0,7,8,121,209,245,238,193,93,1,129,0,1,132,
+    168,134,0,128,255,0,92,133,0,137,255,0,128,128,0,128,255,0,92,134,0,4,45,252,
+    255,247,34,129,0,7,1,103,203,245,246,208,113,5,130,0,128,255,0,92,138,0,128,255,
+    0,92,128,0,128,255,0,92,135,0,128,255,0,92,133,0,8,31,129,198,238,251,232,202,
+    133,49,132,0,140,255,128,0,133,255,3,246,218,165,74,137,0,8,13,114,193,238,252,237,
+    192,110,10,132,0,133,255,4,252,235,194,117,9,131,0,2,223,255,193,137,0,0,116,128,
+    255,0,97,131,0,6,53,176,236,244,206,107,3,133,0,6,17,139,222,250,234,169,49,134,
+    0,7,2,95,193,240,247,215,134,17,133,0,0,84,128,255,0,5,134,0,2,226,242,3,
+    136,0,6,33,153,226,248,219,137,20,134,0,7,7,113,205,245,242,202,108,3,139,0,128,
+    255,0,92,134,0,2,155,254,38,132,0,5,10,143,235,244,179,36,132,0,7,3,103,200,
+    244,243,202,109,5,131,0,0,246,137,255,0,92,133,0,128,255,0,92,128,0,128,255,6,
+    92,23,159,235,243,194,77,131,0,1,74,227,128,255,2,253,193,22,133,0,7,72,162,219,
+    245,242,210,141,38,138,0,8,54,145,211,238,249,229,179,98,6,134,0,4,74,232,242,165,
+    15,137,0,4,59,204,247,228,54,137,0,0,92,128,255,128,0,128,255,0,92,137,0,128,
+    255,0,92,128,0,128,255,0,92,131,0,3,194,255,245,25,128,0,128,255,0,92,128,0,
+    128,255,0,92,131,0,0,92,128,255,130,0,7,48,161,224,249,238,203,114,13,132,0,128,
+    255,0,92,136,0,8,41,134,205,235,249,227,186,107,15,136,0,6,79,194,243,235,158,23,
+    92,128,255,128,0,128,255,0,92,130,0,0,72,128,255,0,64,130,0,0,92,128,255,128,
+    0,1,74,227,128,255,2,253,193,22,139,0,2,174,255,45,128,0,141,255,136,0,128,255,
+    0,92,135,0,0,146,128,255,0,103,135,0,4,19,238,255,243,25,133,0,3,196,255,247,
+    5,133,0,0,37,128,255,0,120,140,0,0,193,128,255,0,29,138,0,8,26,132,201,236,
+    251,241,202,130,24,137,0,128,255,0,92,138,0,8,71,163,221,245,246,221,173,82,2,131,
+    0,128,255,0,92,136,0,0,181,128,255,0,76,128,0,128,255,0,92,145,0,2,53,151,
+    213,128,242,2,214,152,56,133,0,128,255,0,92,134,0,1,1,205,128,255,128,0,130,255,
+    128,0,129,255,0,196,128,0,128,255,0,92,129,0,2,223,255,13,129,0,2,235,253,8,
+    185,0,1,4,215,129,255,0,76,134,0,0,172,129,255,0,135,144,0,3,45,192,239,6,
+    128,0,129,255,0,140,142,0,0,4,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    183,0,0,111,129,255,0,193,135,0,1,38,251,128,255,1,248,33,145,0,0,42,129,0,
+    129,255,0,140,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,198,0,0,5,130,0,1,73,226,128,255,1,245,146,133,0,8,46,141,201,237,250,
+    233,207,155,55,136,0,7,13,108,194,232,248,222,165,68,137,0,8,44,150,213,242,246,222,
+    170,81,1,131,0,1,73,226,130,255,4,224,247,224,166,66,129,0,1,73,226,128,255,1,
+    245,146,129,0,1,146,245,128,255,1,226,72,128,0,1,73,226,128,255,15,245,211,176,236,
+    250,223,150,33,1,80,189,241,247,215,137,22,131,0,6,24,191,252,255,253,191,25,129,0,
+    6,6,168,247,255,254,207,41,129,0,1,66,222,128,255,1,240,140,128,0,14,24,187,253,
+    255,249,173,9,0,5,165,247,255,253,195,28,129,0,1,73,226,137,255,1,226,72,128,0,
+    1,73,226,128,255,7,245,215,174,221,247,228,168,63,131,0,2,4,154,245,128,255,2,244,
+    151,2,128,0,1,105,233,128,255,2,249,173,11,133,0,8,9,102,187,229,249,228,186,101,
+    8,132,0,3,41,231,255,79,134,0,3,108,255,215,13,128,0,1,19,225,128,255,1,248,
+    94,128,0,4,19,225,255,197,1,128,0,4,119,251,228,128,1,131,0,4,19,225,255,197,
+    1,128,0,1,134,254,128,255,1,197,1,130,0,4,22,175,245,224,18,133,0,7,47,150,
+    217,247,245,204,121,13,134,0,2,62,178,229,134,255,2,230,177,61,133,0,7,16,128,208,
+    242,245,207,123,13,134,0,7,7,111,199,239,244,210,130,16,134,0,7,4,101,189,234,248,
+    224,159,54,132,0,128,255,0,168,128,0,128,255,6,104,16,167,243,232,175,38,131,0,4,
+    20,239,255,208,1,136,0,1,73,226,128,255,1,245,146,134,0,5,3,121,224,243,190,55,
+    131,0,6,6,131,223,249,220,125,5,131,0,0,231,132,255,0,28,130,0,7,3,109,204,
+    245,243,208,123,10,136,0,2,195,255,140,134,0,3,44,253,249,30,132,0,3,19,242,250,
+    35,130,0,5,42,181,243,235,147,10,131,0,4,84,210,247,212,87,130,0,132,255,3,247,
+    227,162,29,134,0,6,40,158,227,250,230,162,38,132,0,2,64,255,20,128,0,131,255,4,
+    252,239,201,103,2,129,0,135,255,128,0,136,255,129,0,131,255,3,247,229,176,61,131,0,
+    2,64,255,20,128,0,0,64,128,255,0,164,130,0,5,88,206,248,235,160,22,133,0,7,
+    22,137,214,247,235,192,86,2,133,0,5,85,207,249,227,135,7,130,0,0,208,128,255,0,
+    20,128,0,1,255,196,134,0,1,50,198,136,0,2,9,230,196,134,0,1,162,196,130,0,
+    2,9,220,16,128,0,2,190,222,53,132,0,2,104,244,64,128,0,128,255,6,92,12,137,
+    225,245,204,82,128,0,5,24,154,230,247,202,77,130,0,3,134,255,231,1,132,0,2,182,
+    255,168,131,0,6,5,100,199,239,243,188,71,135,0,6,80,186,237,248,215,130,12,130,0,
+    128,255,7,92,8,129,219,247,221,131,11,132,0,6,53,165,229,249,228,163,48,131,0,2,
+    217,255,135,131,0,2,220,255,185,131,0,2,171,255,147,129,0,137,255,131,0,4,92,213,
+    249,211,79,132,0,3,43,252,255,179,131,0,0,122,128,255,0,68,128,0,128,255,5,92,
+    66,214,247,217,95,128,0,128,255,0,92,131,0,0,92,128,255,128,0,0,1,152,0,0,
+    1,128,0,128,255,0,92,131,0,2,85,255,37,134,0,6,59,172,232,248,218,139,18,133,
+    0,8,8,111,193,236,251,233,201,110,9,143,0,4,75,201,252,184,11,128,0,0,227,131,
+    255,0,62,130,0,2,7,153,254,134,255,1,158,7,133,0,1,71,227,133,255,1,177,20,
+    133,0,2,2,136,254,133,255,1,195,31,130,0,0,227,135,255,1,251,77,128,0,0,227,
+    131,255,2,62,0,63,131,255,0,226,128,0,0,227,137,255,0,246,132,255,1,239,61,130,
+    0,0,139,131,255,0,168,129,0,0,119,131,255,0,175,129,0,0,216,131,255,2,74,0,
+    158,131,255,2,124,0,111,131,255,0,147,129,0,0,227,139,255,0,226,128,0,0,227,137,
+    255,1,156,3,129,0,0,80,132,255,3,110,0,54,254,131,255,0,108,132,0,1,67,223,
+    133,255,1,221,63,131,0,0,59,128,255,1,228,5,132,0,0,23,129,255,0,19,128,0,
+    0,64,130,255,0,164,128,0,0,64,129,255,0,20,128,0,0,192,129,255,0,111,131,0,
+    4,64,255,145,255,20,128,0,0,208,130,255,0,20,130,0,0,170,129,255,0,64,131,0,
+    2,2,136,253,132,255,1,225,42,132,0,1,123,253,138,255,1,253,122,131,0,1,56,232,
+    132,255,1,219,34,132,0,1,33,214,132,255,1,231,53,132,0,1,29,208,132,255,2,254,
+    139,1,130,0,128,255,0,168,128,0,128,255,1,104,184,130,255,0,34,130,0,0,89,130,
+    255,1,208,35,135,0,0,227,131,255,0,62,133,0,6,159,255,250,205,244,249,64,129,0,
+    8,2,184,255,245,209,246,255,177,1,129,0,2,12,255,227,131,196,0,21,129,0,9,3,
+    179,255,249,215,212,248,255,217,22,134,0,3,19,252,255,222,135,0,2,164,255,152,132,0,
+    2,137,255,147,130,0,7,43,241,255,212,239,255,186,1,129,0,6,85,254,247,206,249,255,
+    88,129,0,1,255,241,130,196,4,209,247,255,227,15,132,0,8,78,248,255,232,206,242,255,
+    245,70,131,0,2,23,92,7,128,0,1,255,241,129,196,4,197,212,251,255,144,129,0,132,
+    196,2,213,255,228,128,0,1,255,241,134,196,129,0,1,255,241,129,196,4,207,234,255,254,
+    109,130,0,2,64,255,20,128,0,3,64,255,104,58,129,0,7,108,255,252,212,240,255,212,
+    8,131,0,9,63,237,244,152,107,117,188,255,171,7,131,0,7,105,255,252,211,238,255,184,
+    2,129,0,3,74,133,255,20,128,0,1,255,196,135,0,1,197,71,135,0,2,119,255,196,
+    133,0,2,62,252,196,130,0,1,113,152,129,0,2,72,193,189,131,0,3,8,244,159,23,
+    128,0,128,255,1,103,205,130,255,3,254,86,33,225,130,255,1,254,83,129,0,0,56,128,
+    255,0,50,131,0,3,9,246,255,91,130,0,1,12,192,132,255,0,148,132,0,1,2,157,
+    132,255,1,215,23,129,0,128,255,1,100,199,131,255,1,199,5,130,0,1,120,253,131,255,
+    1,252,111,130,0,2,154,255,192,130,0,0,19,128,255,0,237,131,0,2,230,255,83,129,
+    0,137,255,130,0,0,95,130,255,1,254,67,132,0,0,152,128,255,0,58,129,0,3,24,
+    243,255,173,129,0,128,255,1,130,246,129,255,0,89,128,0,128,255,0,92,131,0,0,92,
+    128,255,128,0,1,208,78,149,0,2,23,144,120,128,0,128,255,0,92,129,0,1,32,206,
+    128,255,1,254,149,132,0,1,123,254,131,255,1,231,44,131,0,1,24,212,133,255,1,201,
+    15,140,0,1,68,200,130,255,0,99,128,0,132,255,0,92,129,0,1,2,183,137,255,0,
+    170,132,0,1,81,251,135,255,1,209,20,132,0,0,143,136,255,1,219,21,129,0,137,255,
+    0,159,128,0,132,255,2,92,0,92,132,255,128,0,146,255,1,241,28,129,0,0,144,131,
+    255,1,245,7,128,0,0,204,131,255,0,179,129,0,0,223,131,255,2,147,0,231,131,255,
+    2,195,0,187,131,255,0,155,129,0,141,255,128,0,139,255,0,144,129,0,0,79,132,255,
+    2,233,13,198,132,255,0,108,131,0,1,81,249,135,255,1,248,77,130,0,1,1,219,128,
+    255,0,102,132,0,0,142,128,255,0,173,129,0,0,64,130,255,0,141,128,0,0,64,129,
+    255,0,20,128,0,0,170,129,255,0,210,131,0,0,42,128,255,1,244,9,128,0,0,186,
+    130,255,0,20,129,0,1,10,250,129,255,0,42,131,0,0,150,135,255,1,238,42,130,0,
+    1,62,254,140,255,1,253,61,129,0,1,39,241,128,255,3,236,170,172,235,128,255,1,215,
+    6,130,0,1,19,224,128,255,3,222,163,167,227,128,255,1,240,37,130,0,1,20,224,128,
+    255,3,246,178,161,208,129,255,0,148,130,0,128,255,0,168,128,0,128,255,0,188,130,255,
+    0,216,130,0,1,80,254,131,255,1,224,12,134,0,132,255,0,92,132,0,8,70,255,230,
+    39,0,25,215,225,5,128,0,8,89,255,199,20,0,24,204,255,85,129,0,2,49,255,113,
+    135,0,3,111,255,171,21,128,0,3,17,168,255,177,134,0,4,93,255,193,255,48,134,0,
+    3,35,250,249,30,130,0,3,23,245,242,22,130,0,7,202,252,80,0,12,195,255,76,128,
+    0,8,6,231,236,38,0,41,237,229,6,128,0,1,255,196,131,0,3,17,179,255,130,131,
+    0,3,58,251,230,72,128,0,4,4,127,255,239,26,135,0,1,255,196,131,0,3,26,218,
+    255,48,134,0,2,162,255,75,128,0,1,255,196,137,0,1,255,196,131,0,3,66,232,253,
+    56,129,0,2,64,255,20,128,0,2,64,255,20,129,0,8,18,245,230,43,0,9,175,255,
+    114,130,0,3,39,242,193,23,130,0,2,80,246,149,130,0,8,17,243,241,50,0,11,184,
+    255,90,130,0,2,64,255,20,128,0,1,255,196,135,0,1,97,188,134,0,3,15,238,255,
+    196,132,0,3,38,232,255,196,129,0,2,2,228,52,130,0,2,77,251,2,130,0,2,47,
+    255,34,129,0,128,255,16,226,252,148,89,137,252,255,220,200,251,146,88,134,250,255,222,1,
+    128,0,3,1,231,255,123,131,0,3,75,255,251,17,130,0,0,178,134,255,0,121,131,0,
+    0,128,128,255,3,212,111,93,165,128,255,0,182,129,0,128,255,5,222,254,162,91,108,219,
+    128,255,0,105,129,0,0,98,128,255,4,228,122,87,127,232,128,255,0,91,129,0,3,92,
+    255,244,3,129,0,0,75,129,255,0,35,129,0,3,36,255,254,20,129,0,133,80,0,113,
+    128,255,0,156,129,0,1,6,235,131,255,0,201,132,0,3,22,241,255,193,129,0,3,158,
+    255,247,32,129,0,128,255,5,248,237,118,98,184,14,128,0,128,255,0,92,131,0,0,92,
+    128,255,128,0,128,255,1,202,71,145,0,4,19,137,245,255,128,128,0,128,255,0,92,129,
+    0,6,194,220,124,255,129,254,86,130,0,0,95,128,255,7,191,102,89,144,247,255,229,16,
+    130,0,7,183,255,250,160,102,91,128,229,128,255,0,131,138,0,1,61,193,132,255,0,128,
+    128,0,128,255,1,92,0,128,255,0,92,129,0,0,111,139,255,0,74,130,0,1,36,246,
+    137,255,0,175,131,0,0,56,138,255,0,150,129,0,137,255,0,114,128,0,132,255,2,92,
+    0,92,132,255,128,0,147,255,0,157,129,0,0,77,132,255,3,70,0,23,254,131,255,0,
+    112,129,0,0,168,131,255,1,203,31,132,255,2,245,7,243,131,255,0,98,129,0,141,255,
+    128,0,139,255,1,253,42,128,0,1,7,222,132,255,0,215,132,255,1,236,18,130,0,1,
+    37,245,137,255,1,243,34,130,0,0,113,128,255,0,205,131,0,1,7,240,128,255,0,69,
+    129,0,0,64,129,255,1,97,12,128,0,0,64,129,255,0,20,128,0,1,19,137,128,255,
+    1,252,2,131,0,2,61,92,45,129,0,1,23,131,129,255,0,20,129,0,0,49,129,255,
+    0,80,131,0,0,82,129,255,4,253,167,107,120,213,129,255,1,203,1,129,0,0,178,142,
+    255,0,177,129,0,0,194,128,255,1,160,10,128,0,1,18,191,128,255,0,106,130,0,4,
+    162,255,252,110,2,128,0,1,3,126,128,255,0,193,130,0,0,168,128,255,1,192,23,129,
+    0,1,75,242,128,255,0,75,129,0,128,255,0,168,128,0,129,255,4,247,92,12,50,88,
+    130,0,0,216,133,255,0,108,134,0,132,255,0,92,132,0,2,170,255,94,129,0,2,74,
+    255,91,128,0,2,167,255,50,129,0,2,56,255,165,129,0,2,87,255,77,135,0,2,208,
+    240,9,130,0,3,8,222,253,26,133,0,4,170,252,81,255,130,135,0,2,152,255,153,130,
+    0,2,144,255,125,130,0,2,60,255,153,129,0,2,59,255,155,128,0,2,81,255,114,129,
+    0,2,115,255,81,128,0,1,255,196,132,0,2,21,248,212,130,0,3,2,205,248,43,131,
+    0,2,157,255,144,135,0,1,255,196,132,0,2,86,255,139,133,0,2,52,254,179,129,0,
+    1,255,196,137,0,1,255,196,132,0,2,58,254,194,129,0,2,64,255,20,128,0,2,64,
+    255,20,129,0,2,95,255,105,129,0,2,20,248,203,130,0,2,192,209,12,132,0,2,96,
+    254,50,129,0,2,95,255,127,129,0,2,43,255,168,130,0,2,64,255,20,128,0,1,255,
+    196,135,0,2,14,250,27,133,0,3,133,248,255,196,131,0,1,55,232,128,255,0,196,129,
+    0,1,68,222,131,0,2,66,255,13,130,0,2,61,255,20,129,0,129,255,0,94,129,0,
+    0,119,129,255,0,86,129,0,0,116,128,255,0,40,129,0,2,156,255,197,131,0,2,150,
+    255,192,130,0,0,71,129,255,3,214,118,124,234,128,255,1,245,28,129,0,4,26,249,255,
+    184,6,129,0,0,128,128,255,0,46,128,0,129,255,0,104,129,0,3,21,237,255,187,128,
+    0,4,15,241,255,210,18,129,0,4,22,213,255,239,14,128,0,0,29,128,255,0,48,129,
+    0,0,130,129,255,0,88,129,0,2,97,255,211,136,0,4,4,199,255,227,14,129,0,0,
+    43,129,255,0,164,128,255,1,249,4,132,0,0,120,128,255,5,72,0,50,253,255,128,130,
+    0,129,255,0,58,132,0,128,255,0,92,131,0,0,92,128,255,128,0,0,235,129,255,1,
+    195,64,141,0,2,15,130,242,129,255,0,108,133,0,7,29,255,70,64,255,16,185,172,129,
+    0,3,13,238,255,135,130,0,3,49,242,255,142,129,0,0,49,128,255,0,81,130,0,3,
+    14,218,255,207,136,0,1,55,186,134,255,0,128,128,0,132,255,0,92,128,0,1,6,232,
+    139,255,0,164,130,0,0,185,139,255,0,74,130,0,0,165,138,255,1,249,15,128,0,137,
+    255,0,34,128,0,132,255,2,92,0,92,132,255,128,0,147,255,1,243,6,128,0,1,9,
+    245,131,255,2,143,0,97,132,255,0,34,129,0,0,105,131,255,1,250,95,133,255,0,97,
+    132,255,0,34,129,0,0,243,139,255,0,209,128,0,140,255,0,135,129,0,0,85,139,255,
+    0,104,131,0,0,188,139,255,0,185,130,0,0,24,129,255,0,40,130,0,0,84,128,255,
+    1,230,2,129,0,0,64,129,255,0,20,129,0,0,64,129,255,0,20,129,0,0,66,129,
+    255,0,13,130,0,4,19,225,255,197,1,129,0,0,64,129,255,0,20,129,0,0,61,129,
+    255,0,19,130,0,1,4,221,128,255,4,245,146,214,242,216,131,255,0,72,129,0,0,230,
+    142,255,0,230,128,0,0,52,128,255,1,192,2,130,0,3,26,244,255,199,129,0,3,30,
+    253,255,122,132,0,0,145,128,255,0,53,128,0,4,35,254,255,219,11,131,0,0,71,128,
+    255,0,201,134,0,129,255,0,116,133,0,0,33,134,255,0,178,134,0,132,255,0,92,132,
+    0,2,225,245,5,130,0,1,239,165,128,0,2,190,255,10,129,0,2,11,255,189,129,0,
+    2,124,255,42,135,0,1,247,207,132,0,2,148,255,67,132,0,5,5,241,208,10,249,212,
+    135,0,3,27,247,250,31,128,0,3,27,247,231,11,130,0,2,132,255,53,129,0,2,3,
+    123,75,128,0,2,147,255,33,129,0,2,35,255,149,128,0,1,255,196,133,0,1,212,244,
+    130,0,2,67,255,144,132,0,3,33,255,233,1,129,0,2,64,255,20,128,0,1,255,196,
+    132,0,2,20,255,175,133,0,2,180,254,44,129,0,1,255,196,137,0,1,255,196,133,0,
+    2,179,255,36,128,0,2,64,255,20,128,0,2,64,255,20,129,0,2,144,255,40,130,0,
+    1,211,245,129,0,12,61,255,64,0,35,191,241,120,117,194,0,210,146,129,0,2,69,172,
+    51,129,0,2,11,255,189,130,0,2,64,255,20,128,0,1,255,196,136,0,1,208,110,132,
+    0,4,23,244,143,255,196,130,0,5,86,251,255,123,255,196,129,0,1,154,162,131,0,2,
+    64,255,18,130,0,2,64,255,18,129,0,128,255,0,215,130,0,0,36,128,255,0,199,130,
+    0,0,31,128,255,0,76,129,0,3,78,255,252,17,130,0,2,224,255,114,130,0,0,174,
+    128,255,1,222,15,128,0,1,42,249,128,255,0,122,129,0,3,117,255,248,25,130,0,3,
+    5,238,255,121,128,0,128,255,0,215,131,0,2,151,255,229,128,0,3,106,255,254,45,131,
+    0,3,49,254,255,105,129,0,2,223,255,105,129,0,4,186,255,198,255,140,129,0,2,157,
+    255,146,136,0,0,134,128,255,0,71,130,0,0,52,129,255,0,216,128,255,1,247,2,132,
+    0,8,7,223,255,203,0,192,255,224,9,130,0,128,255,0,204,133,0,128,255,0,92,131,
+    0,0,92,128,255,128,0,2,12,121,236,129,255,1,188,57,137,0,2,12,123,238,129,255,
+    1,185,56,134,0,7,58,255,28,64,255,16,45,41,129,0,3,99,255,210,1,131,0,3,
+    126,255,238,6,128,0,2,127,255,209,132,0,2,125,255,237,134,0,1,48,179,136,255,0,
+    124,128,0,0,227,131,255,0,62,128,0,0,76,140,255,0,212,129,0,0,38,140,255,0,
+    178,130,0,0,227,139,255,0,71,128,0,136,255,0,202,129,0,132,255,2,92,0,92,132,
+    255,128,0,148,255,0,48,129,0,0,177,131,255,2,217,0,172,131,255,0,212,130,0,0,
+    42,132,255,0,202,133,255,0,211,131,255,0,226,130,0,0,138,139,255,0,87,128,0,140,
+    255,0,197,130,0,0,196,137,255,1,207,2,130,0,0,41,141,255,0,39,130,0,0,213,
+    128,255,0,119,130,0,0,164,128,255,0,167,130,0,0,64,129,255,0,20,129,0,0,64,
+    129,255,0,20,129,0,0,64,129,255,0,18,130,0,0,64,129,255,0,20,129,0,0,64,
+    129,255,0,20,129,0,0,64,129,255,0,17,130,0,0,85,129,255,0,200,135,255,0,161,
+    129,0,144,255,128,0,0,136,128,255,0,65,132,0,3,171,255,221,3,128,0,3,120,255,
+    240,8,132,0,3,25,254,255,140,128,0,0,126,128,255,0,87,133,0,0,180,128,255,0,
+    39,133,0,129,255,0,23,133,0,0,58,134,255,0,156,134,0,132,255,0,92,132,0,1,
+    249,214,131,0,128,209,128,0,2,167,255,51,129,0,2,49,255,166,129,0,2,161,254,8,
+    135,0,2,240,245,23,131,0,2,24,37,6,132,0,6,68,255,151,0,190,255,38,135,0,
+    2,141,255,152,128,0,2,149,255,104,131,0,2,183,248,4,134,0,1,194,244,131,0,1,
+    244,193,128,0,1,255,196,133,0,1,211,235,130,0,2,144,255,53,133,0,1,87,31,130,
+    0,2,64,255,20,128,0,1,255,196,132,0,2,9,255,189,132,0,2,39,254,178,130,0,
+    1,255,196,137,0,1,255,196,133,0,2,94,255,101,128,0,2,64,255,20,128,0,2,64,
+    255,20,129,0,2,44,100,8,130,0,1,219,242,129,0,12,145,199,0,13,221,196,109,224,
+    212,152,0,124,220,135,0,2,60,255,159,130,0,2,64,255,20,128,0,6,255,196,48,192,
+    247,226,114,131,0,1,153,168,132,0,4,147,244,22,255,196,130,0,5,128,241,91,0,255,
+    196,129,0,1,213,105,131,0,2,61,255,20,130,0,2,66,255,13,129,0,128,255,0,149,
+    130,0,0,6,128,255,0,131,130,0,0,7,128,255,0,89,129,0,3,9,246,255,88,129,
+    0,0,44,128,255,0,36,129,0,1,5,243,128,255,0,108,130,0,0,161,128,255,0,199,
+    129,0,2,180,255,179,132,0,2,95,97,36,128,0,128,255,0,144,131,0,2,109,255,247,
+    128,0,2,174,255,194,133,0,2,196,255,175,129,0,2,160,255,161,128,0,5,1,239,252,
+    103,255,193,129,0,2,218,255,82,135,0,3,65,253,255,155,131,0,1,8,243,131,255,0,
+    185,134,0,0,87,128,255,0,152,128,255,0,83,131,0,128,255,0,150,133,0,128,255,0,
+    92,131,0,0,92,128,255,130,0,2,12,121,236,129,255,1,181,51,133,0,2,9,116,235,
+    129,255,1,185,56,136,0,5,37,255,81,64,255,16,131,0,2,170,255,126,132,0,0,40,
+    128,255,0,53,128,0,2,8,48,49,132,0,2,97,255,251,132,0,2,43,172,254,137,255,
+    0,63,128,0,1,74,227,128,255,1,245,147,129,0,0,138,131,255,3,239,103,93,228,131,
+    255,0,238,129,0,0,128,132,255,1,214,177,132,255,1,251,10,129,0,0,249,132,255,1,
+    173,250,131,255,0,112,128,0,132,255,4,229,122,217,203,47,129,0,132,255,2,92,0,92,
+    132,255,128,0,132,255,1,244,125,132,255,1,240,119,132,255,0,76,129,0,0,99,132,255,
+    1,40,241,131,255,0,135,131,0,0,234,145,255,0,161,131,0,0,51,129,80,0,102,133,
+    255,0,172,129,0,132,255,2,245,108,194,131,255,0,231,130,0,1,53,254,136,255,0,60,
+    131,0,0,130,132,255,2,187,95,194,132,255,0,127,130,0,0,157,128,255,0,174,130,0,
+    0,219,128,255,0,110,130,0,0,64,129,255,0,20,129,0,0,64,129,255,0,20,129,0,
+    0,61,129,255,0,20,130,0,0,64,129,255,0,20,129,0,0,64,129,255,0,20,129,0,
+    0,65,129,255,0,12,130,0,0,173,128,255,1,246,251,135,255,0,223,129,0,144,255,128,
+    0,3,188,255,241,2,132,0,1,24,17,130,0,2,177,255,188,134,0,2,216,255,193,128,
+    0,3,182,255,248,8,133,0,0,91,128,255,0,96,133,0,128,255,0,228,134,0,0,41,
+    132,255,2,92,52,2,129,0,1,73,226,138,255,1,226,72,128,0,1,248,208,131,0,1,
+    213,235,128,0,8,85,255,195,18,0,18,195,255,79,129,0,6,199,226,56,160,188,147,35,
+    131,0,4,184,255,212,81,4,138,0,6,145,255,81,0,119,255,120,135,0,7,20,242,248,
+    25,28,248,217,4,131,0,6,216,219,0,85,174,179,88,130,0,1,225,219,131,0,1,221,
+    225,128,0,1,255,196,132,0,2,27,252,199,130,0,2,204,244,3,139,0,2,64,255,20,
+    128,0,1,255,196,132,0,2,39,255,166,132,0,2,149,255,64,130,0,1,255,196,137,0,
+    1,255,196,133,0,2,43,255,151,128,0,2,64,255,20,128,0,2,64,255,20,135,0,2,
+    29,253,208,129,0,13,223,123,0,124,227,12,0,69,255,110,0,84,249,1,133,0,3,33,
+    209,255,63,130,0,2,64,255,20,128,0,7,255,224,240,241,214,254,255,92,130,0,1,112,
+    221,131,0,5,32,249,133,0,255,196,130,0,1,62,27,128,0,1,255,196,128,0,2,12,
+    253,64,131,0,2,49,255,26,130,0,2,74,253,3,129,0,128,255,0,113,131,0,128,255,
+    0,100,131,0,128,255,0,92,130,0,2,178,255,161,129,0,2,119,255,215,130,0,0,31,
+    129,255,0,49,130,0,0,97,128,255,0,238,129,0,2,224,255,128,137,0,128,255,0,109,
+    131,0,2,96,255,254,128,0,2,221,255,135,133,0,2,137,255,223,129,0,2,97,255,217,
+    128,0,11,41,255,209,46,255,243,2,0,23,255,254,19,134,0,4,19,228,255,226,14,132,
+    0,0,167,130,255,1,249,55,135,0,0,198,129,255,0,189,132,0,128,255,0,114,133,0,
+    128,255,0,92,131,0,0,92,128,255,132,0,2,12,121,236,129,255,1,174,45,129,0,2,
+    7,109,231,129,255,1,185,56,139,0,4,208,237,145,255,16,131,0,2,217,255,147,132,80,
+    3,82,253,255,97,135,0,2,31,91,191,128,255,130,0,2,17,164,253,137,255,1,232,94,
+    138,0,0,130,132,255,1,204,245,132,255,0,251,129,0,0,181,141,255,0,60,129,0,0,
+    232,138,255,1,253,56,128,0,132,255,0,160,133,0,132,255,2,92,0,92,132,255,128,0,
+    132,255,1,159,7,132,255,1,142,6,132,255,0,89,129,0,1,22,253,131,255,0,174,132,
+    255,0,57,131,0,0,173,145,255,0,97,134,0,1,1,182,132,255,1,235,22,129,0,132,
+    255,2,155,0,110,131,255,0,247,131,0,0,164,135,255,0,165,132,0,0,183,131,255,4,
+    224,6,0,8,227,131,255,0,184,130,0,0,112,128,255,0,224,129,0,0,14,129,255,0,
+    64,130,0,0,64,129,255,0,20,129,0,0,64,129,255,0,20,129,0,0,49,129,255,0,
+    26,130,0,0,64,129,255,0,20,129,0,0,64,129,255,0,20,129,0,0,73,128,255,1,
+    253,2,130,0,0,236,131,255,1,246,152,129,255,0,197,128,255,1,249,1,128,0,144,255,
+    128,0,2,227,255,200,139,0,2,221,255,221,134,152,2,229,255,229,128,0,2,224,255,206,
+    134,0,0,39,128,255,0,137,133,0,128,255,0,193,134,0,1,1,229,131,255,1,151,13,
+    130,0,0,227,140,255,0,226,128,0,2,223,241,3,129,0,2,4,243,249,129,0,6,143,
+    254,244,208,244,251,127,130,0,2,236,247,254,129,255,1,243,62,130,0,1,60,253,128,255,
+    3,239,167,90,12,135,0,6,222,251,14,0,47,255,202,136,0,5,129,255,138,143,255,82,
+    132,0,2,239,202,138,130,255,0,136,129,0,1,243,205,131,0,1,206,241,128,0,1,255,
+    196,131,0,3,20,189,255,99,130,0,1,227,219,140,0,2,64,255,20,128,0,1,255,196,
+    132,0,2,133,255,107,131,0,2,4,236,220,131,0,1,255,196,137,0,1,255,196,133,0,
+    2,14,255,174,128,0,2,64,255,20,128,0,2,64,255,20,135,0,2,138,255,130,128,0,
+    5,14,255,64,0,220,125,128,0,6,12,255,68,0,70,255,10,131,0,4,36,211,250,252,
+    114,131,0,2,64,255,20,128,0,128,255,5,183,10,0,99,255,189,130,0,1,93,248,131,
+    0,5,161,240,17,0,255,196,134,0,1,255,196,128,0,2,38,255,46,131,0,2,16,254,
+    49,130,0,1,106,219,130,0,128,255,0,98,131,0,128,255,0,92,131,0,128,255,0,92,
+    130,0,3,100,255,233,1,128,0,2,194,255,137,130,0,0,53,129,255,0,26,130,0,0,
+    72,128,255,1,254,5,128,0,2,243,255,102,137,0,128,255,0,95,131,0,0,92,128,255,
+    128,0,2,241,255,104,133,0,2,105,255,242,129,0,15,35,255,254,18,0,96,255,155,4,
+    246,255,43,0,84,255,210,135,0,0,176,128,255,0,70,132,0,1,21,241,130,255,3,189,
+    118,77,6,133,0,4,55,254,255,251,43,132,0,128,255,0,98,133,0,128,255,0,92,131,
+    0,0,92,128,255,134,0,2,12,121,236,128,255,1,254,100,128,0,0,226,129,255,1,185,
+    56,141,0,1,36,208,128,255,1,220,89,130,0,0,240,137,255,0,115,130,0,4,12,92,
+    154,198,238,131,255,130,0,0,186,137,255,2,232,115,9,139,0,1,19,187,140,255,129,0,
+    0,222,141,255,0,99,129,0,0,186,137,255,1,227,65,129,0,132,255,0,116,133,0,132,
+    255,2,92,0,92,132,255,128,0,132,255,1,117,0,132,255,1,100,0,132,255,0,92,130,
+    0,0,199,137,255,1,233,2,131,0,0,111,145,255,0,33,134,0,0,114,133,255,0,86,
+    130,0,132,255,2,111,0,95,131,255,0,254,131,0,1,29,246,133,255,1,244,27,132,0,
+    0,224,131,255,0,143,129,0,0,148,131,255,0,225,130,0,0,93,128,255,0,249,129,0,
+    0,38,129,255,0,45,130,0,0,64,129,255,0,20,129,0,0,64,129,255,0,20,129,0,
+    0,18,129,255,0,56,130,0,0,64,129,255,0,20,129,0,0,64,129,255,0,20,129,0,
+    0,120,128,255,0,222,130,0,0,25,132,255,1,140,13,129,255,0,141,129,255,0,10,128,
+    0,144,255,128,0,2,243,255,179,139,0,0,240,138,255,0,244,128,0,2,241,255,180,134,
+    0,0,14,128,255,0,154,133,0,128,255,0,177,135,0,0,95,132,255,1,208,11,129,0,
+    142,255,128,0,2,166,255,91,129,0,2,89,255,254,129,0,1,95,239,129,255,1,242,88,
+    129,0,9,17,255,254,129,20,19,124,254,231,13,130,0,1,83,239,130,255,2,243,121,3,
+    132,0,2,44,255,192,129,0,2,229,255,29,135,0,4,14,236,242,243,199,133,0,8,248,
+    240,253,109,10,57,228,255,59,128,0,1,252,198,131,0,1,199,251,128,0,1,255,241,130,
+    196,4,210,250,255,171,4,130,0,1,247,202,140,0,2,64,255,20,128,0,1,255,196,129,
+    0,5,3,36,125,249,237,17,131,0,2,72,255,125,131,0,135,255,0,128,129,0,1,255,
+    196,133,0,2,3,255,189,128,0,2,64,255,20,128,0,2,64,255,20,134,0,3,49,249,
+    248,30,128,0,5,38,255,41,28,255,56,128,0,5,13,255,26,0,93,247,132,0,0,69,
+    129,255,1,197,40,130,0,2,64,255,20,128,0,2,255,254,29,128,0,2,2,235,233,130,
+    0,2,74,255,11,129,0,2,42,253,124,128,0,1,255,196,134,0,1,255,196,128,0,2,
+    55,255,29,132,0,2,171,153,6,128,0,2,33,212,124,130,0,128,255,0,92,131,0,128,
+    255,0,92,131,0,128,255,0,92,130,0,8,23,254,255,52,0,17,252,255,59,130,0,0,
+    57,129,255,0,25,130,0,0,72,129,255,0,7,128,0,2,252,255,94,137,0,128,255,0,
+    92,131,0,0,92,128,255,128,0,2,252,255,95,133,0,2,95,255,251,130,0,14,228,255,
+    74,0,152,255,101,0,197,255,95,0,144,255,145,134,0,0,107,128,255,0,154,133,0,0,
+    162,134,255,0,165,133,0,4,23,245,255,251,39,132,0,128,255,0,92,133,0,128,255,0,
+    92,131,0,0,92,128,255,136,0,1,12,155,128,255,0,128,128,0,128,255,1,234,60,144,
+    0,5,2,107,255,217,255,85,129,0,0,252,137,255,0,127,129,0,1,71,235,131,255,1,
+    209,179,128,255,130,0,0,251,135,255,2,233,116,10,142,0,1,44,245,139,255,129,0,0,
+    240,141,255,0,115,129,0,0,90,137,255,1,253,99,129,0,132,255,0,98,133,0,132,255,
+    2,92,0,92,132,255,128,0,132,255,1,98,0,132,255,1,92,0,132,255,0,92,130,0,
+    0,121,137,255,0,158,132,0,0,48,144,255,0,225,134,0,1,49,249,132,255,0,171,131,
+    0,132,255,2,95,0,92,132,255,132,0,0,131,133,255,0,121,133,0,0,241,131,255,0,
+    105,129,0,0,107,131,255,0,242,130,0,0,74,129,255,0,11,128,0,0,55,129,255,0,
+    28,130,0,0,64,129,255,0,20,129,0,0,64,129,255,0,20,130,0,0,200,128,255,1,
+    238,23,129,0,0,64,129,255,0,20,129,0,0,64,129,255,0,20,128,0,0,134,129,255,
+    0,151,130,0,0,51,132,255,1,60,12,129,255,0,126,128,255,0,249,129,0,144,255,128,
+    0,2,252,255,170,139,0,0,252,139,255,128,0,2,252,255,171,134,0,0,3,128,255,0,
+    163,133,0,128,255,0,168,136,0,0,92,132,255,0,133,129,0,142,255,128,0,8,61,255,
+    236,73,7,67,232,241,249,128,0,8,76,255,233,73,15,79,237,251,54,128,0,2,20,142,
+    114,130,0,2,158,255,103,131,0,3,15,108,196,253,129,255,0,161,132,0,2,121,255,120,
+    129,0,2,157,255,110,136,0,0,117,128,255,0,61,133,0,2,253,255,158,129,0,2,82,
+    255,164,128,0,1,252,199,131,0,1,200,250,128,0,133,255,2,197,94,1,131,0,1,244,
+    202,140,0,2,64,255,20,128,0,134,255,1,247,74,132,0,2,156,255,40,131,0,1,255,
+    241,133,196,0,98,129,0,1,255,196,133,0,2,12,255,184,128,0,2,64,255,20,128,0,
+    2,64,255,20,133,0,3,17,219,255,126,129,0,5,57,255,25,55,255,24,128,0,1,51,
+    240,128,0,1,152,198,132,0,6,17,15,27,129,253,228,14,129,0,2,64,255,20,128,0,
+    1,255,222,130,0,1,205,250,130,0,2,71,255,9,129,0,2,175,235,12,128,0,1,255,
+    196,134,0,1,255,196,128,0,2,54,255,26,132,0,2,16,234,64,128,0,2,192,199,3,
+    130,0,128,255,0,92,131,0,128,255,0,92,131,0,128,255,0,92,131,0,7,201,255,126,
+    0,88,255,235,2,130,0,0,38,129,255,0,48,130,0,0,96,128,255,0,244,129,0,2,
+    242,255,103,137,0,128,255,0,92,131,0,0,92,128,255,128,0,2,241,255,104,133,0,2,
+    105,255,238,130,0,14,166,255,130,0,207,255,47,0,142,255,148,0,205,255,81,133,0,4,
+    45,247,255,225,14,132,0,1,12,248,134,255,0,172,133,0,0,154,129,255,0,179,132,0,
+    128,255,0,92,133,0,128,255,0,92,131,0,0,98,128,255,135,0,2,34,158,251,128,255,
+    0,127,128,0,129,255,2,218,94,3,143,0,4,64,255,19,180,206,129,0,2,244,255,98,
+    138,0,9,45,247,255,248,178,124,76,22,0,95,128,255,130,0,135,255,1,148,10,143,0,
+    1,10,214,140,255,129,0,0,252,141,255,0,127,129,0,1,1,187,137,255,1,248,42,128,
+    0,132,255,0,92,133,0,132,255,2,92,0,92,132,255,128,0,132,255,1,92,0,132,255,
+    1,92,0,132,255,0,92,130,0,0,43,137,255,0,80,132,0,1,2,239,143,255,0,160,
+    133,0,1,11,216,132,255,1,234,21,131,0,132,255,2,92,0,92,132,255,132,0,0,89,
+    133,255,0,113,133,0,0,252,131,255,0,95,129,0,0,95,131,255,0,251,130,0,0,71,
+    129,255,0,9,128,0,0,54,129,255,0,27,130,0,0,64,129,255,0,20,129,0,0,64,
+    129,255,0,20,130,0,0,107,129,255,0,64,129,0,0,64,129,255,0,20,129,0,0,64,
+    129,255,0,20,128,0,0,192,129,255,0,44,130,0,0,61,132,255,1,23,59,128,255,1,
+    242,165,128,255,0,204,129,0,144,255,128,0,2,242,255,179,139,0,2,243,255,174,139,0,
+    2,241,255,180,134,0,0,14,128,255,0,149,133,0,128,255,0,168,135,0,2,4,51,91,
+    131,255,0,224,129,0,0,243,140,255,0,243,129,0,0,138,130,255,2,140,204,238,128,0,
+    2,183,255,73,129,0,2,81,255,167,135,0,2,51,255,165,134,0,2,23,105,209,128,255,
+    0,70,131,0,2,198,255,48,129,0,2,84,255,192,136,0,2,9,255,205,134,0,2,246,
+    255,58,129,0,2,2,241,223,128,0,1,243,205,131,0,1,206,241,128,0,1,255,196,128,
+    0,4,14,104,251,224,36,132,0,1,223,215,140,0,2,64,255,20,128,0,1,255,241,129,
+    196,3,193,175,125,29,133,0,1,223,219,132,0,1,255,196,137,0,1,255,196,133,0,2,
+    30,255,164,128,0,2,64,255,20,128,0,2,64,255,20,132,0,4,6,190,255,195,4,129,
+    0,5,43,255,41,44,255,32,128,0,5,132,199,0,12,238,116,136,0,2,144,255,112,129,
+    0,2,64,255,20,128,0,1,255,200,130,0,1,196,255,130,0,1,87,246,129,0,2,54,
+    255,114,129,0,1,255,196,134,0,1,255,196,128,0,2,35,255,42,132,0,2,160,178,18,
+    128,0,2,67,224,113,130,0,128,255,0,92,131,0,128,255,0,92,131,0,128,255,0,92,
+    131,0,6,123,255,196,0,162,255,160,131,0,1,3,247,128,255,5,107,0,82,190,100,163,
+    128,255,0,200,129,0,2,223,255,129,132,0,2,35,50,11,128,0,128,255,0,92,131,0,
+    0,92,128,255,128,0,2,221,255,135,133,0,2,137,255,217,130,0,14,103,255,186,9,251,
+    245,3,0,87,255,202,13,252,254,18,132,0,1,9,212,128,255,0,69,133,0,0,48,129,
+    255,1,79,241,130,255,0,107,132,0,3,44,252,255,189,128,255,0,67,131,0,128,255,0,
+    92,133,0,2,253,255,97,131,0,0,111,128,255,133,0,2,33,156,251,128,255,2,240,125,
+    12,128,0,1,59,192,129,255,2,217,92,3,138,0,8,1,41,0,64,255,16,79,249,4,
+    128,0,2,225,255,120,138,0,3,169,255,232,44,131,0,0,113,128,255,130,0,135,255,2,
+    250,153,30,142,0,0,102,141,255,129,0,0,243,141,255,0,98,129,0,1,1,74,138,255,
+    0,149,128,0,132,255,0,92,133,0,132,255,2,92,0,97,132,255,128,0,132,255,1,92,
+    0,132,255,1,92,0,132,255,0,92,131,0,0,221,135,255,1,247,11,133,0,0,179,143,
+    255,0,96,133,0,0,158,133,255,0,85,132,0,132,255,2,92,0,92,132,255,131,0,1,
+    7,222,133,255,1,238,18,132,0,0,241,131,255,0,105,129,0,0,107,131,255,0,237,130,
+    0,0,87,128,255,0,246,129,0,0,35,129,255,0,42,130,0,0,64,129,255,0,20,129,
+    0,0,64,129,255,0,20,130,0,0,199,129,255,0,36,129,0,0,64,129,255,0,20,129,
+    0,0,64,129,255,0,20,128,0,0,163,129,255,0,152,130,0,0,54,132,255,1,32,158,
+    128,255,1,238,249,128,255,0,134,129,0,144,255,128,0,2,226,255,200,133,0,1,4,3,
+    130,0,2,227,255,193,139,0,2,224,255,206,134,0,0,39,128,255,0,132,133,0,128,255,
+    0,168,134,0,1,22,231,134,255,0,7,128,0,0,138,140,255,0,137,130,0,0,86,128,
+    177,3,88,0,220,217,128,0,1,232,234,131,0,1,236,227,135,0,2,14,255,189,136,0,
+    3,3,161,255,157,130,0,1,21,253,133,255,1,252,21,136,0,1,255,196,134,0,2,233,
+    255,24,130,0,1,211,248,128,0,1,228,219,131,0,1,222,224,128,0,1,255,196,130,0,
+    3,117,255,197,1,131,0,2,198,247,2,133,0,1,35,6,130,0,2,64,255,20,128,0,
+    1,255,196,139,0,2,30,255,149,132,0,1,255,196,137,0,1,255,196,133,0,2,57,255,
+    143,128,0,2,64,255,20,128,0,2,64,255,20,131,0,4,1,165,255,228,24,130,0,13,
+    19,255,68,12,250,103,0,31,239,163,0,155,234,16,136,0,2,39,255,174,129,0,2,64,
+    255,20,128,0,1,255,196,130,0,1,196,255,130,0,1,111,222,129,0,2,189,229,8,129,
+    0,1,255,196,134,0,1,255,196,128,0,2,12,254,66,131,0,2,17,253,50,130,0,1,
+    106,226,130,0,128,255,0,92,131,0,128,255,0,92,131,0,128,255,0,92,131,0,6,45,
+    255,250,12,231,255,82,132,0,0,179,128,255,2,222,15,211,131,255,0,134,129,0,2,180,
+    255,178,132,0,2,143,255,195,128,0,128,255,0,92,131,0,0,92,128,255,128,0,2,174,
+    255,194,133,0,2,197,255,170,130,0,5,40,255,240,59,255,195,128,0,5,33,255,249,77,
+    255,209,133,0,0,151,128,255,0,153,134,0,0,54,129,255,1,39,120,130,255,0,32,132,
+    0,7,185,255,227,9,207,255,208,2,130,0,128,255,0,92,133,0,2,242,255,110,131,0,
+    0,147,128,255,131,0,2,32,155,251,128,255,2,244,135,17,132,0,1,69,201,129,255,2,
+    216,90,2,136,0,8,53,254,13,64,255,16,80,249,2,128,0,2,180,255,174,132,0,3,
+    23,173,135,41,128,0,2,232,255,119,132,0,0,153,128,255,0,1,129,0,0,219,136,255,
+    2,249,151,29,140,0,0,192,141,255,129,0,0,227,141,255,0,33,128,0,1,2,191,139,
+    255,0,219,128,0,132,255,0,92,133,0,0,254,131,255,2,96,0,114,132,255,128,0,132,
+    255,1,92,0,132,255,1,92,0,132,255,0,92,131,0,0,144,135,255,0,181,134,0,0,
+    116,143,255,0,32,132,0,0,87,133,255,0,170,133,0,132,255,2,92,0,92,132,255,131,
+    0,0,118,135,255,0,145,132,0,0,225,131,255,0,142,129,0,0,147,131,255,0,220,130,
+    0,0,113,128,255,0,225,129,0,0,13,129,255,0,69,130,0,0,64,129,255,0,20,129,
+    0,0,64,129,255,0,20,129,0,0,21,129,255,0,76,130,0,0,64,129,255,0,20,129,
+    0,0,64,129,255,0,20,128,0,1,8,144,128,255,0,231,130,0,0,29,132,255,0,198,
+    132,255,1,250,33,129,0,144,255,128,0,3,186,255,240,2,132,0,3,79,248,212,51,128,
+    0,3,188,255,237,1,133,0,2,86,67,28,128,0,3,181,255,248,8,133,0,0,91,128,
+    255,0,89,133,0,128,255,0,168,134,0,0,53,135,255,0,6,129,0,0,51,129,80,132,
+    255,0,143,128,80,0,51,135,0,2,8,250,182,128,0,1,251,204,131,0,1,205,249,129,
+    0,1,2,5,130,0,2,19,255,184,128,0,2,94,220,67,132,0,2,29,255,187,130,0,
+    2,96,255,241,131,228,2,244,255,100,136,0,1,255,196,134,0,2,203,255,29,130,0,1,
+    209,243,128,0,1,198,243,130,0,2,1,245,193,128,0,1,255,196,130,0,3,4,214,255,
+    98,131,0,2,136,255,49,133,0,2,194,241,40,129,0,2,64,255,20,128,0,1,255,196,
+    139,0,2,91,255,93,132,0,1,255,196,137,0,1,255,196,133,0,2,119,255,86,128,0,
+    2,64,255,20,128,0,2,64,255,20,131,0,3,128,255,243,48,132,0,11,224,135,0,162,
+    244,154,231,222,227,185,254,82,130,0,2,12,54,1,130,0,2,10,255,190,129,0,2,64,
+    255,20,128,0,1,255,196,130,0,1,196,255,130,0,1,156,167,129,0,136,255,132,0,1,
+    255,196,129,0,1,212,111,131,0,2,50,255,25,130,0,2,72,255,8,129,0,128,255,0,
+    92,131,0,128,255,0,92,131,0,128,255,0,92,132,0,5,222,255,115,255,248,12,132,0,
+    0,71,129,255,0,215,132,255,0,35,129,0,3,116,255,246,21,130,0,3,2,219,255,137,
+    128,0,128,255,0,92,131,0,0,92,128,255,128,0,3,105,255,254,45,131,0,3,48,254,
+    255,103,131,0,4,233,255,151,255,142,129,0,4,233,255,186,255,144,132,0,0,81,128,255,
+    1,225,13,134,0,1,15,252,128,255,1,168,188,130,255,1,162,1,130,0,0,73,128,255,
+    2,98,0,74,128,255,0,99,130,0,128,255,0,92,133,0,2,223,255,145,130,0,1,1,
+    217,128,255,129,0,2,31,153,250,128,255,2,248,146,23,136,0,1,79,210,129,255,2,215,
+    89,2,134,0,7,16,251,97,64,255,16,150,209,129,0,3,113,255,248,27,131,0,0,126,
+    128,255,0,46,128,0,2,250,255,108,131,0,1,14,232,128,255,0,4,129,0,1,63,234,
+    137,255,2,248,148,25,138,0,0,231,131,255,3,212,130,83,215,132,255,0,1,128,0,0,
+    190,131,255,3,214,2,0,60,132,255,0,98,128,0,0,54,132,255,2,146,198,253,131,255,
+    0,246,128,0,132,255,0,92,133,0,0,247,131,255,2,110,0,159,132,255,128,0,132,255,
+    1,92,0,132,255,1,92,0,132,255,0,92,131,0,0,66,135,255,0,103,134,0,0,54,
+    142,255,0,224,132,0,1,31,240,132,255,1,234,21,133,0,132,255,2,92,0,92,132,255,
+    130,0,1,20,240,135,255,1,250,38,131,0,0,184,131,255,4,223,7,0,8,228,131,255,
+    0,177,130,0,0,160,128,255,0,174,130,0,0,220,128,255,0,115,130,0,0,64,129,255,
+    0,20,129,0,0,64,129,255,0,20,129,0,0,50,129,255,0,25,130,0,0,64,129,255,
+    0,20,129,0,0,64,129,255,0,20,129,0,0,72,129,255,0,8,129,0,1,1,238,138,
+    255,1,189,31,129,0,144,255,128,0,0,134,128,255,0,61,132,0,0,141,128,255,0,26,
+    128,0,0,133,128,255,0,64,132,0,3,37,254,255,199,128,0,0,124,128,255,0,87,133,
+    0,0,179,128,255,0,34,133,0,128,255,0,168,134,0,1,20,254,133,255,0,223,134,0,
+    132,255,0,92,132,0,1,70,118,130,0,2,63,255,130,128,0,1,239,227,131,0,1,225,
+    238,128,0,2,106,251,113,130,0,2,54,255,150,128,0,2,98,255,126,132,0,2,15,255,
+    170,130,0,2,173,255,80,131,0,2,106,255,182,136,0,1,255,196,134,0,2,161,255,63,
+    130,0,1,237,217,128,0,2,157,255,32,129,0,2,37,255,145,128,0,1,255,196,131,0,
+    3,83,255,232,9,130,0,2,63,255,138,132,0,3,24,252,240,4,129,0,2,64,255,20,
+    128,0,1,255,196,139,0,2,136,255,41,132,0,1,255,196,137,0,1,255,196,133,0,2,
+    191,253,19,128,0,2,64,255,20,128,0,2,64,255,20,130,0,3,68,254,252,73,133,0,
+    13,140,222,7,20,187,240,125,59,239,221,85,8,52,19,128,0,2,175,255,48,130,0,2,
+    40,255,168,129,0,2,64,255,20,128,0,1,255,196,130,0,1,196,255,130,0,1,205,107,
+    129,0,132,196,1,255,241,128,196,132,0,1,255,196,129,0,1,149,161,131,0,2,60,255,
+    19,130,0,2,64,255,18,129,0,128,255,0,92,131,0,128,255,0,92,131,0,128,255,0,
+    92,132,0,4,145,255,232,255,183,134,0,0,171,135,255,0,95,129,0,4,26,249,255,172,
+    3,129,0,0,116,128,255,0,48,128,0,128,255,0,92,131,0,0,92,128,255,128,0,4,
+    15,241,255,210,20,129,0,4,20,212,255,241,14,131,0,4,171,255,244,255,88,129,0,0,
+    179,129,255,0,80,131,0,4,28,237,255,253,63,136,0,0,171,135,255,0,93,129,0,4,
+    3,212,255,214,3,128,0,3,194,255,231,12,129,0,128,255,0,92,133,0,3,179,255,233,
+    20,129,0,0,113,129,255,128,0,1,152,249,128,255,2,251,156,30,139,0,2,1,89,218,
+    129,255,1,214,60,134,0,6,162,243,158,255,149,254,95,129,0,4,22,246,255,191,10,129,
+    0,3,50,247,255,205,129,0,3,223,255,196,2,129,0,1,11,179,129,255,0,11,130,0,
+    2,13,125,240,137,255,1,230,30,128,0,1,73,226,128,255,1,245,146,129,0,0,250,131,
+    255,2,161,88,167,133,255,0,5,128,0,0,138,132,255,2,170,92,217,132,255,0,66,128,
+    0,0,38,132,255,2,169,88,179,131,255,0,240,128,0,132,255,0,92,133,0,0,228,131,
+    255,2,189,112,248,132,255,128,0,132,255,1,92,0,132,255,1,92,0,132,255,0,92,131,
+    0,1,4,239,133,255,1,254,27,134,0,1,4,243,141,255,0,160,131,0,1,3,197,133,
+    255,0,164,130,80,0,50,129,0,132,255,2,92,0,92,132,255,130,0,0,150,137,255,0,
+    177,131,0,0,132,132,255,2,192,94,184,132,255,0,124,130,0,0,214,128,255,0,114,130,
+    0,0,157,128,255,0,170,130,0,0,64,129,255,0,20,129,0,0,64,129,255,0,20,129,
+    0,0,60,129,255,0,19,130,0,0,64,129,255,0,20,129,0,0,64,129,255,0,20,129,
+    0,0,64,129,255,0,18,130,0,0,168,139,255,1,253,61,128,0,144,255,128,0,0,48,
+    128,255,0,183,131,0,3,14,235,255,206,129,0,0,44,128,255,1,197,3,131,0,0,166,
+    128,255,0,118,128,0,4,33,254,255,219,12,131,0,0,67,128,255,0,199,134,0,128,255,
+    0,168,135,0,0,191,133,255,0,138,134,0,132,255,0,92,132,0,2,144,255,42,129,0,
+    2,162,255,52,128,0,2,190,255,50,129,0,2,44,254,189,128,0,2,66,255,189,130,0,
+    2,156,255,81,128,0,3,34,254,228,18,131,0,2,86,255,112,129,0,3,6,243,247,11,
+    131,0,3,25,254,249,14,135,0,1,255,196,134,0,2,92,255,157,129,0,2,67,255,152,
+    128,0,2,92,255,111,129,0,2,118,255,79,128,0,1,255,196,131,0,3,1,209,255,112,
+    130,0,3,2,218,244,38,131,0,2,155,255,146,130,0,2,65,255,18,128,0,1,255,196,
+    139,0,2,177,254,7,132,0,1,255,196,137,0,1,255,196,132,0,2,64,255,182,129,0,
+    2,64,255,20,128,0,2,64,255,20,129,0,3,7,224,255,110,134,0,2,35,246,132,134,
+    0,2,147,245,24,128,0,2,120,255,136,130,0,2,135,255,107,129,0,2,64,255,20,128,
+    0,1,255,196,130,0,1,196,255,129,0,2,24,252,29,135,0,1,255,196,134,0,1,255,
+    196,129,0,2,70,231,1,130,0,2,63,255,18,130,0,2,62,255,20,129,0,128,255,0,
+    92,131,0,128,255,0,92,131,0,128,255,0,92,132,0,0,67,129,255,0,105,134,0,1,
+    10,189,135,255,0,43,129,0,0,128,128,255,3,202,103,97,172,128,255,0,165,129,0,128,
+    255,0,92,131,0,0,92,128,255,129,0,0,97,128,255,4,231,126,87,121,229,128,255,0,
+    100,132,0,0,109,129,255,0,34,129,0,0,125,128,255,1,254,18,131,0,0,192,128,255,
+    3,172,59,72,79,131,80,129,0,1,30,233,134,255,0,65,129,0,0,105,128,255,0,81,
+    129,0,0,59,128,255,0,131,129,0,128,255,0,92,133,0,0,92,128,255,5,218,107,92,
+    168,255,209,128,255,128,0,128,255,2,253,166,37,143,0,2,4,100,226,128,255,0,128,128,
+    0,128,255,0,92,129,0,5,12,160,245,255,239,129,131,0,0,115,128,255,7,219,115,90,
+    140,247,255,254,65,129,0,0,142,128,255,4,200,106,90,131,226,130,255,0,24,132,0,2,
+    17,136,245,136,255,0,112,128,0,0,227,131,255,0,62,128,0,0,230,141,255,0,11,128,
+    0,0,53,140,255,1,238,5,128,0,1,1,235,139,255,0,206,128,0,132,255,0,92,133,
+    0,0,193,140,255,128,0,132,255,1,92,0,132,255,1,92,0,132,255,0,92,132,0,0,
+    166,133,255,0,204,136,0,0,185,141,255,0,95,131,0,0,125,140,255,0,136,128,0,132,
+    255,2,92,0,92,132,255,129,0,1,41,251,138,255,0,65,130,0,0,44,141,255,0,37,
+    129,0,0,34,129,255,0,44,130,0,0,86,128,255,1,240,5,129,0,0,64,129,255,0,
+    20,129,0,0,64,129,255,0,20,129,0,0,63,129,255,0,18,130,0,0,64,129,255,0,
+    18,129,0,0,64,129,255,0,20,129,0,0,62,129,255,0,20,130,0,0,65,130,255,4,
+    241,243,173,188,243,131,255,0,45,128,0,0,230,142,255,0,229,129,0,0,190,128,255,1,
+    145,5,128,0,1,14,184,128,255,0,100,130,0,0,181,128,255,1,170,14,128,0,1,4,
+    129,128,255,1,241,18,129,0,0,165,128,255,1,194,27,129,0,1,69,240,128,255,0,79,
+    129,0,128,255,0,168,128,0,128,255,0,168,135,0,1,50,245,131,255,1,221,16,134,0,
+    132,255,0,92,132,0,7,74,255,175,5,0,84,254,198,129,0,8,93,255,207,25,0,21,
+    201,255,89,128,0,3,4,222,255,107,128,0,3,87,251,218,5,129,0,3,167,255,207,52,
+    129,0,0,74,128,235,0,18,129,0,2,71,255,181,133,0,2,198,255,90,135,0,1,255,
+    196,134,0,8,9,231,251,75,0,15,204,255,55,128,0,0,10,128,235,5,40,0,39,237,
+    231,5,128,0,1,255,196,132,0,3,84,255,229,7,130,0,3,76,255,224,61,128,0,4,
+    9,137,255,238,23,130,0,2,79,255,8,128,0,1,255,196,139,0,1,214,229,133,0,1,
+    255,196,137,0,1,255,196,130,0,4,3,81,238,252,50,129,0,2,64,255,20,128,0,2,
+    64,255,20,129,0,2,99,255,191,136,0,3,113,255,131,5,130,0,3,4,137,255,93,129,
+    0,3,27,248,246,67,128,0,3,82,248,233,13,129,0,2,64,255,20,128,0,1,255,196,
+    130,0,1,196,255,129,0,1,100,187,136,0,1,255,196,134,0,1,255,196,129,0,2,2,
+    224,55,130,0,2,77,255,8,130,0,2,54,255,28,129,0,128,255,0,92,131,0,128,255,
+    0,92,131,0,128,255,0,92,132,0,1,5,239,128,255,0,29,135,0,6,2,102,200,241,
+    239,200,204,128,255,1,249,15,129,0,1,2,160,132,255,1,194,12,129,0,128,255,0,92,
+    131,0,0,92,128,255,130,0,1,119,253,131,255,1,254,124,133,0,0,46,128,255,0,235,
+    130,0,0,70,128,255,0,208,132,0,138,255,130,0,1,37,176,128,241,4,179,46,89,244,
+    135,129,0,3,14,234,255,200,131,0,3,180,255,246,28,128,0,128,255,0,92,133,0,1,
+    3,179,131,255,1,219,53,128,255,128,0,2,255,176,45,147,0,3,7,110,232,128,128,0,
+    128,255,0,92,131,0,2,65,255,16,133,0,0,141,132,255,1,252,106,130,0,1,17,215,
+    132,255,1,237,85,128,255,0,63,134,0,2,23,146,249,134,255,0,128,128,0,132,255,0,
+    92,128,0,0,176,141,255,0,28,129,0,0,203,139,255,0,134,130,0,0,148,139,255,0,
+    132,128,0,132,255,0,92,133,0,0,133,140,255,128,0,132,255,1,92,0,132,255,1,92,
+    0,132,255,0,92,132,0,0,88,133,255,0,126,136,0,0,122,133,255,0,180,133,255,0,
+    31,131,0,0,228,140,255,0,243,128,0,132,255,2,92,0,92,132,255,129,0,0,182,139,
+    255,1,206,2,130,0,0,190,139,255,0,188,130,0,0,116,128,255,0,203,131,0,1,7,
+    237,128,255,0,72,129,0,0,64,129,255,1,97,12,128,0,0,64,129,255,0,20,128,0,
+    1,18,137,129,255,0,10,129,0,1,34,167,129,255,0,8,128,0,1,22,131,129,255,0,
+    20,129,0,0,55,129,255,0,79,131,0,0,182,129,255,5,242,153,109,104,151,242,129,255,
+    0,156,129,0,0,179,142,255,0,178,129,0,1,38,241,128,255,3,227,165,168,237,128,255,
+    1,196,3,130,0,1,29,234,128,255,3,239,172,167,222,129,255,0,97,130,0,1,18,222,
+    128,255,3,248,182,159,201,129,255,0,158,130,0,128,255,0,168,128,0,128,255,0,168,136,
+    0,1,53,237,129,255,1,185,27,135,0,132,255,0,92,133,0,6,184,255,230,215,255,241,
+    44,129,0,7,1,175,255,248,210,247,255,171,130,0,7,64,248,255,223,217,255,246,57,130,
+    0,1,14,198,128,255,5,225,204,234,255,242,66,130,0,2,148,255,104,133,0,2,116,255,
+    172,135,0,1,255,196,135,0,6,75,252,255,209,237,255,151,130,0,6,87,254,249,206,247,
+    255,87,129,0,1,255,196,132,0,3,1,212,255,107,131,0,0,122,128,255,5,223,202,242,
+    255,240,63,130,0,2,91,193,223,129,0,1,255,196,139,0,1,233,212,133,0,1,255,241,
+    134,196,0,98,128,0,1,255,241,129,196,4,210,239,255,252,100,130,0,2,64,255,20,128,
+    0,3,64,255,104,58,128,0,2,191,255,219,132,196,131,0,9,117,254,230,144,109,104,141,
+    229,249,99,131,0,7,103,255,254,217,219,255,244,64,129,0,3,74,133,255,20,128,0,1,
+    255,196,130,0,1,196,255,129,0,1,199,77,136,0,1,255,196,134,0,1,255,196,130,0,
+    1,117,154,129,0,2,73,192,213,131,0,3,15,248,151,23,128,0,128,255,0,92,131,0,
+    128,255,0,92,131,0,128,255,0,92,133,0,2,167,255,206,143,0,2,47,169,113,132,0,
+    6,84,190,240,247,207,112,5,130,0,128,255,0,92,131,0,0,92,128,255,131,0,6,51,
+    166,230,250,230,168,55,134,0,3,1,237,255,182,130,0,3,16,254,255,144,132,0,138,255,
+    137,0,0,3,130,0,0,136,128,255,0,64,131,0,3,46,253,255,163,128,0,128,255,0,
+    92,134,0,7,7,117,214,246,225,145,18,28,128,255,128,0,0,53,151,0,1,10,43,128,
+    0,128,255,0,92,131,0,2,32,128,8,134,0,6,65,174,232,250,231,168,52,132,0,11,
+    15,138,220,250,241,203,128,19,0,216,255,140,136,0,2,30,156,251,132,255,0,128,128,0,
+    128,255,1,92,0,128,255,0,92,128,0,0,76,141,255,0,91,129,0,1,51,252,137,255,
+    1,230,16,130,0,1,30,246,137,255,1,243,23,128,0,132,255,0,92,133,0,1,39,252,
+    139,255,128,0,132,255,1,92,0,132,255,1,92,0,132,255,0,92,132,0,1,15,250,132,
+    255,0,49,136,0,0,59,132,255,1,243,84,132,255,0,223,132,0,142,255,128,0,132,255,
+    2,92,0,92,132,255,128,0,0,69,132,255,2,244,36,234,132,255,0,97,130,0,1,38,
+    245,137,255,1,247,39,129,0,1,1,221,128,255,0,103,132,0,0,142,128,255,0,177,129,
+    0,0,64,130,255,0,141,128,0,0,64,129,255,0,20,128,0,0,170,129,255,0,224,130,
+    0,0,167,129,255,0,229,129,0,0,186,130,255,0,20,129,0,0,24,130,255,0,41,130,
+    0,1,24,223,136,255,1,198,8,129,0,1,63,254,140,255,1,253,62,130,0,1,57,233,
+    132,255,1,198,20,132,0,1,43,222,132,255,1,252,116,132,0,1,28,206,133,255,1,152,
+    3,130,0,128,255,0,168,128,0,128,255,0,168,137,0,0,50,128,255,1,249,9,136,0,
+    0,227,131,255,0,62,133,0,5,14,153,237,239,176,39,131,0,6,5,122,221,250,220,120,
+    4,131,0,5,52,183,244,242,182,48,132,0,7,6,106,197,241,248,222,152,35,131,0,2,
+    225,255,27,133,0,3,33,255,244,9,134,0,1,255,196,136,0,5,64,196,246,224,121,2,
+    131,0,4,80,209,247,212,87,130,0,1,255,196,133,0,3,87,255,226,6,131,0,6,56,
+    172,224,249,227,154,32,131,0,2,190,234,82,129,0,1,255,196,139,0,1,248,201,133,0,
+    136,255,0,128,128,0,131,255,3,245,217,156,46,131,0,2,64,255,20,128,0,0,64,128,
+    255,0,164,128,0,0,238,134,255,132,0,7,43,147,210,240,246,218,150,35,133,0,5,76,
+    199,247,238,172,42,130,0,0,208,128,255,0,20,128,0,1,255,196,130,0,1,196,255,128,
+    0,1,50,201,137,0,1,255,196,134,0,1,255,196,130,0,2,10,221,16,128,0,2,191,
+    228,65,132,0,2,122,246,64,255,0,255,0,137,0,2,37,166,254,130,255,0,118,128,0,
+    132,255,0,92,129,0,0,171,140,255,0,157,130,0,1,102,254,135,255,1,246,62,132,0,
+    0,101,136,255,1,254,85,129,0,132,255,0,92,134,0,0,125,139,255,128,0,132,255,1,
+    92,0,132,255,1,92,0,132,255,0,92,133,0,0,188,131,255,0,226,137,0,1,6,246,
+    131,255,1,192,26,132,255,0,159,132,0,142,255,128,0,132,255,2,92,0,92,132,255,128,
+    0,0,174,132,255,2,132,0,111,132,255,0,202,131,0,1,81,250,135,255,1,251,87,130,
+    0,0,68,128,255,1,229,7,132,0,0,26,129,255,0,26,128,0,0,64,130,255,0,164,
+    128,0,0,64,129,255,0,20,128,0,0,192,129,255,0,125,130,0,0,211,129,255,0,143,
+    129,0,0,208,130,255,0,20,130,0,0,190,129,255,0,64,131,0,1,27,191,134,255,1,
+    167,10,131,0,1,124,254,138,255,1,254,123,132,0,7,18,132,213,245,242,198,104,5,134,
+    0,7,9,115,199,238,250,224,159,47,134,0,7,3,99,190,235,249,226,164,60,132,0,128,
+    255,0,168,128,0,128,255,0,168,138,0,2,97,128,73,137,0,1,74,227,128,255,1,245,
+    147,255,0,255,0,255,0,255,0,191,0,1,45,177,128,255,1,244,41,128,0,0,227,131,
+    255,0,62,129,0,1,10,169,139,255,0,155,131,0,1,86,235,133,255,1,225,58,134,0,
+    1,101,246,133,255,1,240,81,130,0,0,227,131,255,0,62,135,0,0,136,137,255,0,226,
+    128,0,0,227,131,255,2,62,0,227,131,255,2,62,0,227,131,255,0,62,133,0,0,101,
+    131,255,0,140,138,0,0,176,131,255,2,120,0,210,131,255,0,81,132,0,0,227,140,255,
+    0,226,128,0,0,227,131,255,2,62,0,63,131,255,0,226,128,0,0,173,131,255,4,236,
+    15,0,7,224,131,255,0,200,132,0,1,69,226,133,255,1,226,71,131,0,3,50,231,255,
+    79,134,0,3,111,255,214,23,128,0,1,19,225,128,255,1,249,95,128,0,4,19,225,255,
+    198,1,128,0,4,120,251,234,144,4,130,0,4,121,228,244,155,6,129,0,1,135,254,128,
+    255,1,198,1,130,0,4,28,187,247,225,18,133,0,7,76,169,223,249,246,221,159,60,134,
+    0,2,63,179,230,134,255,2,230,178,62,255,0,255,0,255,0,255,0,255,0,157,0,2,
+    47,103,38,129,0,1,74,227,128,255,1,245,147,132,0,13,69,170,227,249,242,214,156,79,
+    188,252,255,253,198,30,132,0,8,18,117,195,232,250,234,188,107,9,136,0,8,26,131,202,
+    239,251,235,193,120,17,131,0,1,74,227,128,255,1,245,147,137,0,7,62,172,231,250,227,
+    184,181,236,128,255,1,227,73,128,0,1,74,227,128,255,1,245,147,128,0,1,74,227,128,
+    255,1,245,147,128,0,1,74,227,128,255,1,245,147,134,0,6,2,157,245,255,251,180,13,
+    138,0,9,33,195,254,255,249,172,8,0,56,207,128,255,1,242,145,133,0,1,74,227,138,
+    255,1,227,73,128,0,1,74,227,128,255,1,245,147,129,0,1,148,245,128,255,1,227,73,
+    128,0,2,38,206,254,128,255,1,219,63,129,0,1,51,213,129,255,1,216,54,133,0,8,
+    11,108,189,231,250,231,188,106,10,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,
+    0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,
+    0,255,0,238,0,7,5,112,202,243,246,218,145,27,136,0,4,67,125,128,94,12,134,0,
+    3,174,255,199,3,131,0,4,19,225,255,220,20,128,0,4,19,225,255,194,1,132,0,2,
+    174,255,201,129,0,4,19,225,255,197,1,133,0,4,58,234,255,226,27,128,0,4,8,187,
+    255,234,58,128,0,4,19,225,255,197,1,128,0,4,122,249,255,228,22,128,0,4,34,222,
+    255,241,57,129,0,4,43,236,255,219,32,132,0,4,19,225,255,194,1,128,0,0,180,134,
+    255,0,180,128,0,1,19,225,128,255,0,154,130,0,4,144,254,255,194,1,130,0,5,14,
+    143,230,242,191,65,131,0,4,19,225,255,197,1,133,0,4,19,225,255,197,1,131,0,6,
+    13,130,208,243,235,177,57,134,0,2,3,107,202,128,243,1,188,71,132,0,1,19,225,132,
+    255,1,252,119,129,0,1,95,249,130,255,1,246,84,129,0,0,180,134,255,0,180,128,0,
+    1,19,225,133,255,1,224,18,128,0,1,19,225,128,255,128,234,1,155,19,132,0,7,9,
+    213,255,164,120,255,232,36,130,0,6,19,141,222,249,232,174,59,134,0,5,77,197,245,233,
+    150,15,132,0,3,41,183,243,225,128,255,1,194,1,133,0,4,19,225,255,194,1,128,0,
+    0,180,133,255,0,180,128,0,1,19,225,129,255,3,250,229,162,36,131,0,1,19,225,130,
+    255,3,251,229,158,27,133,0,6,13,122,209,245,233,161,33,131,0,9,114,252,250,104,0,
+    3,199,255,220,16,130,0,5,54,186,245,237,161,27,133,0,1,48,57,131,0,1,19,225,
+    129,255,3,253,231,164,33,136,0,3,176,255,247,83,134,0,6,4,119,217,249,224,132,10,
+    130,0,1,19,225,130,255,3,245,218,136,13,130,0,4,19,225,255,197,1,128,0,4,19,
+    225,255,194,1,130,0,5,2,118,219,247,209,92,131,0,4,19,225,255,197,1,131,0,3,
+    142,254,197,1,129,0,5,15,155,236,246,216,57,128,0,3,124,253,249,100,128,0,3,146,
+    254,255,154,128,0,3,95,249,253,125,130,0,3,36,176,240,230,128,255,1,194,1,128,0,
+    3,150,255,248,90,130,0,0,115,128,251,0,107,130,0,5,96,207,248,233,155,21,130,0,
+    4,19,225,255,197,1,133,0,4,19,225,255,197,1,128,0,4,19,225,255,194,1,128,0,
+    4,19,225,255,197,1,130,0,5,31,169,241,240,166,29,131,0,4,19,225,255,197,1,134,
+    0,4,5,144,241,228,88,129,0,2,174,255,146,131,0,4,19,225,255,197,1,132,0,4,
+    4,195,255,194,1,128,0,4,19,225,255,197,1,130,0,4,35,189,242,184,25,134,0,5,
+    70,190,239,232,169,41,136,0,128,255,0,92,132,0,2,64,255,20,128,0,0,64,130,255,
+    2,246,213,105,131,0,3,66,228,205,31,129,0,1,29,170,131,0,2,49,254,123,130,0,
+    2,86,253,49,128,0,0,64,130,255,3,251,225,128,2,129,0,1,179,185,129,0,3,1,
+    238,243,3,129,0,1,180,176,128,0,134,255,128,0,2,64,255,20,130,0,2,64,255,16,
+    129,0,6,1,110,216,249,231,157,25,130,0,1,199,182,132,0,1,212,149,130,0,1,57,
+    222,128,0,1,209,70,128,0,0,64,133,255,0,64,132,0,2,71,255,16,128,0,2,25,
+    246,161,131,0,2,148,243,21,128,0,2,64,255,20,130,0,2,64,255,16,129,0,0,178,
+    130,255,0,152,132,0,5,90,201,243,235,159,23,130,0,0,64,132,255,0,192,129,0,0,
+    50,138,80,0,50,129,0,5,64,248,72,227,233,108,132,0,4,33,182,245,220,97,131,0,
+    6,4,151,243,209,72,255,16,128,0,133,255,128,0,2,64,255,20,129,0,5,13,155,235,
+    234,128,1,136,0,1,7,191,132,255,1,242,56,134,0,0,101,130,255,0,183,134,0,0,
+    233,128,255,0,48,131,0,0,64,129,255,0,139,128,0,0,64,129,255,0,16,131,0,0,
+    21,128,255,1,254,8,128,0,0,64,129,255,0,20,133,0,0,72,129,255,0,156,128,0,
+    0,124,129,255,0,75,128,0,0,64,129,255,2,20,0,79,130,255,0,22,128,0,1,39,
+    254,128,255,0,191,129,0,0,175,129,255,0,37,132,0,0,64,129,255,0,16,128,0,136,
+    255,128,0,0,64,129,255,1,250,11,128,0,1,7,245,129,255,0,16,129,0,1,11,207,
+    131,255,0,90,130,0,0,64,129,255,0,20,133,0,0,64,129,255,0,20,130,0,1,28,
+    218,131,255,1,252,95,132,0,1,14,196,132,255,1,147,1,130,0,0,64,134,255,0,192,
+    129,0,0,179,132,255,0,152,129,0,136,255,128,0,0,64,135,255,0,64,128,0,0,64,
+    132,255,1,199,4,131,0,0,59,128,255,1,224,211,128,255,0,72,129,0,1,26,223,131,
+    255,1,253,102,132,0,0,110,131,255,1,199,2,130,0,1,27,236,132,255,0,16,133,0,
+    0,64,129,255,0,16,128,0,135,255,128,0,0,64,133,255,1,240,49,130,0,0,64,134,
+    255,1,226,17,131,0,1,25,216,131,255,1,240,55,130,0,0,163,128,255,2,209,0,60,
+    129,255,0,34,129,0,1,64,249,130,255,1,226,21,131,0,3,118,255,250,8,130,0,0,
+    64,133,255,1,235,27,134,0,0,34,129,255,0,190,133,0,1,1,176,131,255,1,199,8,
+    129,0,0,64,134,255,1,210,11,129,0,0,64,129,255,0,20,128,0,0,64,129,255,0,
+    16,130,0,0,163,131,255,0,118,130,0,0,64,129,255,0,20,130,0,1,45,252,128,255,
+    0,20,129,0,0,179,130,255,0,123,128,0,0,182,128,255,3,189,0,2,243,128,255,3,
+    248,5,0,185,128,255,0,181,129,0,1,23,228,132,255,0,16,128,0,0,203,128,255,0,
+    192,130,0,0,223,128,255,0,154,129,0,0,131,131,255,1,215,14,129,0,0,64,129,255,
+    0,20,133,0,0,64,129,255,0,20,128,0,0,64,129,255,0,16,128,0,4,64,255,145,
+    255,20,129,0,1,17,229,130,255,1,228,23,130,0,0,64,129,255,0,20,134,0,0,129,
+    130,255,2,76,0,47,128,255,0,189,131,0,0,64,129,255,0,20,132,0,0,109,129,255,
+    0,16,128,0,4,64,255,145,255,20,129,0,5,2,209,197,105,220,179,133,0,7,105,254,
+    181,105,115,209,242,60,135,0,128,255,0,92,132,0,2,64,255,20,128,0,2,64,255,104,
+    128,92,3,99,152,254,97,129,0,4,2,222,170,200,170,129,0,1,139,61,132,0,2,166,
+    241,19,128,0,2,9,224,159,129,0,2,64,255,104,128,92,3,99,163,255,110,129,0,1,
+    127,230,129,0,3,38,252,254,45,129,0,1,228,123,128,0,129,92,2,133,255,102,128,92,
+    128,0,2,64,255,20,130,0,2,64,255,16,129,0,7,134,247,148,101,126,231,225,19,129,
+    0,2,124,244,6,130,0,2,28,255,74,130,0,5,98,181,0,2,247,29,128,0,2,64,
+    255,104,131,92,0,23,131,0,3,3,212,255,16,129,0,2,143,251,33,129,0,2,26,247,
+    131,129,0,2,64,255,20,130,0,2,64,255,16,129,0,1,214,154,129,92,0,54,131,0,
+    7,128,252,163,103,125,235,218,13,129,0,2,64,255,104,130,92,0,69,128,0,0,137,140,
+    255,0,136,128,0,6,64,251,235,136,155,255,71,130,0,6,18,226,203,104,169,255,67,130,
+    0,6,118,250,126,165,229,255,16,128,0,131,92,1,230,189,128,0,2,64,255,20,129,0,
+    5,171,239,118,141,253,108,136,0,0,126,128,255,7,180,103,90,139,245,255,219,3,132,0,
+    1,1,226,131,255,0,55,133,0,0,181,128,255,0,104,131,0,7,64,255,240,254,245,23,
+    0,64,129,255,0,16,131,0,0,77,128,255,0,207,129,0,0,64,129,255,0,20,134,0,
+    0,198,128,255,3,252,40,27,244,128,255,0,196,129,0,0,64,129,255,2,20,33,239,129,
+    255,0,84,130,0,0,173,129,255,3,59,0,46,254,128,255,0,165,133,0,0,64,129,255,
+    0,16,128,0,0,234,134,255,0,241,128,0,0,64,130,255,0,73,128,0,0,66,130,255,
+    0,16,129,0,0,137,132,255,1,246,23,129,0,0,64,129,255,0,20,133,0,0,64,129,
+    255,0,20,130,0,0,195,133,255,1,249,32,131,0,0,182,134,255,0,125,130,0,0,64,
+    134,255,0,169,129,0,0,215,132,255,0,129,129,0,0,234,134,255,0,234,128,0,0,64,
+    135,255,0,42,128,0,0,64,133,255,0,99,131,0,0,99,128,255,1,187,248,128,255,0,
+    32,129,0,0,179,133,255,1,251,40,130,0,1,39,252,132,255,0,97,130,0,0,142,133,
+    255,0,16,133,0,0,64,129,255,0,16,128,0,0,234,133,255,0,217,128,0,0,64,134,
+    255,1,216,4,129,0,0,64,135,255,0,137,130,0,1,1,203,133,255,1,225,10,129,0,
+    0,94,129,255,1,25,132,128,255,0,222,130,0,0,216,132,255,0,152,130,0,0,42,129,
+    255,0,16,130,0,0,64,134,255,0,158,134,0,0,109,129,255,1,251,17,132,0,0,88,
+    133,255,0,125,129,0,0,64,135,255,0,129,129,0,0,64,129,255,0,20,128,0,0,64,
+    129,255,0,16,129,0,0,71,132,255,1,249,28,129,0,0,64,129,255,0,20,129,0,1,
+    33,219,129,255,0,20,128,0,0,23,131,255,0,81,128,0,0,134,128,255,2,234,0,45,
+    130,255,2,52,0,232,128,255,0,130,129,0,0,143,133,255,0,16,128,0,0,133,128,255,
+    1,249,11,128,0,0,39,129,255,0,83,128,0,1,36,253,132,255,0,130,129,0,0,64,
+    129,255,0,20,133,0,0,64,129,255,0,20,128,0,0,64,129,255,0,16,128,0,0,42,
+    128,255,1,244,9,129,0,0,151,132,255,0,157,130,0,0,64,129,255,0,20,133,0,1,
+    7,235,130,255,2,192,0,162,128,255,0,87,131,0,0,64,129,255,0,20,131,0,1,16,
+    236,129,255,0,16,128,0,0,42,128,255,1,244,9,129,0,6,41,255,35,0,84,249,4,
+    131,0,2,39,250,115,129,0,3,3,167,226,10,134,0,128,255,0,92,132,0,2,64,255,
+    20,128,0,2,64,255,20,130,0,1,157,212,129,0,4,37,255,43,90,242,128,0,1,12,
+    188,133,0,2,33,249,141,128,0,2,126,244,26,129,0,2,64,255,20,130,0,1,161,214,
+    129,0,2,76,255,19,128,0,3,92,211,219,100,128,0,2,19,255,70,131,0,2,64,255,
+    16,130,0,2,64,255,20,130,0,2,64,255,16,128,0,2,15,249,92,129,0,2,32,244,
+    125,129,0,2,49,255,64,130,0,2,100,245,8,130,0,5,139,140,0,35,243,1,128,0,
+    2,64,255,20,137,0,3,103,250,255,16,129,0,2,23,246,153,129,0,2,145,237,15,129,
+    0,2,64,255,20,130,0,2,64,255,16,128,0,2,1,247,69,134,0,2,49,254,90,129,
+    0,2,42,240,121,129,0,2,64,255,20,133,0,0,243,140,255,0,243,128,0,2,64,255,
+    152,128,0,1,185,180,130,0,2,133,225,12,128,0,1,193,171,129,0,7,1,221,133,0,
+    1,196,255,16,132,0,2,76,252,39,128,0,2,64,255,20,128,0,2,22,255,83,128,0,
+    1,140,222,136,0,2,218,255,166,130,0,0,74,128,255,0,61,132,0,0,65,132,255,0,
+    148,133,0,0,125,128,255,0,160,131,0,0,64,130,255,2,143,0,64,129,255,0,16,131,
+    0,0,133,128,255,0,151,129,0,0,64,129,255,0,20,134,0,0,61,129,255,1,173,164,
+    128,255,1,254,54,129,0,0,64,129,255,1,26,203,129,255,0,139,131,0,1,45,254,128,
+    255,2,183,0,172,128,255,1,251,36,133,0,0,64,129,255,0,16,128,0,0,39,130,92,
+    0,242,129,255,0,121,128,0,0,64,130,255,0,141,128,0,0,135,130,255,0,16,128,0,
+    1,2,237,128,255,2,230,113,237,128,255,0,132,129,0,0,64,129,255,0,20,133,0,0,
+    64,129,255,0,20,129,0,0,80,129,255,2,195,104,153,129,255,0,138,130,0,0,79,129,
+    255,3,212,117,124,234,128,255,1,246,30,129,0,0,64,129,255,0,104,129,92,1,88,19,
+    128,0,1,2,248,128,255,0,133,128,92,1,83,10,129,0,0,39,128,92,0,133,129,255,
+    2,102,92,38,128,0,0,64,129,255,0,104,130,92,0,61,129,0,0,64,129,255,1,196,
+    214,128,255,0,189,131,0,0,140,128,255,0,180,128,255,1,246,1,128,0,1,21,254,128,
+    255,3,179,102,140,254,128,255,0,134,130,0,0,151,128,255,2,246,114,224,128,255,0,176,
+    129,0,1,2,234,128,255,1,182,224,129,255,0,16,133,0,0,64,129,255,0,16,128,0,
+    0,39,129,92,0,199,129,255,0,75,128,0,0,64,129,255,2,104,96,166,129,255,0,85,
+    129,0,0,64,129,255,3,104,92,98,208,128,255,0,221,130,0,0,93,129,255,2,183,103,
+    183,129,255,0,92,129,0,1,21,253,128,255,1,94,204,128,255,0,148,129,0,0,37,129,
+    255,1,156,194,128,255,0,236,130,0,0,64,129,255,0,16,130,0,0,64,129,255,2,104,
+    95,183,128,255,0,239,134,0,0,183,130,255,0,92,132,0,0,174,128,255,2,238,111,221,
+    128,255,0,222,129,0,0,64,129,255,3,104,92,98,205,128,255,0,219,129,0,0,64,129,
+    255,0,20,128,0,0,64,129,255,0,16,129,0,0,172,128,255,2,233,119,250,128,255,0,
+    122,129,0,0,64,129,255,0,20,128,0,1,44,233,130,255,0,20,128,0,0,55,129,255,
+    2,112,91,2,128,0,0,83,129,255,1,23,99,130,255,1,107,24,129,255,0,77,129,0,
+    0,232,128,255,1,184,219,129,255,0,16,128,0,0,58,129,255,0,74,128,0,0,111,128,
+    255,1,250,13,128,0,0,125,128,255,2,251,117,202,128,255,0,220,129,0,0,64,129,255,
+    0,20,133,0,0,64,129,255,0,20,128,0,0,64,129,255,0,16,129,0,2,61,92,45,
+    129,0,1,1,235,128,255,1,184,177,128,255,1,240,1,129,0,0,64,129,255,0,20,133,
+    0,0,40,131,255,1,247,26,129,255,0,4,131,0,0,64,129,255,0,20,131,0,0,140,
+    130,255,0,16,129,0,2,61,92,45,130,0,6,41,255,63,0,93,248,2,131,0,1,161,
+    194,131,0,2,14,236,109,134,0,128,255,0,92,132,0,2,64,255,20,128,0,2,64,255,
+    20,130,0,2,80,253,4,128,0,8,57,255,23,68,255,8,0,110,91,134,0,5,146,248,
+    30,27,245,126,130,0,2,64,255,20,130,0,2,84,254,4,128,0,2,25,255,64,128,0,
+    3,146,162,166,155,128,0,2,67,255,18,131,0,2,64,255,16,130,0,2,64,255,20,130,
+    0,2,64,255,16,128,0,2,56,255,31,130,0,1,179,173,130,0,1,229,133,130,0,1,
+    172,178,131,0,4,180,100,0,76,204,129,0,2,64,255,20,136,0,4,13,232,145,255,16,
+    130,0,6,141,249,27,0,24,246,119,130,0,2,64,255,20,130,0,2,64,255,16,128,0,
+    2,30,255,35,134,0,1,166,188,131,0,1,142,200,129,0,2,64,255,20,133,0,142,255,
+    128,0,2,64,255,63,128,0,1,101,240,130,0,1,217,120,129,0,1,67,103,129,0,2,
+    27,255,54,128,0,2,109,255,16,132,0,1,201,158,129,0,2,64,255,20,128,0,2,55,
+    255,25,128,0,2,75,254,6,135,0,2,249,255,106,131,0,2,205,192,68,132,0,0,158,
+    132,255,1,235,5,132,0,0,69,128,255,0,216,131,0,0,64,130,255,2,247,25,64,129,
+    255,0,16,131,0,0,189,128,255,0,95,129,0,0,64,129,255,3,252,234,156,20,132,0,
+    0,179,132,255,0,164,130,0,0,64,129,255,0,168,129,255,1,191,3,132,0,0,171,129,
+    255,1,96,254,128,255,0,153,134,0,0,64,129,255,0,16,132,0,1,41,252,128,255,1,
+    215,6,128,0,0,64,130,255,0,208,128,0,0,204,130,255,0,16,128,0,0,39,129,255,
+    2,83,0,117,128,255,0,202,129,0,0,64,129,255,0,20,133,0,0,64,129,255,0,20,
+    129,0,0,176,128,255,1,213,6,128,0,0,162,128,255,0,206,130,0,0,184,128,255,1,
+    221,14,128,0,1,42,248,128,255,0,124,129,0,0,64,129,255,0,20,133,0,0,31,129,
+    255,1,47,3,135,0,0,64,129,255,0,16,130,0,0,64,129,255,0,20,134,0,0,64,
+    129,255,1,71,109,128,255,0,243,129,0,0,180,134,255,0,180,128,0,0,57,129,255,0,
+    32,128,0,0,186,128,255,0,177,130,0,0,224,128,255,2,136,8,117,128,255,0,207,129,
+    0,0,26,129,255,1,58,116,129,255,0,16,130,0,2,40,179,240,130,255,0,16,131,0,
+    1,2,220,128,255,0,189,129,0,0,64,129,255,3,20,0,2,211,128,255,0,168,129,0,
+    0,64,129,255,0,20,128,0,0,87,128,255,1,254,4,129,0,0,188,128,255,4,201,3,
+    0,9,229,128,255,0,175,130,0,0,201,128,255,1,187,254,128,255,0,75,129,0,0,58,
+    129,255,1,23,74,129,255,0,9,129,0,0,236,130,255,0,180,129,0,0,64,129,255,2,
+    20,0,76,129,255,0,8,132,0,1,9,247,130,255,0,172,132,0,0,229,128,255,2,134,
+    0,89,129,255,0,7,128,0,0,64,129,255,0,20,128,0,0,83,128,255,1,252,4,128,
+    0,0,64,129,255,0,20,128,0,0,64,129,255,0,16,129,0,0,237,128,255,2,111,0,
+    157,128,255,0,191,129,0,0,64,129,255,0,20,128,0,0,175,131,255,0,20,128,0,0,
+    236,130,255,0,180,129,0,0,31,129,255,1,68,153,130,255,1,162,72,129,255,0,24,128,
+    0,0,32,129,255,1,61,111,129,255,0,16,128,0,1,2,236,128,255,0,143,128,0,0,
+    183,128,255,0,188,129,0,0,173,128,255,2,186,0,78,129,255,0,7,128,0,0,64,129,
+    255,3,239,249,212,87,130,0,0,64,129,255,0,20,128,0,0,64,129,255,0,16,128,0,
+    4,19,225,255,197,1,128,0,0,27,129,255,1,55,73,129,255,0,13,129,0,0,64,129,
+    255,1,21,159,128,255,0,148,129,0,0,58,132,255,0,144,128,255,0,117,132,0,0,64,
+    129,255,0,20,130,0,1,34,251,130,255,0,16,136,0,5,2,228,207,44,226,161,131,0,
+    2,3,236,98,132,0,1,152,189,134,0,128,255,0,92,132,0,2,64,255,20,128,0,2,
+    64,255,20,130,0,2,78,250,3,128,0,8,42,255,33,78,248,0,2,194,5,134,0,5,
+    21,242,154,153,228,10,130,0,2,64,255,20,130,0,2,73,253,5,129,0,1,230,109,128,
+    0,3,200,108,113,210,128,0,1,114,220,132,0,2,64,255,16,130,0,2,64,255,20,130,
+    0,2,64,255,16,128,0,2,43,255,119,130,0,0,5,131,0,1,155,202,129,0,2,3,
+    239,103,129,0,134,255,128,0,2,64,255,20,136,0,4,134,195,64,255,16,130,0,6,22,
+    245,142,0,139,231,10,130,0,2,64,255,20,130,0,2,64,255,16,128,0,4,65,252,4,
+    7,3,131,0,2,3,237,100,131,0,1,32,29,129,0,2,64,255,20,133,0,142,255,128,
+    0,2,64,255,33,128,0,2,74,255,8,128,0,5,12,255,60,0,9,2,131,0,2,53,
+    255,30,128,0,2,79,255,16,131,0,2,54,255,44,129,0,2,64,255,20,128,0,2,29,
+    255,58,128,0,2,105,245,1,135,0,3,231,255,196,10,138,0,1,8,241,133,255,0,77,
+    132,0,0,14,129,255,0,17,130,0,0,64,131,255,1,147,64,129,255,0,16,130,0,1,
+    2,242,128,255,0,38,129,0,0,64,132,255,1,202,6,131,0,1,44,253,130,255,1,246,
+    29,130,0,0,64,132,255,1,227,22,133,0,1,44,254,131,255,1,247,27,134,0,0,64,
+    129,255,0,16,132,0,0,179,129,255,0,64,129,0,0,64,130,255,3,254,21,19,254,130,
+    255,0,16,128,0,0,59,129,255,2,29,0,73,128,255,0,242,129,0,0,64,129,255,0,
+    20,133,0,0,64,129,255,0,20,128,0,1,5,243,128,255,0,107,129,0,0,70,128,255,
+    0,156,129,0,1,3,247,128,255,0,110,130,0,0,165,128,255,0,200,129,0,0,64,129,
+    255,0,38,129,20,0,6,129,0,0,67,130,255,2,249,164,20,133,0,0,64,129,255,0,
+    16,130,0,0,64,129,255,0,38,129,20,0,16,130,0,0,64,129,255,1,33,75,129,255,
+    0,7,128,0,136,255,128,0,0,45,129,255,6,220,124,47,94,251,246,110,129,0,0,14,
+    130,255,0,254,128,255,1,140,42,129,0,0,53,129,255,1,29,79,129,255,0,16,129,0,
+    1,27,231,132,255,0,16,131,0,0,76,129,255,0,66,129,0,0,64,129,255,0,20,128,
+    0,0,129,128,255,0,219,129,0,0,64,129,255,0,20,128,0,0,83,128,255,1,253,5,
+    128,0,1,9,249,128,255,0,97,129,0,3,129,255,244,103,130,0,0,126,131,255,1,247,
+    10,129,0,0,35,129,255,1,91,137,128,255,0,248,130,0,132,255,129,0,0,64,129,255,
+    2,38,21,124,128,255,0,241,133,0,0,76,131,255,1,243,7,131,0,0,200,128,255,2,
+    62,0,97,128,255,1,253,4,128,0,0,64,129,255,0,20,128,0,0,77,129,255,0,7,
+    128,0,0,64,129,255,0,38,128,20,0,79,129,255,0,16,128,0,0,23,129,255,2,56,
+    0,102,128,255,0,230,129,0,0,64,129,255,0,20,128,0,0,198,131,255,0,20,128,0,
+    132,255,130,0,0,236,128,255,1,113,207,130,255,1,217,119,128,255,0,227,129,0,0,55,
+    129,255,1,28,76,129,255,0,16,129,0,0,164,128,255,3,212,0,8,246,128,255,0,112,
+    129,0,0,128,128,255,2,127,0,100,128,255,1,251,3,128,0,0,64,133,255,0,79,129,
+    0,0,64,129,255,0,20,128,0,0,64,129,255,0,16,128,0,0,64,129,255,0,20,129,
+    0,4,118,200,174,20,150,128,255,1,248,1,129,0,0,64,129,255,0,144,129,255,0,161,
+    129,0,0,42,135,255,0,16,132,0,0,64,129,255,0,20,130,0,0,171,131,255,0,16,
+    137,0,4,96,255,253,205,16,131,0,2,31,255,47,132,0,1,94,238,134,0,128,255,0,
+    92,132,0,2,64,255,20,128,0,2,64,255,20,130,0,1,135,215,129,0,7,8,239,116,
+    154,196,0,82,121,136,0,3,126,249,250,93,131,0,2,64,255,20,130,0,1,134,220,130,
+    0,11,179,154,0,5,248,55,60,253,12,0,162,167,132,0,2,64,255,16,130,0,2,64,
+    255,20,130,0,2,64,255,16,128,0,5,1,214,255,201,112,33,133,0,2,80,253,18,128,
+    0,2,60,255,28,129,0,7,92,100,255,99,92,197,168,92,128,0,2,64,255,38,130,20,
+    0,15,130,0,5,29,246,55,64,255,16,131,0,4,139,242,31,243,107,131,0,2,64,255,
+    38,130,20,2,79,255,16,128,0,5,101,237,176,251,242,117,130,0,2,32,255,48,136,0,
+    2,64,255,38,130,20,0,5,128,0,0,227,140,255,0,226,128,0,2,64,255,28,128,0,
+    2,76,255,8,128,0,6,43,255,60,189,255,239,106,130,0,2,56,255,30,128,0,2,72,
+    255,16,131,0,1,152,194,130,0,2,64,255,20,129,0,5,165,202,45,64,229,149,136,0,
+    0,158,128,255,3,234,143,56,1,135,0,0,87,134,255,0,170,133,0,0,213,128,255,0,
+    72,130,0,0,64,131,255,1,248,92,129,255,0,16,130,0,0,45,128,255,0,237,130,0,
+    0,64,133,255,0,103,132,0,0,160,130,255,0,131,131,0,0,64,132,255,0,58,135,0,
+    0,169,131,255,0,141,135,0,0,64,129,255,0,16,131,0,0,64,129,255,0,163,130,0,
+    0,64,131,255,1,87,86,131,255,0,16,128,0,0,50,129,255,2,43,0,90,129,255,0,
+    7,128,0,0,64,129,255,0,20,133,0,0,64,129,255,0,20,128,0,0,31,129,255,2,
+    50,0,6,128,20,2,89,65,3,129,0,0,37,129,255,0,52,130,0,0,100,128,255,0,
+    238,129,0,0,64,133,255,1,238,23,128,0,0,102,132,255,1,212,10,132,0,0,64,129,
+    255,0,16,130,0,0,64,134,255,0,134,129,0,0,64,129,255,1,28,70,129,255,0,7,
+    128,0,0,234,134,255,0,234,128,0,1,4,234,131,255,2,218,113,2,130,0,0,44,133,
+    255,1,202,6,129,0,0,56,129,255,1,30,72,129,255,0,16,129,0,0,151,133,255,0,
+    16,131,0,0,168,128,255,0,213,130,0,0,64,129,255,0,20,128,0,0,85,128,255,0,
+    252,129,0,0,64,129,255,3,38,20,28,170,128,255,0,225,129,0,0,35,129,255,0,45,
+    129,0,2,4,50,8,131,0,0,52,131,255,0,184,131,0,0,209,132,255,0,179,130,0,
+    131,255,0,234,129,0,0,64,134,255,0,161,133,0,0,150,132,255,0,74,131,0,5,3,
+    44,48,0,29,231,128,255,0,208,129,0,0,64,129,255,3,38,20,36,174,128,255,0,228,
+    129,0,0,64,136,255,0,16,128,0,0,49,129,255,2,31,0,77,128,255,1,254,1,128,
+    0,0,64,129,255,0,20,128,0,2,141,252,212,129,255,0,20,128,0,131,255,0,234,130,
+    0,0,185,128,255,1,167,251,130,255,1,254,184,128,255,0,174,129,0,0,57,129,255,1,
+    30,69,129,255,0,16,129,0,0,89,129,255,1,26,71,129,255,0,36,130,0,4,24,46,
+    3,4,209,128,255,0,215,129,0,0,64,133,255,0,193,129,0,0,64,129,255,0,20,128,
+    0,0,64,129,255,0,16,128,0,0,64,129,255,0,20,131,0,1,103,254,129,255,0,176,
+    130,0,0,64,132,255,1,219,15,129,0,1,12,251,133,255,0,147,133,0,0,64,129,255,
+    0,20,129,0,0,59,132,255,0,16,136,0,1,2,148,128,255,0,59,132,0,2,53,255,
+    26,132,0,2,73,255,5,128,0,138,255,128,0,2,64,255,20,128,0,2,64,255,38,128,
+    20,3,36,108,246,108,130,0,6,114,255,248,66,0,185,18,136,0,3,11,244,227,1,131,
+    0,2,64,255,38,128,20,3,28,93,245,117,130,0,11,128,199,0,52,250,7,10,252,63,
+    0,209,114,132,0,2,64,255,16,130,0,2,64,255,20,130,0,2,64,255,16,129,0,1,
+    42,220,129,255,1,200,64,131,0,2,12,249,84,128,0,1,131,207,131,0,1,45,234,128,
+    0,1,197,86,129,0,0,64,132,255,0,192,130,0,5,165,169,0,64,255,16,131,0,4,
+    21,244,215,223,6,131,0,0,64,134,255,0,16,128,0,6,137,255,148,80,155,255,82,129,
+    0,2,52,255,28,128,0,0,4,130,20,0,1,128,0,0,64,132,255,0,64,128,0,1,
+    74,227,138,255,1,227,73,128,0,2,64,255,53,128,0,1,103,237,129,0,7,56,255,221,
+    146,83,164,255,69,129,0,2,29,255,59,128,0,2,97,255,16,130,0,2,3,233,101,130,
+    0,2,64,255,20,129,0,1,45,238,128,255,1,218,19,136,0,1,25,227,130,255,2,225,
+    136,34,133,0,0,180,134,255,1,247,15,132,0,0,157,128,255,0,128,130,0,0,64,132,
+    255,0,212,129,255,0,16,130,0,0,101,128,255,0,182,130,0,0,64,129,255,1,191,215,
+    128,255,0,192,132,0,0,35,129,255,1,250,14,131,0,0,64,132,255,0,100,135,0,1,
+    42,253,129,255,1,242,20,135,0,0,64,129,255,0,16,130,0,1,1,203,128,255,1,239,
+    23,130,0,0,64,131,255,1,154,155,131,255,0,16,128,0,1,12,252,128,255,2,168,35,
+    199,129,255,0,13,128,0,0,64,129,255,0,20,133,0,0,64,129,255,0,20,128,0,0,
+    52,129,255,2,28,19,235,130,255,1,211,2,128,0,0,55,129,255,0,28,130,0,0,74,
+    128,255,1,254,5,128,0,0,64,134,255,0,64,128,0,0,138,133,255,0,125,132,0,0,
+    64,129,255,0,16,130,0,0,64,134,255,0,192,129,0,0,64,129,255,1,57,108,128,255,
+    0,240,129,0,1,39,126,128,255,1,239,223,128,255,1,144,38,129,0,0,102,129,255,1,
+    247,248,128,255,1,177,3,129,0,0,56,134,255,0,114,129,0,0,32,129,255,1,65,103,
+    129,255,0,16,128,0,1,1,236,128,255,1,182,217,129,255,0,16,130,0,1,8,243,128,
+    255,0,118,130,0,0,64,129,255,0,20,128,0,0,70,129,255,0,9,128,0,0,64,135,
+    255,0,141,129,0,0,55,129,255,0,26,137,0,1,1,232,130,255,0,111,131,0,0,167,
+    132,255,0,147,130,0,0,103,129,255,1,102,38,129,0,0,64,134,255,0,167,133,0,0,
+    223,128,255,1,191,252,128,255,0,153,134,0,1,10,207,129,255,0,100,129,0,0,64,135,
+    255,0,149,129,0,0,64,136,255,0,16,128,0,0,59,129,255,2,22,0,67,129,255,0,
+    10,128,0,0,64,129,255,0,20,128,0,2,3,19,64,129,255,0,20,128,0,0,103,129,
+    255,1,102,38,130,0,0,134,138,255,0,120,129,0,0,36,129,255,1,59,105,129,255,0,
+    16,129,0,1,18,252,128,255,1,95,143,128,255,0,217,134,0,0,139,129,255,0,126,129,
+    0,0,64,129,255,1,182,166,128,255,1,246,1,128,0,0,64,129,255,0,20,128,0,0,
+    64,129,255,0,16,128,0,0,64,129,255,0,20,131,0,0,170,130,255,1,210,5,129,0,
+    0,64,131,255,1,244,44,131,0,0,173,133,255,3,176,232,220,97,130,0,0,64,129,255,
+    0,20,128,0,1,1,201,128,255,0,245,129,255,0,16,136,0,7,122,251,115,248,203,2,
+    72,58,129,0,2,57,255,25,132,0,2,72,255,7,128,0,138,255,128,0,2,64,255,20,
+    128,0,0,64,131,255,2,252,152,4,131,0,9,39,25,0,52,150,0,66,221,198,31,132,
+    0,0,74,128,255,0,61,131,0,0,64,131,255,2,246,141,2,130,0,4,77,243,1,106,
+    204,128,0,4,209,116,6,250,60,132,0,2,64,255,16,130,0,2,64,255,20,130,0,2,
+    64,255,15,130,0,6,5,86,176,246,255,253,74,131,0,1,187,153,128,0,1,203,131,131,
+    0,1,84,195,128,0,1,236,47,129,0,2,64,255,82,130,68,0,51,129,0,6,53,248,
+    34,0,64,255,16,132,0,2,137,255,95,132,0,2,64,255,82,130,68,2,115,255,16,128,
+    0,1,69,105,129,0,1,172,203,129,0,2,55,255,25,128,0,0,56,130,255,0,16,128,
+    0,2,64,255,82,130,68,0,17,129,0,0,50,138,80,0,50,129,0,2,64,255,133,128,
+    0,1,188,176,129,0,2,61,255,140,129,0,1,183,193,130,0,1,222,146,128,0,2,176,
+    255,16,130,0,2,60,253,21,130,0,2,64,255,20,128,0,7,1,220,250,131,82,162,228,
+    39,136,0,2,24,157,247,130,255,2,252,135,1,130,0,1,21,251,135,255,0,100,132,0,
+    0,101,128,255,0,184,130,0,0,64,129,255,0,211,132,255,0,16,130,0,0,157,128,255,
+    0,126,130,0,0,64,129,255,1,66,109,128,255,0,244,132,0,0,112,130,255,0,94,131,
+    0,0,64,132,255,1,230,11,135,0,0,167,129,255,0,128,136,0,0,64,129,255,0,16,
+    130,0,0,90,129,255,0,106,131,0,0,64,131,255,1,222,224,131,255,0,16,129,0,0,
+    180,134,255,0,9,128,0,0,64,129,255,0,20,133,0,0,64,129,255,0,20,128,0,0,
+    54,129,255,1,25,56,132,255,0,16,128,0,0,58,129,255,0,24,130,0,0,71,129,255,
+    0,8,128,0,0,64,133,255,1,254,36,128,0,0,144,128,255,2,209,82,213,128,255,0,
+    217,132,0,0,64,129,255,0,16,130,0,0,64,134,255,0,162,129,0,0,64,129,255,1,
+    180,215,128,255,0,187,129,0,1,1,98,128,255,1,202,238,128,255,1,66,1,130,0,1,
+    105,240,128,255,0,252,129,255,0,120,129,0,0,61,129,255,2,197,84,220,128,255,0,209,
+    129,0,1,1,233,128,255,1,190,208,129,255,0,16,128,0,0,35,129,255,1,59,112,129,
+    255,0,16,130,0,0,70,129,255,0,31,130,0,0,64,129,255,0,20,128,0,0,74,129,
+    255,0,5,128,0,0,64,134,255,1,235,26,129,0,0,53,129,255,0,26,138,0,0,159,
+    130,255,0,38,130,0,1,2,238,133,255,0,82,129,0,0,64,129,255,0,16,130,0,0,
+    64,135,255,0,97,131,0,0,42,129,255,1,130,211,128,255,1,231,1,133,0,0,133,129,
+    255,1,184,2,129,0,0,64,134,255,1,235,25,129,0,0,64,136,255,0,16,128,0,0,
+    60,129,255,2,22,0,68,129,255,0,10,128,0,0,64,129,255,0,20,130,0,0,64,129,
+    255,0,20,128,0,0,64,129,255,0,16,131,0,0,83,131,255,1,211,216,131,255,0,67,
+    129,0,1,2,238,128,255,1,182,211,129,255,0,16,130,0,0,196,128,255,1,164,214,128,
+    255,0,141,133,0,0,100,129,255,1,238,21,129,0,0,64,129,255,1,44,70,129,255,0,
+    11,128,0,0,64,129,255,0,20,128,0,0,64,129,255,0,15,128,0,0,64,129,255,0,
+    20,131,0,0,168,131,255,0,121,129,0,0,64,131,255,0,92,132,0,1,23,210,128,255,
+    0,250,133,255,0,72,129,0,0,64,129,255,0,20,128,0,0,90,129,255,0,143,129,255,
+    0,17,129,0,2,61,92,45,129,0,8,8,240,132,0,127,255,110,196,165,129,0,2,36,
+    255,47,132,0,1,94,243,129,0,131,80,128,255,0,143,130,80,128,0,2,64,255,20,128,
+    0,6,64,255,82,68,67,57,17,136,0,6,165,39,3,225,128,170,175,131,0,4,3,213,
+    182,220,198,131,0,7,64,255,82,69,100,232,172,4,131,0,4,25,255,33,160,150,128,0,
+    4,155,165,48,252,11,132,0,2,64,255,16,130,0,2,59,255,21,130,0,2,67,255,8,
+    133,0,3,11,102,241,209,131,0,5,112,222,0,20,253,56,130,0,7,20,132,165,20,36,
+    255,30,20,128,0,2,64,255,20,134,0,1,195,157,128,20,2,79,255,34,132,0,2,64,
+    255,20,132,0,2,64,255,20,130,0,2,64,255,16,133,0,2,89,247,1,128,0,2,34,
+    255,44,128,0,0,14,128,68,2,115,255,16,128,0,2,64,255,20,133,0,0,137,140,255,
+    0,136,128,0,6,64,255,245,128,157,253,58,129,0,2,53,255,48,129,0,1,93,242,130,
+    0,6,101,253,137,147,247,255,16,130,0,1,123,202,131,0,2,64,255,20,128,0,2,36,
+    255,116,129,0,1,168,188,138,0,3,14,94,175,245,129,255,0,102,130,0,0,110,136,255,
+    0,192,132,0,0,45,128,255,1,238,1,129,0,0,64,129,255,0,84,132,255,0,16,130,
+    0,0,213,128,255,0,69,130,0,0,64,129,255,1,30,75,129,255,0,8,130,0,1,17,
+    237,130,255,1,225,7,130,0,0,64,129,255,0,245,129,255,0,129,135,0,0,69,129,255,
+    0,26,134,0,2,17,6,64,129,255,0,16,129,0,1,7,223,128,255,1,203,2,131,0,
+    0,64,138,255,0,16,129,0,1,42,245,132,255,0,250,129,0,0,64,129,255,0,20,133,
+    0,0,64,129,255,0,20,128,0,0,33,129,255,2,45,29,253,131,255,0,16,128,0,0,
+    40,129,255,0,45,130,0,0,96,128,255,0,246,129,0,0,64,129,255,0,82,129,68,0,
+    38,129,0,5,12,103,133,30,0,95,129,255,0,6,131,0,0,64,129,255,0,16,130,0,
+    0,64,129,255,0,82,129,68,1,64,8,129,0,0,64,133,255,0,90,129,0,0,198,134,
+    255,0,197,128,0,6,34,127,143,57,101,187,251,129,255,0,217,129,0,0,53,129,255,2,
+    52,0,98,128,255,1,253,2,129,0,0,137,133,255,0,16,128,0,0,55,129,255,1,29,
+    72,129,255,0,16,130,0,0,131,128,255,0,211,131,0,0,64,129,255,0,20,128,0,0,
+    91,128,255,0,243,129,0,0,64,134,255,0,62,130,0,0,33,129,255,0,47,129,0,3,
+    39,207,169,60,131,0,0,85,129,255,0,220,131,0,0,39,129,255,2,179,82,214,128,255,
+    0,206,129,0,0,64,129,255,0,16,130,0,0,64,129,255,3,82,68,83,204,128,255,0,
+    212,131,0,0,117,134,255,0,55,132,0,1,3,233,128,255,1,219,17,130,0,0,64,132,
+    255,2,254,189,40,130,0,0,64,129,255,0,82,128,68,0,115,129,255,0,16,128,0,0,
+    50,129,255,2,31,0,76,128,255,1,254,1,128,0,0,64,129,255,0,20,130,0,0,64,
+    129,255,0,20,128,0,0,64,129,255,0,16,131,0,0,32,131,255,1,157,162,130,255,1,
+    254,16,130,0,0,147,133,255,0,15,130,0,0,121,132,255,0,65,132,0,1,77,252,129,
+    255,0,85,130,0,0,64,129,255,1,21,64,129,255,0,16,128,0,0,58,129,255,0,21,
+    128,0,0,67,129,255,0,8,128,0,0,64,129,255,0,20,131,0,3,28,91,84,211,128,
+    255,0,222,129,0,0,64,131,255,0,113,133,0,3,3,53,43,196,133,255,0,187,129,0,
+    0,64,129,255,0,20,128,0,0,220,133,255,0,212,128,0,0,42,128,255,1,244,9,128,
+    0,8,49,255,38,0,7,217,243,253,95,129,0,2,1,240,99,132,0,1,148,195,134,0,
+    128,255,0,92,132,0,2,64,255,20,128,0,2,64,255,20,139,0,7,29,175,0,39,255,
+    31,80,244,131,0,5,104,254,51,93,255,81,130,0,2,64,255,20,128,0,2,53,252,123,
+    132,0,3,230,76,213,96,128,0,3,101,213,95,210,133,0,2,64,255,16,130,0,2,45,
+    255,33,130,0,1,81,250,129,0,1,95,105,131,0,2,108,254,6,130,0,5,37,255,36,
+    91,234,2,130,0,134,255,128,0,2,64,255,20,134,0,133,255,132,0,2,64,255,20,132,
+    0,2,64,255,20,130,0,2,64,255,16,133,0,2,73,255,9,128,0,2,5,241,92,131,
+    0,2,64,255,16,128,0,2,64,255,20,133,0,0,243,140,255,0,243,128,0,5,64,255,
+    99,231,229,91,130,0,2,28,255,30,129,0,2,72,255,8,130,0,5,123,238,216,102,255,
+    16,130,0,1,184,143,131,0,2,64,255,20,128,0,2,58,255,36,129,0,2,83,250,4,
+    140,0,4,11,101,246,255,208,130,0,0,202,136,255,1,254,31,131,0,1,2,242,128,255,
+    0,40,129,0,0,64,129,255,1,20,190,131,255,0,16,129,0,0,14,129,255,0,15,130,
+    0,0,64,129,255,1,25,76,129,255,0,7,130,0,0,142,132,255,0,115,130,0,0,64,
+    129,255,1,55,231,128,255,1,245,26,134,0,0,64,129,255,0,20,132,0,4,18,213,255,
+    225,69,129,255,0,13,129,0,0,116,129,255,0,51,132,0,0,64,129,255,0,253,130,255,
+    0,254,129,255,0,16,129,0,1,36,158,132,255,0,224,129,0,0,64,129,255,0,20,133,
+    0,0,64,129,255,0,20,128,0,1,7,246,128,255,4,99,0,36,68,115,129,255,0,16,
+    128,0,1,5,247,128,255,0,112,130,0,0,157,128,255,0,201,129,0,0,64,129,255,0,
+    20,133,0,5,102,209,219,56,0,73,129,255,0,14,131,0,0,64,129,255,0,16,130,0,
+    0,64,129,255,0,20,134,0,0,64,132,255,1,184,1,129,0,136,255,128,0,0,176,128,
+    255,0,172,128,0,1,20,165,128,255,1,253,5,128,0,0,32,129,255,2,29,0,72,129,
+    255,0,9,129,0,1,15,217,132,255,0,16,128,0,0,51,129,255,1,29,72,129,255,0,
+    16,130,0,0,190,128,255,0,149,131,0,0,64,129,255,0,20,128,0,0,138,128,255,0,
+    213,129,0,0,64,129,255,1,83,138,129,255,0,171,130,0,1,6,246,128,255,0,98,129,
+    0,0,143,128,255,0,233,131,0,1,15,254,128,255,0,147,131,0,0,58,129,255,2,36,
+    0,87,128,255,1,250,3,128,0,0,64,129,255,0,16,130,0,0,64,129,255,0,20,128,
+    0,0,88,128,255,1,252,4,130,0,0,191,134,255,0,134,132,0,0,38,129,255,0,69,
+    131,0,0,64,129,255,3,82,67,57,21,132,0,0,64,129,255,0,20,128,0,0,64,129,
+    255,0,16,128,0,0,28,129,255,2,55,0,100,128,255,0,229,129,0,0,64,129,255,0,
+    20,130,0,0,64,129,255,0,20,128,0,0,64,129,255,0,16,132,0,0,236,130,255,1,
+    103,108,130,255,0,217,131,0,1,36,242,132,255,0,9,130,0,0,46,131,255,1,240,5,
+    131,0,1,44,244,129,255,0,141,131,0,0,64,129,255,1,20,64,129,255,0,16,128,0,
+    0,45,129,255,0,33,128,0,0,83,128,255,0,250,129,0,0,64,129,255,0,20,128,0,
+    3,16,176,232,177,128,0,0,81,129,255,0,7,128,0,0,64,131,255,1,232,10,134,0,
+    0,47,134,255,0,241,129,0,0,64,129,255,0,20,128,0,135,255,128,0,0,64,129,255,
+    0,20,128,0,2,46,255,36,128,0,3,65,255,248,11,130,0,1,160,196,129,0,4,145,
+    66,11,235,119,134,0,128,255,0,92,137,0,2,64,255,20,139,0,8,138,67,0,57,255,
+    19,68,255,9,129,0,7,13,233,166,0,2,210,215,3,129,0,2,64,255,20,129,0,2,
+    152,248,38,131,0,3,179,124,252,43,128,0,3,48,249,142,157,133,0,2,64,255,16,130,
+    0,2,11,254,69,130,0,1,120,211,129,0,2,167,225,1,130,0,2,77,250,2,131,0,
+    3,218,103,159,160,131,0,5,68,224,117,68,147,194,128,68,128,0,2,64,255,20,134,0,
+    130,68,2,115,255,79,132,0,2,64,255,20,132,0,2,64,255,20,130,0,2,64,255,16,
+    128,0,1,167,134,129,0,1,105,233,130,0,1,170,182,131,0,2,64,255,16,128,0,2,
+    64,255,20,133,0,142,255,128,0,2,64,255,20,133,0,2,1,239,68,129,0,1,103,239,
+    134,0,2,64,255,16,130,0,1,230,93,131,0,2,64,255,20,128,0,2,49,255,43,129,
+    0,2,86,254,5,133,0,3,16,99,147,17,131,0,2,129,255,246,129,0,0,39,138,255,
+    0,122,132,0,0,189,128,255,0,96,129,0,0,64,129,255,1,20,61,131,255,0,16,129,
+    0,0,69,128,255,0,213,131,0,0,64,129,255,1,53,110,128,255,0,240,130,0,1,35,
+    249,128,255,1,214,235,128,255,1,237,15,129,0,0,64,129,255,1,20,107,129,255,0,158,
+    134,0,0,64,129,255,0,20,132,0,0,52,129,255,0,101,128,255,1,254,4,128,0,1,
+    18,240,128,255,0,147,133,0,0,64,129,255,0,204,130,255,0,204,129,255,0,16,128,0,
+    1,3,242,128,255,2,92,52,190,128,255,0,177,129,0,0,64,129,255,0,20,133,0,4,
+    19,225,255,198,1,129,0,0,181,128,255,1,212,11,128,0,0,86,129,255,0,16,129,0,
+    0,180,128,255,1,228,15,128,0,1,40,247,128,255,0,130,129,0,0,64,129,255,0,20,
+    133,0,0,207,128,255,2,152,0,115,128,255,1,244,1,131,0,0,64,129,255,0,16,130,
+    0,0,64,129,255,0,20,134,0,0,64,130,255,2,236,144,9,130,0,0,227,134,255,0,
+    226,128,0,0,170,128,255,1,235,11,128,0,0,80,128,255,1,249,2,128,0,1,3,247,
+    128,255,2,80,0,112,128,255,0,242,131,0,2,24,168,242,130,255,0,16,128,0,0,24,
+    129,255,1,59,104,129,255,0,16,130,0,0,233,128,255,0,96,131,0,0,64,129,255,0,
+    20,128,0,0,211,128,255,0,151,129,0,0,64,129,255,2,20,0,190,129,255,0,67,130,
+    0,0,185,128,255,4,199,2,0,9,225,128,255,0,196,131,0,1,16,254,128,255,0,70,
+    131,0,0,50,129,255,2,48,0,87,129,255,0,5,128,0,0,64,129,255,0,16,130,0,
+    0,64,129,255,0,20,128,0,0,82,128,255,1,251,3,129,0,1,14,250,134,255,0,214,
+    132,0,0,60,129,255,0,25,131,0,0,64,129,255,0,20,135,0,0,64,129,255,0,20,
+    128,0,0,64,129,255,0,16,128,0,1,2,244,128,255,2,109,0,155,128,255,0,188,129,
+    0,0,64,129,255,0,20,130,0,0,64,129,255,0,20,128,0,0,64,129,255,0,16,132,
+    0,0,185,130,255,1,50,55,130,255,0,164,130,0,1,27,249,128,255,0,245,129,255,0,
+    249,132,0,0,226,130,255,0,170,131,0,1,4,210,129,255,1,180,2,131,0,0,64,129,
+    255,1,20,64,129,255,0,16,128,0,0,13,129,255,0,79,128,0,0,128,128,255,0,215,
+    129,0,0,64,129,255,0,20,128,0,0,67,129,255,2,39,0,98,128,255,1,253,2,128,
+    0,0,64,132,255,0,118,134,0,0,161,128,255,0,151,132,255,0,8,128,0,0,64,129,
+    255,0,20,128,0,0,227,133,255,0,238,128,0,0,19,129,255,0,14,128,0,2,8,241,
+    111,128,0,0,89,128,255,0,94,130,0,9,39,250,120,0,1,177,254,206,238,20,134,0,
+    128,255,0,92,137,0,2,64,255,20,138,0,1,12,193,128,0,4,37,255,38,89,244,130,
+    0,2,134,249,33,128,0,2,77,255,102,129,0,2,64,255,20,129,0,2,25,245,167,131,
+    0,3,128,208,243,2,128,0,3,4,246,214,104,133,0,2,64,255,16,131,0,1,201,174,
+    129,0,2,8,210,143,129,0,2,94,255,108,130,0,1,164,185,132,0,3,143,166,223,85,
+    131,0,5,3,247,30,0,147,134,130,0,2,64,255,20,138,0,2,64,255,16,132,0,2,
+    64,255,20,132,0,2,64,255,20,130,0,2,64,255,16,128,0,6,154,224,7,0,4,206,
+    161,130,0,2,48,253,93,129,0,3,8,168,255,16,128,0,2,64,255,20,133,0,142,255,
+    128,0,2,64,255,20,134,0,6,162,186,2,0,4,206,169,134,0,2,64,255,16,129,0,
+    2,13,255,58,131,0,2,64,255,20,128,0,2,6,240,137,129,0,1,175,205,134,0,0,
+    27,128,255,0,81,131,0,2,112,255,240,129,0,0,132,131,255,1,245,176,131,255,0,215,
+    132,0,0,133,128,255,0,152,129,0,0,64,129,255,2,20,0,187,130,255,0,16,129,0,
+    0,125,128,255,0,156,131,0,0,64,129,255,1,181,214,128,255,0,187,130,0,0,172,129,
+    255,1,62,112,129,255,0,135,129,0,0,64,129,255,2,20,5,221,128,255,1,253,47,133,
+    0,0,64,129,255,0,20,132,0,0,27,129,255,0,194,128,255,0,227,129,0,0,142,129,
+    255,0,107,130,92,0,38,128,0,0,64,129,255,0,136,130,255,0,135,129,255,0,16,129,
+    0,0,230,128,255,1,176,131,129,255,0,99,129,0,0,64,129,255,0,160,129,152,1,121,
+    1,129,0,2,61,92,45,130,0,0,84,129,255,3,204,110,132,242,129,255,0,16,129,0,
+    0,70,129,255,3,212,115,126,232,128,255,1,248,32,129,0,0,64,129,255,0,20,133,0,
+    0,160,128,255,2,241,113,234,128,255,0,184,132,0,0,64,129,255,0,16,130,0,0,64,
+    129,255,0,104,130,92,1,88,18,128,0,0,64,129,255,0,20,133,0,1,27,254,128,255,
+    0,203,128,255,2,164,68,21,128,0,0,114,129,255,3,207,108,110,220,128,255,0,201,130,
+    0,0,178,128,255,2,228,110,234,128,255,0,180,134,0,0,64,129,255,0,16,128,0,1,
+    2,238,128,255,1,186,211,129,255,0,16,129,0,0,15,129,255,0,60,131,0,0,64,129,
+    255,2,104,99,168,129,255,0,73,129,0,0,64,129,255,3,20,0,51,254,128,255,0,198,
+    130,0,0,94,129,255,2,178,106,190,129,255,0,109,129,0,2,1,162,190,128,255,1,240,
+    5,131,0,1,10,250,128,255,2,200,104,219,128,255,0,216,129,0,0,61,129,255,1,112,
+    43,129,0,0,64,129,255,3,104,92,101,208,128,255,0,212,130,0,0,84,129,255,0,124,
+    128,80,0,178,129,255,0,37,131,0,0,25,129,255,0,3,131,0,0,64,129,255,0,20,
+    135,0,0,64,129,255,0,20,128,0,0,64,129,255,0,16,129,0,0,181,128,255,2,232,
+    115,249,128,255,0,121,129,0,0,64,129,255,0,20,130,0,0,64,129,255,0,20,128,0,
+    0,64,129,255,0,16,132,0,0,134,129,255,3,247,5,7,249,129,255,0,111,130,0,0,
+    38,129,255,1,110,194,128,255,0,212,132,0,0,152,130,255,0,94,131,0,0,94,130,255,
+    0,103,128,92,0,43,129,0,0,64,129,255,1,20,64,129,255,0,16,129,0,0,212,128,
+    255,3,220,106,121,238,128,255,0,157,129,0,0,64,129,255,0,20,128,0,0,25,129,255,
+    2,189,108,231,128,255,0,203,129,0,0,64,129,255,0,231,128,255,1,235,12,132,0,0,
+    24,129,255,0,44,131,255,0,242,129,0,0,64,129,255,0,20,128,0,0,22,129,68,0,
+    115,129,255,0,37,128,0,0,37,129,255,130,0,8,127,245,120,140,250,192,180,246,56,130,
+    0,8,97,253,183,105,111,230,255,188,7,134,0,128,255,0,92,132,0,2,23,92,7,128,
+    0,2,64,255,20,138,0,1,110,97,128,0,4,2,225,168,198,176,129,0,2,30,247,144,
+    130,0,2,196,229,10,128,0,2,64,255,20,130,0,2,137,253,44,130,0,2,77,255,192,
+    130,0,2,197,255,51,133,0,2,64,255,16,131,0,7,76,254,180,103,121,210,234,29,129,
+    0,8,4,190,255,176,105,111,187,246,49,132,0,3,68,242,250,14,131,0,5,39,242,1,
+    0,191,91,130,0,2,64,255,104,131,92,0,69,132,0,2,64,255,16,132,0,2,64,255,
+    20,132,0,2,64,255,20,130,0,2,64,255,16,128,0,6,38,248,190,107,189,248,41,131,
+    0,8,115,254,166,101,121,219,255,140,1,128,0,2,64,255,20,133,0,0,227,140,255,0,
+    226,128,0,2,64,255,20,134,0,6,37,242,187,108,189,250,47,134,0,2,64,255,16,129,
+    0,2,41,255,32,131,0,2,64,255,20,129,0,6,114,255,159,105,178,254,75,135,0,3,
+    210,255,212,10,129,0,3,7,208,255,189,128,0,1,1,223,131,255,1,170,79,132,255,0,
+    52,131,0,0,77,128,255,0,208,129,0,0,64,129,255,4,20,0,57,255,241,128,255,0,
+    16,129,0,0,181,128,255,0,100,131,0,0,64,133,255,0,90,129,0,0,59,129,255,3,
+    179,0,7,224,128,255,1,246,26,128,0,0,64,129,255,2,20,0,91,129,255,0,187,133,
+    0,0,64,129,255,0,20,132,0,1,1,230,131,255,0,163,129,0,0,245,134,255,0,233,
+    128,0,0,64,129,255,0,68,129,255,1,248,73,129,255,0,16,129,0,0,161,132,255,1,
+    229,7,129,0,0,64,134,255,0,55,128,0,0,42,128,255,1,244,9,130,0,0,189,134,
+    255,1,220,2,130,0,0,169,134,255,0,126,130,0,0,64,129,255,0,20,133,0,0,70,
+    133,255,0,80,132,0,0,64,129,255,0,16,130,0,0,64,135,255,0,169,128,0,0,64,
+    129,255,0,20,133,0,0,42,128,255,1,245,196,128,255,0,94,130,0,1,17,236,134,255,
+    0,89,130,0,0,67,133,255,0,78,134,0,0,64,129,255,0,16,129,0,0,146,133,255,
+    0,16,129,0,0,41,129,255,0,32,131,0,0,64,134,255,0,203,130,0,0,64,129,255,
+    0,20,128,0,0,172,129,255,0,74,129,0,1,3,215,133,255,1,224,10,129,0,0,45,
+    130,255,0,158,133,0,0,160,133,255,0,116,129,0,0,42,130,255,0,228,129,0,0,64,
+    135,255,0,113,130,0,0,158,128,255,1,244,8,128,0,0,73,129,255,0,116,131,0,0,
+    42,128,255,1,249,9,131,0,0,64,129,255,0,20,135,0,0,64,129,255,0,20,128,0,
+    0,64,129,255,0,16,129,0,0,77,132,255,1,248,27,129,0,0,64,129,255,0,20,130,
+    0,0,64,129,255,0,20,128,0,0,64,129,255,0,16,132,0,0,83,129,255,0,199,128,
+    0,0,204,129,255,0,58,130,0,1,4,240,132,255,0,129,132,0,0,77,129,255,1,254,
+    21,131,0,0,189,133,255,1,242,6,128,0,0,64,129,255,1,20,64,129,255,0,16,129,
+    0,0,116,134,255,0,51,129,0,0,64,129,255,0,20,129,0,0,182,133,255,0,91,129,
+    0,0,64,129,255,0,106,129,255,0,123,132,0,0,132,128,255,2,123,7,244,130,255,0,
+    191,129,0,0,64,129,255,0,20,132,0,0,64,129,255,0,16,128,0,0,40,128,255,0,
+    131,130,0,8,4,141,238,240,153,12,18,197,33,131,0,8,65,188,241,239,188,101,223,210,
+    24,133,0,128,255,0,92,132,0,2,64,255,20,128,0,2,64,255,20,137,0,2,2,198,
+    7,129,0,3,69,228,206,34,129,0,2,164,241,20,130,0,2,60,255,122,128,0,2,64,
+    255,20,130,0,2,18,240,174,130,0,2,26,255,138,130,0,2,143,248,5,133,0,2,64,
+    255,16,132,0,5,78,201,247,236,176,41,131,0,6,7,127,217,249,236,177,47,133,0,2,
+    6,243,189,132,0,1,82,201,128,0,1,234,49,130,0,0,64,133,255,0,192,132,0,2,
+    64,255,16,132,0,2,64,255,20,132,0,2,64,255,20,130,0,2,64,255,16,129,0,4,
+    60,201,246,209,68,133,0,5,76,194,241,238,179,62,130,0,2,64,255,20,133,0,1,74,
+    227,138,255,1,227,73,128,0,2,64,255,20,135,0,4,53,199,247,210,70,135,0,2,64,
+    255,16,129,0,2,56,255,21,131,0,2,64,255,20,130,0,4,106,222,250,209,77,136,0,
+    0,92,128,255,4,223,121,89,115,215,128,255,0,79,128,0,0,46,132,255,2,86,7,240,
+    131,255,0,129,131,0,0,21,128,255,1,254,8,128,0,0,64,129,255,0,20,128,0,0,
+    184,129,255,0,16,129,0,0,233,128,255,0,44,131,0,0,64,132,255,1,184,1,129,0,
+    0,192,128,255,1,253,43,128,0,0,96,129,255,0,147,128,0,0,64,129,255,3,20,0,
+    2,209,129,255,0,64,132,0,0,64,129,255,0,20,133,0,0,112,130,255,1,248,47,129,
+    0,136,255,128,0,0,64,129,255,1,21,234,128,255,1,188,64,129,255,0,16,129,0,1,
+    34,237,130,255,1,247,60,130,0,0,64,134,255,0,64,128,0,4,64,255,145,255,20,130,
+    0,1,16,200,132,255,1,202,29,131,0,1,11,193,132,255,1,156,1,130,0,0,64,129,
+    255,0,20,134,0,0,162,131,255,0,166,133,0,0,64,129,255,0,16,130,0,0,64,135,
+    255,0,192,128,0,0,64,129,255,0,20,133,0,0,84,128,255,1,204,236,128,255,0,52,
+    131,0,1,62,241,132,255,0,149,132,0,0,146,131,255,0,168,135,0,0,64,129,255,0,
+    16,129,0,1,19,222,132,255,0,16,129,0,0,56,129,255,0,21,131,0,0,64,133,255,
+    1,237,44,130,0,0,64,129,255,0,20,128,0,1,41,252,128,255,0,191,130,0,1,47,
+    237,131,255,1,237,50,130,0,0,28,129,255,1,249,41,133,0,1,19,216,131,255,1,187,
+    4,129,0,1,3,216,130,255,0,25,128,0,0,64,134,255,1,191,4,130,0,0,227,128,
+    255,0,171,129,0,1,5,239,128,255,0,190,131,0,4,64,255,145,255,20,131,0,0,64,
+    129,255,0,20,135,0,0,64,129,255,0,20,128,0,0,64,129,255,0,16,130,0,0,165,
+    131,255,0,111,130,0,0,64,129,255,0,20,130,0,0,64,129,255,0,20,128,0,0,64,
+    129,255,0,16,132,0,0,32,129,255,0,145,128,0,0,150,128,255,1,251,9,131,0,0,
+    112,131,255,1,215,16,132,0,1,10,248,128,255,0,199,132,0,0,239,134,255,0,16,128,
+    0,0,64,129,255,1,20,64,129,255,0,16,129,0,1,7,192,132,255,0,123,130,0,0,
+    64,129,255,0,20,129,0,1,34,234,131,255,0,155,130,0,0,64,129,255,1,21,211,128,
+    255,0,241,132,0,0,236,128,255,2,19,0,139,130,255,0,76,129,0,0,64,129,255,0,
+    20,132,0,0,64,129,255,0,16,129,0,2,104,117,3,137,0,0,1,138,0,2,19,145,
+    7,133,0,128,255,0,92,255,0,255,0,161,0,0,153,133,255,0,134,129,0,0,43,131,
+    255,3,239,11,0,153,131,255,0,126,132,0,2,175,255,201,129,0,4,19,225,255,198,1,
+    128,0,4,48,238,255,195,1,129,0,3,174,255,196,2,131,0,1,19,225,128,255,3,240,
+    237,145,9,130,0,0,154,128,255,0,139,129,0,4,2,191,255,251,117,128,0,4,19,225,
+    255,198,1,128,0,4,65,244,255,231,50,132,0,4,19,225,255,198,1,134,0,4,121,226,
+    249,204,66,130,0,0,181,134,255,0,180,128,0,13,19,225,255,198,1,128,253,247,87,19,
+    225,255,195,1,130,0,5,39,179,243,236,179,47,131,0,1,19,225,132,255,1,225,18,128,
+    0,4,19,225,255,198,1,131,0,7,6,105,202,241,239,190,95,2,133,0,6,3,108,204,
+    243,238,189,82,132,0,4,19,225,255,198,1,134,0,6,3,120,220,249,219,120,3,133,0,
+    4,19,225,255,195,1,130,0,1,19,225,133,255,1,252,119,128,0,4,19,225,255,198,1,
+    133,0,7,44,234,255,115,175,255,209,6,132,0,6,33,150,222,249,236,189,84,134,0,5,
+    103,211,247,221,121,3,135,0,4,19,225,255,195,1,130,0,3,28,175,243,235,128,255,1,
+    195,1,129,0,4,19,225,255,195,1,131,0,1,19,225,129,255,3,250,221,147,29,131,0,
+    4,19,225,255,198,1,129,0,3,139,253,255,152,131,0,6,25,143,217,248,229,156,30,132,
+    0,3,144,245,220,75,135,0,6,17,145,228,250,218,121,6,131,0,1,37,183,128,243,1,
+    187,5,128,0,1,19,225,130,255,3,243,211,125,6,131,0,3,174,255,244,67,130,0,3,
+    127,253,255,141,131,0,4,19,225,255,198,1,131,0,4,19,225,255,198,1,135,0,4,19,
+    225,255,198,1,128,0,4,19,225,255,195,1,130,0,5,3,119,222,247,209,89,131,0,4,
+    19,225,255,198,1,130,0,4,19,225,255,198,1,128,0,4,19,225,255,195,1,133,0,3,
+    189,255,241,59,128,0,3,62,242,255,161,133,0,5,96,212,249,228,149,22,134,0,3,147,
+    254,249,92,132,0,0,181,133,255,1,195,1,128,0,9,19,225,255,198,1,19,225,255,195,
+    1,130,0,6,7,118,210,246,237,193,77,131,0,4,19,225,255,198,1,130,0,5,31,162,
+    236,248,208,102,131,0,8,19,225,255,198,1,72,246,255,199,132,0,2,193,255,128,128,0,
+    4,5,146,242,231,105,130,0,4,19,225,255,198,1,132,0,4,19,225,255,195,1,255,0,
+    255,0,205,0,6,86,188,238,251,233,177,69,131,0,1,129,240,128,255,1,220,76,128,0,
+    6,17,186,252,255,251,184,18,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,201,0,0,64,129,255,3,251,226,138,8,131,0,1,21,6,133,0,
+    5,92,204,244,218,125,6,129,0,0,64,129,255,3,254,230,137,4,134,0,2,26,255,179,
+    136,0,1,73,226,128,255,1,245,146,133,0,4,73,209,249,217,91,130,0,1,159,198,129,
+    0,2,49,255,27,130,0,4,102,224,242,172,27,132,0,4,70,211,247,197,44,130,0,134,
+    255,128,0,1,228,39,134,0,5,71,192,243,232,169,41,131,0,2,64,255,108,130,0,2,
+    64,255,16,128,0,3,64,255,246,7,130,0,3,3,239,255,16,130,0,2,14,246,6,128,
+    0,2,64,255,20,133,0,2,64,255,20,129,0,3,30,237,206,8,128,0,2,64,255,20,
+    133,0,2,64,255,20,137,0,2,64,255,16,129,0,5,3,128,229,237,133,2,130,0,2,
+    64,255,20,130,0,2,17,243,20,128,0,2,64,255,20,129,0,3,102,231,246,110,129,0,
+    6,2,141,240,214,85,255,16,129,0,4,49,194,248,229,120,135,0,2,64,255,16,128,0,
+    2,64,255,20,138,0,2,109,128,23,132,0,2,64,255,20,128,0,1,255,196,130,0,5,
+    82,203,243,235,165,30,130,0,6,10,121,210,243,238,191,65,130,0,128,20,142,0,128,20,
+    128,0,4,19,225,255,197,1,128,0,0,180,132,255,0,180,128,0,1,19,225,128,255,2,
+    245,225,112,129,0,1,19,225,128,255,8,212,246,212,96,101,213,248,215,95,132,0,5,14,
+    142,229,247,202,79,130,0,1,19,225,128,255,3,218,247,205,80,132,0,5,21,153,232,248,
+    195,58,132,0,5,38,167,227,246,208,92,132,0,6,12,137,225,248,210,103,1,130,0,1,
+    73,226,128,255,1,245,146,130,0,2,169,255,237,128,43,7,237,255,183,0,125,253,241,63,
+    128,0,9,103,250,255,181,0,77,248,255,187,1,128,0,1,73,226,128,255,2,245,255,245,
+    128,255,1,226,72,130,0,5,106,205,244,235,165,31,130,0,9,125,253,247,87,0,10,213,
+    255,213,8,128,0,9,19,225,255,197,1,19,225,255,194,1,129,0,1,73,226,128,255,1,
+    245,146,150,0,4,19,225,255,194,1,130,0,1,171,178,129,0,2,68,252,17,128,0,6,
+    64,244,57,208,248,183,26,129,0,2,64,255,20,128,0,2,64,255,16,130,0,4,95,218,
+    248,201,58,134,0,2,251,255,84,131,0,138,80,134,0,0,11,128,0,4,64,244,109,245,
+    189,128,0,0,11,136,0,4,100,222,247,185,34,130,0,5,49,194,244,231,134,2,129,0,
+    134,255,130,0,4,115,227,241,172,23,130,0,5,8,145,229,246,195,42,129,0,132,255,128,
+    0,1,223,118,128,0,2,119,255,21,128,0,1,221,100,128,0,2,64,255,20,128,0,2,
+    107,254,48,128,0,1,193,199,129,0,2,6,135,229,137,255,2,229,135,6,131,0,2,78,
+    127,68,131,0,11,64,240,54,203,247,201,42,50,202,245,192,34,131,0,2,64,255,16,130,
+    0,0,180,133,255,0,180,128,0,1,42,208,129,255,1,233,110,133,0,4,19,225,255,197,
+    1,130,0,128,255,2,92,0,92,128,255,129,0,128,255,0,92,130,0,2,19,127,8,130,
+    0,128,255,0,92,129,0,2,61,92,45,129,0,1,15,122,134,152,1,122,15,143,0,1,
+    19,225,129,255,1,194,1,128,0,1,73,226,128,255,1,245,146,129,0,4,19,225,255,197,
+    1,129,0,0,50,133,80,0,50,131,0,2,58,255,13,129,0,1,48,186,141,216,1,186,
+    47,130,0,1,9,3,129,0,1,4,3,128,0,133,255,131,0,7,64,255,104,92,97,135,
+    245,171,130,0,2,32,229,16,132,0,6,137,249,152,103,147,251,169,129,0,7,64,255,104,
+    92,96,133,246,128,134,0,3,100,246,247,11,135,0,0,227,131,255,0,62,131,0,6,54,
+    251,193,107,174,255,74,129,0,2,85,252,17,128,0,1,121,209,130,0,6,96,255,185,109,
+    192,216,9,130,0,6,41,248,173,103,202,229,12,129,0,131,92,2,95,242,223,128,0,1,
+    173,95,133,0,7,110,255,181,105,115,209,243,62,130,0,3,64,255,230,8,129,0,2,64,
+    255,16,128,0,0,64,128,255,0,64,130,0,0,56,128,255,0,16,130,0,1,69,199,129,
+    0,2,64,255,20,133,0,2,64,255,20,128,0,3,5,200,237,33,129,0,2,64,255,20,
+    133,0,2,64,255,20,137,0,2,64,255,16,129,0,5,116,250,132,126,247,113,130,0,2,
+    23,92,7,130,0,2,163,255,20,128,0,2,64,255,20,128,0,4,19,251,174,99,43,129,
+    0,6,115,251,128,161,242,255,16,128,0,6,21,236,211,109,151,254,91,134,0,2,64,255,
+    16,128,0,2,64,255,20,137,0,0,34,128,255,0,116,132,0,2,23,92,7,128,0,1,
+    255,196,129,0,7,88,255,250,208,225,255,224,11,128,0,8,2,192,255,236,205,235,255,250,
+    51,129,0,3,212,255,137,17,138,0,3,17,137,255,211,128,0,4,64,255,145,255,20,128,
+    0,134,255,128,0,0,64,131,255,0,222,129,0,0,64,138,255,0,90,130,0,1,11,204,
+    131,255,0,102,129,0,0,64,132,255,1,254,80,130,0,1,18,218,130,255,1,253,62,130,
+    0,1,40,243,131,255,0,99,130,0,1,10,203,131,255,0,156,130,0,0,227,131,255,0,
+    62,129,0,0,225,128,255,1,125,126,129,255,1,26,226,128,255,0,104,128,0,0,132,129,
+    255,1,83,222,128,255,1,227,1,128,0,0,227,135,255,0,226,129,0,0,119,131,255,1,
+    229,23,129,0,0,175,128,255,2,189,0,79,128,255,1,254,20,128,0,0,64,129,255,1,
+    20,64,129,255,0,16,129,0,0,227,131,255,0,62,130,0,7,54,163,225,249,231,174,87,
+    5,129,0,0,79,128,229,0,73,130,0,0,64,129,255,0,16,130,0,2,97,243,5,128,
+    0,1,140,196,129,0,6,64,250,230,134,114,243,175,129,0,2,64,255,20,128,0,2,64,
+    255,16,129,0,6,91,255,169,108,196,246,45,133,0,2,235,255,71,131,0,138,255,132,0,
+    2,4,105,231,128,0,4,64,252,225,107,97,128,0,2,231,105,4,133,0,6,91,251,143,
+    111,215,221,10,128,0,6,8,229,195,102,131,250,112,129,0,134,255,129,0,5,107,255,157,
+    109,226,187,130,0,5,137,233,116,113,230,205,129,0,130,92,1,221,195,128,0,1,163,173,
+    128,0,6,172,255,71,0,22,255,39,128,0,2,23,92,7,128,0,6,5,219,175,0,77,
+    255,57,129,0,0,136,141,255,0,135,130,0,4,33,253,255,248,18,130,0,11,64,248,233,
+    140,110,232,210,229,137,117,236,185,131,0,2,64,255,16,130,0,135,255,128,0,0,184,131,
+    255,1,254,51,131,0,1,52,181,129,255,1,138,33,129,0,128,255,2,92,0,92,128,255,
+    129,0,128,255,0,92,130,0,2,103,255,83,130,0,128,255,0,92,128,0,0,42,128,255,
+    1,244,9,128,0,0,186,136,255,0,184,128,0,6,4,120,218,249,223,147,42,131,0,0,
+    129,128,0,0,64,131,255,0,16,128,0,0,227,131,255,0,62,128,0,0,64,129,255,0,
+    20,128,0,0,137,135,255,0,136,129,0,4,92,50,247,19,80,128,0,0,213,143,255,0,
+    212,128,0,8,44,197,255,250,190,85,59,223,209,128,0,133,92,131,0,2,64,255,20,129,
+    0,2,68,255,64,129,0,2,64,255,16,131,0,2,60,254,73,129,0,2,92,255,77,128,
+    0,2,64,255,20,129,0,1,125,232,134,0,3,174,159,252,81,133,0,1,96,139,132,255,
+    2,205,130,22,129,0,2,172,218,5,128,0,1,176,205,129,0,2,15,251,84,128,0,1,
+    193,136,129,0,7,1,227,188,2,0,5,208,112,130,0,6,158,197,1,0,14,231,109,134,
+    0,2,110,255,77,128,0,1,117,151,132,0,2,49,252,114,129,0,3,3,165,228,11,129,
+    0,0,64,128,255,0,113,129,0,2,64,255,16,128,0,3,64,255,227,132,130,0,3,125,
+    237,255,16,130,0,1,125,143,129,0,2,64,255,20,133,0,2,64,255,20,128,0,2,145,
+    253,72,130,0,2,64,255,20,133,0,2,64,255,20,137,0,2,64,255,16,129,0,1,229,
+    128,128,0,1,124,227,136,0,0,133,128,255,0,20,128,0,2,64,255,20,128,0,2,56,
+    255,30,131,0,1,225,138,128,0,2,190,255,16,128,0,2,115,243,20,128,0,1,148,207,
+    134,0,2,64,255,16,128,0,2,64,255,20,137,0,0,126,128,255,0,209,137,0,1,40,
+    30,129,0,7,207,244,41,0,1,144,255,95,128,0,8,83,255,164,6,0,3,144,255,146,
+    129,0,129,255,2,238,118,8,134,0,2,8,118,238,129,255,128,0,0,42,128,255,1,244,
+    9,128,0,0,234,132,255,0,222,128,0,0,64,131,255,0,159,129,0,0,64,138,255,0,
+    205,130,0,0,131,132,255,1,245,24,128,0,0,64,133,255,0,200,130,0,0,145,132,255,
+    0,213,130,0,0,164,132,255,0,217,130,0,0,133,133,255,0,79,129,0,132,255,0,92,
+    129,0,0,169,128,255,1,180,179,129,255,0,103,129,255,0,46,128,0,1,18,240,132,255,
+    0,93,129,0,137,255,128,0,1,10,248,132,255,0,132,129,0,0,106,128,255,2,248,10,
+    151,128,255,0,205,129,0,0,64,129,255,1,20,64,129,255,0,16,129,0,132,255,0,92,
+    129,0,1,128,253,132,255,4,225,108,11,95,252,128,255,0,218,130,0,0,64,129,255,0,
+    16,130,0,2,23,254,63,128,0,1,211,122,129,0,2,64,255,112,128,0,2,118,248,1,
+    128,0,2,64,255,20,128,0,2,64,255,16,129,0,1,221,170,128,0,2,6,212,172,130,
+    0,8,94,25,0,212,255,44,4,89,26,128,0,138,255,130,0,4,1,85,218,255,176,128,
+    0,2,64,255,102,130,0,4,175,255,218,85,1,131,0,1,219,116,128,0,2,20,240,101,
+    128,0,2,50,255,35,128,0,1,139,140,129,0,134,255,128,0,2,1,228,148,128,0,2,
+    62,255,31,129,0,1,228,99,128,0,2,92,253,3,131,0,2,71,250,43,128,0,1,103,
+    227,128,0,5,225,233,121,0,80,234,135,0,4,86,254,50,212,168,130,0,0,230,141,255,
+    0,229,130,0,0,119,129,255,0,99,130,0,2,64,255,118,128,0,2,105,255,113,128,0,
+    1,103,247,131,0,2,64,255,16,130,0,0,234,133,255,0,234,128,0,0,184,132,255,0,
+    162,131,0,0,209,131,255,0,171,129,0,128,255,2,92,0,92,128,255,129,0,128,255,0,
+    92,130,0,2,190,227,170,130,0,128,255,0,92,128,0,0,64,129,255,0,20,128,0,0,
+    251,136,255,0,251,128,0,0,176,131,255,6,254,175,64,5,27,159,255,128,0,0,64,131,
+    255,0,16,128,0,132,255,0,92,128,0,0,64,129,255,0,20,128,0,0,243,135,255,0,
+    243,128,0,5,6,226,238,248,242,192,128,0,145,255,128,0,0,225,134,255,140,0,2,64,
+    255,20,130,0,1,193,158,129,0,2,64,255,16,131,0,1,178,173,131,0,1,217,160,128,
+    0,2,64,255,20,129,0,2,71,255,8,132,0,4,5,242,96,203,160,132,0,0,112,136,
+    255,1,210,1,128,0,1,234,128,129,0,2,83,249,4,129,0,5,192,154,0,14,250,62,
+    129,0,2,37,255,72,129,0,1,106,197,130,0,1,231,100,129,0,1,146,184,133,0,2,
+    18,238,176,129,0,1,61,207,132,0,1,167,195,131,0,2,12,234,112,129,0,4,64,255,
+    192,232,10,128,0,2,64,255,16,128,0,3,64,255,160,199,130,0,3,194,170,255,16,130,
+    0,1,181,86,129,0,2,64,255,20,133,0,6,64,255,20,0,82,255,124,131,0,2,64,
+    255,20,133,0,2,64,255,20,137,0,2,64,255,16,128,0,2,16,194,46,128,0,2,73,
+    255,10,134,0,4,149,254,163,255,20,128,0,2,64,255,20,128,0,2,64,255,16,130,0,
+    2,30,255,56,128,0,2,103,255,16,128,0,1,170,182,129,0,2,77,250,4,133,0,2,
+    64,255,16,128,0,2,64,255,20,137,0,4,218,255,247,255,46,141,0,1,246,210,129,0,
+    2,29,180,81,128,0,2,141,252,29,129,0,2,22,255,181,129,0,0,244,130,255,2,227,
+    98,3,130,0,2,3,98,227,130,255,0,243,129,0,2,61,92,45,129,0,0,39,128,92,
+    0,206,129,255,0,82,128,0,0,64,129,255,2,161,157,31,129,0,0,64,129,255,1,183,
+    159,129,255,1,179,158,128,255,0,245,130,0,0,231,128,255,1,205,142,129,255,0,113,128,
+    0,0,64,129,255,1,177,166,128,255,1,249,1,128,0,1,2,238,128,255,1,203,140,129,
+    255,0,37,129,0,0,235,128,255,1,159,158,128,255,1,253,3,128,0,1,1,234,128,255,
+    2,215,111,238,128,255,0,183,129,0,132,255,0,92,129,0,0,109,128,255,1,233,232,129,
+    255,0,212,128,255,1,239,1,129,0,0,121,131,255,1,204,1,129,0,137,255,128,0,0,
+    50,129,255,1,163,194,128,255,0,184,129,0,0,31,129,255,1,74,222,128,255,0,131,129,
+    0,0,64,129,255,1,20,64,129,255,0,16,129,0,132,255,0,92,128,0,0,113,136,255,
+    0,252,131,255,128,0,2,1,20,79,129,255,2,34,20,1,129,0,5,204,133,0,27,255,
+    48,129,0,2,64,255,40,128,0,2,70,255,11,128,0,2,64,255,20,128,0,2,64,255,
+    16,128,0,2,31,255,66,129,0,1,112,239,129,0,9,8,247,248,145,201,255,108,225,255,
+    99,143,0,4,66,203,255,188,54,129,0,2,64,255,54,131,0,4,54,188,255,202,66,129,
+    0,2,28,255,54,129,20,1,183,163,128,0,3,33,255,164,38,132,0,134,255,128,0,2,
+    33,255,56,128,0,2,1,49,5,129,0,6,10,7,0,1,100,255,13,130,0,2,6,217,
+    135,129,0,9,43,255,25,22,252,145,172,0,137,173,135,0,4,1,202,227,248,32,130,0,
+    143,255,130,0,0,206,129,255,0,187,130,0,2,64,255,45,128,0,2,68,255,37,128,0,
+    2,67,255,14,128,0,128,20,2,79,255,34,128,20,128,0,0,40,133,112,0,40,128,0,
+    1,62,253,131,255,1,249,23,129,0,0,9,132,255,0,224,129,0,6,254,255,90,0,90,
+    255,254,130,0,1,225,84,129,0,4,23,252,81,246,12,129,0,128,255,0,91,128,0,0,
+    19,129,255,0,14,128,0,138,255,128,0,129,255,0,254,131,255,0,252,129,255,128,0,0,
+    59,131,255,0,11,128,0,128,255,1,92,0,128,255,0,92,128,0,0,60,129,255,0,15,
+    128,0,137,255,130,0,2,167,248,123,129,0,145,255,128,0,134,255,0,248,128,0,133,20,
+    131,0,2,64,255,20,130,0,1,123,216,129,0,130,255,129,0,2,6,244,91,131,0,1,
+    31,3,128,0,2,64,255,20,129,0,1,94,236,133,0,5,67,255,43,137,236,3,131,0,
+    0,207,137,255,0,50,128,0,1,41,25,129,0,2,92,253,4,129,0,5,118,225,0,82,
+    241,4,129,0,2,59,255,31,129,0,1,73,241,129,0,2,22,255,55,129,0,1,100,228,
+    133,0,2,142,245,30,129,0,2,9,247,11,130,0,2,1,242,101,132,0,1,155,191,129,
+    0,4,64,255,63,253,117,128,0,2,64,255,16,128,0,4,64,255,91,252,15,128,0,4,
+    12,250,101,255,16,130,0,1,235,30,129,0,2,64,255,20,133,0,6,64,255,20,35,240,
+    178,1,131,0,5,64,255,91,227,234,111,130,0,6,64,255,20,0,61,251,110,133,0,2,
+    64,255,16,133,0,2,114,243,1,129,0,2,64,255,20,128,0,4,174,83,64,255,20,128,
+    0,2,64,255,20,128,0,130,255,129,0,2,55,255,29,128,0,2,76,255,16,128,0,1,
+    21,34,129,0,2,93,251,3,129,0,6,3,147,241,208,103,255,16,128,0,6,64,255,75,
+    207,244,186,30,132,0,5,55,255,222,150,255,138,141,0,3,221,254,118,12,133,0,0,7,
+    130,0,2,14,255,192,129,0,1,65,207,131,255,1,213,68,128,0,1,69,214,131,255,1,
+    207,65,137,0,1,25,242,128,255,0,179,129,0,0,64,129,255,0,54,131,0,0,64,129,
+    255,1,50,68,129,255,1,39,67,129,255,0,14,128,0,0,31,134,255,0,165,128,0,0,
+    64,129,255,1,44,70,129,255,0,11,128,0,0,36,129,255,5,65,4,225,255,236,27,129,
+    0,0,174,128,255,0,219,130,255,0,13,128,0,0,34,129,255,2,74,0,122,128,255,0,
+    241,129,0,132,255,0,92,129,0,0,49,136,255,0,179,130,0,1,9,229,130,255,0,63,
+    130,0,137,255,128,0,0,39,132,255,1,219,75,130,0,0,213,128,255,0,182,129,255,0,
+    57,129,0,0,64,129,255,1,20,64,129,255,0,16,129,0,132,255,0,92,128,0,0,227,
+    142,255,128,0,0,198,133,255,0,197,129,0,4,130,203,0,98,229,130,0,2,64,255,21,
+    128,0,2,64,255,16,128,0,2,64,255,20,128,0,2,64,255,16,128,0,2,57,255,33,
+    129,0,2,78,255,9,128,0,1,37,213,132,255,1,246,115,142,0,3,184,255,199,65,131,
+    0,2,64,255,26,133,0,3,65,199,255,184,128,0,0,56,132,255,0,186,129,0,0,133,
+    128,255,2,204,105,4,129,0,134,255,128,0,2,58,255,25,134,0,3,12,120,190,240,128,
+    255,0,16,130,0,2,122,223,10,129,0,9,1,237,79,76,211,87,222,0,195,112,136,0,
+    2,71,255,149,131,0,143,255,129,0,0,37,130,255,1,252,22,129,0,2,64,255,23,128,
+    0,2,64,255,16,128,0,2,64,255,16,128,0,133,255,128,0,0,198,133,255,0,197,129,
+    0,0,128,132,255,0,126,130,0,0,146,131,255,0,112,129,0,6,229,255,67,0,66,255,
+    229,129,0,2,6,247,62,129,0,4,108,205,0,224,89,129,0,2,233,255,67,128,0,0,
+    37,129,255,129,0,138,255,128,0,6,255,158,31,6,58,164,251,131,255,0,182,128,0,0,
+    31,130,255,0,239,129,0,132,255,0,92,128,0,0,34,128,255,0,244,129,0,137,255,129,
+    0,4,59,241,72,242,34,128,0,0,227,143,255,0,226,128,0,4,233,255,100,126,230,128,
+    255,1,229,67,128,0,133,255,131,0,2,64,255,20,130,0,1,87,251,129,0,3,133,255,
+    102,92,129,0,2,35,255,44,135,0,7,64,255,38,20,22,57,217,132,133,0,5,141,232,
+    0,71,255,62,130,0,1,21,254,137,255,0,119,132,0,2,3,192,193,130,0,4,43,255,
+    39,153,172,130,0,2,37,255,43,129,0,2,90,255,6,128,0,2,49,255,31,129,0,2,
+    76,254,1,131,0,2,33,249,118,131,0,1,205,63,130,0,2,35,255,50,132,0,1,97,
+    239,129,0,9,64,255,20,168,234,12,0,64,255,16,128,0,4,64,255,30,248,78,128,0,
+    4,76,223,64,255,16,129,0,1,37,230,130,0,2,64,255,20,133,0,5,64,255,27,205,
+    237,15,132,0,6,64,255,245,135,155,255,75,129,0,5,64,255,20,21,229,164,134,0,2,
+    64,255,16,131,0,3,16,81,236,144,130,0,2,64,255,20,128,0,4,5,0,64,255,20,
+    128,0,2,64,255,20,128,0,3,133,255,102,92,129,0,2,50,255,25,128,0,2,69,255,
+    16,133,0,1,181,205,130,0,6,122,250,126,160,245,255,16,128,0,6,64,255,241,136,115,
+    239,181,132,0,6,148,255,138,62,255,228,2,140,0,0,111,128,255,3,244,165,72,1,131,
+    0,6,34,98,145,193,248,255,196,130,0,2,1,86,216,130,255,0,244,128,0,0,245,130,
+    255,2,215,86,1,138,0,0,165,128,255,1,245,31,129,0,0,64,129,255,0,26,131,0,
+    0,64,129,255,1,23,64,129,255,1,16,64,129,255,0,16,128,0,0,56,134,255,0,186,
+    128,0,0,64,129,255,1,21,64,129,255,0,16,128,0,0,57,129,255,4,25,0,23,52,
+    9,130,0,0,68,133,255,0,16,128,0,0,57,129,255,2,31,0,77,129,255,0,9,128,
+    0,132,255,0,91,129,0,1,2,241,135,255,0,118,131,0,0,106,129,255,0,186,131,0,
+    137,255,129,0,0,206,131,255,1,235,46,130,0,0,138,131,255,1,236,2,129,0,0,64,
+    129,255,1,20,64,129,255,0,16,129,0,0,227,131,255,0,83,128,0,143,255,128,0,135,
+    255,129,0,4,55,253,20,170,156,130,0,2,64,255,20,128,0,2,64,255,16,128,0,2,
+    64,255,20,128,0,2,66,255,16,128,0,2,58,255,32,129,0,2,78,255,7,130,0,1,
+    28,147,128,255,2,212,71,12,143,0,2,255,215,35,132,0,2,64,255,20,134,0,2,35,
+    215,255,128,0,2,58,255,90,130,68,0,51,130,0,4,55,146,227,255,150,129,0,134,255,
+    128,0,2,58,255,25,134,0,6,192,240,159,99,86,255,16,129,0,2,29,245,74,131,0,
+    8,179,133,129,159,35,255,23,246,50,136,0,3,121,255,213,3,130,0,143,255,129,0,0,
+    124,131,255,0,106,129,0,2,64,255,20,128,0,2,64,255,16,128,0,2,64,255,16,128,
+    0,128,68,2,115,255,79,128,68,128,0,135,255,129,0,1,3,192,131,255,0,214,130,0,
+    0,88,131,255,0,57,129,0,6,194,255,36,0,34,255,195,129,0,2,93,246,9,129,0,
+    4,195,126,0,144,177,129,0,2,201,255,34,128,0,0,40,128,255,0,131,129,0,0,227,
+    136,255,0,226,128,0,0,129,131,0,6,34,151,223,248,216,114,4,128,0,0,3,130,255,
+    0,213,129,0,0,227,131,255,0,62,128,0,0,6,128,255,0,216,129,0,0,227,135,255,
+    0,226,129,0,4,29,91,0,108,15,128,0,1,74,227,141,255,1,227,73,128,0,1,28,
+    27,128,0,3,4,48,56,6,129,0,133,68,131,0,2,64,255,20,130,0,2,70,255,9,
+    128,0,2,64,255,16,130,0,2,55,255,26,135,0,0,64,131,255,1,234,35,133,0,5,
+    215,166,0,10,249,141,130,0,0,65,138,255,0,166,132,0,2,144,252,58,131,0,3,224,
+    103,217,98,130,0,2,6,245,119,129,0,2,163,255,13,128,0,2,60,255,23,129,0,2,
+    68,255,10,131,0,2,168,212,5,131,0,1,149,119,130,0,2,55,255,28,132,0,2,74,
+    255,5,128,0,9,64,255,20,40,253,121,0,64,255,16,128,0,4,64,255,20,191,146,128,
+    0,4,145,154,64,255,16,129,0,1,93,173,130,0,2,64,255,20,133,0,5,64,255,171,
+    254,255,62,132,0,2,64,255,147,128,0,128,184,129,0,5,64,255,22,186,209,10,134,0,
+    2,64,255,16,131,0,3,168,255,236,50,130,0,2,64,255,20,130,0,2,64,255,20,128,
+    0,2,64,255,20,128,0,2,64,255,16,130,0,2,22,255,52,128,0,2,96,255,16,132,
+    0,2,73,255,104,130,0,1,230,127,128,0,2,183,255,16,128,0,2,64,255,115,128,0,
+    2,115,245,1,130,0,7,5,235,255,53,2,229,255,68,141,0,1,105,227,129,255,1,208,
+    27,128,0,2,6,163,254,128,255,3,237,159,255,196,132,0,1,54,233,130,255,128,0,130,
+    255,1,233,53,139,0,0,62,129,255,0,118,130,0,0,64,129,255,0,20,131,0,0,64,
+    129,255,1,20,64,129,255,1,16,64,129,255,0,16,128,0,0,58,134,255,0,164,128,0,
+    0,64,129,255,1,20,64,129,255,0,16,128,0,0,58,129,255,5,25,0,89,170,124,10,
+    128,0,1,1,225,133,255,0,16,128,0,0,58,129,255,2,31,0,78,129,255,0,7,128,
+    0,0,237,131,255,0,72,130,0,0,185,135,255,0,57,131,0,0,156,129,255,1,236,14,
+    130,0,0,234,135,255,0,233,129,0,0,57,132,255,0,195,130,0,0,64,131,255,0,165,
+    130,0,0,64,129,255,1,20,70,129,255,0,16,129,0,0,111,131,255,0,61,128,0,142,
+    255,0,242,128,0,0,227,133,255,0,226,129,0,4,2,234,85,237,82,130,0,2,64,255,
+    20,128,0,2,64,255,16,128,0,2,59,255,27,128,0,2,86,255,16,128,0,2,31,255,
+    66,129,0,1,113,236,131,0,5,17,226,249,213,255,84,144,0,4,94,226,250,150,24,130,
+    0,2,64,255,20,132,0,4,25,150,250,225,95,128,0,2,34,255,57,129,0,1,64,43,
+    128,0,1,13,61,128,0,3,1,135,252,5,128,0,134,255,128,0,2,33,255,54,129,0,
+    1,161,51,128,0,2,39,255,68,128,0,2,84,255,16,129,0,128,172,132,0,8,119,187,
+    179,108,0,237,122,242,3,135,0,4,18,240,145,249,98,130,0,143,255,129,0,0,211,128,
+    255,0,250,128,255,0,193,129,0,2,64,255,20,128,0,2,64,255,16,128,0,2,64,255,
+    16,130,0,2,64,255,16,130,0,0,227,133,255,0,226,130,0,1,27,235,130,255,0,211,
+    130,0,0,73,131,255,0,48,129,0,6,160,254,7,0,4,252,162,128,0,2,8,242,128,
+    129,0,6,27,254,46,0,63,248,15,128,0,2,169,252,4,129,0,2,104,117,3,129,0,
+    1,74,227,134,255,1,227,73,144,0,4,167,253,255,252,124,129,0,1,74,227,128,255,1,
+    245,147,130,0,2,175,253,129,129,0,1,74,227,133,255,1,227,73,180,0,2,64,255,20,
+    130,0,2,74,255,5,128,0,2,64,255,16,130,0,2,53,255,26,135,0,2,64,255,82,
+    128,68,3,81,151,241,53,131,0,2,33,255,99,128,0,1,192,220,130,0,1,22,233,137,
+    255,0,99,131,0,2,90,255,117,132,0,3,150,185,254,26,131,0,7,137,245,98,34,117,
+    238,255,9,128,0,2,60,255,22,129,0,2,68,255,10,130,0,2,54,254,62,132,0,1,
+    93,175,130,0,2,58,255,24,132,0,2,72,255,8,128,0,9,64,255,20,0,164,237,13,
+    64,255,16,128,0,4,64,255,20,123,213,128,0,4,214,84,64,255,16,129,0,1,149,117,
+    130,0,2,64,255,20,133,0,0,64,128,255,3,95,219,203,1,131,0,2,64,255,58,128,
+    0,1,101,241,129,0,4,64,255,147,252,35,135,0,2,64,255,16,131,0,4,72,82,160,
+    251,72,129,0,2,64,255,20,130,0,2,64,255,20,128,0,2,64,255,20,128,0,2,64,
+    255,16,131,0,1,218,129,128,0,2,174,255,16,131,0,3,34,236,205,4,129,0,2,32,
+    255,51,128,0,2,101,255,16,128,0,2,64,255,41,128,0,2,71,255,12,130,0,2,78,
+    255,224,128,0,2,144,255,161,142,0,5,2,65,149,239,255,171,128,0,8,129,255,206,96,
+    39,1,6,255,196,130,0,2,38,169,254,130,255,0,211,128,0,0,211,130,255,2,254,169,
+    38,136,0,1,4,210,128,255,1,211,4,130,0,0,64,129,255,0,20,131,0,0,64,129,
+    255,1,20,64,129,255,1,16,64,129,255,0,16,128,0,0,38,129,255,2,131,68,232,128,
+    255,0,149,128,0,0,64,129,255,1,20,64,129,255,0,16,128,0,0,36,129,255,2,63,
+    1,236,128,255,0,86,128,0,0,43,129,255,1,174,195,129,255,0,16,128,0,0,35,129,
+    255,2,71,0,122,128,255,0,239,129,0,0,205,131,255,0,38,130,0,0,125,134,255,1,
+    246,6,130,0,1,40,252,130,255,0,131,130,0,0,200,135,255,0,200,128,0,1,55,252,
+    128,255,1,157,236,128,255,1,254,5,129,0,1,4,240,130,255,0,91,130,0,0,58,129,
+    255,1,28,96,129,255,0,16,128,0,1,6,212,130,255,1,253,23,128,0,142,255,0,131,
+    128,0,2,22,68,115,129,255,2,79,68,21,130,0,3,162,194,250,14,130,0,2,64,255,
+    20,128,0,2,64,255,16,128,0,2,38,255,72,128,0,2,160,255,16,129,0,1,221,169,
+    128,0,2,6,212,171,131,0,6,167,255,147,59,255,240,30,129,0,138,80,129,0,5,8,
+    119,239,245,135,16,128,0,2,64,255,20,130,0,5,16,135,245,239,119,8,129,0,2,1,
+    227,153,128,0,2,20,240,123,128,0,2,63,255,35,128,0,2,89,244,1,128,0,134,255,
+    128,0,2,1,227,140,128,0,2,56,255,38,128,0,2,53,255,37,128,0,2,165,255,19,
+    128,0,2,69,241,27,132,0,7,59,239,228,56,0,187,227,184,136,0,5,140,232,10,150,
+    227,8,129,0,0,230,141,255,0,229,128,0,0,42,129,255,0,133,128,255,1,253,27,128,
+    0,2,64,255,20,128,0,2,64,255,16,128,0,2,64,255,16,130,0,2,64,255,16,130,
+    0,0,22,133,68,0,21,131,0,1,57,218,128,255,1,219,61,131,0,4,82,158,58,162,
+    63,130,0,1,125,231,129,0,1,224,128,129,0,1,64,1,129,0,1,113,223,128,0,2,
+    2,233,96,128,0,1,136,224,255,0,2,64,255,20,130,0,1,90,243,129,0,2,64,255,
+    16,130,0,2,33,255,45,135,0,2,64,255,20,130,0,1,156,198,131,0,2,108,255,64,
+    128,32,2,145,255,44,130,0,0,31,136,255,0,94,132,0,1,224,173,133,0,2,76,255,
+    208,132,0,1,11,183,128,255,2,212,108,250,129,0,2,50,255,31,129,0,2,77,253,2,
+    130,0,1,194,160,133,0,1,37,231,130,0,2,38,255,43,132,0,1,93,243,129,0,9,
+    64,255,20,0,37,252,125,64,255,16,128,0,11,64,255,20,55,255,25,27,252,17,64,255,
+    16,129,0,1,205,61,130,0,2,64,255,20,133,0,6,64,255,149,0,88,255,91,131,0,
+    2,64,255,29,128,0,2,74,255,8,128,0,4,64,255,254,255,79,135,0,2,64,255,16,
+    134,0,1,161,210,129,0,2,64,255,20,130,0,2,64,255,20,128,0,2,64,255,20,128,
+    0,2,64,255,16,131,0,6,105,251,128,153,249,255,15,130,0,3,21,218,240,36,130,0,
+    2,55,255,24,128,0,2,71,255,16,128,0,2,64,255,21,128,0,2,64,255,16,130,0,
+    2,171,255,140,128,0,3,56,255,243,10,129,0,2,23,92,7,132,0,2,1,38,41,129,
+    0,2,25,240,242,128,0,2,224,242,13,129,0,2,29,255,196,129,0,1,135,252,130,255,
+    2,244,130,12,128,0,2,12,130,244,130,255,1,252,135,129,0,2,61,92,45,129,0,0,
+    112,129,255,0,151,128,92,0,38,128,0,0,64,129,255,0,20,131,0,0,64,129,255,1,
+    20,64,129,255,1,16,64,129,255,0,16,128,0,1,3,240,128,255,2,203,116,251,128,255,
+    0,136,128,0,0,64,129,255,1,20,64,129,255,0,16,128,0,1,2,238,128,255,1,196,
+    138,129,255,0,43,128,0,0,54,129,255,1,116,212,129,255,0,19,128,0,1,1,235,128,
+    255,2,214,110,237,128,255,0,183,129,0,0,173,130,255,1,254,7,130,0,0,65,134,255,
+    0,190,131,0,0,174,131,255,1,244,24,129,0,0,165,135,255,0,166,128,0,0,69,129,
+    255,1,123,154,128,255,1,253,4,130,0,0,171,129,255,1,253,20,130,0,0,41,129,255,
+    1,137,207,129,255,0,16,128,0,0,25,131,255,0,195,129,0,0,218,128,255,4,252,95,
+    10,91,213,132,255,1,252,127,131,0,0,64,129,255,0,16,132,0,2,88,255,190,131,0,
+    2,64,255,20,128,0,2,64,255,16,128,0,7,2,223,221,105,158,223,255,16,129,0,6,
+    91,255,171,107,194,248,49,130,0,7,24,241,239,21,0,163,255,116,129,0,138,255,131,0,
+    3,18,143,249,238,128,0,2,64,255,20,130,0,3,239,249,143,18,132,0,6,104,255,158,
+    105,207,234,24,128,0,6,5,215,216,109,116,231,158,129,0,134,255,129,0,5,107,254,149,
+    110,226,175,129,0,7,13,240,194,101,164,249,255,30,128,0,2,216,164,87,129,92,129,0,
+    7,6,247,251,9,0,135,255,123,130,0,2,23,92,7,128,0,6,29,247,111,0,28,248,
+    117,129,0,0,136,141,255,0,135,128,0,0,122,128,255,2,232,9,242,128,255,0,105,128,
+    0,2,64,255,20,128,0,2,64,255,16,128,0,2,64,255,16,130,0,2,64,255,16,255,
+    0,190,0,2,64,255,20,130,0,1,132,208,129,0,2,64,255,16,130,0,2,4,241,88,
+    131,0,1,119,147,128,0,2,64,255,20,130,0,2,76,252,4,130,0,0,182,132,255,0,
+    123,130,0,1,16,241,135,255,0,107,131,0,2,37,255,55,133,0,2,10,247,134,134,0,
+    4,43,52,2,102,221,129,0,2,25,255,54,129,0,1,99,228,130,0,2,80,238,21,134,
+    0,1,235,31,129,0,2,2,241,95,132,0,1,146,196,129,0,2,64,255,20,128,0,4,
+    161,239,79,255,16,128,0,11,64,255,20,3,239,92,96,201,0,64,255,16,128,0,2,9,
+    246,9,130,0,2,64,255,20,133,0,7,64,255,22,0,1,206,225,8,130,0,2,64,255,
+    26,128,0,2,76,255,8,128,0,5,64,255,127,183,209,1,131,0,5,15,3,0,64,255,
+    13,134,0,2,80,255,7,128,0,2,64,255,20,130,0,2,64,255,20,128,0,2,64,255,
+    20,128,0,2,64,255,16,131,0,6,2,143,243,214,111,255,10,129,0,3,7,197,251,69,
+    131,0,2,58,255,30,128,0,2,71,255,16,128,0,2,64,255,20,128,0,2,64,255,16,
+    129,0,3,15,247,255,55,129,0,2,224,255,90,129,0,2,64,255,20,132,0,2,21,254,
+    179,130,0,1,211,245,128,0,1,247,209,130,0,2,106,255,199,129,0,130,255,2,252,154,
+    25,132,0,2,25,154,252,130,255,128,0,0,42,128,255,1,244,9,128,0,0,236,132,255,
+    0,233,128,0,0,64,129,255,0,20,131,0,0,64,129,255,1,20,64,129,255,1,16,64,
+    129,255,0,16,129,0,0,144,132,255,1,253,44,128,0,0,64,129,255,1,20,64,129,255,
+    0,16,129,0,0,145,132,255,0,211,129,0,1,19,253,133,255,0,32,129,0,0,134,133,
+    255,0,82,129,0,0,141,130,255,0,228,131,0,1,9,250,128,255,1,254,154,129,255,0,
+    129,130,0,0,55,129,255,0,194,129,255,0,150,129,0,0,131,135,255,0,133,128,0,1,
+    9,242,132,255,0,196,131,0,0,97,129,255,0,199,131,0,1,5,239,133,255,0,16,129,
+    0,0,205,129,255,1,253,58,129,0,0,70,128,227,0,80,129,0,7,2,87,183,235,250,
+    225,158,48,132,0,0,64,129,255,0,16,132,0,2,17,252,116,131,0,2,64,255,20,128,
+    0,2,64,255,16,129,0,6,51,206,247,189,56,255,16,130,0,4,94,219,249,204,64,132,
+    0,1,47,87,128,0,1,20,114,130,0,138,255,133,0,1,33,167,128,0,2,64,255,20,
+    130,0,1,166,33,135,0,4,108,223,245,194,49,130,0,5,37,185,242,229,147,12,129,0,
+    134,255,130,0,4,117,229,238,160,15,130,0,6,74,219,240,188,53,246,86,128,0,132,255,
+    130,0,1,194,209,128,0,2,82,255,62,130,0,2,64,255,20,128,0,2,159,229,8,128,
+    0,2,148,238,16,128,0,2,6,136,230,137,255,2,230,136,6,128,0,8,81,246,255,123,
+    0,134,255,242,68,128,0,2,64,255,20,128,0,2,64,255,16,128,0,2,64,255,16,255,
+    0,197,0,2,64,255,20,130,0,1,195,145,129,0,2,64,255,16,131,0,1,175,170,131,
+    0,1,209,184,128,0,2,64,255,20,130,0,2,79,252,3,129,0,2,9,246,170,130,80,
+    1,227,202,130,0,0,60,136,255,0,165,131,0,2,60,255,26,133,0,2,9,247,59,131,
+    0,2,2,95,27,129,0,1,166,169,129,0,2,1,238,99,129,0,1,145,181,129,0,2,
+    4,216,103,135,0,1,181,87,130,0,1,160,194,131,0,2,11,232,114,129,0,2,64,255,
+    20,128,0,4,35,251,193,255,16,128,0,11,64,255,20,0,175,157,163,131,0,64,255,16,
+    128,0,1,61,204,131,0,2,64,255,20,133,0,2,64,255,20,128,0,2,72,255,120,130,
+    0,2,64,255,49,128,0,1,103,237,129,0,5,64,255,20,55,255,85,130,0,6,56,255,
+    26,0,72,254,3,128,0,2,46,230,32,129,0,2,91,251,2,128,0,2,64,255,20,130,
+    0,2,64,255,20,128,0,2,64,255,20,128,0,2,64,255,16,130,0,1,8,9,129,0,
+    1,79,248,130,0,2,155,255,100,132,0,2,33,255,57,128,0,2,97,255,16,128,0,2,
+    64,255,20,128,0,2,64,255,16,129,0,3,100,255,226,1,129,0,2,138,255,183,130,0,
+    1,163,14,128,0,1,40,30,129,0,2,202,253,74,128,0,2,73,253,191,128,0,2,212,
+    251,58,128,0,3,72,240,255,206,129,0,129,255,1,178,41,136,0,1,41,178,129,255,128,
+    0,4,64,255,145,255,20,128,0,134,255,128,0,0,64,129,255,0,20,131,0,0,64,129,
+    255,1,20,64,129,255,1,16,64,129,255,0,16,129,0,1,16,214,131,255,0,130,129,0,
+    0,64,129,255,1,20,64,129,255,0,16,129,0,1,18,218,130,255,1,249,54,130,0,0,
+    147,133,255,0,87,129,0,1,10,203,131,255,0,164,130,0,0,79,130,255,0,166,132,0,
+    0,201,128,255,1,215,89,129,255,0,68,130,0,0,184,128,255,2,245,23,179,129,255,0,
+    28,128,0,0,68,135,255,0,71,129,0,0,99,131,255,1,247,54,131,0,1,24,254,128,
+    255,0,125,132,0,0,118,133,255,0,16,129,0,4,71,254,255,251,102,151,0,4,19,225,
+    255,195,1,255,0,255,0,255,0,164,0,2,64,255,20,129,0,2,63,254,49,129,0,2,
+    60,255,20,131,0,2,64,253,67,129,0,2,99,255,83,128,0,2,64,255,20,130,0,1,
+    159,201,130,0,2,75,255,64,130,0,2,144,254,26,129,0,1,3,212,135,255,0,65,131,
+    0,2,6,24,1,133,0,2,85,231,2,132,0,1,225,124,128,0,2,33,248,75,130,0,
+    6,167,196,1,0,12,230,106,129,0,2,106,200,2,135,0,1,125,143,130,0,2,38,249,
+    119,129,0,3,2,162,232,13,129,0,2,64,255,20,129,0,0,157,128,255,0,16,128,0,
+    11,64,255,20,0,107,221,228,61,0,64,255,16,128,0,1,117,148,131,0,2,64,255,20,
+    133,0,2,64,255,20,129,0,2,191,241,21,129,0,2,64,255,123,128,0,1,187,176,129,
+    0,6,64,255,20,0,183,213,2,129,0,5,31,255,61,0,112,223,129,0,2,11,249,130,
+    128,0,2,2,194,188,129,0,2,64,255,20,130,0,2,64,255,20,128,0,2,64,255,20,
+    128,0,2,64,255,16,130,0,2,39,252,24,128,0,1,146,207,129,0,2,61,255,144,133,
+    0,2,1,227,141,128,0,2,179,255,16,128,0,2,64,255,20,128,0,2,64,255,16,129,
+    0,2,193,255,142,130,0,3,51,255,252,24,128,0,1,20,202,129,0,1,255,196,129,0,
+    7,59,253,255,216,214,255,250,60,128,0,5,103,255,252,209,222,255,128,228,0,230,129,0,
+    2,157,193,62,140,0,2,62,193,156,128,0,4,19,225,255,198,1,128,0,0,181,132,255,
+    0,180,128,0,4,19,225,255,198,1,131,0,14,19,225,255,198,1,19,225,255,195,1,19,
+    225,255,195,1,130,0,5,18,148,230,246,207,95,130,0,9,19,225,255,198,1,19,225,255,
+    195,1,130,0,5,21,156,234,247,195,58,131,0,4,7,144,225,248,207,128,255,1,237,54,
+    130,0,6,13,139,227,249,215,114,3,131,0,4,148,242,254,189,34,132,0,8,103,250,252,
+    120,20,224,255,212,9,130,0,0,149,128,255,6,118,0,45,237,255,217,27,129,0,8,139,
+    240,255,214,74,189,254,241,142,131,0,5,94,203,242,241,180,49,133,0,3,165,255,234,35,
+    133,0,3,108,218,247,211,128,255,1,195,1,130,0,2,65,128,52,255,0,255,0,255,0,
+    195,0,7,64,255,104,92,100,142,242,155,130,0,3,37,255,149,95,131,0,6,158,248,144,
+    102,157,254,177,129,0,2,64,255,104,128,92,3,100,166,255,77,130,0,2,149,236,3,130,
+    0,2,59,255,104,130,0,1,33,216,128,255,1,248,228,128,255,1,251,102,132,0,2,23,
+    92,7,131,0,3,35,170,239,137,133,0,6,125,246,129,112,224,189,1,130,0,6,46,248,
+    176,101,198,226,12,129,0,1,233,135,132,92,130,0,1,69,199,131,0,7,99,254,183,104,
+    112,203,247,62,130,0,2,64,255,20,129,0,3,32,250,255,16,128,0,11,64,255,20,0,
+    39,255,242,5,0,64,255,16,128,0,1,173,92,131,0,2,64,255,160,130,152,0,38,128,
+    0,2,64,255,20,129,0,2,56,255,149,129,0,6,64,254,233,123,156,253,58,129,0,6,
+    64,255,20,0,56,255,91,130,0,4,213,205,108,233,146,130,0,6,130,252,145,107,195,247,
+    51,129,0,2,64,255,20,130,0,2,64,255,20,128,0,2,64,255,20,128,0,2,64,255,
+    16,130,0,6,3,213,197,101,140,252,100,129,0,2,175,250,102,130,92,0,5,129,0,6,
+    110,252,133,151,239,255,16,128,0,2,64,255,20,128,0,2,64,255,16,128,0,3,31,254,
+    255,58,131,0,2,219,255,113,128,0,1,28,67,129,0,1,255,196,130,0,5,61,191,238,
+    244,190,61,129,0,9,1,106,215,248,227,152,26,157,255,43,255,0,255,0,255,0,255,0,
+    255,0,157,0,0,64,129,255,3,250,218,123,3,131,0,0,144,128,242,0,19,130,0,6,
+    3,117,216,248,225,129,5,129,0,0,64,130,255,2,244,203,85,131,0,1,222,160,131,0,
+    2,1,228,184,131,0,7,18,147,176,65,16,152,177,63,133,0,2,64,255,20,131,0,3,
+    23,237,195,15,133,0,5,5,138,232,236,154,14,132,0,4,69,212,247,195,41,130,0,134,
+    255,130,0,2,14,246,6,131,0,5,70,193,244,238,175,45,131,0,2,64,255,20,130,0,
+    2,153,255,16,128,0,2,64,255,20,128,0,1,226,178,128,0,2,64,255,16,128,0,1,
+    228,36,131,0,0,64,132,255,0,64,128,0,2,64,255,20,130,0,2,176,251,40,128,0,
+    5,64,252,79,231,230,91,130,0,2,64,255,20,128,0,2,184,218,3,129,0,4,46,207,
+    247,179,15,130,0,5,3,131,231,248,193,54,130,0,2,64,255,20,130,0,2,64,255,20,
+    128,0,2,64,255,20,128,0,2,64,255,16,131,0,4,39,188,243,227,116,130,0,0,238,
+    132,255,0,16,130,0,5,130,240,215,87,255,16,128,0,2,64,255,20,128,0,2,64,255,
+    16,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,
+    0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,188,0,0,5,134,
+    24,0,9,129,0,2,64,255,20,128,0,4,26,185,216,199,33,129,0,0,2,130,24,0,
+    2,128,0,4,64,255,84,255,16,128,0,2,23,92,7,129,0,1,5,3,129,0,0,1,
+    129,0,2,61,92,45,129,0,137,255,128,0,0,126,128,255,0,114,129,0,130,24,128,0,
+    134,152,128,0,1,40,30,128,0,133,80,128,0,128,255,0,92,128,0,0,2,134,24,0,
+    6,128,0,2,28,212,111,129,0,141,216,128,0,2,23,92,7,128,0,131,196,255,0,255,
+    0,255,0,255,0,255,0,255,0,214,0,1,6,223,134,255,1,242,30,128,0,2,64,255,
+    20,128,0,0,59,129,255,0,142,129,0,0,201,130,255,0,201,128,0,4,64,255,84,255,
+    16,128,0,2,64,255,20,128,0,6,150,248,247,171,70,43,173,128,0,0,42,128,255,1,
+    244,9,128,0,137,255,128,0,4,2,190,255,221,2,128,0,130,255,128,0,134,255,128,0,
+    1,255,196,128,0,133,255,128,0,128,255,0,92,128,0,0,28,134,255,0,72,129,0,1,
+    148,212,129,0,141,255,128,0,2,64,255,20,128,0,131,255,255,0,255,0,255,0,255,0,
+    255,0,255,0,214,0,0,28,136,255,0,72,128,0,2,58,255,13,129,0,0,186,128,255,
+    1,227,1,128,0,132,255,128,0,4,56,255,70,255,9,129,0,1,163,14,128,0,3,201,
+    89,110,212,128,255,0,195,128,0,4,64,255,145,255,20,128,0,137,255,129,0,3,25,234,
+    255,78,128,0,130,68,128,0,134,255,128,0,1,255,196,128,0,133,255,128,0,128,255,0,
+    92,128,0,0,7,134,68,0,19,129,0,2,18,236,44,255,0,255,0,255,0,255,0,255,
+    0,255,0,243,0,1,11,244,135,255,0,43,128,0,1,31,241,130,0,1,42,252,128,255,
+    0,53,128,0,0,227,130,255,0,226,128,0,3,27,242,29,236,129,0,1,21,203,129,0,
+    0,10,129,0,2,45,46,2,128,0,4,19,225,255,198,1,128,0,137,255,130,0,2,72,
+    254,188,255,0,255,0,255,0,255,0,255,0,255,0,255,0,167,0,0,29,134,68,0,40,
+    129,0,1,4,208,131,0,3,114,255,227,31,128,0,0,22,130,68,0,21,128,0,3,2,
+    207,3,202,129,0,1,28,67,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,
+    255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,218,0,
+};
+
+#endif
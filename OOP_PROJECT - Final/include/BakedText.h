@@ -0,0 +1,40 @@
+#ifndef BAKEDTEXT_H
+#define BAKEDTEXT_H
+
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <vector>
+#include "FontAtlas.h"
+
+// Text drawn from the baked font atlas, laid out like sf::Text (first
+// baseline at the character size, '\n' starts a new line). Every glyph is a
+// quad in one vertex list - outlines first, fill on top - so a whole block
+// of text is a single draw call. Changing the string reuses the vertex
+// memory, so it only allocates when a text gets longer than ever before.
+class BakedText : public sf::Drawable, public sf::Transformable {
+private:
+    const FontAtlas* atlas;
+    FontStyle style;
+    sf::Color fillColor;
+    sf::Color outlineColor;
+    std::vector<sf::Vertex> vertices;   // Outline quads, then the fill quads
+    size_t fillStart;
+    sf::FloatRect bounds;
+
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+public:
+    BakedText();
+
+    // Set the font before the string
+    void setFont(const FontAtlas& font, FontStyle textStyle);
+    void setString(const char* text);
+    void setString(const std::string& text) { setString(text.c_str()); }
+    void setFillColor(sf::Color color);
+    void setOutlineColor(sf::Color color);
+
+    // Like sf::Text: the glyphs' box, grown by the outline
+    sf::FloatRect getLocalBounds() const { return bounds; }
+};
+
+#endif
@@ -0,0 +1,101 @@
+#ifndef BEATDETECTOR_H
+#define BEATDETECTOR_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+#include "SpscRing.h"
+
+// A block of mono samples copied out of the music stream
+struct AudioBlock {
+    static const int SIZE = 512;
+    float samples[SIZE];
+    uint64_t startFrame;     // Position of samples[0] in the stream (in frames)
+};
+
+// A detected onset in the music
+struct BeatEvent {
+    float time;              // Seconds since the music started (keeps growing across loops)
+    float strength;          // How far above the threshold the onset was (1 = just above)
+};
+
+// Finds beats/onsets in the background music on a worker thread.
+// The audio thread pushes blocks into a lock-free ring; the worker runs an
+// FFT over a sliding window, measures spectral flux (how much the spectrum
+// grew since the last block) and reports peaks above an adaptive threshold.
+// Once the whole track has been heard, the beat map is saved next to the
+// track and later runs just replay it instead of analysing again.
+class BeatDetector {
+private:
+    static const int FFT_SIZE = 1024;
+    static const int FLUX_HISTORY = 16;
+
+    SpscRing<AudioBlock> input;      // Audio thread -> worker
+    SpscRing<BeatEvent> output;      // Worker -> game thread
+    std::thread worker;
+    std::atomic<bool> running;
+
+    unsigned sampleRate;
+    uint64_t trackFrames;            // Length of one loop of the track
+    std::string cachePath;
+
+    // Analysis state (worker thread only)
+    float window[FFT_SIZE];
+    float history[FFT_SIZE];         // Last FFT_SIZE samples
+    float real[FFT_SIZE];
+    float imag[FFT_SIZE];
+    float magnitude[FFT_SIZE / 2];
+    float previousMagnitude[FFT_SIZE / 2];
+    int bitReverse[FFT_SIZE];
+    float twiddleReal[FFT_SIZE];     // Twiddles stored stage by stage, contiguous
+    float twiddleImag[FFT_SIZE];
+    float fluxHistory[FLUX_HISTORY];
+    int fluxCount;
+    float lastFlux;
+    float lastThreshold;
+    uint64_t lastFluxFrame;
+    bool lastWasRising;
+    float lastBeatTime;
+
+    // Beat map of one full loop (cache)
+    std::vector<float> beatMap;
+    std::vector<float> beatMapStrength;
+    bool usingCache;
+    bool cacheWritten;
+    uint64_t cacheCursorLoop;
+    size_t cacheCursor;
+
+    // Timing of the analysis (microseconds per block)
+    std::atomic<int64_t> lastBlockMicros;
+    std::atomic<int64_t> maxBlockMicros;
+
+    void workerLoop();
+    void analyseBlock(const AudioBlock& block);
+    void replayCache(const AudioBlock& block);
+    void fft();
+    void reportBeat(float time, float strength);
+    bool loadCache();
+    void saveCache();
+
+public:
+    BeatDetector();
+    ~BeatDetector();
+
+    // trackFrames = frames in one loop; cacheFile is where the beat map lives
+    void start(unsigned rate, uint64_t frames, const std::string& cacheFile);
+    void stop();
+
+    // Audio thread: hand over a block (dropped if the worker is behind)
+    void pushBlock(const AudioBlock& block) { input.tryPush(block); }
+
+    // Game thread: next detected beat, if any
+    bool pollBeat(BeatEvent& beat) { return output.tryPop(beat); }
+
+    bool isUsingCache() const { return usingCache; }
+    float getLastBlockMs() const { return lastBlockMicros.load() / 1000.0f; }
+    float getMaxBlockMs() const { return maxBlockMicros.load() / 1000.0f; }
+};
+
+#endif
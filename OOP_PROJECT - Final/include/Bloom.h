@@ -0,0 +1,80 @@
+#ifndef BLOOM_H
+#define BLOOM_H
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+#include "WorkerPool.h"
+
+enum class BloomQuality {
+    OFF,
+    LOW,        // 1/8 resolution, small blur
+    MEDIUM,     // 1/4 resolution
+    HIGH        // 1/4 resolution, wide blur
+};
+
+// Bloom post-process: the bright neon colors bleed light into their
+// surroundings. Replaces the old glow (power-ups and color walls drawn twice)
+// with a fixed handful of draws, no matter how many things glow.
+//   1. the world is halved (and halved again) on the GPU - drawing at half
+//      size with smoothing averages every 2x2 block
+//   2. a threshold keeps only the bright colors
+//   3. separable Gaussian blur, horizontal then vertical
+//   4. the result is added back over the world
+// Steps 2-3 run in a shader when the GPU has them. Otherwise the small buffer
+// is read back and blurred on the CPU (SSE, rows then column tiles over the
+// render workers), which keeps software GL machines covered.
+//
+// The CPU path reads pixels with glReadPixels, so link OpenGL as well
+// (-lopengl32 on Windows, -lGL elsewhere).
+class Bloom {
+public:
+    static const int MAX_RADIUS = 12;
+    static const int LEVELS = 3;        // 1/2, 1/4 and 1/8 of the world
+
+private:
+    BloomQuality quality;
+    bool available;             // Render targets could be created
+    bool shaderPath;
+    int level;                  // Level blurred at the current quality
+    int radius;
+    float weights[MAX_RADIUS + 1];      // Center tap first
+
+    sf::RenderTexture levels[LEVELS];
+    sf::Sprite sprite;
+
+    // GPU path: ping-pong targets for each level that can be blurred
+    sf::Shader blurShader;
+    sf::RenderTexture blurTargets[LEVELS][2];
+
+    // CPU path: RGBA floats; rows are padded by MAX_RADIUS for the
+    // horizontal pass so it needs no edge checks
+    std::vector<uint8_t> readback;
+    std::vector<float> paddedRows;      // One padded row per band
+    std::vector<float> horizontal;
+    std::vector<uint8_t> pixels;
+    sf::Texture cpuResult;
+
+    float lastMs;
+
+    void blurOnGpu();
+    void blurOnCpu(WorkerPool& pool);
+    void blurRows(int firstRow, int lastRow, float* padded);
+    void blurColumns(int firstColumn, int lastColumn);
+
+public:
+    Bloom();
+
+    void setQuality(BloomQuality q);
+    BloomQuality getQuality() const { return quality; }
+    static const char* getQualityName(BloomQuality q);
+
+    // Adds the glow of the area (in texels) of 'world' back over it; call
+    // after world.display()
+    void apply(sf::RenderTexture& world, sf::Vector2u area, WorkerPool& pool);
+
+    bool isUsingShader() const { return shaderPath; }
+    float getLastMs() const { return lastMs; }
+};
+
+#endif
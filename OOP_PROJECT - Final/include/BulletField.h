@@ -0,0 +1,85 @@
+#ifndef BULLETFIELD_H
+#define BULLETFIELD_H
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+#include "Fixed.h"
+
+namespace StateHash { class Stream; }
+
+// How a newly emitted bullet moves (script values, already fixed-point)
+struct BulletMotion {
+    Fixed speed;
+    Fixed halfSize;
+    Fixed sineAmplitude;     // Sideways wobble in pixels (0 = straight)
+    Fixed sineFrequency;     // Wobbles per second
+    Fixed curve;             // Degrees per second the heading turns
+    Fixed accel;             // Pixels per second added to the speed each second
+};
+
+// The small, numerous obstacles fired by pattern scripts.
+// Stored as a structure of arrays with room for MAX_BULLETS reserved up
+// front, so updating, colliding and drawing thousands of them is a few
+// straight loops with no allocations. Bullets of the player's own color
+// pass through the player harmlessly (like color walls).
+// Everything that moves is raw 16.16 fixed-point (see Fixed.h) so bullets
+// fly the same way on every build.
+class BulletField {
+private:
+    // Moving state
+    std::vector<int32_t> baseX, baseY;   // Position along the path (before wobble)
+    std::vector<int32_t> x, y;           // Drawn / collided position
+    std::vector<int32_t> dirX, dirY;
+    std::vector<int32_t> speed;
+    std::vector<int32_t> halfSize;
+    std::vector<int32_t> sineAmplitude;
+    std::vector<int32_t> sinePhase, sineRate;  // Degrees, degrees per second
+    std::vector<int32_t> turnRate;       // Degrees per second
+    std::vector<int32_t> accel;
+    std::vector<int32_t> age;
+    std::vector<uint8_t> color;          // Palette index
+    std::vector<uint8_t> pattern;        // Which pattern fired it (for stats)
+
+    size_t count;
+    std::vector<sf::Vertex> vertices;    // 6 per bullet, filled by draw
+
+    void removeAt(size_t i);
+
+public:
+    static const int PALETTE_SIZE = 6;
+
+    BulletField();
+
+    void spawn(FixedVec2 position, Fixed angleDegrees, int paletteIndex,
+               const BulletMotion& motion, int patternId);
+    void update(Fixed dt);
+    void clear();
+
+    // Index of a bullet touching the player that isn't the player's color, or -1
+    int findHit(const FixedRect& playerBounds, sf::Color playerColor) const;
+
+    // Same test for several players in one pass over the bullets. Bit p of
+    // the result is set if player p was hit.
+    unsigned findHits(const FixedRect* playerBounds, const sf::Color* playerColors, int playerCount) const;
+
+    // Bullets per pattern id (counts has room for maxPatterns entries)
+    void countByPattern(int* counts, int maxPatterns) const;
+
+    // Every live bullet's moving state, column by column, for the state hash
+    void hashState(StateHash::Stream& stream) const;
+
+    // One draw call for every bullet
+    void draw(sf::RenderTarget& target);
+
+    size_t getCount() const { return count; }
+    size_t getCapacity() const { return speed.size(); }
+    sf::Vector2f getPosition(size_t i) const {
+        return sf::Vector2f(Fixed::fromRaw(x[i]).toFloat(), Fixed::fromRaw(y[i]).toFloat());
+    }
+    float getHalfSize(size_t i) const { return Fixed::fromRaw(halfSize[i]).toFloat(); }
+    sf::Color getColor(size_t i) const { return getPaletteColor(color[i]); }
+    static sf::Color getPaletteColor(int index);
+};
+
+#endif
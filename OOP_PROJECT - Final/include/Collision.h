@@ -0,0 +1,108 @@
+#ifndef COLLISION_H
+#define COLLISION_H
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+#include "Fixed.h"
+
+// Oriented boxes packed as separate arrays (structure of arrays) of raw
+// 16.16 fixed-point values, so the narrowphase is integer math the compiler
+// can vectorize and gives the same answer on every build.
+//
+// Each box also keeps where it was at the start of the tick (from*), for the
+// swept test. Boxes added without one didn't move.
+struct OrientedBoxBatch {
+    std::vector<int32_t> centerX;
+    std::vector<int32_t> centerY;
+    std::vector<int32_t> halfW;
+    std::vector<int32_t> halfH;
+    std::vector<int32_t> cosA;
+    std::vector<int32_t> sinA;
+    std::vector<int32_t> fromX;
+    std::vector<int32_t> fromY;
+    std::vector<int32_t> fromCos;
+    std::vector<int32_t> fromSin;
+
+    void clear();
+    void reserve(size_t count);
+    void add(FixedVec2 center, FixedVec2 halfSize, Fixed cosRotation, Fixed sinRotation);
+    void add(FixedVec2 center, FixedVec2 halfSize, Fixed cosRotation, Fixed sinRotation,
+             FixedVec2 fromCenter, Fixed fromCos, Fixed fromSin);
+    size_t size() const { return centerX.size(); }
+};
+
+// First contact between a player box and a batch box during a tick
+struct SweepHit {
+    Fixed time;                 // Fraction of the tick, 0 = start, 1 = end
+    uint32_t box;               // Index into the batch
+    int player;                 // Index into the player boxes
+};
+
+// Instruction sets the swept test can run on, in order of preference
+enum class CollisionSimd {
+    SCALAR,
+    SSE41,                      // 4 lanes broadphase, 2 x 2 lanes narrowphase
+    AVX2                        // 8 lanes broadphase, 4 lanes narrowphase
+};
+
+namespace Collision {
+    // Exact separating axis test between an axis-aligned box (the player)
+    // and a rotated box
+    bool boxIntersectsOrientedBox(const FixedRect& box, FixedVec2 center, FixedVec2 halfSize,
+                                  Fixed cosRotation, Fixed sinRotation);
+
+    const int MAX_BATCH_BOXES = 8;
+
+    // Test up to MAX_BATCH_BOXES axis-aligned boxes (the players) against every
+    // box in the batch in a single pass. Bit b of hits[i] is set if box b
+    // overlaps batch box i. Returns the number of overlapping pairs.
+    int testBatch(const FixedRect* boxes, int boxCount, const OrientedBoxBatch& batch,
+                  std::vector<uint8_t>& hits);
+
+    inline int testBatch(const FixedRect& box, const OrientedBoxBatch& batch, std::vector<uint8_t>& hits) {
+        return testBatch(&box, 1, batch, hits);
+    }
+
+    // Continuous version of testBatch: player box b moves in a straight line
+    // from starts[b] to ends[b] while every batch box moves (and turns) from
+    // its from* pose to its current one, so nothing fast tunnels through
+    // anything thin. Every pair that touches during the tick gets one hit at
+    // its first contact; hits come out sorted by time (then box, player).
+    // Returns the number of hits.
+    //
+    // Broadphase is a slab test of the relative motion against the boxes'
+    // world-axis extents (conservative while turning). Only pairs that pass
+    // get the exact test, at poses sampled every few pixels of travel.
+    //
+    // Both phases run in SIMD lanes when the CPU has SSE4.1 or AVX2. The
+    // scalar code is the reference: every path gives exactly the same hits.
+    int sweepBatch(const FixedRect* starts, const FixedRect* ends, int boxCount, const OrientedBoxBatch& batch,
+                   std::vector<SweepHit>& hits);
+    int sweepBatch(const FixedRect* starts, const FixedRect* ends, int boxCount, const OrientedBoxBatch& batch,
+                   std::vector<SweepHit>& hits, CollisionSimd simd);
+
+    // The instruction set sweepBatch uses; starts as the best the CPU has.
+    // setSimd never goes above that, so it can only force a slower path.
+    CollisionSimd getSimd();
+    CollisionSimd getBestSimd();
+    void setSimd(CollisionSimd simd);
+    const char* getSimdName(CollisionSimd simd);
+
+    // Two axis-aligned boxes moving in straight lines; exact. time is when
+    // they first touch (0 if they start overlapping).
+    bool sweepBoxes(const FixedRect& fromA, const FixedRect& toA, const FixedRect& fromB, const FixedRect& toB,
+                    Fixed& time);
+
+    // When a distance that was >= 0 at the start of the tick drops below 0,
+    // e.g. an obstacle's back edge crossing a player. Linear in between.
+    bool crossing(Fixed before, Fixed after, Fixed& time);
+
+    // Slow reference: transforms the corners with sf::Transform and runs a
+    // generic convex polygon SAT in floats. tools/collision_check holds the
+    // fast paths against it (it can disagree on contacts within rounding of
+    // touching).
+    bool referenceIntersects(const sf::FloatRect& box, const sf::Transform& transform, const sf::FloatRect& localRect);
+}
+
+#endif
@@ -10,17 +10,25 @@ class ColorWallObstacle : public Obstacle {
 private:
     sf::Color requiredColor;  // Color player must match to pass through
     bool isTall;              // This obstacle is taller than regular ones
+    sf::RectangleShape glow;  // Kept as a member so drawing doesn't copy the shape
+
+    static bool glowEnabled;  // Shared by all color walls (quality setting)
 
 public:
     // Constructor
-    ColorWallObstacle(sf::Vector2f startPos, sf::Color col, float speed);
+    ColorWallObstacle(FixedVec2 startPos, sf::Color col, Fixed speed);
+
+    void reset(FixedVec2 startPos, sf::Color col, Fixed speed) override;
+    void update(Fixed dt) override;
 
     // Override the draw method to make it look different
-    void draw(sf::RenderWindow& window) override;
+    void draw(sf::RenderTarget& target) override;
 
     // Getter for required color
     sf::Color getRequiredColor() const { return requiredColor; }
 
+    static void setGlowEnabled(bool enabled) { glowEnabled = enabled; }
+
     // Check if this is a color wall (useful for collision detection)
     bool isColorWall() const { return true; }
 };
@@ -8,7 +8,20 @@
 const int WINDOW_WIDTH = 1280;
 const int WINDOW_HEIGHT = 720;
 const std::string WINDOW_TITLE = "Color Swap Runner(Upgraded)";
-const int FPS = 60;
+const int FPS = 60;                    // Target frame rate (F4 cycles 60/120/144/240/unlimited)
+const bool ENABLE_VSYNC = false;       // F5 toggles at runtime
+const bool IDLE_WHEN_STATIC = true;    // Don't render menus/game over/unfocused window until needed
+const bool ENABLE_QUALITY_GOVERNOR = true;  // Scale effects down when frames get too slow
+
+// Internal render resolution for the game world (the HUD is always native)
+const float RENDER_SCALE = 1.0f;            // 0.5 - 1.0 of the window resolution
+const float MIN_RENDER_SCALE = 0.5f;
+const bool DYNAMIC_RENDER_SCALE = true;     // Let the quality governor pick (F6 cycles)
+
+// Input: sleep first and read input right before each tick (lower latency).
+// Set to false to get the old order: read input, update, draw, then wait to
+// present (what setFramerateLimit did).
+const bool LATE_INPUT_SAMPLING = true;
 
 // Player settings
 const float PLAYER_SIZE = 50.0f;
@@ -16,18 +29,73 @@ const float PLAYER_SPEED = 350.0f;
 const float DASH_SPEED = 800.0f;
 const float DASH_DURATION = 0.2f;
 const float DASH_COOLDOWN = 1.0f;
+const float SHAKE_DURATION = 0.3f;
+
+// Local multiplayer: 1-4 players share one world, each in their own
+// horizontal strip of the screen (1-4 on the menu picks how many)
+const int MAX_PLAYERS = 4;
+const sf::Color PLAYER_OUTLINE_COLORS[MAX_PLAYERS] = {
+    sf::Color::White, sf::Color(0, 255, 255), sf::Color(255, 0, 255), sf::Color(255, 255, 0)
+};
 
 // Game settings
 const float OBSTACLE_SPAWN_TIME = 1.5f;
 const float OBSTACLE_SPEED = 300.0f;
 const float OBSTACLE_WIDTH = 40.0f;
 const float OBSTACLE_HEIGHT = 40.0f;
-const float SPEED_INCREASE_RATE = 0.95f;
+const float SPEED_INCREASE_RATE = 0.95f;     // Spawn interval multiplier every 100 points
+const float OBSTACLE_SPEED_RATE = 1.05f;     // Obstacle speed multiplier every 100 points
+const float MAX_OBSTACLE_SPEED = 600.0f;
+const float MIN_OBSTACLE_SPAWN_TIME = 0.5f;
+const int DIFFICULTY_STEP_SCORE = 100;
+const float POWERUP_SPAWN_TIME = 5.0f;
+const int MAX_TIMERS = 4096;               // Timer slots reserved up front (more are added if needed)
+
+// Music-driven spawning: obstacles and color walls wait for beats in the
+// background music (the timers above are the fallback for quiet passages)
+const bool ENABLE_BEAT_SPAWNING = true;
+const std::string MUSIC_FILE = "assets/sounds/bg_sound.wav";
+const std::string BEAT_CACHE_SUFFIX = ".beats";  // Beat map saved next to the track
+const float BEAT_MIN_SPACING = 0.5f;     // Fraction of the spawn time allowed between beat spawns
+const float BEAT_FALLBACK_SPACING = 2.0f; // Timer spawns anyway after this many spawn times
+const float BEAT_STRONG = 1.5f;          // Beats this strong can bring a color wall
+const float BEAT_LATE_TOLERANCE = 0.1f;  // Seconds a beat may be missed by before it's dropped
+
+// Bullet patterns (spirals, fans, sine lanes...) scripted in a data file
+const bool ENABLE_PATTERNS = true;
+const std::string PATTERN_FILE = "assets/patterns/waves.pat";
+const float PATTERN_SPAWN_TIME = 10.0f;   // Start a random pattern this often
+const std::string STRESS_PATTERN = "test_storm";  // F7 starts it (10k+ bullets)
+const size_t MAX_BULLETS = 16384;         // Bullet storage is reserved once
 
 // Color Wall settings (special obstacles that require color matching)
 const float COLOR_WALL_SPAWN_TIME = 8.0f;  // Spawn a color wall every 8 seconds
 const int SCORE_COLOR_WALL_PASS = 50;      // Bonus points for passing color wall
 
+// Particles bounce off obstacles and the screen edges, stick to color walls
+// and get pushed aside by the players
+const bool ENABLE_PARTICLE_COLLISION = true;
+const float PARTICLE_CELL_SIZE = 64.0f;         // Uniform grid cell size in pixels
+const float PARTICLE_BOUNCE = 0.5f;             // Share of the speed kept after a bounce
+const float PARTICLE_DEFLECT_RADIUS = 70.0f;    // How close to a player particles get pushed
+const float PARTICLE_DEFLECT_STRENGTH = 40.0f;
+const std::string EFFECTS_FILE = "assets/effects/particles.fx";  // Particle emitters, by name
+
+// Lighting: players, power-ups and color walls light up the arena and
+// obstacles cast shadows (CPU light map, F8 toggles)
+const bool ENABLE_LIGHTING = true;
+const float LIGHT_MAP_CELL = 8.0f;              // World pixels per light map texel
+const float LIGHT_INTENSITY = 0.45f;            // Brightness of a light at its center
+const float LIGHT_RADIUS_PLAYER = 240.0f;
+const float LIGHT_RADIUS_POWERUP = 150.0f;
+const float LIGHT_RADIUS_COLOR_WALL = 320.0f;
+
+// Bloom: bright neon bleeds light into its surroundings (F9 cycles the quality)
+const bool DYNAMIC_BLOOM = true;            // Let the quality governor pick the level
+const bool BLOOM_USE_SHADER = true;         // Blur on the GPU when shaders are available
+const float BLOOM_THRESHOLD = 0.35f;        // Colors whose brightest channel is above this glow
+const float BLOOM_STRENGTH = 1.5f;
+
 // Colors - Neon theme
 const sf::Color COLOR_RED = sf::Color(255, 0, 100);
 const sf::Color COLOR_BLUE = sf::Color(0, 200, 255);
@@ -37,9 +105,40 @@ const sf::Color COLOR_PURPLE = sf::Color(200, 0, 255);
 const sf::Color COLOR_ORANGE = sf::Color(255, 150, 0);
 const sf::Color COLOR_BACKGROUND = sf::Color(10, 10, 30);
 
+// Memory
+const size_t MAX_PARTICLES = 32768;         // Particle storage is reserved once
+const size_t FRAME_ARENA_BYTES = 6 << 20;   // Transient per-frame memory (mostly particle vertices)
+const int OBSTACLE_POOL_SIZE = 32;          // Objects created up front and recycled
+const int COLOR_WALL_POOL_SIZE = 4;
+const int POWERUP_POOL_SIZE = 8;
+const float ALLOC_TEST_WARMUP = 10.0f;      // --alloc-test: seconds before checking starts
+const float ALLOC_TEST_DURATION = 60.0f;    // --alloc-test: seconds that must stay allocation-free
+
 // Scoring
 const int SCORE_PER_DODGE = 10;
 const int SCORE_POWERUP = 50;
 const int COMBO_THRESHOLD = 5;
+const float COMBO_TIMEOUT = 3.0f;          // Combo resets after this long without a dodge
+
+// Event journal (binary gameplay logs for later analysis; --journal turns
+// it on without rebuilding)
+const bool ENABLE_EVENT_JOURNAL = false;
+const std::string JOURNAL_DIRECTORY = "logs";
+
+// Prometheus metrics on 127.0.0.1 for unattended machines (--metrics turns
+// it on without rebuilding)
+const bool ENABLE_METRICS = false;
+const unsigned short METRICS_PORT = 9464;
+
+// Shared-memory render feed for tools/spectator on extra screens
+// (--spectator-feed turns it on without rebuilding)
+const bool ENABLE_SPECTATOR_FEED = false;
+
+// Submit every finished run, with its replay, to tools/leaderboard on
+// 127.0.0.1, which re-simulates it before ranking it (--leaderboard [port]
+// and --name NAME without rebuilding)
+const bool ENABLE_LEADERBOARD = false;
+const unsigned short LEADERBOARD_PORT = 9465;
+const std::string LEADERBOARD_NAME = "PLAYER";    // Up to 15 characters
 
 #endif
@@ -0,0 +1,48 @@
+#ifndef COROUTINETASK_H
+#define COROUTINETASK_H
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+
+// Recycles coroutine frames so starting a coroutine during gameplay doesn't
+// hit the heap once the pool has warmed up. Frames are carved from blocks
+// kept on a free list; anything larger than a block falls back to new.
+// Each thread has its own pool (simulations run on worker threads in
+// tools/leaderboard); a frame must be freed on the thread that made it.
+class CoroutineFramePool {
+public:
+    static const std::size_t BLOCK_SIZE = 512;
+    static const std::size_t BLOCKS_PER_CHUNK = 64;
+
+    static void* allocate(std::size_t size);
+    static void deallocate(void* frame, std::size_t size);
+
+    static std::size_t getInUse();
+    static std::size_t getCapacity();
+};
+
+// Fire-and-forget coroutine used for game sequences, e.g.
+//
+//   Task Game::shakeEffect(float intensity) {
+//       shakeIntensity = intensity;
+//       co_await timers.after(300ms);
+//       shakeIntensity = 0;
+//   }
+//
+// It runs right away until its first co_await and frees itself when it
+// finishes. One that is still waiting is destroyed by TimerWheel::reset.
+struct Task {
+    struct promise_type {
+        Task get_return_object() { return Task(); }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+
+        static void* operator new(std::size_t size) { return CoroutineFramePool::allocate(size); }
+        static void operator delete(void* frame, std::size_t size) { CoroutineFramePool::deallocate(frame, size); }
+    };
+};
+
+#endif
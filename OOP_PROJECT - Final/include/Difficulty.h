@@ -0,0 +1,49 @@
+#ifndef DIFFICULTY_H
+#define DIFFICULTY_H
+
+#include <string>
+#include "Config.h"
+#include "Fixed.h"
+
+// The knobs of the difficulty ramp. Defaults are the Config.h values; they
+// can be overridden at runtime (game: --difficulty, tools/balance_sim sweeps
+// them) without rebuilding.
+struct DifficultySettings {
+    float obstacleSpawnTime = OBSTACLE_SPAWN_TIME;      // Starting spawn interval
+    float spawnTimeRate = SPEED_INCREASE_RATE;
+    float speedRate = OBSTACLE_SPEED_RATE;
+    float colorWallSpawnTime = COLOR_WALL_SPAWN_TIME;
+    float maxObstacleSpeed = MAX_OBSTACLE_SPEED;
+    float minSpawnTime = MIN_OBSTACLE_SPAWN_TIME;
+
+    // "spawn=1.2,rate=0.9,speed_rate=1.05,wall=6,max_speed=700,min_spawn=0.4"
+    // (any subset); false and a message on stderr for anything unknown
+    bool parse(const std::string& text);
+};
+
+// Obstacle speed and spawn interval as a run goes on: both step every
+// DIFFICULTY_STEP_SCORE points until they hit their limits. Fixed-point so
+// it compounds the same on every build.
+class DifficultyRamp {
+private:
+    Fixed speed;
+    Fixed spawnTime;
+    Fixed speedRate;
+    Fixed spawnTimeRate;
+    Fixed maxSpeed;
+    Fixed minSpawnTime;
+    int lastStepScore;
+
+public:
+    DifficultyRamp();
+
+    void reset(const DifficultySettings& settings);
+
+    // True when this score took another step
+    bool update(int score);
+
+    Fixed getObstacleSpeed() const { return speed; }
+    Fixed getSpawnTime() const { return spawnTime; }
+};
+
+#endif
@@ -0,0 +1,77 @@
+#ifndef EFFECTBUFFER_H
+#define EFFECTBUFFER_H
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+
+enum class EffectType : uint8_t {
+    SHAKE,          // Sorted first so a frame's biggest shake wins
+    SOUND,
+    PARTICLES
+};
+
+enum class SoundId : uint8_t {
+    DASH,
+    WALL_PASS
+};
+
+// One queued effect - 16 bytes
+struct EffectCommand {
+    EffectType type;
+    uint8_t id;              // SoundId for sounds, particle emitter for particles
+    uint8_t count;           // Particles to emit
+    uint8_t direction;       // 256ths of a turn (turns cones and rings)
+    uint32_t color;          // sf::Color::toInteger()
+    float x, y;              // Position (shake: x = intensity)
+};
+
+// Gameplay code records what should be seen and heard here instead of
+// touching the particle system or the audio directly. After the tick the
+// game sorts the commands, merges the ones that would look the same (emits
+// of one emitter and color close together, the same sound twice, several shakes) and
+// runs them in one go. A disabled buffer (headless runs) ignores every call.
+class EffectBuffer {
+private:
+    std::vector<EffectCommand> commands;
+    size_t merged;           // Commands left after the last coalesce
+    size_t recorded;         // Commands recorded before it
+    bool enabled;
+
+    void push(const EffectCommand& command);
+
+public:
+    static const size_t CAPACITY = 1024;
+
+    EffectBuffer();
+
+    void setEnabled(bool on) { enabled = on; }
+    bool isEnabled() const { return enabled; }
+
+    // count particles from one of the ParticleSystem's emitters
+    void particles(sf::Vector2f position, sf::Color color, int emitter, int count, uint8_t direction = 0) {
+        if (!enabled) return;
+        push(EffectCommand{EffectType::PARTICLES, static_cast<uint8_t>(emitter),
+                           static_cast<uint8_t>(count < 255 ? count : 255), direction,
+                           color.toInteger(), position.x, position.y});
+    }
+    void sound(SoundId id) {
+        if (!enabled) return;
+        push(EffectCommand{EffectType::SOUND, static_cast<uint8_t>(id), 0, 0, 0, 0, 0});
+    }
+    void shake(float intensity) {
+        if (!enabled) return;
+        push(EffectCommand{EffectType::SHAKE, 0, 0, 0, 0, intensity, 0});
+    }
+
+    // Sort and merge; afterwards the commands can be read back in order
+    void coalesce();
+    size_t getCount() const { return commands.size(); }
+    const EffectCommand& getCommand(size_t i) const { return commands[i]; }
+    void clear() { commands.clear(); }
+
+    size_t getRecordedCount() const { return recorded; }
+    size_t getMergedCount() const { return merged; }
+};
+
+#endif
@@ -0,0 +1,101 @@
+#ifndef EVENTJOURNAL_H
+#define EVENTJOURNAL_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+#include "SpscRing.h"
+
+// Every gameplay event we record in the journal
+enum class GameEventType : uint8_t {
+    RUN_START,
+    SPAWN_OBSTACLE,
+    SPAWN_POWERUP,
+    SPAWN_COLOR_WALL,
+    DODGE,
+    WALL_PASS,
+    POWERUP_PICKUP,
+    DASH,
+    COLOR_CHANGE,
+    DIFFICULTY_STEP,
+    COMBO_BREAK,
+    GAME_OVER,
+    SPAWN_PATTERN,       // value = pattern index
+    COUNT
+};
+
+// Why the run ended (stored in the value field of GAME_OVER)
+enum class DeathCause : int32_t {
+    OBSTACLE,
+    COLOR_WALL,
+    PATTERN
+};
+
+// One journal entry - small and trivially copyable so it fits the ring buffer
+struct GameEvent {
+    float time;          // Seconds since the run started
+    GameEventType type;
+    float x;
+    float y;
+    int32_t value;       // Meaning depends on type (score, combo, cause, ...)
+};
+
+// Records gameplay events without ever blocking the game loop.
+// The game thread pushes into a lock-free ring; a writer thread drains the ring
+// and writes the events to disk as compact column blocks:
+//
+//   header : "EVJ1" magic, uint32 version
+//   block  : uint32 count, then count x float time, count x uint8 type,
+//            count x int16 x, count x int16 y, count x int32 value
+//   footer : uint32 0xFFFFFFFF, uint64 dropped event count
+class EventJournal {
+private:
+    SpscRing<GameEvent> ring;
+    std::thread writer;
+    std::atomic<bool> running;
+    std::atomic<uint64_t> dropped;
+    std::string filePath;
+
+    // Column buffers used only by the writer thread
+    std::vector<GameEvent> block;
+
+    void writerLoop();
+
+public:
+    static const uint32_t FILE_VERSION = 1;
+    static const size_t BLOCK_SIZE = 1024;
+    static const int MAX_NAME_ATTEMPTS = 100;     // Same-second sessions before giving up
+
+    EventJournal();
+    ~EventJournal();
+
+    // Open a new log file in the given directory and start the writer thread
+    bool start(const std::string& directory);
+    void stop();
+    bool isRunning() const { return running.load(std::memory_order_relaxed); }
+
+    // Called from the game loop - never allocates, never blocks.
+    // If the ring is full the event is dropped and counted instead.
+    void log(GameEventType type, float time, float x = 0, float y = 0, int32_t value = 0) {
+        if (!running.load(std::memory_order_relaxed)) return;
+        GameEvent e;
+        e.time = time;
+        e.type = type;
+        e.x = x;
+        e.y = y;
+        e.value = value;
+        if (!ring.tryPush(e)) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    uint64_t getDroppedCount() const { return dropped.load(std::memory_order_relaxed); }
+    const std::string& getFilePath() const { return filePath; }
+
+    // Read a whole journal file back (used by the query tool)
+    static bool readFile(const std::string& path, std::vector<GameEvent>& events, uint64_t* droppedOut = nullptr);
+};
+
+#endif
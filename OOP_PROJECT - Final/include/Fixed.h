@@ -0,0 +1,109 @@
+#ifndef FIXED_H
+#define FIXED_H
+
+#include <SFML/Graphics.hpp>
+#include <compare>
+#include <cstdint>
+
+// 16.16 fixed-point number used for all simulation state (positions,
+// velocities, speeds, hit boxes). Every operation is plain integer math, so
+// a run gives bit-identical results no matter the compiler, optimization
+// level or FPU - floats only appear when something is handed to SFML.
+class Fixed {
+private:
+    int32_t value;
+
+public:
+    static const int FRACTION_BITS = 16;
+    static const int32_t ONE = 1 << FRACTION_BITS;
+
+    constexpr Fixed() : value(0) {}
+    constexpr explicit Fixed(int whole) : value(whole * ONE) {}
+    // No silent float conversions - those have to go through fromFloat
+    Fixed(float) = delete;
+    Fixed(double) = delete;
+
+    static constexpr Fixed fromRaw(int32_t raw) {
+        Fixed f;
+        f.value = raw;
+        return f;
+    }
+
+    // Rounds to the nearest 1/65536. Done in double so it is exact, which
+    // keeps it deterministic for the same input float (constants, recorded
+    // values, the frame time).
+    static constexpr Fixed fromFloat(float f) {
+        double scaled = static_cast<double>(f) * ONE;
+        return fromRaw(static_cast<int32_t>(scaled >= 0 ? scaled + 0.5 : scaled - 0.5));
+    }
+
+    constexpr int32_t raw() const { return value; }
+    constexpr float toFloat() const { return static_cast<float>(value) / ONE; }
+    constexpr int toInt() const { return value >> FRACTION_BITS; }  // Rounds down
+
+    constexpr Fixed operator+(Fixed o) const { return fromRaw(value + o.value); }
+    constexpr Fixed operator-(Fixed o) const { return fromRaw(value - o.value); }
+    constexpr Fixed operator-() const { return fromRaw(-value); }
+    constexpr Fixed operator*(Fixed o) const {
+        return fromRaw(static_cast<int32_t>((static_cast<int64_t>(value) * o.value) >> FRACTION_BITS));
+    }
+    constexpr Fixed operator/(Fixed o) const {
+        return fromRaw(static_cast<int32_t>((static_cast<int64_t>(value) << FRACTION_BITS) / o.value));
+    }
+    Fixed& operator+=(Fixed o) { value += o.value; return *this; }
+    Fixed& operator-=(Fixed o) { value -= o.value; return *this; }
+    Fixed& operator*=(Fixed o) { return *this = *this * o; }
+
+    constexpr bool operator==(Fixed o) const { return value == o.value; }
+    constexpr auto operator<=>(Fixed o) const { return value <=> o.value; }
+
+    constexpr Fixed abs() const { return value < 0 ? fromRaw(-value) : *this; }
+
+    // Integer square root (for normalizing directions)
+    static Fixed sqrt(Fixed f);
+
+    // Angles are in degrees, like the rest of the game. Accurate to about 2e-4.
+    static Fixed sinDeg(Fixed degrees);
+    static Fixed cosDeg(Fixed degrees) { return sinDeg(degrees + Fixed(90)); }
+};
+
+struct FixedVec2 {
+    Fixed x;
+    Fixed y;
+
+    constexpr FixedVec2() {}
+    constexpr FixedVec2(Fixed px, Fixed py) : x(px), y(py) {}
+
+    static FixedVec2 fromVector2f(sf::Vector2f v) { return FixedVec2(Fixed::fromFloat(v.x), Fixed::fromFloat(v.y)); }
+    sf::Vector2f toVector2f() const { return sf::Vector2f(x.toFloat(), y.toFloat()); }
+
+    constexpr FixedVec2 operator+(FixedVec2 o) const { return FixedVec2(x + o.x, y + o.y); }
+    constexpr FixedVec2 operator-(FixedVec2 o) const { return FixedVec2(x - o.x, y - o.y); }
+    constexpr FixedVec2 operator*(Fixed s) const { return FixedVec2(x * s, y * s); }
+    FixedVec2& operator+=(FixedVec2 o) { x += o.x; y += o.y; return *this; }
+    constexpr bool operator==(FixedVec2 o) const { return x == o.x && y == o.y; }
+
+    Fixed length() const;
+};
+
+// Axis-aligned box in simulation units
+struct FixedRect {
+    Fixed left, top, width, height;
+
+    constexpr FixedRect() {}
+    constexpr FixedRect(Fixed l, Fixed t, Fixed w, Fixed h) : left(l), top(t), width(w), height(h) {}
+
+    // Box of the given half size around a center point
+    static constexpr FixedRect around(FixedVec2 center, Fixed halfW, Fixed halfH) {
+        return FixedRect(center.x - halfW, center.y - halfH, halfW + halfW, halfH + halfH);
+    }
+
+    constexpr bool intersects(const FixedRect& o) const {
+        return left < o.left + o.width && o.left < left + width &&
+               top < o.top + o.height && o.top < top + height;
+    }
+
+    sf::FloatRect toFloatRect() const { return sf::FloatRect(left.toFloat(), top.toFloat(), width.toFloat(), height.toFloat()); }
+};
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef FONTATLAS_H
+#define FONTATLAS_H
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include "BakedFont.h"
+
+// The baked UI font (see BakedFont.h) as one texture plus a glyph lookup per
+// style. Unpacked once at startup - no font files, no FreeType.
+class FontAtlas {
+private:
+    sf::Texture texture;
+    int16_t lookup[static_cast<int>(FontStyle::COUNT)][128];   // Into BAKED_GLYPHS, -1 if not baked
+
+public:
+    FontAtlas();
+
+    const sf::Texture& getTexture() const { return texture; }
+
+    // nullptr if the style doesn't have that character
+    const BakedGlyph* findGlyph(FontStyle style, char c) const;
+    float getLineSpacing(FontStyle style) const;
+    float getKerning(FontStyle style, char first, char second) const;
+    unsigned getCharacterSize(FontStyle style) const { return BAKED_FONT_STYLES[static_cast<int>(style)].size; }
+    unsigned getOutlineThickness(FontStyle style) const { return BAKED_FONT_STYLES[static_cast<int>(style)].outline; }
+};
+
+#endif
@@ -0,0 +1,57 @@
+#ifndef FRAMEARENA_H
+#define FRAMEARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+// Bump allocator for objects that only live for one frame.
+// allocate() just moves a pointer forward; reset() at the end of the frame
+// throws everything away at once. Nothing here ever calls a destructor, so
+// only trivially destructible types may be stored.
+class FrameArena {
+private:
+    std::unique_ptr<char[]> buffer;
+    size_t capacity;
+    size_t offset;
+    size_t peak;       // Highest usage seen since construction
+
+public:
+    explicit FrameArena(size_t bytes) : buffer(new char[bytes]), capacity(bytes), offset(0), peak(0) {}
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    // Returns nullptr if the arena is full
+    void* allocate(size_t bytes, size_t alignment) {
+        size_t start = (offset + alignment - 1) & ~(alignment - 1);
+        if (start + bytes > capacity) return nullptr;
+        offset = start + bytes;
+        if (offset > peak) peak = offset;
+        return buffer.get() + start;
+    }
+
+    // Default-constructed array of count objects (nullptr if full)
+    template <typename T>
+    T* allocateArray(size_t count) {
+        static_assert(std::is_trivially_destructible<T>::value,
+                      "FrameArena never runs destructors");
+        void* memory = allocate(sizeof(T) * count, alignof(T));
+        if (!memory) return nullptr;
+        T* items = static_cast<T*>(memory);
+        for (size_t i = 0; i < count; i++) {
+            new (items + i) T();
+        }
+        return items;
+    }
+
+    // Everything allocated since the last reset becomes invalid
+    void reset() { offset = 0; }
+
+    size_t getUsed() const { return offset; }
+    size_t getPeak() const { return peak; }
+    size_t getCapacity() const { return capacity; }
+};
+
+#endif
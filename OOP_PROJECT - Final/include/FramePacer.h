@@ -0,0 +1,70 @@
+#ifndef FRAMEPACER_H
+#define FRAMEPACER_H
+
+#include <SFML/System.hpp>
+#include <functional>
+
+// Replaces window.setFramerateLimit(). sf::sleep alone is only accurate to a
+// millisecond or two, so the pacer sleeps while the deadline is far away and
+// spins for the last stretch. It also keeps frame time statistics.
+class FramePacer {
+private:
+    static const int HISTORY = 240;
+
+    sf::Clock clock;
+    int targetFps;
+    sf::Int64 period;          // Microseconds per frame (0 = unlimited)
+    bool vsync;
+
+    sf::Int64 nextPresent;     // When the next frame should reach the screen
+    sf::Int64 lastPresent;
+    sf::Int64 workStart;
+    sf::Int64 workEstimate;    // Smoothed update + render + display time
+    sf::Int64 lastWork;        // Work time of the most recent frame
+    sf::Int64 sleepOvershoot;  // Smoothed amount sf::sleep oversleeps by
+
+    // Recent frame times in microseconds
+    sf::Int64 frameTimes[HISTORY];
+    int frameCount;
+    int frameIndex;
+
+public:
+    FramePacer();
+
+    sf::Int64 now() const { return clock.getElapsedTime().asMicroseconds(); }
+
+    void setTargetFps(int fps);  // 0 = unlimited
+    int getTargetFps() const { return targetFps; }
+
+    // With vsync the driver does the waiting inside display(); the target
+    // fps should then be the monitor refresh rate
+    void setVsync(bool enabled) { vsync = enabled; }
+    bool getVsync() const { return vsync; }
+
+    // Latest time to sample input so the frame is still ready on time
+    sf::Int64 getSampleDeadline() const;
+    sf::Int64 getPresentDeadline() const { return nextPresent; }
+
+    // Hybrid wait: sleep in short slices (calling poll in between), then spin
+    void waitUntil(sf::Int64 deadline, const std::function<void()>& poll);
+
+    // Hold a finished frame until its present time, like setFramerateLimit
+    // does inside display(). The wait doesn't count as work.
+    void waitToPresent();
+
+    // Bracket the work of a frame
+    void beginWork() { workStart = now(); }
+    void framePresented();
+
+    float getLastWorkMs() const { return lastWork / 1000.0f; }
+
+    // Start a fresh schedule after an idle period
+    void resync();
+
+    // Statistics over the last HISTORY frames (milliseconds)
+    float getAverageFrameMs() const;
+    float getFrameStdDevMs() const;
+    float getMaxFrameMs() const;
+};
+
+#endif
@@ -5,13 +5,30 @@
 #include <SFML/Audio.hpp>
 #include <vector>
 #include <memory>
+#include <string>
 #include "Config.h"
-#include "Player.h"
-#include "Obstacle.h"
-#include "ColorWallObstacle.h"  // Include the new color wall class
-#include "PowerUp.h"
+#include "Simulation.h"
 #include "ParticleSystem.h"
 #include "UIManager.h"
+#include "EventJournal.h"
+#include "InputManager.h"
+#include "FramePacer.h"
+#include "QualityGovernor.h"
+#include "AllocTracker.h"
+#include "FrameArena.h"
+#include "MusicStream.h"
+#include "BeatDetector.h"
+#include "PatternScript.h"
+#include "CoroutineTask.h"
+#include "WorkerPool.h"
+#include "LightMap.h"
+#include "Bloom.h"
+#include "Difficulty.h"
+#include "MetricsExporter.h"
+#include "SpectatorFeed.h"
+#include "StateHash.h"
+#include "Replay.h"
+#include "LeaderboardClient.h"
 
 enum class GameState {
     MENU,
@@ -24,25 +41,30 @@ private:
     sf::RenderWindow window;
     GameState state;
     
-    // Game objects
-    Player player;
-    std::vector<std::unique_ptr<Obstacle>> obstacles;
-    std::vector<std::unique_ptr<PowerUp>> powerUps;
+    // The rules of the run; the game feeds it input and draws it
+    Simulation sim;
+    SimInput tickInput;         // What goes into this tick
+    bool stressQueued;          // F7 was pressed since the last tick
+    int playerCount;            // Local players picked on the menu (1-4)
+
     ParticleSystem particles;
+    ParticleCollider particleCollider;  // Lets particles bounce off / stick to the world
+    int dashTrailEmitter;       // From EFFECTS_FILE (the simulation has the others)
+    int dashTrails[MAX_PLAYERS];        // Running trail emitter per dashing player (-1 = none)
     UIManager ui;
+
+    // Bullet patterns, shared with the simulation
+    PatternLibrary patternLibrary;
+
+    // Every run starts from a random seed unless --seed fixes it
+    uint32_t fixedSeed;
+    bool useFixedSeed;
     
-    // Game stats
-    int score;
-    int combo;
-    float obstacleSpawnTimer;
-    float currentObstacleSpeed;
-    float currentSpawnTime;
-    float powerUpSpawnTimer;
-    float colorWallSpawnTimer;  // Timer for spawning color walls
-    
-    // Screen shake
+    // Screen shake. It has its own clock: the simulation's wheel is part of
+    // the state hash, and shake is only for show.
+    TimerWheel effectTimers;
     float shakeIntensity;
-    float shakeTimer;
+    int shakeCount;             // Only the latest shake may end the shaking
     sf::Vector2f cameraOffset;
     
     // Background
@@ -55,19 +77,100 @@ private:
     sf::SoundBuffer wallPassBuffer;
     sf::Sound wallPassSound;
 
-    // Background music
-    sf::Music backgroundMusic;
+    // Background music, analysed for beats as it plays
+    BeatDetector beatDetector;      // Declared first so it outlives the stream feeding it
+    MusicStream backgroundMusic;
+    static const int MAX_PENDING_BEATS = 32;
+    BeatEvent pendingBeats[MAX_PENDING_BEATS];  // Detected ahead of playback, waiting for their time
+    int pendingBeatCount;
+
+    // Gameplay event log
+    EventJournal journal;
+
+    // Live metrics for a scraper (off unless enabled)
+    MetricsExporter metrics;
+
+    // Render snapshots for spectator screens (off unless enabled)
+    SpectatorFeed spectatorFeed;
+
+    // Per-tick simulation state hashes (off unless enabled)
+    StateHashLog stateHashes;
+
+    // Every run is recorded and submitted for the leaderboard (off unless enabled)
+    LeaderboardClient leaderboard;
+    Replay replay;
+    std::string playerName;
+
+    // Input and frame timing
+    InputManager input;
+    FramePacer pacer;
+    QualityGovernor governor;
+    QualityTier appliedTier;    // Tier whose settings are currently in effect
+    bool showStats;             // F3 toggles the stats overlay
+    bool needsRedraw;           // Static screens only redraw when this is set
+
+    // Memory
+    FrameArena frameArena;      // Transient per-frame memory, reset every frame
+    FrameAllocStats lastFrameAllocs;
+
+    // Rendering: the world goes into a texture at renderScale x the window
+    // resolution and is upscaled; the HUD is drawn at native resolution
+    sf::RenderTexture worldTexture;
+    sf::Sprite worldSprite;
+    sf::RectangleShape paneDivider; // Line between split-screen panes
+    WorkerPool renderWorkers;       // Threads for the CPU render passes
+    LightMap lightMap;              // Colored lights and shadows added over the world
+    bool lightingEnabled;           // F8 toggles
+    bool lightingAllowed;           // The quality tier can afford it
+    Bloom bloom;
+    bool dynamicBloom;              // Follow the quality governor
+    sf::View screenView;            // Letterboxed WINDOW_WIDTH x WINDOW_HEIGHT view
+    sf::Vector2u viewportPixels;    // Size of the letterboxed area in pixels
+    float renderScale;
+    bool dynamicRenderScale;        // Follow the quality governor
+    bool allocTestMode;         // Fail if steady-state gameplay allocates
+    bool allocTestFailed;
 
 public:
     Game();
     
-    // Main game loop
-    void run();
+    // Main game loop - returns the process exit code
+    int run();
+
+    // Automated run: play with an invulnerable player and fail on any
+    // gameplay allocation once warmed up
+    void enableAllocTest();
+
+    // Runtime difficulty overrides (--difficulty); call before a run starts
+    void setDifficulty(const DifficultySettings& settings);
+
+    // Serve Prometheus metrics on 127.0.0.1 (--metrics)
+    bool enableMetrics(unsigned short port);
+
+    // Publish every frame for tools/spectator (--spectator-feed)
+    bool enableSpectatorFeed();
+
+    // Record gameplay events to JOURNAL_DIRECTORY (--journal)
+    bool enableJournal();
+
+    // Write a hash of the simulation state every tick (--state-hash). The
+    // game then steps a fixed 1/FPS per frame, so runs can be compared.
+    bool enableStateHashing(const std::string& path);
+
+    // Start every run from this seed instead of a random one (--seed)
+    void setSeed(uint32_t seed);
+
+    // Record every run and submit it to tools/leaderboard on 127.0.0.1
+    // when it ends (--leaderboard), under this name (--name)
+    void enableLeaderboard(unsigned short port);
+    void setPlayerName(const std::string& name);
     
 private:
     // Game loop components
     void processEvents();
-    void update(float dt);
+    void handleEvent(const sf::Event& event);
+    bool isIdle() const;
+    void update(float dt, const InputState* in);
     void render();
     
     // State management
@@ -75,16 +178,23 @@ private:
     void resetGame();
     void gameOver();
     
-    // Game logic
-    void spawnObstacle();
-    void spawnPowerUp();
-    void spawnColorWall();  // Spawn special color wall obstacles
-    void checkCollisions();
-    void updateDifficulty();
+    // Cosmetics of the simulation's ticks (on its game clock)
+    Task shakeEffect(float intensity);
     void screenShake(float intensity);
+    void executeEffects();
+    void updateParticles(float dt);
+    void updateQuality(float dt);
+    void updateBeats();
+    void checkFrameAllocations();
+    void updateMetrics(float dt);
+    void publishSpectatorFrame();
+    void updateScreenLayout(unsigned windowWidth, unsigned windowHeight);
+    void setRenderScale(float scale);
+    void drawPanes(unsigned internalWidth, unsigned internalHeight);
+    void updateLighting();
+    void updateGlow();
     
     // Helpers
-    sf::Color getRandomColor();
     void createBackground();
 };
 
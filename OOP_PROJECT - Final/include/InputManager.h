@@ -0,0 +1,70 @@
+#ifndef INPUTMANAGER_H
+#define INPUTMANAGER_H
+
+#include <SFML/Graphics.hpp>
+#include "Config.h"
+
+// Everything the simulation needs to know about input for one tick
+struct InputState {
+    sf::Vector2f move;      // -1, 0 or 1 on each axis
+    bool dash;              // Dash was pressed since the last tick
+    bool changeColor;       // Color change was pressed since the last tick
+};
+
+// The keys of one local player
+struct KeyBindings {
+    sf::Keyboard::Key up, down, left, right;
+    sf::Keyboard::Key dash, color;
+};
+
+// Turns timestamped window events into per-tick input states.
+// Key state is tracked from events (not sf::Keyboard::isKeyPressed) so a tap
+// shorter than a frame is never lost, and every key press remembers when it
+// was polled so we can measure input-to-present latency.
+class InputManager {
+private:
+    static const int MAX_PENDING = 32;
+    static const int LATENCY_HISTORY = 120;
+
+    bool keyDown[sf::Keyboard::KeyCount];
+    bool keyTapped[sf::Keyboard::KeyCount];  // Pressed (maybe already released) since last sample
+    bool dashQueued[MAX_PLAYERS];
+    bool colorQueued[MAX_PLAYERS];
+
+    // Timestamps of gameplay key presses waiting to be sampled / presented
+    sf::Int64 queuedStamps[MAX_PENDING];
+    int queuedCount;
+    sf::Int64 sampledStamps[MAX_PENDING];
+    int sampledCount;
+
+    // Recent input-to-present latencies in microseconds
+    sf::Int64 latencies[LATENCY_HISTORY];
+    int latencyCount;
+    int latencyIndex;
+
+    bool isHeld(sf::Keyboard::Key key) const;
+    sf::Vector2f readMove(const KeyBindings& keys) const;
+
+public:
+    InputManager();
+
+    // Feed one polled event, stamped with the time it was polled (microseconds)
+    void handleEvent(const sf::Event& event, sf::Int64 now);
+
+    // Build the input states of the first count players for the next tick -
+    // call as late as possible. A single player can also move with the arrows.
+    void sample(InputState* states, int count);
+
+    static const KeyBindings& getBindings(int player);
+
+    // Call right after window.display() to close the latency measurement
+    void notePresented(sf::Int64 now);
+
+    // Forget all keys (focus lost, game reset)
+    void clear();
+
+    float getAverageLatencyMs() const;
+    float getMaxLatencyMs() const;
+};
+
+#endif
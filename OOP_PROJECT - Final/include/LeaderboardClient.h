@@ -0,0 +1,50 @@
+#ifndef LEADERBOARDCLIENT_H
+#define LEADERBOARDCLIENT_H
+
+#include <SFML/Network.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Hands finished runs (serialized replays) to the local leaderboard service,
+// tools/leaderboard, over HTTP on 127.0.0.1. Sending happens on the client's
+// own thread, so the game over screen never waits on the network; the
+// service only queues the run, and it shows up in the service's /top list
+// once a worker has re-simulated it and the score checks out. Problems are
+// only reported on stderr.
+class LeaderboardClient {
+public:
+    static const size_t MAX_PENDING = 8;    // Older runs are dropped beyond this
+
+private:
+    std::thread sender;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::deque<std::vector<uint8_t>> pending;
+    bool stopping;
+    std::atomic<bool> running;
+    unsigned short port;
+
+    void senderLoop();
+    void send(const std::vector<uint8_t>& replay);
+
+public:
+    LeaderboardClient();
+    ~LeaderboardClient();
+
+    LeaderboardClient(const LeaderboardClient&) = delete;
+    LeaderboardClient& operator=(const LeaderboardClient&) = delete;
+
+    void start(unsigned short servicePort);
+    void stop();
+    bool isRunning() const { return running.load(std::memory_order_relaxed); }
+
+    // Game thread - takes the bytes and returns right away
+    void submit(std::vector<uint8_t>&& replay);
+};
+
+#endif
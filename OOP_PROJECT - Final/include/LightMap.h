@@ -0,0 +1,85 @@
+#ifndef LIGHTMAP_H
+#define LIGHTMAP_H
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+#include "WorkerPool.h"
+
+// Real 2D lighting for the neon theme: players, power-ups and color walls are
+// colored point lights, and the regular obstacles cast shadows.
+//
+// Everything is computed on the CPU at 1/LIGHT_MAP_CELL of the world
+// resolution, so it looks the same with software GL and needs no shaders:
+//   1. every light builds a 1D shadow map - the nearest occluder in each of
+//      SHADOW_BINS directions around it
+//   2. the cells are shaded four at a time (SSE), split into row bands over
+//      the render worker threads
+// The result is uploaded as a small texture and added over the world.
+class LightMap {
+public:
+    static const int MAX_LIGHTS = 64;
+    static const int MAX_OCCLUDERS = 256;
+    static const int SHADOW_BINS = 256;      // Directions per light (power of two)
+
+private:
+    struct Light {
+        float x, y;
+        float radius;
+        float red, green, blue;
+    };
+
+    struct Occluder {
+        float cornerX[4], cornerY[4];        // In order around the box
+        float centerX, centerY;
+        float boundRadius;
+    };
+
+    int width;                  // Cells
+    int height;
+    int stride;                 // Row length rounded up to a multiple of 4
+
+    Light lights[MAX_LIGHTS];
+    int lightCount;
+    Occluder occluders[MAX_OCCLUDERS];
+    int occluderCount;
+
+    // Squared distance to the nearest occluder, SHADOW_BINS per light
+    std::vector<float> shadowDepth;
+    float binDirectionX[SHADOW_BINS];
+    float binDirectionY[SHADOW_BINS];
+
+    // Accumulated light, one plane per channel
+    std::vector<float> red;
+    std::vector<float> green;
+    std::vector<float> blue;
+    std::vector<uint8_t> pixels;
+
+    sf::Texture texture;
+    sf::Sprite sprite;
+
+    float lastMs;
+
+    void buildShadows(int light);
+    void castEdge(const Light& light, float* depth, float ax, float ay, float bx, float by);
+    void shadeRows(int firstRow, int lastRow);
+    void shadeSpan(const Light& light, const float* depth, int row, int firstCell, int lastCell);
+
+public:
+    LightMap();
+
+    // Collect this frame's lights and occluders, then compute()
+    void clear();
+    void addLight(sf::Vector2f position, float radius, sf::Color color);
+    void addOccluder(sf::Vector2f center, sf::Vector2f halfSize, float cosRotation, float sinRotation);
+    void compute(WorkerPool& pool);
+
+    // Adds the light over whatever the target already shows (world units)
+    void draw(sf::RenderTarget& target);
+
+    float getLastMs() const { return lastMs; }
+    int getLightCount() const { return lightCount; }
+    int getOccluderCount() const { return occluderCount; }
+};
+
+#endif
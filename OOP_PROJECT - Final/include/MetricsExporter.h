@@ -0,0 +1,93 @@
+#ifndef METRICSEXPORTER_H
+#define METRICSEXPORTER_H
+
+#include <SFML/Network.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+// Live metrics for unattended (kiosk) machines, in the Prometheus text
+// format on a local port:  curl http://127.0.0.1:9464/metrics
+//
+// The game loop only stores into relaxed atomics. The exporter's own thread
+// reads them and answers every scrape, so a slow or stuck scraper never
+// costs a frame. Reads of different metrics aren't one snapshot - fine for
+// monitoring.
+//
+// Process memory is read at scrape time; on Windows that needs psapi
+// (link -lpsapi).
+class MetricsExporter {
+public:
+    static const int FRAME_BUCKETS = 10;        // Including +Inf
+    static const int SCORE_BUCKETS = 8;
+    static const int DURATION_BUCKETS = 7;
+
+private:
+    // Game thread -> exporter thread. Histogram buckets are per bucket
+    // (made cumulative when served).
+    std::atomic<uint64_t> frameBuckets[FRAME_BUCKETS];
+    std::atomic<uint64_t> frameMicros;
+    std::atomic<uint32_t> particles;
+    std::atomic<uint32_t> obstacles;
+    std::atomic<uint32_t> powerUps;
+    std::atomic<uint32_t> bullets;
+    std::atomic<uint32_t> voicesPlaying;
+    std::atomic<uint32_t> voices;
+    std::atomic<uint64_t> allocations;
+    std::atomic<uint64_t> allocatedBytes;
+    std::atomic<uint64_t> arenaPeak;
+    std::atomic<uint64_t> uiTextUpdates;
+    std::atomic<uint64_t> gamesStarted;
+    std::atomic<uint64_t> scoreBuckets[SCORE_BUCKETS];
+    std::atomic<uint64_t> scoreSum;
+    std::atomic<uint64_t> durationBuckets[DURATION_BUCKETS];
+    std::atomic<uint64_t> durationMillis;
+    std::atomic<int32_t> currentScore;
+    std::atomic<int32_t> bestScore;
+    std::atomic<bool> playing;
+
+    // Exporter thread
+    std::thread server;
+    std::atomic<bool> running;
+    sf::TcpListener listener;
+    std::string page;               // Reused for every scrape
+    int64_t startTime;              // Steady clock, microseconds
+
+    void serverLoop();
+    void answer(sf::TcpSocket& client);
+    void buildPage();
+
+public:
+    MetricsExporter();
+    ~MetricsExporter();
+
+    MetricsExporter(const MetricsExporter&) = delete;
+    MetricsExporter& operator=(const MetricsExporter&) = delete;
+
+    // Listens on 127.0.0.1 only; false if the port is taken
+    bool start(unsigned short port);
+    void stop();
+    bool isRunning() const { return running.load(std::memory_order_relaxed); }
+
+    // Game thread - never blocks, never allocates
+    void recordFrame(float seconds);
+    void setWorldCounts(size_t particleCount, size_t obstacleCount, size_t powerUpCount, size_t bulletCount) {
+        particles.store(static_cast<uint32_t>(particleCount), std::memory_order_relaxed);
+        obstacles.store(static_cast<uint32_t>(obstacleCount), std::memory_order_relaxed);
+        powerUps.store(static_cast<uint32_t>(powerUpCount), std::memory_order_relaxed);
+        bullets.store(static_cast<uint32_t>(bulletCount), std::memory_order_relaxed);
+    }
+    void setAudioVoices(int playingCount, int total) {
+        voicesPlaying.store(static_cast<uint32_t>(playingCount), std::memory_order_relaxed);
+        voices.store(static_cast<uint32_t>(total), std::memory_order_relaxed);
+    }
+    void addAllocations(uint64_t count, uint64_t bytes, size_t framePeak);
+    void setUiTextUpdates(uint64_t count) { uiTextUpdates.store(count, std::memory_order_relaxed); }
+    void setScore(int score) { currentScore.store(score, std::memory_order_relaxed); }
+    void gameStarted();
+    void gameFinished(int score, float seconds);
+};
+
+#endif
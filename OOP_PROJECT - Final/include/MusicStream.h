@@ -0,0 +1,40 @@
+#ifndef MUSICSTREAM_H
+#define MUSICSTREAM_H
+
+#include <SFML/Audio.hpp>
+#include <string>
+#include <vector>
+#include "BeatDetector.h"
+
+// Streams a music file (looping forever) like sf::Music, but also hands a
+// mono copy of every chunk to a BeatDetector as SFML's audio thread reads it.
+// The tap only copies samples into a ring, so playback is never held up.
+class MusicStream : public sf::SoundStream {
+private:
+    sf::InputSoundFile file;
+    std::vector<sf::Int16> samples;  // One chunk, filled by onGetData
+    unsigned channels;
+    BeatDetector* detector;
+
+    AudioBlock pending;              // Block being filled for the detector
+    int pendingCount;
+    uint64_t framePosition;          // Frames handed to SFML so far (keeps counting across loops)
+
+    void tap(const sf::Int16* data, std::size_t count);
+
+protected:
+    bool onGetData(Chunk& data) override;
+    void onSeek(sf::Time timeOffset) override;
+
+public:
+    MusicStream();
+    ~MusicStream();
+
+    // detector may be nullptr to just play the file
+    bool openFromFile(const std::string& path, BeatDetector* beatDetector);
+
+    // Frames in one loop of the track
+    uint64_t getTrackFrames() const;
+};
+
+#endif
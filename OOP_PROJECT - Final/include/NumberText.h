@@ -0,0 +1,43 @@
+#ifndef NUMBERTEXT_H
+#define NUMBERTEXT_H
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include "BakedText.h"
+
+// A fixed label followed by a changing number, e.g. "Score: 120".
+// Label and number are one BakedText that is only rebuilt when the number
+// actually changes; rebuilding reuses its vertices, so nothing allocates.
+class NumberText {
+private:
+    static const int MAX_LENGTH = 16;
+    static const int MAX_LABEL = 32;
+
+    BakedText text;
+    char buffer[MAX_LABEL + MAX_LENGTH + 1];   // Label, then the value
+    int labelLength;
+    bool centered;
+    uint64_t rebuilds;
+
+    void rebuild();
+
+public:
+    NumberText();
+
+    void setup(const FontAtlas& font, FontStyle style, const char* label,
+               sf::Color fill, sf::Color outline = sf::Color::Black);
+
+    void setPosition(float x, float y) { text.setPosition(x, y); }
+    void setCentered(bool c);
+    void setFillColor(sf::Color color) { text.setFillColor(color); }
+
+    // Characters the style doesn't have are skipped
+    void setValue(const char* value);
+    void setValue(int number);
+
+    float getWidth() const { return text.getLocalBounds().width; }
+    uint64_t getRebuildCount() const { return rebuilds; }
+    void draw(sf::RenderWindow& window) { window.draw(text); }
+};
+
+#endif
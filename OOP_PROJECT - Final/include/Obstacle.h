@@ -3,35 +3,70 @@
 
 #include <SFML/Graphics.hpp>
 #include "Config.h"
+#include "Fixed.h"
+
+namespace StateHash { class Stream; }
 
 class Obstacle {
 protected:  // Changed to protected so child classes can access these
     sf::RectangleShape shape;
-    sf::Vector2f position;
-    sf::Vector2f velocity;
+    FixedVec2 position;
+    FixedVec2 velocity;
     sf::Color color;
     bool isActive;
-    float rotation;
-    float rotationSpeed;
+    Fixed rotation;             // Degrees
+    Fixed rotationSpeed;
+
+    // Collision shape: half size (including outline) and the rotation's
+    // sin/cos, computed once per tick for the narrowphase
+    FixedVec2 halfSize;
+    Fixed cosRotation;
+    Fixed sinRotation;
+
+    // Pose at the start of the tick, for the swept collision test
+    FixedVec2 previousPosition;
+    Fixed previousCos;
+    Fixed previousSin;
 
 public:
-    Obstacle(sf::Vector2f startPos, sf::Color col, float speed);
+    Obstacle(FixedVec2 startPos, sf::Color col, Fixed speed);
     virtual ~Obstacle() {}  // Virtual destructor for proper inheritance
 
+    // Reuse a finished obstacle instead of allocating a new one
+    virtual void reset(FixedVec2 startPos, sf::Color col, Fixed speed);
+
     // Update
-    virtual void update(float dt);  // Virtual so child classes can override
+    virtual void update(Fixed dt);  // Virtual so child classes can override
 
     // Getters
-    sf::Vector2f getPosition() const { return position; }
+    sf::Vector2f getPosition() const { return position.toVector2f(); }
+    FixedVec2 getFixedPosition() const { return position; }
+    sf::Vector2f getVelocity() const { return velocity.toVector2f(); }
     sf::FloatRect getBounds() const { return shape.getGlobalBounds(); }
     bool active() const { return isActive; }
     sf::Color getColor() const { return color; }
+    FixedVec2 getHalfSize() const { return halfSize; }
+    Fixed getCosRotation() const { return cosRotation; }
+    Fixed getSinRotation() const { return sinRotation; }
+    float getRotation() const { return rotation.toFloat(); }
+    sf::Vector2f getSize() const { return shape.getSize(); }            // As drawn, without the outline
+    float getOutlineThickness() const { return shape.getOutlineThickness(); }
+    FixedVec2 getPreviousPosition() const { return previousPosition; }
+    Fixed getPreviousCos() const { return previousCos; }
+    Fixed getPreviousSin() const { return previousSin; }
+
+    // Used to cross-check the fast collision test against the reference one
+    sf::Transform getTransform() const { return shape.getTransform(); }
+    sf::FloatRect getLocalBounds() const { return shape.getLocalBounds(); }
 
     // Set inactive
     void deactivate() { isActive = false; }
 
+    // Simulation state for the per-tick state hash
+    void hashState(StateHash::Stream& stream) const;
+
     // Drawing - virtual so child classes can override
-    virtual void draw(sf::RenderWindow& window);
+    virtual void draw(sf::RenderTarget& target);
 
     // Virtual method to check if this is a color wall
     virtual bool isColorWall() const { return false; }
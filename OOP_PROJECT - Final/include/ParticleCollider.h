@@ -0,0 +1,82 @@
+#ifndef PARTICLECOLLIDER_H
+#define PARTICLECOLLIDER_H
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+
+struct Particle;
+
+// What a particle does when it runs into a box
+enum class ParticleResponse : uint8_t {
+    BOUNCE,     // Pushed out and reflected (obstacles)
+    STICK       // Rides along with the box (color walls)
+};
+
+// Lets particles interact with the world: they bounce off obstacles and the
+// screen edges, stick to color walls and get pushed aside by the players.
+//
+// Every frame the boxes are put into a uniform grid over the screen, then the
+// particles are sorted into the same cells (counting sort, no allocations), so
+// each cell tests its particles against just the few boxes overlapping it.
+// Purely visual - none of this feeds back into the simulation.
+class ParticleCollider {
+public:
+    static const int MAX_DEFLECTORS = 4;
+
+private:
+    struct Box {
+        float centerX, centerY;
+        float halfW, halfH;
+        float cosA, sinA;
+        float velocityX, velocityY;
+        ParticleResponse response;
+    };
+
+    struct Deflector {
+        float x, y;
+        float radius;
+    };
+
+    int columns;
+    int rows;
+    float inverseCellSize;
+
+    std::vector<Box> boxes;
+    Deflector deflectors[MAX_DEFLECTORS];
+    int deflectorCount;
+
+    // Boxes per cell: cellBoxStart[c] .. cellBoxStart[c + 1] in cellBoxes
+    std::vector<uint32_t> cellBoxStart;
+    std::vector<uint16_t> cellBoxes;
+
+    // Particles per cell, rebuilt in resolve()
+    std::vector<uint32_t> particleCell;
+    std::vector<uint32_t> cellParticleStart;
+    std::vector<uint32_t> sortedParticles;
+
+    float lastMs;
+    size_t lastTests;
+
+    int cellIndex(float x, float y) const;
+    void collideCell(Particle* particles, int cell);
+
+public:
+    ParticleCollider();
+
+    // Collect the world for this frame, then build() the grid
+    void clear();
+    void addBox(sf::Vector2f center, sf::Vector2f halfSize, float cosRotation, float sinRotation,
+                sf::Vector2f velocity, ParticleResponse response);
+    void addDeflector(sf::Vector2f center, float radius);
+    void build();
+
+    // Push already-integrated particles out of whatever they ran into
+    void resolve(Particle* particles, size_t count, float dt);
+
+    float getLastMs() const { return lastMs; }
+    size_t getLastTests() const { return lastTests; }       // Particle/box pairs tested
+    size_t getBoxCount() const { return boxes.size(); }
+};
+
+#endif
@@ -2,43 +2,127 @@
 #define PARTICLESYSTEM_H
 
 #include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <string>
 #include <vector>
-#include <cmath>
-#include <random>
+#include "FrameArena.h"
+#include "ParticleCollider.h"
 
 // Simple particle struct
 struct Particle {
     sf::Vector2f position;
     sf::Vector2f velocity;
-    sf::Color color;
-    float lifetime;
-    float size;
+    sf::Color color;        // Current color, from the emitter's curves
+    float size;             // Current radius, from the emitter's curves
+    sf::Color baseColor;    // The color it was emitted with
+    float baseSize;
+    float age;              // 0 at birth, 1 at death
+    float ageRate;          // 1 / lifetime
+    uint8_t emitter;
+};
+
+enum class EmitterShape : uint8_t {
+    BURST,          // Every direction at once
+    CONE,           // Within spread degrees around the direction
+    RING,           // Evenly spaced around the circle, turned by the direction
+    CONTINUOUS      // count per second while running, within spread
+};
+
+// One effect from the effects file. The curves are sampled into tables when
+// the file is loaded, so aging a particle is a few table lookups.
+struct ParticleEmitter {
+    static const int CURVE_SAMPLES = 64;
+
+    // A color curve entry: baseWeight/256 of the emitted color plus a fixed
+    // color, already scaled by the rest of the weight
+    struct ColorSample {
+        uint16_t baseWeight;
+        uint16_t r, g, b;
+    };
+
+    std::string name;
+    EmitterShape shape;
+    int count;                      // Per emit (continuous: per second)
+    float speedMin, speedMax;
+    float lifetimeMin, lifetimeMax;
+    float sizeMin, sizeMax;
+    float spread;                   // Degrees
+    float sizeCurve[CURVE_SAMPLES];
+    uint8_t alphaCurve[CURVE_SAMPLES];
+    ColorSample colorCurve[CURVE_SAMPLES];
 };
 
 class ParticleSystem {
+public:
+    static const int TRIG_TABLE_SIZE = 1024;    // Steps per turn
+    static const int MAX_RUNNING_EMITTERS = 16;
+
 private:
+    // A continuous emitter that is running
+    struct RunningEmitter {
+        bool active;
+        uint8_t emitter;
+        uint8_t direction;
+        sf::Color color;
+        sf::Vector2f position;
+        sf::Vector2f lastPosition;  // Particles are spread along the way since the last update
+        float carry;                // Fraction of a particle owed from earlier updates
+    };
+
     std::vector<Particle> particles;
-    std::mt19937 rng;
+    std::vector<ParticleEmitter> emitters;     // [0] is the built-in "sparks"
+    RunningEmitter running[MAX_RUNNING_EMITTERS];
+    std::vector<sf::Vertex> fallbackVertices;  // Only used if the frame arena is full
+    sf::Texture dotTexture;                    // Anti-aliased disc used for every particle
+    float sinTable[TRIG_TABLE_SIZE + TRIG_TABLE_SIZE / 4];  // cos(i) = sinTable[i + TRIG_TABLE_SIZE / 4]
+    uint32_t randomState;
+    float density;  // Multiplier on emit counts (set by the quality governor)
 
 public:
     ParticleSystem();
-    
-    // Emit particles
-    void emit(sf::Vector2f position, sf::Color color, int count = 10);
-    void emitTrail(sf::Vector2f position, sf::Color color);
-    void emitExplosion(sf::Vector2f position, sf::Color color);
-    
-    // Update particles
-    void update(float dt);
-    
-    // Draw particles
-    void draw(sf::RenderWindow& window);
-    
-    // Clear all particles
+
+    // Replace the emitters with the ones in an effects file (see
+    // assets/effects/particles.fx). Returns false (and reports the line on
+    // stderr) if the file has errors; the built-in "sparks" stays either way.
+    bool loadEmitters(const std::string& path);
+    bool compileEmitters(const std::string& source, const std::string& sourceName);
+
+    // Index of a named emitter; falls back to "sparks" (0) if there is none
+    int findEmitter(const std::string& name) const;
+    const ParticleEmitter& getEmitter(int emitter) const { return emitters[emitter]; }
+
+    // One shot of an emitter. count < 0 uses the emitter's own count.
+    // direction is in 256ths of a turn (0 = right, 64 = down) and turns
+    // cones and rings.
+    void emit(int emitter, sf::Vector2f position, sf::Color color, int count = -1, uint8_t direction = 0);
+
+    // Continuous emitters: start one, move it along with whatever it
+    // follows, stop it. -1 if every slot is busy (the others still work).
+    int startEmitter(int emitter, sf::Vector2f position, sf::Color color, uint8_t direction = 0);
+    void moveEmitter(int handle, sf::Vector2f position);
+    void stopEmitter(int handle);
+
+    // Update particles; with a collider they also interact with the world
+    void update(float dt, ParticleCollider* collider = nullptr);
+
+    // Draw particles (one draw call, vertices come from the frame arena)
+    void draw(sf::RenderTarget& target, FrameArena& arena);
+
+    // Clear all particles (and stop the continuous emitters)
     void clear();
 
+    void setDensity(float d) { density = d; }
+    size_t getCount() const { return particles.size(); }
+    const Particle& getParticle(size_t i) const { return particles[i]; }
+
+    // 256ths of a turn for emit() pointing along v
+    static uint8_t directionOf(sf::Vector2f v);
+
 private:
-    float random(float min, float max);
+    uint32_t nextRandom();
+    void spawn(const ParticleEmitter& e, int index, sf::Vector2f position, sf::Color color,
+               int angleStep, uint32_t bits);
+    void createDotTexture();
 };
 
 #endif
@@ -0,0 +1,81 @@
+#ifndef PATTERNSCRIPT_H
+#define PATTERNSCRIPT_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Fixed.h"
+
+// Instructions of the pattern bytecode. Each one is a 16-bit opcode word
+// followed by a fixed number of operand words (see PatternLibrary::getOperandCount).
+// An operand word is either a register (top bit set, low bits = a..h) or an
+// index into the library's constant pool.
+enum class PatternOp : uint16_t {
+    END,        //                              stop the pattern
+    ORIGIN,     // x y                          where bullets come from
+    SET,        // reg value
+    ADD,        // reg value
+    MUL,        // reg value
+    RAND,       // reg low high
+    EMIT,       // angle speed color            one bullet
+    FAN,        // count angle spread speed color
+    RING,       // count angle speed color
+    SIZE,       // halfSize                     for bullets emitted after this
+    SINE,       // amplitude frequency          sideways wobble (0 = off)
+    CURVE,      // degreesPerSecond             steering
+    ACCEL,      // pixelsPerSecond2
+    WALL,       // color                        a color wall gauntlet gate
+    WAIT,       // seconds
+    REPEAT,     // count                        loop until the matching NEXT
+    NEXT,
+    COUNT
+};
+
+// One compiled pattern
+struct PatternProgram {
+    std::string name;
+    std::vector<uint16_t> code;
+};
+
+// Compiles pattern scripts into bytecode. A script is a list of blocks:
+//
+//   pattern spiral
+//       origin 1180 360
+//       set a 0
+//       repeat 120
+//           emit a 180 random
+//           add a 13
+//           wait 0.03
+//       end
+//   end
+//
+// Angles are in degrees (180 = towards the player), colors are palette
+// indices 0-5 or "random", and a-h are per-instance registers.
+class PatternLibrary {
+private:
+    std::vector<PatternProgram> programs;
+    std::vector<Fixed> constants;      // Parsed once, so the VM only does fixed-point math
+
+    uint16_t addConstant(Fixed value);
+    bool parseOperand(const std::string& token, bool allowRandom, uint16_t& word);
+
+public:
+    static const uint16_t REGISTER_BIT = 0x8000;
+    static const int REGISTER_COUNT = 8;
+    static const int MAX_LOOP_DEPTH = 4;
+    static const int MAX_PATTERNS = 32;      // The VM keeps per-pattern stats in a fixed array
+
+    // Returns false (and reports the line on stderr) if the file has errors.
+    // A file with errors adds nothing to the library.
+    bool loadFromFile(const std::string& path);
+    bool compile(const std::string& source, const std::string& sourceName);
+
+    int getPatternCount() const { return static_cast<int>(programs.size()); }
+    const PatternProgram& getPattern(int i) const { return programs[i]; }
+    int findPattern(const std::string& name) const;
+
+    Fixed getConstant(uint16_t index) const { return constants[index]; }
+    static int getOperandCount(PatternOp op);
+};
+
+#endif
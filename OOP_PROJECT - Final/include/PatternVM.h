@@ -0,0 +1,85 @@
+#ifndef PATTERNVM_H
+#define PATTERNVM_H
+
+#include <cstdint>
+#include "PatternScript.h"
+#include "BulletField.h"
+#include "SimRandom.h"
+
+// Runtime cost of one pattern (for the stats overlay)
+struct PatternStats {
+    int running;             // Instances currently executing
+    int bullets;             // Bullets of this pattern still alive
+    int emitted;             // Bullets fired since the last reset
+    float vmMs;              // Time spent running its bytecode last frame
+};
+
+// Runs compiled patterns. Every running instance has its own registers,
+// program counter and loop stack; a WAIT parks it until its timer runs out.
+// Registers and all bullet math are fixed-point, so patterns fire the same
+// bullets on every build.
+// Bullets go straight into the BulletField, color walls are queued for the
+// game to spawn.
+class PatternVM {
+public:
+    static const int MAX_INSTANCES = 32;
+    static const int MAX_PATTERNS = PatternLibrary::MAX_PATTERNS;
+    static const int MAX_WALL_REQUESTS = 8;
+
+private:
+    struct Loop {
+        uint16_t start;      // First instruction inside the loop
+        int remaining;
+    };
+
+    struct Instance {
+        bool active;
+        int program;
+        uint16_t pc;
+        Fixed wait;          // Seconds left of the current WAIT
+        Fixed registers[PatternLibrary::REGISTER_COUNT];
+        Loop loops[PatternLibrary::MAX_LOOP_DEPTH];
+        int loopDepth;
+        FixedVec2 origin;
+        BulletMotion motion;
+    };
+
+    const PatternLibrary* library;
+    Instance instances[MAX_INSTANCES];
+    PatternStats stats[MAX_PATTERNS];
+    int wallRequests[MAX_WALL_REQUESTS];
+    int wallRequestCount;
+    SimRandom rng;          // Its own, so patterns don't shift the spawn sequence
+
+    Fixed operand(const Instance& inst, uint16_t word) const;
+    int paletteIndex(Fixed value);
+    void execute(Instance& inst, BulletField& bullets, Fixed speedScale);
+
+public:
+    PatternVM();
+
+    void setLibrary(const PatternLibrary* lib) { library = lib; }
+
+    // Start a pattern by index; false if it doesn't exist or all slots are busy
+    bool start(int program);
+
+    // Run every instance for dt seconds. speedScale multiplies bullet speeds
+    // so patterns get harder along with the rest of the game.
+    void update(Fixed dt, BulletField& bullets, Fixed speedScale);
+    void reset();
+
+    // Restart the random numbers (RAND, random colors) from a known seed
+    void seed(uint32_t s) { rng.seed(s); }
+    uint32_t getRandomState() const { return rng.getState(); }
+
+    int getRunningCount() const;
+
+    // Color walls asked for during the last update (palette indices)
+    int getWallRequestCount() const { return wallRequestCount; }
+    int getWallRequest(int i) const { return wallRequests[i]; }
+
+    const PatternStats& getStats(int program) const { return stats[program]; }
+    void updateBulletCounts(const BulletField& bullets);
+};
+
+#endif
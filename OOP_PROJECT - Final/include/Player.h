@@ -3,23 +3,28 @@
 
 #include <SFML/Graphics.hpp>
 #include "Config.h"
-#include "ParticleSystem.h"
+#include "Fixed.h"
+#include "InputManager.h"
+#include "PlayerTrail.h"
+
+namespace StateHash { class Stream; }
 
 class Player {
 private:
     sf::RectangleShape shape;
-    sf::Vector2f position;
-    sf::Vector2f velocity;
+    // Simulation state is fixed-point; the shape and trail get floats
+    FixedVec2 position;
+    FixedVec2 previousPosition;     // At the start of the tick
+    FixedVec2 velocity;
     sf::Color currentColor;
     
-    // Dash mechanics
-    bool isDashing;
-    float dashTimer;
-    float dashCooldownTimer;
-    sf::Vector2f dashDirection;
+    // Dash mechanics (how long a dash lasts is up to the game's timers)
+    bool dashing;
+    float dashTime;          // Seconds into the current dash (for the pulse)
+    FixedVec2 dashDirection;
     
     // Trail effect
-    float trailTimer;
+    PlayerTrail trail;
 
     // Color changing
     int currentColorIndex;
@@ -29,26 +34,41 @@ public:
     Player();
 
     // Movement
-    void update(float dt);
-    void handleInput();
-    void dash();
+    void update(Fixed dt, const InputState& input);
+    void handleInput(const InputState& input);
+    void startDash();
+    void endDash();
 
     // Color changing
     void changeColor();
 
     // Getters
-    sf::Vector2f getPosition() const { return position; }
-    sf::FloatRect getBounds() const { return shape.getGlobalBounds(); }
+    sf::Vector2f getPosition() const { return position.toVector2f(); }
+    FixedVec2 getFixedPosition() const { return position; }
+    FixedVec2 getPreviousPosition() const { return previousPosition; }
+    FixedRect getBounds() const;
+    FixedRect getPreviousBounds() const;
     sf::Color getColor() const { return currentColor; }
-    bool canDash() const { return dashCooldownTimer <= 0 && !isDashing; }
-    float getDashCooldown() const { return dashCooldownTimer; }
+    bool isDashing() const { return dashing; }
+    FixedVec2 getDashDirection() const { return dashDirection; }
+    float getDrawScale() const { return shape.getScale().x; }          // Dash pulse
+    sf::Color getOutlineColor() const { return shape.getOutlineColor(); }
     
+    // Move back along this tick's path to where a hit happened (0 = start, 1 = end)
+    void rewind(Fixed time);
+
+    // Simulation state for the per-tick state hash
+    void hashState(StateHash::Stream& stream) const;
+
     // Drawing
-    void draw(sf::RenderWindow& window);
-    void drawTrail(sf::RenderWindow& window, ParticleSystem& particles);
+    void draw(sf::RenderTarget& target);
     
+    void setTrailLength(int points) { trail.setLength(points); }
+    void setOutlineColor(sf::Color color) { shape.setOutlineColor(color); }
+
     // Reset
     void reset();
+    void reset(FixedVec2 start, int colorIndex);
 };
 
 #endif
@@ -0,0 +1,41 @@
+#ifndef PLAYERTRAIL_H
+#define PLAYERTRAIL_H
+
+#include <SFML/Graphics.hpp>
+
+// Ribbon drawn behind the player.
+// Keeps a fixed ring of recent positions and turns them into one tapering
+// triangle strip, so the trail costs the same every frame and doesn't use
+// any particles.
+class PlayerTrail {
+private:
+    static const int MAX_POINTS = 48;
+
+    struct TrailPoint {
+        sf::Vector2f position;
+        sf::Color color;
+        float width;
+    };
+
+    TrailPoint points[MAX_POINTS];
+    int head;            // Index of the newest point
+    int count;
+    int length;          // How many points are drawn (quality setting)
+    float sampleTimer;
+
+    sf::VertexArray strip;
+
+public:
+    PlayerTrail();
+
+    // Record the player's position; dashing makes the ribbon wider
+    void update(float dt, sf::Vector2f position, sf::Color color, bool dashing);
+
+    void setLength(int pointCount);
+    void clear();
+
+    // One draw call
+    void draw(sf::RenderTarget& target);
+};
+
+#endif
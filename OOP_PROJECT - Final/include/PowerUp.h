@@ -3,6 +3,9 @@
 
 #include <SFML/Graphics.hpp>
 #include "Config.h"
+#include "Fixed.h"
+
+namespace StateHash { class Stream; }
 
 enum class PowerUpType {
     SHIELD,
@@ -13,29 +16,42 @@ enum class PowerUpType {
 class PowerUp {
 private:
     sf::CircleShape shape;
-    sf::Vector2f position;
-    sf::Vector2f velocity;
+    FixedVec2 position;
+    FixedVec2 previousPosition;     // At the start of the tick
+    FixedVec2 velocity;
     PowerUpType type;
     bool isActive;
     float pulseTimer;
 
+    static bool glowEnabled;  // Shared by all power-ups (quality setting)
+
 public:
-    PowerUp(sf::Vector2f startPos, PowerUpType t, float speed);
+    PowerUp(FixedVec2 startPos, PowerUpType t, Fixed speed);
     
+    // Reuse a collected/finished power-up instead of allocating a new one
+    void reset(FixedVec2 startPos, PowerUpType t, Fixed speed);
+
     // Update
-    void update(float dt);
+    void update(Fixed dt);
     
     // Getters
-    sf::Vector2f getPosition() const { return position; }
-    sf::FloatRect getBounds() const { return shape.getGlobalBounds(); }
+    sf::Vector2f getPosition() const { return position.toVector2f(); }
+    FixedRect getBounds() const;       // Pickup area (doesn't pulse)
+    FixedRect getPreviousBounds() const;
     bool active() const { return isActive; }
     PowerUpType getType() const { return type; }
+    sf::Color getColor() const { return shape.getFillColor(); }
+    float getDrawRadius() const { return shape.getRadius() * shape.getScale().x; }  // Pulses
     
     // Set inactive
     void deactivate() { isActive = false; }
     
+    // Simulation state for the per-tick state hash
+    void hashState(StateHash::Stream& stream) const;
+
     // Drawing
-    void draw(sf::RenderWindow& window);
+    void draw(sf::RenderTarget& target);
+    static void setGlowEnabled(bool enabled) { glowEnabled = enabled; }
 };
 
 #endif
@@ -0,0 +1,73 @@
+#ifndef QUALITYGOVERNOR_H
+#define QUALITYGOVERNOR_H
+
+#include <string>
+
+enum class QualityTier {
+    HIGH,
+    MEDIUM,
+    LOW,
+    MINIMAL
+};
+
+// The effect knobs each tier controls
+struct QualitySettings {
+    float particleDensity;   // Multiplier on every particle emit count
+    int trailLength;         // Points in the player's ribbon trail
+    bool glowEnabled;        // Double-drawn glow on power-ups and color walls (without bloom)
+    bool lightingEnabled;    // CPU light map with shadows
+    int bloomLevel;          // 0 off, 1 low, 2 medium, 3 high (see BloomQuality)
+    float renderScale;       // Internal world resolution (fraction of the window)
+};
+
+// One tier change and why it happened
+struct QualityDecision {
+    float time;              // Seconds since the governor started
+    QualityTier from;
+    QualityTier to;
+    float averageWorkMs;     // Average frame work time that triggered it
+};
+
+// Watches recent frame work times and moves between quality tiers to stay
+// inside the frame budget. Uses hysteresis so it doesn't flip back and forth:
+// drops quickly when over budget, but only climbs back after a long calm period.
+class QualityGovernor {
+private:
+    static const int WINDOW = 30;          // Frames averaged per decision
+    static const int HISTORY = 16;         // Decisions remembered
+
+    QualityTier tier;
+    float budgetMs;
+
+    float workTimes[WINDOW];
+    int workCount;
+    int workIndex;
+
+    float clockTime;
+    float calmTime;          // How long we have been well under budget
+    float cooldown;          // No changes until this reaches zero
+
+    QualityDecision history[HISTORY];
+    int historyCount;
+
+    void changeTier(QualityTier newTier, float averageMs);
+
+public:
+    QualityGovernor();
+
+    // Frame budget in milliseconds (e.g. 16.6 for 60 FPS)
+    void setBudget(float ms) { budgetMs = ms; }
+
+    // Feed the work time of the last frame and the real time that passed
+    void update(float workMs, float dt);
+
+    QualityTier getTier() const { return tier; }
+    QualitySettings getSettings() const;
+    static const char* getTierName(QualityTier t);
+
+    // Most recent decisions, oldest first
+    int getHistoryCount() const { return historyCount < HISTORY ? historyCount : HISTORY; }
+    const QualityDecision& getDecision(int i) const;
+};
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Difficulty.h"
+#include "Simulation.h"
+
+struct ReplayHeader {
+    char magic[4];                  // "CSRP"
+    uint32_t version;
+    uint32_t seed;
+    uint32_t playerCount;
+    DifficultySettings difficulty;
+    int32_t score;                  // What the run claims (set by finish())
+    uint32_t ticks;
+    float runTime;
+    char name[16];                  // Zero-padded
+};
+
+// A run as its seed, its settings and the SimInput of every tick - enough to
+// play it again through a Simulation and end up with the same score (on a
+// build of the same sources). Stored as:
+//
+//   header : ReplayHeader
+//   tick   : float dt, uint8 flags (bit 0: stress pattern, bits 4-7: beat
+//            count), uint8 per player (move x + 1 in bits 0-1, move y + 1 in
+//            bits 2-3, bit 4 dash, bit 5 color change), float per beat
+//
+// A single player tick without beats is 6 bytes: an hour at 144 FPS is 3 MB.
+class Replay {
+private:
+    ReplayHeader header;
+    std::vector<uint8_t> ticks;
+    size_t readPosition;
+
+public:
+    static const uint32_t VERSION = 1;
+    static const size_t MAX_SIZE = 16 * 1024 * 1024;
+
+    Replay();
+
+    // Recording. begin() keeps room for reserveBytes of ticks, so recording
+    // doesn't allocate during a run of normal length.
+    void begin(uint32_t seed, int playerCount, const DifficultySettings& difficulty,
+               const std::string& name, size_t reserveBytes);
+    void record(const SimInput& in);
+    void finish(int score, float runTime);
+
+    // Header and ticks as one block (what gets submitted)
+    void serialize(std::vector<uint8_t>& out) const;
+
+    // Take a serialized replay; false (and nothing to play) unless it is one
+    // of this version with exactly the ticks its header says
+    bool parse(const uint8_t* data, size_t size);
+
+    // Playback, tick by tick from the start
+    void rewind() { readPosition = 0; }
+    bool next(SimInput& in);
+
+    const ReplayHeader& getHeader() const { return header; }
+    std::string getName() const;
+};
+
+#endif
@@ -0,0 +1,38 @@
+#ifndef SIMRANDOM_H
+#define SIMRANDOM_H
+
+#include <cstdint>
+#include "Fixed.h"
+
+// Random numbers for anything that changes the simulation (spawn heights,
+// colors, power-up types, bullet patterns). A tiny LCG instead of <random>:
+// std distributions differ between standard libraries, and the whole state
+// is one number, so a seeded run plays out the same on every build and the
+// state hash (StateHash.h) can include it. Only integer math in here - no
+// floats, so no FMA or x87 differences between builds either.
+class SimRandom {
+private:
+    uint32_t state;
+
+public:
+    explicit SimRandom(uint32_t seed = 1) : state(seed) {}
+
+    void seed(uint32_t s) { state = s; }
+    uint32_t getState() const { return state; }
+
+    // 24 random bits
+    uint32_t next() {
+        state = state * 1664525u + 1013904223u;
+        return state >> 8;
+    }
+
+    // In [low, high), in steps of 1/65536 of the range
+    Fixed uniform(Fixed low, Fixed high) {
+        int64_t range = static_cast<int64_t>((high - low).raw());
+        return low + Fixed::fromRaw(static_cast<int32_t>((range * (next() & 0xFFFF)) >> 16));
+    }
+
+    int below(int n) { return static_cast<int>(next() % static_cast<uint32_t>(n)); }
+};
+
+#endif
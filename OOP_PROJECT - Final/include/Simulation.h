@@ -0,0 +1,185 @@
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Config.h"
+#include "Player.h"
+#include "Obstacle.h"
+#include "ColorWallObstacle.h"
+#include "PowerUp.h"
+#include "EventJournal.h"
+#include "EffectBuffer.h"
+#include "Collision.h"
+#include "InputManager.h"
+#include "PatternScript.h"
+#include "PatternVM.h"
+#include "BulletField.h"
+#include "TimerWheel.h"
+#include "CoroutineTask.h"
+#include "Difficulty.h"
+#include "SimRandom.h"
+#include "StateHash.h"
+
+// A particle effect the rules ask for: one of the game's emitters and how
+// many particles a burst of it is
+struct SimEffect {
+    int emitter = 0;
+    int count = 0;
+};
+
+struct SimEffects {
+    SimEffect dash;
+    SimEffect colorChange;
+    SimEffect dodge;
+    SimEffect wallPass;
+    SimEffect pickup;
+    SimEffect explosion;
+};
+
+// Everything that goes into one tick from outside. A run is its seed, its
+// difficulty settings and one of these per tick - that is all a Replay keeps.
+struct SimInput {
+    static const int MAX_BEATS = 8;
+
+    float dt;
+    InputState players[MAX_PLAYERS];
+    float beats[MAX_BEATS];         // Strengths of the music beats that played
+    int beatCount;
+    bool stressPattern;             // F7 was pressed
+};
+
+// The rules of a run without a window: players, obstacles, color walls,
+// power-ups, bullet patterns, collisions, score and difficulty, stepped one
+// tick at a time. The game steps one and draws it; tools/leaderboard re-runs
+// recorded runs through one per worker thread. What should be seen and heard
+// goes into the effect buffer (disable it when nobody is watching).
+class Simulation {
+private:
+    Player players[MAX_PLAYERS];
+    int playerCount;            // Players in this run (1-4)
+    bool playerAlive[MAX_PLAYERS];
+    bool over;                  // Nobody is left
+    DeathCause deathCause;      // What got the last player (once over)
+    std::vector<std::unique_ptr<Obstacle>> obstacles;
+    std::vector<std::unique_ptr<PowerUp>> powerUps;
+
+    // Finished objects waiting to be reused (so spawning doesn't allocate)
+    std::vector<std::unique_ptr<Obstacle>> obstaclePool;
+    std::vector<std::unique_ptr<Obstacle>> colorWallPool;
+    std::vector<std::unique_ptr<PowerUp>> powerUpPool;
+
+    // Narrowphase scratch data, reused every tick
+    OrientedBoxBatch obstacleBoxes;
+    std::vector<SweepHit> obstacleSweeps;
+
+    EffectBuffer effects;       // What this tick wants to be seen/heard
+    SimEffects effectIds;
+    EventJournal* journal;      // Optional
+
+    // Scripted bullet patterns
+    const PatternLibrary* patternLibrary;
+    PatternVM patterns;
+    BulletField bullets;
+    std::vector<int> patternRotation;  // Patterns the game picks from (not test_*)
+    float bulletUpdateMs;
+
+    // Game clock: every timed sequence of a run waits on this
+    TimerWheel timers;
+
+    // Run stats
+    int score;
+    int combo;
+    DifficultySettings difficultySettings;  // Config.h values unless overridden
+    DifficultyRamp difficulty;      // Obstacle speed and spawn interval (fixed-point)
+    Fixed runTime;              // Seconds since the run started (= timers.now())
+
+    // When things last happened, on the game clock
+    Fixed lastObstacleSpawn;
+    Fixed lastColorWallSpawn;
+    Fixed lastComboTime;
+    Fixed lastBeatTime;
+    Fixed dashReadyTime[MAX_PLAYERS];   // No dashing before this
+
+    // Everything random in a run draws from here, except bullet patterns,
+    // which have their own SimRandom (seeded from the same seed)
+    SimRandom random;
+    bool invulnerable;          // Nobody goes down (allocation test)
+
+    void log(GameEventType type, Fixed time, float x = 0, float y = 0, int32_t value = 0) {
+        if (journal) journal->log(type, time.toFloat(), x, y, value);
+    }
+    void emitParticles(const SimEffect& effect, sf::Vector2f position, sf::Color color, uint8_t direction = 0) {
+        effects.particles(position, color, effect.emitter, effect.count, direction);
+    }
+
+    void playerDown(int p, DeathCause cause, Fixed time = Fixed(1));   // time: when in this tick (0-1)
+    void gameOver(DeathCause cause, int lastPlayer);
+    void spawnObstacle();
+    void spawnPowerUp();
+    void spawnColorWall();
+    void spawnColorWall(sf::Color wallColor);
+    void startPattern(int index);
+    void updatePatterns(Fixed step);
+    void onBeat(float strength);
+    bool beatsActive() const;
+    void checkCollisions(Fixed step);
+    void updateDifficulty();
+    void recycleInactive();
+    sf::Color getRandomColor();
+
+    // Timed sequences (coroutines on the game clock)
+    void startTimers();
+    Task obstacleSpawner();
+    Task colorWallSpawner();
+    Task powerUpSpawner();
+    Task patternSpawner();
+    Task comboWatcher();
+    Task dashSequence(int p);
+
+public:
+    Simulation();
+
+    Simulation(const Simulation&) = delete;
+    Simulation& operator=(const Simulation&) = delete;
+
+    // Setup; none of these take effect before the next start()
+    void setPatternLibrary(const PatternLibrary* library);     // Shared, read-only
+    void setDifficulty(const DifficultySettings& settings);
+    void setEffects(const SimEffects& ids) { effectIds = ids; }
+    void setJournal(EventJournal* j) { journal = j; }
+    void setInvulnerable(bool on) { invulnerable = on; }
+
+    // Everything back to the start, then a new run from this seed
+    void start(int count, uint32_t seed);
+
+    // One tick. Same seed, same settings, same inputs: same run.
+    void step(const SimInput& in);
+
+    bool isOver() const { return over; }
+    DeathCause getDeathCause() const { return deathCause; }
+
+    // The state the next tick starts from, one hash per field (StateHash.h)
+    void hashState(StateHashLog& log, const SimInput& in) const;
+
+    // For the game to draw, sound and report what happened
+    int getPlayerCount() const { return playerCount; }
+    Player& getPlayer(int p) { return players[p]; }
+    bool isPlayerAlive(int p) const { return playerAlive[p]; }
+    std::vector<std::unique_ptr<Obstacle>>& getObstacles() { return obstacles; }
+    std::vector<std::unique_ptr<PowerUp>>& getPowerUps() { return powerUps; }
+    BulletField& getBullets() { return bullets; }
+    PatternVM& getPatterns() { return patterns; }
+    TimerWheel& getTimers() { return timers; }
+    EffectBuffer& getEffects() { return effects; }
+    const DifficultySettings& getDifficulty() const { return difficultySettings; }
+    int getScore() const { return score; }
+    int getCombo() const { return combo; }
+    float getRunTime() const { return runTime.toFloat(); }
+    float getDashCooldown(int p) const { return dashReadyTime[p] > runTime ? (dashReadyTime[p] - runTime).toFloat() : 0.0f; }
+    float getBulletUpdateMs() const { return bulletUpdateMs; }
+};
+
+#endif
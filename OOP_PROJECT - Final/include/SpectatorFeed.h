@@ -0,0 +1,143 @@
+#ifndef SPECTATORFEED_H
+#define SPECTATORFEED_H
+
+#include <atomic>
+#include <cstdint>
+#include "Config.h"
+
+// Live feed of what the game draws, for extra screens at events. The game
+// writes a render snapshot of every frame into shared memory; any number of
+// tools/spectator processes map it and draw it at their own frame rate and
+// resolution, without running a Game of their own.
+//
+// The shared memory is a ring of SPECTATOR_SLOTS frames, each guarded by a
+// seqlock: the sequence is odd while the game writes the slot. The game
+// fills the slot after the newest one in place and never waits for anyone;
+// a reader copies the newest slot and retries if the sequence moved under
+// it. A stalled spectator can only ever miss frames.
+//
+// Capacities come from Config.h, so the game and the spectator must be built
+// from the same tree (checked when the spectator connects).
+
+const int SPECTATOR_SLOTS = 3;
+
+#ifdef _WIN32
+constexpr const char* SPECTATOR_FEED_NAME = "Local\\colorswap_spectator";
+#else
+constexpr const char* SPECTATOR_FEED_NAME = "/colorswap_spectator";
+#endif
+
+enum class SpectatorScreen : uint8_t {
+    MENU,
+    PLAYING,
+    GAME_OVER
+};
+
+enum class SpectatorShape : uint8_t {
+    BOX,            // Rotated rectangle
+    ROUND
+};
+
+// A player, obstacle, color wall or power-up as drawn
+struct SpectatorEntity {
+    float x, y;
+    float halfWidth, halfHeight;    // Without the outline; radius for round shapes
+    float rotation;                 // Degrees
+    float outline;                  // Thickness (0 = none)
+    uint32_t color;                 // sf::Color::toInteger()
+    uint32_t outlineColor;
+    SpectatorShape shape;
+    uint8_t padding[3];
+};
+
+// Bullets and particles: a center, a size and a color
+struct SpectatorDot {
+    float x, y;
+    float size;
+    uint32_t color;
+};
+
+struct SpectatorFrame {
+    static const int MAX_ENTITIES = 512;
+
+    uint64_t frame;                 // Counts up with every published frame
+    float runTime;
+    float cameraX, cameraY;         // Screen shake offset
+    float dashCooldown;             // Player 1, seconds (0 = ready)
+    int32_t score;
+    int32_t combo;
+    SpectatorScreen screen;
+    uint8_t playerCount;
+    uint8_t padding[2];
+
+    uint32_t entityCount;
+    uint32_t bulletCount;
+    uint32_t particleCount;
+    SpectatorEntity entities[MAX_ENTITIES];     // Drawn in order
+    SpectatorDot bullets[MAX_BULLETS];
+    SpectatorDot particles[MAX_PARTICLES];
+};
+
+// The layout of the shared memory
+struct SpectatorRing {
+    uint32_t magic;
+    uint32_t frameSize;             // sizeof(SpectatorFrame) of the game's build
+    std::atomic<uint32_t> latest;   // Newest complete slot
+    struct Slot {
+        std::atomic<uint32_t> sequence;
+        SpectatorFrame frame;
+    } slots[SPECTATOR_SLOTS];
+};
+
+// The game's side: creates the shared memory and publishes frames
+class SpectatorFeed {
+private:
+    SpectatorRing* ring;
+    void* handle;           // Windows file mapping
+    int fd;                 // POSIX shared memory
+    uint32_t writing;       // Slot being filled
+    uint64_t frameCount;
+
+public:
+    SpectatorFeed();
+    ~SpectatorFeed();
+
+    SpectatorFeed(const SpectatorFeed&) = delete;
+    SpectatorFeed& operator=(const SpectatorFeed&) = delete;
+
+    bool open();
+    void close();
+    bool isOpen() const { return ring != nullptr; }
+
+    // The next slot, to be filled in place (entities etc. are uninitialized
+    // apart from what the last use of the slot left). Every beginFrame needs
+    // a publish before the next one.
+    SpectatorFrame* beginFrame();
+    void publish();
+};
+
+// The spectator's side: maps the shared memory read-only
+class SpectatorView {
+private:
+    const SpectatorRing* ring;
+    void* handle;
+    int fd;
+    uint64_t lastFrame;
+
+public:
+    SpectatorView();
+    ~SpectatorView();
+
+    SpectatorView(const SpectatorView&) = delete;
+    SpectatorView& operator=(const SpectatorView&) = delete;
+
+    // False if no game is publishing (or it was built with other capacities)
+    bool open();
+    void close();
+    bool isOpen() const { return ring != nullptr; }
+
+    // Copy the newest frame into out if there is one we haven't seen yet
+    bool read(SpectatorFrame& out);
+};
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef SPSCRING_H
+#define SPSCRING_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+// Lock-free ring buffer for exactly ONE producer thread and ONE consumer thread.
+// The storage is allocated once in the constructor, so push/pop never allocate
+// and never block - push simply fails when the buffer is full.
+template <typename T>
+class SpscRing {
+private:
+    std::unique_ptr<T[]> buffer;
+    size_t mask;  // capacity - 1 (capacity is always a power of two)
+
+    // Keep the two indices on separate cache lines so the threads don't fight
+    alignas(64) std::atomic<size_t> head;  // Next slot to write (producer)
+    alignas(64) std::atomic<size_t> tail;  // Next slot to read (consumer)
+
+public:
+    explicit SpscRing(size_t minCapacity) : head(0), tail(0) {
+        size_t capacity = 2;
+        while (capacity < minCapacity) capacity *= 2;
+        buffer.reset(new T[capacity]);
+        mask = capacity - 1;
+    }
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    // Producer side - returns false if the ring is full
+    bool tryPush(const T& item) {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) > mask) {
+            return false;
+        }
+        buffer[h & mask] = item;
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side - returns false if the ring is empty
+    bool tryPop(T& item) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        if (t == head.load(std::memory_order_acquire)) {
+            return false;
+        }
+        item = buffer[t & mask];
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Approximate number of queued items (exact when called from either thread
+    // while the other is idle)
+    size_t size() const {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+
+    size_t capacity() const { return mask + 1; }
+};
+
+#endif
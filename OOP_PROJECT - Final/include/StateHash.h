@@ -0,0 +1,113 @@
+#ifndef STATEHASH_H
+#define STATEHASH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Per-tick hashes of the simulation state, to find the exact tick (and part
+// of the state) where two runs stop agreeing - between builds, compilers or
+// machines. Compare two logs with tools/state_diff.
+namespace StateHash {
+    // XXH64 (same output as the reference xxHash), fed piece by piece. Input
+    // goes in 32-byte stripes over four independent lanes, so the multiplies
+    // overlap in the pipeline instead of waiting on each other.
+    class Stream {
+    private:
+        uint64_t lanes[4];
+        uint64_t total;
+        uint64_t seed;
+        unsigned char buffer[32];
+        uint32_t buffered;
+
+    public:
+        explicit Stream(uint64_t s = 0) { reset(s); }
+
+        void reset(uint64_t s = 0);
+        void update(const void* data, size_t size);
+        uint64_t digest() const;
+
+        // Plain values as their bytes (Fixed as its raw 16.16 value). Hash
+        // fields one by one rather than whole structs, so padding stays out.
+        template <typename T>
+        void add(const T& value) {
+            static_assert(std::is_trivially_copyable_v<T>, "hash values, not objects");
+            update(&value, sizeof(T));
+        }
+    };
+
+    uint64_t hash(const void* data, size_t size, uint64_t seed = 0);
+}
+
+// Parts of the state hashed separately, so a mismatch says where to look
+enum class StateField : uint8_t {
+    PLAYERS,
+    OBSTACLES,          // Obstacles and color walls
+    POWERUPS,
+    BULLETS,
+    TIMERS,
+    DIFFICULTY,         // Obstacle speed, spawn interval
+    SCORE,              // Score, combo, run time, who is alive
+    RNG,
+    INPUT,              // What went in this tick (not state)
+    COUNT
+};
+
+const int STATE_FIELD_COUNT = static_cast<int>(StateField::COUNT);
+
+// One tick. Each field's 64-bit hash is folded to 32 bits - plenty to spot a
+// difference, and half the size.
+struct StateHashRecord {
+    uint32_t run;                   // Counts runs within the file
+    uint32_t tick;                  // Ticks into the run
+    int32_t step;                   // The tick's dt, raw 16.16 (an input, like INPUT)
+    uint32_t fields[STATE_FIELD_COUNT];
+};
+
+// Writes a record per tick:
+//
+//   header : "STH1" magic, uint32 version, uint32 field count
+//   record : uint32 run, uint32 tick, int32 step, field count x uint32 hash
+//
+// Records go through a large stdio buffer, so a tick costs a memcpy.
+class StateHashLog {
+private:
+    std::FILE* file;
+    std::vector<char> fileBuffer;
+    StateHash::Stream streams[STATE_FIELD_COUNT];
+    uint32_t run;
+    uint32_t tick;
+    StateHashRecord last;
+
+public:
+    static const uint32_t FILE_VERSION = 1;
+
+    StateHashLog();
+    ~StateHashLog();
+
+    StateHashLog(const StateHashLog&) = delete;
+    StateHashLog& operator=(const StateHashLog&) = delete;
+
+    bool open(const std::string& path);
+    void close();
+    bool isOpen() const { return file != nullptr; }
+
+    void beginRun();
+
+    // Between beginTick and endTick, hash the state into field(...)
+    void beginTick();
+    StateHash::Stream& field(StateField f) { return streams[static_cast<int>(f)]; }
+    void endTick(int32_t rawStep);
+
+    // The record endTick made last (also without a file open)
+    const StateHashRecord& getLastRecord() const { return last; }
+
+    static const char* getFieldName(StateField f);
+
+    static bool readFile(const std::string& path, std::vector<StateHashRecord>& records);
+};
+
+#endif
@@ -0,0 +1,99 @@
+#ifndef TIMERWHEEL_H
+#define TIMERWHEEL_H
+
+#include <chrono>
+#include <coroutine>
+#include <cstdint>
+#include <vector>
+#include "Fixed.h"
+
+class TimerWheel;
+namespace StateHash { class Stream; }
+
+// What "co_await timers.after(...)" waits on
+struct TimerAwaiter {
+    TimerWheel* wheel;
+    uint64_t tick;           // Tick at which the coroutine resumes
+
+    bool await_ready() const { return false; }
+    void await_suspend(std::coroutine_handle<> handle);
+    void await_resume() const {}
+};
+
+// The game's clock and every pending wait in one place.
+// Time moves in 1 ms ticks. Waiting coroutines sit in a hierarchical wheel:
+// 4 levels of 256 slots each, where level 0 holds the next 256 ms and
+// every higher level covers 256x as much. Scheduling and firing are O(1)
+// no matter how many timers are waiting; a far-away timer just trickles
+// down a level each time its slot comes round.
+//
+// Times are fixed-point seconds and the remainder of a tick is carried in
+// 1/65536 ms, so the clock is integer math from end to end: the same dts
+// fire the same timers on the same frames on every build, and nothing drifts.
+// Fixed limits a run to about 9 hours.
+class TimerWheel {
+public:
+    static const int TICKS_PER_SECOND = 1000;
+
+private:
+    static const int LEVELS = 4;
+    static const int SLOT_BITS = 8;
+    static const int SLOTS = 1 << SLOT_BITS;
+
+    struct Node {
+        uint64_t tick;
+        std::coroutine_handle<> handle;
+        uint32_t next;
+        uint32_t prev;
+        uint8_t level;
+        uint8_t slot;
+    };
+
+    std::vector<Node> nodes;
+    uint32_t freeHead;
+    uint32_t heads[LEVELS][SLOTS];
+    uint64_t currentTick;
+    int64_t leftover;        // Part of a tick carried over, in 1/65536 ms
+    size_t pending;
+
+    uint32_t allocateNode();
+    void link(uint32_t index);
+    void cascade(int level);
+    void step();
+
+public:
+    explicit TimerWheel(size_t reserveTimers);
+    ~TimerWheel();
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    // Move the clock forward, resuming every coroutine whose time has come
+    void advance(Fixed dt);
+
+    // Destroy every waiting coroutine and put the clock back to zero
+    void reset();
+
+    // co_await timers.after(Fixed(2)) / timers.after(1500ms) / timers.at(t)
+    TimerAwaiter after(Fixed seconds) const;
+    template <typename Rep, typename Period>
+    TimerAwaiter after(std::chrono::duration<Rep, Period> delay) const {
+        auto ticks = std::chrono::duration_cast<std::chrono::duration<int64_t, std::ratio<1, TICKS_PER_SECOND>>>(delay);
+        return TimerAwaiter{const_cast<TimerWheel*>(this), currentTick + static_cast<uint64_t>(ticks.count() > 0 ? ticks.count() : 0)};
+    }
+    TimerAwaiter at(Fixed seconds) const;
+
+    // Used by TimerAwaiter; tick is pushed to at least the next tick
+    void schedule(uint64_t tick, std::coroutine_handle<> handle);
+
+    Fixed now() const {
+        return Fixed::fromRaw(static_cast<int32_t>((currentTick << Fixed::FRACTION_BITS) / TICKS_PER_SECOND));
+    }
+    uint64_t getTick() const { return currentTick; }
+    size_t getPendingCount() const { return pending; }
+
+    // The clock and when every waiting timer fires, for the state hash
+    void hashState(StateHash::Stream& stream) const;
+};
+
+#endif
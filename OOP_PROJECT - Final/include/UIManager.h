@@ -3,34 +3,53 @@
 
 #include <SFML/Graphics.hpp>
 #include "Config.h"
+#include "FontAtlas.h"
+#include "BakedText.h"
+#include "NumberText.h"
 #include <string>
 
 class UIManager {
 private:
-    sf::Font font;
-    sf::Text scoreText;
-    sf::Text comboText;
-    sf::Text dashCooldownText;
-    sf::Text gameOverText;
-    sf::Text instructionText;
+    FontAtlas atlas;
+    NumberText scoreText;
+    NumberText comboText;
+    NumberText dashCooldownText;
+    NumberText finalScoreText;
+    BakedText dashReadyText;
+    BakedText gameOverText;
+    BakedText restartText;
+    BakedText titleText;
+    BakedText instructionText;
+    BakedText statsText;
+    sf::RectangleShape overlay;
     
-    bool fontLoaded;
+    bool showCombo;
+    bool dashReady;
+    int menuPlayers;        // Player count shown on the menu
+    uint64_t textUpdates;   // Stats and menu text rebuilds
+
+    // Build every text object
+    void setupTexts();
+    void setupInstructions();
     
 public:
     UIManager();
     
-    // Load font
-    bool loadFont(const std::string& path);
-    
-    // Update displays
+    // Update displays (none of these allocate)
     void updateScore(int score);
     void updateCombo(int combo);
     void updateDashCooldown(float cooldown);
+    void updateStats(const char* text);
+    void updatePlayerCount(int count);     // Menu text (allocates - menus only)
+
+    // How many texts were rebuilt so far (for the metrics exporter)
+    uint64_t getTextUpdates() const;
     
     // Draw
     void drawGameUI(sf::RenderWindow& window);
     void drawGameOver(sf::RenderWindow& window, int finalScore);
     void drawMenu(sf::RenderWindow& window);
+    void drawStats(sf::RenderWindow& window);
 };
 
 #endif
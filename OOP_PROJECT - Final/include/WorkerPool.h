@@ -0,0 +1,45 @@
+#ifndef WORKERPOOL_H
+#define WORKERPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// A few threads for the CPU render passes (light map, bloom). run() splits
+// one job into bands: the calling thread takes band 0, the workers the rest,
+// and it returns once every band is done. Workers sleep between jobs.
+class WorkerPool {
+public:
+    static const int MAX_WORKERS = 3;
+
+private:
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    const std::function<void(int, int)>* task;
+    int generation;
+    int bandCount;
+    std::atomic<int> remaining;
+    bool stopping;
+
+    void workerLoop(int band);
+
+public:
+    // One worker per spare core, up to maxWorkers
+    explicit WorkerPool(int maxWorkers = MAX_WORKERS);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    // Calls task(band, bandCount) once for every band and waits for all of them
+    void run(const std::function<void(int, int)>& job);
+
+    int getBandCount() const { return bandCount; }
+};
+
+#endif
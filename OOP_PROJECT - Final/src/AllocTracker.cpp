@@ -0,0 +1,160 @@
+#include "AllocTracker.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+namespace {
+    const int PHASE_COUNT = static_cast<int>(AllocPhase::COUNT);
+
+    // Plain arrays of atomics - these must work before main() and must
+    // never allocate themselves
+    std::atomic<uint64_t> allocCount[PHASE_COUNT];
+    std::atomic<uint64_t> allocBytes[PHASE_COUNT];
+    uint64_t lastCount[PHASE_COUNT];
+    uint64_t lastBytes[PHASE_COUNT];
+
+    // Each thread starts in OTHER; only the game thread ever changes it
+    thread_local AllocPhase currentPhase = AllocPhase::OTHER;
+
+    void* trackedAlloc(std::size_t size) {
+        int phase = static_cast<int>(currentPhase);
+        allocCount[phase].fetch_add(1, std::memory_order_relaxed);
+        allocBytes[phase].fetch_add(size, std::memory_order_relaxed);
+        return std::malloc(size == 0 ? 1 : size);
+    }
+
+    // Over-aligned types (alignas bigger than what malloc guarantees) come
+    // through here. aligned_alloc wants the size to be a multiple of the
+    // alignment; Windows has its own pair that must be freed with _aligned_free.
+    void* trackedAlignedAlloc(std::size_t size, std::align_val_t alignment) {
+        std::size_t align = static_cast<std::size_t>(alignment);
+        int phase = static_cast<int>(currentPhase);
+        allocCount[phase].fetch_add(1, std::memory_order_relaxed);
+        allocBytes[phase].fetch_add(size, std::memory_order_relaxed);
+        std::size_t rounded = size == 0 ? align : (size + align - 1) / align * align;
+#ifdef _WIN32
+        return _aligned_malloc(rounded, align);
+#else
+        return std::aligned_alloc(align, rounded);
+#endif
+    }
+
+    void alignedFree(void* p) {
+#ifdef _WIN32
+        _aligned_free(p);
+#else
+        std::free(p);
+#endif
+    }
+}
+
+// Global allocation hooks
+void* operator new(std::size_t size) {
+    void* p = trackedAlloc(size);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void* operator new[](std::size_t size) {
+    void* p = trackedAlloc(size);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return trackedAlloc(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return trackedAlloc(size);
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { std::free(p); }
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    void* p = trackedAlignedAlloc(size, alignment);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    void* p = trackedAlignedAlloc(size, alignment);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return trackedAlignedAlloc(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return trackedAlignedAlloc(size, alignment);
+}
+
+void operator delete(void* p, std::align_val_t) noexcept { alignedFree(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { alignedFree(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { alignedFree(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { alignedFree(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept { alignedFree(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { alignedFree(p); }
+
+uint64_t FrameAllocStats::totalCount() const {
+    uint64_t total = 0;
+    for (int i = 0; i < PHASE_COUNT; i++) total += count[i];
+    return total;
+}
+
+uint64_t FrameAllocStats::totalBytes() const {
+    uint64_t total = 0;
+    for (int i = 0; i < PHASE_COUNT; i++) total += bytes[i];
+    return total;
+}
+
+uint64_t FrameAllocStats::gameplayCount() const {
+    return count[static_cast<int>(AllocPhase::INPUT)] +
+           count[static_cast<int>(AllocPhase::UPDATE)] +
+           count[static_cast<int>(AllocPhase::COLLISION)] +
+           count[static_cast<int>(AllocPhase::RENDER)];
+}
+
+void AllocTracker::setPhase(AllocPhase phase) {
+    currentPhase = phase;
+}
+
+AllocPhase AllocTracker::getPhase() {
+    return currentPhase;
+}
+
+FrameAllocStats AllocTracker::endFrame() {
+    FrameAllocStats stats;
+    for (int i = 0; i < PHASE_COUNT; i++) {
+        uint64_t c = allocCount[i].load(std::memory_order_relaxed);
+        uint64_t b = allocBytes[i].load(std::memory_order_relaxed);
+        stats.count[i] = c - lastCount[i];
+        stats.bytes[i] = b - lastBytes[i];
+        lastCount[i] = c;
+        lastBytes[i] = b;
+    }
+    return stats;
+}
+
+const char* AllocTracker::getPhaseName(AllocPhase phase) {
+    switch (phase) {
+        case AllocPhase::OTHER:     return "other";
+        case AllocPhase::INPUT:     return "input";
+        case AllocPhase::UPDATE:    return "update";
+        case AllocPhase::COLLISION: return "collision";
+        case AllocPhase::RENDER:    return "render";
+        case AllocPhase::PRESENT:   return "present";
+        case AllocPhase::OVERLAY:   return "overlay";
+        default:                    return "?";
+    }
+}
@@ -0,0 +1,124 @@
+#include "BakedText.h"
+#include <algorithm>
+#include <iostream>
+
+namespace {
+    // Two triangles for one glyph image at the pen position
+    void addQuad(sf::Vertex* v, float x, float y, const BakedGlyphImage& image, sf::Color color) {
+        float left = x + image.left;
+        float top = y + image.top;
+        float right = left + image.width;
+        float bottom = top + image.height;
+        float u0 = image.x;
+        float v0 = image.y;
+        float u1 = u0 + image.width;
+        float v1 = v0 + image.height;
+
+        v[0] = sf::Vertex(sf::Vector2f(left, top), color, sf::Vector2f(u0, v0));
+        v[1] = sf::Vertex(sf::Vector2f(right, top), color, sf::Vector2f(u1, v0));
+        v[2] = sf::Vertex(sf::Vector2f(left, bottom), color, sf::Vector2f(u0, v1));
+        v[3] = v[2];
+        v[4] = v[1];
+        v[5] = sf::Vertex(sf::Vector2f(right, bottom), color, sf::Vector2f(u1, v1));
+    }
+}
+
+BakedText::BakedText() : atlas(nullptr), style(FontStyle::MEDIUM), fillColor(sf::Color::White),
+                         outlineColor(sf::Color::Black), fillStart(0) {
+}
+
+void BakedText::setFont(const FontAtlas& font, FontStyle textStyle) {
+    atlas = &font;
+    style = textStyle;
+}
+
+void BakedText::setString(const char* text) {
+    vertices.clear();
+    fillStart = 0;
+    bounds = sf::FloatRect();
+    if (!atlas) return;
+
+    bool outlined = atlas->getOutlineThickness(style) > 0;
+    float size = static_cast<float>(atlas->getCharacterSize(style));
+    float lineSpacing = atlas->getLineSpacing(style);
+
+    // Count the quads first so the outlines can go in front of the fill
+    size_t glyphs = 0;
+    for (const char* c = text; *c != '\0'; c++) {
+        const BakedGlyph* g = atlas->findGlyph(style, *c);
+        if (g && g->fill.width > 0) glyphs++;
+    }
+    fillStart = outlined ? glyphs * 6 : 0;
+    vertices.resize(fillStart + glyphs * 6);
+
+    float x = 0;
+    float y = size;     // First baseline, as in sf::Text
+    float minX = 0, minY = 0, maxX = 0, maxY = 0;
+    size_t quad = 0;
+    char previous = '\0';
+    for (const char* c = text; *c != '\0'; c++) {
+        if (*c == '\n') {
+            x = 0;
+            y += lineSpacing;
+            previous = '\0';
+            continue;
+        }
+        if (previous != '\0') x += atlas->getKerning(style, previous, *c);
+        previous = *c;
+
+        const BakedGlyph* g = atlas->findGlyph(style, *c);
+        if (!g) {
+            std::cerr << "Character '" << *c << "' is not in the baked font (re-run font_baker)" << std::endl;
+            continue;
+        }
+        if (g->fill.width > 0) {
+            addQuad(&vertices[fillStart + quad * 6], x, y, g->fill, fillColor);
+            if (outlined) {
+                addQuad(&vertices[quad * 6], x, y, g->outline, outlineColor);
+            }
+
+            // Ink box without the transparent border
+            float left = x + g->fill.left + 1;
+            float top = y + g->fill.top + 1;
+            float right = left + g->fill.width - 2;
+            float bottom = top + g->fill.height - 2;
+            if (quad == 0) {
+                minX = left; minY = top; maxX = right; maxY = bottom;
+            } else {
+                minX = std::min(minX, left);
+                minY = std::min(minY, top);
+                maxX = std::max(maxX, right);
+                maxY = std::max(maxY, bottom);
+            }
+            quad++;
+        }
+        x += g->advance;
+    }
+
+    if (quad > 0) {
+        float outline = static_cast<float>(atlas->getOutlineThickness(style));
+        bounds = sf::FloatRect(minX - outline, minY - outline,
+                               maxX - minX + 2 * outline, maxY - minY + 2 * outline);
+    }
+}
+
+void BakedText::setFillColor(sf::Color color) {
+    fillColor = color;
+    for (size_t i = fillStart; i < vertices.size(); i++) {
+        vertices[i].color = color;
+    }
+}
+
+void BakedText::setOutlineColor(sf::Color color) {
+    outlineColor = color;
+    for (size_t i = 0; i < fillStart; i++) {
+        vertices[i].color = color;
+    }
+}
+
+void BakedText::draw(sf::RenderTarget& target, sf::RenderStates states) const {
+    if (!atlas || vertices.empty()) return;
+    states.transform *= getTransform();
+    states.texture = &atlas->getTexture();
+    target.draw(vertices.data(), vertices.size(), sf::Triangles, states);
+}
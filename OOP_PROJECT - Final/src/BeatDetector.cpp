@@ -0,0 +1,286 @@
+#include "BeatDetector.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+    const char CACHE_MAGIC[4] = {'B', 'E', 'A', 'T'};
+    const uint32_t CACHE_VERSION = 1;
+
+    const float THRESHOLD_RATIO = 1.5f;     // Flux must beat the recent average by 50%
+    const float THRESHOLD_FLOOR = 2.0f;     // ...and this absolute amount (ignores near-silence)
+    const float MIN_BEAT_GAP = 0.2f;        // Seconds between two reported beats
+    const float PI = 3.14159265358979f;
+}
+
+BeatDetector::BeatDetector() : input(64), output(256), running(false),
+                               lastBlockMicros(0), maxBlockMicros(0) {
+    sampleRate = 44100;
+    trackFrames = 0;
+    usingCache = false;
+    cacheWritten = false;
+
+    // Hann window and bit reversal table
+    int bits = 0;
+    while ((1 << bits) < FFT_SIZE) bits++;
+    for (int i = 0; i < FFT_SIZE; i++) {
+        window[i] = 0.5f - 0.5f * std::cos(2.0f * PI * i / (FFT_SIZE - 1));
+
+        int reversed = 0;
+        for (int b = 0; b < bits; b++) {
+            if (i & (1 << b)) reversed |= 1 << (bits - 1 - b);
+        }
+        bitReverse[i] = reversed;
+    }
+
+    // Twiddles for each stage stored one after another (stage of size m starts
+    // at m/2 - 1) so the butterfly loop reads them contiguously and vectorizes
+    for (int half = 1; half < FFT_SIZE; half *= 2) {
+        for (int j = 0; j < half; j++) {
+            float angle = -PI * j / half;
+            twiddleReal[half - 1 + j] = std::cos(angle);
+            twiddleImag[half - 1 + j] = std::sin(angle);
+        }
+    }
+}
+
+BeatDetector::~BeatDetector() {
+    stop();
+}
+
+void BeatDetector::start(unsigned rate, uint64_t frames, const std::string& cacheFile) {
+    stop();
+
+    sampleRate = rate > 0 ? rate : 44100;
+    trackFrames = frames;
+    cachePath = cacheFile;
+
+    std::memset(history, 0, sizeof(history));
+    std::memset(previousMagnitude, 0, sizeof(previousMagnitude));
+    fluxCount = 0;
+    lastFlux = 0;
+    lastThreshold = 0;
+    lastFluxFrame = 0;
+    lastWasRising = false;
+    lastBeatTime = -MIN_BEAT_GAP;
+    cacheCursorLoop = 0;
+    cacheCursor = 0;
+
+    beatMap.clear();
+    beatMapStrength.clear();
+    usingCache = loadCache();
+    cacheWritten = usingCache;
+    if (!usingCache) {
+        // Roughly one beat per 0.2s is the most we can report
+        beatMap.reserve(static_cast<size_t>(trackFrames / sampleRate * 5 + 16));
+        beatMapStrength.reserve(beatMap.capacity());
+    }
+
+    running = true;
+    worker = std::thread(&BeatDetector::workerLoop, this);
+}
+
+void BeatDetector::stop() {
+    if (!running) return;
+    running = false;
+    if (worker.joinable()) {
+        worker.join();
+    }
+}
+
+void BeatDetector::workerLoop() {
+    AudioBlock block;
+    uint64_t expectedFrame = 0;
+
+    while (running.load(std::memory_order_relaxed)) {
+        if (!input.tryPop(block)) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            continue;
+        }
+
+        auto begin = std::chrono::steady_clock::now();
+
+        // The stream was seeked - start the analysis over from there
+        if (block.startFrame != expectedFrame) {
+            std::memset(history, 0, sizeof(history));
+            fluxCount = 0;
+            lastWasRising = false;
+            cacheCursorLoop = trackFrames > 0 ? block.startFrame / trackFrames : 0;
+            cacheCursor = 0;
+        }
+        expectedFrame = block.startFrame + AudioBlock::SIZE;
+
+        if (usingCache) {
+            replayCache(block);
+        } else {
+            analyseBlock(block);
+            // Heard the whole track once - remember its beats for next time
+            if (!cacheWritten && trackFrames > 0 && block.startFrame >= trackFrames) {
+                saveCache();
+                cacheWritten = true;
+            }
+        }
+
+        int64_t micros = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - begin).count();
+        lastBlockMicros.store(micros, std::memory_order_relaxed);
+        if (micros > maxBlockMicros.load(std::memory_order_relaxed)) {
+            maxBlockMicros.store(micros, std::memory_order_relaxed);
+        }
+    }
+}
+
+void BeatDetector::analyseBlock(const AudioBlock& block) {
+    // Slide the analysis window along by one block
+    std::memmove(history, history + AudioBlock::SIZE, (FFT_SIZE - AudioBlock::SIZE) * sizeof(float));
+    std::memcpy(history + FFT_SIZE - AudioBlock::SIZE, block.samples, AudioBlock::SIZE * sizeof(float));
+
+    for (int i = 0; i < FFT_SIZE; i++) {
+        real[bitReverse[i]] = history[i] * window[i];
+        imag[i] = 0;
+    }
+    fft();
+
+    // Spectral flux: total increase in (log) magnitude since the last block
+    float flux = 0;
+    for (int k = 0; k < FFT_SIZE / 2; k++) {
+        magnitude[k] = std::log(1.0f + 10.0f * std::sqrt(real[k] * real[k] + imag[k] * imag[k]));
+    }
+    for (int k = 0; k < FFT_SIZE / 2; k++) {
+        float rise = magnitude[k] - previousMagnitude[k];
+        flux += rise > 0 ? rise : 0;
+    }
+    std::memcpy(previousMagnitude, magnitude, sizeof(magnitude));
+
+    // Adaptive threshold from the recent flux average
+    int used = fluxCount < FLUX_HISTORY ? fluxCount : FLUX_HISTORY;
+    float average = 0;
+    for (int i = 0; i < used; i++) average += fluxHistory[i];
+    if (used > 0) average /= used;
+    float threshold = average * THRESHOLD_RATIO + THRESHOLD_FLOOR;
+    fluxHistory[fluxCount % FLUX_HISTORY] = flux;
+    fluxCount++;
+
+    // The previous block was a peak if flux rose into it and fell after it
+    bool rising = flux > lastFlux;
+    if (lastWasRising && !rising && lastFlux > lastThreshold && used == FLUX_HISTORY) {
+        reportBeat(static_cast<float>(lastFluxFrame) / sampleRate, lastFlux / lastThreshold);
+    }
+    lastWasRising = rising;
+    lastFlux = flux;
+    lastThreshold = threshold;
+    lastFluxFrame = block.startFrame + AudioBlock::SIZE - FFT_SIZE / 2;  // Centre of the window
+}
+
+void BeatDetector::replayCache(const AudioBlock& block) {
+    if (beatMap.empty() || trackFrames == 0) return;
+
+    uint64_t end = block.startFrame + AudioBlock::SIZE;
+    while (true) {
+        uint64_t frame = cacheCursorLoop * trackFrames
+                       + static_cast<uint64_t>(beatMap[cacheCursor] * sampleRate);
+        if (frame >= end) break;
+        if (frame >= block.startFrame) {
+            reportBeat(static_cast<float>(frame) / sampleRate, beatMapStrength[cacheCursor]);
+        }
+        cacheCursor++;
+        if (cacheCursor == beatMap.size()) {
+            cacheCursor = 0;
+            cacheCursorLoop++;
+        }
+    }
+}
+
+// In-place radix-2 FFT on real/imag (input already in bit-reversed order)
+void BeatDetector::fft() {
+    for (int half = 1; half < FFT_SIZE; half *= 2) {
+        const float* wr = twiddleReal + half - 1;
+        const float* wi = twiddleImag + half - 1;
+        for (int start = 0; start < FFT_SIZE; start += half * 2) {
+            float* ar = real + start;
+            float* ai = imag + start;
+            float* br = ar + half;
+            float* bi = ai + half;
+            for (int j = 0; j < half; j++) {
+                float tr = br[j] * wr[j] - bi[j] * wi[j];
+                float ti = br[j] * wi[j] + bi[j] * wr[j];
+                br[j] = ar[j] - tr;
+                bi[j] = ai[j] - ti;
+                ar[j] += tr;
+                ai[j] += ti;
+            }
+        }
+    }
+}
+
+void BeatDetector::reportBeat(float time, float strength) {
+    if (time - lastBeatTime < MIN_BEAT_GAP) return;
+    lastBeatTime = time;
+
+    BeatEvent beat;
+    beat.time = time;
+    beat.strength = strength;
+    output.tryPush(beat);  // Game isn't reading - drop it
+
+    // Beats from the first play through make up the beat map
+    if (!usingCache && trackFrames > 0 && time * sampleRate < trackFrames
+        && beatMap.size() < beatMap.capacity()) {
+        beatMap.push_back(time);
+        beatMapStrength.push_back(strength);
+    }
+}
+
+// Cache layout: "BEAT", version, sample rate, track frames, count,
+// then count x (time, strength)
+bool BeatDetector::loadCache() {
+    std::FILE* file = std::fopen(cachePath.c_str(), "rb");
+    if (!file) return false;
+
+    char magic[4];
+    uint32_t version = 0, rate = 0, count = 0;
+    uint64_t frames = 0;
+    bool ok = std::fread(magic, 1, 4, file) == 4 && std::memcmp(magic, CACHE_MAGIC, 4) == 0
+           && std::fread(&version, sizeof(version), 1, file) == 1 && version == CACHE_VERSION
+           && std::fread(&rate, sizeof(rate), 1, file) == 1 && rate == sampleRate
+           && std::fread(&frames, sizeof(frames), 1, file) == 1 && frames == trackFrames
+           && std::fread(&count, sizeof(count), 1, file) == 1 && count > 0;
+
+    if (ok) {
+        beatMap.resize(count);
+        beatMapStrength.resize(count);
+        for (uint32_t i = 0; i < count && ok; i++) {
+            ok = std::fread(&beatMap[i], sizeof(float), 1, file) == 1
+              && std::fread(&beatMapStrength[i], sizeof(float), 1, file) == 1;
+        }
+    }
+    std::fclose(file);
+
+    // A different or changed track - analyse it again
+    if (!ok) {
+        beatMap.clear();
+        beatMapStrength.clear();
+    }
+    return ok;
+}
+
+void BeatDetector::saveCache() {
+    if (beatMap.empty() || cachePath.empty()) return;
+
+    std::FILE* file = std::fopen(cachePath.c_str(), "wb");
+    if (!file) return;
+
+    uint32_t version = CACHE_VERSION;
+    uint32_t rate = sampleRate;
+    uint32_t count = static_cast<uint32_t>(beatMap.size());
+    std::fwrite(CACHE_MAGIC, 1, 4, file);
+    std::fwrite(&version, sizeof(version), 1, file);
+    std::fwrite(&rate, sizeof(rate), 1, file);
+    std::fwrite(&trackFrames, sizeof(trackFrames), 1, file);
+    std::fwrite(&count, sizeof(count), 1, file);
+    for (uint32_t i = 0; i < count; i++) {
+        std::fwrite(&beatMap[i], sizeof(float), 1, file);
+        std::fwrite(&beatMapStrength[i], sizeof(float), 1, file);
+    }
+    std::fclose(file);
+}
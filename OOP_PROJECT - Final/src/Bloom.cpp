@@ -0,0 +1,310 @@
+#include "Bloom.h"
+#include "Config.h"
+#include <SFML/OpenGL.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace {
+    // Per quality: which level gets blurred and how wide (OFF, LOW, MEDIUM, HIGH)
+    const int BLUR_LEVEL[] = {1, 2, 1, 1};
+    const int BLUR_RADIUS[] = {0, 4, 6, 10};
+
+    const int COLUMN_TILE = 16;     // Columns per vertical-pass tile (16 RGBA pixels = 256 bytes a row)
+
+    // One blur pass; the first one thresholds every tap, the second scales
+    const char* BLUR_SHADER = R"(
+        uniform sampler2D source;
+        uniform vec2 direction;
+        uniform float threshold;
+        uniform float strength;
+        uniform float weights[13];
+        uniform int radius;
+
+        vec3 bright(vec2 uv) {
+            vec3 c = texture2D(source, uv).rgb;
+            if (threshold <= 0.0) return c;
+            float brightest = max(c.r, max(c.g, c.b));
+            return c * (max(brightest - threshold, 0.0) / max(brightest, 0.0001));
+        }
+
+        void main() {
+            vec2 uv = gl_TexCoord[0].xy;
+            vec3 sum = bright(uv) * weights[0];
+            for (int i = 1; i <= 12; i++) {
+                if (i > radius) break;
+                vec2 offset = direction * float(i);
+                sum += (bright(uv - offset) + bright(uv + offset)) * weights[i];
+            }
+            gl_FragColor = vec4(sum * strength, 1.0);
+        }
+    )";
+
+    // One RGBA pixel as four floats - a single SSE register where available
+#ifdef __SSE2__
+    typedef __m128 Pixel;
+    inline Pixel load(const float* p) { return _mm_loadu_ps(p); }
+    inline void store(float* p, Pixel v) { _mm_storeu_ps(p, v); }
+    inline Pixel add(Pixel a, Pixel b) { return _mm_add_ps(a, b); }
+    inline Pixel mul(Pixel a, Pixel b) { return _mm_mul_ps(a, b); }
+    inline Pixel splat(float f) { return _mm_set1_ps(f); }
+#else
+    struct Pixel { float c[4]; };
+    inline Pixel load(const float* p) { return Pixel{{p[0], p[1], p[2], p[3]}}; }
+    inline void store(float* p, Pixel v) { for (int i = 0; i < 4; i++) p[i] = v.c[i]; }
+    inline Pixel add(Pixel a, Pixel b) { for (int i = 0; i < 4; i++) a.c[i] += b.c[i]; return a; }
+    inline Pixel mul(Pixel a, Pixel b) { for (int i = 0; i < 4; i++) a.c[i] *= b.c[i]; return a; }
+    inline Pixel splat(float f) { return Pixel{{f, f, f, f}}; }
+#endif
+}
+
+Bloom::Bloom() {
+    quality = BloomQuality::OFF;
+    level = BLUR_LEVEL[0];
+    radius = 0;
+    lastMs = 0;
+    for (float& w : weights) w = 0;
+
+    // Level l is 1/2^(l+1) of the world, rounded up
+    available = true;
+    for (int l = 0; l < LEVELS; l++) {
+        unsigned divisor = 2u << l;
+        if (!levels[l].create((WINDOW_WIDTH + divisor - 1) / divisor, (WINDOW_HEIGHT + divisor - 1) / divisor)) {
+            available = false;
+        }
+        levels[l].setSmooth(true);  // The next halving averages 2x2 blocks through this
+    }
+    if (!available) {
+        std::cerr << "Bloom disabled: could not create its render textures" << std::endl;
+    }
+
+    shaderPath = available && BLOOM_USE_SHADER && sf::Shader::isAvailable() &&
+                 blurShader.loadFromMemory(BLUR_SHADER, sf::Shader::Fragment);
+    if (shaderPath) {
+        for (int l = 1; l < LEVELS; l++) {
+            sf::Vector2u size = levels[l].getSize();
+            for (sf::RenderTexture& target : blurTargets[l]) {
+                target.create(size.x, size.y);
+                target.setSmooth(true);
+            }
+        }
+    } else {
+        // Level 1 is the biggest one ever blurred
+        sf::Vector2u size = levels[1].getSize();
+        size_t texels = static_cast<size_t>(size.x) * size.y;
+        readback.resize(texels * 4);
+        paddedRows.resize(static_cast<size_t>(WorkerPool::MAX_WORKERS + 1) * (size.x + 2 * MAX_RADIUS) * 4);
+        horizontal.resize(texels * 4);
+        pixels.resize(texels * 4);
+        cpuResult.create(size.x, size.y);
+        cpuResult.setSmooth(true);
+    }
+}
+
+void Bloom::setQuality(BloomQuality q) {
+    quality = q;
+    level = BLUR_LEVEL[static_cast<int>(q)];
+    radius = BLUR_RADIUS[static_cast<int>(q)];
+
+    // Gaussian with sigma = radius / 2, normalized over -radius..radius
+    for (float& w : weights) w = 0;
+    if (radius == 0) return;
+    float sigma = radius / 2.0f;
+    float total = 0;
+    for (int i = 0; i <= radius; i++) {
+        weights[i] = std::exp(-(i * i) / (2 * sigma * sigma));
+        total += i == 0 ? weights[i] : 2 * weights[i];
+    }
+    for (int i = 0; i <= radius; i++) {
+        weights[i] /= total;
+    }
+}
+
+const char* Bloom::getQualityName(BloomQuality q) {
+    switch (q) {
+        case BloomQuality::OFF:    return "off";
+        case BloomQuality::LOW:    return "low";
+        case BloomQuality::MEDIUM: return "medium";
+        case BloomQuality::HIGH:   return "high";
+    }
+    return "?";
+}
+
+void Bloom::apply(sf::RenderTexture& world, sf::Vector2u area, WorkerPool& pool) {
+    if (quality == BloomQuality::OFF || !available || area.x == 0 || area.y == 0) return;
+    auto begin = std::chrono::steady_clock::now();
+
+    // 1. Halve the world down to the level this quality blurs
+    const sf::Texture* source = &world.getTexture();
+    sf::Vector2u sourceSize = area;
+    for (int l = 0; l <= level; l++) {
+        sf::Vector2u size = levels[l].getSize();
+        sprite.setTexture(*source);
+        sprite.setTextureRect(sf::IntRect(0, 0, sourceSize.x, sourceSize.y));
+        sprite.setScale(static_cast<float>(size.x) / sourceSize.x, static_cast<float>(size.y) / sourceSize.y);
+        levels[l].clear(sf::Color::Black);
+        levels[l].draw(sprite);
+        levels[l].display();
+        source = &levels[l].getTexture();
+        sourceSize = size;
+    }
+
+    // 2-3. Threshold and blur
+    if (shaderPath) {
+        blurOnGpu();
+        source = &blurTargets[level][1].getTexture();
+    } else {
+        blurOnCpu(pool);
+        cpuResult.update(pixels.data(), sourceSize.x, sourceSize.y, 0, 0);
+        source = &cpuResult;
+    }
+
+    // 4. Add it back over the world, in texels
+    sf::Vector2u worldSize = world.getSize();
+    world.setView(sf::View(sf::FloatRect(0, 0, static_cast<float>(worldSize.x), static_cast<float>(worldSize.y))));
+    sprite.setTexture(*source);
+    sprite.setTextureRect(sf::IntRect(0, 0, sourceSize.x, sourceSize.y));
+    sprite.setScale(static_cast<float>(area.x) / sourceSize.x, static_cast<float>(area.y) / sourceSize.y);
+    world.draw(sprite, sf::BlendAdd);
+    world.display();
+
+    lastMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - begin).count();
+}
+
+void Bloom::blurOnGpu() {
+    sf::Vector2u size = levels[level].getSize();
+    sprite.setTextureRect(sf::IntRect(0, 0, size.x, size.y));
+    sprite.setScale(1, 1);
+    blurShader.setUniform("source", sf::Shader::CurrentTexture);
+    blurShader.setUniformArray("weights", weights, MAX_RADIUS + 1);
+    blurShader.setUniform("radius", radius);
+
+    // Horizontal, keeping only the bright colors
+    blurShader.setUniform("direction", sf::Vector2f(1.0f / size.x, 0));
+    blurShader.setUniform("threshold", BLOOM_THRESHOLD);
+    blurShader.setUniform("strength", 1.0f);
+    sprite.setTexture(levels[level].getTexture());
+    blurTargets[level][0].clear(sf::Color::Black);
+    blurTargets[level][0].draw(sprite, &blurShader);
+    blurTargets[level][0].display();
+
+    // Vertical
+    blurShader.setUniform("direction", sf::Vector2f(0, 1.0f / size.y));
+    blurShader.setUniform("threshold", 0.0f);
+    blurShader.setUniform("strength", BLOOM_STRENGTH);
+    sprite.setTexture(blurTargets[level][0].getTexture());
+    blurTargets[level][1].clear(sf::Color::Black);
+    blurTargets[level][1].draw(sprite, &blurShader);
+    blurTargets[level][1].display();
+}
+
+void Bloom::blurOnCpu(WorkerPool& pool) {
+    sf::Vector2u size = levels[level].getSize();
+    int width = static_cast<int>(size.x);
+    int height = static_cast<int>(size.y);
+
+    // Into preallocated memory (copyToImage would allocate every frame)
+    levels[level].setActive(true);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, readback.data());
+
+    // Rows in bands, then column tiles dealt out round robin
+    size_t paddedLength = static_cast<size_t>(levels[1].getSize().x + 2 * MAX_RADIUS) * 4;
+    pool.run([this, height, paddedLength](int band, int bands) {
+        blurRows(height * band / bands, height * (band + 1) / bands, &paddedRows[band * paddedLength]);
+    });
+    pool.run([this, width](int band, int bands) {
+        int tiles = (width + COLUMN_TILE - 1) / COLUMN_TILE;
+        for (int t = band; t < tiles; t += bands) {
+            blurColumns(t * COLUMN_TILE, std::min(width, (t + 1) * COLUMN_TILE));
+        }
+    });
+}
+
+// Threshold and horizontal pass for rows firstRow..lastRow - 1
+void Bloom::blurRows(int firstRow, int lastRow, float* padded) {
+    sf::Vector2u size = levels[level].getSize();
+    int width = static_cast<int>(size.x);
+    int height = static_cast<int>(size.y);
+    float* row = padded + MAX_RADIUS * 4;
+
+    Pixel weight[MAX_RADIUS + 1];
+    for (int k = 0; k <= radius; k++) {
+        weight[k] = splat(weights[k]);
+    }
+
+    for (int y = firstRow; y < lastRow; y++) {
+        // glReadPixels starts at the bottom row
+        const uint8_t* in = &readback[static_cast<size_t>(height - 1 - y) * width * 4];
+        for (int x = 0; x < width; x++) {
+            float r = in[x * 4 + 0] / 255.0f;
+            float g = in[x * 4 + 1] / 255.0f;
+            float b = in[x * 4 + 2] / 255.0f;
+            float brightest = std::max(r, std::max(g, b));
+            float keep = brightest > BLOOM_THRESHOLD ? (brightest - BLOOM_THRESHOLD) / brightest : 0.0f;
+            row[x * 4 + 0] = r * keep;
+            row[x * 4 + 1] = g * keep;
+            row[x * 4 + 2] = b * keep;
+            row[x * 4 + 3] = 0;
+        }
+
+        // Repeat the edge pixels into the padding
+        for (int k = 1; k <= radius; k++) {
+            store(row - k * 4, load(row));
+            store(row + (width - 1 + k) * 4, load(row + (width - 1) * 4));
+        }
+
+        float* out = &horizontal[static_cast<size_t>(y) * width * 4];
+        for (int x = 0; x < width; x++) {
+            const float* center = row + x * 4;
+            Pixel sum = mul(load(center), weight[0]);
+            for (int k = 1; k <= radius; k++) {
+                sum = add(sum, mul(add(load(center - k * 4), load(center + k * 4)), weight[k]));
+            }
+            store(out + x * 4, sum);
+        }
+    }
+}
+
+// Vertical pass for one tile of columns, straight to 8 bit
+void Bloom::blurColumns(int firstColumn, int lastColumn) {
+    sf::Vector2u size = levels[level].getSize();
+    int width = static_cast<int>(size.x);
+    int height = static_cast<int>(size.y);
+    int count = lastColumn - firstColumn;
+
+    Pixel weight[MAX_RADIUS + 1];
+    for (int k = 0; k <= radius; k++) {
+        weight[k] = splat(weights[k]);
+    }
+    Pixel scale = splat(BLOOM_STRENGTH * 255.0f);
+    Pixel sum[COLUMN_TILE];
+    float value[4];
+
+    for (int y = 0; y < height; y++) {
+        const float* center = &horizontal[(static_cast<size_t>(y) * width + firstColumn) * 4];
+        for (int i = 0; i < count; i++) {
+            sum[i] = mul(load(center + i * 4), weight[0]);
+        }
+        for (int k = 1; k <= radius; k++) {
+            const float* above = &horizontal[(static_cast<size_t>(std::max(0, y - k)) * width + firstColumn) * 4];
+            const float* below = &horizontal[(static_cast<size_t>(std::min(height - 1, y + k)) * width + firstColumn) * 4];
+            for (int i = 0; i < count; i++) {
+                sum[i] = add(sum[i], mul(add(load(above + i * 4), load(below + i * 4)), weight[k]));
+            }
+        }
+
+        uint8_t* out = &pixels[(static_cast<size_t>(y) * width + firstColumn) * 4];
+        for (int i = 0; i < count; i++) {
+            store(value, mul(sum[i], scale));
+            out[i * 4 + 0] = static_cast<uint8_t>(std::min(255.0f, value[0]));
+            out[i * 4 + 1] = static_cast<uint8_t>(std::min(255.0f, value[1]));
+            out[i * 4 + 2] = static_cast<uint8_t>(std::min(255.0f, value[2]));
+            out[i * 4 + 3] = 255;
+        }
+    }
+}
@@ -0,0 +1,209 @@
+#include "BulletField.h"
+#include "Config.h"
+#include "StateHash.h"
+#include <cmath>
+
+namespace {
+    const int SHIFT = Fixed::FRACTION_BITS;
+    const int32_t MAX_AGE = Fixed(20).raw();             // Seconds before a bullet gives up
+    const int32_t OFFSCREEN_MARGIN = Fixed(150).raw();   // Patterns may start just off screen
+    const int32_t FULL_TURN = Fixed(360).raw();
+
+    const sf::Color PALETTE[BulletField::PALETTE_SIZE] = {
+        COLOR_RED, COLOR_BLUE, COLOR_YELLOW, COLOR_GREEN, COLOR_PURPLE, COLOR_ORANGE
+    };
+
+    // a * b for raw 16.16 values
+    inline int32_t mul(int32_t a, int32_t b) {
+        return static_cast<int32_t>((static_cast<int64_t>(a) * b) >> SHIFT);
+    }
+}
+
+BulletField::BulletField() {
+    // All storage is sized once; count says how much of it is live
+    baseX.resize(MAX_BULLETS); baseY.resize(MAX_BULLETS);
+    x.resize(MAX_BULLETS); y.resize(MAX_BULLETS);
+    dirX.resize(MAX_BULLETS); dirY.resize(MAX_BULLETS);
+    speed.resize(MAX_BULLETS);
+    halfSize.resize(MAX_BULLETS);
+    sineAmplitude.resize(MAX_BULLETS); sinePhase.resize(MAX_BULLETS); sineRate.resize(MAX_BULLETS);
+    turnRate.resize(MAX_BULLETS);
+    accel.resize(MAX_BULLETS);
+    age.resize(MAX_BULLETS);
+    color.resize(MAX_BULLETS);
+    pattern.resize(MAX_BULLETS);
+    vertices.resize(MAX_BULLETS * 6);
+    count = 0;
+}
+
+sf::Color BulletField::getPaletteColor(int index) {
+    if (index < 0 || index >= PALETTE_SIZE) index = 0;
+    return PALETTE[index];
+}
+
+void BulletField::spawn(FixedVec2 position, Fixed angleDegrees, int paletteIndex,
+                        const BulletMotion& motion, int patternId) {
+    if (count >= speed.size()) return;  // Full - the pattern just fires fewer bullets
+
+    size_t i = count++;
+    baseX[i] = x[i] = position.x.raw();
+    baseY[i] = y[i] = position.y.raw();
+    dirX[i] = Fixed::cosDeg(angleDegrees).raw();
+    dirY[i] = Fixed::sinDeg(angleDegrees).raw();
+    speed[i] = motion.speed.raw();
+    halfSize[i] = motion.halfSize.raw();
+    sineAmplitude[i] = motion.sineAmplitude.raw();
+    sinePhase[i] = 0;
+    sineRate[i] = (motion.sineFrequency * Fixed(360)).raw();
+    turnRate[i] = motion.curve.raw();
+    accel[i] = motion.accel.raw();
+    age[i] = 0;
+    color[i] = static_cast<uint8_t>(paletteIndex % PALETTE_SIZE);
+    pattern[i] = static_cast<uint8_t>(patternId);
+}
+
+void BulletField::removeAt(size_t i) {
+    // Swap the last bullet into the hole (order doesn't matter)
+    size_t last = --count;
+    baseX[i] = baseX[last]; baseY[i] = baseY[last];
+    x[i] = x[last]; y[i] = y[last];
+    dirX[i] = dirX[last]; dirY[i] = dirY[last];
+    speed[i] = speed[last];
+    halfSize[i] = halfSize[last];
+    sineAmplitude[i] = sineAmplitude[last]; sinePhase[i] = sinePhase[last]; sineRate[i] = sineRate[last];
+    turnRate[i] = turnRate[last];
+    accel[i] = accel[last];
+    age[i] = age[last];
+    color[i] = color[last];
+    pattern[i] = pattern[last];
+}
+
+void BulletField::update(Fixed dt) {
+    const int32_t step = dt.raw();
+
+    // Steering first - only bullets that actually turn pay for sin/cos
+    for (size_t i = 0; i < count; i++) {
+        if (turnRate[i] != 0) {
+            Fixed angle = Fixed::fromRaw(mul(turnRate[i], step));
+            int32_t turnCos = Fixed::cosDeg(angle).raw();
+            int32_t turnSin = Fixed::sinDeg(angle).raw();
+            int32_t dx = dirX[i];
+            dirX[i] = mul(dx, turnCos) - mul(dirY[i], turnSin);
+            dirY[i] = mul(dx, turnSin) + mul(dirY[i], turnCos);
+        }
+    }
+
+    // Straight-line part, written so the compiler can vectorize it
+    for (size_t i = 0; i < count; i++) {
+        speed[i] += mul(accel[i], step);
+        int32_t distance = mul(speed[i], step);
+        baseX[i] += mul(dirX[i], distance);
+        baseY[i] += mul(dirY[i], distance);
+        age[i] += step;
+        x[i] = baseX[i];
+        y[i] = baseY[i];
+    }
+
+    // Sideways wobble for sine lanes
+    for (size_t i = 0; i < count; i++) {
+        if (sineAmplitude[i] != 0) {
+            sinePhase[i] += mul(sineRate[i], step);
+            if (sinePhase[i] >= FULL_TURN) sinePhase[i] -= FULL_TURN;
+            int32_t offset = mul(sineAmplitude[i], Fixed::sinDeg(Fixed::fromRaw(sinePhase[i])).raw());
+            x[i] -= mul(dirY[i], offset);
+            y[i] += mul(dirX[i], offset);
+        }
+    }
+
+    // Retire bullets that left the screen or lived too long
+    const int32_t right = Fixed(WINDOW_WIDTH).raw() + OFFSCREEN_MARGIN;
+    const int32_t bottom = Fixed(WINDOW_HEIGHT).raw() + OFFSCREEN_MARGIN;
+    for (size_t i = 0; i < count;) {
+        bool gone = x[i] < -OFFSCREEN_MARGIN || x[i] > right ||
+                    y[i] < -OFFSCREEN_MARGIN || y[i] > bottom ||
+                    age[i] > MAX_AGE;
+        if (gone) {
+            removeAt(i);
+        } else {
+            i++;
+        }
+    }
+}
+
+void BulletField::clear() {
+    count = 0;
+}
+
+int BulletField::findHit(const FixedRect& playerBounds, sf::Color playerColor) const {
+    int32_t left = playerBounds.left.raw();
+    int32_t right = (playerBounds.left + playerBounds.width).raw();
+    int32_t top = playerBounds.top.raw();
+    int32_t bottom = (playerBounds.top + playerBounds.height).raw();
+
+    for (size_t i = 0; i < count; i++) {
+        int32_t h = halfSize[i];
+        if (x[i] + h < left || x[i] - h > right || y[i] + h < top || y[i] - h > bottom) continue;
+        if (PALETTE[color[i]] == playerColor) continue;
+        return static_cast<int>(i);
+    }
+    return -1;
+}
+
+unsigned BulletField::findHits(const FixedRect* playerBounds, const sf::Color* playerColors,
+                               int playerCount) const {
+    unsigned hitMask = 0;
+    unsigned allPlayers = (1u << playerCount) - 1;
+
+    for (size_t i = 0; i < count && hitMask != allPlayers; i++) {
+        int32_t h = halfSize[i];
+        for (int p = 0; p < playerCount; p++) {
+            const FixedRect& b = playerBounds[p];
+            if (x[i] + h < b.left.raw() || x[i] - h > (b.left + b.width).raw() ||
+                y[i] + h < b.top.raw() || y[i] - h > (b.top + b.height).raw()) continue;
+            if (PALETTE[color[i]] == playerColors[p]) continue;
+            hitMask |= 1u << p;
+        }
+    }
+    return hitMask;
+}
+
+void BulletField::countByPattern(int* counts, int maxPatterns) const {
+    for (int p = 0; p < maxPatterns; p++) counts[p] = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (pattern[i] < maxPatterns) counts[pattern[i]]++;
+    }
+}
+
+void BulletField::hashState(StateHash::Stream& stream) const {
+    stream.add(static_cast<uint32_t>(count));
+    if (count == 0) return;
+    for (const std::vector<int32_t>* column : {&baseX, &baseY, &x, &y, &dirX, &dirY, &speed, &halfSize,
+                                              &sineAmplitude, &sinePhase, &sineRate, &turnRate, &accel, &age}) {
+        stream.update(column->data(), count * sizeof(int32_t));
+    }
+    stream.update(color.data(), count);
+}
+
+void BulletField::draw(sf::RenderTarget& target) {
+    if (count == 0) return;
+
+    // Diamonds spinning with their age look busy without any per-bullet shapes
+    for (size_t i = 0; i < count; i++) {
+        float h = Fixed::fromRaw(halfSize[i]).toFloat();
+        float spin = Fixed::fromRaw(age[i]).toFloat() * 3.0f;
+        float c = std::cos(spin) * h;
+        float s = std::sin(spin) * h;
+        sf::Vector2f center = getPosition(i);
+        sf::Vector2f a = center + sf::Vector2f(c, s);
+        sf::Vector2f b = center + sf::Vector2f(-s, c);
+        sf::Vector2f d = center + sf::Vector2f(s, -c);
+        sf::Vector2f e = center - sf::Vector2f(c, s);
+        sf::Color col = PALETTE[color[i]];
+
+        sf::Vertex* v = &vertices[i * 6];
+        v[0].position = a; v[1].position = b; v[2].position = e;
+        v[3].position = a; v[4].position = e; v[5].position = d;
+        for (int k = 0; k < 6; k++) v[k].color = col;
+    }
+    target.draw(&vertices[0], count * 6, sf::Triangles);
+}
@@ -0,0 +1,771 @@
+#include "Collision.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+// SIMD paths of the swept test are picked at startup from what the CPU has,
+// so a default build (plain x86-64) uses them too
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define COLLISION_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define SIMD_TARGET(isa)
+#else
+#define SIMD_TARGET(isa) __attribute__((target(isa)))
+#endif
+#endif
+
+void OrientedBoxBatch::clear() {
+    centerX.clear();
+    centerY.clear();
+    halfW.clear();
+    halfH.clear();
+    cosA.clear();
+    sinA.clear();
+    fromX.clear();
+    fromY.clear();
+    fromCos.clear();
+    fromSin.clear();
+}
+
+void OrientedBoxBatch::reserve(size_t count) {
+    centerX.reserve(count);
+    centerY.reserve(count);
+    halfW.reserve(count);
+    halfH.reserve(count);
+    cosA.reserve(count);
+    sinA.reserve(count);
+    fromX.reserve(count);
+    fromY.reserve(count);
+    fromCos.reserve(count);
+    fromSin.reserve(count);
+}
+
+void OrientedBoxBatch::add(FixedVec2 center, FixedVec2 halfSize, Fixed cosRotation, Fixed sinRotation) {
+    add(center, halfSize, cosRotation, sinRotation, center, cosRotation, sinRotation);
+}
+
+void OrientedBoxBatch::add(FixedVec2 center, FixedVec2 halfSize, Fixed cosRotation, Fixed sinRotation,
+                           FixedVec2 fromCenter, Fixed fromCosRotation, Fixed fromSinRotation) {
+    centerX.push_back(center.x.raw());
+    centerY.push_back(center.y.raw());
+    halfW.push_back(halfSize.x.raw());
+    halfH.push_back(halfSize.y.raw());
+    cosA.push_back(cosRotation.raw());
+    sinA.push_back(sinRotation.raw());
+    fromX.push_back(fromCenter.x.raw());
+    fromY.push_back(fromCenter.y.raw());
+    fromCos.push_back(fromCosRotation.raw());
+    fromSin.push_back(fromSinRotation.raw());
+}
+
+namespace {
+    const int SHIFT = Fixed::FRACTION_BITS;
+
+    inline int64_t absolute(int64_t v) { return v < 0 ? -v : v; }
+
+    const int64_t ONE = Fixed::ONE;
+    const int64_t SWEEP_STEP = 4LL << SHIFT;    // Exact test at least every 4 px of relative travel
+    const int64_t MAX_SWEEP_STEPS = 32;
+    const int REFINE_STEPS = 12;                // Bisections between the last miss and the first hit
+
+    inline int64_t lerp(int64_t a, int64_t b, int64_t t) { return a + (((b - a) * t) >> SHIFT); }
+
+    // Narrow [enter, exit] (fractions of the tick) to when |r0 + d * t| <= extent.
+    // Widened by one raw unit each way so rounding never loses a contact.
+    bool clipSlab(int64_t r0, int64_t d, int64_t extent, int64_t& enter, int64_t& exit) {
+        if (d == 0) return absolute(r0) <= extent;
+        int64_t t1 = ((-extent - r0) << SHIFT) / d;
+        int64_t t2 = ((extent - r0) << SHIFT) / d;
+        if (t1 > t2) std::swap(t1, t2);
+        enter = std::max(enter, t1 - 1);
+        exit = std::min(exit, t2 + 1);
+        return enter <= exit;
+    }
+}
+
+bool Collision::boxIntersectsOrientedBox(const FixedRect& box, FixedVec2 center, FixedVec2 halfSize,
+                                         Fixed cosRotation, Fixed sinRotation) {
+    // Raw 16.16 values; products are 32.32 in 64 bits and shifted back
+    int64_t px = box.width.raw() >> 1;
+    int64_t py = box.height.raw() >> 1;
+    int64_t dx = center.x.raw() - (box.left.raw() + px);
+    int64_t dy = center.y.raw() - (box.top.raw() + py);
+    int64_t hw = halfSize.x.raw();
+    int64_t hh = halfSize.y.raw();
+    int64_t c = cosRotation.raw();
+    int64_t s = sinRotation.raw();
+    int64_t ac = absolute(c);
+    int64_t as = absolute(s);
+
+    // Only 4 axes matter: the world axes (player box) and the rotated box's own axes
+    if (absolute(dx) > px + ((ac * hw + as * hh) >> SHIFT)) return false;
+    if (absolute(dy) > py + ((as * hw + ac * hh) >> SHIFT)) return false;
+    if (absolute((dx * c + dy * s) >> SHIFT) > hw + ((px * ac + py * as) >> SHIFT)) return false;
+    if (absolute((dy * c - dx * s) >> SHIFT) > hh + ((px * as + py * ac) >> SHIFT)) return false;
+    return true;
+}
+
+int Collision::testBatch(const FixedRect* boxes, int boxCount, const OrientedBoxBatch& batch,
+                         std::vector<uint8_t>& hits) {
+    const size_t BLOCK = 64;
+    size_t count = batch.size();
+    hits.resize(count);
+    if (boxCount > MAX_BATCH_BOXES) boxCount = MAX_BATCH_BOXES;
+
+    // Player boxes as center + half extents
+    int64_t px[MAX_BATCH_BOXES], py[MAX_BATCH_BOXES], bx[MAX_BATCH_BOXES], by[MAX_BATCH_BOXES];
+    for (int b = 0; b < boxCount; b++) {
+        px[b] = boxes[b].width.raw() >> 1;
+        py[b] = boxes[b].height.raw() >> 1;
+        bx[b] = boxes[b].left.raw() + px[b];
+        by[b] = boxes[b].top.raw() + py[b];
+    }
+
+    // Obstacles go in blocks small enough to stay in L1 while every box is
+    // tested against them. The inner loops are branch-free integer math
+    // over plain arrays so the compiler can vectorize them.
+    const int32_t* cxs = batch.centerX.data();
+    const int32_t* cys = batch.centerY.data();
+    const int32_t* hws = batch.halfW.data();
+    const int32_t* hhs = batch.halfH.data();
+    const int32_t* cs = batch.cosA.data();
+    const int32_t* ss = batch.sinA.data();
+    int hitCount = 0;
+
+    for (size_t start = 0; start < count; start += BLOCK) {
+        size_t n = std::min(BLOCK, count - start);
+
+        // World-axis extents of the rotated boxes don't depend on the player
+        int64_t extentX[BLOCK], extentY[BLOCK];
+        for (size_t k = 0; k < n; k++) {
+            size_t i = start + k;
+            int64_t ac = absolute(cs[i]);
+            int64_t as = absolute(ss[i]);
+            extentX[k] = (ac * hws[i] + as * hhs[i]) >> SHIFT;
+            extentY[k] = (as * hws[i] + ac * hhs[i]) >> SHIFT;
+        }
+
+        uint8_t masks[BLOCK] = {};
+        for (int b = 0; b < boxCount; b++) {
+            for (size_t k = 0; k < n; k++) {
+                size_t i = start + k;
+                int64_t c = cs[i];
+                int64_t s = ss[i];
+                int64_t ac = absolute(c);
+                int64_t as = absolute(s);
+                int64_t dx = cxs[i] - bx[b];
+                int64_t dy = cys[i] - by[b];
+
+                bool separated = (absolute(dx) > px[b] + extentX[k]) |
+                                 (absolute(dy) > py[b] + extentY[k]) |
+                                 (absolute((dx * c + dy * s) >> SHIFT) > hws[i] + ((px[b] * ac + py[b] * as) >> SHIFT)) |
+                                 (absolute((dy * c - dx * s) >> SHIFT) > hhs[i] + ((px[b] * as + py[b] * ac) >> SHIFT));
+                masks[k] |= static_cast<uint8_t>(!separated << b);
+            }
+        }
+
+        for (size_t k = 0; k < n; k++) {
+            hits[start + k] = masks[k];
+            hitCount += std::popcount(static_cast<unsigned>(masks[k]));
+        }
+    }
+
+    return hitCount;
+}
+
+namespace {
+    const size_t SWEEP_BLOCK = 64;
+
+    // The SIMD paths work in 32-bit lanes (64-bit for products), which holds
+    // for everything within 4096 px of the origin with half sizes under
+    // 2048 px - far beyond the screen. A block with anything outside that
+    // takes the scalar path, so the hits never depend on the path taken.
+    const int64_t SIMD_POSITION_LIMIT = 1LL << 28;
+    const int64_t SIMD_SIZE_LIMIT = 1LL << 27;
+
+    bool simdPosition(int64_t v) { return v > -SIMD_POSITION_LIMIT && v < SIMD_POSITION_LIMIT; }
+    bool simdSize(int64_t v) { return v >= 0 && v < SIMD_SIZE_LIMIT; }
+    bool simdRotation(int64_t v) { return v >= -ONE && v <= ONE; }
+
+    // Player boxes of one sweep: half extents and centers at both ends of the tick
+    struct SweepPlayers {
+        int count;
+        int64_t px[Collision::MAX_BATCH_BOXES], py[Collision::MAX_BATCH_BOXES];
+        int64_t ax[Collision::MAX_BATCH_BOXES], ay[Collision::MAX_BATCH_BOXES];
+        int64_t bx[Collision::MAX_BATCH_BOXES], by[Collision::MAX_BATCH_BOXES];
+    };
+
+    // A pair that passed the broadphase, with the part of the tick in which
+    // it can touch and how many samples the walk over it takes
+    struct SweepPair {
+        uint32_t box;
+        int player;
+        int64_t enter;
+        int64_t span;
+        int64_t steps;
+    };
+
+    // Broadphase of one pair: the box's motion relative to the player against
+    // the summed extents (extents are conservative while the box turns)
+    bool sweepBroadphase(const OrientedBoxBatch& batch, size_t i, const SweepPlayers& p, int b,
+                         int64_t extentX, int64_t extentY, int64_t arc, SweepPair& pair) {
+        int64_t rx = batch.fromX[i] - p.ax[b];
+        int64_t ry = batch.fromY[i] - p.ay[b];
+        int64_t dx = batch.centerX[i] - p.bx[b] - rx;
+        int64_t dy = batch.centerY[i] - p.by[b] - ry;
+        int64_t enter = 0, exit = ONE;
+        if (!clipSlab(rx, dx, p.px[b] + extentX, enter, exit) ||
+            !clipSlab(ry, dy, p.py[b] + extentY, enter, exit)) {
+            return false;
+        }
+
+        // Sample often enough that nothing fits between two samples
+        int64_t span = exit - enter;
+        int64_t travel = ((absolute(dx) + absolute(dy) + arc) * span) >> SHIFT;
+        pair = SweepPair{static_cast<uint32_t>(i), b, enter, span,
+                         std::clamp<int64_t>(travel / SWEEP_STEP + 1, 1, MAX_SWEEP_STEPS)};
+        return true;
+    }
+
+    // Exact test of both boxes posed at time t. Rotation is lerped as
+    // cos/sin, which shrinks the box a hair mid-turn (0.02 px at 60 Hz).
+    bool sweepOverlaps(const OrientedBoxBatch& batch, const SweepPlayers& p, const SweepPair& pair, int64_t t) {
+        size_t i = pair.box;
+        int b = pair.player;
+        FixedVec2 player(Fixed::fromRaw(static_cast<int32_t>(lerp(p.ax[b], p.bx[b], t))),
+                         Fixed::fromRaw(static_cast<int32_t>(lerp(p.ay[b], p.by[b], t))));
+        FixedVec2 center(Fixed::fromRaw(static_cast<int32_t>(lerp(batch.fromX[i], batch.centerX[i], t))),
+                         Fixed::fromRaw(static_cast<int32_t>(lerp(batch.fromY[i], batch.centerY[i], t))));
+        return Collision::boxIntersectsOrientedBox(
+            FixedRect::around(player, Fixed::fromRaw(static_cast<int32_t>(p.px[b])),
+                              Fixed::fromRaw(static_cast<int32_t>(p.py[b]))),
+            center, FixedVec2(Fixed::fromRaw(batch.halfW[i]), Fixed::fromRaw(batch.halfH[i])),
+            Fixed::fromRaw(static_cast<int32_t>(lerp(batch.fromCos[i], batch.cosA[i], t))),
+            Fixed::fromRaw(static_cast<int32_t>(lerp(batch.fromSin[i], batch.sinA[i], t))));
+    }
+
+    // First contact of one pair: walk the broadphase interval, then bisect
+    // between the last miss and the first hit. The scalar reference for the
+    // SIMD narrowphase.
+    bool sweepNarrowphase(const OrientedBoxBatch& batch, const SweepPlayers& p, const SweepPair& pair, int64_t& time) {
+        int64_t miss = -1;
+        for (int64_t k = 0; k <= pair.steps; k++) {
+            int64_t t = pair.enter + pair.span * k / pair.steps;
+            if (!sweepOverlaps(batch, p, pair, t)) {
+                miss = t;
+                continue;
+            }
+            int64_t hit = t;
+            for (int r = 0; r < REFINE_STEPS && miss >= 0 && hit - miss > 1; r++) {
+                int64_t mid = (miss + hit) / 2;
+                if (sweepOverlaps(batch, p, pair, mid)) hit = mid; else miss = mid;
+            }
+            time = hit;
+            return true;
+        }
+        return false;
+    }
+
+    // Cheap necessary condition for clipSlab on one axis: the bounds of the
+    // relative motion against the summed extents, widened by the two raw time
+    // units clipSlab may round by. It never drops a pair clipSlab would keep.
+    bool slabCandidate(int64_t r0, int64_t r1, int64_t extent) {
+        int64_t reach = extent + (absolute(r1 - r0) >> 15) + 2;
+        return std::min(r0, r1) <= reach && std::max(r0, r1) >= -reach;
+    }
+
+    // Four pairs side by side for the SIMD narrowphase, every value widened
+    // to 64 bits: the products need 64-bit lanes and take their factors from
+    // the low halves
+    struct PairLanes {
+        static const int WIDTH = 4;
+
+        int64_t ax[WIDTH], ay[WIDTH], bx[WIDTH], by[WIDTH], px[WIDTH], py[WIDTH];
+        int64_t fromX[WIDTH], fromY[WIDTH], toX[WIDTH], toY[WIDTH], hw[WIDTH], hh[WIDTH];
+        int64_t c0[WIDTH], s0[WIDTH], c1[WIDTH], s1[WIDTH];
+        int64_t t[WIDTH];
+
+        void load(int lane, const OrientedBoxBatch& batch, const SweepPlayers& p, const SweepPair& pair) {
+            size_t i = pair.box;
+            int b = pair.player;
+            ax[lane] = p.ax[b];
+            ay[lane] = p.ay[b];
+            bx[lane] = p.bx[b];
+            by[lane] = p.by[b];
+            px[lane] = p.px[b];
+            py[lane] = p.py[b];
+            fromX[lane] = batch.fromX[i];
+            fromY[lane] = batch.fromY[i];
+            toX[lane] = batch.centerX[i];
+            toY[lane] = batch.centerY[i];
+            hw[lane] = batch.halfW[i];
+            hh[lane] = batch.halfH[i];
+            c0[lane] = batch.fromCos[i];
+            s0[lane] = batch.fromSin[i];
+            c1[lane] = batch.cosA[i];
+            s1[lane] = batch.sinA[i];
+        }
+    };
+
+#ifdef COLLISION_X86
+    // The same math as boxIntersectsOrientedBox, four pairs at once. There
+    // is no 64-bit arithmetic shift below AVX-512, so >> 16 is a logical
+    // shift with the sign bits put back; |x| > e is tested as e - x < 0 or
+    // e + x < 0, so only sign bits have to come out.
+    SIMD_TARGET("avx2") inline __m256i load256(const void* v) {
+        return _mm256_loadu_si256(static_cast<const __m256i*>(v));
+    }
+
+    SIMD_TARGET("avx2") inline __m256i shiftDown256(__m256i x) {
+        __m256i sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), x);
+        return _mm256_or_si256(_mm256_srli_epi64(x, SHIFT), _mm256_slli_epi64(sign, 64 - SHIFT));
+    }
+
+    SIMD_TARGET("avx2") inline __m256i lerp256(__m256i a, __m256i b, __m256i t) {
+        return _mm256_add_epi64(a, shiftDown256(_mm256_mul_epi32(_mm256_sub_epi64(b, a), t)));
+    }
+
+    SIMD_TARGET("avx2") inline __m256i outside256(__m256i x, __m256i e) {
+        return _mm256_or_si256(_mm256_sub_epi64(e, x), _mm256_add_epi64(e, x));
+    }
+
+    SIMD_TARGET("avx2") unsigned overlapsAvx2(const PairLanes& l) {
+        __m256i t = load256(l.t);
+        __m256i px = load256(l.px), py = load256(l.py), hw = load256(l.hw), hh = load256(l.hh);
+        __m256i dx = _mm256_sub_epi64(lerp256(load256(l.fromX), load256(l.toX), t), lerp256(load256(l.ax), load256(l.bx), t));
+        __m256i dy = _mm256_sub_epi64(lerp256(load256(l.fromY), load256(l.toY), t), lerp256(load256(l.ay), load256(l.by), t));
+        __m256i c = lerp256(load256(l.c0), load256(l.c1), t);
+        __m256i s = lerp256(load256(l.s0), load256(l.s1), t);
+        __m256i ac = _mm256_abs_epi32(c);   // Only ever a factor, so the low halves are enough
+        __m256i as = _mm256_abs_epi32(s);
+
+        __m256i extentX = _mm256_add_epi64(px, shiftDown256(_mm256_add_epi64(_mm256_mul_epi32(ac, hw), _mm256_mul_epi32(as, hh))));
+        __m256i extentY = _mm256_add_epi64(py, shiftDown256(_mm256_add_epi64(_mm256_mul_epi32(as, hw), _mm256_mul_epi32(ac, hh))));
+        __m256i u = shiftDown256(_mm256_add_epi64(_mm256_mul_epi32(dx, c), _mm256_mul_epi32(dy, s)));
+        __m256i v = shiftDown256(_mm256_sub_epi64(_mm256_mul_epi32(dy, c), _mm256_mul_epi32(dx, s)));
+        __m256i extentU = _mm256_add_epi64(hw, shiftDown256(_mm256_add_epi64(_mm256_mul_epi32(px, ac), _mm256_mul_epi32(py, as))));
+        __m256i extentV = _mm256_add_epi64(hh, shiftDown256(_mm256_add_epi64(_mm256_mul_epi32(px, as), _mm256_mul_epi32(py, ac))));
+
+        __m256i separated = _mm256_or_si256(_mm256_or_si256(outside256(dx, extentX), outside256(dy, extentY)),
+                                            _mm256_or_si256(outside256(u, extentU), outside256(v, extentV)));
+        return ~static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(separated))) & 0xF;
+    }
+
+    // SSE4.1 has the signed 32 x 32 -> 64 multiply but no 64-bit compare;
+    // the sign comes from the high halves instead. Two pairs per register.
+    SIMD_TARGET("sse4.1") inline __m128i load128(const void* v) {
+        return _mm_loadu_si128(static_cast<const __m128i*>(v));
+    }
+
+    SIMD_TARGET("sse4.1") inline __m128i shiftDown128(__m128i x) {
+        __m128i sign = _mm_shuffle_epi32(_mm_srai_epi32(x, 31), _MM_SHUFFLE(3, 3, 1, 1));
+        return _mm_or_si128(_mm_srli_epi64(x, SHIFT), _mm_slli_epi64(sign, 64 - SHIFT));
+    }
+
+    SIMD_TARGET("sse4.1") inline __m128i lerp128(__m128i a, __m128i b, __m128i t) {
+        return _mm_add_epi64(a, shiftDown128(_mm_mul_epi32(_mm_sub_epi64(b, a), t)));
+    }
+
+    SIMD_TARGET("sse4.1") inline __m128i outside128(__m128i x, __m128i e) {
+        return _mm_or_si128(_mm_sub_epi64(e, x), _mm_add_epi64(e, x));
+    }
+
+    SIMD_TARGET("sse4.1") unsigned overlapsSse41(const PairLanes& l) {
+        unsigned overlapping = 0;
+        for (int h = 0; h < PairLanes::WIDTH; h += 2) {
+            __m128i t = load128(l.t + h);
+            __m128i px = load128(l.px + h), py = load128(l.py + h), hw = load128(l.hw + h), hh = load128(l.hh + h);
+            __m128i dx = _mm_sub_epi64(lerp128(load128(l.fromX + h), load128(l.toX + h), t),
+                                       lerp128(load128(l.ax + h), load128(l.bx + h), t));
+            __m128i dy = _mm_sub_epi64(lerp128(load128(l.fromY + h), load128(l.toY + h), t),
+                                       lerp128(load128(l.ay + h), load128(l.by + h), t));
+            __m128i c = lerp128(load128(l.c0 + h), load128(l.c1 + h), t);
+            __m128i s = lerp128(load128(l.s0 + h), load128(l.s1 + h), t);
+            __m128i ac = _mm_abs_epi32(c);
+            __m128i as = _mm_abs_epi32(s);
+
+            __m128i extentX = _mm_add_epi64(px, shiftDown128(_mm_add_epi64(_mm_mul_epi32(ac, hw), _mm_mul_epi32(as, hh))));
+            __m128i extentY = _mm_add_epi64(py, shiftDown128(_mm_add_epi64(_mm_mul_epi32(as, hw), _mm_mul_epi32(ac, hh))));
+            __m128i u = shiftDown128(_mm_add_epi64(_mm_mul_epi32(dx, c), _mm_mul_epi32(dy, s)));
+            __m128i v = shiftDown128(_mm_sub_epi64(_mm_mul_epi32(dy, c), _mm_mul_epi32(dx, s)));
+            __m128i extentU = _mm_add_epi64(hw, shiftDown128(_mm_add_epi64(_mm_mul_epi32(px, ac), _mm_mul_epi32(py, as))));
+            __m128i extentV = _mm_add_epi64(hh, shiftDown128(_mm_add_epi64(_mm_mul_epi32(px, as), _mm_mul_epi32(py, ac))));
+
+            __m128i separated = _mm_or_si128(_mm_or_si128(outside128(dx, extentX), outside128(dy, extentY)),
+                                             _mm_or_si128(outside128(u, extentU), outside128(v, extentV)));
+            overlapping |= (~static_cast<unsigned>(_mm_movemask_pd(_mm_castsi128_pd(separated))) & 3) << h;
+        }
+        return overlapping;
+    }
+
+    // slabCandidate in 32-bit lanes: all ones where the pair can't touch.
+    // extent already has the + 2.
+    SIMD_TARGET("avx2") inline __m256i slabMissing256(__m256i r0, __m256i r1, __m256i extent) {
+        __m256i reach = _mm256_add_epi32(extent, _mm256_srli_epi32(_mm256_abs_epi32(_mm256_sub_epi32(r1, r0)), 15));
+        return _mm256_or_si256(_mm256_cmpgt_epi32(_mm256_min_epi32(r0, r1), reach),
+                               _mm256_cmpgt_epi32(_mm256_sub_epi32(_mm256_setzero_si256(), reach), _mm256_max_epi32(r0, r1)));
+    }
+
+    SIMD_TARGET("sse4.1") inline __m128i slabMissing128(__m128i r0, __m128i r1, __m128i extent) {
+        __m128i reach = _mm_add_epi32(extent, _mm_srli_epi32(_mm_abs_epi32(_mm_sub_epi32(r1, r0)), 15));
+        return _mm_or_si128(_mm_cmpgt_epi32(_mm_min_epi32(r0, r1), reach),
+                            _mm_cmpgt_epi32(_mm_sub_epi32(_mm_setzero_si128(), reach), _mm_max_epi32(r0, r1)));
+    }
+
+    // slabCandidate for a whole block of boxes against one player, 8 boxes
+    // per instruction in 32-bit lanes. Bit k is set if box k may touch.
+    SIMD_TARGET("avx2") uint64_t candidatesAvx2(const OrientedBoxBatch& batch, size_t start, size_t n,
+                                                const int32_t* extentX, const int32_t* extentY,
+                                                const SweepPlayers& p, int b) {
+        const __m256i ax = _mm256_set1_epi32(static_cast<int32_t>(p.ax[b]));
+        const __m256i ay = _mm256_set1_epi32(static_cast<int32_t>(p.ay[b]));
+        const __m256i bx = _mm256_set1_epi32(static_cast<int32_t>(p.bx[b]));
+        const __m256i by = _mm256_set1_epi32(static_cast<int32_t>(p.by[b]));
+        const __m256i px = _mm256_set1_epi32(static_cast<int32_t>(p.px[b] + 2));
+        const __m256i py = _mm256_set1_epi32(static_cast<int32_t>(p.py[b] + 2));
+
+        uint64_t candidates = 0;
+        size_t k = 0;
+        for (; k + 8 <= n; k += 8) {
+            size_t i = start + k;
+            __m256i missX = slabMissing256(_mm256_sub_epi32(load256(&batch.fromX[i]), ax),
+                                           _mm256_sub_epi32(load256(&batch.centerX[i]), bx),
+                                           _mm256_add_epi32(load256(extentX + k), px));
+            __m256i missY = slabMissing256(_mm256_sub_epi32(load256(&batch.fromY[i]), ay),
+                                           _mm256_sub_epi32(load256(&batch.centerY[i]), by),
+                                           _mm256_add_epi32(load256(extentY + k), py));
+            unsigned missed = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_or_si256(missX, missY))));
+            candidates |= static_cast<uint64_t>(~missed & 0xFF) << k;
+        }
+        for (; k < n; k++) {
+            size_t i = start + k;
+            if (slabCandidate(batch.fromX[i] - p.ax[b], batch.centerX[i] - p.bx[b], p.px[b] + extentX[k]) &&
+                slabCandidate(batch.fromY[i] - p.ay[b], batch.centerY[i] - p.by[b], p.py[b] + extentY[k])) {
+                candidates |= uint64_t(1) << k;
+            }
+        }
+        return candidates;
+    }
+
+    SIMD_TARGET("sse4.1") uint64_t candidatesSse41(const OrientedBoxBatch& batch, size_t start, size_t n,
+                                                   const int32_t* extentX, const int32_t* extentY,
+                                                   const SweepPlayers& p, int b) {
+        const __m128i ax = _mm_set1_epi32(static_cast<int32_t>(p.ax[b]));
+        const __m128i ay = _mm_set1_epi32(static_cast<int32_t>(p.ay[b]));
+        const __m128i bx = _mm_set1_epi32(static_cast<int32_t>(p.bx[b]));
+        const __m128i by = _mm_set1_epi32(static_cast<int32_t>(p.by[b]));
+        const __m128i px = _mm_set1_epi32(static_cast<int32_t>(p.px[b] + 2));
+        const __m128i py = _mm_set1_epi32(static_cast<int32_t>(p.py[b] + 2));
+
+        uint64_t candidates = 0;
+        size_t k = 0;
+        for (; k + 4 <= n; k += 4) {
+            size_t i = start + k;
+            __m128i missX = slabMissing128(_mm_sub_epi32(load128(&batch.fromX[i]), ax),
+                                           _mm_sub_epi32(load128(&batch.centerX[i]), bx),
+                                           _mm_add_epi32(load128(extentX + k), px));
+            __m128i missY = slabMissing128(_mm_sub_epi32(load128(&batch.fromY[i]), ay),
+                                           _mm_sub_epi32(load128(&batch.centerY[i]), by),
+                                           _mm_add_epi32(load128(extentY + k), py));
+            unsigned missed = static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(_mm_or_si128(missX, missY))));
+            candidates |= static_cast<uint64_t>(~missed & 0xF) << k;
+        }
+        for (; k < n; k++) {
+            size_t i = start + k;
+            if (slabCandidate(batch.fromX[i] - p.ax[b], batch.centerX[i] - p.bx[b], p.px[b] + extentX[k]) &&
+                slabCandidate(batch.fromY[i] - p.ay[b], batch.centerY[i] - p.by[b], p.py[b] + extentY[k])) {
+                candidates |= uint64_t(1) << k;
+            }
+        }
+        return candidates;
+    }
+#endif
+
+    // Narrowphase of many pairs, PairLanes::WIDTH at a time. Every lane runs
+    // the walk and bisection of sweepNarrowphase on its own pair, at its own
+    // times, and takes the next waiting pair when it is done.
+    void narrowphaseLanes(const OrientedBoxBatch& batch, const SweepPlayers& p, const SweepPair* pairs, int count,
+                          CollisionSimd simd, std::vector<SweepHit>& hits) {
+#ifdef COLLISION_X86
+        struct LaneState {
+            int pair;               // -1 = idle
+            int64_t k;
+            int64_t miss;
+            int64_t hit;
+            int refine;
+            bool bisecting;
+        };
+        PairLanes lanes = {};
+        LaneState state[PairLanes::WIDTH];
+        int next = 0;
+        int busy = 0;
+
+        auto take = [&](int lane) {
+            state[lane].pair = -1;
+            if (next == count) return;
+            state[lane] = LaneState{next, 0, -1, 0, 0, false};
+            lanes.load(lane, batch, p, pairs[next]);
+            next++;
+            busy++;
+        };
+        auto finish = [&](int lane, bool found) {
+            if (found) {
+                const SweepPair& pair = pairs[state[lane].pair];
+                hits.push_back({Fixed::fromRaw(static_cast<int32_t>(state[lane].hit)), pair.box, pair.player});
+            }
+            busy--;
+            take(lane);
+        };
+        for (int lane = 0; lane < PairLanes::WIDTH; lane++) take(lane);
+
+        while (busy > 0) {
+            for (int lane = 0; lane < PairLanes::WIDTH; lane++) {
+                const LaneState& s = state[lane];
+                if (s.pair < 0) continue;
+                const SweepPair& pair = pairs[s.pair];
+                lanes.t[lane] = s.bisecting ? (s.miss + s.hit) / 2 : pair.enter + pair.span * s.k / pair.steps;
+            }
+            unsigned overlapping = simd == CollisionSimd::AVX2 ? overlapsAvx2(lanes) : overlapsSse41(lanes);
+
+            for (int lane = 0; lane < PairLanes::WIDTH; lane++) {
+                LaneState& s = state[lane];
+                if (s.pair < 0) continue;
+                int64_t t = lanes.t[lane];
+                bool overlaps = ((overlapping >> lane) & 1) != 0;
+                if (s.bisecting) {
+                    if (overlaps) s.hit = t; else s.miss = t;
+                    s.refine++;
+                } else if (!overlaps) {
+                    s.miss = t;
+                    if (++s.k > pairs[s.pair].steps) finish(lane, false);
+                    continue;
+                } else {
+                    s.hit = t;
+                    s.bisecting = true;
+                }
+                if (!(s.refine < REFINE_STEPS && s.miss >= 0 && s.hit - s.miss > 1)) finish(lane, true);
+            }
+        }
+#else
+        (void)simd;
+        for (int j = 0; j < count; j++) {
+            int64_t time;
+            if (sweepNarrowphase(batch, p, pairs[j], time)) {
+                hits.push_back({Fixed::fromRaw(static_cast<int32_t>(time)), pairs[j].box, pairs[j].player});
+            }
+        }
+#endif
+    }
+
+    CollisionSimd detectSimd() {
+#if defined(COLLISION_X86) && defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 0);
+        int maxLeaf = info[0];
+        __cpuid(info, 1);
+        bool sse41 = (info[2] >> 19) & 1;
+        bool osAvx = ((info[2] >> 27) & 1) && ((info[2] >> 28) & 1) && (_xgetbv(0) & 6) == 6;
+        bool avx2 = false;
+        if (maxLeaf >= 7 && osAvx) {
+            __cpuidex(info, 7, 0);
+            avx2 = (info[1] >> 5) & 1;
+        }
+#elif defined(COLLISION_X86)
+        __builtin_cpu_init();
+        bool sse41 = __builtin_cpu_supports("sse4.1");
+        bool avx2 = __builtin_cpu_supports("avx2");
+#else
+        bool sse41 = false;
+        bool avx2 = false;
+#endif
+        return avx2 ? CollisionSimd::AVX2 : sse41 ? CollisionSimd::SSE41 : CollisionSimd::SCALAR;
+    }
+
+    const CollisionSimd bestSimd = detectSimd();
+    CollisionSimd activeSimd = bestSimd;
+}
+
+CollisionSimd Collision::getSimd() {
+    return activeSimd;
+}
+
+CollisionSimd Collision::getBestSimd() {
+    return bestSimd;
+}
+
+void Collision::setSimd(CollisionSimd simd) {
+    activeSimd = std::min(simd, bestSimd);
+}
+
+const char* Collision::getSimdName(CollisionSimd simd) {
+    switch (simd) {
+        case CollisionSimd::SCALAR: return "scalar";
+        case CollisionSimd::SSE41:  return "sse4.1";
+        case CollisionSimd::AVX2:   return "avx2";
+        default:                    return "?";
+    }
+}
+
+int Collision::sweepBatch(const FixedRect* starts, const FixedRect* ends, int boxCount,
+                          const OrientedBoxBatch& batch, std::vector<SweepHit>& hits) {
+    return sweepBatch(starts, ends, boxCount, batch, hits, activeSimd);
+}
+
+int Collision::sweepBatch(const FixedRect* starts, const FixedRect* ends, int boxCount,
+                          const OrientedBoxBatch& batch, std::vector<SweepHit>& hits, CollisionSimd simd) {
+    hits.clear();
+    if (boxCount > MAX_BATCH_BOXES) boxCount = MAX_BATCH_BOXES;
+    if (simd > bestSimd) simd = bestSimd;
+
+    SweepPlayers p;
+    p.count = boxCount;
+    bool playersFit = true;
+    for (int b = 0; b < boxCount; b++) {
+        p.px[b] = ends[b].width.raw() >> 1;
+        p.py[b] = ends[b].height.raw() >> 1;
+        p.ax[b] = starts[b].left.raw() + (starts[b].width.raw() >> 1);
+        p.ay[b] = starts[b].top.raw() + (starts[b].height.raw() >> 1);
+        p.bx[b] = ends[b].left.raw() + p.px[b];
+        p.by[b] = ends[b].top.raw() + p.py[b];
+        playersFit = playersFit && simdSize(p.px[b]) && simdSize(p.py[b]) && simdPosition(p.ax[b]) &&
+                     simdPosition(p.ay[b]) && simdPosition(p.bx[b]) && simdPosition(p.by[b]);
+    }
+    if (!playersFit) simd = CollisionSimd::SCALAR;
+
+    // Boxes go in blocks: extents first, then every player's broadphase over
+    // the block, then the narrowphase of every pair that got through
+    SweepPair pairs[SWEEP_BLOCK * MAX_BATCH_BOXES];
+    for (size_t start = 0; start < batch.size(); start += SWEEP_BLOCK) {
+        size_t n = std::min(SWEEP_BLOCK, batch.size() - start);
+
+        int32_t extentX[SWEEP_BLOCK], extentY[SWEEP_BLOCK];
+        int64_t arc[SWEEP_BLOCK];
+        bool blockFits = simd != CollisionSimd::SCALAR;
+        for (size_t k = 0; k < n; k++) {
+            size_t i = start + k;
+            int64_t hw = batch.halfW[i];
+            int64_t hh = batch.halfH[i];
+            int64_t c0 = batch.fromCos[i], s0 = batch.fromSin[i];
+            int64_t c1 = batch.cosA[i], s1 = batch.sinA[i];
+            bool turning = c0 != c1 || s0 != s1;
+
+            // World-axis extents; a turning box can reach anything up to hw + hh
+            int64_t reachX = hw + hh;
+            int64_t reachY = hw + hh;
+            if (!turning) {
+                reachX = (absolute(c1) * hw + absolute(s1) * hh) >> SHIFT;
+                reachY = (absolute(s1) * hw + absolute(c1) * hh) >> SHIFT;
+            }
+            extentX[k] = static_cast<int32_t>(reachX);
+            extentY[k] = static_cast<int32_t>(reachY);
+            // How far the corners swing over the whole tick
+            arc[k] = turning ? ((hw + hh) * (absolute(c1 - c0) + absolute(s1 - s0))) >> SHIFT : 0;
+
+            blockFits = blockFits && simdSize(hw) && simdSize(hh) && simdPosition(batch.centerX[i]) &&
+                        simdPosition(batch.centerY[i]) && simdPosition(batch.fromX[i]) && simdPosition(batch.fromY[i]) &&
+                        simdRotation(c0) && simdRotation(s0) && simdRotation(c1) && simdRotation(s1);
+        }
+
+        int pairCount = 0;
+        for (int b = 0; b < boxCount; b++) {
+            uint64_t candidates = n == 64 ? ~uint64_t(0) : (uint64_t(1) << n) - 1;
+#ifdef COLLISION_X86
+            if (blockFits && simd == CollisionSimd::AVX2) {
+                candidates = candidatesAvx2(batch, start, n, extentX, extentY, p, b);
+            } else if (blockFits) {
+                candidates = candidatesSse41(batch, start, n, extentX, extentY, p, b);
+            }
+#endif
+            while (candidates) {
+                size_t k = static_cast<size_t>(std::countr_zero(candidates));
+                candidates &= candidates - 1;
+                // The exact slab test overflows 32 bits, so it stays scalar
+                if (sweepBroadphase(batch, start + k, p, b, extentX[k], extentY[k], arc[k], pairs[pairCount])) {
+                    pairCount++;
+                }
+            }
+        }
+
+        if (blockFits) {
+            narrowphaseLanes(batch, p, pairs, pairCount, simd, hits);
+            continue;
+        }
+        for (int j = 0; j < pairCount; j++) {
+            int64_t time;
+            if (sweepNarrowphase(batch, p, pairs[j], time)) {
+                hits.push_back({Fixed::fromRaw(static_cast<int32_t>(time)), pairs[j].box, pairs[j].player});
+            }
+        }
+    }
+
+    std::sort(hits.begin(), hits.end(), [](const SweepHit& a, const SweepHit& b) {
+        if (a.time != b.time) return a.time < b.time;
+        if (a.box != b.box) return a.box < b.box;
+        return a.player < b.player;
+    });
+    return static_cast<int>(hits.size());
+}
+bool Collision::sweepBoxes(const FixedRect& fromA, const FixedRect& toA, const FixedRect& fromB, const FixedRect& toB,
+                           Fixed& time) {
+    // B's center relative to A's, against the summed half sizes
+    int64_t rx = (fromB.left.raw() * 2 + fromB.width.raw()) - (fromA.left.raw() * 2 + fromA.width.raw());
+    int64_t ry = (fromB.top.raw() * 2 + fromB.height.raw()) - (fromA.top.raw() * 2 + fromA.height.raw());
+    int64_t dx = (toB.left.raw() * 2 + toB.width.raw()) - (toA.left.raw() * 2 + toA.width.raw()) - rx;
+    int64_t dy = (toB.top.raw() * 2 + toB.height.raw()) - (toA.top.raw() * 2 + toA.height.raw()) - ry;
+    int64_t enter = 0, exit = ONE;
+    // Everything doubled so the centers stay exact
+    if (!clipSlab(rx, dx, static_cast<int64_t>(toA.width.raw()) + toB.width.raw(), enter, exit) ||
+        !clipSlab(ry, dy, static_cast<int64_t>(toA.height.raw()) + toB.height.raw(), enter, exit)) {
+        return false;
+    }
+    time = Fixed::fromRaw(static_cast<int32_t>(enter));
+    return true;
+}
+
+bool Collision::crossing(Fixed before, Fixed after, Fixed& time) {
+    if (before < Fixed() || after >= Fixed()) return false;
+    time = before / (before - after);
+    return true;
+}
+
+namespace {
+    // Project a polygon onto an axis and return the [min, max] interval
+    void project(const sf::Vector2f* points, int count, sf::Vector2f axis, float& outMin, float& outMax) {
+        outMin = outMax = points[0].x * axis.x + points[0].y * axis.y;
+        for (int i = 1; i < count; i++) {
+            float d = points[i].x * axis.x + points[i].y * axis.y;
+            if (d < outMin) outMin = d;
+            if (d > outMax) outMax = d;
+        }
+    }
+
+    bool separatedOnEdges(const sf::Vector2f* a, const sf::Vector2f* b) {
+        for (int i = 0; i < 4; i++) {
+            sf::Vector2f edge = a[(i + 1) % 4] - a[i];
+            sf::Vector2f axis(-edge.y, edge.x);
+            float minA, maxA, minB, maxB;
+            project(a, 4, axis, minA, maxA);
+            project(b, 4, axis, minB, maxB);
+            if (maxA < minB || maxB < minA) return true;
+        }
+        return false;
+    }
+}
+
+bool Collision::referenceIntersects(const sf::FloatRect& box, const sf::Transform& transform, const sf::FloatRect& localRect) {
+    sf::Vector2f boxCorners[4] = {
+        sf::Vector2f(box.left, box.top),
+        sf::Vector2f(box.left + box.width, box.top),
+        sf::Vector2f(box.left + box.width, box.top + box.height),
+        sf::Vector2f(box.left, box.top + box.height)
+    };
+    sf::Vector2f shapeCorners[4] = {
+        transform.transformPoint(localRect.left, localRect.top),
+        transform.transformPoint(localRect.left + localRect.width, localRect.top),
+        transform.transformPoint(localRect.left + localRect.width, localRect.top + localRect.height),
+        transform.transformPoint(localRect.left, localRect.top + localRect.height)
+    };
+    return !separatedOnEdges(boxCorners, shapeCorners) && !separatedOnEdges(shapeCorners, boxCorners);
+}
@@ -1,29 +1,48 @@
 #include "ColorWallObstacle.h"
 
-ColorWallObstacle::ColorWallObstacle(sf::Vector2f startPos, sf::Color col, float speed)
+bool ColorWallObstacle::glowEnabled = true;
+
+ColorWallObstacle::ColorWallObstacle(FixedVec2 startPos, sf::Color col, Fixed speed)
     : Obstacle(startPos, col, speed) {  // Call parent constructor
 
-    requiredColor = col;
     isTall = true;
     shape.setSize(sf::Vector2f(OBSTACLE_WIDTH * 3, WINDOW_HEIGHT * 0.8f));
     shape.setOrigin(OBSTACLE_WIDTH * 1.5f, WINDOW_HEIGHT * 0.4f);
-    shape.setFillColor(requiredColor);
 
 
     shape.setOutlineThickness(5.0f);
     shape.setOutlineColor(sf::Color::White);
-    rotationSpeed = 0.0f;
+    rotationSpeed = Fixed();
+    halfSize = FixedVec2(Fixed::fromFloat(OBSTACLE_WIDTH * 1.5f + 5.0f), Fixed::fromFloat(WINDOW_HEIGHT * 0.4f + 5.0f));
+
+    glow.setSize(shape.getSize());
+    glow.setOrigin(OBSTACLE_WIDTH * 1.5f, WINDOW_HEIGHT * 0.4f);
+    glow.setOutlineThickness(10.0f);
+
+    ColorWallObstacle::reset(startPos, col, speed);
 }
 
-void ColorWallObstacle::draw(sf::RenderWindow& window) {
-    if (!active()) return;
+void ColorWallObstacle::reset(FixedVec2 startPos, sf::Color col, Fixed speed) {
+    Obstacle::reset(startPos, col, speed);
 
-    sf::RectangleShape glow = shape;
+    requiredColor = col;
     glow.setFillColor(sf::Color(requiredColor.r, requiredColor.g, requiredColor.b, 100));
-    glow.setOutlineThickness(10.0f);
     glow.setOutlineColor(sf::Color(requiredColor.r, requiredColor.g, requiredColor.b, 50));
-    window.draw(glow);
+    glow.setPosition(position.toVector2f());
+}
+
+void ColorWallObstacle::update(Fixed dt) {
+    Obstacle::update(dt);
+    glow.setPosition(position.toVector2f());
+}
+
+void ColorWallObstacle::draw(sf::RenderTarget& target) {
+    if (!active()) return;
+
+    if (glowEnabled) {
+        target.draw(glow);
+    }
 
     // Draw the main wall
-    window.draw(shape);
+    target.draw(shape);
 }
@@ -0,0 +1,56 @@
+#include "CoroutineTask.h"
+#include <new>
+
+namespace {
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    thread_local FreeBlock* freeBlocks = nullptr;
+    thread_local std::size_t blocksInUse = 0;
+    thread_local std::size_t blocksTotal = 0;
+
+    // Chunks are never returned - the pool only grows to the busiest moment
+    void addChunk() {
+        char* chunk = static_cast<char*>(::operator new(CoroutineFramePool::BLOCK_SIZE *
+                                                        CoroutineFramePool::BLOCKS_PER_CHUNK));
+        for (std::size_t i = 0; i < CoroutineFramePool::BLOCKS_PER_CHUNK; i++) {
+            FreeBlock* block = reinterpret_cast<FreeBlock*>(chunk + i * CoroutineFramePool::BLOCK_SIZE);
+            block->next = freeBlocks;
+            freeBlocks = block;
+        }
+        blocksTotal += CoroutineFramePool::BLOCKS_PER_CHUNK;
+    }
+}
+
+void* CoroutineFramePool::allocate(std::size_t size) {
+    if (size > BLOCK_SIZE) {
+        return ::operator new(size);
+    }
+    if (!freeBlocks) {
+        addChunk();
+    }
+    FreeBlock* block = freeBlocks;
+    freeBlocks = block->next;
+    blocksInUse++;
+    return block;
+}
+
+void CoroutineFramePool::deallocate(void* frame, std::size_t size) {
+    if (size > BLOCK_SIZE) {
+        ::operator delete(frame);
+        return;
+    }
+    FreeBlock* block = static_cast<FreeBlock*>(frame);
+    block->next = freeBlocks;
+    freeBlocks = block;
+    blocksInUse--;
+}
+
+std::size_t CoroutineFramePool::getInUse() {
+    return blocksInUse;
+}
+
+std::size_t CoroutineFramePool::getCapacity() {
+    return blocksTotal;
+}
@@ -0,0 +1,63 @@
+#include "Difficulty.h"
+#include <cstdlib>
+#include <iostream>
+
+bool DifficultySettings::parse(const std::string& text) {
+    size_t start = 0;
+    while (start < text.size()) {
+        size_t end = text.find(',', start);
+        if (end == std::string::npos) end = text.size();
+        std::string item = text.substr(start, end - start);
+        start = end + 1;
+        if (item.empty()) continue;
+
+        size_t equals = item.find('=');
+        char* numberEnd = nullptr;
+        float value = equals == std::string::npos ? 0 : std::strtof(item.c_str() + equals + 1, &numberEnd);
+        if (equals == std::string::npos || numberEnd == item.c_str() + equals + 1 || *numberEnd != '\0' || value <= 0) {
+            std::cerr << "Bad difficulty setting '" << item << "' (expected name=positive number)" << std::endl;
+            return false;
+        }
+
+        std::string name = item.substr(0, equals);
+        if (name == "spawn") obstacleSpawnTime = value;
+        else if (name == "rate") spawnTimeRate = value;
+        else if (name == "speed_rate") speedRate = value;
+        else if (name == "wall") colorWallSpawnTime = value;
+        else if (name == "max_speed") maxObstacleSpeed = value;
+        else if (name == "min_spawn") minSpawnTime = value;
+        else {
+            std::cerr << "Unknown difficulty setting '" << name
+                      << "' (spawn, rate, speed_rate, wall, max_speed, min_spawn)" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+DifficultyRamp::DifficultyRamp() {
+    reset(DifficultySettings());
+}
+
+void DifficultyRamp::reset(const DifficultySettings& settings) {
+    speed = Fixed::fromFloat(OBSTACLE_SPEED);
+    spawnTime = Fixed::fromFloat(settings.obstacleSpawnTime);
+    speedRate = Fixed::fromFloat(settings.speedRate);
+    spawnTimeRate = Fixed::fromFloat(settings.spawnTimeRate);
+    maxSpeed = Fixed::fromFloat(settings.maxObstacleSpeed);
+    minSpawnTime = Fixed::fromFloat(settings.minSpawnTime);
+    lastStepScore = 0;
+}
+
+bool DifficultyRamp::update(int score) {
+    // Only once per step, however many points came in at once
+    if (score <= 0 || score < lastStepScore + DIFFICULTY_STEP_SCORE) return false;
+
+    spawnTime *= spawnTimeRate;
+    speed *= speedRate;
+    if (spawnTime < minSpawnTime) spawnTime = minSpawnTime;
+    if (speed > maxSpeed) speed = maxSpeed;
+
+    lastStepScore = score;
+    return true;
+}
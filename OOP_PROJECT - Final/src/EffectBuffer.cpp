@@ -0,0 +1,82 @@
+#include "EffectBuffer.h"
+#include <algorithm>
+
+namespace {
+    const float MERGE_CELL = 48.0f;     // Emits closer than this may merge
+    const int MAX_MERGED_COUNT = 60;    // Don't let a merge turn into a firework
+
+    // Sort key: type, then what it looks/sounds like, then where it is
+    uint64_t sortKey(const EffectCommand& c) {
+        uint32_t cellX = static_cast<uint32_t>(static_cast<int>(c.x / MERGE_CELL) + 512) & 0x3FF;
+        uint32_t cellY = static_cast<uint32_t>(static_cast<int>(c.y / MERGE_CELL) + 512) & 0x3FF;
+        uint64_t key = static_cast<uint64_t>(c.type) << 56;
+        key |= static_cast<uint64_t>(c.id) << 48;
+        if (c.type == EffectType::PARTICLES) {
+            key |= static_cast<uint64_t>(c.direction >> 4) << 44;   // Within 1/16 turn
+            key |= static_cast<uint64_t>(c.color >> 8) << 20;       // RGB only
+            key |= static_cast<uint64_t>(cellY) << 10 | cellX;
+        }
+        return key;
+    }
+}
+
+EffectBuffer::EffectBuffer() {
+    commands.reserve(CAPACITY);
+    merged = 0;
+    recorded = 0;
+    enabled = true;
+}
+
+void EffectBuffer::push(const EffectCommand& command) {
+    // Full: effects are cosmetic, so just drop it
+    if (commands.size() < commands.capacity()) {
+        commands.push_back(command);
+    }
+}
+
+void EffectBuffer::coalesce() {
+    recorded = commands.size();
+    if (commands.size() > 1) {
+        std::sort(commands.begin(), commands.end(), [](const EffectCommand& a, const EffectCommand& b) {
+            return sortKey(a) < sortKey(b);
+        });
+
+        // Group by the key the first command of a group had; merging moves
+        // last.x/y, so recomputing its key would drift into the next cell
+        size_t out = 0;
+        uint64_t lastKey = sortKey(commands[0]);
+        for (size_t i = 1; i < commands.size(); i++) {
+            EffectCommand& last = commands[out];
+            const EffectCommand& next = commands[i];
+            uint64_t nextKey = sortKey(next);
+            if (nextKey != lastKey) {
+                commands[++out] = next;
+                lastKey = nextKey;
+                continue;
+            }
+
+            switch (next.type) {
+                case EffectType::SHAKE:
+                    if (next.x > last.x) last.x = next.x;
+                    break;
+                case EffectType::PARTICLES: {
+                    // Weighted centre, summed count
+                    float total = static_cast<float>(last.count + next.count);
+                    if (total > 0) {
+                        last.x = (last.x * last.count + next.x * next.count) / total;
+                        last.y = (last.y * last.count + next.y * next.count) / total;
+                    }
+                    int count = last.count + next.count;
+                    int limit = last.count > MAX_MERGED_COUNT ? last.count : MAX_MERGED_COUNT;
+                    if (next.count > limit) limit = next.count;
+                    last.count = static_cast<uint8_t>(count < limit ? count : limit);
+                    break;
+                }
+                default:
+                    break;  // Same sound twice - once is enough
+            }
+        }
+        commands.resize(out + 1);
+    }
+    merged = commands.size();
+}
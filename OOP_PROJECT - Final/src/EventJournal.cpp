@@ -0,0 +1,172 @@
+#include "EventJournal.h"
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <filesystem>
+
+namespace {
+    const char JOURNAL_MAGIC[4] = {'E', 'V', 'J', '1'};
+    const uint32_t FOOTER_MARKER = 0xFFFFFFFF;
+
+    int16_t packCoord(float v) {
+        if (v > 32767.0f) return 32767;
+        if (v < -32768.0f) return -32768;
+        return static_cast<int16_t>(v);
+    }
+
+    // Write one block of events column by column
+    void writeBlock(std::FILE* file, const std::vector<GameEvent>& events) {
+        uint32_t count = static_cast<uint32_t>(events.size());
+        std::fwrite(&count, sizeof(count), 1, file);
+        for (const auto& e : events) std::fwrite(&e.time, sizeof(float), 1, file);
+        for (const auto& e : events) std::fwrite(&e.type, sizeof(uint8_t), 1, file);
+        for (const auto& e : events) { int16_t x = packCoord(e.x); std::fwrite(&x, sizeof(x), 1, file); }
+        for (const auto& e : events) { int16_t y = packCoord(e.y); std::fwrite(&y, sizeof(y), 1, file); }
+        for (const auto& e : events) std::fwrite(&e.value, sizeof(int32_t), 1, file);
+    }
+}
+
+EventJournal::EventJournal() : ring(8192), running(false), dropped(0) {
+    block.reserve(BLOCK_SIZE);
+}
+
+EventJournal::~EventJournal() {
+    stop();
+}
+
+bool EventJournal::start(const std::string& directory) {
+    if (running) return true;
+
+    std::error_code ec;
+    std::filesystem::create_directories(directory, ec);
+
+    // One file per session, named after the start time. Sessions started in
+    // the same second get a numbered suffix; "x" never opens an existing file.
+    char stamp[32];
+    std::time_t now = std::time(nullptr);
+    std::strftime(stamp, sizeof(stamp), "run_%Y%m%d_%H%M%S", std::localtime(&now));
+
+    std::FILE* probe = nullptr;
+    for (int attempt = 1; !probe && attempt <= MAX_NAME_ATTEMPTS; attempt++) {
+        std::string name = stamp;
+        if (attempt > 1) name += "_" + std::to_string(attempt);
+        filePath = (std::filesystem::path(directory) / (name + ".evj")).string();
+        probe = std::fopen(filePath.c_str(), "wbx");
+        if (!probe && !std::filesystem::exists(filePath, ec)) break;
+    }
+    if (!probe) return false;
+    std::fwrite(JOURNAL_MAGIC, 1, sizeof(JOURNAL_MAGIC), probe);
+    uint32_t version = FILE_VERSION;
+    std::fwrite(&version, sizeof(version), 1, probe);
+    std::fclose(probe);
+
+    dropped = 0;
+    running = true;
+    writer = std::thread(&EventJournal::writerLoop, this);
+    return true;
+}
+
+void EventJournal::stop() {
+    if (!running) return;
+    running = false;
+    if (writer.joinable()) {
+        writer.join();
+    }
+}
+
+void EventJournal::writerLoop() {
+    std::FILE* file = std::fopen(filePath.c_str(), "ab");
+    if (!file) return;
+
+    GameEvent e;
+    auto lastFlush = std::chrono::steady_clock::now();
+
+    // Keep draining until stop() is called AND the ring is empty
+    while (running.load(std::memory_order_relaxed) || ring.size() > 0) {
+        bool gotAny = false;
+        while (block.size() < BLOCK_SIZE && ring.tryPop(e)) {
+            block.push_back(e);
+            gotAny = true;
+        }
+
+        // Write full blocks right away, partial ones at most twice a second
+        auto now = std::chrono::steady_clock::now();
+        if (block.size() >= BLOCK_SIZE ||
+            (!block.empty() && now - lastFlush > std::chrono::milliseconds(500))) {
+            writeBlock(file, block);
+            std::fflush(file);
+            block.clear();
+            lastFlush = now;
+        }
+
+        if (!gotAny) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+    }
+
+    if (!block.empty()) {
+        writeBlock(file, block);
+        block.clear();
+    }
+
+    uint32_t marker = FOOTER_MARKER;
+    uint64_t droppedCount = dropped.load();
+    std::fwrite(&marker, sizeof(marker), 1, file);
+    std::fwrite(&droppedCount, sizeof(droppedCount), 1, file);
+    std::fclose(file);
+}
+
+bool EventJournal::readFile(const std::string& path, std::vector<GameEvent>& events, uint64_t* droppedOut) {
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file) return false;
+
+    char magic[4];
+    uint32_t version = 0;
+    if (std::fread(magic, 1, 4, file) != 4 || std::fread(&version, sizeof(version), 1, file) != 1 ||
+        std::string(magic, 4) != std::string(JOURNAL_MAGIC, 4) || version != FILE_VERSION) {
+        std::fclose(file);
+        return false;
+    }
+
+    std::vector<float> times;
+    std::vector<uint8_t> types;
+    std::vector<int16_t> xs, ys;
+    std::vector<int32_t> values;
+
+    uint32_t count = 0;
+    while (std::fread(&count, sizeof(count), 1, file) == 1) {
+        if (count == FOOTER_MARKER) {
+            uint64_t droppedCount = 0;
+            if (std::fread(&droppedCount, sizeof(droppedCount), 1, file) == 1 && droppedOut) {
+                *droppedOut = droppedCount;
+            }
+            break;
+        }
+
+        times.resize(count);
+        types.resize(count);
+        xs.resize(count);
+        ys.resize(count);
+        values.resize(count);
+        if (std::fread(times.data(), sizeof(float), count, file) != count ||
+            std::fread(types.data(), sizeof(uint8_t), count, file) != count ||
+            std::fread(xs.data(), sizeof(int16_t), count, file) != count ||
+            std::fread(ys.data(), sizeof(int16_t), count, file) != count ||
+            std::fread(values.data(), sizeof(int32_t), count, file) != count) {
+            break;  // Truncated block (game crashed mid-write) - keep what we have
+        }
+
+        for (uint32_t i = 0; i < count; i++) {
+            GameEvent e;
+            e.time = times[i];
+            e.type = static_cast<GameEventType>(types[i]);
+            e.x = xs[i];
+            e.y = ys[i];
+            e.value = values[i];
+            events.push_back(e);
+        }
+    }
+
+    std::fclose(file);
+    return true;
+}
@@ -0,0 +1,57 @@
+#include "Fixed.h"
+
+namespace {
+    // pi / 180 as a 0.32 fraction, so degrees -> radians keeps full precision
+    const int64_t DEG_TO_RAD_32 = 74961321;
+    const int32_t FULL_TURN = 360 * Fixed::ONE;
+}
+
+Fixed Fixed::sqrt(Fixed f) {
+    if (f.value <= 0) return Fixed();
+
+    // sqrt(v / 2^16) * 2^16 = sqrt(v * 2^16), done bit by bit
+    uint64_t n = static_cast<uint64_t>(f.value) << FRACTION_BITS;
+    uint64_t result = 0;
+    uint64_t bit = uint64_t(1) << 62;
+    while (bit > n) bit >>= 2;
+    while (bit != 0) {
+        if (n >= result + bit) {
+            n -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return fromRaw(static_cast<int32_t>(result));
+}
+
+Fixed Fixed::sinDeg(Fixed degrees) {
+    // Fold into -90..90, where the series converges quickly
+    int32_t d = degrees.value % FULL_TURN;
+    if (d < 0) d += FULL_TURN;
+    if (d > 270 * ONE) {
+        d -= FULL_TURN;
+    } else if (d > 90 * ONE) {
+        d = 180 * ONE - d;
+    }
+
+    // sin x = x (1 - x^2/6 (1 - x^2/20 (1 - x^2/42)))
+    int64_t x = (static_cast<int64_t>(d) * DEG_TO_RAD_32) >> 32;
+    int64_t x2 = (x * x) >> FRACTION_BITS;
+    int64_t term = ONE - x2 / 42;
+    term = ONE - ((x2 * term) >> FRACTION_BITS) / 20;
+    term = ONE - ((x2 * term) >> FRACTION_BITS) / 6;
+    int64_t result = (x * term) >> FRACTION_BITS;
+
+    if (result > ONE) result = ONE;
+    if (result < -ONE) result = -ONE;
+    return fromRaw(static_cast<int32_t>(result));
+}
+
+Fixed FixedVec2::length() const {
+    // Square in 64 bits so long vectors don't overflow
+    int64_t squared = (static_cast<int64_t>(x.raw()) * x.raw() + static_cast<int64_t>(y.raw()) * y.raw()) >> Fixed::FRACTION_BITS;
+    if (squared > INT32_MAX) squared = INT32_MAX;
+    return Fixed::sqrt(Fixed::fromRaw(static_cast<int32_t>(squared)));
+}
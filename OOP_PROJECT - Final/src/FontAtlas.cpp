@@ -0,0 +1,65 @@
+#include "FontAtlas.h"
+#include "BakedFontData.h"
+#include <algorithm>
+#include <vector>
+
+FontAtlas::FontAtlas() {
+    for (auto& styleLookup : lookup) {
+        for (int16_t& index : styleLookup) index = -1;
+    }
+    for (int s = 0; s < static_cast<int>(FontStyle::COUNT); s++) {
+        const BakedStyleInfo& info = BAKED_STYLE_INFO[s];
+        for (int g = info.firstGlyph; g < info.firstGlyph + info.glyphCount; g++) {
+            unsigned char c = static_cast<unsigned char>(BAKED_GLYPHS[g].character);
+            if (c < 128) lookup[s][c] = static_cast<int16_t>(g);
+        }
+    }
+
+    // Undo the baker's run-length encoding straight into white RGBA texels
+    // with the glyph coverage as alpha
+    std::vector<sf::Uint8> pixels(static_cast<size_t>(BAKED_ATLAS_WIDTH) * BAKED_ATLAS_HEIGHT * 4, 255);
+    size_t texel = 0;
+    size_t texelCount = static_cast<size_t>(BAKED_ATLAS_WIDTH) * BAKED_ATLAS_HEIGHT;
+    size_t i = 0;
+    while (i < BAKED_ATLAS_RLE_SIZE && texel < texelCount) {
+        unsigned char code = BAKED_ATLAS_RLE[i++];
+        if (code >= 128) {
+            // Repeat: code - 128 + 2 copies of the next byte
+            unsigned char alpha = BAKED_ATLAS_RLE[i++];
+            for (int n = code - 128 + 2; n > 0 && texel < texelCount; n--) {
+                pixels[texel++ * 4 + 3] = alpha;
+            }
+        } else {
+            // Literal: code + 1 bytes
+            for (int n = code + 1; n > 0 && texel < texelCount && i < BAKED_ATLAS_RLE_SIZE; n--) {
+                pixels[texel++ * 4 + 3] = BAKED_ATLAS_RLE[i++];
+            }
+        }
+    }
+
+    texture.create(BAKED_ATLAS_WIDTH, BAKED_ATLAS_HEIGHT);
+    texture.update(pixels.data());
+    texture.setSmooth(true);    // Glyphs carry a transparent border for this
+}
+
+const BakedGlyph* FontAtlas::findGlyph(FontStyle style, char c) const {
+    unsigned char index = static_cast<unsigned char>(c);
+    if (index >= 128) return nullptr;
+    int16_t g = lookup[static_cast<int>(style)][index];
+    return g >= 0 ? &BAKED_GLYPHS[g] : nullptr;
+}
+
+float FontAtlas::getLineSpacing(FontStyle style) const {
+    return BAKED_STYLE_INFO[static_cast<int>(style)].lineSpacing;
+}
+
+float FontAtlas::getKerning(FontStyle style, char first, char second) const {
+    const BakedStyleInfo& info = BAKED_STYLE_INFO[static_cast<int>(style)];
+    const BakedKerning* begin = BAKED_KERNING + info.firstKerning;
+    const BakedKerning* end = begin + info.kerningCount;
+    const BakedKerning* k = std::lower_bound(begin, end, BakedKerning{first, second, 0},
+        [](const BakedKerning& a, const BakedKerning& b) {
+            return a.first != b.first ? a.first < b.first : a.second < b.second;
+        });
+    return (k != end && k->first == first && k->second == second) ? k->amount : 0.0f;
+}
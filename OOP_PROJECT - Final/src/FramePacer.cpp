@@ -0,0 +1,112 @@
+#include "FramePacer.h"
+#include <cmath>
+#include <thread>
+
+FramePacer::FramePacer() {
+    vsync = false;
+    workEstimate = 0;
+    lastWork = 0;
+    sleepOvershoot = 1000;  // Assume a 1 ms timer until we know better
+    frameCount = 0;
+    frameIndex = 0;
+    setTargetFps(60);
+    resync();
+}
+
+void FramePacer::setTargetFps(int fps) {
+    targetFps = fps;
+    period = fps > 0 ? 1000000 / fps : 0;
+    resync();
+}
+
+void FramePacer::resync() {
+    lastPresent = now();
+    nextPresent = lastPresent + period;
+    workStart = lastPresent;
+}
+
+sf::Int64 FramePacer::getSampleDeadline() const {
+    if (period == 0) return 0;
+    // With vsync, missing the blank costs a whole frame, so keep a bigger margin
+    sf::Int64 margin = vsync ? 2000 : 500;
+    return nextPresent - workEstimate - margin;
+}
+
+void FramePacer::waitUntil(sf::Int64 deadline, const std::function<void()>& poll) {
+    // Sleep while we are comfortably early
+    while (true) {
+        sf::Int64 remaining = deadline - now();
+        if (remaining <= sleepOvershoot + 1000) break;
+        if (poll) poll();
+
+        sf::Int64 before = now();
+        sf::sleep(sf::milliseconds(1));
+        sf::Int64 overshoot = (now() - before) - 1000;
+        if (overshoot < 0) overshoot = 0;
+        // Track the overshoot, reacting faster when it gets worse
+        if (overshoot > sleepOvershoot) {
+            sleepOvershoot = (sleepOvershoot + overshoot) / 2;
+        } else {
+            sleepOvershoot = (sleepOvershoot * 15 + overshoot) / 16;
+        }
+    }
+
+    // Spin (yielding to other threads) for the last stretch
+    if (poll) poll();
+    while (now() < deadline) {
+        std::this_thread::yield();
+    }
+}
+
+void FramePacer::waitToPresent() {
+    sf::Int64 before = now();
+    waitUntil(nextPresent, nullptr);
+    workStart += now() - before;
+}
+
+void FramePacer::framePresented() {
+    sf::Int64 presented = now();
+    lastWork = presented - workStart;
+    workEstimate = (workEstimate * 7 + lastWork) / 8;
+
+    frameTimes[frameIndex] = presented - lastPresent;
+    frameIndex = (frameIndex + 1) % HISTORY;
+    if (frameCount < HISTORY) frameCount++;
+    lastPresent = presented;
+
+    // With vsync display() returns right after the blank, so the next one
+    // is one period after this present. Otherwise follow our own schedule
+    // (and don't try to catch up if we fell behind).
+    nextPresent += period;
+    if (vsync || nextPresent < presented) {
+        nextPresent = presented + period;
+    }
+}
+
+float FramePacer::getAverageFrameMs() const {
+    if (frameCount == 0) return 0;
+    sf::Int64 total = 0;
+    for (int i = 0; i < frameCount; i++) {
+        total += frameTimes[i];
+    }
+    return static_cast<float>(total) / frameCount / 1000.0f;
+}
+
+float FramePacer::getFrameStdDevMs() const {
+    if (frameCount < 2) return 0;
+    float mean = getAverageFrameMs();
+    float sum = 0;
+    for (int i = 0; i < frameCount; i++) {
+        float diff = frameTimes[i] / 1000.0f - mean;
+        sum += diff * diff;
+    }
+    return std::sqrt(sum / (frameCount - 1));
+}
+
+float FramePacer::getMaxFrameMs() const {
+    sf::Int64 worst = 0;
+    for (int i = 0; i < frameCount; i++) {
+        if (frameTimes[i] > worst) worst = frameTimes[i];
+    }
+    return worst / 1000.0f;
+}
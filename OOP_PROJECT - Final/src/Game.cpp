@@ -1,20 +1,71 @@
 #include "Game.h"
+#include <algorithm>
 #include <random>
 #include <cmath>
+#include <cstdio>
+#include <iostream>
 
-Game::Game() : window(sf::VideoMode(WINDOW_WIDTH, WINDOW_HEIGHT), WINDOW_TITLE) {
-    window.setFramerateLimit(FPS);
+namespace {
+    // Replay room kept from the start of a run: half an hour of four players at 144 FPS
+    const size_t REPLAY_RESERVE_BYTES = 8 * 1024 * 1024;
+
+    // Cosmetic timers (screen shake) waiting at once
+    const size_t EFFECT_TIMERS = 16;
+}
+
+Game::Game() : window(sf::VideoMode(WINDOW_WIDTH, WINDOW_HEIGHT), WINDOW_TITLE),
+               effectTimers(EFFECT_TIMERS), frameArena(FRAME_ARENA_BYTES) {
+    // Frame rate is limited by Game::run so input can be sampled late
     state = GameState::MENU;
 
-    score = 0;
-    combo = 0;
-    obstacleSpawnTimer = 0;
-    powerUpSpawnTimer = 0;
-    colorWallSpawnTimer = 0;  // Initialize color wall timer
-    currentObstacleSpeed = OBSTACLE_SPEED;
-    currentSpawnTime = OBSTACLE_SPAWN_TIME;
+    tickInput = SimInput();
+    stressQueued = false;
+    playerCount = 1;
+    fixedSeed = 0;
+    useFixedSeed = false;
+    playerName = LEADERBOARD_NAME;
+    for (int p = 0; p < MAX_PLAYERS; p++) {
+        dashTrails[p] = -1;
+    }
     shakeIntensity = 0;
-    shakeTimer = 0;
+    shakeCount = 0;
+    pendingBeatCount = 0;
+    showStats = false;
+    needsRedraw = true;
+    lightingEnabled = ENABLE_LIGHTING;
+    lightingAllowed = governor.getSettings().lightingEnabled;
+    dynamicBloom = DYNAMIC_BLOOM;
+    bloom.setQuality(static_cast<BloomQuality>(governor.getSettings().bloomLevel));
+    updateGlow();
+
+    appliedTier = governor.getTier();
+    dynamicRenderScale = DYNAMIC_RENDER_SCALE;
+    setRenderScale(RENDER_SCALE);
+    updateScreenLayout(WINDOW_WIDTH, WINDOW_HEIGHT);
+    pacer.setTargetFps(FPS);
+    pacer.setVsync(ENABLE_VSYNC);
+    window.setVerticalSyncEnabled(ENABLE_VSYNC);
+
+    paneDivider.setSize(sf::Vector2f(WINDOW_WIDTH, 3));
+    paneDivider.setOrigin(0, 1.5f);
+    paneDivider.setFillColor(sf::Color(255, 255, 255, 180));
+
+    allocTestMode = false;
+    allocTestFailed = false;
+    lastFrameAllocs = AllocTracker::endFrame();
+
+    // Particle effects (the built-in sparks stand in for anything missing)
+    particles.loadEmitters(EFFECTS_FILE);
+    dashTrailEmitter = particles.findEmitter("dash_trail");
+    SimEffects effectIds;
+    SimEffect* slots[] = {&effectIds.dash, &effectIds.colorChange, &effectIds.dodge,
+                          &effectIds.wallPass, &effectIds.pickup, &effectIds.explosion};
+    const char* names[] = {"dash", "color_change", "dodge", "wall_pass", "pickup", "explosion"};
+    for (int i = 0; i < 6; i++) {
+        slots[i]->emitter = particles.findEmitter(names[i]);
+        slots[i]->count = particles.getEmitter(slots[i]->emitter).count;
+    }
+    sim.setEffects(effectIds);
 
     // Load dash sound effect
     if (dashBuffer.loadFromFile("assets/sounds/Dash.wav")) {
@@ -29,332 +80,831 @@ Game::Game() : window(sf::VideoMode(WINDOW_WIDTH, WINDOW_HEIGHT), WINDOW_TITLE)
     }
 
     // Load and play background music
-    if (backgroundMusic.openFromFile("assets/sounds/bg_sound.wav")) {
-        backgroundMusic.setLoop(true);      // Loop forever
+    // (the stream loops by itself and feeds the beat detector)
+    if (backgroundMusic.openFromFile(MUSIC_FILE, ENABLE_BEAT_SPAWNING ? &beatDetector : nullptr)) {
+        if (ENABLE_BEAT_SPAWNING) {
+            beatDetector.start(backgroundMusic.getSampleRate(), backgroundMusic.getTrackFrames(),
+                               MUSIC_FILE + BEAT_CACHE_SUFFIX);
+        }
         backgroundMusic.setVolume(30);      // Quieter than sound effects (0-100)
         backgroundMusic.play();             // Start playing immediately
     }
 
+    // Compile the bullet patterns
+    if (ENABLE_PATTERNS && patternLibrary.loadFromFile(PATTERN_FILE)) {
+        sim.setPatternLibrary(&patternLibrary);
+    }
+
     createBackground();
+
+    // Start recording gameplay events on a background thread
+    if (ENABLE_EVENT_JOURNAL) {
+        journal.start(JOURNAL_DIRECTORY);
+    }
+    sim.setJournal(&journal);
+
+    if (ENABLE_METRICS) {
+        metrics.start(METRICS_PORT);
+    }
+    if (ENABLE_SPECTATOR_FEED) {
+        spectatorFeed.open();
+    }
+    if (ENABLE_LEADERBOARD) {
+        leaderboard.start(LEADERBOARD_PORT);
+    }
+}
+
+void Game::setDifficulty(const DifficultySettings& settings) {
+    sim.setDifficulty(settings);
+}
+
+bool Game::enableMetrics(unsigned short port) {
+    return metrics.start(port);
+}
+
+bool Game::enableSpectatorFeed() {
+    return spectatorFeed.open();
+}
+
+bool Game::enableJournal() {
+    return journal.start(JOURNAL_DIRECTORY);
+}
+
+bool Game::enableStateHashing(const std::string& path) {
+    return stateHashes.open(path);
+}
+
+void Game::setSeed(uint32_t seed) {
+    fixedSeed = seed;
+    useFixedSeed = true;
+}
+
+void Game::enableLeaderboard(unsigned short port) {
+    leaderboard.start(port);
 }
 
-void Game::run() {
+void Game::setPlayerName(const std::string& name) {
+    playerName = name;
+}
+
+void Game::enableAllocTest() {
+    allocTestMode = true;
+    sim.setInvulnerable(true);
+    startGame();
+}
+
+int Game::run() {
     sf::Clock clock;
     
     while (window.isOpen()) {
+        // Nothing on screen can change - sleep until the next window event
+        if (isIdle()) {
+            sf::Event event;
+            if (window.waitEvent(event)) {
+                handleEvent(event);
+            }
+            pacer.resync();
+            clock.restart();  // Don't count the idle time as game time
+            continue;
+        }
+
+        InputState in[MAX_PLAYERS];
+        {
+            AllocPhaseScope phase(AllocPhase::INPUT);
+            if (LATE_INPUT_SAMPLING) {
+                // Sleep first so the input we read is as fresh as possible
+                // when the frame reaches the screen
+                pacer.waitUntil(pacer.getSampleDeadline(), [this]() { processEvents(); });
+            }
+
+            processEvents();
+            input.sample(in, playerCount);
+        }
+        pacer.beginWork();
+
         float dt = clock.restart().asSeconds();
-        processEvents();
-        update(dt);
-        render();
+        // Hashed runs step exactly one frame at a time, so two of them line up tick for tick
+        if (stateHashes.isOpen()) dt = 1.0f / FPS;
+        {
+            AllocPhaseScope phase(AllocPhase::UPDATE);
+            update(dt, in);
+        }
+        {
+            AllocPhaseScope phase(AllocPhase::RENDER);
+            render();
+        }
+
+        input.notePresented(pacer.now());
+        pacer.framePresented();
+
+        // End of frame: throw away transient memory and check allocations
+        frameArena.reset();
+        checkFrameAllocations();
+        updateMetrics(dt);
+        publishSpectatorFrame();
+    }
+
+    return allocTestFailed ? 1 : 0;
+}
+
+void Game::checkFrameAllocations() {
+    lastFrameAllocs = AllocTracker::endFrame();
+    if (!allocTestMode) return;
+
+    // Give the game time to warm up (first sounds, glyphs, pools) before judging
+    float runTime = sim.getRunTime();
+    if (state != GameState::PLAYING || runTime < ALLOC_TEST_WARMUP) return;
+
+    if (lastFrameAllocs.gameplayCount() > 0) {
+        std::cerr << "Allocation test FAILED at " << runTime << "s:";
+        for (int i = 0; i < static_cast<int>(AllocPhase::COUNT); i++) {
+            if (lastFrameAllocs.count[i] > 0) {
+                std::cerr << " " << AllocTracker::getPhaseName(static_cast<AllocPhase>(i)) << "="
+                          << lastFrameAllocs.count[i] << " (" << lastFrameAllocs.bytes[i] << " bytes)";
+            }
+        }
+        std::cerr << std::endl;
+        allocTestFailed = true;
+        window.close();
+    } else if (runTime >= ALLOC_TEST_WARMUP + ALLOC_TEST_DURATION) {
+        std::cerr << "Allocation test passed: no gameplay allocations for "
+                  << ALLOC_TEST_DURATION << "s" << std::endl;
+        window.close();
+    }
+}
+
+// Hand this frame's numbers to the metrics exporter (atomic stores only)
+void Game::updateMetrics(float dt) {
+    if (!metrics.isRunning()) return;
+
+    metrics.recordFrame(dt);
+    metrics.setWorldCounts(particles.getCount(), sim.getObstacles().size(), sim.getPowerUps().size(),
+                           sim.getBullets().getCount());
+    int voicesPlaying = (dashSound.getStatus() == sf::Sound::Playing) +
+                        (wallPassSound.getStatus() == sf::Sound::Playing) +
+                        (backgroundMusic.getStatus() == sf::SoundSource::Playing);
+    metrics.setAudioVoices(voicesPlaying, 3);
+    metrics.addAllocations(lastFrameAllocs.totalCount(), lastFrameAllocs.totalBytes(), frameArena.getPeak());
+    metrics.setUiTextUpdates(ui.getTextUpdates());
+    metrics.setScore(sim.getScore());
+}
+
+// Write what this frame showed straight into the shared ring (no copy, no
+// waiting on spectators)
+void Game::publishSpectatorFrame() {
+    if (!spectatorFeed.isOpen()) return;
+
+    const auto& obstacles = sim.getObstacles();
+    const auto& powerUps = sim.getPowerUps();
+    const BulletField& bullets = sim.getBullets();
+
+    SpectatorFrame* frame = spectatorFeed.beginFrame();
+    frame->runTime = sim.getRunTime();
+    frame->cameraX = cameraOffset.x;
+    frame->cameraY = cameraOffset.y;
+    frame->dashCooldown = sim.getDashCooldown(0);
+    frame->score = sim.getScore();
+    frame->combo = sim.getCombo();
+    frame->screen = state == GameState::PLAYING ? SpectatorScreen::PLAYING
+                  : state == GameState::GAME_OVER ? SpectatorScreen::GAME_OVER : SpectatorScreen::MENU;
+    frame->playerCount = static_cast<uint8_t>(playerCount);
+
+    uint32_t entityCount = 0;
+    uint32_t bulletCount = 0;
+    uint32_t particleCount = 0;
+    if (state != GameState::MENU) {
+        const uint32_t maxEntities = SpectatorFrame::MAX_ENTITIES;
+        for (const auto& obstacle : obstacles) {
+            if (!obstacle->active() || entityCount == maxEntities) continue;
+            SpectatorEntity& e = frame->entities[entityCount++];
+            e.x = obstacle->getPosition().x;
+            e.y = obstacle->getPosition().y;
+            e.halfWidth = obstacle->getSize().x / 2;
+            e.halfHeight = obstacle->getSize().y / 2;
+            e.rotation = obstacle->getRotation();
+            e.outline = obstacle->getOutlineThickness();
+            e.color = obstacle->getColor().toInteger();
+            e.outlineColor = sf::Color::White.toInteger();
+            e.shape = SpectatorShape::BOX;
+        }
+        for (const auto& powerUp : powerUps) {
+            if (!powerUp->active() || state != GameState::PLAYING || entityCount == maxEntities) continue;
+            SpectatorEntity& e = frame->entities[entityCount++];
+            e.x = powerUp->getPosition().x;
+            e.y = powerUp->getPosition().y;
+            e.halfWidth = e.halfHeight = powerUp->getDrawRadius();
+            e.rotation = 0;
+            e.outline = 3.0f;
+            e.color = powerUp->getColor().toInteger();
+            e.outlineColor = sf::Color::White.toInteger();
+            e.shape = SpectatorShape::ROUND;
+        }
+        for (int p = 0; p < playerCount; p++) {
+            if ((!sim.isPlayerAlive(p) && state != GameState::GAME_OVER) || entityCount == maxEntities) continue;
+            const Player& player = sim.getPlayer(p);
+            SpectatorEntity& e = frame->entities[entityCount++];
+            e.x = player.getPosition().x;
+            e.y = player.getPosition().y;
+            e.halfWidth = e.halfHeight = PLAYER_SIZE / 2 * player.getDrawScale();
+            e.rotation = 0;
+            e.outline = 3.0f;
+            e.color = player.getColor().toInteger();
+            e.outlineColor = player.getOutlineColor().toInteger();
+            e.shape = SpectatorShape::BOX;
+        }
+
+        bulletCount = static_cast<uint32_t>(std::min(bullets.getCount(), MAX_BULLETS));
+        for (uint32_t i = 0; i < bulletCount; i++) {
+            sf::Vector2f position = bullets.getPosition(i);
+            frame->bullets[i] = {position.x, position.y, bullets.getHalfSize(i), bullets.getColor(i).toInteger()};
+        }
+        particleCount = static_cast<uint32_t>(std::min(particles.getCount(), MAX_PARTICLES));
+        for (uint32_t i = 0; i < particleCount; i++) {
+            const Particle& particle = particles.getParticle(i);
+            frame->particles[i] = {particle.position.x, particle.position.y, particle.size, particle.color.toInteger()};
+        }
     }
+    frame->entityCount = entityCount;
+    frame->bulletCount = bulletCount;
+    frame->particleCount = particleCount;
+
+    spectatorFeed.publish();
+}
+
+bool Game::isIdle() const {
+    if (!IDLE_WHEN_STATIC || allocTestMode) return false;
+    // Paused while the window is in the background
+    if (!window.hasFocus()) return true;
+    // Menu and game over screens are static until something happens
+    return state != GameState::PLAYING && !needsRedraw;
 }
 
 void Game::processEvents() {
     sf::Event event;
     while (window.pollEvent(event)) {
-        if (event.type == sf::Event::Closed) {
+        handleEvent(event);
+    }
+}
+
+void Game::handleEvent(const sf::Event& event) {
+    input.handleEvent(event, pacer.now());
+
+    if (event.type == sf::Event::Closed) {
+        window.close();
+    }
+    
+    if (event.type == sf::Event::KeyPressed) {
+        if (event.key.code == sf::Keyboard::Escape) {
             window.close();
         }
         
-        if (event.type == sf::Event::KeyPressed) {
-            if (event.key.code == sf::Keyboard::Escape) {
-                window.close();
+        if (event.key.code == sf::Keyboard::Enter) {
+            if (state == GameState::MENU) {
+                startGame();
+            } else if (state == GameState::GAME_OVER) {
+                resetGame();
+                startGame();
             }
-            
-            if (event.key.code == sf::Keyboard::Enter) {
-                if (state == GameState::MENU) {
-                    startGame();
-                } else if (state == GameState::GAME_OVER) {
-                    resetGame();
-                    startGame();
-                }
+        }
+
+        // 1-4 picks the number of local players before a run
+        if (state != GameState::PLAYING && event.key.code >= sf::Keyboard::Num1 &&
+            event.key.code < sf::Keyboard::Num1 + MAX_PLAYERS) {
+            playerCount = event.key.code - sf::Keyboard::Num1 + 1;
+            ui.updatePlayerCount(playerCount);
+        }
+
+        if (event.key.code == sf::Keyboard::F3) {
+            showStats = !showStats;
+        }
+
+        // F4 cycles the target frame rate, F5 toggles vsync
+        if (event.key.code == sf::Keyboard::F4) {
+            const int rates[] = {60, 120, 144, 240, 0};
+            int next = 0;
+            for (int i = 0; i < 5; i++) {
+                if (rates[i] == pacer.getTargetFps()) next = (i + 1) % 5;
             }
-            
-            if (event.key.code == sf::Keyboard::Space && state == GameState::PLAYING) {
-                if (player.canDash()) {
-                    player.dash();
-                    particles.emit(player.getPosition(), COLOR_BLUE, 20);
-                    dashSound.play();  // Play dash sound effect
-                }
+            pacer.setTargetFps(rates[next]);
+        }
+
+        // F6 cycles the internal resolution: dynamic, 100%, 75%, 50%
+        if (event.key.code == sf::Keyboard::F6) {
+            if (dynamicRenderScale) {
+                dynamicRenderScale = false;
+                setRenderScale(1.0f);
+            } else if (renderScale > 0.8f) {
+                setRenderScale(0.75f);
+            } else if (renderScale > 0.6f) {
+                setRenderScale(0.5f);
+            } else {
+                dynamicRenderScale = true;
+                setRenderScale(governor.getSettings().renderScale);
             }
+        }
+
+        // F7 starts the bullet stress pattern
+        if (event.key.code == sf::Keyboard::F7 && state == GameState::PLAYING) {
+            stressQueued = true;
+        }
 
-            // NEW: Change player color when C key is pressed
-            if (event.key.code == sf::Keyboard::C && state == GameState::PLAYING) {
-                player.changeColor();
-                particles.emit(player.getPosition(), player.getColor(), 15);
+        // F8 toggles the light map
+        if (event.key.code == sf::Keyboard::F8) {
+            lightingEnabled = !lightingEnabled;
+        }
+
+        // F9 cycles the bloom quality: dynamic, off, low, medium, high
+        if (event.key.code == sf::Keyboard::F9) {
+            if (dynamicBloom) {
+                dynamicBloom = false;
+                bloom.setQuality(BloomQuality::OFF);
+            } else if (bloom.getQuality() == BloomQuality::HIGH) {
+                dynamicBloom = true;
+                bloom.setQuality(static_cast<BloomQuality>(governor.getSettings().bloomLevel));
+            } else {
+                bloom.setQuality(static_cast<BloomQuality>(static_cast<int>(bloom.getQuality()) + 1));
             }
+            updateGlow();
         }
-    }
-}
 
-void Game::update(float dt) {
-    if (state != GameState::PLAYING) return;
-    
-    // Update player
-    player.update(dt);
-    player.drawTrail(window, particles);
-    
-    // Update obstacles
-    obstacleSpawnTimer += dt;
-    if (obstacleSpawnTimer >= currentSpawnTime) {
-        spawnObstacle();
-        obstacleSpawnTimer = 0;
+        if (event.key.code == sf::Keyboard::F5) {
+            pacer.setVsync(!pacer.getVsync());
+            window.setVerticalSyncEnabled(pacer.getVsync());
+        }
     }
-    
-    for (auto& obstacle : obstacles) {
-        obstacle->update(dt);
+
+    if (event.type == sf::Event::Resized) {
+        updateScreenLayout(event.size.width, event.size.height);
     }
-    
-    // Update power-ups
-    powerUpSpawnTimer += dt;
-    if (powerUpSpawnTimer >= 5.0f) {
-        spawnPowerUp();
-        powerUpSpawnTimer = 0;
+
+    // Anything the player does (or the window system does to us) may change
+    // what the static screens show
+    if (event.type == sf::Event::KeyPressed || event.type == sf::Event::Resized ||
+        event.type == sf::Event::GainedFocus) {
+        needsRedraw = true;
     }
+}
 
-    for (auto& powerUp : powerUps) {
-        powerUp->update(dt);
+void Game::update(float dt, const InputState* in) {
+    if (showStats) {
+        AllocPhaseScope phase(AllocPhase::OVERLAY);
+        BulletField& bullets = sim.getBullets();
+        PatternVM& patterns = sim.getPatterns();
+        EffectBuffer& effects = sim.getEffects();
+        char stats[2048];
+        int length = std::snprintf(stats, sizeof(stats),
+                      "Frame: %.2f ms avg, %.2f ms stddev, %.2f ms max\n"
+                      "Target: %d FPS%s\n"
+                      "Input latency: %.1f ms avg / %.1f ms max\n"
+                      "Quality: %s, render scale %d%%%s\n"
+                      "Allocs: %llu (%llu bytes) upd %llu col %llu ren %llu pres %llu\n"
+                      "Arena: %zu KB peak of %zu KB\n"
+                      "Beats: %s, %.3f ms/block (max %.3f)\n"
+                      "Bullets: %zu of %zu, update %.2f ms, %d patterns running\n"
+                      "Timers: %zu waiting, coroutine frames %zu of %zu\n"
+                      "Effects: %zu commands, %zu after merging\n"
+                      "Particles: %zu, collide %.2f ms (%zu box tests)\n"
+                      "Lights: %d, %d occluders, %.2f ms on %d threads%s\n"
+                      "Bloom: %s%s, %s, %.2f ms",
+                      pacer.getAverageFrameMs(), pacer.getFrameStdDevMs(), pacer.getMaxFrameMs(),
+                      pacer.getTargetFps(), pacer.getVsync() ? " (vsync)" : "",
+                      input.getAverageLatencyMs(), input.getMaxLatencyMs(),
+                      QualityGovernor::getTierName(governor.getTier()),
+                      static_cast<int>(renderScale * 100 + 0.5f), dynamicRenderScale ? " (dynamic)" : "",
+                      static_cast<unsigned long long>(lastFrameAllocs.totalCount()),
+                      static_cast<unsigned long long>(lastFrameAllocs.totalBytes()),
+                      static_cast<unsigned long long>(lastFrameAllocs.count[static_cast<int>(AllocPhase::UPDATE)]),
+                      static_cast<unsigned long long>(lastFrameAllocs.count[static_cast<int>(AllocPhase::COLLISION)]),
+                      static_cast<unsigned long long>(lastFrameAllocs.count[static_cast<int>(AllocPhase::RENDER)]),
+                      static_cast<unsigned long long>(lastFrameAllocs.count[static_cast<int>(AllocPhase::PRESENT)]),
+                      frameArena.getPeak() / 1024, frameArena.getCapacity() / 1024,
+                      !ENABLE_BEAT_SPAWNING ? "off" : beatDetector.isUsingCache() ? "cached map" : "live",
+                      beatDetector.getLastBlockMs(), beatDetector.getMaxBlockMs(),
+                      bullets.getCount(), bullets.getCapacity(), sim.getBulletUpdateMs(), patterns.getRunningCount(),
+                      sim.getTimers().getPendingCount(), CoroutineFramePool::getInUse(), CoroutineFramePool::getCapacity(),
+                      effects.getRecordedCount(), effects.getMergedCount(),
+                      particles.getCount(), particleCollider.getLastMs(), particleCollider.getLastTests(),
+                      lightMap.getLightCount(), lightMap.getOccluderCount(), lightMap.getLastMs(),
+                      renderWorkers.getBandCount(), lightingEnabled && lightingAllowed ? "" : " (off)",
+                      Bloom::getQualityName(bloom.getQuality()), dynamicBloom ? " (dynamic)" : "",
+                      bloom.isUsingShader() ? "shader" : "CPU", bloom.getLastMs());
+        // What each live pattern costs
+        patterns.updateBulletCounts(bullets);
+        for (int i = 0; i < patternLibrary.getPatternCount() && i < PatternVM::MAX_PATTERNS && length < 1800; i++) {
+            const PatternStats& p = patterns.getStats(i);
+            if (p.running == 0 && p.bullets == 0) continue;
+            length += std::snprintf(stats + length, sizeof(stats) - length,
+                                    "\n  %s: x%d, %d bullets, %d fired, vm %.3f ms",
+                                    patternLibrary.getPattern(i).name.c_str(), p.running, p.bullets,
+                                    p.emitted, p.vmMs);
+        }
+        // Last few governor decisions
+        int decisions = governor.getHistoryCount();
+        for (int i = decisions > 3 ? decisions - 3 : 0; i < decisions && length < 1900; i++) {
+            const QualityDecision& d = governor.getDecision(i);
+            length += std::snprintf(stats + length, sizeof(stats) - length, "\n  %.0fs: %s -> %s (%.1f ms)",
+                                    d.time, QualityGovernor::getTierName(d.from),
+                                    QualityGovernor::getTierName(d.to), d.averageWorkMs);
+        }
+        ui.updateStats(stats);
     }
 
-    // Update color walls - spawn them periodically
-    colorWallSpawnTimer += dt;
-    if (colorWallSpawnTimer >= COLOR_WALL_SPAWN_TIME) {
-        spawnColorWall();
-        colorWallSpawnTimer = 0;
+    // Beats that played since the last tick go into it
+    tickInput.beatCount = 0;
+    updateBeats();
+
+    if (state != GameState::PLAYING) return;
+
+    tickInput.dt = dt;
+    for (int p = 0; p < MAX_PLAYERS; p++) {
+        tickInput.players[p] = in[p];
     }
-    
-    // Update particles
-    particles.update(dt);
-    
-    // Check collisions
-    checkCollisions();
+    tickInput.stressPattern = stressQueued;
+    stressQueued = false;
+    if (leaderboard.isRunning()) {
+        replay.record(tickInput);
+    }
+
+    sim.step(tickInput);
+    updateQuality(dt);
+    updateParticles(dt);
     
     // Update UI
-    ui.updateScore(score);
-    ui.updateCombo(combo);
-    ui.updateDashCooldown(player.getDashCooldown());
-    
-    // Update difficulty
-    updateDifficulty();
+    ui.updateScore(sim.getScore());
+    ui.updateCombo(sim.getCombo());
+    ui.updateDashCooldown(sim.getDashCooldown(0));
     
     // Update screen shake
-    if (shakeTimer > 0) {
-        shakeTimer -= dt;
+    effectTimers.advance(Fixed::fromFloat(dt));
+    if (shakeIntensity > 0) {
         cameraOffset.x = (rand() % 100 - 50) / 50.0f * shakeIntensity;
         cameraOffset.y = (rand() % 100 - 50) / 50.0f * shakeIntensity;
     } else {
         cameraOffset = sf::Vector2f(0, 0);
     }
-    
-    // Remove inactive obstacles and power-ups
-    obstacles.erase(
-        std::remove_if(obstacles.begin(), obstacles.end(),
-            [](const std::unique_ptr<Obstacle>& obs) { return !obs->active(); }),
-        obstacles.end()
-    );
-    
-    powerUps.erase(
-        std::remove_if(powerUps.begin(), powerUps.end(),
-            [](const std::unique_ptr<PowerUp>& pw) { return !pw->active(); }),
-        powerUps.end()
-    );
+
+    // Everything this tick asked to be seen and heard, merged
+    executeEffects();
+
+    if (stateHashes.isOpen()) sim.hashState(stateHashes, tickInput);
+
+    if (sim.isOver()) gameOver();
+}
+
+void Game::updateParticles(float dt) {
+    // Dash trails follow their player for as long as the dash lasts
+    for (int p = 0; p < playerCount; p++) {
+        const Player& player = sim.getPlayer(p);
+        bool dashing = sim.isPlayerAlive(p) && player.isDashing();
+        if (dashing && dashTrails[p] < 0) {
+            dashTrails[p] = particles.startEmitter(dashTrailEmitter, player.getPosition(), player.getColor());
+        } else if (dashing) {
+            particles.moveEmitter(dashTrails[p], player.getPosition());
+        } else if (dashTrails[p] >= 0) {
+            particles.stopEmitter(dashTrails[p]);
+            dashTrails[p] = -1;
+        }
+    }
+
+    if (!ENABLE_PARTICLE_COLLISION) {
+        particles.update(dt);
+        return;
+    }
+
+    // The grid is rebuilt from this tick's obstacles and players
+    particleCollider.clear();
+    for (const auto& obstacle : sim.getObstacles()) {
+        if (!obstacle->active()) continue;
+        particleCollider.addBox(obstacle->getPosition(), obstacle->getHalfSize().toVector2f(),
+                                obstacle->getCosRotation().toFloat(), obstacle->getSinRotation().toFloat(),
+                                obstacle->getVelocity(),
+                                obstacle->isColorWall() ? ParticleResponse::STICK : ParticleResponse::BOUNCE);
+    }
+    for (int p = 0; p < playerCount; p++) {
+        if (sim.isPlayerAlive(p)) {
+            particleCollider.addDeflector(sim.getPlayer(p).getPosition(), PARTICLE_DEFLECT_RADIUS);
+        }
+    }
+    particleCollider.build();
+    particles.update(dt, &particleCollider);
+}
+
+void Game::executeEffects() {
+    EffectBuffer& effects = sim.getEffects();
+    effects.coalesce();
+    for (size_t i = 0; i < effects.getCount(); i++) {
+        const EffectCommand& c = effects.getCommand(i);
+        sf::Vector2f position(c.x, c.y);
+        switch (c.type) {
+            case EffectType::SHAKE:
+                screenShake(c.x);
+                break;
+            case EffectType::SOUND:
+                if (static_cast<SoundId>(c.id) == SoundId::DASH) {
+                    dashSound.play();
+                } else if (static_cast<SoundId>(c.id) == SoundId::WALL_PASS) {
+                    wallPassSound.play();
+                }
+                break;
+            case EffectType::PARTICLES:
+                particles.emit(c.id, position, sf::Color(c.color), c.count, c.direction);
+                break;
+        }
+    }
+    effects.clear();
 }
 
 void Game::render() {
-    window.clear(COLOR_BACKGROUND);
+    // Internal resolution of the world this frame
+    unsigned internalWidth = static_cast<unsigned>(viewportPixels.x * renderScale + 0.5f);
+    unsigned internalHeight = static_cast<unsigned>(viewportPixels.y * renderScale + 0.5f);
+    if (internalWidth < 1) internalWidth = 1;
+    if (internalHeight < 1) internalHeight = 1;
+    sf::Vector2u textureSize = worldTexture.getSize();
+
+    // The world is always laid out in WINDOW_WIDTH x WINDOW_HEIGHT units; the
+    // view's viewport only decides how many texels that covers
+    sf::View worldView(sf::FloatRect(0, 0, WINDOW_WIDTH, WINDOW_HEIGHT));
+    worldView.setViewport(sf::FloatRect(0, 0,
+                                        static_cast<float>(internalWidth) / textureSize.x,
+                                        static_cast<float>(internalHeight) / textureSize.y));
+    if (state == GameState::PLAYING) {
+        // Apply camera shake
+        worldView.setCenter(WINDOW_WIDTH / 2.0f + cameraOffset.x, 
+                            WINDOW_HEIGHT / 2.0f + cameraOffset.y);
+    }
+
+    worldTexture.clear(COLOR_BACKGROUND);
+    worldTexture.setView(worldView);
     
     // Draw background stars
     for (const auto& star : backgroundStars) {
-        window.draw(star);
+        worldTexture.draw(star);
     }
     
-    if (state == GameState::MENU) {
-        ui.drawMenu(window);
-    } else if (state == GameState::PLAYING) {
-        // Apply camera shake
-        sf::View view = window.getDefaultView();
-        view.setCenter(WINDOW_WIDTH / 2.0f + cameraOffset.x, 
-                       WINDOW_HEIGHT / 2.0f + cameraOffset.y);
-        window.setView(view);
-        
-        // Draw game objects
-        for (const auto& obstacle : obstacles) {
-            obstacle->draw(window);
+    if (state == GameState::PLAYING || state == GameState::GAME_OVER) {
+        // Draw game objects (game over shows the last game state)
+        for (const auto& obstacle : sim.getObstacles()) {
+            obstacle->draw(worldTexture);
         }
+        sim.getBullets().draw(worldTexture);
         
-        for (const auto& powerUp : powerUps) {
-            powerUp->draw(window);
+        if (state == GameState::PLAYING) {
+            for (const auto& powerUp : sim.getPowerUps()) {
+                powerUp->draw(worldTexture);
+            }
         }
         
-        player.draw(window);
-        particles.draw(window);
-        
-        // Reset view for UI
-        window.setView(window.getDefaultView());
+        // Game over still shows everyone where they fell
+        for (int p = 0; p < playerCount; p++) {
+            if (sim.isPlayerAlive(p) || state == GameState::GAME_OVER) {
+                sim.getPlayer(p).draw(worldTexture);
+            }
+        }
+        particles.draw(worldTexture, frameArena);
+
+        if (lightingEnabled && lightingAllowed) {
+            updateLighting();
+            lightMap.draw(worldTexture);
+        }
+    }
+    worldTexture.display();
+    bloom.apply(worldTexture, sf::Vector2u(internalWidth, internalHeight), renderWorkers);
+
+    // Upscale the world into the (letterboxed) window
+    window.clear(sf::Color::Black);
+    window.setView(screenView);
+    worldSprite.setTexture(worldTexture.getTexture());
+    if (playerCount > 1 && state != GameState::MENU) {
+        drawPanes(internalWidth, internalHeight);
+    } else {
+        worldSprite.setTextureRect(sf::IntRect(0, 0, internalWidth, internalHeight));
+        worldSprite.setScale(static_cast<float>(WINDOW_WIDTH) / internalWidth,
+                             static_cast<float>(WINDOW_HEIGHT) / internalHeight);
+        worldSprite.setPosition(0, 0);
+        window.draw(worldSprite);
+    }
+
+    // The HUD goes straight to the window at native resolution
+    if (state == GameState::MENU) {
+        ui.drawMenu(window);
+    } else if (state == GameState::PLAYING) {
         ui.drawGameUI(window);
-        
     } else if (state == GameState::GAME_OVER) {
-        // Draw last game state
-        for (const auto& obstacle : obstacles) {
-            obstacle->draw(window);
-        }
-        player.draw(window);
-        particles.draw(window);
-        
-        ui.drawGameOver(window, score);
+        ui.drawGameOver(window, sim.getScore());
+    }
+
+    if (showStats) {
+        ui.drawStats(window);
     }
     
-    window.display();
+    {
+        AllocPhaseScope phase(AllocPhase::PRESENT);
+        // Input was read at the top of the frame; wait here instead
+        if (!LATE_INPUT_SAMPLING && !pacer.getVsync()) pacer.waitToPresent();
+        window.display();
+    }
+    needsRedraw = false;
 }
 
-void Game::startGame() {
-    state = GameState::PLAYING;
-    player.reset();
+// Split-screen: the world was drawn once; each player gets a full-width strip
+// of the window showing the part of it around them. Every pane is just a
+// sprite over the same texture, so more players don't mean more scene draws.
+void Game::drawPanes(unsigned internalWidth, unsigned internalHeight) {
+    float paneHeight = static_cast<float>(WINDOW_HEIGHT) / playerCount;
+    float texelsPerUnit = static_cast<float>(internalHeight) / WINDOW_HEIGHT;
+    int paneTexels = static_cast<int>(paneHeight * texelsPerUnit);
+    if (paneTexels < 1) paneTexels = 1;
+
+    worldSprite.setScale(static_cast<float>(WINDOW_WIDTH) / internalWidth,
+                         paneHeight / paneTexels);
+    for (int p = 0; p < playerCount; p++) {
+        // Follow the player vertically, without looking past the world's edges
+        float centerY = sim.getPlayer(p).getPosition().y;
+        centerY = std::max(paneHeight / 2, std::min(WINDOW_HEIGHT - paneHeight / 2, centerY));
+        // No shake here: worldView already moved by cameraOffset when drawing
+        int top = static_cast<int>((centerY - paneHeight / 2) * texelsPerUnit);
+        top = std::max(0, std::min(static_cast<int>(internalHeight) - paneTexels, top));
+
+        worldSprite.setTextureRect(sf::IntRect(0, top, internalWidth, paneTexels));
+        worldSprite.setPosition(0, paneHeight * p);
+        window.draw(worldSprite);
+    }
+    for (int p = 1; p < playerCount; p++) {
+        paneDivider.setPosition(0, paneHeight * p);
+        window.draw(paneDivider);
+    }
 }
 
-void Game::resetGame() {
-    score = 0;
-    combo = 0;
-    obstacleSpawnTimer = 0;
-    powerUpSpawnTimer = 0;
-    colorWallSpawnTimer = 0;  // Reset color wall timer
-    currentObstacleSpeed = OBSTACLE_SPEED;
-    currentSpawnTime = OBSTACLE_SPAWN_TIME;
-
-    obstacles.clear();
-    powerUps.clear();
-    particles.clear();
+// Lights come from whatever is on screen this frame; only the regular
+// obstacles block them (color walls are lights themselves)
+void Game::updateLighting() {
+    lightMap.clear();
+    for (int p = 0; p < playerCount; p++) {
+        if (sim.isPlayerAlive(p) || state == GameState::GAME_OVER) {
+            const Player& player = sim.getPlayer(p);
+            lightMap.addLight(player.getPosition(), LIGHT_RADIUS_PLAYER, player.getColor());
+        }
+    }
+    if (state == GameState::PLAYING) {
+        for (const auto& powerUp : sim.getPowerUps()) {
+            if (powerUp->active()) {
+                lightMap.addLight(powerUp->getPosition(), LIGHT_RADIUS_POWERUP, powerUp->getColor());
+            }
+        }
+    }
+    for (const auto& obstacle : sim.getObstacles()) {
+        if (!obstacle->active()) continue;
+        if (obstacle->isColorWall()) {
+            lightMap.addLight(obstacle->getPosition(), LIGHT_RADIUS_COLOR_WALL, obstacle->getColor());
+        } else {
+            lightMap.addOccluder(obstacle->getPosition(), obstacle->getHalfSize().toVector2f(),
+                                 obstacle->getCosRotation().toFloat(), obstacle->getSinRotation().toFloat());
+        }
+    }
+    lightMap.compute(renderWorkers);
 }
 
-void Game::gameOver() {
-    state = GameState::GAME_OVER;
-    particles.emitExplosion(player.getPosition(), COLOR_RED);
-    screenShake(20.0f);
+void Game::updateScreenLayout(unsigned windowWidth, unsigned windowHeight) {
+    if (windowWidth == 0 || windowHeight == 0) return;
+
+    // Keep the game's aspect ratio and put black bars around it
+    float gameAspect = static_cast<float>(WINDOW_WIDTH) / WINDOW_HEIGHT;
+    float windowAspect = static_cast<float>(windowWidth) / windowHeight;
+    sf::FloatRect viewport(0, 0, 1, 1);
+    if (windowAspect > gameAspect) {
+        viewport.width = gameAspect / windowAspect;
+        viewport.left = (1 - viewport.width) / 2;
+    } else {
+        viewport.height = windowAspect / gameAspect;
+        viewport.top = (1 - viewport.height) / 2;
+    }
+    screenView = sf::View(sf::FloatRect(0, 0, WINDOW_WIDTH, WINDOW_HEIGHT));
+    screenView.setViewport(viewport);
+    viewportPixels = sf::Vector2u(static_cast<unsigned>(windowWidth * viewport.width),
+                                  static_cast<unsigned>(windowHeight * viewport.height));
+
+    // Only reallocate the world texture when it has to grow
+    sf::Vector2u textureSize = worldTexture.getSize();
+    if (viewportPixels.x > textureSize.x || viewportPixels.y > textureSize.y) {
+        worldTexture.create(std::max(viewportPixels.x, textureSize.x),
+                            std::max(viewportPixels.y, textureSize.y));
+        worldTexture.setSmooth(true);
+    }
+    needsRedraw = true;
 }
 
-void Game::spawnObstacle() {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    std::uniform_real_distribution<float> yDist(OBSTACLE_HEIGHT, 
-                                                WINDOW_HEIGHT - OBSTACLE_HEIGHT);
-    
-    float y = yDist(gen);
-    sf::Vector2f pos(WINDOW_WIDTH + OBSTACLE_WIDTH, y);
-    sf::Color color = getRandomColor();
-    
-    obstacles.push_back(std::make_unique<Obstacle>(pos, color, currentObstacleSpeed));
+void Game::setRenderScale(float scale) {
+    if (scale < MIN_RENDER_SCALE) scale = MIN_RENDER_SCALE;
+    if (scale > 1.0f) scale = 1.0f;
+    renderScale = scale;
 }
 
-void Game::spawnPowerUp() {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    std::uniform_real_distribution<float> yDist(50, WINDOW_HEIGHT - 50);
-    std::uniform_int_distribution<int> typeDist(0, 2);
+void Game::updateBeats() {
+    if (!ENABLE_BEAT_SPAWNING) return;
+    float musicTime = backgroundMusic.getPlayingOffset().asSeconds();
 
-    float y = yDist(gen);
-    sf::Vector2f pos(WINDOW_WIDTH + 30, y);
-    PowerUpType type = static_cast<PowerUpType>(typeDist(gen));
+    // Beats are found a little ahead of playback - hold them until they play
+    BeatEvent beat;
+    while (pendingBeatCount < MAX_PENDING_BEATS && beatDetector.pollBeat(beat)) {
+        pendingBeats[pendingBeatCount++] = beat;
+    }
+
+    int kept = 0;
+    for (int i = 0; i < pendingBeatCount; i++) {
+        const BeatEvent& b = pendingBeats[i];
+        if (b.time > musicTime) {
+            pendingBeats[kept++] = b;
+        } else if (musicTime - b.time <= BEAT_LATE_TOLERANCE && state == GameState::PLAYING &&
+                   tickInput.beatCount < SimInput::MAX_BEATS) {
+            tickInput.beats[tickInput.beatCount++] = b.strength;
+        }
+        // Older beats (menus, paused window) are just dropped
+    }
+    pendingBeatCount = kept;
+}
 
-    powerUps.push_back(std::make_unique<PowerUp>(pos, type, currentObstacleSpeed * 0.8f));
+Task Game::shakeEffect(float intensity) {
+    int id = ++shakeCount;
+    shakeIntensity = intensity;
+    co_await effectTimers.after(Fixed::fromFloat(SHAKE_DURATION));
+    // A newer shake keeps going
+    if (id == shakeCount) {
+        shakeIntensity = 0;
+    }
 }
 
-void Game::spawnColorWall() {
-    // Spawn a color wall obstacle in the center of the screen
-    // Player must match their color to pass through it
-    // Spawn further off-screen because color wall is wider (OBSTACLE_WIDTH * 3)
-    sf::Vector2f pos(WINDOW_WIDTH + OBSTACLE_WIDTH * 2, WINDOW_HEIGHT / 2.0f);
-    sf::Color wallColor = getRandomColor();
+void Game::startGame() {
+    state = GameState::PLAYING;
+    needsRedraw = true;
+
+    // Same seed, same inputs, same run
+    uint32_t seed = useFixedSeed ? fixedSeed : std::random_device{}();
+    sim.start(playerCount, seed);
+    stateHashes.beginRun();
+    if (leaderboard.isRunning()) {
+        replay.begin(seed, playerCount, sim.getDifficulty(), playerName, REPLAY_RESERVE_BYTES);
+    }
+    metrics.gameStarted();
+}
 
-    // Use ColorWallObstacle which inherits from Obstacle (POLYMORPHISM)
-    obstacles.push_back(std::make_unique<ColorWallObstacle>(pos, wallColor, currentObstacleSpeed * 0.7f));
+void Game::resetGame() {
+    effectTimers.reset();
+    shakeIntensity = 0;
+    cameraOffset = sf::Vector2f(0, 0);
+    particles.clear();
+    for (int p = 0; p < MAX_PLAYERS; p++) dashTrails[p] = -1;
 }
 
-void Game::checkCollisions() {
-    sf::FloatRect playerBounds = player.getBounds();
+// The simulation ended the run this tick
+void Game::gameOver() {
+    state = GameState::GAME_OVER;
+    needsRedraw = true;
+    metrics.gameFinished(sim.getScore(), sim.getRunTime());
+
+    if (leaderboard.isRunning()) {
+        replay.finish(sim.getScore(), sim.getRunTime());
+        std::vector<uint8_t> bytes;
+        replay.serialize(bytes);
+        leaderboard.submit(std::move(bytes));
+    }
+}
 
-    // Check obstacle collisions
-    for (const auto& obstacle : obstacles) {
-        if (obstacle->active() && obstacle->getBounds().intersects(playerBounds)) {
-            // NEW: Check if this is a color wall obstacle
-            if (obstacle->isColorWall()) {
-                // It's a color wall - check if player color matches
-                if (player.getColor() != obstacle->getColor()) {
-                    // Colors don't match - GAME OVER!
-                    gameOver();
-                    return;
-                }
-                // Colors match - player can pass through! (no collision)
-                // Continue to next obstacle
-            } else {
-                // Regular obstacle - always causes game over
-                gameOver();
-                return;
-            }
-        }
+void Game::updateQuality(float dt) {
+    if (!ENABLE_QUALITY_GOVERNOR) return;
 
-        // Score for passing obstacles
-        if (obstacle->active() &&
-            obstacle->getPosition().x + OBSTACLE_WIDTH/2 < player.getPosition().x &&
-            obstacle->getPosition().x + OBSTACLE_WIDTH/2 > player.getPosition().x - 10) {
+    float budgetMs = pacer.getTargetFps() > 0 ? 1000.0f / pacer.getTargetFps() : 1000.0f / FPS;
+    governor.setBudget(budgetMs);
+    governor.update(pacer.getLastWorkMs(), dt);
 
-            // Give bonus points for passing color walls
-            if (obstacle->isColorWall()) {
-                score += SCORE_COLOR_WALL_PASS;
-                particles.emit(obstacle->getPosition(), obstacle->getColor(), 30);
-                wallPassSound.play();  // Play "Bababooey" sound!
-            } else {
-                score += SCORE_PER_DODGE;
-                particles.emit(obstacle->getPosition(), obstacle->getColor(), 15);
-            }
-            combo++;
+    // Push the new knobs out only when the tier actually changed
+    if (governor.getTier() != appliedTier) {
+        appliedTier = governor.getTier();
+        QualitySettings settings = governor.getSettings();
+        particles.setDensity(settings.particleDensity);
+        for (int p = 0; p < MAX_PLAYERS; p++) {
+            sim.getPlayer(p).setTrailLength(settings.trailLength);
         }
-    }
-
-    // Check power-up collisions
-    for (auto& powerUp : powerUps) {
-        if (powerUp->active() && powerUp->getBounds().intersects(playerBounds)) {
-            score += SCORE_POWERUP;
-            particles.emit(powerUp->getPosition(), COLOR_YELLOW, 25);
-            powerUp->deactivate();
+        lightingAllowed = settings.lightingEnabled;
+        if (dynamicBloom) {
+            bloom.setQuality(static_cast<BloomQuality>(settings.bloomLevel));
+        }
+        updateGlow();
+        if (dynamicRenderScale) {
+            setRenderScale(settings.renderScale);
         }
     }
 }
 
-void Game::updateDifficulty() {
-    // Increase speed based on score (FIXED - only once per 100 points)
-    static int lastDifficultyScore = 0;
-    if (score > 0 && score >= lastDifficultyScore + 100) {
-        currentSpawnTime *= SPEED_INCREASE_RATE;
-        currentObstacleSpeed *= 1.05f;
-        
-        if (currentSpawnTime < 0.5f) currentSpawnTime = 0.5f;
-        if (currentObstacleSpeed > 600.0f) currentObstacleSpeed = 600.0f;
-        
-        lastDifficultyScore = score;
-    }
-    
-    // Reset combo if too slow (FIXED - uses actual dt)
-    static float comboTimer = 0;
-    comboTimer += 0.016f; // This should ideally use dt parameter
-    if (comboTimer > 3.0f) {
-        combo = 0;
-        comboTimer = 0;
-    }
+// The old double-drawn glow only stands in for bloom when bloom is off
+void Game::updateGlow() {
+    bool glow = governor.getSettings().glowEnabled && bloom.getQuality() == BloomQuality::OFF;
+    PowerUp::setGlowEnabled(glow);
+    ColorWallObstacle::setGlowEnabled(glow);
 }
 
 void Game::screenShake(float intensity) {
-    shakeIntensity = intensity;
-    shakeTimer = 0.3f;
-}
-
-sf::Color Game::getRandomColor() {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    std::uniform_int_distribution<int> dist(0, 5);
-    
-    sf::Color colors[] = {COLOR_RED, COLOR_BLUE, COLOR_YELLOW, 
-                         COLOR_GREEN, COLOR_PURPLE, COLOR_ORANGE};
-    return colors[dist(gen)];
+    shakeEffect(intensity);
 }
 
 void Game::createBackground() {
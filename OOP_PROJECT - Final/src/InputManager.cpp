@@ -0,0 +1,145 @@
+#include "InputManager.h"
+
+namespace {
+    const KeyBindings BINDINGS[MAX_PLAYERS] = {
+        {sf::Keyboard::W, sf::Keyboard::S, sf::Keyboard::A, sf::Keyboard::D,
+         sf::Keyboard::Space, sf::Keyboard::C},
+        {sf::Keyboard::Up, sf::Keyboard::Down, sf::Keyboard::Left, sf::Keyboard::Right,
+         sf::Keyboard::RShift, sf::Keyboard::RControl},
+        {sf::Keyboard::I, sf::Keyboard::K, sf::Keyboard::J, sf::Keyboard::L,
+         sf::Keyboard::U, sf::Keyboard::O},
+        {sf::Keyboard::Numpad8, sf::Keyboard::Numpad5, sf::Keyboard::Numpad4, sf::Keyboard::Numpad6,
+         sf::Keyboard::Numpad0, sf::Keyboard::Numpad7}
+    };
+
+    // Keys that reach a tick (move, dash, color change for any player).
+    // Only these are timed - menu and debug keys never get presented.
+    bool isGameplayKey(int code) {
+        for (const KeyBindings& keys : BINDINGS) {
+            if (code == keys.up || code == keys.down || code == keys.left || code == keys.right ||
+                code == keys.dash || code == keys.color) {
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+InputManager::InputManager() {
+    clear();
+    latencyCount = 0;
+    latencyIndex = 0;
+}
+
+void InputManager::clear() {
+    for (int i = 0; i < sf::Keyboard::KeyCount; i++) {
+        keyDown[i] = false;
+        keyTapped[i] = false;
+    }
+    for (int p = 0; p < MAX_PLAYERS; p++) {
+        dashQueued[p] = false;
+        colorQueued[p] = false;
+    }
+    queuedCount = 0;
+    sampledCount = 0;
+}
+
+void InputManager::handleEvent(const sf::Event& event, sf::Int64 now) {
+    if (event.type == sf::Event::LostFocus) {
+        clear();
+        return;
+    }
+
+    if (event.type == sf::Event::KeyPressed) {
+        int code = event.key.code;
+        if (code < 0 || code >= sf::Keyboard::KeyCount) return;
+
+        // Ignore OS key repeat - only real presses count
+        if (!keyDown[code]) {
+            keyTapped[code] = true;
+            for (int p = 0; p < MAX_PLAYERS; p++) {
+                if (code == BINDINGS[p].dash) dashQueued[p] = true;
+                if (code == BINDINGS[p].color) colorQueued[p] = true;
+            }
+            if (queuedCount < MAX_PENDING && isGameplayKey(code)) {
+                queuedStamps[queuedCount++] = now;
+            }
+        }
+        keyDown[code] = true;
+    } else if (event.type == sf::Event::KeyReleased) {
+        int code = event.key.code;
+        if (code < 0 || code >= sf::Keyboard::KeyCount) return;
+        keyDown[code] = false;
+    }
+}
+
+bool InputManager::isHeld(sf::Keyboard::Key key) const {
+    return keyDown[key] || keyTapped[key];
+}
+
+const KeyBindings& InputManager::getBindings(int player) {
+    return BINDINGS[player];
+}
+
+sf::Vector2f InputManager::readMove(const KeyBindings& keys) const {
+    sf::Vector2f move(0, 0);
+    if (isHeld(keys.up)) move.y = -1;
+    if (isHeld(keys.down)) move.y = 1;
+    if (isHeld(keys.left)) move.x = -1;
+    if (isHeld(keys.right)) move.x = 1;
+    return move;
+}
+
+void InputManager::sample(InputState* states, int count) {
+    for (int p = 0; p < count; p++) {
+        states[p].move = readMove(BINDINGS[p]);
+        states[p].dash = dashQueued[p];
+        states[p].changeColor = colorQueued[p];
+    }
+    if (count == 1) {
+        // Solo: the arrow keys work too, like before there were more players
+        sf::Vector2f arrows = readMove(BINDINGS[1]);
+        if (arrows.x != 0) states[0].move.x = arrows.x;
+        if (arrows.y != 0) states[0].move.y = arrows.y;
+    }
+
+    for (int p = 0; p < MAX_PLAYERS; p++) {
+        dashQueued[p] = false;
+        colorQueued[p] = false;
+    }
+    for (int i = 0; i < sf::Keyboard::KeyCount; i++) {
+        keyTapped[i] = false;
+    }
+
+    // These presses are now part of a tick - they become visible on the next present
+    for (int i = 0; i < queuedCount && sampledCount < MAX_PENDING; i++) {
+        sampledStamps[sampledCount++] = queuedStamps[i];
+    }
+    queuedCount = 0;
+}
+
+void InputManager::notePresented(sf::Int64 now) {
+    for (int i = 0; i < sampledCount; i++) {
+        latencies[latencyIndex] = now - sampledStamps[i];
+        latencyIndex = (latencyIndex + 1) % LATENCY_HISTORY;
+        if (latencyCount < LATENCY_HISTORY) latencyCount++;
+    }
+    sampledCount = 0;
+}
+
+float InputManager::getAverageLatencyMs() const {
+    if (latencyCount == 0) return 0;
+    sf::Int64 total = 0;
+    for (int i = 0; i < latencyCount; i++) {
+        total += latencies[i];
+    }
+    return static_cast<float>(total) / latencyCount / 1000.0f;
+}
+
+float InputManager::getMaxLatencyMs() const {
+    sf::Int64 worst = 0;
+    for (int i = 0; i < latencyCount; i++) {
+        if (latencies[i] > worst) worst = latencies[i];
+    }
+    return static_cast<float>(worst) / 1000.0f;
+}
@@ -0,0 +1,95 @@
+#include "LeaderboardClient.h"
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+LeaderboardClient::LeaderboardClient() : stopping(false), running(false), port(0) {}
+
+LeaderboardClient::~LeaderboardClient() {
+    stop();
+}
+
+void LeaderboardClient::start(unsigned short servicePort) {
+    if (running) return;
+    port = servicePort;
+    stopping = false;
+    running = true;
+    sender = std::thread(&LeaderboardClient::senderLoop, this);
+    std::cout << "Leaderboard: submitting runs to 127.0.0.1:" << port << std::endl;
+}
+
+void LeaderboardClient::stop() {
+    if (!running) return;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_one();
+    if (sender.joinable()) {
+        sender.join();
+    }
+    running = false;
+}
+
+void LeaderboardClient::submit(std::vector<uint8_t>&& replay) {
+    if (!running) return;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (pending.size() >= MAX_PENDING) pending.pop_front();
+        pending.push_back(std::move(replay));
+    }
+    wake.notify_one();
+}
+
+void LeaderboardClient::senderLoop() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        wake.wait(lock, [this]() { return stopping || !pending.empty(); });
+        // Whatever is still waiting when the game closes is sent first
+        if (pending.empty()) return;
+
+        std::vector<uint8_t> replay = std::move(pending.front());
+        pending.pop_front();
+        lock.unlock();
+        send(replay);
+        lock.lock();
+    }
+}
+
+void LeaderboardClient::send(const std::vector<uint8_t>& replay) {
+    sf::TcpSocket socket;
+    if (socket.connect(sf::IpAddress::LocalHost, port, sf::seconds(2.0f)) != sf::Socket::Done) {
+        std::cerr << "Leaderboard: service not running on 127.0.0.1:" << port << " - run not submitted" << std::endl;
+        return;
+    }
+
+    char head[256];
+    int headLength = std::snprintf(head, sizeof(head),
+                                   "POST /submit HTTP/1.0\r\nContent-Type: application/octet-stream\r\n"
+                                   "Content-Length: %zu\r\n\r\n", replay.size());
+    if (socket.send(head, headLength) != sf::Socket::Done ||
+        socket.send(replay.data(), replay.size()) != sf::Socket::Done) {
+        std::cerr << "Leaderboard: sending the run failed" << std::endl;
+        return;
+    }
+
+    // The answer is short: a status line and why
+    char answer[512];
+    size_t length = 0;
+    sf::SocketSelector selector;
+    selector.add(socket);
+    while (length < sizeof(answer) - 1 && selector.wait(sf::seconds(5.0f))) {
+        size_t received = 0;
+        if (socket.receive(answer + length, sizeof(answer) - 1 - length, received) != sf::Socket::Done) break;
+        length += received;
+    }
+    answer[length] = '\0';
+
+    const char* body = std::strstr(answer, "\r\n\r\n");
+    body = body ? body + 4 : "";
+    if (std::strncmp(answer, "HTTP/1.0 202", 12) != 0) {
+        std::cerr << "Leaderboard: run not accepted: " << body;
+        return;
+    }
+    std::cout << "Leaderboard: " << body;
+}
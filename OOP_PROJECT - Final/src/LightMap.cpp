@@ -0,0 +1,284 @@
+#include "LightMap.h"
+#include "Config.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace {
+    // Cheap stand-in for atan2: 0-4 around the circle (one unit per quadrant),
+    // growing with the angle. No trig, and easy to do four at a time.
+    float diamondAngle(float x, float y) {
+        float ax = std::fabs(x);
+        float ay = std::fabs(y);
+        float sum = ax + ay + 1e-6f;
+        if (y >= 0) return x >= 0 ? ay / sum : 1.0f + ax / sum;
+        return x < 0 ? 2.0f + ay / sum : 3.0f + ax / sum;
+    }
+
+    const float BINS_PER_UNIT = LightMap::SHADOW_BINS / 4.0f;
+}
+
+LightMap::LightMap() {
+    width = static_cast<int>(std::ceil(static_cast<float>(WINDOW_WIDTH) / LIGHT_MAP_CELL));
+    height = static_cast<int>(std::ceil(static_cast<float>(WINDOW_HEIGHT) / LIGHT_MAP_CELL));
+    stride = (width + 3) & ~3;
+
+    shadowDepth.resize(static_cast<size_t>(MAX_LIGHTS) * SHADOW_BINS);
+    red.resize(static_cast<size_t>(stride) * height);
+    green.resize(red.size());
+    blue.resize(red.size());
+    pixels.resize(static_cast<size_t>(width) * height * 4);
+
+    // Direction through the middle of each bin (inverse of diamondAngle)
+    for (int i = 0; i < SHADOW_BINS; i++) {
+        float t = (i + 0.5f) / BINS_PER_UNIT;
+        int quadrant = static_cast<int>(t);
+        float f = t - quadrant;
+        const float dirX[4] = {1 - f, -f, -(1 - f), f};
+        const float dirY[4] = {f, 1 - f, -f, -(1 - f)};
+        binDirectionX[i] = dirX[quadrant];
+        binDirectionY[i] = dirY[quadrant];
+    }
+
+    texture.create(width, height);
+    texture.setSmooth(true);    // Bilinear upscaling softens the low resolution
+    sprite.setTexture(texture);
+    sprite.setScale(LIGHT_MAP_CELL, LIGHT_MAP_CELL);
+
+    lightCount = 0;
+    occluderCount = 0;
+    lastMs = 0;
+}
+
+void LightMap::clear() {
+    lightCount = 0;
+    occluderCount = 0;
+}
+
+void LightMap::addLight(sf::Vector2f position, float radius, sf::Color color) {
+    if (lightCount >= MAX_LIGHTS || radius <= 0) return;
+    lights[lightCount++] = Light{position.x, position.y, radius,
+                                 color.r / 255.0f, color.g / 255.0f, color.b / 255.0f};
+}
+
+void LightMap::addOccluder(sf::Vector2f center, sf::Vector2f halfSize, float cosRotation, float sinRotation) {
+    if (occluderCount >= MAX_OCCLUDERS) return;
+    Occluder& o = occluders[occluderCount++];
+
+    // Corners in order around the box: (-,-) (+,-) (+,+) (-,+) in its own frame
+    const float signU[4] = {-1, 1, 1, -1};
+    const float signV[4] = {-1, -1, 1, 1};
+    for (int i = 0; i < 4; i++) {
+        float u = signU[i] * halfSize.x;
+        float v = signV[i] * halfSize.y;
+        o.cornerX[i] = center.x + u * cosRotation - v * sinRotation;
+        o.cornerY[i] = center.y + u * sinRotation + v * cosRotation;
+    }
+    o.centerX = center.x;
+    o.centerY = center.y;
+    o.boundRadius = std::sqrt(halfSize.x * halfSize.x + halfSize.y * halfSize.y);
+}
+
+void LightMap::compute(WorkerPool& pool) {
+    auto begin = std::chrono::steady_clock::now();
+
+    // Lights are dealt out round robin, then rows in bands - shading needs
+    // every shadow map, so it only starts once the first job is done
+    pool.run([this](int band, int bands) {
+        for (int l = band; l < lightCount; l += bands) {
+            buildShadows(l);
+        }
+    });
+    pool.run([this](int band, int bands) {
+        shadeRows(height * band / bands, height * (band + 1) / bands);
+    });
+
+    lastMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - begin).count();
+}
+
+void LightMap::draw(sf::RenderTarget& target) {
+    texture.update(pixels.data());
+    target.draw(sprite, sf::BlendAdd);
+}
+
+void LightMap::buildShadows(int l) {
+    const Light& light = lights[l];
+    float* depth = &shadowDepth[static_cast<size_t>(l) * SHADOW_BINS];
+
+    // Nothing in the way: lit out to the light's radius
+    std::fill(depth, depth + SHADOW_BINS, light.radius * light.radius);
+
+    for (int i = 0; i < occluderCount; i++) {
+        const Occluder& o = occluders[i];
+        float dx = o.centerX - light.x;
+        float dy = o.centerY - light.y;
+        float reach = light.radius + o.boundRadius;
+        if (dx * dx + dy * dy > reach * reach) continue;
+
+        // A light inside an occluder (e.g. a player dashing through) doesn't
+        // blank out the whole screen
+        float ex = o.cornerX[1] - o.cornerX[0];
+        float ey = o.cornerY[1] - o.cornerY[0];
+        float fx = o.cornerX[3] - o.cornerX[0];
+        float fy = o.cornerY[3] - o.cornerY[0];
+        float px = light.x - o.cornerX[0];
+        float py = light.y - o.cornerY[0];
+        float u = px * ex + py * ey;
+        float v = px * fx + py * fy;
+        if (u > 0 && u < ex * ex + ey * ey && v > 0 && v < fx * fx + fy * fy) continue;
+
+        for (int e = 0; e < 4; e++) {
+            int next = (e + 1) & 3;
+            castEdge(light, depth, o.cornerX[e], o.cornerY[e], o.cornerX[next], o.cornerY[next]);
+        }
+    }
+}
+
+// Records the edge a-b in every bin whose middle direction it covers
+void LightMap::castEdge(const Light& light, float* depth, float ax, float ay, float bx, float by) {
+    float ta = diamondAngle(ax - light.x, ay - light.y) * BINS_PER_UNIT;
+    float tb = diamondAngle(bx - light.x, by - light.y) * BINS_PER_UNIT;
+
+    // An edge never covers more than half the circle - take the short way round
+    float span = tb - ta;
+    if (span > SHADOW_BINS / 2) span -= SHADOW_BINS;
+    else if (span < -SHADOW_BINS / 2) span += SHADOW_BINS;
+    float start = span >= 0 ? ta : ta + span;
+    int first = static_cast<int>(std::ceil(start - 0.5f));
+    int last = static_cast<int>(std::floor(start + std::fabs(span) - 0.5f));
+
+    // Ray from the light along the bin direction d against the edge:
+    // light + s * d = a + u * (b - a)  ->  s = cross(a - light, b - a) / cross(d, b - a)
+    float edgeX = bx - ax;
+    float edgeY = by - ay;
+    float toEdgeX = ax - light.x;
+    float toEdgeY = ay - light.y;
+    float numerator = toEdgeX * edgeY - toEdgeY * edgeX;
+    for (int i = first; i <= last; i++) {
+        int bin = i & (SHADOW_BINS - 1);
+        float dx = binDirectionX[bin];
+        float dy = binDirectionY[bin];
+        float denominator = dx * edgeY - dy * edgeX;
+        if (std::fabs(denominator) < 1e-6f) continue;
+        float s = numerator / denominator;
+        if (s <= 0) continue;
+        float distanceSquared = s * s * (dx * dx + dy * dy);
+        if (distanceSquared < depth[bin]) depth[bin] = distanceSquared;
+    }
+}
+
+void LightMap::shadeRows(int firstRow, int lastRow) {
+    size_t begin = static_cast<size_t>(firstRow) * stride;
+    size_t end = static_cast<size_t>(lastRow) * stride;
+    std::fill(red.begin() + begin, red.begin() + end, 0.0f);
+    std::fill(green.begin() + begin, green.begin() + end, 0.0f);
+    std::fill(blue.begin() + begin, blue.begin() + end, 0.0f);
+
+    for (int l = 0; l < lightCount; l++) {
+        const Light& light = lights[l];
+        int top = std::max(firstRow, static_cast<int>((light.y - light.radius) / LIGHT_MAP_CELL));
+        int bottom = std::min(lastRow - 1, static_cast<int>((light.y + light.radius) / LIGHT_MAP_CELL));
+        int left = std::max(0, static_cast<int>((light.x - light.radius) / LIGHT_MAP_CELL));
+        int right = std::min(width - 1, static_cast<int>((light.x + light.radius) / LIGHT_MAP_CELL));
+        if (left > right) continue;
+
+        const float* depth = &shadowDepth[static_cast<size_t>(l) * SHADOW_BINS];
+        for (int row = top; row <= bottom; row++) {
+            shadeSpan(light, depth, row, left, right);
+        }
+    }
+
+    // To 8 bit for the texture
+    const float scale = 255.0f * LIGHT_INTENSITY;
+    for (int row = firstRow; row < lastRow; row++) {
+        const float* r = &red[static_cast<size_t>(row) * stride];
+        const float* g = &green[static_cast<size_t>(row) * stride];
+        const float* b = &blue[static_cast<size_t>(row) * stride];
+        uint8_t* out = &pixels[static_cast<size_t>(row) * width * 4];
+        for (int x = 0; x < width; x++) {
+            out[x * 4 + 0] = static_cast<uint8_t>(std::min(255.0f, r[x] * scale));
+            out[x * 4 + 1] = static_cast<uint8_t>(std::min(255.0f, g[x] * scale));
+            out[x * 4 + 2] = static_cast<uint8_t>(std::min(255.0f, b[x] * scale));
+            out[x * 4 + 3] = 255;
+        }
+    }
+}
+
+// One light into cells firstCell..lastCell of a row: quadratic falloff,
+// zeroed where the cell lies behind the nearest occluder in its direction
+void LightMap::shadeSpan(const Light& light, const float* depth, int row, int firstCell, int lastCell) {
+    float inverseRadiusSquared = 1.0f / (light.radius * light.radius);
+    float py = (row + 0.5f) * LIGHT_MAP_CELL - light.y;
+    float ay = std::fabs(py);
+    float* r = &red[static_cast<size_t>(row) * stride];
+    float* g = &green[static_cast<size_t>(row) * stride];
+    float* b = &blue[static_cast<size_t>(row) * stride];
+
+    // Starts on a multiple of 4; the row stride leaves room for the last group
+    int cell = firstCell & ~3;
+
+#ifdef __SSE2__
+    // diamondAngle with the row's (fixed) sign of y already decided
+    bool below = py >= 0;
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 signBit = _mm_set1_ps(-0.0f);
+    const __m128 cellSize = _mm_set1_ps(LIGHT_MAP_CELL);
+    const __m128 offsets = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+    const __m128 lightX = _mm_set1_ps(light.x);
+    const __m128 pySquared = _mm_set1_ps(py * py);
+    const __m128 rowAy = _mm_set1_ps(ay);
+    const __m128 inverseR2 = _mm_set1_ps(inverseRadiusSquared);
+    const __m128 negativeBase = _mm_set1_ps(below ? 1.0f : 2.0f);
+    const __m128 positiveBase = _mm_set1_ps(below ? 0.0f : 3.0f);
+    const __m128 binScale = _mm_set1_ps(BINS_PER_UNIT);
+    const __m128i binMask = _mm_set1_epi32(SHADOW_BINS - 1);
+    const __m128 lightR = _mm_set1_ps(light.red);
+    const __m128 lightG = _mm_set1_ps(light.green);
+    const __m128 lightB = _mm_set1_ps(light.blue);
+    alignas(16) int32_t bins[4];
+
+    for (; cell <= lastCell; cell += 4) {
+        __m128 px = _mm_sub_ps(_mm_mul_ps(_mm_add_ps(_mm_set1_ps(static_cast<float>(cell)), offsets), cellSize), lightX);
+        __m128 distanceSquared = _mm_add_ps(_mm_mul_ps(px, px), pySquared);
+        __m128 falloff = _mm_max_ps(zero, _mm_sub_ps(one, _mm_mul_ps(distanceSquared, inverseR2)));
+        if (_mm_movemask_ps(_mm_cmpgt_ps(falloff, zero)) == 0) continue;
+        falloff = _mm_mul_ps(falloff, falloff);
+
+        __m128 ax = _mm_andnot_ps(signBit, px);
+        __m128 inverseSum = _mm_div_ps(one, _mm_add_ps(_mm_add_ps(ax, rowAy), _mm_set1_ps(1e-6f)));
+        __m128 negativeT = _mm_add_ps(negativeBase, _mm_mul_ps(below ? ax : rowAy, inverseSum));
+        __m128 positiveT = _mm_add_ps(positiveBase, _mm_mul_ps(below ? rowAy : ax, inverseSum));
+        __m128 leftOfLight = _mm_cmplt_ps(px, zero);
+        __m128 t = _mm_or_ps(_mm_and_ps(leftOfLight, negativeT), _mm_andnot_ps(leftOfLight, positiveT));
+        _mm_store_si128(reinterpret_cast<__m128i*>(bins),
+                        _mm_and_si128(_mm_cvttps_epi32(_mm_mul_ps(t, binScale)), binMask));
+
+        __m128 occluder = _mm_setr_ps(depth[bins[0]], depth[bins[1]], depth[bins[2]], depth[bins[3]]);
+        __m128 intensity = _mm_and_ps(falloff, _mm_cmplt_ps(distanceSquared, occluder));
+
+        _mm_storeu_ps(r + cell, _mm_add_ps(_mm_loadu_ps(r + cell), _mm_mul_ps(intensity, lightR)));
+        _mm_storeu_ps(g + cell, _mm_add_ps(_mm_loadu_ps(g + cell), _mm_mul_ps(intensity, lightG)));
+        _mm_storeu_ps(b + cell, _mm_add_ps(_mm_loadu_ps(b + cell), _mm_mul_ps(intensity, lightB)));
+    }
+#else
+    for (; cell <= lastCell; cell++) {
+        float px = (cell + 0.5f) * LIGHT_MAP_CELL - light.x;
+        float distanceSquared = px * px + py * py;
+        float falloff = 1.0f - distanceSquared * inverseRadiusSquared;
+        if (falloff <= 0) continue;
+
+        int bin = static_cast<int>(diamondAngle(px, py) * BINS_PER_UNIT) & (SHADOW_BINS - 1);
+        if (distanceSquared >= depth[bin]) continue;
+
+        float intensity = falloff * falloff;
+        r[cell] += intensity * light.red;
+        g[cell] += intensity * light.green;
+        b[cell] += intensity * light.blue;
+    }
+    (void)ay;
+#endif
+}
@@ -0,0 +1,262 @@
+#include "MetricsExporter.h"
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+    // Upper bounds; the last bucket of each histogram is +Inf
+    const double FRAME_BOUNDS[MetricsExporter::FRAME_BUCKETS - 1] = {
+        0.004, 0.008, 0.0125, 0.0167, 0.025, 0.0334, 0.05, 0.1, 0.25
+    };
+    const double SCORE_BOUNDS[MetricsExporter::SCORE_BUCKETS - 1] = {
+        100, 250, 500, 1000, 2500, 5000, 10000
+    };
+    const double DURATION_BOUNDS[MetricsExporter::DURATION_BUCKETS - 1] = {
+        10, 30, 60, 120, 300, 600
+    };
+
+    int64_t nowMicros() {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    template <int N>
+    int bucketOf(const double (&bounds)[N], double value) {
+        int i = 0;
+        while (i < N && value > bounds[i]) i++;
+        return i;
+    }
+
+    // Resident memory of the whole process (0 if the platform won't say)
+    uint64_t residentBytes() {
+#ifdef _WIN32
+        PROCESS_MEMORY_COUNTERS counters;
+        if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+            return counters.WorkingSetSize;
+        }
+        return 0;
+#else
+        unsigned long pages = 0;
+        unsigned long resident = 0;
+        FILE* f = std::fopen("/proc/self/statm", "r");
+        if (!f) return 0;
+        int read = std::fscanf(f, "%lu %lu", &pages, &resident);
+        std::fclose(f);
+        return read == 2 ? static_cast<uint64_t>(resident) * sysconf(_SC_PAGESIZE) : 0;
+#endif
+    }
+
+    void appendf(std::string& out, const char* format, ...) {
+        char line[512];
+        va_list args;
+        va_start(args, format);
+        int length = std::vsnprintf(line, sizeof(line), format, args);
+        va_end(args);
+        if (length > 0) out.append(line, length < static_cast<int>(sizeof(line)) ? length : sizeof(line) - 1);
+    }
+
+    void appendMetric(std::string& out, const char* name, const char* type, const char* help, double value) {
+        appendf(out, "# HELP %s %s\n# TYPE %s %s\n%s %.17g\n", name, help, name, type, name, value);
+    }
+
+    template <int N>
+    void appendHistogram(std::string& out, const char* name, const char* help, const double (&bounds)[N],
+                         const std::atomic<uint64_t>* buckets, double sum) {
+        appendf(out, "# HELP %s %s\n# TYPE %s histogram\n", name, help, name);
+        uint64_t cumulative = 0;
+        for (int i = 0; i <= N; i++) {
+            cumulative += buckets[i].load(std::memory_order_relaxed);
+            if (i < N) {
+                appendf(out, "%s_bucket{le=\"%g\"} %llu\n", name, bounds[i], static_cast<unsigned long long>(cumulative));
+            } else {
+                appendf(out, "%s_bucket{le=\"+Inf\"} %llu\n", name, static_cast<unsigned long long>(cumulative));
+            }
+        }
+        appendf(out, "%s_sum %.17g\n%s_count %llu\n", name, sum, name, static_cast<unsigned long long>(cumulative));
+    }
+}
+
+MetricsExporter::MetricsExporter() : running(false) {
+    for (auto& b : frameBuckets) b = 0;
+    for (auto& b : scoreBuckets) b = 0;
+    for (auto& b : durationBuckets) b = 0;
+    frameMicros = 0;
+    particles = 0;
+    obstacles = 0;
+    powerUps = 0;
+    bullets = 0;
+    voicesPlaying = 0;
+    voices = 0;
+    allocations = 0;
+    allocatedBytes = 0;
+    arenaPeak = 0;
+    uiTextUpdates = 0;
+    gamesStarted = 0;
+    scoreSum = 0;
+    durationMillis = 0;
+    currentScore = 0;
+    bestScore = 0;
+    playing = false;
+    startTime = nowMicros();
+}
+
+MetricsExporter::~MetricsExporter() {
+    stop();
+}
+
+bool MetricsExporter::start(unsigned short port) {
+    if (running) return true;
+    if (listener.listen(port, sf::IpAddress::LocalHost) != sf::Socket::Done) {
+        std::cerr << "Metrics: cannot listen on 127.0.0.1:" << port << std::endl;
+        return false;
+    }
+    page.reserve(16 * 1024);
+    running = true;
+    server = std::thread(&MetricsExporter::serverLoop, this);
+    std::cout << "Metrics: http://127.0.0.1:" << port << "/metrics" << std::endl;
+    return true;
+}
+
+void MetricsExporter::stop() {
+    if (!running) return;
+    running = false;
+    if (server.joinable()) {
+        server.join();
+    }
+    listener.close();
+}
+
+void MetricsExporter::recordFrame(float seconds) {
+    frameBuckets[bucketOf(FRAME_BOUNDS, seconds)].fetch_add(1, std::memory_order_relaxed);
+    frameMicros.fetch_add(static_cast<uint64_t>(seconds * 1e6f), std::memory_order_relaxed);
+}
+
+void MetricsExporter::addAllocations(uint64_t count, uint64_t bytes, size_t framePeak) {
+    allocations.fetch_add(count, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(bytes, std::memory_order_relaxed);
+    if (framePeak > arenaPeak.load(std::memory_order_relaxed)) {
+        arenaPeak.store(framePeak, std::memory_order_relaxed);
+    }
+}
+
+void MetricsExporter::gameStarted() {
+    gamesStarted.fetch_add(1, std::memory_order_relaxed);
+    currentScore.store(0, std::memory_order_relaxed);
+    playing.store(true, std::memory_order_relaxed);
+}
+
+void MetricsExporter::gameFinished(int score, float seconds) {
+    scoreBuckets[bucketOf(SCORE_BOUNDS, score)].fetch_add(1, std::memory_order_relaxed);
+    scoreSum.fetch_add(static_cast<uint64_t>(score > 0 ? score : 0), std::memory_order_relaxed);
+    durationBuckets[bucketOf(DURATION_BOUNDS, seconds)].fetch_add(1, std::memory_order_relaxed);
+    durationMillis.fetch_add(static_cast<uint64_t>(seconds * 1000.0f), std::memory_order_relaxed);
+    if (score > bestScore.load(std::memory_order_relaxed)) {
+        bestScore.store(score, std::memory_order_relaxed);
+    }
+    playing.store(false, std::memory_order_relaxed);
+}
+
+void MetricsExporter::serverLoop() {
+    // The selector wakes up now and then so stop() doesn't wait on a scrape
+    sf::SocketSelector selector;
+    selector.add(listener);
+    while (running.load(std::memory_order_relaxed)) {
+        if (!selector.wait(sf::milliseconds(250))) continue;
+        sf::TcpSocket client;
+        if (listener.accept(client) == sf::Socket::Done) {
+            answer(client);
+        }
+    }
+}
+
+void MetricsExporter::answer(sf::TcpSocket& client) {
+    // Read the request head (give up after a second - nobody can stall us)
+    char request[2048];
+    size_t length = 0;
+    sf::SocketSelector selector;
+    selector.add(client);
+    while (length < sizeof(request) - 1) {
+        if (!selector.wait(sf::seconds(1.0f))) return;
+        size_t received = 0;
+        if (client.receive(request + length, sizeof(request) - 1 - length, received) != sf::Socket::Done) return;
+        length += received;
+        request[length] = '\0';
+        if (std::strstr(request, "\r\n\r\n") || std::strstr(request, "\n\n")) break;
+    }
+    request[length] = '\0';
+
+    const char* status = "200 OK";
+    bool found = std::strncmp(request, "GET /metrics ", 13) == 0 || std::strncmp(request, "GET / ", 6) == 0;
+    if (found) {
+        buildPage();
+    } else {
+        status = "404 Not Found";
+        page = "Try /metrics\n";
+    }
+
+    char head[256];
+    int headLength = std::snprintf(head, sizeof(head),
+                                   "HTTP/1.0 %s\r\nContent-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+                                   "Content-Length: %zu\r\nConnection: close\r\n\r\n", status, page.size());
+    if (client.send(head, headLength) == sf::Socket::Done) {
+        client.send(page.data(), page.size());
+    }
+    client.disconnect();
+}
+
+void MetricsExporter::buildPage() {
+    page.clear();
+
+    appendHistogram(page, "colorswap_frame_seconds", "Time between frames.", FRAME_BOUNDS, frameBuckets,
+                    frameMicros.load(std::memory_order_relaxed) / 1e6);
+
+    appendMetric(page, "colorswap_particles", "gauge", "Live particles.", particles.load(std::memory_order_relaxed));
+    appendMetric(page, "colorswap_obstacles", "gauge", "Active obstacles and color walls.",
+                 obstacles.load(std::memory_order_relaxed));
+    appendMetric(page, "colorswap_powerups", "gauge", "Active power-ups.", powerUps.load(std::memory_order_relaxed));
+    appendMetric(page, "colorswap_bullets", "gauge", "Live pattern bullets.", bullets.load(std::memory_order_relaxed));
+
+    appendMetric(page, "colorswap_audio_voices_playing", "gauge", "Sound effect and music voices playing.",
+                 voicesPlaying.load(std::memory_order_relaxed));
+    appendMetric(page, "colorswap_audio_voices", "gauge", "Sound effect and music voices available.",
+                 voices.load(std::memory_order_relaxed));
+
+    appendMetric(page, "colorswap_allocations_total", "counter", "Heap allocations made by the process.",
+                 static_cast<double>(allocations.load(std::memory_order_relaxed)));
+    appendMetric(page, "colorswap_allocated_bytes_total", "counter", "Bytes requested from the heap.",
+                 static_cast<double>(allocatedBytes.load(std::memory_order_relaxed)));
+    appendMetric(page, "colorswap_frame_arena_peak_bytes", "gauge", "Most per-frame arena memory used in one frame.",
+                 static_cast<double>(arenaPeak.load(std::memory_order_relaxed)));
+    appendMetric(page, "process_resident_memory_bytes", "gauge", "Resident memory size in bytes.",
+                 static_cast<double>(residentBytes()));
+
+    appendMetric(page, "colorswap_ui_text_updates_total", "counter", "HUD texts rebuilt.",
+                 static_cast<double>(uiTextUpdates.load(std::memory_order_relaxed)));
+
+    appendMetric(page, "colorswap_games_started_total", "counter", "Runs started.",
+                 static_cast<double>(gamesStarted.load(std::memory_order_relaxed)));
+    appendHistogram(page, "colorswap_game_score", "Final score of finished runs.", SCORE_BOUNDS, scoreBuckets,
+                    static_cast<double>(scoreSum.load(std::memory_order_relaxed)));
+    appendHistogram(page, "colorswap_game_duration_seconds", "Length of finished runs.", DURATION_BOUNDS,
+                    durationBuckets, durationMillis.load(std::memory_order_relaxed) / 1000.0);
+    appendMetric(page, "colorswap_playing", "gauge", "1 while a run is in progress.",
+                 playing.load(std::memory_order_relaxed) ? 1 : 0);
+    appendMetric(page, "colorswap_score", "gauge", "Score of the current (or last) run.",
+                 currentScore.load(std::memory_order_relaxed));
+    appendMetric(page, "colorswap_best_score", "gauge", "Best score since start.",
+                 bestScore.load(std::memory_order_relaxed));
+
+    appendMetric(page, "colorswap_uptime_seconds", "gauge", "Seconds since the game started.",
+                 (nowMicros() - startTime) / 1e6);
+}
@@ -0,0 +1,83 @@
+#include "MusicStream.h"
+
+namespace {
+    const float CHUNK_SECONDS = 0.1f;  // Small chunks keep the detector close to playback
+}
+
+MusicStream::MusicStream() {
+    channels = 0;
+    detector = nullptr;
+    pendingCount = 0;
+    framePosition = 0;
+}
+
+MusicStream::~MusicStream() {
+    // Stop the audio thread before this object (and the tap) goes away
+    stop();
+}
+
+bool MusicStream::openFromFile(const std::string& path, BeatDetector* beatDetector) {
+    stop();
+    if (!file.openFromFile(path)) return false;
+
+    channels = file.getChannelCount();
+    detector = beatDetector;
+    pendingCount = 0;
+    framePosition = 0;
+
+    std::size_t chunkFrames = static_cast<std::size_t>(file.getSampleRate() * CHUNK_SECONDS);
+    samples.resize(chunkFrames * channels);
+    initialize(channels, file.getSampleRate());
+    return true;
+}
+
+uint64_t MusicStream::getTrackFrames() const {
+    return channels > 0 ? file.getSampleCount() / channels : 0;
+}
+
+bool MusicStream::onGetData(Chunk& data) {
+    std::size_t wanted = samples.size();
+    std::size_t read = static_cast<std::size_t>(file.read(samples.data(), wanted));
+
+    // Reached the end - wrap around so the stream (and its clock) never restarts
+    if (read < wanted) {
+        file.seek(static_cast<sf::Uint64>(0));
+        read += static_cast<std::size_t>(file.read(samples.data() + read, wanted - read));
+    }
+
+    tap(samples.data(), read);
+
+    data.samples = samples.data();
+    data.sampleCount = read;
+    return read > 0;
+}
+
+void MusicStream::onSeek(sf::Time timeOffset) {
+    file.seek(timeOffset);
+    framePosition = static_cast<uint64_t>(timeOffset.asMicroseconds()) * getSampleRate() / 1000000;
+    pendingCount = 0;
+}
+
+void MusicStream::tap(const sf::Int16* data, std::size_t count) {
+    if (!detector || channels == 0) return;
+
+    std::size_t frames = count / channels;
+    for (std::size_t f = 0; f < frames; f++) {
+        // Mix down to mono
+        int sum = 0;
+        for (unsigned c = 0; c < channels; c++) {
+            sum += data[f * channels + c];
+        }
+
+        if (pendingCount == 0) {
+            pending.startFrame = framePosition;
+        }
+        pending.samples[pendingCount++] = sum / (32768.0f * channels);
+        framePosition++;
+
+        if (pendingCount == AudioBlock::SIZE) {
+            detector->pushBlock(pending);
+            pendingCount = 0;
+        }
+    }
+}
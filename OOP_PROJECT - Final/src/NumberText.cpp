@@ -0,0 +1,54 @@
+#include "NumberText.h"
+#include <cstdio>
+#include <cstring>
+
+NumberText::NumberText() : labelLength(0), centered(false), rebuilds(0) {
+    buffer[0] = '\0';
+}
+
+void NumberText::setup(const FontAtlas& font, FontStyle style, const char* label,
+                       sf::Color fill, sf::Color outline) {
+    text.setFont(font, style);
+    text.setFillColor(fill);
+    text.setOutlineColor(outline);
+
+    labelLength = 0;
+    for (; labelLength < MAX_LABEL && label[labelLength] != '\0'; labelLength++) {
+        buffer[labelLength] = label[labelLength];
+    }
+    buffer[labelLength] = '\0';
+    rebuild();
+}
+
+void NumberText::rebuild() {
+    rebuilds++;
+    text.setString(buffer);
+    if (centered) {
+        sf::FloatRect bounds = text.getLocalBounds();
+        text.setOrigin(bounds.width / 2, bounds.height / 2);
+    }
+}
+
+void NumberText::setCentered(bool c) {
+    centered = c;
+    if (!centered) text.setOrigin(0, 0);
+    rebuild();
+}
+
+void NumberText::setValue(const char* value) {
+    char* end = buffer + labelLength;
+    if (std::strncmp(end, value, MAX_LENGTH) == 0) return;
+
+    int i = 0;
+    for (; i < MAX_LENGTH && value[i] != '\0'; i++) {
+        end[i] = value[i];
+    }
+    end[i] = '\0';
+    rebuild();
+}
+
+void NumberText::setValue(int number) {
+    char value[MAX_LENGTH + 1];
+    std::snprintf(value, sizeof(value), "%d", number);
+    setValue(value);
+}
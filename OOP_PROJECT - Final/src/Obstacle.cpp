@@ -1,38 +1,75 @@
 #include "Obstacle.h"
+#include "StateHash.h"
 
-Obstacle::Obstacle(sf::Vector2f startPos, sf::Color col, float speed) {
-    position = startPos;
-    color = col;
-    isActive = true;
-    rotation = 0;
-    rotationSpeed = 180.0f;
+Obstacle::Obstacle(FixedVec2 startPos, sf::Color col, Fixed speed) {
+    rotationSpeed = Fixed(180);
     
     shape.setSize(sf::Vector2f(OBSTACLE_WIDTH, OBSTACLE_HEIGHT));
     shape.setOrigin(OBSTACLE_WIDTH / 2, OBSTACLE_HEIGHT / 2);
-    shape.setFillColor(color);
     shape.setOutlineThickness(2.0f);
     shape.setOutlineColor(sf::Color::White);
-    
-    velocity = sf::Vector2f(-speed, 0);
+
+    halfSize = FixedVec2(Fixed::fromFloat(OBSTACLE_WIDTH / 2 + 2.0f), Fixed::fromFloat(OBSTACLE_HEIGHT / 2 + 2.0f));
+
+    Obstacle::reset(startPos, col, speed);
 }
 
-void Obstacle::update(float dt) {
+void Obstacle::reset(FixedVec2 startPos, sf::Color col, Fixed speed) {
+    position = startPos;
+    color = col;
+    isActive = true;
+    rotation = Fixed();
+    cosRotation = Fixed(1);
+    sinRotation = Fixed();
+    previousPosition = position;
+    previousCos = cosRotation;
+    previousSin = sinRotation;
+
+    shape.setFillColor(color);
+    shape.setPosition(position.toVector2f());
+    shape.setRotation(0);
+
+    velocity = FixedVec2(-speed, Fixed());
+}
+
+void Obstacle::update(Fixed dt) {
     if (!isActive) return;
-    
+
+    previousPosition = position;
+    previousCos = cosRotation;
+    previousSin = sinRotation;
     position += velocity * dt;
     rotation += rotationSpeed * dt;
+    if (rotation >= Fixed(360)) rotation -= Fixed(360);
+
+    // Compute sin/cos once per tick instead of going through sf::Transform
+    if (rotationSpeed != Fixed()) {
+        cosRotation = Fixed::cosDeg(rotation);
+        sinRotation = Fixed::sinDeg(rotation);
+    }
     
-    shape.setPosition(position);
-    shape.setRotation(rotation);
+    shape.setPosition(position.toVector2f());
+    shape.setRotation(rotation.toFloat());
     
     // Deactivate if off screen
-    if (position.x < -OBSTACLE_WIDTH) {
+    if (position.x < -Fixed::fromFloat(OBSTACLE_WIDTH)) {
         isActive = false;
     }
 }
 
-void Obstacle::draw(sf::RenderWindow& window) {
+void Obstacle::hashState(StateHash::Stream& stream) const {
+    stream.add(isColorWall());
+    stream.add(isActive);
+    stream.add(position);
+    stream.add(velocity);
+    stream.add(rotation);
+    stream.add(rotationSpeed);
+    stream.add(halfSize);
+    stream.add(color.toInteger());
+}
+
+void Obstacle::draw(sf::RenderTarget& target) {
     if (isActive) {
-        window.draw(shape);
+        target.draw(shape);
     }
 }
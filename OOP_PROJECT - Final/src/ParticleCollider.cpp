@@ -0,0 +1,218 @@
+#include "ParticleCollider.h"
+#include "ParticleSystem.h"
+#include "Config.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+ParticleCollider::ParticleCollider() {
+    columns = static_cast<int>(std::ceil(WINDOW_WIDTH / PARTICLE_CELL_SIZE));
+    rows = static_cast<int>(std::ceil(WINDOW_HEIGHT / PARTICLE_CELL_SIZE));
+    inverseCellSize = 1.0f / PARTICLE_CELL_SIZE;
+
+    int cells = columns * rows;
+    cellBoxStart.resize(cells + 1);
+    cellParticleStart.resize(cells + 1);
+    boxes.reserve(256);
+    cellBoxes.reserve(4096);
+    particleCell.reserve(MAX_PARTICLES);
+    sortedParticles.reserve(MAX_PARTICLES);
+
+    deflectorCount = 0;
+    lastMs = 0;
+    lastTests = 0;
+}
+
+void ParticleCollider::clear() {
+    boxes.clear();
+    deflectorCount = 0;
+}
+
+void ParticleCollider::addBox(sf::Vector2f center, sf::Vector2f halfSize, float cosRotation, float sinRotation,
+                              sf::Vector2f velocity, ParticleResponse response) {
+    // Cell indices are 16 bit
+    if (boxes.size() >= 0xFFFF) return;
+    boxes.push_back(Box{center.x, center.y, halfSize.x, halfSize.y, cosRotation, sinRotation,
+                        velocity.x, velocity.y, response});
+}
+
+void ParticleCollider::addDeflector(sf::Vector2f center, float radius) {
+    if (deflectorCount < MAX_DEFLECTORS) {
+        deflectors[deflectorCount++] = Deflector{center.x, center.y, radius};
+    }
+}
+
+int ParticleCollider::cellIndex(float x, float y) const {
+    int cx = static_cast<int>(x * inverseCellSize);
+    int cy = static_cast<int>(y * inverseCellSize);
+    cx = std::max(0, std::min(columns - 1, cx));
+    cy = std::max(0, std::min(rows - 1, cy));
+    return cy * columns + cx;
+}
+
+void ParticleCollider::build() {
+    // Counting sort of the boxes into every cell their bounding box touches:
+    // count, prefix sum, then fill
+    int cells = columns * rows;
+    std::fill(cellBoxStart.begin(), cellBoxStart.end(), 0);
+
+    auto forEachCell = [this](const Box& b, auto&& visit) {
+        float ac = std::fabs(b.cosA);
+        float as = std::fabs(b.sinA);
+        float extentX = ac * b.halfW + as * b.halfH;
+        float extentY = as * b.halfW + ac * b.halfH;
+        if (b.centerX + extentX < 0 || b.centerX - extentX >= WINDOW_WIDTH ||
+            b.centerY + extentY < 0 || b.centerY - extentY >= WINDOW_HEIGHT) return;
+
+        int x0 = std::max(0, static_cast<int>((b.centerX - extentX) * inverseCellSize));
+        int x1 = std::min(columns - 1, static_cast<int>((b.centerX + extentX) * inverseCellSize));
+        int y0 = std::max(0, static_cast<int>((b.centerY - extentY) * inverseCellSize));
+        int y1 = std::min(rows - 1, static_cast<int>((b.centerY + extentY) * inverseCellSize));
+        for (int y = y0; y <= y1; y++) {
+            for (int x = x0; x <= x1; x++) {
+                visit(y * columns + x);
+            }
+        }
+    };
+
+    for (const Box& b : boxes) {
+        forEachCell(b, [this](int cell) { cellBoxStart[cell + 1]++; });
+    }
+    for (int c = 0; c < cells; c++) {
+        cellBoxStart[c + 1] += cellBoxStart[c];
+    }
+    cellBoxes.resize(cellBoxStart[cells]);
+
+    // Fill using the start offsets as cursors, then shift them back
+    for (size_t i = 0; i < boxes.size(); i++) {
+        uint16_t index = static_cast<uint16_t>(i);
+        forEachCell(boxes[i], [this, index](int cell) { cellBoxes[cellBoxStart[cell]++] = index; });
+    }
+    for (int c = cells; c > 0; c--) {
+        cellBoxStart[c] = cellBoxStart[c - 1];
+    }
+    cellBoxStart[0] = 0;
+}
+
+void ParticleCollider::resolve(Particle* particles, size_t count, float dt) {
+    auto begin = std::chrono::steady_clock::now();
+    lastTests = 0;
+    int cells = columns * rows;
+
+    // Screen edges and the players apply to everyone; this pass also finds each particle's cell
+    particleCell.resize(count);
+    std::fill(cellParticleStart.begin(), cellParticleStart.end(), 0);
+    for (size_t i = 0; i < count; i++) {
+        Particle& p = particles[i];
+
+        if (p.position.x < 0) {
+            p.position.x = -p.position.x;
+            p.velocity.x = std::fabs(p.velocity.x) * PARTICLE_BOUNCE;
+        } else if (p.position.x > WINDOW_WIDTH) {
+            p.position.x = 2.0f * WINDOW_WIDTH - p.position.x;
+            p.velocity.x = -std::fabs(p.velocity.x) * PARTICLE_BOUNCE;
+        }
+        if (p.position.y < 0) {
+            p.position.y = -p.position.y;
+            p.velocity.y = std::fabs(p.velocity.y) * PARTICLE_BOUNCE;
+        } else if (p.position.y > WINDOW_HEIGHT) {
+            p.position.y = 2.0f * WINDOW_HEIGHT - p.position.y;
+            p.velocity.y = -std::fabs(p.velocity.y) * PARTICLE_BOUNCE;
+        }
+
+        // Players push particles aside, harder the closer they get
+        for (int d = 0; d < deflectorCount; d++) {
+            float dx = p.position.x - deflectors[d].x;
+            float dy = p.position.y - deflectors[d].y;
+            float distanceSquared = dx * dx + dy * dy;
+            float r = deflectors[d].radius;
+            if (distanceSquared < r * r && distanceSquared > 0.01f) {
+                float distance = std::sqrt(distanceSquared);
+                float push = (r - distance) / distance * PARTICLE_DEFLECT_STRENGTH * dt;
+                p.velocity.x += dx * push;
+                p.velocity.y += dy * push;
+            }
+        }
+
+        uint32_t cell = static_cast<uint32_t>(cellIndex(p.position.x, p.position.y));
+        particleCell[i] = cell;
+        cellParticleStart[cell + 1]++;
+    }
+
+    if (!boxes.empty()) {
+        // Sort the particle indices by cell so each cell's batch is contiguous
+        for (int c = 0; c < cells; c++) {
+            cellParticleStart[c + 1] += cellParticleStart[c];
+        }
+        sortedParticles.resize(count);
+        for (size_t i = 0; i < count; i++) {
+            sortedParticles[cellParticleStart[particleCell[i]]++] = static_cast<uint32_t>(i);
+        }
+        for (int c = cells; c > 0; c--) {
+            cellParticleStart[c] = cellParticleStart[c - 1];
+        }
+        cellParticleStart[0] = 0;
+
+        for (int c = 0; c < cells; c++) {
+            if (cellBoxStart[c] != cellBoxStart[c + 1] && cellParticleStart[c] != cellParticleStart[c + 1]) {
+                collideCell(particles, c);
+            }
+        }
+    }
+
+    lastMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - begin).count();
+}
+
+void ParticleCollider::collideCell(Particle* particles, int cell) {
+    uint32_t firstBox = cellBoxStart[cell];
+    uint32_t lastBox = cellBoxStart[cell + 1];
+    lastTests += static_cast<size_t>(lastBox - firstBox) * (cellParticleStart[cell + 1] - cellParticleStart[cell]);
+
+    for (uint32_t k = cellParticleStart[cell]; k < cellParticleStart[cell + 1]; k++) {
+        Particle& p = particles[sortedParticles[k]];
+
+        for (uint32_t j = firstBox; j < lastBox; j++) {
+            const Box& b = boxes[cellBoxes[j]];
+
+            // Into the box's own frame
+            float dx = p.position.x - b.centerX;
+            float dy = p.position.y - b.centerY;
+            float u = dx * b.cosA + dy * b.sinA;
+            float v = -dx * b.sinA + dy * b.cosA;
+            float penetrationU = b.halfW - std::fabs(u);
+            float penetrationV = b.halfH - std::fabs(v);
+            if (penetrationU <= 0 || penetrationV <= 0) continue;
+
+            if (b.response == ParticleResponse::STICK) {
+                p.velocity.x = b.velocityX;
+                p.velocity.y = b.velocityY;
+                continue;
+            }
+
+            // Out through the nearest face, reflecting the velocity relative to the box
+            float nx, ny, depth;
+            if (penetrationU < penetrationV) {
+                float side = u < 0 ? -1.0f : 1.0f;
+                nx = b.cosA * side;
+                ny = b.sinA * side;
+                depth = penetrationU;
+            } else {
+                float side = v < 0 ? -1.0f : 1.0f;
+                nx = -b.sinA * side;
+                ny = b.cosA * side;
+                depth = penetrationV;
+            }
+            p.position.x += nx * depth;
+            p.position.y += ny * depth;
+
+            float relativeX = p.velocity.x - b.velocityX;
+            float relativeY = p.velocity.y - b.velocityY;
+            float approach = relativeX * nx + relativeY * ny;
+            if (approach < 0) {
+                float impulse = -(1.0f + PARTICLE_BOUNCE) * approach;
+                p.velocity.x += nx * impulse;
+                p.velocity.y += ny * impulse;
+            }
+        }
+    }
+}
@@ -1,85 +1,440 @@
 #include "ParticleSystem.h"
+#include "Config.h"
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace {
+    const unsigned DOT_TEXTURE_SIZE = 32;
+    const size_t MAX_EMITTERS = 256;        // Particles store the emitter in a byte
+    const int QUARTER_TURN = ParticleSystem::TRIG_TABLE_SIZE / 4;
+    const int ANGLE_MASK = ParticleSystem::TRIG_TABLE_SIZE - 1;
+    const float TWO_PI = 6.28318531f;
+
+    // A color curve key: how much of the emitted color, plus a fixed color
+    // already scaled by the rest (so keys blend linearly)
+    struct ColorKey {
+        float baseWeight;
+        float r, g, b;
+    };
+
+    // Curve keys are evenly spaced from birth (first) to death (last)
+    template <typename Key, typename Blend>
+    void sampleCurve(const std::vector<Key>& keys, Blend blend) {
+        const int last = ParticleEmitter::CURVE_SAMPLES - 1;
+        for (int s = 0; s <= last; s++) {
+            if (keys.size() == 1) {
+                blend(s, keys[0], keys[0], 0.0f);
+                continue;
+            }
+            float at = static_cast<float>(s) / last * (keys.size() - 1);
+            size_t i = static_cast<size_t>(at);
+            if (i > keys.size() - 2) i = keys.size() - 2;
+            blend(s, keys[i], keys[i + 1], at - i);
+        }
+    }
+
+    void setSizeCurve(ParticleEmitter& e, const std::vector<float>& keys) {
+        sampleCurve(keys, [&](int s, float a, float b, float t) { e.sizeCurve[s] = a + (b - a) * t; });
+    }
+
+    void setAlphaCurve(ParticleEmitter& e, const std::vector<float>& keys) {
+        sampleCurve(keys, [&](int s, float a, float b, float t) {
+            float alpha = a + (b - a) * t;
+            e.alphaCurve[s] = static_cast<uint8_t>(alpha * 255 + 0.5f);
+        });
+    }
+
+    void setColorCurve(ParticleEmitter& e, const std::vector<ColorKey>& keys) {
+        sampleCurve(keys, [&](int s, const ColorKey& a, const ColorKey& b, float t) {
+            ParticleEmitter::ColorSample& c = e.colorCurve[s];
+            c.baseWeight = static_cast<uint16_t>((a.baseWeight + (b.baseWeight - a.baseWeight) * t) * 256 + 0.5f);
+            c.r = static_cast<uint16_t>((a.r + (b.r - a.r) * t) * 256 + 0.5f);
+            c.g = static_cast<uint16_t>((a.g + (b.g - a.g) * t) * 256 + 0.5f);
+            c.b = static_cast<uint16_t>((a.b + (b.b - a.b) * t) * 256 + 0.5f);
+        });
+    }
+
+    // What the old hard-coded emit() did, except that particles now fade
+    // over their own lifetime
+    ParticleEmitter makeSparks() {
+        ParticleEmitter e;
+        e.name = "sparks";
+        e.shape = EmitterShape::BURST;
+        e.count = 10;
+        e.speedMin = 50;
+        e.speedMax = 200;
+        e.lifetimeMin = 0.5f;
+        e.lifetimeMax = 1.5f;
+        e.sizeMin = 2;
+        e.sizeMax = 6;
+        e.spread = 360;
+        setSizeCurve(e, {1.0f});
+        setAlphaCurve(e, {1.0f, 0.0f});
+        setColorCurve(e, {ColorKey{1, 0, 0, 0}});
+        return e;
+    }
+
+    bool parseColorKey(const std::string& token, ColorKey& key) {
+        if (token == "base") {
+            key = ColorKey{1, 0, 0, 0};
+            return true;
+        }
+        char* end = nullptr;
+        unsigned long rgb = std::strtoul(token.c_str(), &end, 16);
+        if (token.size() != 6 || *end != '\0') return false;
+        key = ColorKey{0, static_cast<float>((rgb >> 16) & 0xFF), static_cast<float>((rgb >> 8) & 0xFF),
+                       static_cast<float>(rgb & 0xFF)};
+        return true;
+    }
+
+    // Current color from the curves
+    inline sf::Color curveColor(const ParticleEmitter& e, int sample, sf::Color base) {
+        const ParticleEmitter::ColorSample& c = e.colorCurve[sample];
+        return sf::Color(static_cast<sf::Uint8>((base.r * c.baseWeight + c.r) >> 8),
+                         static_cast<sf::Uint8>((base.g * c.baseWeight + c.g) >> 8),
+                         static_cast<sf::Uint8>((base.b * c.baseWeight + c.b) >> 8),
+                         static_cast<sf::Uint8>((base.a * (e.alphaCurve[sample] + 1)) >> 8));
+    }
+}
 
 ParticleSystem::ParticleSystem() {
-    rng.seed(100000);
+    randomState = 100000;
+    density = 1.0f;
+
+    // The only sin/cos calls: directions are looked up from here
+    for (int i = 0; i < TRIG_TABLE_SIZE + QUARTER_TURN; i++) {
+        sinTable[i] = std::sin(i * TWO_PI / TRIG_TABLE_SIZE);
+    }
+    emitters.push_back(makeSparks());
+    for (RunningEmitter& r : running) r.active = false;
+
+    // Never grow the vector during gameplay - emits past the cap are dropped
+    particles.reserve(MAX_PARTICLES);
+    createDotTexture();
 }
 
-void ParticleSystem::emit(sf::Vector2f position, sf::Color color, int count) {
+void ParticleSystem::createDotTexture() {
+    // White disc with a one pixel soft edge, tinted per particle by vertex color
+    sf::Image image;
+    image.create(DOT_TEXTURE_SIZE, DOT_TEXTURE_SIZE, sf::Color::Transparent);
+    float radius = DOT_TEXTURE_SIZE / 2.0f;
+    for (unsigned y = 0; y < DOT_TEXTURE_SIZE; y++) {
+        for (unsigned x = 0; x < DOT_TEXTURE_SIZE; x++) {
+            float dx = x + 0.5f - radius;
+            float dy = y + 0.5f - radius;
+            float edge = radius - std::sqrt(dx * dx + dy * dy);
+            if (edge > 0) {
+                float alpha = edge > 1.0f ? 1.0f : edge;
+                image.setPixel(x, y, sf::Color(255, 255, 255, static_cast<sf::Uint8>(alpha * 255)));
+            }
+        }
+    }
+    dotTexture.loadFromImage(image);
+    dotTexture.setSmooth(true);
+}
+
+bool ParticleSystem::loadEmitters(const std::string& path) {
+    std::ifstream file(path);
+    if (!file) {
+        std::cerr << "Could not open effects file " << path << std::endl;
+        return false;
+    }
+    std::stringstream source;
+    source << file.rdbuf();
+    return compileEmitters(source.str(), path);
+}
+
+bool ParticleSystem::compileEmitters(const std::string& source, const std::string& sourceName) {
+    std::istringstream lines(source);
+    std::string line;
+    int lineNumber = 0;
+
+    // Only replace the emitters if the whole file is good
+    std::vector<ParticleEmitter> loaded;
+    loaded.push_back(makeSparks());
+    ParticleEmitter current;
+    bool inEmitter = false;
+
+    auto fail = [&](const std::string& message) {
+        std::cerr << sourceName << ":" << lineNumber << ": " << message << std::endl;
+        return false;
+    };
+
+    while (std::getline(lines, line)) {
+        lineNumber++;
+        size_t comment = line.find('#');
+        if (comment != std::string::npos) line.erase(comment);
+
+        std::istringstream words(line);
+        std::string keyword;
+        if (!(words >> keyword)) continue;
+
+        if (keyword == "emitter") {
+            if (inEmitter) return fail("emitter inside emitter");
+            current = makeSparks();
+            if (!(words >> current.name)) return fail("emitter needs a name");
+            inEmitter = true;
+            continue;
+        }
+        if (!inEmitter) return fail("'" + keyword + "' outside an emitter");
+
+        if (keyword == "end") {
+            if (current.name == "sparks") {
+                loaded[0] = current;
+            } else {
+                loaded.push_back(current);
+            }
+            inEmitter = false;
+            continue;
+        }
+
+        bool ok = true;
+        if (keyword == "shape") {
+            std::string shape;
+            words >> shape;
+            if (shape == "burst") current.shape = EmitterShape::BURST;
+            else if (shape == "cone") current.shape = EmitterShape::CONE;
+            else if (shape == "ring") current.shape = EmitterShape::RING;
+            else if (shape == "continuous") current.shape = EmitterShape::CONTINUOUS;
+            else return fail("unknown shape '" + shape + "'");
+        } else if (keyword == "count") {
+            ok = static_cast<bool>(words >> current.count) && current.count >= 0;
+        } else if (keyword == "speed") {
+            ok = static_cast<bool>(words >> current.speedMin >> current.speedMax);
+        } else if (keyword == "lifetime") {
+            ok = static_cast<bool>(words >> current.lifetimeMin >> current.lifetimeMax) &&
+                 current.lifetimeMin > 0 && current.lifetimeMax >= current.lifetimeMin;
+        } else if (keyword == "size") {
+            ok = static_cast<bool>(words >> current.sizeMin >> current.sizeMax);
+        } else if (keyword == "spread") {
+            ok = static_cast<bool>(words >> current.spread) && current.spread >= 0 && current.spread <= 360;
+        } else if (keyword == "size_curve" || keyword == "alpha_curve") {
+            std::vector<float> keys;
+            float key;
+            while (words >> key) keys.push_back(key);
+            ok = !keys.empty() && words.eof();
+            if (ok && keyword == "size_curve") {
+                setSizeCurve(current, keys);
+            } else if (ok) {
+                for (float k : keys) ok = ok && k >= 0 && k <= 1;
+                if (ok) setAlphaCurve(current, keys);
+            }
+        } else if (keyword == "color_curve") {
+            std::vector<ColorKey> keys;
+            std::string token;
+            while (words >> token) {
+                ColorKey key;
+                if (!parseColorKey(token, key)) return fail("bad color '" + token + "' (base or RRGGBB)");
+                keys.push_back(key);
+            }
+            ok = !keys.empty();
+            if (ok) setColorCurve(current, keys);
+        } else {
+            return fail("unknown setting '" + keyword + "'");
+        }
+        if (!ok) return fail("bad values for '" + keyword + "'");
+
+        std::string extra;
+        words.clear();
+        if (words >> extra) return fail("too many values for '" + keyword + "'");
+    }
+
+    if (inEmitter) return fail("missing 'end' for emitter " + current.name);
+    if (loaded.size() > MAX_EMITTERS) return fail("too many emitters");
+
+    // Running emitters may point past the new list
+    for (RunningEmitter& r : running) r.active = false;
+    particles.clear();
+    emitters = loaded;
+    return true;
+}
+
+int ParticleSystem::findEmitter(const std::string& name) const {
+    for (size_t i = 0; i < emitters.size(); i++) {
+        if (emitters[i].name == name) return static_cast<int>(i);
+    }
+    return 0;
+}
+
+uint8_t ParticleSystem::directionOf(sf::Vector2f v) {
+    float turns = std::atan2(v.y, v.x) / TWO_PI;
+    return static_cast<uint8_t>(static_cast<int>(std::floor(turns * 256 + 0.5f)) & 0xFF);
+}
+
+// xorshift32 - one call per particle is all the randomness it needs
+uint32_t ParticleSystem::nextRandom() {
+    uint32_t x = randomState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    randomState = x;
+    return x;
+}
+
+// One random number covers a particle: bits 0-9 pick the direction (where
+// the shape leaves it random), 10-17 the speed, 18-25 the lifetime and
+// 26-31 the size
+void ParticleSystem::spawn(const ParticleEmitter& e, int index, sf::Vector2f position, sf::Color color,
+                           int angleStep, uint32_t bits) {
+    const float INV_255 = 1.0f / 255.0f;
+    int angle = angleStep & ANGLE_MASK;
+    float speed = e.speedMin + (e.speedMax - e.speedMin) * ((bits >> 10) & 0xFF) * INV_255;
+    float lifetime = e.lifetimeMin + (e.lifetimeMax - e.lifetimeMin) * ((bits >> 18) & 0xFF) * INV_255;
+
+    Particle p;
+    p.position = position;
+    p.velocity = sf::Vector2f(sinTable[angle + QUARTER_TURN] * speed, sinTable[angle] * speed);
+    p.baseColor = color;
+    p.baseSize = e.sizeMin + (e.sizeMax - e.sizeMin) * (bits >> 26) * (1.0f / 63);
+    p.age = 0;
+    p.ageRate = 1.0f / lifetime;
+    p.emitter = static_cast<uint8_t>(index);
+    p.size = p.baseSize * e.sizeCurve[0];
+    p.color = curveColor(e, 0, color);
+    particles.push_back(p);
+}
+
+void ParticleSystem::emit(int emitter, sf::Vector2f position, sf::Color color, int count, uint8_t direction) {
+    const ParticleEmitter& e = emitters[emitter];
+    if (count < 0) count = e.count;
+
+    // Scale by the current quality, but always emit at least one particle
+    count = static_cast<int>(count * density + 0.5f);
+    if (count < 1) count = 1;
+    size_t room = particles.capacity() - particles.size();
+    if (static_cast<size_t>(count) > room) count = static_cast<int>(room);
+
+    int center = direction * (TRIG_TABLE_SIZE / 256);
+    int spread = static_cast<int>(e.spread / 360.0f * TRIG_TABLE_SIZE);
     for (int i = 0; i < count; i++) {
-        Particle p;
-        p.position = position;
-        
-        // Random direction
-        float angle = random(0, 6.28318f); // 2 * PI
-        float speed = random(50, 200);
-        p.velocity.x = cos(angle) * speed;
-        p.velocity.y = sin(angle) * speed;
-        
-        p.color = color;
-        p.lifetime = random(0.5f, 1.5f);
-        p.size = random(2.0f, 6.0f);
-        
-        particles.push_back(p);
-    }
-}
-
-void ParticleSystem::emitTrail(sf::Vector2f position, sf::Color color) {
-    // Small trail particles
-    for (int i = 0; i < 3; i++) {
-        Particle p;
-        p.position = position + sf::Vector2f(random(-5, 5), random(-5, 5));
-        p.velocity = sf::Vector2f(random(-30, 30), random(-30, 30));
-        p.color = color;
-        p.lifetime = random(0.2f, 0.5f);
-        p.size = random(3.0f, 7.0f);
-        particles.push_back(p);
-    }
-}
-
-void ParticleSystem::emitExplosion(sf::Vector2f position, sf::Color color) {
-    // Big explosion
-    emit(position, color, 30);
-}
-
-void ParticleSystem::update(float dt) {
-    // Update and remove dead particles
-    for (auto it = particles.begin(); it != particles.end();) {
-        it->lifetime -= dt;
-        
-        if (it->lifetime <= 0) {
-            it = particles.erase(it);
+        uint32_t bits = nextRandom();
+        int angle;
+        if (e.shape == EmitterShape::BURST) {
+            angle = static_cast<int>(bits);
+        } else if (e.shape == EmitterShape::RING) {
+            angle = center + i * TRIG_TABLE_SIZE / count;
+        } else {
+            angle = center + ((static_cast<int>(bits & ANGLE_MASK) * spread) >> 10) - spread / 2;
+        }
+        spawn(e, emitter, position, color, angle, bits);
+    }
+}
+
+int ParticleSystem::startEmitter(int emitter, sf::Vector2f position, sf::Color color, uint8_t direction) {
+    for (int i = 0; i < MAX_RUNNING_EMITTERS; i++) {
+        RunningEmitter& r = running[i];
+        if (r.active) continue;
+        r.active = true;
+        r.emitter = static_cast<uint8_t>(emitter);
+        r.direction = direction;
+        r.color = color;
+        r.position = position;
+        r.lastPosition = position;
+        r.carry = 0;
+        return i;
+    }
+    return -1;
+}
+
+void ParticleSystem::moveEmitter(int handle, sf::Vector2f position) {
+    if (handle >= 0) running[handle].position = position;
+}
+
+void ParticleSystem::stopEmitter(int handle) {
+    if (handle >= 0) running[handle].active = false;
+}
+
+void ParticleSystem::update(float dt, ParticleCollider* collider) {
+    // Continuous emitters owe count * dt particles, spread along the path
+    // they moved since the last update
+    for (RunningEmitter& r : running) {
+        if (!r.active) continue;
+        const ParticleEmitter& e = emitters[r.emitter];
+        r.carry += e.count * density * dt;
+        int count = static_cast<int>(r.carry);
+        r.carry -= count;
+        size_t room = particles.capacity() - particles.size();
+        if (static_cast<size_t>(count) > room) count = static_cast<int>(room);
+
+        int center = r.direction * (TRIG_TABLE_SIZE / 256);
+        int spread = static_cast<int>(e.spread / 360.0f * TRIG_TABLE_SIZE);
+        sf::Vector2f step = count > 0 ? (r.position - r.lastPosition) / static_cast<float>(count) : sf::Vector2f();
+        for (int i = 0; i < count; i++) {
+            uint32_t bits = nextRandom();
+            int angle = center + ((static_cast<int>(bits & ANGLE_MASK) * spread) >> 10) - spread / 2;
+            spawn(e, r.emitter, r.lastPosition + step * static_cast<float>(i + 1), r.color, angle, bits);
+        }
+        r.lastPosition = r.position;
+    }
+
+    // Age, move and remove dead particles
+    const float lastSample = static_cast<float>(ParticleEmitter::CURVE_SAMPLES - 1);
+    for (size_t i = 0; i < particles.size();) {
+        Particle& p = particles[i];
+        p.age += p.ageRate * dt;
+
+        if (p.age >= 1.0f) {
+            // Swap with the last one instead of erasing from the middle
+            p = particles.back();
+            particles.pop_back();
         } else {
             // Update position
-            it->position += it->velocity * dt;
-            
-            // Fade out
-            float alpha = (it->lifetime / 1.5f) * 255;
-            it->color.a = static_cast<sf::Uint8>(alpha);
-            
-            ++it;
+            p.position += p.velocity * dt;
+
+            // Size, color and fade from the emitter's curves
+            const ParticleEmitter& e = emitters[p.emitter];
+            int sample = static_cast<int>(p.age * lastSample + 0.5f);
+            p.size = p.baseSize * e.sizeCurve[sample];
+            p.color = curveColor(e, sample, p.baseColor);
+
+            ++i;
         }
     }
+
+    if (collider && !particles.empty()) {
+        collider->resolve(particles.data(), particles.size(), dt);
+    }
 }
 
-void ParticleSystem::draw(sf::RenderWindow& window) {
+void ParticleSystem::draw(sf::RenderTarget& target, FrameArena& arena) {
+    if (particles.empty()) return;
+
+    // Two triangles per particle, built in transient frame memory
+    size_t vertexCount = particles.size() * 6;
+    sf::Vertex* vertices = arena.allocateArray<sf::Vertex>(vertexCount);
+    if (!vertices) {
+        fallbackVertices.resize(vertexCount);
+        vertices = fallbackVertices.data();
+    }
+
+    const float t = static_cast<float>(DOT_TEXTURE_SIZE);
+    sf::Vertex* v = vertices;
     for (const auto& p : particles) {
-        sf::CircleShape shape(p.size);
-        shape.setPosition(p.position);
-        shape.setFillColor(p.color);
-        shape.setOrigin(p.size, p.size);
-        
-        // Draw with additive blending for glow
-        sf::RenderStates states;
-        states.blendMode = sf::BlendAdd;
-        window.draw(shape, states);
+        float left = p.position.x - p.size;
+        float right = p.position.x + p.size;
+        float top = p.position.y - p.size;
+        float bottom = p.position.y + p.size;
+
+        v[0] = sf::Vertex(sf::Vector2f(left, top), p.color, sf::Vector2f(0, 0));
+        v[1] = sf::Vertex(sf::Vector2f(right, top), p.color, sf::Vector2f(t, 0));
+        v[2] = sf::Vertex(sf::Vector2f(right, bottom), p.color, sf::Vector2f(t, t));
+        v[3] = v[0];
+        v[4] = v[2];
+        v[5] = sf::Vertex(sf::Vector2f(left, bottom), p.color, sf::Vector2f(0, t));
+        v += 6;
     }
+
+    // Draw with additive blending for glow
+    sf::RenderStates states;
+    states.blendMode = sf::BlendAdd;
+    states.texture = &dotTexture;
+    target.draw(vertices, vertexCount, sf::Triangles, states);
 }
 
 void ParticleSystem::clear() {
     particles.clear();
-}
-
-float ParticleSystem::random(float min, float max) {
-    std::uniform_real_distribution<float> dist(min, max);
-    return dist(rng);
+    for (RunningEmitter& r : running) r.active = false;
 }
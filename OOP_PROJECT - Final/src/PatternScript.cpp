@@ -0,0 +1,178 @@
+#include "PatternScript.h"
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace {
+    struct OpName {
+        const char* name;
+        PatternOp op;
+    };
+
+    // "end" is handled separately (it closes either a repeat or a pattern)
+    const OpName OP_NAMES[] = {
+        {"origin", PatternOp::ORIGIN}, {"set", PatternOp::SET},     {"add", PatternOp::ADD},
+        {"mul", PatternOp::MUL},       {"rand", PatternOp::RAND},   {"emit", PatternOp::EMIT},
+        {"fan", PatternOp::FAN},       {"ring", PatternOp::RING},   {"size", PatternOp::SIZE},
+        {"sine", PatternOp::SINE},     {"curve", PatternOp::CURVE}, {"accel", PatternOp::ACCEL},
+        {"wall", PatternOp::WALL},     {"wait", PatternOp::WAIT},   {"repeat", PatternOp::REPEAT},
+    };
+
+    // Operands that are colors may also be written as "random"
+    bool isColorOperand(PatternOp op, int index) {
+        switch (op) {
+            case PatternOp::EMIT: return index == 2;
+            case PatternOp::FAN:  return index == 4;
+            case PatternOp::RING: return index == 3;
+            case PatternOp::WALL: return index == 0;
+            default:              return false;
+        }
+    }
+}
+
+int PatternLibrary::getOperandCount(PatternOp op) {
+    switch (op) {
+        case PatternOp::ORIGIN: return 2;
+        case PatternOp::SET:    return 2;
+        case PatternOp::ADD:    return 2;
+        case PatternOp::MUL:    return 2;
+        case PatternOp::RAND:   return 3;
+        case PatternOp::EMIT:   return 3;
+        case PatternOp::FAN:    return 5;
+        case PatternOp::RING:   return 4;
+        case PatternOp::SIZE:   return 1;
+        case PatternOp::SINE:   return 2;
+        case PatternOp::CURVE:  return 1;
+        case PatternOp::ACCEL:  return 1;
+        case PatternOp::WALL:   return 1;
+        case PatternOp::WAIT:   return 1;
+        case PatternOp::REPEAT: return 1;
+        default:                return 0;
+    }
+}
+
+bool PatternLibrary::loadFromFile(const std::string& path) {
+    std::ifstream file(path);
+    if (!file) {
+        std::cerr << "Could not open pattern file " << path << std::endl;
+        return false;
+    }
+    std::stringstream source;
+    source << file.rdbuf();
+    return compile(source.str(), path);
+}
+
+uint16_t PatternLibrary::addConstant(Fixed value) {
+    for (size_t i = 0; i < constants.size(); i++) {
+        if (constants[i] == value) return static_cast<uint16_t>(i);
+    }
+    constants.push_back(value);
+    return static_cast<uint16_t>(constants.size() - 1);
+}
+
+bool PatternLibrary::parseOperand(const std::string& token, bool allowRandom, uint16_t& word) {
+    if (token.size() == 1 && token[0] >= 'a' && token[0] < 'a' + REGISTER_COUNT) {
+        word = REGISTER_BIT | static_cast<uint16_t>(token[0] - 'a');
+        return true;
+    }
+    if (allowRandom && token == "random") {
+        word = addConstant(Fixed(-1));
+        return true;
+    }
+
+    char* end = nullptr;
+    float value = std::strtof(token.c_str(), &end);
+    if (end == token.c_str() || *end != '\0') return false;
+    word = addConstant(Fixed::fromFloat(value));
+    return true;
+}
+
+bool PatternLibrary::compile(const std::string& source, const std::string& sourceName) {
+    std::istringstream lines(source);
+    std::string line;
+    int lineNumber = 0;
+
+    // Compile into a temporary and only register the patterns once the
+    // whole source is good; constants added on the way are rolled back
+    std::vector<PatternProgram> compiled;
+    size_t constantsBefore = constants.size();
+    PatternProgram current;
+    bool inPattern = false;
+    int openLoops = 0;              // REPEATs still waiting for their "end"
+
+    auto fail = [&](const std::string& message) {
+        std::cerr << sourceName << ":" << lineNumber << ": " << message << std::endl;
+        constants.resize(constantsBefore);
+        return false;
+    };
+
+    while (std::getline(lines, line)) {
+        lineNumber++;
+        size_t comment = line.find('#');
+        if (comment != std::string::npos) line.erase(comment);
+
+        std::istringstream words(line);
+        std::string keyword;
+        if (!(words >> keyword)) continue;
+
+        if (keyword == "pattern") {
+            if (inPattern) return fail("pattern inside pattern");
+            if (programs.size() + compiled.size() >= MAX_PATTERNS) {
+                return fail("too many patterns (at most " + std::to_string(MAX_PATTERNS) + ")");
+            }
+            current = PatternProgram();
+            if (!(words >> current.name)) return fail("pattern needs a name");
+            inPattern = true;
+            continue;
+        }
+        if (!inPattern) return fail("'" + keyword + "' outside a pattern");
+
+        if (keyword == "end") {
+            if (openLoops > 0) {
+                openLoops--;
+                current.code.push_back(static_cast<uint16_t>(PatternOp::NEXT));
+            } else {
+                current.code.push_back(static_cast<uint16_t>(PatternOp::END));
+                compiled.push_back(current);
+                inPattern = false;
+            }
+            continue;
+        }
+
+        PatternOp op = PatternOp::COUNT;
+        for (const OpName& entry : OP_NAMES) {
+            if (keyword == entry.name) op = entry.op;
+        }
+        if (op == PatternOp::COUNT) return fail("unknown instruction '" + keyword + "'");
+
+        current.code.push_back(static_cast<uint16_t>(op));
+        for (int i = 0; i < getOperandCount(op); i++) {
+            std::string token;
+            uint16_t word;
+            if (!(words >> token)) return fail("'" + keyword + "' needs more operands");
+            if (!parseOperand(token, isColorOperand(op, i), word)) return fail("bad operand '" + token + "'");
+            // SET/ADD/MUL/RAND write to their first operand
+            bool writes = op == PatternOp::SET || op == PatternOp::ADD ||
+                          op == PatternOp::MUL || op == PatternOp::RAND;
+            if (writes && i == 0 && !(word & REGISTER_BIT)) return fail("expected a register");
+            current.code.push_back(word);
+        }
+        std::string extra;
+        if (words >> extra) return fail("too many operands for '" + keyword + "'");
+
+        if (op == PatternOp::REPEAT && ++openLoops > MAX_LOOP_DEPTH) return fail("repeats nested too deep");
+    }
+
+    if (inPattern) return fail("missing 'end' for pattern " + current.name);
+    if (constants.size() >= REGISTER_BIT) return fail("too many constants");
+    programs.insert(programs.end(), compiled.begin(), compiled.end());
+    return true;
+}
+
+int PatternLibrary::findPattern(const std::string& name) const {
+    for (size_t i = 0; i < programs.size(); i++) {
+        if (programs[i].name == name) return static_cast<int>(i);
+    }
+    return -1;
+}
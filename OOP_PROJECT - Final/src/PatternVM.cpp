@@ -0,0 +1,200 @@
+#include "PatternVM.h"
+#include "Config.h"
+#include <chrono>
+
+namespace {
+    // An instance that never waits can't freeze the game - it just
+    // continues next frame
+    const int MAX_STEPS_PER_UPDATE = 20000;
+}
+
+PatternVM::PatternVM() {
+    library = nullptr;
+    reset();
+}
+
+void PatternVM::reset() {
+    for (Instance& inst : instances) inst.active = false;
+    for (PatternStats& s : stats) s = PatternStats{0, 0, 0, 0.0f};
+    wallRequestCount = 0;
+}
+
+bool PatternVM::start(int program) {
+    if (!library || program < 0 || program >= library->getPatternCount() || program >= MAX_PATTERNS) {
+        return false;
+    }
+
+    for (Instance& inst : instances) {
+        if (inst.active) continue;
+        inst.active = true;
+        inst.program = program;
+        inst.pc = 0;
+        inst.wait = Fixed();
+        for (Fixed& r : inst.registers) r = Fixed();
+        inst.loopDepth = 0;
+        inst.origin = FixedVec2(Fixed::fromFloat(WINDOW_WIDTH + OBSTACLE_WIDTH),  // Right edge, like normal obstacles
+                                Fixed(WINDOW_HEIGHT / 2));
+        inst.motion = BulletMotion{Fixed(200), Fixed(8), Fixed(), Fixed(), Fixed(), Fixed()};
+        return true;
+    }
+    return false;
+}
+
+int PatternVM::getRunningCount() const {
+    int running = 0;
+    for (const Instance& inst : instances) {
+        if (inst.active) running++;
+    }
+    return running;
+}
+
+Fixed PatternVM::operand(const Instance& inst, uint16_t word) const {
+    if (word & PatternLibrary::REGISTER_BIT) {
+        return inst.registers[word & ~PatternLibrary::REGISTER_BIT];
+    }
+    return library->getConstant(word);
+}
+
+int PatternVM::paletteIndex(Fixed value) {
+    if (value < Fixed()) {
+        return rng.below(BulletField::PALETTE_SIZE);
+    }
+    return value.toInt() % BulletField::PALETTE_SIZE;
+}
+
+void PatternVM::update(Fixed dt, BulletField& bullets, Fixed speedScale) {
+    wallRequestCount = 0;
+    for (PatternStats& s : stats) {
+        s.running = 0;
+        s.vmMs = 0;
+    }
+    if (!library) return;
+
+    for (Instance& inst : instances) {
+        if (!inst.active) continue;
+
+        auto begin = std::chrono::steady_clock::now();
+        inst.wait -= dt;
+        execute(inst, bullets, speedScale);
+        float ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - begin).count();
+
+        stats[inst.program].vmMs += ms;
+        if (inst.active) stats[inst.program].running++;
+    }
+}
+
+void PatternVM::execute(Instance& inst, BulletField& bullets, Fixed speedScale) {
+    const std::vector<uint16_t>& code = library->getPattern(inst.program).code;
+    PatternStats& s = stats[inst.program];
+
+    for (int steps = 0; inst.active && inst.wait <= Fixed() && steps < MAX_STEPS_PER_UPDATE; steps++) {
+        PatternOp op = static_cast<PatternOp>(code[inst.pc]);
+        const uint16_t* args = &code[inst.pc + 1];
+        inst.pc += static_cast<uint16_t>(1 + PatternLibrary::getOperandCount(op));
+
+        switch (op) {
+            case PatternOp::ORIGIN:
+                inst.origin = FixedVec2(operand(inst, args[0]), operand(inst, args[1]));
+                break;
+            case PatternOp::SET:
+                inst.registers[args[0] & ~PatternLibrary::REGISTER_BIT] = operand(inst, args[1]);
+                break;
+            case PatternOp::ADD:
+                inst.registers[args[0] & ~PatternLibrary::REGISTER_BIT] += operand(inst, args[1]);
+                break;
+            case PatternOp::MUL:
+                inst.registers[args[0] & ~PatternLibrary::REGISTER_BIT] *= operand(inst, args[1]);
+                break;
+            case PatternOp::RAND:
+                inst.registers[args[0] & ~PatternLibrary::REGISTER_BIT] = rng.uniform(operand(inst, args[1]), operand(inst, args[2]));
+                break;
+            case PatternOp::EMIT: {
+                BulletMotion motion = inst.motion;
+                motion.speed = operand(inst, args[1]) * speedScale;
+                bullets.spawn(inst.origin, operand(inst, args[0]), paletteIndex(operand(inst, args[2])),
+                              motion, inst.program);
+                s.emitted++;
+                break;
+            }
+            case PatternOp::FAN: {
+                // count bullets spread evenly across 'spread' degrees around 'angle'
+                int n = operand(inst, args[0]).toInt();
+                Fixed angle = operand(inst, args[1]);
+                int64_t spread = operand(inst, args[2]).raw();
+                BulletMotion motion = inst.motion;
+                motion.speed = operand(inst, args[3]) * speedScale;
+                int color = paletteIndex(operand(inst, args[4]));
+                for (int i = 0; i < n; i++) {
+                    // spread * (i / (n - 1) - 1/2), in one division
+                    int64_t offset = n > 1 ? spread * (2 * i - (n - 1)) / (2 * (n - 1)) : 0;
+                    bullets.spawn(inst.origin, angle + Fixed::fromRaw(static_cast<int32_t>(offset)), color, motion,
+                                  inst.program);
+                }
+                s.emitted += n;
+                break;
+            }
+            case PatternOp::RING: {
+                int n = operand(inst, args[0]).toInt();
+                Fixed angle = operand(inst, args[1]);
+                BulletMotion motion = inst.motion;
+                motion.speed = operand(inst, args[2]) * speedScale;
+                int color = paletteIndex(operand(inst, args[3]));
+                for (int i = 0; i < n; i++) {
+                    Fixed offset = Fixed::fromRaw(static_cast<int32_t>(static_cast<int64_t>(Fixed(360).raw()) * i / n));
+                    bullets.spawn(inst.origin, angle + offset, color, motion, inst.program);
+                }
+                s.emitted += n;
+                break;
+            }
+            case PatternOp::SIZE:
+                inst.motion.halfSize = operand(inst, args[0]);
+                break;
+            case PatternOp::SINE:
+                inst.motion.sineAmplitude = operand(inst, args[0]);
+                inst.motion.sineFrequency = operand(inst, args[1]);
+                break;
+            case PatternOp::CURVE:
+                inst.motion.curve = operand(inst, args[0]);
+                break;
+            case PatternOp::ACCEL:
+                inst.motion.accel = operand(inst, args[0]);
+                break;
+            case PatternOp::WALL:
+                if (wallRequestCount < MAX_WALL_REQUESTS) {
+                    wallRequests[wallRequestCount++] = paletteIndex(operand(inst, args[0]));
+                }
+                break;
+            case PatternOp::WAIT:
+                inst.wait += operand(inst, args[0]);    // Keep the remainder so timing doesn't drift
+                break;
+            case PatternOp::REPEAT: {
+                int times = operand(inst, args[0]).toInt();
+                inst.loops[inst.loopDepth].start = inst.pc;
+                inst.loops[inst.loopDepth].remaining = times > 1 ? times : 1;
+                inst.loopDepth++;
+                break;
+            }
+            case PatternOp::NEXT: {
+                Loop& loop = inst.loops[inst.loopDepth - 1];
+                if (--loop.remaining > 0) {
+                    inst.pc = loop.start;
+                } else {
+                    inst.loopDepth--;
+                }
+                break;
+            }
+            case PatternOp::END:
+            default:
+                inst.active = false;
+                break;
+        }
+    }
+}
+
+void PatternVM::updateBulletCounts(const BulletField& bullets) {
+    int counts[MAX_PATTERNS];
+    bullets.countByPattern(counts, MAX_PATTERNS);
+    for (int p = 0; p < MAX_PATTERNS; p++) {
+        stats[p].bullets = counts[p];
+    }
+}
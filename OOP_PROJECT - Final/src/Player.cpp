@@ -1,8 +1,18 @@
 #include "Player.h"
+#include "StateHash.h"
 #include <cmath>
 
+namespace {
+    const Fixed SPEED = Fixed::fromFloat(PLAYER_SPEED);
+    const Fixed DASH = Fixed::fromFloat(DASH_SPEED);
+    const Fixed HALF_SIZE = Fixed::fromFloat(PLAYER_SIZE / 2);
+    const Fixed HIT_HALF_SIZE = Fixed::fromFloat(PLAYER_SIZE / 2 + 3.0f);  // Includes the outline
+    const FixedVec2 START(Fixed(WINDOW_WIDTH / 4), Fixed(WINDOW_HEIGHT / 2));
+}
+
 Player::Player() {
-    position = sf::Vector2f(WINDOW_WIDTH / 4.0f, WINDOW_HEIGHT / 2.0f);
+    position = START;
+    previousPosition = START;
     shape.setSize(sf::Vector2f(PLAYER_SIZE, PLAYER_SIZE));
     shape.setOrigin(PLAYER_SIZE / 2, PLAYER_SIZE / 2);
 
@@ -21,106 +31,98 @@ Player::Player() {
     shape.setOutlineThickness(3.0f);
     shape.setOutlineColor(sf::Color::White);
 
-    isDashing = false;
-    dashTimer = 0;
-    dashCooldownTimer = 0;
-    trailTimer = 0;
+    dashing = false;
+    dashTime = 0;
 }
 
-void Player::handleInput() {
-    velocity = sf::Vector2f(0, 0);
+void Player::handleInput(const InputState& input) {
+    velocity = FixedVec2();
     
-    if (!isDashing) {
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::W) || 
-            sf::Keyboard::isKeyPressed(sf::Keyboard::Up)) {
-            velocity.y = -PLAYER_SPEED;
-        }
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::S) || 
-            sf::Keyboard::isKeyPressed(sf::Keyboard::Down)) {
-            velocity.y = PLAYER_SPEED;
-        }
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::A) || 
-            sf::Keyboard::isKeyPressed(sf::Keyboard::Left)) {
-            velocity.x = -PLAYER_SPEED;
-        }
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::D) || 
-            sf::Keyboard::isKeyPressed(sf::Keyboard::Right)) {
-            velocity.x = PLAYER_SPEED;
-        }
+    if (!dashing) {
+        velocity = FixedVec2(Fixed(static_cast<int>(input.move.x)), Fixed(static_cast<int>(input.move.y))) * SPEED;
         
         // Normalize diagonal movement
-        if (velocity.x != 0 && velocity.y != 0) {
-            float length = sqrt(velocity.x * velocity.x + velocity.y * velocity.y);
-            velocity.x = (velocity.x / length) * PLAYER_SPEED;
-            velocity.y = (velocity.y / length) * PLAYER_SPEED;
+        if (velocity.x != Fixed() && velocity.y != Fixed()) {
+            Fixed length = velocity.length();
+            velocity.x = velocity.x / length * SPEED;
+            velocity.y = velocity.y / length * SPEED;
         }
     }
 }
 
-void Player::dash() {
-    if (!canDash()) return;
-    
+void Player::startDash() {
     // Get dash direction from current velocity or last movement
-    if (velocity.x != 0 || velocity.y != 0) {
-        float length = sqrt(velocity.x * velocity.x + velocity.y * velocity.y);
-        dashDirection = sf::Vector2f(velocity.x / length, velocity.y / length);
+    if (velocity.x != Fixed() || velocity.y != Fixed()) {
+        Fixed length = velocity.length();
+        dashDirection = FixedVec2(velocity.x / length, velocity.y / length);
     } else {
-        dashDirection = sf::Vector2f(1, 0); // Default right
+        dashDirection = FixedVec2(Fixed(1), Fixed()); // Default right
     }
     
-    isDashing = true;
-    dashTimer = DASH_DURATION;
-    dashCooldownTimer = DASH_COOLDOWN;
+    dashing = true;
+    dashTime = 0;
 }
 
-void Player::update(float dt) {
-    handleInput();
-    
+void Player::endDash() {
+    dashing = false;
+}
+
+void Player::update(Fixed dt, const InputState& input) {
+    handleInput(input);
+    previousPosition = position;
+
     // Update dash
-    if (isDashing) {
-        dashTimer -= dt;
-        if (dashTimer <= 0) {
-            isDashing = false;
-        }
-        position += dashDirection * DASH_SPEED * dt;
+    if (dashing) {
+        dashTime += dt.toFloat();
+        position += dashDirection * DASH * dt;
     } else {
         position += velocity * dt;
     }
     
-    // Update cooldown
-    if (dashCooldownTimer > 0) {
-        dashCooldownTimer -= dt;
-    }
-    
     // Keep player in bounds
-    if (position.x < PLAYER_SIZE / 2) position.x = PLAYER_SIZE / 2;
-    if (position.x > WINDOW_WIDTH - PLAYER_SIZE / 2) 
-        position.x = WINDOW_WIDTH - PLAYER_SIZE / 2;
-    if (position.y < PLAYER_SIZE / 2) position.y = PLAYER_SIZE / 2;
-    if (position.y > WINDOW_HEIGHT - PLAYER_SIZE / 2) 
-        position.y = WINDOW_HEIGHT - PLAYER_SIZE / 2;
+    if (position.x < HALF_SIZE) position.x = HALF_SIZE;
+    if (position.x > Fixed(WINDOW_WIDTH) - HALF_SIZE)
+        position.x = Fixed(WINDOW_WIDTH) - HALF_SIZE;
+    if (position.y < HALF_SIZE) position.y = HALF_SIZE;
+    if (position.y > Fixed(WINDOW_HEIGHT) - HALF_SIZE)
+        position.y = Fixed(WINDOW_HEIGHT) - HALF_SIZE;
     
-    shape.setPosition(position);
+    shape.setPosition(position.toVector2f());
+    trail.update(dt.toFloat(), position.toVector2f(), currentColor, dashing);
     
-    // Pulse effect during dash
-    if (isDashing) {
-        float scale = 1.0f + sin(dashTimer * 30) * 0.2f;
+    // Pulse effect during dash (only looks - the hit box doesn't pulse)
+    if (dashing) {
+        float scale = 1.0f + sin((DASH_DURATION - dashTime) * 30) * 0.2f;
         shape.setScale(scale, scale);
     } else {
         shape.setScale(1.0f, 1.0f);
     }
 }
 
-void Player::drawTrail(sf::RenderWindow& window, ParticleSystem& particles) {
-    trailTimer += 0.016f; // Approximate dt
-    if (trailTimer >= 0.05f) {
-        particles.emitTrail(position, currentColor);
-        trailTimer = 0;
-    }
+FixedRect Player::getBounds() const {
+    return FixedRect::around(position, HIT_HALF_SIZE, HIT_HALF_SIZE);
+}
+
+FixedRect Player::getPreviousBounds() const {
+    return FixedRect::around(previousPosition, HIT_HALF_SIZE, HIT_HALF_SIZE);
+}
+
+void Player::rewind(Fixed time) {
+    position = previousPosition + (position - previousPosition) * time;
+    shape.setPosition(position.toVector2f());
+}
+
+void Player::hashState(StateHash::Stream& stream) const {
+    stream.add(position);
+    stream.add(velocity);
+    stream.add(dashing);
+    stream.add(dashDirection);
+    stream.add(currentColorIndex);
 }
 
-void Player::draw(sf::RenderWindow& window) {
-    window.draw(shape);
+void Player::draw(sf::RenderTarget& target) {
+    trail.draw(target);
+    target.draw(shape);
 }
 
 void Player::changeColor() {
@@ -131,12 +133,18 @@ void Player::changeColor() {
 }
 
 void Player::reset() {
-    position = sf::Vector2f(WINDOW_WIDTH / 4.0f, WINDOW_HEIGHT / 2.0f);
-    velocity = sf::Vector2f(0, 0);
-    isDashing = false;
-    dashTimer = 0;
-    dashCooldownTimer = 0;
-    currentColorIndex = 0;
+    reset(START, 0);
+}
+
+void Player::reset(FixedVec2 start, int colorIndex) {
+    position = start;
+    previousPosition = start;
+    velocity = FixedVec2();
+    dashing = false;
+    dashTime = 0;
+    currentColorIndex = colorIndex % availableColors.size();
     currentColor = availableColors[currentColorIndex];
     shape.setFillColor(currentColor);
+    shape.setPosition(position.toVector2f());
+    trail.clear();
 }
\ No newline at end of file
@@ -0,0 +1,79 @@
+#include "PlayerTrail.h"
+#include "Config.h"
+#include <cmath>
+
+namespace {
+    const float SAMPLE_INTERVAL = 1.0f / 60.0f;  // Record a point 60 times a second
+    const float BASE_WIDTH = PLAYER_SIZE * 0.35f;
+    const float DASH_WIDTH = PLAYER_SIZE * 0.6f;
+}
+
+PlayerTrail::PlayerTrail() : strip(sf::TriangleStrip, MAX_POINTS * 2) {
+    length = 32;
+    clear();
+}
+
+void PlayerTrail::clear() {
+    head = 0;
+    count = 0;
+    sampleTimer = 0;
+}
+
+void PlayerTrail::setLength(int pointCount) {
+    if (pointCount < 2) pointCount = 2;
+    if (pointCount > MAX_POINTS) pointCount = MAX_POINTS;
+    length = pointCount;
+}
+
+void PlayerTrail::update(float dt, sf::Vector2f position, sf::Color color, bool dashing) {
+    float width = dashing ? DASH_WIDTH : BASE_WIDTH;
+
+    sampleTimer += dt;
+    if (count == 0 || sampleTimer >= SAMPLE_INTERVAL) {
+        sampleTimer = 0;
+        head = (head + 1) % MAX_POINTS;
+        if (count < MAX_POINTS) count++;
+    }
+
+    // The newest point always follows the player exactly
+    points[head].position = position;
+    points[head].color = color;
+    points[head].width = width;
+}
+
+void PlayerTrail::draw(sf::RenderTarget& target) {
+    int used = count < length ? count : length;
+    if (used < 2) return;
+
+    sf::Vector2f lastNormal(0, 1);
+    for (int i = 0; i < used; i++) {
+        const TrailPoint& p = points[(head - i + MAX_POINTS) % MAX_POINTS];
+
+        // Direction along the ribbon from the neighbouring points
+        const TrailPoint& newer = points[(head - (i > 0 ? i - 1 : 0) + MAX_POINTS) % MAX_POINTS];
+        const TrailPoint& older = points[(head - (i < used - 1 ? i + 1 : i) + MAX_POINTS) % MAX_POINTS];
+        sf::Vector2f dir = newer.position - older.position;
+        float len = std::sqrt(dir.x * dir.x + dir.y * dir.y);
+        sf::Vector2f normal = lastNormal;
+        if (len > 0.001f) {
+            normal = sf::Vector2f(-dir.y / len, dir.x / len);
+            lastNormal = normal;
+        }
+
+        // Taper and fade towards the tail
+        float t = 1.0f - static_cast<float>(i) / (used - 1);
+        float halfWidth = p.width * t;
+        sf::Color color = p.color;
+        color.a = static_cast<sf::Uint8>(180 * t);
+
+        strip[i * 2].position = p.position + normal * halfWidth;
+        strip[i * 2].color = color;
+        strip[i * 2 + 1].position = p.position - normal * halfWidth;
+        strip[i * 2 + 1].color = color;
+    }
+
+    // Only draw the part of the strip we filled this frame
+    sf::RenderStates states;
+    states.blendMode = sf::BlendAdd;
+    target.draw(&strip[0], used * 2, sf::TriangleStrip, states);
+}
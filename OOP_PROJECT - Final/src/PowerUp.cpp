@@ -1,16 +1,29 @@
 #include "PowerUp.h"
+#include "StateHash.h"
 #include <cmath>
 
-PowerUp::PowerUp(sf::Vector2f startPos, PowerUpType t, float speed) {
-    position = startPos;
-    type = t;
-    isActive = true;
-    pulseTimer = 0;
-    
+bool PowerUp::glowEnabled = true;
+
+namespace {
+    const Fixed PICKUP_HALF_SIZE = Fixed(18);  // Radius + outline
+}
+
+PowerUp::PowerUp(FixedVec2 startPos, PowerUpType t, Fixed speed) {
     shape.setRadius(15.0f);
     shape.setOrigin(15.0f, 15.0f);
     shape.setOutlineThickness(3.0f);
     shape.setOutlineColor(sf::Color::White);
+
+    reset(startPos, t, speed);
+}
+
+void PowerUp::reset(FixedVec2 startPos, PowerUpType t, Fixed speed) {
+    position = startPos;
+    previousPosition = startPos;
+    type = t;
+    isActive = true;
+    pulseTimer = 0;
+    shape.setPosition(position.toVector2f());
     
     // Set color based on type
     switch(type) {
@@ -25,36 +38,54 @@ PowerUp::PowerUp(sf::Vector2f startPos, PowerUpType t, float speed) {
             break;
     }
     
-    velocity = sf::Vector2f(-speed, 0);
+    velocity = FixedVec2(-speed, Fixed());
 }
 
-void PowerUp::update(float dt) {
+void PowerUp::update(Fixed dt) {
     if (!isActive) return;
-    
+
+    previousPosition = position;
     position += velocity * dt;
-    pulseTimer += dt;
+    pulseTimer += dt.toFloat();
     
     // Pulsing effect
     float scale = 1.0f + sin(pulseTimer * 5) * 0.2f;
     shape.setScale(scale, scale);
     
-    shape.setPosition(position);
+    shape.setPosition(position.toVector2f());
     
     // Deactivate if off screen
-    if (position.x < -30) {
+    if (position.x < Fixed(-30)) {
         isActive = false;
     }
 }
 
-void PowerUp::draw(sf::RenderWindow& window) {
+FixedRect PowerUp::getBounds() const {
+    return FixedRect::around(position, PICKUP_HALF_SIZE, PICKUP_HALF_SIZE);
+}
+
+FixedRect PowerUp::getPreviousBounds() const {
+    return FixedRect::around(previousPosition, PICKUP_HALF_SIZE, PICKUP_HALF_SIZE);
+}
+
+void PowerUp::hashState(StateHash::Stream& stream) const {
+    stream.add(isActive);
+    stream.add(type);
+    stream.add(position);
+    stream.add(velocity);
+}
+
+void PowerUp::draw(sf::RenderTarget& target) {
     if (isActive) {
-        // Draw with glow
         sf::RenderStates states;
-        states.blendMode = sf::BlendAdd;
-        window.draw(shape, states);
+        if (glowEnabled) {
+            // Draw with glow
+            states.blendMode = sf::BlendAdd;
+            target.draw(shape, states);
+        }
         
         // Draw normal too for solid part
         states.blendMode = sf::BlendAlpha;
-        window.draw(shape, states);
+        target.draw(shape, states);
     }
 }
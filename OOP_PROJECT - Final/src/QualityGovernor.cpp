@@ -0,0 +1,123 @@
+#include "QualityGovernor.h"
+
+namespace {
+    const float DOWNGRADE_LOAD = 0.85f;   // Drop a tier above 85% of the budget
+    const float UPGRADE_LOAD = 0.5f;      // Consider climbing below 50%
+    const float UPGRADE_CALM_TIME = 3.0f; // ...after this many calm seconds
+    const float CHANGE_COOLDOWN = 1.0f;   // Let a change settle before judging it
+}
+
+QualityGovernor::QualityGovernor() {
+    tier = QualityTier::HIGH;
+    budgetMs = 1000.0f / 60.0f;
+    workCount = 0;
+    workIndex = 0;
+    clockTime = 0;
+    calmTime = 0;
+    cooldown = 0;
+    historyCount = 0;
+}
+
+void QualityGovernor::update(float workMs, float dt) {
+    clockTime += dt;
+    workTimes[workIndex] = workMs;
+    workIndex = (workIndex + 1) % WINDOW;
+    if (workCount < WINDOW) workCount++;
+
+    if (cooldown > 0) {
+        cooldown -= dt;
+        return;
+    }
+    if (workCount < WINDOW) return;
+
+    float total = 0;
+    for (int i = 0; i < WINDOW; i++) {
+        total += workTimes[i];
+    }
+    float average = total / WINDOW;
+
+    if (average > budgetMs * DOWNGRADE_LOAD) {
+        calmTime = 0;
+        if (tier != QualityTier::MINIMAL) {
+            changeTier(static_cast<QualityTier>(static_cast<int>(tier) + 1), average);
+        }
+    } else if (average < budgetMs * UPGRADE_LOAD) {
+        calmTime += dt;
+        if (calmTime >= UPGRADE_CALM_TIME && tier != QualityTier::HIGH) {
+            changeTier(static_cast<QualityTier>(static_cast<int>(tier) - 1), average);
+        }
+    } else {
+        // In between the two thresholds - stay where we are
+        calmTime = 0;
+    }
+}
+
+void QualityGovernor::changeTier(QualityTier newTier, float averageMs) {
+    QualityDecision& d = history[historyCount % HISTORY];
+    d.time = clockTime;
+    d.from = tier;
+    d.to = newTier;
+    d.averageWorkMs = averageMs;
+    historyCount++;
+
+    tier = newTier;
+    calmTime = 0;
+    cooldown = CHANGE_COOLDOWN;
+    workCount = 0;  // Judge the new tier on fresh samples only
+    workIndex = 0;
+}
+
+QualitySettings QualityGovernor::getSettings() const {
+    QualitySettings settings;
+    switch (tier) {
+        case QualityTier::HIGH:
+            settings.particleDensity = 1.0f;
+            settings.trailLength = 32;
+            settings.glowEnabled = true;
+            settings.lightingEnabled = true;
+            settings.bloomLevel = 3;
+            settings.renderScale = 1.0f;
+            break;
+        case QualityTier::MEDIUM:
+            settings.particleDensity = 0.6f;
+            settings.trailLength = 24;
+            settings.glowEnabled = true;
+            settings.lightingEnabled = true;
+            settings.bloomLevel = 2;
+            settings.renderScale = 0.85f;
+            break;
+        case QualityTier::LOW:
+            settings.particleDensity = 0.3f;
+            settings.trailLength = 16;
+            settings.glowEnabled = false;
+            settings.lightingEnabled = true;
+            settings.bloomLevel = 1;
+            settings.renderScale = 0.7f;
+            break;
+        case QualityTier::MINIMAL:
+        default:
+            settings.particleDensity = 0.1f;
+            settings.trailLength = 8;
+            settings.glowEnabled = false;
+            settings.lightingEnabled = false;
+            settings.bloomLevel = 0;
+            settings.renderScale = 0.5f;
+            break;
+    }
+    return settings;
+}
+
+const char* QualityGovernor::getTierName(QualityTier t) {
+    switch (t) {
+        case QualityTier::HIGH:    return "HIGH";
+        case QualityTier::MEDIUM:  return "MEDIUM";
+        case QualityTier::LOW:     return "LOW";
+        case QualityTier::MINIMAL: return "MINIMAL";
+    }
+    return "?";
+}
+
+const QualityDecision& QualityGovernor::getDecision(int i) const {
+    int first = historyCount > HISTORY ? historyCount - HISTORY : 0;
+    return history[(first + i) % HISTORY];
+}
@@ -0,0 +1,126 @@
+#include "Replay.h"
+#include <cstring>
+
+namespace {
+    const char MAGIC[4] = {'C', 'S', 'R', 'P'};
+
+    const uint8_t FLAG_STRESS = 1;
+    const int BEAT_SHIFT = 4;
+
+    // -1, 0 or 1 as two bits, and back
+    uint8_t packAxis(float v) { return v < 0 ? 0 : v > 0 ? 2 : 1; }
+    float unpackAxis(uint8_t bits) { return static_cast<float>(static_cast<int>(bits & 3) - 1); }
+
+    size_t tickSize(uint8_t flags, uint32_t playerCount) {
+        return sizeof(float) + 1 + playerCount + (flags >> BEAT_SHIFT) * sizeof(float);
+    }
+}
+
+Replay::Replay() : header(), readPosition(0) {}
+
+void Replay::begin(uint32_t seed, int playerCount, const DifficultySettings& difficulty,
+                   const std::string& name, size_t reserveBytes) {
+    header = ReplayHeader();
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.seed = seed;
+    header.playerCount = static_cast<uint32_t>(playerCount);
+    header.difficulty = difficulty;
+    std::strncpy(header.name, name.c_str(), sizeof(header.name) - 1);
+    ticks.clear();
+    ticks.reserve(reserveBytes);
+    readPosition = 0;
+}
+
+void Replay::record(const SimInput& in) {
+    int beats = in.beatCount < SimInput::MAX_BEATS ? in.beatCount : SimInput::MAX_BEATS;
+    uint8_t flags = static_cast<uint8_t>((in.stressPattern ? FLAG_STRESS : 0) | (beats << BEAT_SHIFT));
+
+    uint8_t bytes[sizeof(float) + 1 + MAX_PLAYERS + SimInput::MAX_BEATS * sizeof(float)];
+    size_t size = 0;
+    std::memcpy(bytes, &in.dt, sizeof(float));
+    size += sizeof(float);
+    bytes[size++] = flags;
+    for (uint32_t p = 0; p < header.playerCount; p++) {
+        const InputState& s = in.players[p];
+        bytes[size++] = static_cast<uint8_t>(packAxis(s.move.x) | (packAxis(s.move.y) << 2) |
+                                             (s.dash ? 16 : 0) | (s.changeColor ? 32 : 0));
+    }
+    std::memcpy(bytes + size, in.beats, beats * sizeof(float));
+    size += beats * sizeof(float);
+
+    ticks.insert(ticks.end(), bytes, bytes + size);
+    header.ticks++;
+}
+
+void Replay::finish(int score, float runTime) {
+    header.score = score;
+    header.runTime = runTime;
+}
+
+void Replay::serialize(std::vector<uint8_t>& out) const {
+    out.resize(sizeof(header) + ticks.size());
+    std::memcpy(out.data(), &header, sizeof(header));
+    if (!ticks.empty()) std::memcpy(out.data() + sizeof(header), ticks.data(), ticks.size());
+}
+
+bool Replay::parse(const uint8_t* data, size_t size) {
+    header = ReplayHeader();
+    ticks.clear();
+    readPosition = 0;
+    if (size < sizeof(header) || size > MAX_SIZE) return false;
+    ReplayHeader h;
+    std::memcpy(&h, data, sizeof(h));
+    if (std::memcmp(h.magic, MAGIC, sizeof(MAGIC)) != 0 || h.version != VERSION ||
+        h.playerCount < 1 || h.playerCount > MAX_PLAYERS) {
+        return false;
+    }
+
+    // Walk the ticks once, so playback can trust every one of them
+    const uint8_t* p = data + sizeof(h);
+    const uint8_t* end = data + size;
+    uint32_t count = 0;
+    while (p < end) {
+        if (end - p < static_cast<ptrdiff_t>(sizeof(float) + 1)) return false;
+        uint8_t flags = p[sizeof(float)];
+        size_t length = tickSize(flags, h.playerCount);
+        if ((flags >> BEAT_SHIFT) > SimInput::MAX_BEATS || static_cast<size_t>(end - p) < length) return false;
+        float dt;
+        std::memcpy(&dt, p, sizeof(float));
+        if (!(dt >= 0.0f && dt < 60.0f)) return false;    // Also turns away NaN
+        p += length;
+        count++;
+    }
+    if (count != h.ticks) return false;
+
+    header = h;
+    header.name[sizeof(header.name) - 1] = '\0';
+    ticks.assign(data + sizeof(header), end);
+    return true;
+}
+
+bool Replay::next(SimInput& in) {
+    if (readPosition >= ticks.size()) return false;
+    const uint8_t* p = ticks.data() + readPosition;
+
+    std::memcpy(&in.dt, p, sizeof(float));
+    uint8_t flags = p[sizeof(float)];
+    p += sizeof(float) + 1;
+    in.stressPattern = (flags & FLAG_STRESS) != 0;
+    in.beatCount = flags >> BEAT_SHIFT;
+    for (int i = 0; i < MAX_PLAYERS; i++) {
+        InputState& s = in.players[i];
+        uint8_t bits = i < static_cast<int>(header.playerCount) ? *p++ : 0x05;    // 0x05: standing still
+        s.move = sf::Vector2f(unpackAxis(bits), unpackAxis(bits >> 2));
+        s.dash = (bits & 16) != 0;
+        s.changeColor = (bits & 32) != 0;
+    }
+    std::memcpy(in.beats, p, in.beatCount * sizeof(float));
+
+    readPosition += tickSize(flags, header.playerCount);
+    return true;
+}
+
+std::string Replay::getName() const {
+    return header.name;
+}
@@ -0,0 +1,572 @@
+#include "Simulation.h"
+#include "AllocTracker.h"
+#include "ParticleSystem.h"
+#include <algorithm>
+
+namespace {
+    const Fixed START_SPEED = Fixed::fromFloat(OBSTACLE_SPEED);
+    const Fixed POWERUP_SPEED_FACTOR = Fixed::fromFloat(0.8f);
+    const Fixed COLOR_WALL_SPEED_FACTOR = Fixed::fromFloat(0.7f);
+    const Fixed HALF_OBSTACLE_WIDTH = Fixed::fromFloat(OBSTACLE_WIDTH / 2);
+    const Fixed NEVER = Fixed(2);         // Later than any time within a tick
+
+    // Config.h times on the game clock
+    const Fixed DASH_TIME = Fixed::fromFloat(DASH_DURATION);
+    const Fixed DASH_COOLDOWN_TIME = Fixed::fromFloat(DASH_COOLDOWN);
+    const Fixed COMBO_TIME = Fixed::fromFloat(COMBO_TIMEOUT);
+    const Fixed POWERUP_INTERVAL = Fixed::fromFloat(POWERUP_SPAWN_TIME);
+    const Fixed PATTERN_INTERVAL = Fixed::fromFloat(PATTERN_SPAWN_TIME);
+    const Fixed BEAT_MIN_GAP = Fixed::fromFloat(BEAT_MIN_SPACING);
+    const Fixed BEAT_FALLBACK_GAP = Fixed::fromFloat(BEAT_FALLBACK_SPACING);
+    const Fixed NO_BEAT_YET = Fixed(-1000);
+}
+
+Simulation::Simulation() : timers(MAX_TIMERS) {
+    playerCount = 1;
+    over = true;
+    deathCause = DeathCause::OBSTACLE;
+    journal = nullptr;
+    patternLibrary = nullptr;
+    bulletUpdateMs = 0;
+    score = 0;
+    combo = 0;
+    runTime = Fixed();
+    lastObstacleSpawn = Fixed();
+    lastColorWallSpawn = Fixed();
+    lastComboTime = Fixed();
+    lastBeatTime = NO_BEAT_YET;
+    invulnerable = false;
+    for (int p = 0; p < MAX_PLAYERS; p++) {
+        dashReadyTime[p] = Fixed();
+        playerAlive[p] = false;
+        players[p].setOutlineColor(PLAYER_OUTLINE_COLORS[p]);
+    }
+
+    obstacleBoxes.reserve(256);
+    obstacleSweeps.reserve(64);
+
+    // Create the objects up front; they are recycled instead of deleted
+    // (with room to spare so the vectors themselves never grow)
+    obstacles.reserve((OBSTACLE_POOL_SIZE + COLOR_WALL_POOL_SIZE) * 2);
+    powerUps.reserve(POWERUP_POOL_SIZE * 2);
+    obstaclePool.reserve(OBSTACLE_POOL_SIZE * 2);
+    colorWallPool.reserve(COLOR_WALL_POOL_SIZE * 2);
+    powerUpPool.reserve(POWERUP_POOL_SIZE * 2);
+    for (int i = 0; i < OBSTACLE_POOL_SIZE; i++) {
+        obstaclePool.push_back(std::make_unique<Obstacle>(FixedVec2(), COLOR_RED, Fixed()));
+    }
+    for (int i = 0; i < COLOR_WALL_POOL_SIZE; i++) {
+        colorWallPool.push_back(std::make_unique<ColorWallObstacle>(FixedVec2(), COLOR_RED, Fixed()));
+    }
+    for (int i = 0; i < POWERUP_POOL_SIZE; i++) {
+        powerUpPool.push_back(std::make_unique<PowerUp>(FixedVec2(), PowerUpType::SHIELD, Fixed()));
+    }
+}
+
+void Simulation::setPatternLibrary(const PatternLibrary* library) {
+    patternLibrary = library;
+    patterns.setLibrary(library);
+    patternRotation.clear();
+    if (!library) return;
+    for (int i = 0; i < library->getPatternCount(); i++) {
+        if (library->getPattern(i).name.compare(0, 5, "test_") != 0) {
+            patternRotation.push_back(i);
+        }
+    }
+}
+
+void Simulation::setDifficulty(const DifficultySettings& settings) {
+    difficultySettings = settings;
+    difficulty.reset(difficultySettings);
+}
+
+void Simulation::start(int count, uint32_t seed) {
+    score = 0;
+    combo = 0;
+    difficulty.reset(difficultySettings);
+
+    // Drops every pending spawn and dash of the old run
+    timers.reset();
+    patterns.reset();
+    bullets.clear();
+    effects.clear();
+
+    // Everything goes back to the pools for the new run
+    for (auto& obstacle : obstacles) obstacle->deactivate();
+    for (auto& powerUp : powerUps) powerUp->deactivate();
+    recycleInactive();
+
+    // Spread the players out vertically, each starting on a different color
+    playerCount = count;
+    for (int p = 0; p < playerCount; p++) {
+        Fixed y = Fixed(WINDOW_HEIGHT * (p + 1)) / Fixed(playerCount + 1);
+        players[p].reset(FixedVec2(Fixed(WINDOW_WIDTH / 4), y), p);
+        playerAlive[p] = true;
+        dashReadyTime[p] = Fixed();
+    }
+    for (int p = playerCount; p < MAX_PLAYERS; p++) {
+        playerAlive[p] = false;
+    }
+    over = false;
+    deathCause = DeathCause::OBSTACLE;
+    runTime = Fixed();
+    lastBeatTime = NO_BEAT_YET;
+    lastObstacleSpawn = Fixed();
+    lastColorWallSpawn = Fixed();
+    lastComboTime = Fixed();
+
+    // Same seed, same inputs, same run
+    random.seed(seed);
+    patterns.seed(seed ^ 0x9E3779B9u);     // Same generator, so not the same numbers
+
+    startTimers();
+    log(GameEventType::RUN_START, runTime);
+}
+
+void Simulation::step(const SimInput& in) {
+    if (over) return;
+
+    if (in.stressPattern && patternLibrary) {
+        startPattern(patternLibrary->findPattern(STRESS_PATTERN));
+    }
+    for (int i = 0; i < in.beatCount; i++) {
+        onBeat(in.beats[i]);
+    }
+
+    // The simulation steps in fixed-point; the frame time is the only float going in
+    Fixed step = Fixed::fromFloat(in.dt);
+
+    // Run every timed sequence that is due (spawners, dash, combo)
+    timers.advance(step);
+    runTime = timers.now();
+
+    for (int p = 0; p < playerCount; p++) {
+        if (!playerAlive[p]) continue;
+        Player& player = players[p];
+
+        // Actions come from the sampled input state (dash and color change)
+        if (in.players[p].dash && !player.isDashing() && runTime >= dashReadyTime[p]) {
+            dashSequence(p);
+            log(GameEventType::DASH, runTime, player.getPosition().x, player.getPosition().y, p);
+            // Kicked out behind the player
+            FixedVec2 direction = player.getDashDirection();
+            emitParticles(effectIds.dash, player.getPosition(), COLOR_BLUE,
+                          ParticleSystem::directionOf(-direction.toVector2f()));
+            effects.sound(SoundId::DASH);
+        }
+
+        // Change player color when C key is pressed
+        if (in.players[p].changeColor) {
+            player.changeColor();
+            log(GameEventType::COLOR_CHANGE, runTime, player.getPosition().x, player.getPosition().y, p);
+            emitParticles(effectIds.colorChange, player.getPosition(), player.getColor());
+        }
+
+        player.update(step, in.players[p]);
+    }
+
+    // Update obstacles (spawning is done by the spawner coroutines)
+    for (auto& obstacle : obstacles) {
+        obstacle->update(step);
+    }
+
+    for (auto& powerUp : powerUps) {
+        powerUp->update(step);
+    }
+
+    updatePatterns(step);
+
+    {
+        AllocPhaseScope phase(AllocPhase::COLLISION);
+        checkCollisions(step);
+    }
+
+    updateDifficulty();
+
+    // Move inactive obstacles and power-ups back to their pools
+    recycleInactive();
+}
+
+// Only simulation state goes in - particles, shake and the camera are
+// cosmetic and belong to the game
+void Simulation::hashState(StateHashLog& log, const SimInput& in) const {
+    log.beginTick();
+
+    StateHash::Stream& playerHash = log.field(StateField::PLAYERS);
+    for (int p = 0; p < playerCount; p++) players[p].hashState(playerHash);
+
+    StateHash::Stream& obstacleHash = log.field(StateField::OBSTACLES);
+    obstacleHash.add(static_cast<uint32_t>(obstacles.size()));
+    for (const auto& obstacle : obstacles) obstacle->hashState(obstacleHash);
+
+    StateHash::Stream& powerUpHash = log.field(StateField::POWERUPS);
+    powerUpHash.add(static_cast<uint32_t>(powerUps.size()));
+    for (const auto& powerUp : powerUps) powerUp->hashState(powerUpHash);
+
+    bullets.hashState(log.field(StateField::BULLETS));
+    StateHash::Stream& timerHash = log.field(StateField::TIMERS);
+    timers.hashState(timerHash);
+    timerHash.add(lastObstacleSpawn);
+    timerHash.add(lastColorWallSpawn);
+    timerHash.add(lastBeatTime);
+
+    StateHash::Stream& difficultyHash = log.field(StateField::DIFFICULTY);
+    difficultyHash.add(difficulty.getObstacleSpeed());
+    difficultyHash.add(difficulty.getSpawnTime());
+
+    StateHash::Stream& scoreHash = log.field(StateField::SCORE);
+    scoreHash.add(score);
+    scoreHash.add(combo);
+    scoreHash.add(runTime);
+    scoreHash.add(lastComboTime);
+    for (int p = 0; p < playerCount; p++) {
+        scoreHash.add(playerAlive[p]);
+        scoreHash.add(dashReadyTime[p]);
+    }
+
+    StateHash::Stream& rngHash = log.field(StateField::RNG);
+    rngHash.add(random.getState());
+    rngHash.add(patterns.getRandomState());
+
+    StateHash::Stream& inputHash = log.field(StateField::INPUT);
+    for (int p = 0; p < playerCount; p++) {
+        inputHash.add(in.players[p].move.x);
+        inputHash.add(in.players[p].move.y);
+        inputHash.add(in.players[p].dash);
+        inputHash.add(in.players[p].changeColor);
+    }
+    inputHash.add(in.stressPattern);
+    for (int i = 0; i < in.beatCount; i++) inputHash.add(in.beats[i]);
+
+    log.endTick(Fixed::fromFloat(in.dt).raw());
+}
+
+void Simulation::recycleInactive() {
+    size_t kept = 0;
+    for (size_t i = 0; i < obstacles.size(); i++) {
+        if (obstacles[i]->active()) {
+            obstacles[kept++] = std::move(obstacles[i]);
+        } else if (obstacles[i]->isColorWall()) {
+            colorWallPool.push_back(std::move(obstacles[i]));
+        } else {
+            obstaclePool.push_back(std::move(obstacles[i]));
+        }
+    }
+    obstacles.resize(kept);
+
+    kept = 0;
+    for (size_t i = 0; i < powerUps.size(); i++) {
+        if (powerUps[i]->active()) {
+            powerUps[kept++] = std::move(powerUps[i]);
+        } else {
+            powerUpPool.push_back(std::move(powerUps[i]));
+        }
+    }
+    powerUps.resize(kept);
+}
+
+void Simulation::updatePatterns(Fixed step) {
+    // Patterns speed up with the rest of the game
+    patterns.update(step, bullets, difficulty.getObstacleSpeed() / START_SPEED);
+    for (int i = 0; i < patterns.getWallRequestCount(); i++) {
+        spawnColorWall(BulletField::getPaletteColor(patterns.getWallRequest(i)));
+    }
+
+    sf::Clock timer;
+    bullets.update(step);
+    bulletUpdateMs = timer.getElapsedTime().asMicroseconds() / 1000.0f;
+}
+
+void Simulation::startPattern(int index) {
+    if (patterns.start(index)) {
+        log(GameEventType::SPAWN_PATTERN, runTime, 0, 0, index);
+    }
+}
+
+void Simulation::onBeat(float strength) {
+    lastBeatTime = runTime;
+
+    if (strength >= BEAT_STRONG && runTime - lastColorWallSpawn >= Fixed::fromFloat(difficultySettings.colorWallSpawnTime)) {
+        spawnColorWall();
+        lastColorWallSpawn = runTime;
+    } else if (runTime - lastObstacleSpawn >= difficulty.getSpawnTime() * BEAT_MIN_GAP) {
+        spawnObstacle();
+        lastObstacleSpawn = runTime;
+    }
+}
+
+void Simulation::startTimers() {
+    obstacleSpawner();
+    colorWallSpawner();
+    powerUpSpawner();
+    if (!patternRotation.empty()) {
+        patternSpawner();
+    }
+    comboWatcher();
+}
+
+// With beats coming in, the spawners only fill long gaps in the music
+Task Simulation::obstacleSpawner() {
+    while (true) {
+        Fixed spawnTime = difficulty.getSpawnTime();
+        Fixed interval = beatsActive() ? spawnTime * BEAT_FALLBACK_GAP : spawnTime;
+        Fixed due = lastObstacleSpawn + interval;
+        if (timers.now() >= due) {
+            spawnObstacle();
+            lastObstacleSpawn = timers.now();
+            continue;
+        }
+        // A beat may have spawned in the meantime - then we just check again
+        co_await timers.at(due);
+    }
+}
+
+Task Simulation::colorWallSpawner() {
+    while (true) {
+        Fixed wallTime = Fixed::fromFloat(difficultySettings.colorWallSpawnTime);
+        Fixed interval = beatsActive() ? wallTime * BEAT_FALLBACK_GAP : wallTime;
+        Fixed due = lastColorWallSpawn + interval;
+        if (timers.now() >= due) {
+            spawnColorWall();
+            lastColorWallSpawn = timers.now();
+            continue;
+        }
+        co_await timers.at(due);
+    }
+}
+
+Task Simulation::powerUpSpawner() {
+    while (true) {
+        co_await timers.after(POWERUP_INTERVAL);
+        spawnPowerUp();
+    }
+}
+
+Task Simulation::patternSpawner() {
+    while (true) {
+        co_await timers.after(PATTERN_INTERVAL);
+        startPattern(patternRotation[random.below(static_cast<int>(patternRotation.size()))]);
+    }
+}
+
+// The combo is lost after COMBO_TIMEOUT seconds without a dodge
+Task Simulation::comboWatcher() {
+    while (true) {
+        co_await timers.at(lastComboTime + COMBO_TIME);
+        if (timers.now() >= lastComboTime + COMBO_TIME) {
+            if (combo > 0) {
+                log(GameEventType::COMBO_BREAK, timers.now(), 0, 0, combo);
+            }
+            combo = 0;
+            lastComboTime = timers.now();
+        }
+    }
+}
+
+Task Simulation::dashSequence(int p) {
+    players[p].startDash();
+    dashReadyTime[p] = timers.now() + DASH_COOLDOWN_TIME;
+    co_await timers.after(DASH_TIME);
+    players[p].endDash();
+}
+
+// True while the music has been giving us beats recently
+bool Simulation::beatsActive() const {
+    return ENABLE_BEAT_SPAWNING && timers.now() - lastBeatTime < difficulty.getSpawnTime() * BEAT_FALLBACK_GAP;
+}
+
+void Simulation::playerDown(int p, DeathCause cause, Fixed time) {
+    // The allocation test plays unattended, so the player can't die
+    if (invulnerable || !playerAlive[p]) return;
+
+    playerAlive[p] = false;
+    players[p].rewind(time);
+    emitParticles(effectIds.explosion, players[p].getPosition(), COLOR_RED);
+
+    // The run goes on as long as anyone is left
+    for (int i = 0; i < playerCount; i++) {
+        if (playerAlive[i]) {
+            effects.shake(10.0f);
+            return;
+        }
+    }
+    gameOver(cause, p);
+}
+
+void Simulation::gameOver(DeathCause cause, int lastPlayer) {
+    over = true;
+    deathCause = cause;
+    sf::Vector2f position = players[lastPlayer].getPosition();
+    log(GameEventType::GAME_OVER, runTime, position.x, position.y, static_cast<int32_t>(cause));
+    log(GameEventType::COMBO_BREAK, runTime, 0, 0, combo);
+    effects.shake(20.0f);
+}
+
+void Simulation::spawnObstacle() {
+    FixedVec2 pos(Fixed::fromFloat(WINDOW_WIDTH + OBSTACLE_WIDTH),
+                  random.uniform(Fixed::fromFloat(OBSTACLE_HEIGHT), Fixed::fromFloat(WINDOW_HEIGHT - OBSTACLE_HEIGHT)));
+    sf::Color color = getRandomColor();
+
+    if (obstaclePool.empty()) {
+        obstacles.push_back(std::make_unique<Obstacle>(pos, color, difficulty.getObstacleSpeed()));
+    } else {
+        obstaclePool.back()->reset(pos, color, difficulty.getObstacleSpeed());
+        obstacles.push_back(std::move(obstaclePool.back()));
+        obstaclePool.pop_back();
+    }
+    log(GameEventType::SPAWN_OBSTACLE, runTime, pos.x.toFloat(), pos.y.toFloat());
+}
+
+void Simulation::spawnPowerUp() {
+    FixedVec2 pos(Fixed(WINDOW_WIDTH + 30), random.uniform(Fixed(50), Fixed(WINDOW_HEIGHT - 50)));
+    PowerUpType type = static_cast<PowerUpType>(random.below(3));
+
+    if (powerUpPool.empty()) {
+        powerUps.push_back(std::make_unique<PowerUp>(pos, type, difficulty.getObstacleSpeed() * POWERUP_SPEED_FACTOR));
+    } else {
+        powerUpPool.back()->reset(pos, type, difficulty.getObstacleSpeed() * POWERUP_SPEED_FACTOR);
+        powerUps.push_back(std::move(powerUpPool.back()));
+        powerUpPool.pop_back();
+    }
+    log(GameEventType::SPAWN_POWERUP, runTime, pos.x.toFloat(), pos.y.toFloat(), static_cast<int32_t>(type));
+}
+
+void Simulation::spawnColorWall() {
+    spawnColorWall(getRandomColor());
+}
+
+void Simulation::spawnColorWall(sf::Color wallColor) {
+    // Spawn a color wall obstacle in the center of the screen
+    // Player must match their color to pass through it
+    // Spawn further off-screen because color wall is wider (OBSTACLE_WIDTH * 3)
+    FixedVec2 pos(Fixed::fromFloat(WINDOW_WIDTH + OBSTACLE_WIDTH * 2), Fixed(WINDOW_HEIGHT / 2));
+
+    // Use ColorWallObstacle which inherits from Obstacle (POLYMORPHISM)
+    if (colorWallPool.empty()) {
+        obstacles.push_back(std::make_unique<ColorWallObstacle>(pos, wallColor, difficulty.getObstacleSpeed() * COLOR_WALL_SPEED_FACTOR));
+    } else {
+        colorWallPool.back()->reset(pos, wallColor, difficulty.getObstacleSpeed() * COLOR_WALL_SPEED_FACTOR);
+        obstacles.push_back(std::move(colorWallPool.back()));
+        colorWallPool.pop_back();
+    }
+    log(GameEventType::SPAWN_COLOR_WALL, runTime, pos.x.toFloat(), pos.y.toFloat());
+}
+
+void Simulation::checkCollisions(Fixed step) {
+    // Everyone still in the run is tested in the same pass over the world,
+    // along the path they moved this tick (times are fractions of the tick)
+    int ids[MAX_PLAYERS];
+    FixedRect playerStarts[MAX_PLAYERS];
+    FixedRect playerBounds[MAX_PLAYERS];
+    sf::Color playerColors[MAX_PLAYERS];
+    Fixed deathTimes[MAX_PLAYERS];
+    int count = 0;
+    for (int p = 0; p < playerCount; p++) {
+        if (!playerAlive[p]) continue;
+        ids[count] = p;
+        playerStarts[count] = players[p].getPreviousBounds();
+        playerBounds[count] = players[p].getBounds();
+        playerColors[count] = players[p].getColor();
+        deathTimes[count] = NEVER;
+        count++;
+    }
+    if (count == 0) return;
+
+    // Swept test against the moving, turning obstacles, all in one batch
+    obstacleBoxes.clear();
+    for (const auto& obstacle : obstacles) {
+        obstacleBoxes.add(obstacle->getFixedPosition(), obstacle->getHalfSize(),
+                          obstacle->getCosRotation(), obstacle->getSinRotation(),
+                          obstacle->getPreviousPosition(), obstacle->getPreviousCos(), obstacle->getPreviousSin());
+    }
+    Collision::sweepBatch(playerStarts, playerBounds, count, obstacleBoxes, obstacleSweeps);
+
+    // A player's first deadly contact is when they go down. Color walls let a
+    // player of the same color pass through.
+    for (const SweepHit& hit : obstacleSweeps) {
+        const auto& obstacle = obstacles[hit.box];
+        if (!obstacle->active() || deathTimes[hit.player] != NEVER) continue;
+        if (obstacle->isColorWall() && playerColors[hit.player] == obstacle->getColor()) continue;
+        deathTimes[hit.player] = hit.time;
+    }
+
+    // Score for passing obstacles - the moment an obstacle's back edge gets
+    // behind a player who is still alive by then. Every player it passes counts.
+    for (const auto& obstacle : obstacles) {
+        if (!obstacle->active()) continue;
+        for (int b = 0; b < count; b++) {
+            const Player& player = players[ids[b]];
+            Fixed before = obstacle->getPreviousPosition().x + HALF_OBSTACLE_WIDTH - player.getPreviousPosition().x;
+            Fixed after = obstacle->getFixedPosition().x + HALF_OBSTACLE_WIDTH - player.getFixedPosition().x;
+            Fixed passTime;
+            if (!Collision::crossing(before, after, passTime) || passTime >= deathTimes[b]) continue;
+            Fixed eventTime = runTime - step * (Fixed(1) - passTime);
+
+            // Give bonus points for passing color walls
+            if (obstacle->isColorWall()) {
+                score += SCORE_COLOR_WALL_PASS;
+                log(GameEventType::WALL_PASS, eventTime, obstacle->getPosition().x,
+                    obstacle->getPosition().y, score);
+                emitParticles(effectIds.wallPass, obstacle->getPosition(), obstacle->getColor());
+                effects.sound(SoundId::WALL_PASS);  // "Bababooey"!
+            } else {
+                score += SCORE_PER_DODGE;
+                log(GameEventType::DODGE, eventTime, obstacle->getPosition().x,
+                    obstacle->getPosition().y, score);
+                emitParticles(effectIds.dodge, obstacle->getPosition(), obstacle->getColor());
+            }
+            combo++;
+            lastComboTime = eventTime;
+        }
+    }
+
+    // Players go down in the order they were hit, where they were hit
+    for (const SweepHit& hit : obstacleSweeps) {
+        if (deathTimes[hit.player] != hit.time || !playerAlive[ids[hit.player]]) continue;
+        const auto& obstacle = obstacles[hit.box];
+        if (obstacle->isColorWall() && playerColors[hit.player] == obstacle->getColor()) continue;
+        playerDown(ids[hit.player], obstacle->isColorWall() ? DeathCause::COLOR_WALL : DeathCause::OBSTACLE, hit.time);
+    }
+    if (over) return;
+
+    // Bullets of any other color than the player's are deadly
+    unsigned bulletHits = bullets.findHits(playerBounds, playerColors, count);
+    for (int b = 0; b < count; b++) {
+        if ((bulletHits >> b) & 1) {
+            playerDown(ids[b], DeathCause::PATTERN);
+        }
+    }
+    if (over) return;
+
+    // Check power-up collisions (whoever touches it first)
+    for (auto& powerUp : powerUps) {
+        if (!powerUp->active()) continue;
+        for (int b = 0; b < count; b++) {
+            Fixed time;
+            if (playerAlive[ids[b]] && Collision::sweepBoxes(playerStarts[b], playerBounds[b], powerUp->getPreviousBounds(),
+                                                             powerUp->getBounds(), time)) {
+                score += SCORE_POWERUP;
+                log(GameEventType::POWERUP_PICKUP, runTime, powerUp->getPosition().x,
+                    powerUp->getPosition().y, static_cast<int32_t>(powerUp->getType()));
+                emitParticles(effectIds.pickup, powerUp->getPosition(), COLOR_YELLOW);
+                powerUp->deactivate();
+                break;
+            }
+        }
+    }
+}
+
+void Simulation::updateDifficulty() {
+    // Increase speed based on score (only once per DIFFICULTY_STEP_SCORE points)
+    if (difficulty.update(score)) {
+        // x = new obstacle speed, y = new spawn interval in milliseconds
+        log(GameEventType::DIFFICULTY_STEP, runTime, difficulty.getObstacleSpeed().toFloat(),
+            difficulty.getSpawnTime().toFloat() * 1000.0f, score);
+    }
+}
+
+sf::Color Simulation::getRandomColor() {
+    sf::Color colors[] = {COLOR_RED, COLOR_BLUE, COLOR_YELLOW, 
+                         COLOR_GREEN, COLOR_PURPLE, COLOR_ORANGE};
+    return colors[random.below(6)];
+}
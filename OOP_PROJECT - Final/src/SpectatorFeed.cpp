@@ -0,0 +1,200 @@
+#include "SpectatorFeed.h"
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <new>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "the seqlock needs lock-free atomics in shared memory");
+
+namespace {
+    const uint32_t RING_MAGIC = 0x43535046;    // "CSPF"
+    const int READ_ATTEMPTS = 4;
+
+    // Copy what a slot's header says is there; counts are clamped because a
+    // torn header can say anything (the sequence check throws it away after)
+    void copyFrame(SpectatorFrame& out, const SpectatorFrame& in) {
+        std::memcpy(&out, &in, offsetof(SpectatorFrame, entities));
+        if (out.entityCount > SpectatorFrame::MAX_ENTITIES) out.entityCount = SpectatorFrame::MAX_ENTITIES;
+        if (out.bulletCount > MAX_BULLETS) out.bulletCount = static_cast<uint32_t>(MAX_BULLETS);
+        if (out.particleCount > MAX_PARTICLES) out.particleCount = static_cast<uint32_t>(MAX_PARTICLES);
+        std::memcpy(out.entities, in.entities, out.entityCount * sizeof(SpectatorEntity));
+        std::memcpy(out.bullets, in.bullets, out.bulletCount * sizeof(SpectatorDot));
+        std::memcpy(out.particles, in.particles, out.particleCount * sizeof(SpectatorDot));
+    }
+}
+
+SpectatorFeed::SpectatorFeed() : ring(nullptr), handle(nullptr), fd(-1), writing(0), frameCount(0) {}
+
+SpectatorFeed::~SpectatorFeed() {
+    close();
+}
+
+bool SpectatorFeed::open() {
+    if (ring) return true;
+    void* memory = nullptr;
+
+#ifdef _WIN32
+    uint64_t size = sizeof(SpectatorRing);
+    HANDLE mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+                                        static_cast<DWORD>(size >> 32), static_cast<DWORD>(size),
+                                        SPECTATOR_FEED_NAME);
+    if (mapping) {
+        memory = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, sizeof(SpectatorRing));
+        if (!memory) CloseHandle(mapping);
+        else handle = mapping;
+    }
+#else
+    // A fresh segment each time, so a spectator never sees an old game's layout
+    shm_unlink(SPECTATOR_FEED_NAME);
+    fd = shm_open(SPECTATOR_FEED_NAME, O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fd >= 0 && ftruncate(fd, sizeof(SpectatorRing)) == 0) {
+        memory = mmap(nullptr, sizeof(SpectatorRing), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (memory == MAP_FAILED) memory = nullptr;
+    }
+    if (!memory && fd >= 0) {
+        ::close(fd);
+        fd = -1;
+        shm_unlink(SPECTATOR_FEED_NAME);
+    }
+#endif
+
+    if (!memory) {
+        std::cerr << "Spectator feed: cannot create shared memory " << SPECTATOR_FEED_NAME << std::endl;
+        return false;
+    }
+
+    std::memset(memory, 0, sizeof(SpectatorRing));
+    ring = new (memory) SpectatorRing();
+    ring->frameSize = sizeof(SpectatorFrame);
+    std::atomic_thread_fence(std::memory_order_release);
+    ring->magic = RING_MAGIC;
+    std::cout << "Spectator feed: " << SPECTATOR_FEED_NAME << " ("
+              << sizeof(SpectatorRing) / 1024 << " KB)" << std::endl;
+    return true;
+}
+
+void SpectatorFeed::close() {
+    if (!ring) return;
+#ifdef _WIN32
+    UnmapViewOfFile(ring);
+    CloseHandle(static_cast<HANDLE>(handle));
+    handle = nullptr;
+#else
+    munmap(ring, sizeof(SpectatorRing));
+    ::close(fd);
+    fd = -1;
+    shm_unlink(SPECTATOR_FEED_NAME);
+#endif
+    ring = nullptr;
+}
+
+SpectatorFrame* SpectatorFeed::beginFrame() {
+    // Never the newest slot - that's the one spectators are most likely copying
+    writing = (ring->latest.load(std::memory_order_relaxed) + 1) % SPECTATOR_SLOTS;
+    SpectatorRing::Slot& slot = ring->slots[writing];
+    slot.sequence.store(slot.sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot.frame.frame = ++frameCount;
+    return &slot.frame;
+}
+
+void SpectatorFeed::publish() {
+    SpectatorRing::Slot& slot = ring->slots[writing];
+    slot.sequence.store(slot.sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    ring->latest.store(writing, std::memory_order_release);
+}
+
+SpectatorView::SpectatorView() : ring(nullptr), handle(nullptr), fd(-1), lastFrame(0) {}
+
+SpectatorView::~SpectatorView() {
+    close();
+}
+
+bool SpectatorView::open() {
+    if (ring) return true;
+    const void* memory = nullptr;
+
+#ifdef _WIN32
+    HANDLE mapping = OpenFileMappingA(FILE_MAP_READ, FALSE, SPECTATOR_FEED_NAME);
+    if (!mapping) return false;
+    // Fails if the game's mapping is smaller than ours
+    memory = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, sizeof(SpectatorRing));
+    if (!memory) {
+        CloseHandle(mapping);
+        return false;
+    }
+    handle = mapping;
+#else
+    fd = shm_open(SPECTATOR_FEED_NAME, O_RDONLY, 0);
+    if (fd < 0) return false;
+    struct stat info;
+    if (fstat(fd, &info) == 0 && static_cast<size_t>(info.st_size) >= sizeof(SpectatorRing)) {
+        memory = mmap(nullptr, sizeof(SpectatorRing), PROT_READ, MAP_SHARED, fd, 0);
+        if (memory == MAP_FAILED) memory = nullptr;
+    }
+    if (!memory) {
+        ::close(fd);
+        fd = -1;
+        return false;
+    }
+#endif
+
+    ring = static_cast<const SpectatorRing*>(memory);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (ring->magic != RING_MAGIC || ring->frameSize != sizeof(SpectatorFrame)) {
+        std::cerr << "Spectator feed: the game was built with a different frame layout" << std::endl;
+        close();
+        return false;
+    }
+    lastFrame = 0;
+    return true;
+}
+
+void SpectatorView::close() {
+    if (!ring) return;
+#ifdef _WIN32
+    UnmapViewOfFile(ring);
+    CloseHandle(static_cast<HANDLE>(handle));
+    handle = nullptr;
+#else
+    munmap(const_cast<SpectatorRing*>(ring), sizeof(SpectatorRing));
+    ::close(fd);
+    fd = -1;
+#endif
+    ring = nullptr;
+}
+
+bool SpectatorView::read(SpectatorFrame& out) {
+    if (!ring) return false;
+
+    // Classic seqlock read: the copy races with the game on purpose, and only
+    // counts if the slot's sequence was even and unchanged around it
+    for (int attempt = 0; attempt < READ_ATTEMPTS; attempt++) {
+        const SpectatorRing::Slot& slot = ring->slots[ring->latest.load(std::memory_order_acquire) % SPECTATOR_SLOTS];
+        uint32_t before = slot.sequence.load(std::memory_order_acquire);
+        if (before == 0) return false;          // Nothing published yet
+        if (before & 1) continue;               // The game lapped us and is writing it
+
+        if (slot.frame.frame == lastFrame) return false;
+        copyFrame(out, slot.frame);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) == before) {
+            lastFrame = out.frame;
+            return true;
+        }
+    }
+    return false;
+}
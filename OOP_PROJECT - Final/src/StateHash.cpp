@@ -0,0 +1,217 @@
+#include "StateHash.h"
+#include <cstring>
+#include <iostream>
+
+namespace {
+    const uint64_t PRIME1 = 0x9E3779B185EBCA87ull;
+    const uint64_t PRIME2 = 0xC2B2AE3D27D4EB4Full;
+    const uint64_t PRIME3 = 0x165667B19E3779F9ull;
+    const uint64_t PRIME4 = 0x85EBCA77C2B2AE63ull;
+    const uint64_t PRIME5 = 0x27D4EB2F165667C5ull;
+
+    const char FILE_MAGIC[4] = {'S', 'T', 'H', '1'};
+    const size_t FILE_BUFFER_SIZE = 256 * 1024;
+
+    inline uint64_t rotl(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+
+    // Little-endian reads; the hashes are only comparable between
+    // little-endian machines (every platform the game ships on)
+    inline uint64_t read64(const unsigned char* p) {
+        uint64_t v;
+        std::memcpy(&v, p, sizeof(v));
+        return v;
+    }
+    inline uint32_t read32(const unsigned char* p) {
+        uint32_t v;
+        std::memcpy(&v, p, sizeof(v));
+        return v;
+    }
+
+    inline uint64_t laneRound(uint64_t acc, uint64_t input) {
+        acc += input * PRIME2;
+        acc = rotl(acc, 31);
+        return acc * PRIME1;
+    }
+
+    inline uint64_t mergeRound(uint64_t acc, uint64_t lane) {
+        acc ^= laneRound(0, lane);
+        return acc * PRIME1 + PRIME4;
+    }
+
+    // Whole stripes straight from the input
+    inline const unsigned char* consumeStripes(uint64_t* lanes, const unsigned char* p, const unsigned char* end) {
+        uint64_t v0 = lanes[0], v1 = lanes[1], v2 = lanes[2], v3 = lanes[3];
+        while (end - p >= 32) {
+            v0 = laneRound(v0, read64(p));
+            v1 = laneRound(v1, read64(p + 8));
+            v2 = laneRound(v2, read64(p + 16));
+            v3 = laneRound(v3, read64(p + 24));
+            p += 32;
+        }
+        lanes[0] = v0; lanes[1] = v1; lanes[2] = v2; lanes[3] = v3;
+        return p;
+    }
+}
+
+void StateHash::Stream::reset(uint64_t s) {
+    seed = s;
+    lanes[0] = s + PRIME1 + PRIME2;
+    lanes[1] = s + PRIME2;
+    lanes[2] = s;
+    lanes[3] = s - PRIME1;
+    total = 0;
+    buffered = 0;
+}
+
+void StateHash::Stream::update(const void* data, size_t size) {
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    const unsigned char* end = p + size;
+    total += size;
+
+    // Top up a partial stripe first
+    if (buffered + size < 32) {
+        std::memcpy(buffer + buffered, p, size);
+        buffered += static_cast<uint32_t>(size);
+        return;
+    }
+    if (buffered > 0) {
+        size_t fill = 32 - buffered;
+        std::memcpy(buffer + buffered, p, fill);
+        consumeStripes(lanes, buffer, buffer + 32);
+        p += fill;
+        buffered = 0;
+    }
+
+    p = consumeStripes(lanes, p, end);
+    buffered = static_cast<uint32_t>(end - p);
+    std::memcpy(buffer, p, buffered);
+}
+
+uint64_t StateHash::Stream::digest() const {
+    uint64_t h;
+    if (total >= 32) {
+        h = rotl(lanes[0], 1) + rotl(lanes[1], 7) + rotl(lanes[2], 12) + rotl(lanes[3], 18);
+        for (int i = 0; i < 4; i++) h = mergeRound(h, lanes[i]);
+    } else {
+        h = seed + PRIME5;
+    }
+    h += total;
+
+    const unsigned char* p = buffer;
+    const unsigned char* end = buffer + buffered;
+    while (end - p >= 8) {
+        h ^= laneRound(0, read64(p));
+        h = rotl(h, 27) * PRIME1 + PRIME4;
+        p += 8;
+    }
+    if (end - p >= 4) {
+        h ^= static_cast<uint64_t>(read32(p)) * PRIME1;
+        h = rotl(h, 23) * PRIME2 + PRIME3;
+        p += 4;
+    }
+    while (p < end) {
+        h ^= *p * PRIME5;
+        h = rotl(h, 11) * PRIME1;
+        p++;
+    }
+
+    h ^= h >> 33;
+    h *= PRIME2;
+    h ^= h >> 29;
+    h *= PRIME3;
+    h ^= h >> 32;
+    return h;
+}
+
+uint64_t StateHash::hash(const void* data, size_t size, uint64_t seed) {
+    Stream stream(seed);
+    stream.update(data, size);
+    return stream.digest();
+}
+
+StateHashLog::StateHashLog() : file(nullptr), run(0), tick(0), last() {}
+
+StateHashLog::~StateHashLog() {
+    close();
+}
+
+bool StateHashLog::open(const std::string& path) {
+    close();
+    file = std::fopen(path.c_str(), "wb");
+    if (!file) {
+        std::cerr << "State hashes: cannot write " << path << std::endl;
+        return false;
+    }
+    fileBuffer.resize(FILE_BUFFER_SIZE);
+    std::setvbuf(file, fileBuffer.data(), _IOFBF, fileBuffer.size());
+
+    uint32_t header[2] = {FILE_VERSION, static_cast<uint32_t>(STATE_FIELD_COUNT)};
+    std::fwrite(FILE_MAGIC, 1, sizeof(FILE_MAGIC), file);
+    std::fwrite(header, sizeof(uint32_t), 2, file);
+    run = 0;
+    tick = 0;
+    std::cout << "State hashes: " << path << std::endl;
+    return true;
+}
+
+void StateHashLog::close() {
+    if (!file) return;
+    std::fclose(file);
+    file = nullptr;
+}
+
+void StateHashLog::beginRun() {
+    run++;
+    tick = 0;
+}
+
+void StateHashLog::beginTick() {
+    for (StateHash::Stream& stream : streams) stream.reset();
+}
+
+void StateHashLog::endTick(int32_t rawStep) {
+    StateHashRecord record;
+    record.run = run;
+    record.tick = tick++;
+    record.step = rawStep;
+    for (int i = 0; i < STATE_FIELD_COUNT; i++) {
+        uint64_t h = streams[i].digest();
+        record.fields[i] = static_cast<uint32_t>(h ^ (h >> 32));
+    }
+    last = record;
+    if (file) std::fwrite(&record, sizeof(record), 1, file);
+}
+
+const char* StateHashLog::getFieldName(StateField f) {
+    switch (f) {
+        case StateField::PLAYERS:    return "players";
+        case StateField::OBSTACLES:  return "obstacles";
+        case StateField::POWERUPS:   return "power-ups";
+        case StateField::BULLETS:    return "bullets";
+        case StateField::TIMERS:     return "timers";
+        case StateField::DIFFICULTY: return "difficulty";
+        case StateField::SCORE:      return "score";
+        case StateField::RNG:        return "rng";
+        case StateField::INPUT:      return "input";
+        default:                     return "?";
+    }
+}
+
+bool StateHashLog::readFile(const std::string& path, std::vector<StateHashRecord>& records) {
+    records.clear();
+    std::FILE* in = std::fopen(path.c_str(), "rb");
+    if (!in) return false;
+
+    char magic[4];
+    uint32_t header[2];
+    bool ok = std::fread(magic, 1, sizeof(magic), in) == sizeof(magic) &&
+              std::memcmp(magic, FILE_MAGIC, sizeof(magic)) == 0 &&
+              std::fread(header, sizeof(uint32_t), 2, in) == 2 &&
+              header[0] == FILE_VERSION && header[1] == static_cast<uint32_t>(STATE_FIELD_COUNT);
+    StateHashRecord record;
+    while (ok && std::fread(&record, sizeof(record), 1, in) == 1) {
+        records.push_back(record);
+    }
+    std::fclose(in);
+    return ok;
+}
@@ -0,0 +1,167 @@
+#include "TimerWheel.h"
+#include "StateHash.h"
+
+namespace {
+    const uint32_t NIL = 0xFFFFFFFF;
+
+    // Fixed-point seconds to the nearest tick
+    uint64_t toTicks(Fixed seconds) {
+        if (seconds.raw() <= 0) return 0;
+        int64_t scaled = static_cast<int64_t>(seconds.raw()) * TimerWheel::TICKS_PER_SECOND;
+        return static_cast<uint64_t>((scaled + (Fixed::ONE / 2)) >> Fixed::FRACTION_BITS);
+    }
+}
+
+void TimerAwaiter::await_suspend(std::coroutine_handle<> handle) {
+    wheel->schedule(tick, handle);
+}
+
+TimerWheel::TimerWheel(size_t reserveTimers) {
+    nodes.reserve(reserveTimers);
+    freeHead = NIL;
+    for (int level = 0; level < LEVELS; level++) {
+        for (int slot = 0; slot < SLOTS; slot++) {
+            heads[level][slot] = NIL;
+        }
+    }
+    currentTick = 0;
+    leftover = 0;
+    pending = 0;
+}
+
+TimerWheel::~TimerWheel() {
+    reset();
+}
+
+TimerAwaiter TimerWheel::after(Fixed seconds) const {
+    return TimerAwaiter{const_cast<TimerWheel*>(this), currentTick + toTicks(seconds)};
+}
+
+TimerAwaiter TimerWheel::at(Fixed seconds) const {
+    return TimerAwaiter{const_cast<TimerWheel*>(this), toTicks(seconds)};
+}
+
+uint32_t TimerWheel::allocateNode() {
+    if (freeHead != NIL) {
+        uint32_t index = freeHead;
+        freeHead = nodes[index].next;
+        return index;
+    }
+    nodes.push_back(Node());
+    return static_cast<uint32_t>(nodes.size() - 1);
+}
+
+void TimerWheel::schedule(uint64_t tick, std::coroutine_handle<> handle) {
+    // Nothing fires on the tick that is already being processed
+    if (tick <= currentTick) tick = currentTick + 1;
+
+    uint32_t index = allocateNode();
+    nodes[index].tick = tick;
+    nodes[index].handle = handle;
+    link(index);
+    pending++;
+}
+
+// Put a node in the slot for its distance from now
+void TimerWheel::link(uint32_t index) {
+    Node& node = nodes[index];
+    uint64_t delta = node.tick > currentTick ? node.tick - currentTick : 0;
+
+    int level = 0;
+    while (level < LEVELS - 1 && delta >= (uint64_t(1) << (SLOT_BITS * (level + 1)))) {
+        level++;
+    }
+    int slot = static_cast<int>((node.tick >> (SLOT_BITS * level)) & (SLOTS - 1));
+
+    node.level = static_cast<uint8_t>(level);
+    node.slot = static_cast<uint8_t>(slot);
+    node.prev = NIL;
+    node.next = heads[level][slot];
+    if (node.next != NIL) nodes[node.next].prev = index;
+    heads[level][slot] = index;
+}
+
+// Move everything in the current slot of a higher level down towards level 0
+void TimerWheel::cascade(int level) {
+    int slot = static_cast<int>((currentTick >> (SLOT_BITS * level)) & (SLOTS - 1));
+    uint32_t index = heads[level][slot];
+    heads[level][slot] = NIL;
+    while (index != NIL) {
+        uint32_t next = nodes[index].next;
+        link(index);
+        index = next;
+    }
+}
+
+void TimerWheel::step() {
+    currentTick++;
+
+    // Higher levels first so their timers can fall all the way down
+    for (int level = LEVELS - 1; level > 0; level--) {
+        uint64_t mask = (uint64_t(1) << (SLOT_BITS * level)) - 1;
+        if ((currentTick & mask) == 0) cascade(level);
+    }
+
+    // Take the whole slot first - resumed coroutines may schedule new timers
+    int slot = static_cast<int>(currentTick & (SLOTS - 1));
+    uint32_t index = heads[0][slot];
+    heads[0][slot] = NIL;
+    while (index != NIL) {
+        uint32_t next = nodes[index].next;
+        std::coroutine_handle<> handle = nodes[index].handle;
+        nodes[index].next = freeHead;
+        freeHead = index;
+        pending--;
+        handle.resume();
+        index = next;
+    }
+}
+
+void TimerWheel::advance(Fixed dt) {
+    if (dt.raw() <= 0) return;
+    leftover += static_cast<int64_t>(dt.raw()) * TICKS_PER_SECOND;
+    int64_t ticks = leftover >> Fixed::FRACTION_BITS;
+    leftover -= ticks << Fixed::FRACTION_BITS;
+
+    for (int64_t i = 0; i < ticks; i++) {
+        step();
+    }
+}
+
+void TimerWheel::reset() {
+    for (int level = 0; level < LEVELS; level++) {
+        for (int slot = 0; slot < SLOTS; slot++) {
+            uint32_t index = heads[level][slot];
+            heads[level][slot] = NIL;
+            while (index != NIL) {
+                uint32_t next = nodes[index].next;
+                nodes[index].handle.destroy();
+                index = next;
+            }
+        }
+    }
+
+    // Every node is free again
+    freeHead = NIL;
+    for (size_t i = nodes.size(); i > 0; i--) {
+        nodes[i - 1].next = freeHead;
+        freeHead = static_cast<uint32_t>(i - 1);
+    }
+    currentTick = 0;
+    leftover = 0;
+    pending = 0;
+}
+
+void TimerWheel::hashState(StateHash::Stream& stream) const {
+    stream.add(currentTick);
+    stream.add(leftover);
+    stream.add(static_cast<uint32_t>(pending));
+    if (pending == 0) return;
+    for (int level = 0; level < LEVELS; level++) {
+        for (int slot = 0; slot < SLOTS; slot++) {
+            for (uint32_t i = heads[level][slot]; i != NIL; i = nodes[i].next) {
+                stream.add(nodes[i].tick);
+            }
+        }
+    }
+}
@@ -1,146 +1,171 @@
 #include "UIManager.h"
+#include <cstdio>
 
-UIManager::UIManager() : fontLoaded(false) {
-    if (font.loadFromFile("assets/fonts/ARIALN.TTF")) {
-        fontLoaded = true;
-    } else if (font.loadFromFile("ARIALN.TTF")) {
-        fontLoaded = true;
+namespace {
+    // Center a text on its local bounds
+    void centerOrigin(BakedText& text) {
+        sf::FloatRect bounds = text.getLocalBounds();
+        text.setOrigin(bounds.width / 2, bounds.height / 2);
     }
-    
-    // Setup text objects
-    scoreText.setFont(font);
-    scoreText.setCharacterSize(36);
-    scoreText.setFillColor(sf::Color::White);
+
+    void setupText(BakedText& text, const FontAtlas& atlas, FontStyle style, sf::Color fill,
+                   sf::Color outline = sf::Color::Black) {
+        text.setFont(atlas, style);
+        text.setFillColor(fill);
+        text.setOutlineColor(outline);
+    }
+}
+
+UIManager::UIManager() : showCombo(false), dashReady(true), menuPlayers(1), textUpdates(0) {
+    setupTexts();
+}
+
+void UIManager::setupTexts() {
+    // Setup text objects - everything that never changes gets its string here,
+    // once, so drawing a frame doesn't build any strings. Sizes and outlines
+    // come from the baked styles (BakedFont.h).
+    scoreText.setup(atlas, FontStyle::SCORE, "Score: ", sf::Color::White);
     scoreText.setPosition(20, 20);
-    scoreText.setOutlineThickness(2);
-    scoreText.setOutlineColor(sf::Color::Black);
+    scoreText.setValue(0);
     
-    comboText.setFont(font);
-    comboText.setCharacterSize(48);
-    comboText.setFillColor(COLOR_YELLOW);
+    comboText.setup(atlas, FontStyle::LARGE, "COMBO x", COLOR_YELLOW);
     comboText.setPosition(WINDOW_WIDTH / 2 - 100, 100);
-    comboText.setOutlineThickness(3);
-    comboText.setOutlineColor(sf::Color::Black);
     
-    dashCooldownText.setFont(font);
-    dashCooldownText.setCharacterSize(24);
-    dashCooldownText.setFillColor(COLOR_GREEN);
+    dashCooldownText.setup(atlas, FontStyle::SMALL, "Dash: ", COLOR_ORANGE);
     dashCooldownText.setPosition(20, WINDOW_HEIGHT - 50);
+
+    setupText(dashReadyText, atlas, FontStyle::SMALL, COLOR_GREEN);
+    dashReadyText.setString("Dash: READY [SPACE]");
+    dashReadyText.setPosition(20, WINDOW_HEIGHT - 50);
     
-    gameOverText.setFont(font);
-    gameOverText.setCharacterSize(72);
-    gameOverText.setFillColor(COLOR_RED);
+    setupText(gameOverText, atlas, FontStyle::GAME_OVER, COLOR_RED);
     gameOverText.setString("GAME OVER");
-    gameOverText.setOutlineThickness(4);
-    gameOverText.setOutlineColor(sf::Color::Black);
-    sf::FloatRect bounds = gameOverText.getLocalBounds();
-    gameOverText.setOrigin(bounds.width / 2, bounds.height / 2);
+    centerOrigin(gameOverText);
     gameOverText.setPosition(WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2 - 100);
+
+    finalScoreText.setup(atlas, FontStyle::LARGE, "Final Score: ", sf::Color::White);
+    finalScoreText.setCentered(true);
+    finalScoreText.setPosition(WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2);
+
+    setupText(restartText, atlas, FontStyle::MEDIUM, COLOR_GREEN);
+    restartText.setString("Press ENTER to restart");
+    centerOrigin(restartText);
+    restartText.setPosition(WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2 + 100);
+
+    setupText(titleText, atlas, FontStyle::TITLE, COLOR_BLUE, sf::Color::White);
+    titleText.setString("COLOR SWAP RUNNER! (2.0)");
+    centerOrigin(titleText);
+    titleText.setPosition(WINDOW_WIDTH / 2, 150);
     
-    instructionText.setFont(font);
-    instructionText.setCharacterSize(32);
-    instructionText.setFillColor(sf::Color::White);
-    instructionText.setOutlineThickness(2);
-    instructionText.setOutlineColor(sf::Color::Black);
+    setupText(instructionText, atlas, FontStyle::MEDIUM, sf::Color::White);
+    setupInstructions();
+
+    setupText(statsText, atlas, FontStyle::STATS, sf::Color::White);
+    statsText.setPosition(WINDOW_WIDTH - 420, 20);
+
+    // Dark overlay behind the game over screen
+    overlay.setSize(sf::Vector2f(WINDOW_WIDTH, WINDOW_HEIGHT));
+    overlay.setFillColor(sf::Color(0, 0, 0, 150));
 }
 
-bool UIManager::loadFont(const std::string& path) {
-    if (font.loadFromFile(path)) {
-        fontLoaded = true;
-        return true;
+void UIManager::setupInstructions() {
+    std::string text;
+    if (menuPlayers == 1) {
+        text = "WASD or Arrow Keys to Move\nSPACE to Dash\nC to Change Color\n"
+               "Match your color to pass through color walls!\n\n"
+               "1-4: number of players\nPress ENTER to Start";
+    } else {
+        // Only list the players that are actually in
+        const char* keys[MAX_PLAYERS] = {
+            "P1: WASD, SPACE dash, C color",
+            "P2: Arrows, RIGHT SHIFT dash, RIGHT CTRL color",
+            "P3: IJKL, U dash, O color",
+            "P4: Numpad 8456, Numpad 0 dash, Numpad 7 color"
+        };
+        text = std::to_string(menuPlayers) + " players (1-4 to change)\n";
+        for (int p = 0; p < menuPlayers; p++) {
+            text += keys[p];
+            text += "\n";
+        }
+        text += "\nPress ENTER to Start";
     }
-    return false;
+    instructionText.setString(text);
+    textUpdates++;
+    centerOrigin(instructionText);
+    instructionText.setPosition(WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2 + 70);
+}
+
+void UIManager::updatePlayerCount(int count) {
+    if (count == menuPlayers) return;
+    menuPlayers = count;
+    setupInstructions();
 }
 
 void UIManager::updateScore(int score) {
-    scoreText.setString("Score: " + std::to_string(score));
+    scoreText.setValue(score);
 }
 
 void UIManager::updateCombo(int combo) {
-    if (combo >= COMBO_THRESHOLD) {
-        comboText.setString("COMBO x" + std::to_string(combo));
-    } else {
-        comboText.setString("");
+    showCombo = combo >= COMBO_THRESHOLD;
+    if (showCombo) {
+        comboText.setValue(combo);
     }
 }
 
 void UIManager::updateDashCooldown(float cooldown) {
-    if (cooldown > 0) {
-        dashCooldownText.setString("Dash: " + 
-            std::to_string(static_cast<int>(cooldown * 10) / 10.0f) + "s");
-        dashCooldownText.setFillColor(COLOR_ORANGE);
-    } else {
-        dashCooldownText.setString("Dash: READY [SPACE]");
-        dashCooldownText.setFillColor(COLOR_GREEN);
+    dashReady = cooldown <= 0;
+    if (!dashReady) {
+        char buffer[16];
+        std::snprintf(buffer, sizeof(buffer), "%.1fs", static_cast<int>(cooldown * 10) / 10.0f);
+        dashCooldownText.setValue(buffer);
     }
 }
 
+void UIManager::updateStats(const char* text) {
+    statsText.setString(text);
+    textUpdates++;
+}
+
+uint64_t UIManager::getTextUpdates() const {
+    return textUpdates + scoreText.getRebuildCount() + comboText.getRebuildCount() +
+           dashCooldownText.getRebuildCount() + finalScoreText.getRebuildCount();
+}
+
 void UIManager::drawGameUI(sf::RenderWindow& window) {
-    if (!fontLoaded) return;
-    
-    window.draw(scoreText);
-    window.draw(comboText);
-    window.draw(dashCooldownText);
+    scoreText.draw(window);
+    if (showCombo) {
+        comboText.draw(window);
+    }
+    if (dashReady) {
+        window.draw(dashReadyText);
+    } else {
+        dashCooldownText.draw(window);
+    }
 }
 
 void UIManager::drawGameOver(sf::RenderWindow& window, int finalScore) {
-    if (!fontLoaded) return;
-    
     // Dark overlay
-    sf::RectangleShape overlay(sf::Vector2f(WINDOW_WIDTH, WINDOW_HEIGHT));
-    overlay.setFillColor(sf::Color(0, 0, 0, 150));
     window.draw(overlay);
     
     // Game over text
     window.draw(gameOverText);
     
     // Final score
-    sf::Text finalScoreText;
-    finalScoreText.setFont(font);
-    finalScoreText.setCharacterSize(48);
-    finalScoreText.setFillColor(sf::Color::White);
-    finalScoreText.setString("Final Score: " + std::to_string(finalScore));
-    finalScoreText.setOutlineThickness(3);
-    finalScoreText.setOutlineColor(sf::Color::Black);
-    sf::FloatRect bounds = finalScoreText.getLocalBounds();
-    finalScoreText.setOrigin(bounds.width / 2, bounds.height / 2);
-    finalScoreText.setPosition(WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2);
-    window.draw(finalScoreText);
+    finalScoreText.setValue(finalScore);
+    finalScoreText.draw(window);
     
     // Restart instruction
-    sf::Text restartText;
-    restartText.setFont(font);
-    restartText.setCharacterSize(32);
-    restartText.setFillColor(COLOR_GREEN);
-    restartText.setString("Press ENTER to restart");
-    restartText.setOutlineThickness(2);
-    restartText.setOutlineColor(sf::Color::Black);
-    bounds = restartText.getLocalBounds();
-    restartText.setOrigin(bounds.width / 2, bounds.height / 2);
-    restartText.setPosition(WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2 + 100);
     window.draw(restartText);
 }
 
 void UIManager::drawMenu(sf::RenderWindow& window) {
-    if (!fontLoaded) return;
-    
     // Title
-    sf::Text title;
-    title.setFont(font);
-    title.setCharacterSize(96);
-    title.setFillColor(COLOR_BLUE);
-    title.setString("COLOR SWAP RUNNER! (2.0)");
-    title.setOutlineThickness(5);
-    title.setOutlineColor(sf::Color::White);
-    sf::FloatRect bounds = title.getLocalBounds();
-    title.setOrigin(bounds.width / 2, bounds.height / 2);
-    title.setPosition(WINDOW_WIDTH / 2, 150);
-    window.draw(title);
+    window.draw(titleText);
     
     // Instructions
-    instructionText.setString("WASD or Arrow Keys to Move\nSPACE to Dash\nC to Change Color\nMatch your color to pass through color walls!\n\nPress ENTER to Start");
-    bounds = instructionText.getLocalBounds();
-    instructionText.setOrigin(bounds.width / 2, bounds.height / 2);
-    instructionText.setPosition(WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2 + 50);
     window.draw(instructionText);
 }
+
+void UIManager::drawStats(sf::RenderWindow& window) {
+    window.draw(statsText);
+}
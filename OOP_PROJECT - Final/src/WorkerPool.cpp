@@ -0,0 +1,68 @@
+#include "WorkerPool.h"
+#include <algorithm>
+
+WorkerPool::WorkerPool(int maxWorkers) {
+    task = nullptr;
+    generation = 0;
+    remaining = 0;
+    stopping = false;
+
+    unsigned cores = std::thread::hardware_concurrency();
+    int workerCount = cores > 1 ? std::min(static_cast<int>(cores) - 1, maxWorkers) : 0;
+    bandCount = workerCount + 1;
+    for (int i = 0; i < workerCount; i++) {
+        workers.emplace_back(&WorkerPool::workerLoop, this, i + 1);
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+void WorkerPool::run(const std::function<void(int, int)>& job) {
+    if (workers.empty()) {
+        job(0, 1);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        task = &job;
+        generation++;
+        remaining = static_cast<int>(workers.size());
+    }
+    wake.notify_all();
+    job(0, bandCount);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    done.wait(lock, [this] { return remaining.load() == 0; });
+    task = nullptr;
+}
+
+void WorkerPool::workerLoop(int band) {
+    int seen = 0;
+    while (true) {
+        const std::function<void(int, int)>* job;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [this, seen] { return stopping || generation != seen; });
+            if (stopping) return;
+            seen = generation;
+            job = task;
+        }
+
+        (*job)(band, bandCount);
+
+        if (remaining.fetch_sub(1) == 1) {
+            std::lock_guard<std::mutex> lock(mutex);
+            done.notify_one();
+        }
+    }
+}
@@ -1,8 +1,80 @@
 #include "Game.h"
+#include <cstdlib>
 #include <iostream>
+#include <string>
 
-int main() {
+int main(int argc, char** argv) {
     Game game;
-    game.run();
-    return 0;
-}
\ No newline at end of file
+
+    // --difficulty spawn=1.2,rate=0.9,...: override the Config.h difficulty
+    // ramp (names in Difficulty.h; tools/balance_sim finds good values)
+    for (int i = 1; i + 1 < argc; i++) {
+        if (std::string(argv[i]) == "--difficulty") {
+            DifficultySettings settings;
+            if (!settings.parse(argv[i + 1])) {
+                return 1;
+            }
+            game.setDifficulty(settings);
+        }
+    }
+
+    // --metrics [port]: serve Prometheus metrics on 127.0.0.1 (kiosks)
+    for (int i = 1; i < argc; i++) {
+        if (std::string(argv[i]) == "--metrics") {
+            int port = i + 1 < argc ? std::atoi(argv[i + 1]) : 0;
+            game.enableMetrics(port > 0 && port < 65536 ? static_cast<unsigned short>(port) : METRICS_PORT);
+        }
+    }
+
+    // --spectator-feed: publish every frame for tools/spectator (event screens)
+    for (int i = 1; i < argc; i++) {
+        if (std::string(argv[i]) == "--spectator-feed") {
+            game.enableSpectatorFeed();
+        }
+    }
+
+    // --journal: record gameplay events to logs/ (read with tools/journal_query)
+    for (int i = 1; i < argc; i++) {
+        if (std::string(argv[i]) == "--journal") {
+            game.enableJournal();
+        }
+    }
+
+    // --seed N: start every run from the same seed (reproducing a run)
+    for (int i = 1; i + 1 < argc; i++) {
+        if (std::string(argv[i]) == "--seed") {
+            game.setSeed(static_cast<uint32_t>(std::strtoul(argv[i + 1], nullptr, 10)));
+        }
+    }
+
+    // --state-hash FILE: write per-tick state hashes (compare with tools/state_diff)
+    for (int i = 1; i + 1 < argc; i++) {
+        if (std::string(argv[i]) == "--state-hash") {
+            game.enableStateHashing(argv[i + 1]);
+        }
+    }
+
+    // --name NAME: who the leaderboard lists the runs under
+    for (int i = 1; i + 1 < argc; i++) {
+        if (std::string(argv[i]) == "--name") {
+            game.setPlayerName(argv[i + 1]);
+        }
+    }
+
+    // --leaderboard [port]: submit finished runs to tools/leaderboard on 127.0.0.1
+    for (int i = 1; i < argc; i++) {
+        if (std::string(argv[i]) == "--leaderboard") {
+            int port = i + 1 < argc ? std::atoi(argv[i + 1]) : 0;
+            game.enableLeaderboard(port > 0 && port < 65536 ? static_cast<unsigned short>(port) : LEADERBOARD_PORT);
+        }
+    }
+
+    // --alloc-test: play unattended and fail if gameplay allocates memory
+    for (int i = 1; i < argc; i++) {
+        if (std::string(argv[i]) == "--alloc-test") {
+            game.enableAllocTest();
+        }
+    }
+
+    return game.run();
+}
@@ -0,0 +1,383 @@
+// Balance sim - Monte Carlo difficulty tuning. Plays thousands of seeded
+// single-player runs with a heuristic bot for every combination of the
+// difficulty settings given on the command line, spread over all cores, and
+// writes the survival time and score distributions as CSV (one row per
+// setting, optionally one row per run as well).
+//
+// Every run is a headless Simulation (one per thread, effects off) fed the
+// bot's input tick by tick, so spawning, scoring and dying are the game's
+// own rules. Spawning is timer-only, like the game with the music off, and
+// bullet patterns are left out.
+//
+// Build:  g++ -std=c++20 -O2 -pthread -Iinclude tools/balance_sim.cpp src/Simulation.cpp src/Player.cpp
+//             src/PlayerTrail.cpp src/Obstacle.cpp src/ColorWallObstacle.cpp src/PowerUp.cpp
+//             src/BulletField.cpp src/PatternScript.cpp src/PatternVM.cpp src/TimerWheel.cpp
+//             src/CoroutineTask.cpp src/Collision.cpp src/Difficulty.cpp src/Fixed.cpp src/StateHash.cpp
+//             src/EffectBuffer.cpp src/EventJournal.cpp src/ParticleSystem.cpp src/ParticleCollider.cpp
+//             src/AllocTracker.cpp -lsfml-graphics -lsfml-window -lsfml-system -o balance_sim
+// Usage:  balance_sim [options] > balance.csv
+//   --spawn 1.0:2.0:0.25     starting spawn interval     (values: a,b,c or from:to:step)
+//   --rate 0.9,0.95          spawn interval multiplier per difficulty step
+//   --speed-rate 1.05        obstacle speed multiplier per difficulty step
+//   --wall 6:10:2            color wall interval
+//   --max-speed 500,600      obstacle speed cap
+//   --min-spawn 0.4,0.5      spawn interval floor
+//   --runs 1000              runs per setting
+//   --max-time 300           seconds after which a run counts as survived
+//   --reaction 0.2           how often the bot looks at the screen (seconds)
+//   --miss 0.03              chance the bot overlooks an obstacle at a look
+//   --threads N              default: every core
+//   --seed 1                 run i uses the same seed under every setting
+//   --runs-csv runs.csv      also write every single run
+// Settings left out keep their Config.h value.
+//
+// Example: balance_sim --spawn 1.0:2.0:0.25 --rate 0.9,0.95 --wall 6,8,10 --runs 2000 > sweep.csv
+
+#include "Simulation.h"
+#include "SimRandom.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+    const sf::Color COLORS[] = {COLOR_RED, COLOR_BLUE, COLOR_YELLOW, COLOR_GREEN, COLOR_PURPLE, COLOR_ORANGE};
+    const int COLOR_COUNT = 6;
+
+    const float TICK = 1.0f / 60.0f;
+
+    // Bot tuning
+    const float LOOKAHEAD = 1.5f;               // Seconds ahead the bot plans for
+    const float PLAYER_REACH = PLAYER_SIZE / 2 + 3.0f;
+    const float SAFETY_MARGIN = 6.0f;
+    const int LANES = 25;                       // Candidate heights the bot considers
+
+    enum class Death { NONE, OBSTACLE, COLOR_WALL };
+
+    struct RunResult {
+        float time;
+        int score;
+        Death death;
+    };
+
+    // A hand-rolled player: every reaction period it looks at what is coming,
+    // picks the height with the fewest collisions it can still reach and
+    // walks there; it matches the color of the next color wall and dashes
+    // when walking can't get it out of the way. Left alone it plays nearly
+    // perfectly, so it overlooks obstacles now and then like people do.
+    class Bot {
+    private:
+        SimRandom random;
+        int reactionTicks;
+        uint32_t missThreshold; // Out of 1 << 24
+        int ticksUntilLook;
+        float targetY;          // Height picked at the last look
+        int wallColor;          // Color index to switch to, -1 for none
+        int colorIndex;         // What the player shows (it cycles through COLORS)
+
+        static float reachable(float from, float to, float t) {
+            float step = PLAYER_SPEED * t;
+            return from + std::clamp(to - from, -step, step);
+        }
+
+    public:
+        Bot(float reaction, float miss, uint32_t seed, int startColor)
+            : random(seed), reactionTicks(std::max(1, static_cast<int>(reaction / TICK + 0.5f))),
+              missThreshold(static_cast<uint32_t>(miss * (1 << 24))), ticksUntilLook(0),
+              targetY(WINDOW_HEIGHT / 2), wallColor(-1), colorIndex(startColor) {}
+
+        // Walk towards the picked height (and the start column)
+        static float steer(float from, float to) {
+            float d = to - from;
+            return d > 4 ? 1.0f : d < -4 ? -1.0f : 0.0f;
+        }
+
+        InputState decide(const Player& player, const std::vector<std::unique_ptr<Obstacle>>& obstacles,
+                          bool dashReady) {
+            sf::Vector2f pos = player.getPosition();
+            InputState in;
+            in.dash = false;
+            in.changeColor = wallColor >= 0 && colorIndex != wallColor;
+            if (in.changeColor) colorIndex = (colorIndex + 1) % COLOR_COUNT;
+
+            if (--ticksUntilLook > 0) {
+                in.move = sf::Vector2f(steer(pos.x, WINDOW_WIDTH / 4), steer(pos.y, targetY));
+                return in;
+            }
+            ticksUntilLook = reactionTicks;
+
+            float lanes[LANES];
+            float cost[LANES];
+            for (int i = 0; i < LANES; i++) {
+                lanes[i] = PLAYER_REACH + (WINDOW_HEIGHT - 2 * PLAYER_REACH) * i / (LANES - 1);
+                cost[i] = std::fabs(lanes[i] - pos.y) * 0.05f + std::fabs(lanes[i] - WINDOW_HEIGHT / 2) * 0.02f;
+            }
+
+            // The nearest color wall sets the color to wear
+            float nearestWall = LOOKAHEAD;
+            wallColor = -1;
+            for (const auto& obstacle : obstacles) {
+                if (!obstacle->active()) continue;
+                sf::Vector2f o = obstacle->getPosition();
+                float speed = -obstacle->getVelocity().x;
+                FixedVec2 half = obstacle->getHalfSize();
+                // Rotating obstacles sweep a circle; walls don't rotate
+                float reachX = half.x.toFloat();
+                float reachY = half.y.toFloat();
+                if (!obstacle->isColorWall()) {
+                    reachX = reachY = std::sqrt(reachX * reachX + reachY * reachY);
+                }
+                float enter = (o.x - reachX - (pos.x + PLAYER_REACH)) / speed;
+                float exit = (o.x + reachX - (pos.x - PLAYER_REACH)) / speed;
+                if (exit < 0 || enter > LOOKAHEAD || random.next() < missThreshold) continue;
+
+                if (obstacle->isColorWall()) {
+                    if (enter < nearestWall) {
+                        nearestWall = enter;
+                        for (int c = 0; c < COLOR_COUNT; c++) {
+                            if (COLORS[c] == obstacle->getColor()) wallColor = c;
+                        }
+                    }
+                    continue;
+                }
+
+                float top = o.y - reachY - PLAYER_REACH - SAFETY_MARGIN;
+                float bottom = o.y + reachY + PLAYER_REACH + SAFETY_MARGIN;
+                float t[3] = {std::max(enter, 0.0f), std::max((enter + exit) / 2, 0.0f), exit};
+                float weight = 1000.0f / (std::max(enter, 0.0f) + 0.05f);
+                for (int i = 0; i < LANES; i++) {
+                    for (float when : t) {
+                        float y = reachable(pos.y, lanes[i], when);
+                        if (y > top && y < bottom) {
+                            cost[i] += weight;
+                            break;
+                        }
+                    }
+                }
+            }
+
+            int best = 0;
+            for (int i = 1; i < LANES; i++) {
+                if (cost[i] < cost[best]) best = i;
+            }
+            targetY = lanes[best];
+            in.move = sf::Vector2f(steer(pos.x, WINDOW_WIDTH / 4), steer(pos.y, targetY));
+
+            // Even the best height gets hit soon: dash towards it
+            in.dash = dashReady && cost[best] >= 1000.0f / (0.3f + 0.05f) && in.move.y != 0;
+            return in;
+        }
+    };
+
+    struct BotSettings {
+        float reaction;
+        float miss;
+    };
+
+    RunResult playRun(Simulation& sim, const DifficultySettings& settings, uint32_t seed, float maxTime,
+                      const BotSettings& skill) {
+        sim.setDifficulty(settings);
+        sim.start(1, seed);
+        Bot bot(skill.reaction, skill.miss, seed ^ 0x5bd1e995u, 0);
+
+        SimInput in = SimInput();
+        in.dt = TICK;
+        Player& player = sim.getPlayer(0);
+        while (!sim.isOver() && sim.getRunTime() < maxTime) {
+            bool dashReady = sim.getDashCooldown(0) <= 0 && !player.isDashing();
+            in.players[0] = bot.decide(player, sim.getObstacles(), dashReady);
+            sim.step(in);
+        }
+
+        if (!sim.isOver()) return {maxTime, sim.getScore(), Death::NONE};
+        // No patterns run here, so nothing else can end a run
+        Death death = sim.getDeathCause() == DeathCause::COLOR_WALL ? Death::COLOR_WALL : Death::OBSTACLE;
+        return {sim.getRunTime(), sim.getScore(), death};
+    }
+
+    // "a,b,c" or "from:to:step"
+    bool parseValues(const char* text, std::vector<float>& values) {
+        values.clear();
+        float from, to, step;
+        if (std::sscanf(text, "%f:%f:%f", &from, &to, &step) == 3) {
+            if (step <= 0 || to < from) return false;
+            for (int i = 0; from + i * step <= to + step * 0.001f; i++) values.push_back(from + i * step);
+            return true;
+        }
+        const char* c = text;
+        while (*c != '\0') {
+            char* end = nullptr;
+            float value = std::strtof(c, &end);
+            if (end == c || value <= 0) return false;
+            values.push_back(value);
+            c = *end == ',' ? end + 1 : end;
+            if (*end != ',' && *end != '\0') return false;
+        }
+        return !values.empty();
+    }
+
+    float percentile(const std::vector<float>& sorted, float p) {
+        size_t i = static_cast<size_t>(p * (sorted.size() - 1) + 0.5f);
+        return sorted[i];
+    }
+
+    void writeDistribution(FILE* out, std::vector<float>& values) {
+        std::sort(values.begin(), values.end());
+        double sum = 0;
+        for (float v : values) sum += v;
+        std::fprintf(out, ",%.2f,%.2f,%.2f,%.2f,%.2f,%.2f", sum / values.size(), percentile(values, 0.1f),
+                     percentile(values, 0.25f), percentile(values, 0.5f), percentile(values, 0.75f),
+                     percentile(values, 0.9f));
+    }
+
+    void writeSettings(FILE* out, const DifficultySettings& s) {
+        std::fprintf(out, "%.3f,%.3f,%.3f,%.3f,%.1f,%.3f", s.obstacleSpawnTime, s.spawnTimeRate, s.speedRate,
+                     s.colorWallSpawnTime, s.maxObstacleSpeed, s.minSpawnTime);
+    }
+
+    const char* deathName(Death d) {
+        switch (d) {
+            case Death::OBSTACLE: return "obstacle";
+            case Death::COLOR_WALL: return "color_wall";
+            default: return "survived";
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    DifficultySettings defaults;
+    std::vector<float> spawn = {defaults.obstacleSpawnTime};
+    std::vector<float> rate = {defaults.spawnTimeRate};
+    std::vector<float> speedRate = {defaults.speedRate};
+    std::vector<float> wall = {defaults.colorWallSpawnTime};
+    std::vector<float> maxSpeed = {defaults.maxObstacleSpeed};
+    std::vector<float> minSpawn = {defaults.minSpawnTime};
+    int runs = 1000;
+    float maxTime = 300.0f;
+    BotSettings skill = {0.2f, 0.03f};
+    int threads = static_cast<int>(std::thread::hardware_concurrency());
+    uint32_t seed = 1;
+    const char* runsPath = nullptr;
+
+    struct SweepOption {
+        const char* name;
+        std::vector<float>* values;
+    };
+    SweepOption sweeps[] = {{"--spawn", &spawn}, {"--rate", &rate}, {"--speed-rate", &speedRate},
+                            {"--wall", &wall}, {"--max-speed", &maxSpeed}, {"--min-spawn", &minSpawn}};
+
+    for (int i = 1; i < argc; i++) {
+        bool known = false;
+        if (i + 1 < argc) {
+            for (SweepOption& option : sweeps) {
+                if (std::strcmp(argv[i], option.name) == 0) {
+                    if (!parseValues(argv[i + 1], *option.values)) {
+                        std::fprintf(stderr, "Bad values for %s: %s\n", option.name, argv[i + 1]);
+                        return 1;
+                    }
+                    known = true;
+                }
+            }
+            if (std::strcmp(argv[i], "--runs") == 0) { runs = std::atoi(argv[i + 1]); known = true; }
+            if (std::strcmp(argv[i], "--max-time") == 0) { maxTime = std::strtof(argv[i + 1], nullptr); known = true; }
+            if (std::strcmp(argv[i], "--reaction") == 0) { skill.reaction = std::strtof(argv[i + 1], nullptr); known = true; }
+            if (std::strcmp(argv[i], "--miss") == 0) { skill.miss = std::strtof(argv[i + 1], nullptr); known = true; }
+            if (std::strcmp(argv[i], "--threads") == 0) { threads = std::atoi(argv[i + 1]); known = true; }
+            if (std::strcmp(argv[i], "--seed") == 0) { seed = static_cast<uint32_t>(std::strtoul(argv[i + 1], nullptr, 10)); known = true; }
+            if (std::strcmp(argv[i], "--runs-csv") == 0) { runsPath = argv[i + 1]; known = true; }
+        }
+        if (!known) {
+            std::fprintf(stderr, "Unknown option %s (see the top of tools/balance_sim.cpp)\n", argv[i]);
+            return 1;
+        }
+        i++;
+    }
+    if (runs < 1 || maxTime <= 0 || skill.reaction <= 0 || skill.miss < 0 || skill.miss >= 1) {
+        std::fprintf(stderr, "--runs, --max-time and --reaction must be positive, --miss in [0, 1)\n");
+        return 1;
+    }
+    threads = std::max(threads, 1);
+
+    // Every combination of the swept values
+    std::vector<DifficultySettings> settings;
+    for (float a : spawn) for (float b : rate) for (float c : speedRate)
+    for (float d : wall) for (float e : maxSpeed) for (float f : minSpawn) {
+        DifficultySettings s;
+        s.obstacleSpawnTime = a;
+        s.spawnTimeRate = b;
+        s.speedRate = c;
+        s.colorWallSpawnTime = d;
+        s.maxObstacleSpeed = e;
+        s.minSpawnTime = f;
+        settings.push_back(s);
+    }
+
+    size_t total = settings.size() * static_cast<size_t>(runs);
+    std::fprintf(stderr, "%zu settings x %d runs on %d threads...\n", settings.size(), runs, threads);
+    auto start = std::chrono::steady_clock::now();
+
+    // Runs are handed out one by one, so slow (long surviving) runs don't
+    // leave the other threads idle
+    std::vector<RunResult> results(total);
+    std::atomic<size_t> nextRun(0);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&]() {
+            // One simulation per thread; its pools carry over from run to run
+            Simulation sim;
+            sim.getEffects().setEnabled(false);
+            for (size_t job = nextRun++; job < total; job = nextRun++) {
+                size_t run = job % runs;
+                uint32_t runSeed = seed * 2654435761u + static_cast<uint32_t>(run) * 40503u + 1;
+                results[job] = playRun(sim, settings[job / runs], runSeed, maxTime, skill);
+            }
+        });
+    }
+    for (std::thread& worker : workers) worker.join();
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::fprintf(stderr, "%zu runs in %.1f s\n", total, seconds);
+
+    std::printf("spawn,rate,speed_rate,wall,max_speed,min_spawn,runs,survived,"
+                "time_mean,time_p10,time_p25,time_p50,time_p75,time_p90,"
+                "score_mean,score_p10,score_p25,score_p50,score_p75,score_p90,"
+                "deaths_obstacle,deaths_color_wall\n");
+    std::vector<float> times(runs);
+    std::vector<float> scores(runs);
+    for (size_t s = 0; s < settings.size(); s++) {
+        int counts[3] = {0, 0, 0};
+        for (int r = 0; r < runs; r++) {
+            const RunResult& result = results[s * runs + r];
+            times[r] = result.time;
+            scores[r] = static_cast<float>(result.score);
+            counts[static_cast<int>(result.death)]++;
+        }
+        writeSettings(stdout, settings[s]);
+        std::printf(",%d,%d", runs, counts[static_cast<int>(Death::NONE)]);
+        writeDistribution(stdout, times);
+        writeDistribution(stdout, scores);
+        std::printf(",%d,%d\n", counts[static_cast<int>(Death::OBSTACLE)], counts[static_cast<int>(Death::COLOR_WALL)]);
+    }
+
+    if (runsPath) {
+        FILE* f = std::fopen(runsPath, "w");
+        if (!f) {
+            std::fprintf(stderr, "Cannot write %s\n", runsPath);
+            return 1;
+        }
+        std::fprintf(f, "spawn,rate,speed_rate,wall,max_speed,min_spawn,run,time,score,death\n");
+        for (size_t job = 0; job < total; job++) {
+            writeSettings(f, settings[job / runs]);
+            std::fprintf(f, ",%zu,%.3f,%d,%s\n", job % runs, results[job].time, results[job].score,
+                         deathName(results[job].death));
+        }
+        std::fclose(f);
+    }
+    return 0;
+}
@@ -0,0 +1,133 @@
+// Determinism check - plays scripted runs through the game's own Simulation
+// (players, obstacles, color walls, power-ups, bullet patterns, collisions,
+// the difficulty ramp, SimRandom and the timer wheel) from fixed seeds, and
+// prints one hash over Simulation::hashState of every tick. Builds with
+// different compilers, standard libraries or optimization levels must print
+// the same hash - which is what replays (tools/leaderboard) rely on.
+//
+// Build:  g++ -std=c++20 -O2 -Iinclude tools/determinism_check.cpp src/Simulation.cpp src/Player.cpp
+//             src/PlayerTrail.cpp src/Obstacle.cpp src/ColorWallObstacle.cpp src/PowerUp.cpp
+//             src/BulletField.cpp src/PatternScript.cpp src/PatternVM.cpp src/TimerWheel.cpp
+//             src/CoroutineTask.cpp src/Collision.cpp src/Difficulty.cpp src/Fixed.cpp src/StateHash.cpp
+//             src/EffectBuffer.cpp src/EventJournal.cpp src/ParticleSystem.cpp src/ParticleCollider.cpp
+//             src/AllocTracker.cpp -lsfml-graphics -lsfml-window -lsfml-system -o determinism_check
+// Usage:  determinism_check [--log FILE] [--simd scalar|sse4.1|avx2] [ticks]
+//         (from the game's directory - the runs use its bullet patterns)
+//
+// --simd forces the swept collision test down a slower path; every path
+// must print the same hash.
+//
+// Compare e.g. a -O0 and an -O2 build, or g++ and clang++:
+//         ./determinism_check_O0 > a.txt && ./determinism_check_O2 > b.txt && cmp a.txt b.txt
+// If they differ, --log writes the per-tick hashes and tools/state_diff
+// shows the first tick and field where the builds part ways.
+
+#include "Simulation.h"
+#include "Collision.h"
+#include "PatternScript.h"
+#include "StateHash.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace {
+    // One run per player count; runs 2 and 4 can't die, so they get far into
+    // the difficulty ramp and the pattern rotation
+    const int RUNS = 4;
+
+    // The scripted input of one tick. The script has its own generator, so
+    // what the simulation draws never changes what is pressed.
+    void scriptTick(SimInput& in, SimRandom& script, int players, int tick) {
+        // Uneven frame times, like a real run (1/60 s give or take a bit)
+        int32_t raw = Fixed::ONE / 60 - 200 + static_cast<int32_t>(script.next() % 400);
+        in.dt = Fixed::fromRaw(raw).toFloat();
+
+        for (int p = 0; p < MAX_PLAYERS; p++) {
+            InputState& s = in.players[p];
+            uint32_t r = script.next();
+            s.move = p < players ? sf::Vector2f(static_cast<float>(static_cast<int>(r % 3) - 1),
+                                                static_cast<float>(static_cast<int>((r / 3) % 3) - 1))
+                                 : sf::Vector2f(0, 0);
+            s.dash = p < players && (r % 151) == 0;
+            s.changeColor = p < players && (r % 97) == 0;
+        }
+
+        // A beat now and then, some strong enough for a color wall
+        in.beatCount = 0;
+        if (script.next() % 40 == 0) {
+            in.beats[in.beatCount++] = static_cast<float>(script.next() % 200) / 100.0f;
+        }
+        in.stressPattern = tick == 600;
+    }
+}
+
+int main(int argc, char** argv) {
+    int ticks = 20000;
+    std::string logPath;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--log") == 0 && i + 1 < argc) {
+            logPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--simd") == 0 && i + 1 < argc) {
+            const char* name = argv[++i];
+            CollisionSimd simd = CollisionSimd::AVX2;
+            while (simd != CollisionSimd::SCALAR && std::strcmp(Collision::getSimdName(simd), name) != 0) {
+                simd = static_cast<CollisionSimd>(static_cast<int>(simd) - 1);
+            }
+            if (std::strcmp(Collision::getSimdName(simd), name) != 0) {
+                std::fprintf(stderr, "Unknown --simd %s (scalar, sse4.1 or avx2)\n", name);
+                return 1;
+            }
+            Collision::setSimd(simd);
+        } else {
+            ticks = std::atoi(argv[i]);
+        }
+    }
+
+    PatternLibrary library;
+    if (ENABLE_PATTERNS && !library.loadFromFile(PATTERN_FILE)) {
+        std::fprintf(stderr, "Cannot load %s (run from the game's directory)\n", PATTERN_FILE.c_str());
+        return 1;
+    }
+
+    StateHashLog log;
+    if (!logPath.empty() && !log.open(logPath)) {
+        std::fprintf(stderr, "Cannot write %s\n", logPath.c_str());
+        return 1;
+    }
+
+    Simulation sim;
+    sim.setPatternLibrary(&library);
+    sim.getEffects().setEnabled(false);
+
+    // Every tick's field hashes, folded into one
+    StateHash::Stream total;
+    int played = 0;
+    for (int run = 0; run < RUNS; run++) {
+        int players = run + 1;
+        sim.setInvulnerable(run % 2 == 1);
+        sim.start(players, 1000 + static_cast<uint32_t>(run));
+        log.beginRun();
+
+        SimRandom script(77 + static_cast<uint32_t>(run));
+        SimInput in = SimInput();
+        int tick = 0;
+        for (; tick < ticks / RUNS && !sim.isOver(); tick++) {
+            scriptTick(in, script, players, tick);
+            sim.step(in);
+            sim.hashState(log, in);
+            const StateHashRecord& record = log.getLastRecord();
+            total.update(record.fields, sizeof(record.fields));
+        }
+        played += tick;
+
+        std::printf("run %d: %d players, %d ticks, %.1f s, score %d, %zu obstacles, %zu bullets%s\n",
+                    run + 1, players, tick, sim.getRunTime(), sim.getScore(), sim.getObstacles().size(),
+                    sim.getBullets().getCount(), sim.isOver() ? ", over" : "");
+    }
+
+    std::printf("collision %s\n", Collision::getSimdName(Collision::getSimd()));
+    std::printf("ticks %d\n", played);
+    std::printf("hash %016llx\n", static_cast<unsigned long long>(total.digest()));
+    return 0;
+}
@@ -0,0 +1,304 @@
+// Font baker - rasterizes every style in BakedFont.h from a TTF into one
+// alpha atlas and writes it, with the glyph metrics, as constexpr data.
+// Rendering follows sf::Font (auto-hinted, round-joined FreeType stroker for
+// outlines), so baked text looks like the sf::Text it replaces.
+//
+// Build:  g++ -std=c++17 -O2 -Iinclude $(pkg-config --cflags freetype2) tools/font_baker.cpp
+//             -lfreetype -o font_baker
+// Usage:  font_baker assets/fonts/ARIALN.TTF include/BakedFontData.h
+//
+// The atlas is run-length encoded in the header; FontAtlas unpacks it once
+// at startup.
+
+#include "BakedFont.h"
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include FT_GLYPH_H
+#include FT_STROKER_H
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+    const int ATLAS_WIDTH = 1024;
+    const int STYLE_COUNT = static_cast<int>(FontStyle::COUNT);
+
+    struct Bitmap {
+        int width = 0;
+        int height = 0;
+        int left = 0;
+        int top = 0;
+        std::vector<unsigned char> pixels;
+    };
+
+    struct Entry {
+        int style;
+        char character;
+        float advance;
+        Bitmap fill;
+        Bitmap outline;
+        BakedGlyphImage fillImage = {};
+        BakedGlyphImage outlineImage = {};
+    };
+
+    // Same steps as sf::Font::loadGlyph
+    bool rasterize(FT_Face face, FT_Stroker stroker, char character, unsigned outline, Bitmap& out, float& advance) {
+        if (FT_Load_Char(face, static_cast<unsigned char>(character), FT_LOAD_TARGET_NORMAL | FT_LOAD_FORCE_AUTOHINT) != 0) {
+            return false;
+        }
+        advance = static_cast<float>(face->glyph->metrics.horiAdvance) / 64.0f;
+
+        FT_Glyph glyph;
+        if (FT_Get_Glyph(face->glyph, &glyph) != 0) return false;
+        if (outline > 0 && glyph->format == FT_GLYPH_FORMAT_OUTLINE) {
+            FT_Stroker_Set(stroker, static_cast<FT_Fixed>(outline * 64), FT_STROKER_LINECAP_ROUND,
+                           FT_STROKER_LINEJOIN_ROUND, 0);
+            FT_Glyph_Stroke(&glyph, stroker, 1);
+        }
+        FT_Glyph_To_Bitmap(&glyph, FT_RENDER_MODE_NORMAL, nullptr, 1);
+
+        FT_BitmapGlyph bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(glyph);
+        const FT_Bitmap& bitmap = bitmapGlyph->bitmap;
+        out.width = static_cast<int>(bitmap.width);
+        out.height = static_cast<int>(bitmap.rows);
+        out.left = bitmapGlyph->left;
+        out.top = -bitmapGlyph->top;
+        out.pixels.assign(static_cast<size_t>(out.width) * out.height, 0);
+        for (int y = 0; y < out.height; y++) {
+            const unsigned char* row = bitmap.buffer + y * bitmap.pitch;
+            for (int x = 0; x < out.width; x++) {
+                out.pixels[static_cast<size_t>(y) * out.width + x] = row[x];
+            }
+        }
+        FT_Done_Glyph(glyph);
+        return true;
+    }
+
+    // Shelf packing, tallest first; every image gets a 1 px transparent border
+    int pack(std::vector<Bitmap*>& images, std::vector<BakedGlyphImage*>& placements) {
+        std::vector<size_t> order(images.size());
+        for (size_t i = 0; i < order.size(); i++) order[i] = i;
+        std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            return images[a]->height > images[b]->height;
+        });
+
+        int x = 0;
+        int y = 0;
+        int shelfHeight = 0;
+        for (size_t i : order) {
+            const Bitmap& b = *images[i];
+            if (b.width == 0 || b.height == 0) continue;
+            int w = b.width + 2;
+            int h = b.height + 2;
+            if (x + w > ATLAS_WIDTH) {
+                x = 0;
+                y += shelfHeight;
+                shelfHeight = 0;
+            }
+            BakedGlyphImage& p = *placements[i];
+            p.x = static_cast<uint16_t>(x);
+            p.y = static_cast<uint16_t>(y);
+            p.width = static_cast<uint16_t>(w);
+            p.height = static_cast<uint16_t>(h);
+            p.left = static_cast<int16_t>(b.left - 1);
+            p.top = static_cast<int16_t>(b.top - 1);
+            x += w;
+            shelfHeight = std::max(shelfHeight, h);
+        }
+        int height = y + shelfHeight;
+        int power = 1;
+        while (power < height) power *= 2;
+        return power;
+    }
+
+    // Literal runs: n (0-127) then n + 1 bytes; repeats: 128 + n then one byte, n + 2 copies
+    std::vector<unsigned char> encode(const std::vector<unsigned char>& data) {
+        std::vector<unsigned char> out;
+        size_t i = 0;
+        while (i < data.size()) {
+            size_t run = 1;
+            while (i + run < data.size() && data[i + run] == data[i] && run < 129) run++;
+            if (run >= 2) {
+                out.push_back(static_cast<unsigned char>(128 + run - 2));
+                out.push_back(data[i]);
+                i += run;
+                continue;
+            }
+            size_t start = i;
+            size_t length = 0;
+            while (i < data.size() && length < 128) {
+                if (i + 1 < data.size() && data[i + 1] == data[i]) break;
+                i++;
+                length++;
+            }
+            out.push_back(static_cast<unsigned char>(length - 1));
+            out.insert(out.end(), data.begin() + start, data.begin() + start + length);
+        }
+        return out;
+    }
+
+    // Same rounding as sf::Font::getKerning, including the hinting deltas
+    int kerning(FT_Face face, char first, char second) {
+        FT_UInt left = FT_Get_Char_Index(face, static_cast<unsigned char>(first));
+        FT_UInt right = FT_Get_Char_Index(face, static_cast<unsigned char>(second));
+        if (left == 0 || right == 0) return 0;
+
+        FT_Load_Glyph(face, left, FT_LOAD_TARGET_NORMAL | FT_LOAD_FORCE_AUTOHINT);
+        FT_Pos firstRsbDelta = face->glyph->rsb_delta;
+        FT_Load_Glyph(face, right, FT_LOAD_TARGET_NORMAL | FT_LOAD_FORCE_AUTOHINT);
+        FT_Pos secondLsbDelta = face->glyph->lsb_delta;
+
+        FT_Vector amount;
+        if (FT_Get_Kerning(face, left, right, FT_KERNING_UNFITTED, &amount) != 0) return 0;
+        return static_cast<int>(std::floor((secondLsbDelta - firstRsbDelta + amount.x + 32) / 64.0));
+    }
+
+    void writeChar(FILE* f, char c) {
+        if (c == '\'' || c == '\\') {
+            std::fprintf(f, "'\\%c'", c);
+        } else {
+            std::fprintf(f, "'%c'", c);
+        }
+    }
+
+    void writeImage(FILE* f, const BakedGlyphImage& g) {
+        std::fprintf(f, "{%u, %u, %u, %u, %d, %d}", g.x, g.y, g.width, g.height, g.left, g.top);
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        std::fprintf(stderr, "Usage: font_baker <font.ttf> <output.h>\n");
+        return 1;
+    }
+
+    FT_Library library;
+    FT_Face face;
+    FT_Stroker stroker;
+    if (FT_Init_FreeType(&library) != 0 || FT_New_Face(library, argv[1], 0, &face) != 0 ||
+        FT_Stroker_New(library, &stroker) != 0) {
+        std::fprintf(stderr, "Cannot open %s\n", argv[1]);
+        return 1;
+    }
+
+    // Rasterize every style's characters (sorted, no duplicates)
+    std::vector<Entry> entries;
+    std::vector<BakedKerning> kernings;
+    BakedStyleInfo styles[STYLE_COUNT];
+    for (int s = 0; s < STYLE_COUNT; s++) {
+        const BakedFontStyle& style = BAKED_FONT_STYLES[s];
+        FT_Set_Pixel_Sizes(face, 0, style.size);
+        styles[s].lineSpacing = static_cast<float>(face->size->metrics.height) / 64.0f;
+        styles[s].firstGlyph = static_cast<uint16_t>(entries.size());
+
+        std::string characters(style.characters);
+        std::sort(characters.begin(), characters.end());
+        characters.erase(std::unique(characters.begin(), characters.end()), characters.end());
+        for (char c : characters) {
+            Entry e;
+            e.style = s;
+            e.character = c;
+            if (!rasterize(face, stroker, c, 0, e.fill, e.advance)) {
+                std::fprintf(stderr, "No glyph for '%c' at size %u\n", c, style.size);
+                continue;
+            }
+            float unused;
+            if (style.outline > 0) rasterize(face, stroker, c, style.outline, e.outline, unused);
+            entries.push_back(std::move(e));
+        }
+        styles[s].glyphCount = static_cast<uint16_t>(entries.size() - styles[s].firstGlyph);
+
+        styles[s].firstKerning = static_cast<uint16_t>(kernings.size());
+        if (FT_HAS_KERNING(face)) {
+            for (char first : characters) {
+                for (char second : characters) {
+                    int amount = kerning(face, first, second);
+                    if (amount != 0) kernings.push_back({first, second, static_cast<int16_t>(amount)});
+                }
+            }
+        }
+        styles[s].kerningCount = static_cast<uint16_t>(kernings.size() - styles[s].firstKerning);
+    }
+
+    std::vector<Bitmap*> images;
+    std::vector<BakedGlyphImage*> placements;
+    for (Entry& e : entries) {
+        images.push_back(&e.fill);
+        placements.push_back(&e.fillImage);
+        images.push_back(&e.outline);
+        placements.push_back(&e.outlineImage);
+    }
+    int atlasHeight = pack(images, placements);
+
+    std::vector<unsigned char> atlas(static_cast<size_t>(ATLAS_WIDTH) * atlasHeight, 0);
+    for (size_t i = 0; i < images.size(); i++) {
+        const Bitmap& b = *images[i];
+        const BakedGlyphImage& p = *placements[i];
+        for (int y = 0; y < b.height; y++) {
+            std::memcpy(&atlas[static_cast<size_t>(p.y + 1 + y) * ATLAS_WIDTH + p.x + 1],
+                        &b.pixels[static_cast<size_t>(y) * b.width], b.width);
+        }
+    }
+    std::vector<unsigned char> encoded = encode(atlas);
+
+    FILE* f = std::fopen(argv[2], "w");
+    if (!f) {
+        std::fprintf(stderr, "Cannot write %s\n", argv[2]);
+        return 1;
+    }
+    const char* fontName = std::strrchr(argv[1], '/') ? std::strrchr(argv[1], '/') + 1 : argv[1];
+    std::fprintf(f, "// Generated by tools/font_baker from %s - do not edit.\n", fontName);
+    std::fprintf(f, "#ifndef BAKEDFONTDATA_H\n#define BAKEDFONTDATA_H\n\n#include \"BakedFont.h\"\n#include <cstddef>\n\n");
+    std::fprintf(f, "constexpr unsigned BAKED_ATLAS_WIDTH = %d;\n", ATLAS_WIDTH);
+    std::fprintf(f, "constexpr unsigned BAKED_ATLAS_HEIGHT = %d;\n\n", atlasHeight);
+
+    std::fprintf(f, "constexpr BakedStyleInfo BAKED_STYLE_INFO[%d] = {\n", STYLE_COUNT);
+    for (int s = 0; s < STYLE_COUNT; s++) {
+        std::fprintf(f, "    {%.1ff, %u, %u, %u, %u},\n", styles[s].lineSpacing, styles[s].firstGlyph,
+                     styles[s].glyphCount, styles[s].firstKerning, styles[s].kerningCount);
+    }
+    std::fprintf(f, "};\n\n");
+
+    std::fprintf(f, "constexpr BakedGlyph BAKED_GLYPHS[%zu] = {\n", entries.size());
+    for (const Entry& e : entries) {
+        std::fprintf(f, "    {");
+        writeChar(f, e.character);
+        std::fprintf(f, ", %.2ff, ", e.advance);
+        writeImage(f, e.fillImage);
+        std::fprintf(f, ", ");
+        writeImage(f, e.outlineImage);
+        std::fprintf(f, "},\n");
+    }
+    std::fprintf(f, "};\n\n");
+
+    // At least one entry so the array is valid when the font has no kerning
+    std::fprintf(f, "constexpr BakedKerning BAKED_KERNING[%zu] = {\n", std::max<size_t>(kernings.size(), 1));
+    for (const BakedKerning& k : kernings) {
+        std::fprintf(f, "    {");
+        writeChar(f, k.first);
+        std::fprintf(f, ", ");
+        writeChar(f, k.second);
+        std::fprintf(f, ", %d},\n", k.amount);
+    }
+    if (kernings.empty()) std::fprintf(f, "    {0, 0, 0},\n");
+    std::fprintf(f, "};\n\n");
+
+    std::fprintf(f, "constexpr size_t BAKED_ATLAS_RLE_SIZE = %zu;\n", encoded.size());
+    std::fprintf(f, "constexpr unsigned char BAKED_ATLAS_RLE[BAKED_ATLAS_RLE_SIZE] = {");
+    for (size_t i = 0; i < encoded.size(); i++) {
+        std::fprintf(f, "%s%u,", i % 24 == 0 ? "\n    " : "", encoded[i]);
+    }
+    std::fprintf(f, "\n};\n\n#endif\n");
+    std::fclose(f);
+
+    std::printf("%zu glyphs in %d styles, %zu kerning pairs, atlas %dx%d, %zu bytes encoded (%zu raw)\n",
+                entries.size(), STYLE_COUNT, kernings.size(), ATLAS_WIDTH, atlasHeight, encoded.size(), atlas.size());
+
+    FT_Stroker_Done(stroker);
+    FT_Done_Face(face);
+    FT_Done_FreeType(library);
+    return 0;
+}
@@ -0,0 +1,165 @@
+// Journal query tool - aggregates many event journal files (.evj) at once.
+//
+// Build:  g++ -std=c++17 -O2 -Iinclude tools/journal_query.cpp src/EventJournal.cpp -o journal_query -pthread
+// Usage:  journal_query <file-or-directory> [more files/directories...]
+//
+// Prints death causes, a survival curve and the combo length distribution.
+
+#include "EventJournal.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct RunStats {
+    int runs = 0;
+    int deathsByObstacle = 0;
+    int deathsByColorWall = 0;
+    int deathsByPattern = 0;
+    int dodges = 0;
+    int wallPasses = 0;
+    int pickups = 0;
+    int dashes = 0;
+    int colorChanges = 0;
+    uint64_t droppedEvents = 0;
+    std::vector<float> survivalTimes;
+    std::map<int, int> comboLengths;
+
+    void merge(const RunStats& other) {
+        runs += other.runs;
+        deathsByObstacle += other.deathsByObstacle;
+        deathsByColorWall += other.deathsByColorWall;
+        deathsByPattern += other.deathsByPattern;
+        dodges += other.dodges;
+        wallPasses += other.wallPasses;
+        pickups += other.pickups;
+        dashes += other.dashes;
+        colorChanges += other.colorChanges;
+        droppedEvents += other.droppedEvents;
+        survivalTimes.insert(survivalTimes.end(), other.survivalTimes.begin(), other.survivalTimes.end());
+        for (const auto& entry : other.comboLengths) {
+            comboLengths[entry.first] += entry.second;
+        }
+    }
+};
+
+// Aggregate a single journal file (one file can hold many runs)
+static void processFile(const std::string& path, RunStats& stats) {
+    std::vector<GameEvent> events;
+    uint64_t dropped = 0;
+    if (!EventJournal::readFile(path, events, &dropped)) {
+        std::fprintf(stderr, "skipping %s (not a journal file)\n", path.c_str());
+        return;
+    }
+    stats.droppedEvents += dropped;
+
+    for (const auto& e : events) {
+        switch (e.type) {
+            case GameEventType::RUN_START:      stats.runs++; break;
+            case GameEventType::DODGE:          stats.dodges++; break;
+            case GameEventType::WALL_PASS:      stats.wallPasses++; break;
+            case GameEventType::POWERUP_PICKUP: stats.pickups++; break;
+            case GameEventType::DASH:           stats.dashes++; break;
+            case GameEventType::COLOR_CHANGE:   stats.colorChanges++; break;
+            case GameEventType::COMBO_BREAK:
+                if (e.value > 0) stats.comboLengths[e.value]++;
+                break;
+            case GameEventType::GAME_OVER:
+                if (e.value == static_cast<int32_t>(DeathCause::COLOR_WALL)) {
+                    stats.deathsByColorWall++;
+                } else if (e.value == static_cast<int32_t>(DeathCause::PATTERN)) {
+                    stats.deathsByPattern++;
+                } else {
+                    stats.deathsByObstacle++;
+                }
+                stats.survivalTimes.push_back(e.time);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+static void collectFiles(const std::string& arg, std::vector<std::string>& files) {
+    namespace fs = std::filesystem;
+    std::error_code ec;
+    if (fs::is_directory(arg, ec)) {
+        for (const auto& entry : fs::recursive_directory_iterator(arg, ec)) {
+            if (entry.is_regular_file() && entry.path().extension() == ".evj") {
+                files.push_back(entry.path().string());
+            }
+        }
+    } else {
+        files.push_back(arg);
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::printf("Usage: %s <file-or-directory> [...]\n", argv[0]);
+        return 1;
+    }
+
+    std::vector<std::string> files;
+    for (int i = 1; i < argc; i++) {
+        collectFiles(argv[i], files);
+    }
+
+    // Spread the files over all cores; each worker keeps its own stats
+    unsigned threadCount = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<RunStats> partial(threadCount);
+    std::vector<std::thread> workers;
+    std::atomic<size_t> nextFile(0);
+    for (unsigned t = 0; t < threadCount; t++) {
+        workers.emplace_back([&, t]() {
+            size_t i;
+            while ((i = nextFile.fetch_add(1)) < files.size()) {
+                processFile(files[i], partial[t]);
+            }
+        });
+    }
+    for (auto& w : workers) w.join();
+
+    RunStats total;
+    for (const auto& p : partial) total.merge(p);
+
+    std::printf("Files: %zu  Runs: %d  Dropped events: %llu\n",
+                files.size(), total.runs, static_cast<unsigned long long>(total.droppedEvents));
+    std::printf("Dodges: %d  Wall passes: %d  Pickups: %d  Dashes: %d  Color changes: %d\n",
+                total.dodges, total.wallPasses, total.pickups, total.dashes, total.colorChanges);
+
+    int deaths = total.deathsByObstacle + total.deathsByColorWall + total.deathsByPattern;
+    std::printf("\nDeath causes (%d deaths)\n", deaths);
+    if (deaths > 0) {
+        std::printf("  obstacle   : %6d (%5.1f%%)\n", total.deathsByObstacle, 100.0 * total.deathsByObstacle / deaths);
+        std::printf("  color wall : %6d (%5.1f%%)\n", total.deathsByColorWall, 100.0 * total.deathsByColorWall / deaths);
+        std::printf("  pattern    : %6d (%5.1f%%)\n", total.deathsByPattern, 100.0 * total.deathsByPattern / deaths);
+    }
+
+    // Survival curve: fraction of runs still alive after t seconds
+    if (!total.survivalTimes.empty()) {
+        std::sort(total.survivalTimes.begin(), total.survivalTimes.end());
+        float longest = total.survivalTimes.back();
+        std::printf("\nSurvival curve (median %.1fs, longest %.1fs)\n",
+                    total.survivalTimes[total.survivalTimes.size() / 2], longest);
+        for (float t = 0; t <= longest; t += 5.0f) {
+            size_t died = std::lower_bound(total.survivalTimes.begin(), total.survivalTimes.end(), t) -
+                          total.survivalTimes.begin();
+            double alive = 1.0 - static_cast<double>(died) / total.survivalTimes.size();
+            std::printf("  %5.0fs %5.1f%% %s\n", t, alive * 100.0, std::string(static_cast<size_t>(alive * 50), '#').c_str());
+        }
+    }
+
+    if (!total.comboLengths.empty()) {
+        std::printf("\nCombo lengths\n");
+        for (const auto& entry : total.comboLengths) {
+            std::printf("  %4d : %d\n", entry.first, entry.second);
+        }
+    }
+
+    return 0;
+}
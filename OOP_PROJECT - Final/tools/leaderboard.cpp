@@ -0,0 +1,777 @@
+// Leaderboard - local score service for the venue. The game (--leaderboard)
+// submits every finished run together with its replay, and a run only makes
+// the board once a worker has played the replay again - headless, through the
+// game's own Simulation - and ended up with the score the run claims. Each
+// worker keeps one Simulation and steps it as fast as it goes (hundreds of
+// times real time), so a backlog of hundreds of runs clears in seconds.
+//
+// Verified runs are appended to a memory-mapped table file (the service
+// crashing loses nothing that was written); a sorted index over it, rebuilt
+// at startup, answers top-N queries.
+//
+// Build:  g++ -std=c++20 -O2 -pthread -Iinclude tools/leaderboard.cpp src/Simulation.cpp src/Replay.cpp
+//             src/Player.cpp src/PlayerTrail.cpp src/Obstacle.cpp src/ColorWallObstacle.cpp src/PowerUp.cpp
+//             src/BulletField.cpp src/PatternScript.cpp src/PatternVM.cpp src/TimerWheel.cpp
+//             src/CoroutineTask.cpp src/Collision.cpp src/Difficulty.cpp src/Fixed.cpp src/StateHash.cpp
+//             src/EffectBuffer.cpp src/EventJournal.cpp src/ParticleSystem.cpp src/ParticleCollider.cpp
+//             src/AllocTracker.cpp -lsfml-network -lsfml-graphics -lsfml-window -lsfml-system -o leaderboard
+//         Build it from the same sources and with the same compiler settings as the game: a replay
+//         only plays back the same on the same simulation code.
+// Usage:  leaderboard [--port 9465] [--table leaderboard.tbl] [--workers N] [--replays DIR]
+//         leaderboard --verify [--workers N] run.csr ...
+//
+//   GET  /top?n=10     the best verified runs
+//   GET  /status       queue, verification counts and speed
+//   POST /submit       a replay (what the game sends); 202 once it is queued
+//
+// --replays keeps every verified replay as DIR/<hash>.csr; after changing the
+// game, --verify replays/*.csr tells which runs on the board no longer play
+// back the same.
+
+#include "Simulation.h"
+#include "Replay.h"
+#include "PatternScript.h"
+#include "StateHash.h"
+#include <SFML/Network.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    const char TABLE_MAGIC[4] = {'C', 'S', 'L', 'B'};
+    const uint32_t TABLE_VERSION = 1;
+    const uint32_t INITIAL_CAPACITY = 1024;     // Records; the file doubles when full
+    const size_t MAX_QUEUE = 4096;              // Runs waiting for a worker
+    const size_t MAX_QUEUE_BYTES = 512 * 1024 * 1024;
+    const int DEFAULT_TOP = 10;
+    const int MAX_TOP = 1000;
+
+    std::atomic<bool> stopRequested(false);
+
+    void onSignal(int) {
+        stopRequested = true;
+    }
+
+    int64_t nowMicros() {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    struct TableHeader {
+        char magic[4];              // "CSLB"
+        uint32_t version;
+        uint32_t recordSize;
+        uint32_t count;             // Bumped only once a record is complete
+    };
+
+    // One verified run - 48 bytes
+    struct TableRecord {
+        int32_t score;
+        uint32_t ticks;
+        float runTime;
+        uint32_t seed;
+        uint32_t submitted;         // Unix time
+        uint32_t playerCount;
+        uint64_t replayHash;        // Of the whole replay, so a run can't be entered twice
+        char name[16];
+    };
+
+    // Append-only table in a memory-mapped file. Growing it maps it again
+    // somewhere else, so records are only touched under the board's lock.
+    class Table {
+    private:
+#ifdef _WIN32
+        HANDLE file = INVALID_HANDLE_VALUE;
+        HANDLE mapping = nullptr;
+#else
+        int fd = -1;
+#endif
+        void* memory = nullptr;
+        size_t mappedSize = 0;
+
+        TableHeader* header() const { return static_cast<TableHeader*>(memory); }
+        TableRecord* records() const {
+            return reinterpret_cast<TableRecord*>(static_cast<char*>(memory) + sizeof(TableHeader));
+        }
+        uint32_t capacity() const {
+            return static_cast<uint32_t>((mappedSize - sizeof(TableHeader)) / sizeof(TableRecord));
+        }
+
+        // Map the file at this size (growing the file if it is smaller)
+        bool map(size_t size) {
+#ifdef _WIN32
+            uint64_t size64 = size;
+            mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE, static_cast<DWORD>(size64 >> 32),
+                                         static_cast<DWORD>(size64), nullptr);
+            memory = mapping ? MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size) : nullptr;
+#else
+            if (ftruncate(fd, static_cast<off_t>(size)) == 0) {
+                memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+                if (memory == MAP_FAILED) memory = nullptr;
+            }
+#endif
+            mappedSize = memory ? size : 0;
+            return memory != nullptr;
+        }
+
+        void unmap() {
+#ifdef _WIN32
+            if (memory) UnmapViewOfFile(memory);
+            if (mapping) CloseHandle(mapping);
+            mapping = nullptr;
+#else
+            if (memory) munmap(memory, mappedSize);
+#endif
+            memory = nullptr;
+            mappedSize = 0;
+        }
+
+    public:
+        ~Table() { close(); }
+
+        bool open(const std::string& path) {
+            uint64_t fileSize = 0;
+#ifdef _WIN32
+            file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, OPEN_ALWAYS,
+                               FILE_ATTRIBUTE_NORMAL, nullptr);
+            LARGE_INTEGER size;
+            if (file == INVALID_HANDLE_VALUE || !GetFileSizeEx(file, &size)) {
+                std::fprintf(stderr, "Cannot open %s\n", path.c_str());
+                return false;
+            }
+            fileSize = static_cast<uint64_t>(size.QuadPart);
+#else
+            fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+            struct stat info;
+            if (fd < 0 || fstat(fd, &info) != 0) {
+                std::fprintf(stderr, "Cannot open %s\n", path.c_str());
+                return false;
+            }
+            fileSize = static_cast<uint64_t>(info.st_size);
+#endif
+            if (fileSize == 0) {
+                if (!map(sizeof(TableHeader) + INITIAL_CAPACITY * sizeof(TableRecord))) {
+                    std::fprintf(stderr, "Cannot map %s\n", path.c_str());
+                    return false;
+                }
+                std::memcpy(header()->magic, TABLE_MAGIC, sizeof(TABLE_MAGIC));
+                header()->version = TABLE_VERSION;
+                header()->recordSize = sizeof(TableRecord);
+                header()->count = 0;
+                return true;
+            }
+
+            if (fileSize < sizeof(TableHeader) + sizeof(TableRecord) || !map(static_cast<size_t>(fileSize))) {
+                std::fprintf(stderr, "%s: not a leaderboard table\n", path.c_str());
+                return false;
+            }
+            const TableHeader* h = header();
+            if (std::memcmp(h->magic, TABLE_MAGIC, sizeof(TABLE_MAGIC)) != 0 || h->version != TABLE_VERSION ||
+                h->recordSize != sizeof(TableRecord) || h->count > capacity()) {
+                std::fprintf(stderr, "%s: not a leaderboard table (or another version)\n", path.c_str());
+                unmap();
+                return false;
+            }
+            return true;
+        }
+
+        void close() {
+            if (!memory) return;
+            flush();
+            unmap();
+#ifdef _WIN32
+            CloseHandle(file);
+            file = INVALID_HANDLE_VALUE;
+#else
+            ::close(fd);
+            fd = -1;
+#endif
+        }
+
+        uint32_t getCount() const { return header()->count; }
+        const TableRecord& get(uint32_t i) const { return records()[i]; }
+
+        bool append(const TableRecord& record) {
+            uint32_t count = header()->count;
+            if (count == capacity()) {
+                size_t size = mappedSize * 2 - sizeof(TableHeader);
+                flush();
+                unmap();
+                if (!map(size)) {
+                    std::fprintf(stderr, "Cannot grow the table to %zu bytes\n", size);
+                    return false;
+                }
+            }
+            // The record first, then the count that makes it part of the table
+            records()[count] = record;
+            std::atomic_thread_fence(std::memory_order_release);
+            header()->count = count + 1;
+            return true;
+        }
+
+        void flush() {
+#ifdef _WIN32
+            FlushViewOfFile(memory, 0);
+            FlushFileBuffers(file);
+#else
+            msync(memory, mappedSize, MS_SYNC);
+#endif
+        }
+    };
+
+    // The table plus what it takes to query it: the rows sorted best first,
+    // and the replays already in it
+    class Board {
+    private:
+        std::mutex mutex;
+        Table table;
+        std::vector<uint32_t> ranking;
+        std::unordered_set<uint64_t> known;
+
+        // Higher score first; on a tie whoever got there first
+        bool better(uint32_t a, uint32_t b) const {
+            const TableRecord& ra = table.get(a);
+            const TableRecord& rb = table.get(b);
+            if (ra.score != rb.score) return ra.score > rb.score;
+            return a < b;
+        }
+
+    public:
+        bool open(const std::string& path) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!table.open(path)) return false;
+            uint32_t count = table.getCount();
+            ranking.resize(count);
+            for (uint32_t i = 0; i < count; i++) {
+                ranking[i] = i;
+                known.insert(table.get(i).replayHash);
+            }
+            std::sort(ranking.begin(), ranking.end(), [this](uint32_t a, uint32_t b) { return better(a, b); });
+            return true;
+        }
+
+        void close() {
+            std::lock_guard<std::mutex> lock(mutex);
+            table.close();
+        }
+
+        bool contains(uint64_t replayHash) {
+            std::lock_guard<std::mutex> lock(mutex);
+            return known.count(replayHash) != 0;
+        }
+
+        // Rank of the new entry (1 = best), or 0 if it was there already
+        size_t add(const TableRecord& record) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!known.insert(record.replayHash).second) return 0;
+            uint32_t row = table.getCount();
+            if (!table.append(record)) {
+                known.erase(record.replayHash);
+                return 0;
+            }
+            auto at = std::upper_bound(ranking.begin(), ranking.end(), row,
+                                       [this](uint32_t a, uint32_t b) { return better(a, b); });
+            size_t rank = at - ranking.begin() + 1;
+            ranking.insert(at, row);
+            return rank;
+        }
+
+        uint32_t getCount() {
+            std::lock_guard<std::mutex> lock(mutex);
+            return table.getCount();
+        }
+
+        void appendTop(std::string& out, int n) {
+            std::lock_guard<std::mutex> lock(mutex);
+            char line[160];
+            std::snprintf(line, sizeof(line), "%4s %9s  %-15s %7s %9s  %s\n", "rank", "score", "name", "players",
+                          "time", "submitted (UTC)");
+            out += line;
+            for (int i = 0; i < n && i < static_cast<int>(ranking.size()); i++) {
+                const TableRecord& r = table.get(ranking[i]);
+                char name[sizeof(r.name) + 1] = {};
+                std::memcpy(name, r.name, sizeof(r.name));
+                char date[32] = "?";
+                std::time_t when = static_cast<std::time_t>(r.submitted);
+                if (const std::tm* utc = std::gmtime(&when)) {
+                    std::strftime(date, sizeof(date), "%Y-%m-%d %H:%M", utc);
+                }
+                std::snprintf(line, sizeof(line), "%4d %9d  %-15s %7u %7.1f s  %s\n", i + 1, r.score, name,
+                              r.playerCount, r.runTime, date);
+                out += line;
+            }
+        }
+    };
+
+    struct Verdict {
+        bool verified;
+        const char* reason;
+    };
+
+    bool sameSettings(const DifficultySettings& a, const DifficultySettings& b) {
+        return a.obstacleSpawnTime == b.obstacleSpawnTime && a.spawnTimeRate == b.spawnTimeRate &&
+               a.speedRate == b.speedRate && a.colorWallSpawnTime == b.colorWallSpawnTime &&
+               a.maxObstacleSpeed == b.maxObstacleSpeed && a.minSpawnTime == b.minSpawnTime;
+    }
+
+    // Play the run again from its seed and inputs. It has to end on its last
+    // tick, with the score and run time it claims.
+    Verdict verify(Simulation& sim, Replay& replay) {
+        const ReplayHeader& header = replay.getHeader();
+        if (!sameSettings(header.difficulty, DifficultySettings())) {
+            return {false, "custom difficulty settings aren't ranked"};
+        }
+        sim.setDifficulty(header.difficulty);
+        sim.start(static_cast<int>(header.playerCount), header.seed);
+
+        SimInput in = SimInput();
+        replay.rewind();
+        while (replay.next(in)) {
+            if (sim.isOver()) return {false, "input after the run ended"};
+            sim.step(in);
+        }
+        if (!sim.isOver()) return {false, "the run doesn't end"};
+        if (sim.getScore() != header.score) return {false, "the score doesn't match"};
+        if (sim.getRunTime() != header.runTime) return {false, "the run time doesn't match"};
+        return {true, "verified"};
+    }
+
+    struct Job {
+        std::vector<uint8_t> bytes;
+        uint64_t hash;
+        uint32_t submitted;
+        int file;                   // Index into the --verify files, -1 for submissions
+    };
+
+    struct FileResult {
+        Verdict verdict;
+        std::string name;
+        int score;
+        float runTime;
+        float verifyMs;
+    };
+
+    // Worker threads taking runs off a queue. Each has its own Simulation
+    // (and coroutine frame pool), reused for every run it checks; only the
+    // pattern library is shared, read-only.
+    class Verifier {
+    private:
+        const PatternLibrary& library;
+        Board* board;
+        std::string replayDirectory;
+        std::vector<FileResult>* fileResults;
+
+        std::mutex mutex;
+        std::condition_variable wake;
+        std::condition_variable idle;
+        std::deque<Job> jobs;
+        size_t queuedBytes = 0;
+        int busy = 0;
+        bool stopping = false;
+        std::vector<std::thread> workers;
+
+        std::atomic<uint64_t> verified{0};
+        std::atomic<uint64_t> rejected{0};
+        std::atomic<uint64_t> playMicros{0};       // Play time of the verified runs
+        std::atomic<uint64_t> workMicros{0};       // Time spent verifying them
+
+        void workerLoop() {
+            Simulation sim;
+            sim.setPatternLibrary(&library);
+            sim.getEffects().setEnabled(false);
+            Replay replay;
+
+            std::unique_lock<std::mutex> lock(mutex);
+            while (true) {
+                wake.wait(lock, [this]() { return stopping || !jobs.empty(); });
+                // The queue is finished before the workers go
+                if (jobs.empty()) return;
+                Job job = std::move(jobs.front());
+                jobs.pop_front();
+                queuedBytes -= job.bytes.size();
+                busy++;
+                lock.unlock();
+
+                int64_t start = nowMicros();
+                Verdict verdict = replay.parse(job.bytes.data(), job.bytes.size())
+                                ? verify(sim, replay) : Verdict{false, "not a replay of this version"};
+                int64_t elapsed = nowMicros() - start;
+                finish(job, replay, verdict, elapsed);
+
+                lock.lock();
+                busy--;
+                if (jobs.empty() && busy == 0) idle.notify_all();
+            }
+        }
+
+        void finish(const Job& job, const Replay& replay, Verdict verdict, int64_t elapsed) {
+            const ReplayHeader& header = replay.getHeader();
+            if (verdict.verified) {
+                verified.fetch_add(1, std::memory_order_relaxed);
+                playMicros.fetch_add(static_cast<uint64_t>(header.runTime * 1e6f), std::memory_order_relaxed);
+                workMicros.fetch_add(static_cast<uint64_t>(elapsed), std::memory_order_relaxed);
+            } else {
+                rejected.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            if (job.file >= 0) {
+                (*fileResults)[job.file] = {verdict, replay.getName(), header.score, header.runTime, elapsed / 1000.0f};
+                return;
+            }
+
+            if (!verdict.verified) {
+                std::printf("Rejected %s, %d points: %s\n", replay.getName().c_str(), header.score, verdict.reason);
+                return;
+            }
+            TableRecord record = {};
+            record.score = header.score;
+            record.ticks = header.ticks;
+            record.runTime = header.runTime;
+            record.seed = header.seed;
+            record.submitted = job.submitted;
+            record.playerCount = header.playerCount;
+            record.replayHash = job.hash;
+            std::memcpy(record.name, header.name, sizeof(record.name));
+            size_t rank = board->add(record);
+            if (rank == 0) {
+                std::printf("Rejected %s, %d points: already on the board\n", replay.getName().c_str(), header.score);
+                return;
+            }
+            std::printf("Verified %s, %d points (%.1f s of play in %.1f ms) - rank %zu\n", replay.getName().c_str(),
+                        header.score, header.runTime, elapsed / 1000.0f, rank);
+            std::fflush(stdout);
+
+            if (!replayDirectory.empty()) {
+                char name[32];
+                std::snprintf(name, sizeof(name), "%016llx.csr", static_cast<unsigned long long>(job.hash));
+                std::string path = (std::filesystem::path(replayDirectory) / name).string();
+                if (std::FILE* out = std::fopen(path.c_str(), "wb")) {
+                    std::fwrite(job.bytes.data(), 1, job.bytes.size(), out);
+                    std::fclose(out);
+                }
+            }
+        }
+
+    public:
+        Verifier(const PatternLibrary& lib, Board* b, const std::string& replays, std::vector<FileResult>* files)
+            : library(lib), board(b), replayDirectory(replays), fileResults(files) {}
+
+        ~Verifier() { stop(); }
+
+        void start(int count) {
+            for (int i = 0; i < count; i++) {
+                workers.emplace_back(&Verifier::workerLoop, this);
+            }
+        }
+
+        void stop() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+            wake.notify_all();
+            for (std::thread& worker : workers) {
+                worker.join();
+            }
+            workers.clear();
+        }
+
+        // False if the queue is full; otherwise the place in the queue
+        size_t push(Job&& job) {
+            size_t position;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (jobs.size() >= MAX_QUEUE || queuedBytes + job.bytes.size() > MAX_QUEUE_BYTES) return 0;
+                queuedBytes += job.bytes.size();
+                jobs.push_back(std::move(job));
+                position = jobs.size();
+            }
+            wake.notify_one();
+            return position;
+        }
+
+        void waitIdle() {
+            std::unique_lock<std::mutex> lock(mutex);
+            idle.wait(lock, [this]() { return jobs.empty() && busy == 0; });
+        }
+
+        void appendStatus(std::string& out) {
+            size_t queued;
+            int checking;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                queued = jobs.size();
+                checking = busy;
+            }
+            uint64_t play = playMicros.load(std::memory_order_relaxed);
+            uint64_t work = workMicros.load(std::memory_order_relaxed);
+            char text[512];
+            std::snprintf(text, sizeof(text),
+                          "workers %zu\nqueued %zu\nverifying %d\nverified %llu\nrejected %llu\n"
+                          "speed %.0fx real time per worker\n",
+                          workers.size(), queued, checking,
+                          static_cast<unsigned long long>(verified.load(std::memory_order_relaxed)),
+                          static_cast<unsigned long long>(rejected.load(std::memory_order_relaxed)),
+                          work > 0 ? static_cast<double>(play) / work : 0.0);
+            out += text;
+        }
+    };
+
+    void respond(sf::TcpSocket& client, const char* status, const std::string& body) {
+        char head[256];
+        int headLength = std::snprintf(head, sizeof(head),
+                                       "HTTP/1.0 %s\r\nContent-Type: text/plain; charset=utf-8\r\n"
+                                       "Content-Length: %zu\r\nConnection: close\r\n\r\n", status, body.size());
+        if (client.send(head, headLength) == sf::Socket::Done) {
+            client.send(body.data(), body.size());
+        }
+        client.disconnect();
+    }
+
+    // Value of a request header (case-insensitive name), or -1
+    long long headerValue(const char* head, const char* name) {
+        size_t nameLength = std::strlen(name);
+        for (const char* line = std::strchr(head, '\n'); line; line = std::strchr(line + 1, '\n')) {
+            const char* p = line + 1;
+            size_t i = 0;
+            while (i < nameLength && p[i] && std::tolower(static_cast<unsigned char>(p[i])) == name[i]) i++;
+            if (i == nameLength && p[i] == ':') return std::atoll(p + i + 1);
+        }
+        return -1;
+    }
+
+    void answer(sf::TcpSocket& client, Verifier& verifier, Board& board, std::vector<uint8_t>& body,
+                std::string& page) {
+        // Read the request head (give up after a second - nobody can stall us)
+        char request[4096];
+        size_t length = 0;
+        size_t headLength = 0;
+        sf::SocketSelector selector;
+        selector.add(client);
+        while (headLength == 0) {
+            if (length == sizeof(request) - 1 || !selector.wait(sf::seconds(1.0f))) return;
+            size_t received = 0;
+            if (client.receive(request + length, sizeof(request) - 1 - length, received) != sf::Socket::Done) return;
+            length += received;
+            request[length] = '\0';
+            if (const char* end = std::strstr(request, "\r\n\r\n")) headLength = end + 4 - request;
+        }
+        request[headLength - 2] = '\0';
+
+        page.clear();
+        if (std::strncmp(request, "GET /top", 8) == 0 && (request[8] == ' ' || request[8] == '?')) {
+            const char* query = std::strstr(request, "n=");
+            int n = query && query < std::strchr(request, '\n') ? std::atoi(query + 2) : DEFAULT_TOP;
+            board.appendTop(page, std::max(1, std::min(MAX_TOP, n)));
+            respond(client, "200 OK", page);
+            return;
+        }
+        if (std::strncmp(request, "GET /status ", 12) == 0) {
+            verifier.appendStatus(page);
+            page += "entries " + std::to_string(board.getCount()) + "\n";
+            respond(client, "200 OK", page);
+            return;
+        }
+        if (std::strncmp(request, "POST /submit ", 13) != 0) {
+            respond(client, "404 Not Found", "Try /top, /status or POST /submit\n");
+            return;
+        }
+
+        long long contentLength = headerValue(request, "content-length");
+        if (contentLength <= 0 || static_cast<unsigned long long>(contentLength) > Replay::MAX_SIZE) {
+            respond(client, "413 Payload Too Large", "A replay of at most 16 MB, with its Content-Length\n");
+            return;
+        }
+        body.assign(reinterpret_cast<uint8_t*>(request) + headLength, reinterpret_cast<uint8_t*>(request) + length);
+        body.resize(static_cast<size_t>(contentLength));
+        size_t have = std::min(length - headLength, body.size());
+        while (have < body.size()) {
+            size_t received = 0;
+            if (!selector.wait(sf::seconds(5.0f)) ||
+                client.receive(body.data() + have, body.size() - have, received) != sf::Socket::Done) {
+                return;
+            }
+            have += received;
+        }
+
+        // Turn away what can't be ranked before it takes up a worker
+        Replay replay;
+        if (!replay.parse(body.data(), body.size())) {
+            respond(client, "400 Bad Request", "Not a replay of this version\n");
+            return;
+        }
+        uint64_t hash = StateHash::hash(body.data(), body.size());
+        if (board.contains(hash)) {
+            respond(client, "409 Conflict", "This run is on the board already\n");
+            return;
+        }
+        Job job{std::move(body), hash, static_cast<uint32_t>(std::time(nullptr)), -1};
+        size_t position = verifier.push(std::move(job));
+        if (position == 0) {
+            respond(client, "503 Service Unavailable", "Too many runs waiting - try again later\n");
+            return;
+        }
+        char text[128];
+        std::snprintf(text, sizeof(text), "%s, %d points queued for verification (%zu waiting)\n",
+                      replay.getName().c_str(), replay.getHeader().score, position);
+        respond(client, "202 Accepted", text);
+    }
+
+    int verifyFiles(const std::vector<std::string>& paths, const PatternLibrary& library, int workerCount) {
+        std::vector<FileResult> results(paths.size());
+        Verifier verifier(library, nullptr, "", &results);
+        std::vector<Job> jobs;
+        for (size_t i = 0; i < paths.size(); i++) {
+            Job job{{}, 0, 0, static_cast<int>(i)};
+            if (std::FILE* in = std::fopen(paths[i].c_str(), "rb")) {
+                uint8_t buffer[64 * 1024];
+                size_t read;
+                while ((read = std::fread(buffer, 1, sizeof(buffer), in)) > 0 && job.bytes.size() <= Replay::MAX_SIZE) {
+                    job.bytes.insert(job.bytes.end(), buffer, buffer + read);
+                }
+                std::fclose(in);
+            }
+            jobs.push_back(std::move(job));
+        }
+
+        // Everything is read before the clock starts
+        int64_t start = nowMicros();
+        verifier.start(workerCount);
+        for (Job& job : jobs) {
+            while (verifier.push(std::move(job)) == 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+        verifier.waitIdle();
+        double wallSeconds = (nowMicros() - start) / 1e6;
+
+        int failed = 0;
+        double playSeconds = 0;
+        for (size_t i = 0; i < paths.size(); i++) {
+            const FileResult& r = results[i];
+            if (!r.verdict.verified) failed++;
+            playSeconds += r.runTime;
+            std::printf("%s: %s - %s, %d points, %.1f s of play in %.1f ms\n", paths[i].c_str(), r.verdict.reason,
+                        r.name.c_str(), r.score, r.runTime, r.verifyMs);
+        }
+        std::printf("%zu runs, %d failed: %.0f s of play checked in %.2f s on %d workers (%.0fx real time)\n",
+                    paths.size(), failed, playSeconds, wallSeconds, workerCount,
+                    wallSeconds > 0 ? playSeconds / wallSeconds : 0.0);
+        return failed == 0 ? 0 : 1;
+    }
+}
+
+int main(int argc, char** argv) {
+    unsigned short port = LEADERBOARD_PORT;
+    std::string tablePath = "leaderboard.tbl";
+    std::string replayDirectory;
+    int workerCount = static_cast<int>(std::thread::hardware_concurrency());
+    bool verifyMode = false;
+    std::vector<std::string> files;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--port" && hasValue) {
+            int value = std::atoi(argv[++i]);
+            if (value <= 0 || value > 65535) {
+                std::fprintf(stderr, "Bad port %s\n", argv[i]);
+                return 2;
+            }
+            port = static_cast<unsigned short>(value);
+        } else if (arg == "--table" && hasValue) {
+            tablePath = argv[++i];
+        } else if (arg == "--workers" && hasValue) {
+            workerCount = std::atoi(argv[++i]);
+        } else if (arg == "--replays" && hasValue) {
+            replayDirectory = argv[++i];
+        } else if (arg == "--verify") {
+            verifyMode = true;
+        } else if (verifyMode && arg.compare(0, 2, "--") != 0) {
+            files.push_back(arg);
+        } else {
+            std::fprintf(stderr, "Usage: leaderboard [--port 9465] [--table leaderboard.tbl] [--workers N] "
+                                 "[--replays DIR]\n       leaderboard --verify [--workers N] run.csr ...\n");
+            return 2;
+        }
+    }
+    if (workerCount < 1) workerCount = 1;
+
+    // The same patterns the game plays, shared by every worker
+    PatternLibrary library;
+    if (ENABLE_PATTERNS && !library.loadFromFile(PATTERN_FILE)) {
+        std::fprintf(stderr, "Cannot load %s (run from the game's directory)\n", PATTERN_FILE.c_str());
+        return 2;
+    }
+
+    if (verifyMode) {
+        return verifyFiles(files, library, workerCount);
+    }
+
+    Board board;
+    if (!board.open(tablePath)) {
+        return 2;
+    }
+    if (!replayDirectory.empty()) {
+        std::error_code ec;
+        std::filesystem::create_directories(replayDirectory, ec);
+    }
+
+    sf::TcpListener listener;
+    if (listener.listen(port, sf::IpAddress::LocalHost) != sf::Socket::Done) {
+        std::fprintf(stderr, "Cannot listen on 127.0.0.1:%u\n", port);
+        return 2;
+    }
+
+    Verifier verifier(library, &board, replayDirectory, nullptr);
+    verifier.start(workerCount);
+    std::signal(SIGINT, onSignal);
+    std::signal(SIGTERM, onSignal);
+    std::printf("Leaderboard: %s, %u entries, %d workers, http://127.0.0.1:%u/top\n", tablePath.c_str(),
+                board.getCount(), workerCount, port);
+    std::fflush(stdout);
+
+    // One request at a time - the slow part (verification) is on the workers.
+    // The selector wakes up now and then to notice Ctrl+C.
+    sf::SocketSelector selector;
+    selector.add(listener);
+    std::vector<uint8_t> body;
+    std::string page;
+    while (!stopRequested) {
+        if (!selector.wait(sf::milliseconds(250))) continue;
+        sf::TcpSocket client;
+        if (listener.accept(client) == sf::Socket::Done) {
+            answer(client, verifier, board, body, page);
+        }
+    }
+
+    std::printf("Finishing the queue...\n");
+    verifier.stop();
+    board.close();
+    return 0;
+}
@@ -0,0 +1,212 @@
+// Spectator - shows a running game on another screen. Maps the game's
+// shared-memory feed (see SpectatorFeed.h; start the game with
+// --spectator-feed) and draws the newest frame at its own frame rate and
+// resolution: obstacles, players, power-ups, bullets, particles and the HUD.
+// Trails, lighting and bloom are left out. Start as many as there are screens;
+// a slow or frozen spectator never holds the game up.
+//
+// Build:  g++ -std=c++20 -O2 -Iinclude tools/spectator.cpp src/SpectatorFeed.cpp src/UIManager.cpp
+//             src/FontAtlas.cpp src/BakedText.cpp src/NumberText.cpp
+//             -lsfml-graphics -lsfml-window -lsfml-system -o spectator
+//         (add -lrt on older Linux for shm_open)
+// Usage:  spectator [--size 1920x1080] [--fps 60] [--fullscreen]
+
+#include "SpectatorFeed.h"
+#include "UIManager.h"
+#include "FontAtlas.h"
+#include "BakedText.h"
+#include <SFML/Graphics.hpp>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace {
+    const float RECONNECT_TIME = 1.0f;      // Seconds between attempts to find the game
+    const float STALE_TIME = 2.0f;          // No new frame for this long: look for a new game
+    const int ROUND_SEGMENTS = 16;
+
+    // Same letterboxing as the game
+    sf::View letterbox(unsigned windowWidth, unsigned windowHeight) {
+        float gameAspect = static_cast<float>(WINDOW_WIDTH) / WINDOW_HEIGHT;
+        float windowAspect = static_cast<float>(windowWidth) / windowHeight;
+        sf::FloatRect viewport(0, 0, 1, 1);
+        if (windowAspect > gameAspect) {
+            viewport.width = gameAspect / windowAspect;
+            viewport.left = (1 - viewport.width) / 2;
+        } else {
+            viewport.height = windowAspect / gameAspect;
+            viewport.top = (1 - viewport.height) / 2;
+        }
+        sf::View view(sf::FloatRect(0, 0, WINDOW_WIDTH, WINDOW_HEIGHT));
+        view.setViewport(viewport);
+        return view;
+    }
+
+    void addTriangle(std::vector<sf::Vertex>& out, sf::Vector2f a, sf::Vector2f b, sf::Vector2f c, sf::Color color) {
+        out.emplace_back(a, color);
+        out.emplace_back(b, color);
+        out.emplace_back(c, color);
+    }
+
+    void addBox(std::vector<sf::Vertex>& out, float x, float y, float halfW, float halfH, float degrees, sf::Color color) {
+        float radians = degrees * 3.14159265f / 180.0f;
+        float c = std::cos(radians);
+        float s = std::sin(radians);
+        sf::Vector2f center(x, y);
+        sf::Vector2f u(c * halfW, s * halfW);
+        sf::Vector2f v(-s * halfH, c * halfH);
+        addTriangle(out, center - u - v, center + u - v, center + u + v, color);
+        addTriangle(out, center - u - v, center + u + v, center - u + v, color);
+    }
+
+    void addRound(std::vector<sf::Vertex>& out, float x, float y, float radius, sf::Color color) {
+        sf::Vector2f center(x, y);
+        for (int i = 0; i < ROUND_SEGMENTS; i++) {
+            float a0 = i * 2 * 3.14159265f / ROUND_SEGMENTS;
+            float a1 = (i + 1) * 2 * 3.14159265f / ROUND_SEGMENTS;
+            addTriangle(out, center, center + radius * sf::Vector2f(std::cos(a0), std::sin(a0)),
+                        center + radius * sf::Vector2f(std::cos(a1), std::sin(a1)), color);
+        }
+    }
+
+    // Solid shapes (entities, then bullets) and additive particles, as the game layers them
+    void buildScene(const SpectatorFrame& frame, std::vector<sf::Vertex>& solid, std::vector<sf::Vertex>& glow) {
+        solid.clear();
+        glow.clear();
+        for (uint32_t i = 0; i < frame.entityCount; i++) {
+            const SpectatorEntity& e = frame.entities[i];
+            if (e.shape == SpectatorShape::ROUND) {
+                if (e.outline > 0) addRound(solid, e.x, e.y, e.halfWidth + e.outline, sf::Color(e.outlineColor));
+                addRound(solid, e.x, e.y, e.halfWidth, sf::Color(e.color));
+            } else {
+                if (e.outline > 0) {
+                    addBox(solid, e.x, e.y, e.halfWidth + e.outline, e.halfHeight + e.outline, e.rotation,
+                           sf::Color(e.outlineColor));
+                }
+                addBox(solid, e.x, e.y, e.halfWidth, e.halfHeight, e.rotation, sf::Color(e.color));
+            }
+        }
+        for (uint32_t i = 0; i < frame.bulletCount; i++) {
+            const SpectatorDot& b = frame.bullets[i];
+            addBox(solid, b.x, b.y, b.size, b.size, 45.0f, sf::Color(b.color));
+        }
+        for (uint32_t i = 0; i < frame.particleCount; i++) {
+            const SpectatorDot& p = frame.particles[i];
+            addBox(glow, p.x, p.y, p.size * 0.7f, p.size * 0.7f, 0.0f, sf::Color(p.color));
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    unsigned width = 1280;
+    unsigned height = 720;
+    int fps = 60;
+    bool fullscreen = false;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--size") == 0 && i + 1 < argc) {
+            if (std::sscanf(argv[++i], "%ux%u", &width, &height) != 2 || width == 0 || height == 0) {
+                std::fprintf(stderr, "--size wants WIDTHxHEIGHT\n");
+                return 1;
+            }
+        } else if (std::strcmp(argv[i], "--fps") == 0 && i + 1 < argc) {
+            fps = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--fullscreen") == 0) {
+            fullscreen = true;
+        } else {
+            std::fprintf(stderr, "Unknown option %s (see the top of tools/spectator.cpp)\n", argv[i]);
+            return 1;
+        }
+    }
+
+    sf::VideoMode mode = fullscreen ? sf::VideoMode::getDesktopMode() : sf::VideoMode(width, height);
+    sf::RenderWindow window(mode, "Color Swap Runner - Spectator", fullscreen ? sf::Style::Fullscreen : sf::Style::Default);
+    window.setFramerateLimit(fps > 0 ? fps : 0);
+    sf::View screenView = letterbox(window.getSize().x, window.getSize().y);
+
+    SpectatorView feed;
+    std::unique_ptr<SpectatorFrame> frame = std::make_unique<SpectatorFrame>();   // Too big for the stack
+    bool haveFrame = false;
+    std::vector<sf::Vertex> solid, glow;
+    solid.reserve(64 * 1024);
+    glow.reserve(64 * 1024);
+
+    UIManager ui;
+    int shownPlayers = 0;
+    FontAtlas atlas;
+    BakedText waitingText;
+    waitingText.setFont(atlas, FontStyle::MEDIUM);
+    waitingText.setFillColor(sf::Color::White);
+    waitingText.setOutlineColor(sf::Color::Black);
+    waitingText.setString("Waiting for the game (start it with --spectator-feed)...");
+    sf::FloatRect bounds = waitingText.getLocalBounds();
+    waitingText.setOrigin(bounds.width / 2, bounds.height / 2);
+    waitingText.setPosition(WINDOW_WIDTH / 2.0f, WINDOW_HEIGHT / 2.0f);
+
+    sf::RectangleShape background(sf::Vector2f(WINDOW_WIDTH, WINDOW_HEIGHT));
+    background.setFillColor(COLOR_BACKGROUND);
+
+    sf::Clock sinceAttempt;
+    sf::Clock sinceFrame;
+    while (window.isOpen()) {
+        sf::Event event;
+        while (window.pollEvent(event)) {
+            if (event.type == sf::Event::Closed ||
+                (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Escape)) {
+                window.close();
+            } else if (event.type == sf::Event::Resized) {
+                screenView = letterbox(event.size.width, event.size.height);
+            }
+        }
+
+        // (Re)connect: the game may start after us, or restart with a new feed
+        if (!feed.isOpen() && sinceAttempt.getElapsedTime().asSeconds() >= RECONNECT_TIME) {
+            sinceAttempt.restart();
+            if (feed.open()) sinceFrame.restart();
+        }
+        if (feed.read(*frame)) {
+            haveFrame = true;
+            sinceFrame.restart();
+            buildScene(*frame, solid, glow);
+            ui.updateScore(frame->score);
+            ui.updateCombo(frame->combo);
+            ui.updateDashCooldown(frame->dashCooldown);
+            if (frame->playerCount != shownPlayers) {
+                shownPlayers = frame->playerCount;
+                ui.updatePlayerCount(shownPlayers);
+            }
+        } else if (feed.isOpen() && sinceFrame.getElapsedTime().asSeconds() >= STALE_TIME) {
+            feed.close();
+        }
+
+        window.clear(sf::Color::Black);
+        window.setView(screenView);
+        window.draw(background);
+
+        if (haveFrame) {
+            sf::View worldView = screenView;
+            if (frame->screen == SpectatorScreen::PLAYING) {
+                worldView.setCenter(WINDOW_WIDTH / 2.0f + frame->cameraX, WINDOW_HEIGHT / 2.0f + frame->cameraY);
+            }
+            window.setView(worldView);
+            if (!solid.empty()) window.draw(solid.data(), solid.size(), sf::Triangles);
+            if (!glow.empty()) window.draw(glow.data(), glow.size(), sf::Triangles, sf::RenderStates(sf::BlendAdd));
+
+            window.setView(screenView);
+            if (frame->screen == SpectatorScreen::MENU) {
+                ui.drawMenu(window);
+            } else if (frame->screen == SpectatorScreen::PLAYING) {
+                ui.drawGameUI(window);
+            } else {
+                ui.drawGameOver(window, frame->score);
+            }
+        } else {
+            window.setView(screenView);
+            window.draw(waitingText);
+        }
+        window.display();
+    }
+    return 0;
+}
@@ -0,0 +1,101 @@
+// State diff - compares two per-tick state hash logs (the game's
+// --state-hash FILE) and reports where the runs first stop agreeing.
+//
+// Build:  g++ -std=c++17 -O2 -Iinclude tools/state_diff.cpp src/StateHash.cpp -o state_diff
+// Usage:  state_diff a.sth b.sth
+//
+// Record both runs with the same --seed and the same inputs (e.g. --alloc-test,
+// which plays unattended); while hashing, the game steps a fixed 1/FPS. The first tick whose state hashes differ while the
+// step and inputs still match is the nondeterminism; the first field listed
+// for it is usually the one to look at. Exit code 0 if the logs agree, 1 if not.
+
+#include "StateHash.h"
+#include <cstdio>
+#include <vector>
+
+namespace {
+    void printFields(const StateHashRecord& a, const StateHashRecord& b, bool includeInput) {
+        for (int f = 0; f < STATE_FIELD_COUNT; f++) {
+            StateField field = static_cast<StateField>(f);
+            if (field == StateField::INPUT && !includeInput) continue;
+            if (a.fields[f] == b.fields[f]) continue;
+            std::printf("  %-11s %08x  %08x\n", StateHashLog::getFieldName(field), a.fields[f], b.fields[f]);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc != 3) {
+        std::fprintf(stderr, "Usage: state_diff a.sth b.sth\n");
+        return 2;
+    }
+
+    std::vector<StateHashRecord> a, b;
+    for (int i = 0; i < 2; i++) {
+        if (!StateHashLog::readFile(argv[i + 1], i == 0 ? a : b)) {
+            std::fprintf(stderr, "%s: not a state hash log (or another version)\n", argv[i + 1]);
+            return 2;
+        }
+    }
+
+    // First tick each field diverged on while the runs were still comparable
+    const size_t NONE = static_cast<size_t>(-1);
+    size_t firstDivergence[STATE_FIELD_COUNT];
+    for (size_t& d : firstDivergence) d = NONE;
+
+    size_t count = a.size() < b.size() ? a.size() : b.size();
+    size_t firstState = NONE;
+    size_t inputsDiffer = NONE;
+    for (size_t i = 0; i < count; i++) {
+        const StateHashRecord& ra = a[i];
+        const StateHashRecord& rb = b[i];
+        int input = static_cast<int>(StateField::INPUT);
+        if (ra.run != rb.run || ra.tick != rb.tick || ra.step != rb.step || ra.fields[input] != rb.fields[input]) {
+            inputsDiffer = i;
+            break;
+        }
+        for (int f = 0; f < STATE_FIELD_COUNT; f++) {
+            if (ra.fields[f] != rb.fields[f] && firstDivergence[f] == NONE) {
+                firstDivergence[f] = i;
+                if (firstState == NONE) firstState = i;
+            }
+        }
+    }
+
+    std::printf("%zu and %zu ticks\n", a.size(), b.size());
+
+    if (firstState != NONE) {
+        const StateHashRecord& ra = a[firstState];
+        std::printf("State diverges at run %u, tick %u (same step and inputs):\n", ra.run, ra.tick);
+        printFields(ra, b[firstState], false);
+        std::printf("First divergence per field:\n");
+        for (int f = 0; f < STATE_FIELD_COUNT; f++) {
+            if (firstDivergence[f] == NONE) continue;
+            std::printf("  %-11s run %u, tick %u\n", StateHashLog::getFieldName(static_cast<StateField>(f)),
+                        a[firstDivergence[f]].run, a[firstDivergence[f]].tick);
+        }
+    }
+
+    if (inputsDiffer != NONE) {
+        const StateHashRecord& ra = a[inputsDiffer];
+        const StateHashRecord& rb = b[inputsDiffer];
+        if (ra.run != rb.run || ra.tick != rb.tick) {
+            std::printf("Runs split at record %zu (run %u tick %u vs run %u tick %u) - one run ended early\n",
+                        inputsDiffer, ra.run, ra.tick, rb.run, rb.tick);
+        } else if (ra.step != rb.step) {
+            std::printf("Step differs at run %u, tick %u (%.6f vs %.6f s) - runs aren't comparable past here\n",
+                        ra.run, ra.tick, ra.step / 65536.0, rb.step / 65536.0);
+        } else {
+            std::printf("Inputs differ at run %u, tick %u - runs aren't comparable past here\n", ra.run, ra.tick);
+        }
+        printFields(ra, rb, true);
+    } else if (a.size() != b.size()) {
+        std::printf("One log stops after %zu ticks\n", count);
+    }
+
+    if (firstState == NONE && inputsDiffer == NONE && a.size() == b.size()) {
+        std::printf("Identical\n");
+        return 0;
+    }
+    return 1;
+}